@@ -73,6 +73,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <functional>
 #include <iostream>
 #include <iomanip>
@@ -81,6 +82,10 @@
 #include <vector>
 using namespace std;
 
+#if !defined(_MSC_VER) && !defined(__int64)
+#define __int64 long long
+#endif
+
 #define UTF16
 #ifdef UTF16
 	#define SIZEOFWCHAR_T 2
@@ -133,7 +138,7 @@ struct LittleEndian
 	#define READWRITE(Type) \
 	static void Read(const char* buffer, Type& retVal, int pos=0, int bytes=0)	\
 	{	\
-		retVal = Type(0);	\
+		retVal = (Type)0;	\
 		if (bytes == 0) bytes = sizeof(Type);	\
 		for (size_t i=0; i<bytes; ++i)	\
 		{	\
@@ -159,7 +164,7 @@ struct LittleEndian
 	}	\
 	static void Read(const vector<char>& buffer, Type& retVal, int pos=0, int bytes=0)	\
 	{	\
-		retVal = Type(0);	\
+		retVal = (Type)0;	\
 		if (bytes == 0) bytes = sizeof(Type);	\
 		for (size_t i=0; i<bytes; ++i)	\
 		{	\
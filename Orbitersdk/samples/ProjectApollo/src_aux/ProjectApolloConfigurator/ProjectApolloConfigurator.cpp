@@ -28,7 +28,7 @@
 #define ORBITER_MODULE
 // To force orbitersdk.h to use <fstream> in any compiler version
 #pragma include_alias( <fstream.h>, <fstream> )
-#include "orbitersdk.h"
+#include "Orbitersdk.h"
 #include <commctrl.h>
 #include "resource.h"
 #include <stdio.h>
@@ -66,6 +66,7 @@ static struct {
 	int Saturn_VESIM;
 	int Saturn_MaxTimeAcceleration;
 	int Saturn_MultiThread;
+	int Saturn_SystemsThread;
 	int Saturn_VAGCChecklistAutoSlow;
 	int Saturn_VAGCChecklistAutoEnabled;
 	int Saturn_VcInfoEnabled;
@@ -117,6 +118,8 @@ ProjectApolloConfigurator::ProjectApolloConfigurator (): LaunchpadItem ()
 			sscanf (line + 10, "%i", &gParams.Saturn_MaxTimeAcceleration);
 		} else if (!strnicmp (line, "MULTITHREAD", 11)) {
 			sscanf (line + 11, "%i", &gParams.Saturn_MultiThread);
+		} else if (!strnicmp (line, "SYSTEMSTHREAD", 13)) {
+			sscanf (line + 13, "%i", &gParams.Saturn_SystemsThread);
 		} else if (!strnicmp (line, "VAGCCHECKLISTAUTOSLOW", 21)) {
 			sscanf (line + 21, "%i", &gParams.Saturn_VAGCChecklistAutoSlow);
 		} else if (!strnicmp (line, "VAGCCHECKLISTAUTOENABLED", 24)) {
@@ -184,6 +187,10 @@ void ProjectApolloConfigurator::WriteConfig(FILEHANDLE hFile)
 	sprintf(cbuf, "MULTITHREAD %d", gParams.Saturn_MultiThread);
 	oapiWriteLine(hFile, cbuf);
 
+	// Not configurable in the dialog currently, kept as set in the file
+	sprintf(cbuf, "SYSTEMSTHREAD %d", gParams.Saturn_SystemsThread);
+	oapiWriteLine(hFile, cbuf);
+
 	sprintf(cbuf, "VAGCCHECKLISTAUTOSLOW %d", gParams.Saturn_VAGCChecklistAutoSlow);
 	oapiWriteLine(hFile, cbuf);
 
@@ -0,0 +1,348 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  Scoped Timing Profiler
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#include "profiler.h"
+
+#ifdef NASSP_PROFILE
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <chrono>
+#include <mutex>
+#include <vector>
+#include <string>
+#include <map>
+#include <algorithm>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#endif
+
+namespace Profiler
+{
+	//Number of events kept per thread
+	const int EVENT_BUFFER_SIZE = 65536;
+	//Number of frame markers kept
+	const int FRAME_BUFFER_SIZE = 16384;
+	//Maximum scope nesting depth
+	const int MAX_DEPTH = 64;
+
+	struct Event
+	{
+		const char *name;
+		int64_t start;
+		//-1 while the scope is open
+		int64_t end;
+		int depth;
+	};
+
+	struct Buffer
+	{
+		Buffer(int i) : id(i), head(0), depth(0), inuse(true) { events.resize(EVENT_BUFFER_SIZE); }
+
+		//Index in the thread list, used as thread ID in the output
+		int id;
+		std::vector<Event> events;
+		//Total number of events recorded
+		int64_t head;
+		//Event indizes of the open scopes
+		int64_t stack[MAX_DEPTH];
+		int depth;
+		//Owned by a running thread
+		bool inuse;
+	};
+
+	struct FrameMarker
+	{
+		int64_t start;
+		double simt;
+	};
+
+	struct State
+	{
+		State() : numframes(0), lastsimt(-1.0) { frames.resize(FRAME_BUFFER_SIZE); }
+
+		std::mutex lock;
+		//All thread buffers. Buffers of finished threads are handed to new threads, so short lived worker threads don't pile up
+		std::vector<Buffer*> buffers;
+		std::vector<FrameMarker> frames;
+		int64_t numframes;
+		double lastsimt;
+		std::string output;
+	};
+
+	//Never deleted, thread buffers can still be released while the module unloads
+	static State *state = new State();
+
+	static int64_t Now()
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	//Gives the thread buffer back when the thread ends
+	struct BufferHolder
+	{
+		BufferHolder() : buf(NULL) {}
+		~BufferHolder()
+		{
+			if (buf)
+			{
+				std::lock_guard<std::mutex> guard(state->lock);
+				buf->depth = 0;
+				buf->inuse = false;
+			}
+		}
+		Buffer *buf;
+	};
+
+	static thread_local BufferHolder holder;
+
+	static Buffer *GetBuffer()
+	{
+		if (holder.buf) return holder.buf;
+
+		std::lock_guard<std::mutex> guard(state->lock);
+		for (unsigned i = 0;i < state->buffers.size();i++)
+		{
+			if (state->buffers[i]->inuse == false)
+			{
+				state->buffers[i]->inuse = true;
+				holder.buf = state->buffers[i];
+				return holder.buf;
+			}
+		}
+		holder.buf = new Buffer((int)state->buffers.size());
+		state->buffers.push_back(holder.buf);
+		return holder.buf;
+	}
+
+	void Begin(const char *name)
+	{
+		Buffer *buf = GetBuffer();
+
+		if (buf->depth >= MAX_DEPTH)
+		{
+			//Still counted, so End stays balanced
+			buf->depth++;
+			return;
+		}
+
+		Event &ev = buf->events[buf->head % EVENT_BUFFER_SIZE];
+		ev.name = name;
+		ev.end = -1;
+		ev.depth = buf->depth;
+		buf->stack[buf->depth] = buf->head;
+		buf->depth++;
+		buf->head++;
+		//Read the clock last, so the bookkeeping isn't part of the measurement
+		ev.start = Now();
+	}
+
+	void End()
+	{
+		int64_t t = Now();
+		Buffer *buf = holder.buf;
+
+		if (buf == NULL || buf->depth <= 0) return;
+
+		buf->depth--;
+		if (buf->depth >= MAX_DEPTH) return;
+
+		int64_t idx = buf->stack[buf->depth];
+		//Only if the event hasn't been overwritten in the meantime
+		if (buf->head - idx <= EVENT_BUFFER_SIZE)
+		{
+			buf->events[idx % EVENT_BUFFER_SIZE].end = t;
+		}
+	}
+
+	void Frame(double simt)
+	{
+		int64_t t = Now();
+
+		std::lock_guard<std::mutex> guard(state->lock);
+		if (simt == state->lastsimt) return;
+		state->lastsimt = simt;
+		FrameMarker &f = state->frames[state->numframes % FRAME_BUFFER_SIZE];
+		f.start = t;
+		f.simt = simt;
+		state->numframes++;
+	}
+
+	void SetOutput(const char *name)
+	{
+		std::lock_guard<std::mutex> guard(state->lock);
+		state->output = name;
+	}
+
+	static std::string DefaultOutput()
+	{
+		std::string name = "ProjectApollo Profile";
+#ifdef _WIN32
+		HMODULE hModule = NULL;
+		char path[MAX_PATH];
+
+		//Name of the module this file is linked into
+		if (GetModuleHandleExA(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT, (LPCSTR)&DefaultOutput, &hModule) &&
+			GetModuleFileNameA(hModule, path, MAX_PATH) > 0)
+		{
+			std::string file = path;
+			size_t pos = file.find_last_of("\\/");
+			if (pos != std::string::npos) file = file.substr(pos + 1);
+			pos = file.find_last_of('.');
+			if (pos != std::string::npos) file = file.substr(0, pos);
+			name += " " + file;
+		}
+#endif
+		return name;
+	}
+
+	//Names can contain quotes in theory
+	static void WriteEscaped(FILE *fp, const char *s)
+	{
+		for (;*s;s++)
+		{
+			if (*s == '"' || *s == '\\') fputc('\\', fp);
+			fputc(*s, fp);
+		}
+	}
+
+	struct Aggregate
+	{
+		Aggregate() : calls(0), total(0), max(0) {}
+
+		int calls;
+		int64_t total;
+		int64_t max;
+	};
+
+	bool Dump()
+	{
+		std::lock_guard<std::mutex> guard(state->lock);
+
+		std::string name = state->output.empty() ? DefaultOutput() : state->output;
+		unsigned i;
+		int64_t j, first;
+		bool hasevents = false;
+
+		for (i = 0;i < state->buffers.size();i++)
+		{
+			if (state->buffers[i]->head > 0) hasevents = true;
+		}
+		if (hasevents == false) return true;
+
+		//Frame markers in order
+		std::vector<FrameMarker> frames;
+		int64_t firstframe = std::max<int64_t>(0, state->numframes - FRAME_BUFFER_SIZE);
+		for (j = firstframe;j < state->numframes;j++)
+		{
+			frames.push_back(state->frames[j % FRAME_BUFFER_SIZE]);
+		}
+
+		//Time origin of the trace
+		int64_t t0 = INT64_MAX;
+		for (i = 0;i < state->buffers.size();i++)
+		{
+			Buffer *buf = state->buffers[i];
+			first = std::max<int64_t>(0, buf->head - EVENT_BUFFER_SIZE);
+			if (buf->head > first)
+			{
+				t0 = std::min(t0, buf->events[first % EVENT_BUFFER_SIZE].start);
+			}
+		}
+
+		FILE *json = fopen((name + ".json").c_str(), "wt");
+		if (json == NULL) return false;
+
+		//frame, thread, scope path
+		std::map<int64_t, std::map<int, std::map<std::string, Aggregate>>> aggregates;
+		bool firstevent = true;
+
+		fprintf(json, "{\"traceEvents\":[\n");
+		for (i = 0;i < state->buffers.size();i++)
+		{
+			Buffer *buf = state->buffers[i];
+			std::string path[MAX_DEPTH];
+
+			first = std::max<int64_t>(0, buf->head - EVENT_BUFFER_SIZE);
+			for (j = first;j < buf->head;j++)
+			{
+				const Event &ev = buf->events[j % EVENT_BUFFER_SIZE];
+
+				//Events are in start order, so the parent is always the last event one level up
+				path[ev.depth] = ev.depth > 0 ? path[ev.depth - 1] + "/" + ev.name : ev.name;
+
+				//Still running
+				if (ev.end < 0) continue;
+
+				if (!firstevent) fprintf(json, ",\n");
+				firstevent = false;
+				fprintf(json, "{\"name\":\"");
+				WriteEscaped(json, ev.name);
+				fprintf(json, "\",\"ph\":\"X\",\"pid\":0,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}", buf->id, (double)(ev.start - t0) / 1000.0, (double)(ev.end - ev.start) / 1000.0);
+
+				//Frame number of the event, -1 before the first frame marker
+				int64_t frame = (int64_t)(std::upper_bound(frames.begin(), frames.end(), ev.start, [](int64_t t, const FrameMarker &f) { return t < f.start; }) - frames.begin()) - 1;
+				Aggregate &a = aggregates[frame][buf->id][path[ev.depth]];
+				a.calls++;
+				a.total += ev.end - ev.start;
+				a.max = std::max(a.max, ev.end - ev.start);
+			}
+		}
+		fprintf(json, "\n]}\n");
+		fclose(json);
+
+		FILE *csv = fopen((name + ".csv").c_str(), "wt");
+		if (csv == NULL) return false;
+
+		fprintf(csv, "frame,simt,thread,scope,calls,total_us,max_us\n");
+		for (auto &f : aggregates)
+		{
+			double simt = f.first >= 0 ? frames[f.first].simt : 0.0;
+			int64_t frame = f.first >= 0 ? f.first + firstframe : -1;
+			for (auto &t : f.second)
+			{
+				for (auto &s : t.second)
+				{
+					fprintf(csv, "%lld,%.3f,%d,\"%s\",%d,%.3f,%.3f\n", (long long)frame, simt, t.first, s.first.c_str(), s.second.calls,
+						(double)s.second.total / 1000.0, (double)s.second.max / 1000.0);
+				}
+			}
+		}
+		fclose(csv);
+
+		return true;
+	}
+
+	//Writes the files when the module is unloaded
+	struct AutoDump
+	{
+		~AutoDump() { Dump(); }
+	};
+
+	static AutoDump autodump;
+}
+
+#endif
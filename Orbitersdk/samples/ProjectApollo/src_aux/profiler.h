@@ -0,0 +1,90 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  Scoped Timing Profiler (Header)
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#pragma once
+
+//############################################################################//
+// Scoped timers for measuring where the frame time goes, in release builds as
+// well as debug builds. The profiler is only compiled in when NASSP_PROFILE is
+// defined, otherwise all macros expand to nothing and profiler.cpp is empty.
+//
+// PROFILESCOPE(s) times the rest of the enclosing scope. Scopes nest, the
+// nesting is kept and shows up as a path like "Saturn::SystemsTimestep/PCM".
+// s has to be a string literal, only the pointer is stored.
+//
+// PROFILEFRAME(simt) marks the start of a new simulation frame. Calling it
+// more than once with the same simt (e.g. from several vessels) is harmless.
+//
+// PROFILEDUMP() writes the recorded events. This also happens automatically
+// when the module is unloaded. Scopes still running on other threads during a
+// dump are skipped. Two files are written:
+//   <name>.json - Chrome trace format, open with chrome://tracing or Perfetto
+//   <name>.csv  - calls, total and maximum time per frame, thread and scope
+// The name defaults to "ProjectApollo Profile <module>" and can be changed
+// with PROFILEOUTPUT(name).
+//
+// Each thread records into its own ring buffer, so only the most recent
+// events are kept and no locking is needed while recording.
+//############################################################################//
+
+#ifdef NASSP_PROFILE
+
+namespace Profiler
+{
+	//Opens a scope on the calling thread
+	void Begin(const char *name);
+	//Closes the innermost scope of the calling thread
+	void End();
+	//Marks the start of the frame at simulation time simt
+	void Frame(double simt);
+	//Sets the output file name, without extension
+	void SetOutput(const char *name);
+	//Writes the recorded events to the output files. Returns false if the files couldn't be written
+	bool Dump();
+}
+
+class ProfileScope
+{
+public:
+	ProfileScope(const char *name) { Profiler::Begin(name); }
+	~ProfileScope() { Profiler::End(); }
+private:
+	ProfileScope(const ProfileScope &);
+	ProfileScope &operator=(const ProfileScope &);
+};
+
+#define PROFILE_CONCAT_(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_(a, b)
+#define PROFILESCOPE(s) ProfileScope PROFILE_CONCAT(profilescope_, __LINE__)(s);
+#define PROFILEFRAME(simt) Profiler::Frame(simt);
+#define PROFILEOUTPUT(s) Profiler::SetOutput(s);
+#define PROFILEDUMP() Profiler::Dump();
+
+#else
+
+#define PROFILESCOPE(s)
+#define PROFILEFRAME(simt)
+#define PROFILEOUTPUT(s)
+#define PROFILEDUMP()
+
+#endif
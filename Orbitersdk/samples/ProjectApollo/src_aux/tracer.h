@@ -26,6 +26,8 @@
 
   **************************************************************************/
 //############################################################################//
+#include "profiler.h"
+//############################################################################//
 class Tracer{
 public:
 	Tracer(char *s);
@@ -50,12 +52,15 @@ extern char trace_file[];
 // an error occurs, so you can't definitely rely on the "Done" message to tell
 // you that the function completely successfully... if you're not certain, then
 // put in another TRACE message just before it should exit.
+//
+// With NASSP_PROFILE defined, TRACESETUP also opens a profiler scope, so every
+// traced function shows up in the profile (see profiler.h).
 //############################################################################//
 #ifdef _DEBUG
-#define TRACESETUP(s) Tracer traceobj(s);
+#define TRACESETUP(s) Tracer traceobj(s); PROFILESCOPE(s)
 #define TRACE(s) {traceobj.print(s);}
 #else
-#define TRACESETUP(s)
+#define TRACESETUP(s) PROFILESCOPE(s)
 #define TRACE(s) {}
 #endif  
 //############################################################################//
@@ -26,6 +26,7 @@ See http://nassp.sourceforge.net/license/ for more details.
 
 #include <string>
 #include <sstream>
+#include <fstream>
 #include "Orbitersdk.h"
 
 #define DIRECTINPUT_VERSION 0x0800
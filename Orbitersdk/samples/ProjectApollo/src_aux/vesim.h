@@ -26,6 +26,7 @@ See http://nassp.sourceforge.net/license/ for more details.
 
 #define DIRECTINPUT_VERSION 0x0800
 #include "dinput.h"
+#include <vector>
 
 #define VESIM_INPUTTYPE_BUTTON 1
 #define VESIM_INPUTTYPE_AXIS   2
@@ -84,7 +85,7 @@ public:
 		value(defaultValue)
 	{};
 
-	int VesimInput::addConnection(int deviceID, int subdeviceType, int subdeviceID, int modifiers, bool reverse);
+	int addConnection(int deviceID, int subdeviceType, int subdeviceID, int modifiers, bool reverse);
 
 	friend class VesimDevice;
 	friend class Vesim;
@@ -123,7 +124,7 @@ private:
 	std::vector<VesimDevice> vdev;
 	std::vector<VesimDeviceInputConn> vconn;
 
-	bool Vesim::connectDeviceToInput(int inputidx, int deviceID, int subdeviceType, int subdeviceID, bool reverse, int modifiers);
+	bool connectDeviceToInput(int inputidx, int deviceID, int subdeviceType, int subdeviceID, bool reverse, int modifiers);
 public:
 	char* vesselStationName;
 	LPDIRECTINPUT8 dx8ppv;
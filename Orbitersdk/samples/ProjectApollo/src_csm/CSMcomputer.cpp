@@ -34,7 +34,7 @@
 
 #include "apolloguidance.h"
 #include "dsky.h"
-#include "csmcomputer.h"
+#include "CSMcomputer.h"
 #include "toggleswitch.h"
 #include "saturn.h"
 #include "ioChannels.h"
@@ -389,36 +389,42 @@ void CSMcomputer::ProcessChannel5(ChannelValue val){
 	Current.word = val.to_ulong();
 	Changed.word = (val.to_ulong() ^ LastOut5);	
 
+	//
+	// AGC clock time of this channel output, for the jet on time.
+	//
+
+	double t = GetCycleTime();
+
 	//
 	// Update any thrusters that have changed.
 	//
 
 	if (Changed.u.SMA3) {
-		sat->rjec.SetThruster(3,Current.u.SMA3 != 0);
+		sat->rjec.SetThruster(3,Current.u.SMA3 != 0,t);
 	}
 	if (Changed.u.SMA4) {
-		sat->rjec.SetThruster(2,Current.u.SMA4 != 0);
+		sat->rjec.SetThruster(2,Current.u.SMA4 != 0,t);
 	}
 
 	if (Changed.u.SMB3) {
-		sat->rjec.SetThruster(7,Current.u.SMB3 != 0);
+		sat->rjec.SetThruster(7,Current.u.SMB3 != 0,t);
 	}
 	if (Changed.u.SMB4) {
-		sat->rjec.SetThruster(6,Current.u.SMB4 != 0);
+		sat->rjec.SetThruster(6,Current.u.SMB4 != 0,t);
 	}
 
 	if (Changed.u.SMC3) {
-		sat->rjec.SetThruster(1,Current.u.SMC3 != 0);
+		sat->rjec.SetThruster(1,Current.u.SMC3 != 0,t);
 	}
 	if (Changed.u.SMC4) {
-		sat->rjec.SetThruster(4,Current.u.SMC4 != 0);
+		sat->rjec.SetThruster(4,Current.u.SMC4 != 0,t);
 	}
 
 	if (Changed.u.SMD3) {
-		sat->rjec.SetThruster(5,Current.u.SMD3 != 0);
+		sat->rjec.SetThruster(5,Current.u.SMD3 != 0,t);
 	}
 	if (Changed.u.SMD4) {
-		sat->rjec.SetThruster(8,Current.u.SMD4 != 0);
+		sat->rjec.SetThruster(8,Current.u.SMD4 != 0,t);
 	}
 
 	LastOut5 = val.to_ulong();
@@ -443,36 +449,42 @@ void CSMcomputer::ProcessChannel6(ChannelValue val){
 	Current.word = val.to_ulong();
 	Changed.word = (val.to_ulong() ^ LastOut6);	
 
+	//
+	// AGC clock time of this channel output, for the jet on time.
+	//
+
+	double t = GetCycleTime();
+
 	//
 	// Update any thrusters that have changed.
 	//
 
 	if (Changed.u.SMA1) {
-		sat->rjec.SetThruster(13,Current.u.SMA1 != 0);
+		sat->rjec.SetThruster(13,Current.u.SMA1 != 0,t);
 	}
 	if (Changed.u.SMA2) {
-		sat->rjec.SetThruster(14,Current.u.SMA2 != 0);
+		sat->rjec.SetThruster(14,Current.u.SMA2 != 0,t);
 	}
 
 	if (Changed.u.SMB1) {
-		sat->rjec.SetThruster(9,Current.u.SMB1 != 0);
+		sat->rjec.SetThruster(9,Current.u.SMB1 != 0,t);
 	}
 	if (Changed.u.SMB2) {
-		sat->rjec.SetThruster(12,Current.u.SMB2 != 0);
+		sat->rjec.SetThruster(12,Current.u.SMB2 != 0,t);
 	}
 
 	if (Changed.u.SMC1) {
-		sat->rjec.SetThruster(15,Current.u.SMC1 != 0);
+		sat->rjec.SetThruster(15,Current.u.SMC1 != 0,t);
 	}
 	if (Changed.u.SMC2) {
-		sat->rjec.SetThruster(16,Current.u.SMC2 != 0);
+		sat->rjec.SetThruster(16,Current.u.SMC2 != 0,t);
 	}
 
 	if (Changed.u.SMD1) {
-		sat->rjec.SetThruster(11,Current.u.SMD1 != 0);
+		sat->rjec.SetThruster(11,Current.u.SMD1 != 0,t);
 	}
 	if (Changed.u.SMD2) {
-		sat->rjec.SetThruster(10,Current.u.SMD2 != 0);
+		sat->rjec.SetThruster(10,Current.u.SMD2 != 0,t);
 	}
 
 	LastOut6 = val.to_ulong();
@@ -32,7 +32,7 @@
 #include "nasspsound.h"
 #include "toggleswitch.h"
 #include "apolloguidance.h"
-#include "csmcomputer.h"
+#include "CSMcomputer.h"
 #include "saturn.h"
 #include "LEM.h"
 #include "ioChannels.h"
@@ -1918,6 +1918,7 @@ void PCM::SystemTimestep(double simdt) {
 }
 
 void PCM::TimeStep(double simt){
+	PROFILESCOPE("PCM::TimeStep");
 	// This stuff has to happen every timestep, regardless of system status.
 	if(wsk_error != 0){
 		sprintf(oapiDebugString(),"%s",wsk_emsg);
@@ -1947,6 +1948,7 @@ void PCM::TimeStep(double simt){
 					generate_stream_lbr();
 					tx_offset++;
 				}
+				sat->tlmbus.AddPCM(tx_data, tx_size);
 				perform_io(simt);
 			}
 		}
@@ -1963,6 +1965,7 @@ void PCM::TimeStep(double simt){
 					generate_stream_hbr();
 					tx_offset++;
 				}			
+				sat->tlmbus.AddPCM(tx_data, tx_size);
 				perform_io(simt);
 			}
 		}
@@ -38,7 +38,7 @@
 
 #include "connector.h"
 
-#include "csmcomputer.h"
+#include "CSMcomputer.h"
 
 #include "iu.h"
 
@@ -756,6 +756,10 @@ bool CSMToLEMECSConnector::ConnectTo(Connector *other)
 
 	if (SaturnConnector::ConnectTo(other))
 	{
+		//The tunnel pipe connects both Panel SDKs, so the LM systems have to step together with ours
+		SystemsStepper *lmstepper = GetDockingSystemsStepper();
+		if (lmstepper) lmstepper->Link(OurVessel->GetSystemsStepper());
+
 		h_Pipe *cmpipe = OurVessel->GetCMTunnelPipe();
 		h_Pipe *lmpipe = GetDockingTunnelPipe();
 
@@ -770,6 +774,12 @@ bool CSMToLEMECSConnector::ConnectTo(Connector *other)
 
 void CSMToLEMECSConnector::Disconnect()
 {
+	SystemsStepper *lmstepper = GetDockingSystemsStepper();
+
+	//Waits for both systems steps
+	OurVessel->GetSystemsStepper()->Wait();
+	if (lmstepper) lmstepper->Link(NULL);
+
 	OurVessel->ConnectTunnelToCabinVent();
 	ConnectLMTunnelToCabinVent();
 	DisconnectCSMO2Hose();
@@ -792,6 +802,21 @@ h_Pipe* CSMToLEMECSConnector::GetDockingTunnelPipe()
 	return NULL;
 }
 
+SystemsStepper* CSMToLEMECSConnector::GetDockingSystemsStepper()
+{
+	ConnectorMessage cm;
+
+	cm.destination = type;
+	cm.messageType = 3;
+
+	if (SendMessage(cm))
+	{
+		return static_cast<SystemsStepper *> (cm.val1.pValue);
+	}
+
+	return NULL;
+}
+
 void CSMToLEMECSConnector::ConnectLMTunnelToCabinVent()
 {
 	ConnectorMessage cm;
@@ -819,11 +844,13 @@ h_Valve* CSMToLEMECSConnector::GetCSMO2HoseOutlet()
 
 void CSMToLEMECSConnector::ConnectCSMO2Hose()
 {
+	OurVessel->GetSystemsStepper()->Wait();
 	OurVessel->GetCSMO2Hose()->out = GetCSMO2HoseOutlet();
 }
 
 void CSMToLEMECSConnector::DisconnectCSMO2Hose()
 {
+	OurVessel->GetSystemsStepper()->Wait();
 	OurVessel->GetCSMO2Hose()->out = NULL;
 }
 
@@ -82,6 +82,7 @@ public:
 
 class h_Pipe;
 class h_Valve;
+class SystemsStepper;
 
 class CSMToLEMECSConnector : public SaturnConnector
 {
@@ -93,6 +94,7 @@ public:
 	void Disconnect();
 
 	h_Pipe* GetDockingTunnelPipe();
+	SystemsStepper* GetDockingSystemsStepper();
 	void ConnectLMTunnelToCabinVent();
 	h_Valve* GetCSMO2HoseOutlet();
 	virtual void ConnectCSMO2Hose();
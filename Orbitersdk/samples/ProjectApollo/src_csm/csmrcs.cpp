@@ -33,7 +33,7 @@
 #include "toggleswitch.h"
 #include "nasspdefs.h"
 #include "apolloguidance.h"
-#include "csmcomputer.h"
+#include "CSMcomputer.h"
 #include "ioChannels.h"
 #include "saturn.h"
 #include "papi.h"
@@ -66,6 +66,7 @@ public:
 	bool IsHardDocked();
 	bool IsExtended() { return (Status == DOCKINGPROBE_STATUS_EXTENDED); };
 	bool IsRetracted() { return (Status == DOCKINGPROBE_STATUS_RETRACTED); };
+	bool IsMoving() { return (ExtendingRetracting != 0); };
 	void SetEnabled(bool e) { Enabled = e; }
 	bool IsEnabled() { return Enabled; };
 	void DockEvent(int dock, OBJHANDLE connected);
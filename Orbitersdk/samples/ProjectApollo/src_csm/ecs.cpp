@@ -24,7 +24,7 @@
 
 // To force orbitersdk.h to use <fstream> in any compiler version
 #pragma include_alias( <fstream.h>, <fstream> )
-#include "orbitersdk.h"
+#include "Orbitersdk.h"
 #include <stdio.h>
 
 #include "PanelSDK/PanelSDK.h"
@@ -34,7 +34,7 @@
 #include "nasspdefs.h"
 #include "toggleswitch.h"
 #include "apolloguidance.h"
-#include "csmcomputer.h"
+#include "CSMcomputer.h"
 #include "ioChannels.h"
 
 #include "saturn.h"
@@ -302,6 +302,7 @@ CabinPressureReliefValve::CabinPressureReliefValve(Sound &plventsound) : postLan
 	inlet = NULL;
 	reliefPressure = 6.0 / PSI;
 	leakSize = 0; 
+	postLandingVentVolume = 0;
 }
 
 CabinPressureReliefValve::~CabinPressureReliefValve() {
@@ -320,6 +321,14 @@ void CabinPressureReliefValve::Init(h_Pipe *p, h_Pipe *i, Saturn *v, ThumbwheelS
 	sideHatch = sh;
 }
 
+void CabinPressureReliefValve::Timestep(double simdt) {
+
+	if (postLandingVentVolume > 0)
+		postLandingVentSound.play(LOOP, postLandingVentVolume);
+	else
+		postLandingVentSound.stop();
+}
+
 void CabinPressureReliefValve::SystemTimestep(double simdt) {
 
 	if (!pipe && !inlet) return;
@@ -330,7 +339,7 @@ void CabinPressureReliefValve::SystemTimestep(double simdt) {
 	bool hatchOpen = false;
 	double cabinPress = pipe->in->parent->space.Press;
 	if (sideHatch->IsOpen() && saturn->GetSystemsState() >= SATSYSTEMS_READYTOLAUNCH) { // Hatch disabled during GSE support
-		if (cabinPress > saturn->GetAtmPressure()) {
+		if (cabinPress > saturn->Panelsdk.GetAtmPressure()) {
 			pipe->in->Open();
 			pipe->in->size = (float) 100.;	// no pressure in a few seconds
 			pipe->flowMax = 2000. / LBH; 
@@ -339,7 +348,7 @@ void CabinPressureReliefValve::SystemTimestep(double simdt) {
 		} else {
 			inlet->in->Open();		
 			inlet->in->size = (float) 10.0;  // full pressure in a few seconds
-			inlet->P_max = saturn->GetAtmPressure();
+			inlet->P_max = saturn->Panelsdk.GetAtmPressure();
 			inlet->flowMax = 0; // no max. flow
 
 			pipe->in->Close(); 
@@ -349,7 +358,7 @@ void CabinPressureReliefValve::SystemTimestep(double simdt) {
 	} else if (sideHatch->GetVentValveRotary()->GetState() <= 3) {
 		double f = sideHatch->GetVentValveRotary()->GetState();
 		f = (4. - f) / 4.;
-		if (cabinPress > saturn->GetAtmPressure()) {
+		if (cabinPress > saturn->Panelsdk.GetAtmPressure()) {
 			pipe->in->Open();
 			pipe->in->size = (float) (20. * f);
 			pipe->flowMax = 250. / LBH * f;	// about 1 min from 5 psi to 0.1 psi
@@ -358,7 +367,7 @@ void CabinPressureReliefValve::SystemTimestep(double simdt) {
 		} else {
 			inlet->in->Open();		
 			inlet->in->size = (float) (1.0 * f);  // guessed in order to have reasonable reaction times in pressure
-			inlet->P_max = saturn->GetAtmPressure();
+			inlet->P_max = saturn->Panelsdk.GetAtmPressure();
 			inlet->flowMax = 0; // no max. flow
 
 			pipe->in->Close(); 
@@ -370,7 +379,7 @@ void CabinPressureReliefValve::SystemTimestep(double simdt) {
 	// Post Landing Vent
 	if (postLandingValve->IsDown() && !postLandingVent->IsDown() && postLandingPower->Voltage() > SP_MIN_DCVOLTAGE) {
 		if (!hatchOpen) {
-			if (cabinPress > saturn->GetAtmPressure()) {
+			if (cabinPress > saturn->Panelsdk.GetAtmPressure()) {
 				pipe->in->Open();
 				if (postLandingVent->IsUp()) {		// hi to lo is 1:1.5, rest is guessed in order to have reasonable reaction times in pressure
 					pipe->in->size = (float) 20.;
@@ -387,21 +396,21 @@ void CabinPressureReliefValve::SystemTimestep(double simdt) {
 				} else {
 					inlet->in->size = (float) 12.0;
 				}
-				inlet->P_max = saturn->GetAtmPressure();
+				inlet->P_max = saturn->Panelsdk.GetAtmPressure();
 				inlet->flowMax = 0; // no max. flow
 				pipe->in->Close();
 			}
 		}
 		if (postLandingVent->IsUp()) {
 			postLandingPower->DrawPower(25.5);	// systems handbook
-			postLandingVentSound.play(LOOP, 255); 
+			postLandingVentVolume = 255;
 		} else {
 			postLandingPower->DrawPower(22.1);	// systems handbook
-			postLandingVentSound.play(LOOP, 170); 
+			postLandingVentVolume = 170;
 		}
 		return;
 	}
-	postLandingVentSound.stop();
+	postLandingVentVolume = 0;
 	if (hatchOpen) return; 
 	
 	// Closed
@@ -418,7 +427,7 @@ void CabinPressureReliefValve::SystemTimestep(double simdt) {
 			inlet->in->Close();
 			closed = false;
 
-		} else if (cabinPress - saturn->GetAtmPressure() > reliefPressure) {
+		} else if (cabinPress - saturn->Panelsdk.GetAtmPressure() > reliefPressure) {
 			pipe->in->Open();
 			pipe->in->size = (float) 6.0;
 			// Normal
@@ -431,10 +440,10 @@ void CabinPressureReliefValve::SystemTimestep(double simdt) {
 			inlet->in->Close();
 			closed = false;
 
-		} else if (saturn->GetAtmPressure() - cabinPress > 25. / INH2O) {	// Systems handbook
+		} else if (saturn->Panelsdk.GetAtmPressure() - cabinPress > 25. / INH2O) {	// Systems handbook
 			inlet->in->Open();
 			inlet->in->size = (float) 15.0;
-			inlet->P_max = saturn->GetAtmPressure() - 25. / INH2O;
+			inlet->P_max = saturn->Panelsdk.GetAtmPressure() - 25. / INH2O;
 			// Normal
 			if (lever->GetState() == 1) {
 				inlet->flowMax = 30./ LBH; 
@@ -449,7 +458,7 @@ void CabinPressureReliefValve::SystemTimestep(double simdt) {
 
 	// Dump
 	} else if (lever->GetState() == 3) {
-		if (cabinPress > saturn->GetAtmPressure()) {
+		if (cabinPress > saturn->Panelsdk.GetAtmPressure()) {
 			pipe->in->Open();
 			pipe->in->size = (float) 6.0;
 			pipe->flowMax = 70./ LBH; // about 6 min from 3 psi to (almost) zero
@@ -458,7 +467,7 @@ void CabinPressureReliefValve::SystemTimestep(double simdt) {
 		} else {
 			inlet->in->Open();
 			inlet->in->size = (float) 15.0;
-			inlet->P_max = saturn->GetAtmPressure();
+			inlet->P_max = saturn->Panelsdk.GetAtmPressure();
 			inlet->flowMax = 150./ LBH; 
 		}
 	}
@@ -110,6 +110,7 @@ public:
 
 	void Init(h_Pipe *p, h_Pipe *i, Saturn *v, ThumbwheelSwitch *l, CircuitBrakerSwitch *plvlv, ThreePosSwitch *plv, e_object *plpower, SaturnSideHatch *sh);
 	void SystemTimestep(double simdt);
+	void Timestep(double simdt);
 	void SetLeakSize(double s);
 	void SetReliefPressurePSI(double p);
 	void LoadState(char *line);
@@ -125,6 +126,8 @@ protected:
 	e_object *postLandingPower;
 	SaturnSideHatch *sideHatch;
 	Sound &postLandingVentSound;
+	//Post landing vent sound volume set by SystemTimestep, 0 when off
+	int postLandingVentVolume;
 
 	double leakSize;
 	double reliefPressure;
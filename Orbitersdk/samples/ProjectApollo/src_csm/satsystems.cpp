@@ -35,7 +35,7 @@
 #include "toggleswitch.h"
 #include "apolloguidance.h"
 #include "dsky.h"
-#include "csmcomputer.h"
+#include "CSMcomputer.h"
 #include "iu.h"
 #include "saturn.h"
 #include "ioChannels.h"
@@ -55,6 +55,8 @@ void Saturn::SystemsInit() {
 	// initialize SPSDK
 	Panelsdk.RegisterVessel(this);
 	Panelsdk.InitFromFile("ProjectApollo\\SaturnSystems");
+	systemsStepper.SetStep([this](double dt) { SystemsInternalTimestep(dt); });
+	SystemsGraphInit();
 
 	//PanelsdkLogFile = fopen("ProjectApollo Saturn Systems.log", "w");
 
@@ -597,6 +599,24 @@ void Saturn::SystemsInit() {
 	rhc_auto = false;
 	thc_auto = false;
 	rhc_thctoggle_pressed = false;
+
+	//
+	// Systems values on the telemetry bus
+	//
+
+	tlmbus.AddValue("CabinPress", (double *)Panelsdk.GetPointerByString("HYDRAULIC:CABIN:PRESS"));
+	tlmbus.AddValue("CabinTemp", (double *)Panelsdk.GetPointerByString("HYDRAULIC:CABIN:TEMP"));
+	tlmbus.AddValue("SuitPress", (double *)Panelsdk.GetPointerByString("HYDRAULIC:SUIT:PRESS"));
+	tlmbus.AddValue("O2Tank1Press", (double *)Panelsdk.GetPointerByString("HYDRAULIC:O2TANK1:PRESS"));
+	tlmbus.AddValue("O2Tank2Press", (double *)Panelsdk.GetPointerByString("HYDRAULIC:O2TANK2:PRESS"));
+	tlmbus.AddValue("H2Tank1Press", (double *)Panelsdk.GetPointerByString("HYDRAULIC:H2TANK1:PRESS"));
+	tlmbus.AddValue("H2Tank2Press", (double *)Panelsdk.GetPointerByString("HYDRAULIC:H2TANK2:PRESS"));
+	tlmbus.AddValue("FuelCell1Volts", (double *)Panelsdk.GetPointerByString("ELECTRIC:FUELCELL1:VOLTS"));
+	tlmbus.AddValue("FuelCell1Amps", (double *)Panelsdk.GetPointerByString("ELECTRIC:FUELCELL1:AMPS"));
+	tlmbus.AddValue("FuelCell2Volts", (double *)Panelsdk.GetPointerByString("ELECTRIC:FUELCELL2:VOLTS"));
+	tlmbus.AddValue("FuelCell2Amps", (double *)Panelsdk.GetPointerByString("ELECTRIC:FUELCELL2:AMPS"));
+	tlmbus.AddValue("FuelCell3Volts", (double *)Panelsdk.GetPointerByString("ELECTRIC:FUELCELL3:VOLTS"));
+	tlmbus.AddValue("FuelCell3Amps", (double *)Panelsdk.GetPointerByString("ELECTRIC:FUELCELL3:AMPS"));
 }
 
 void Saturn::SetPipeMaxFlow(char *pipe, double flow) {
@@ -607,6 +627,8 @@ void Saturn::SetPipeMaxFlow(char *pipe, double flow) {
 
 void Saturn::SystemsTimestep(double simt, double simdt, double mjd) {
 
+	PROFILESCOPE("Saturn::SystemsTimestep");
+
 	//
 	// Don't clock the computer and the internal systems unless we're actually at pre-launch.
 	//
@@ -621,10 +643,21 @@ void Saturn::SystemsTimestep(double simt, double simdt, double mjd) {
 	else if (stage >= PRELAUNCH_STAGE) {
 
 		//
-		// Timestep the internal systems, there can be multiple systems timesteps in one Orbiter timestep
+		// Timestep the internal systems, there can be multiple systems timesteps in one Orbiter timestep.
+		// With the systems thread option this is done by the systems worker after clbkPostStep.
 		//
 
-		SystemsInternalTimestep(simdt);
+		if (!IsSystemsThread)
+		{
+			systemsStepper.Wait();
+			Panelsdk.UpdateEnvironment();
+			SystemsInternalTimestep(simdt);
+		}
+
+		//Sounds of the internal systems, the Orbiter API is only used on the main thread
+		CabinFansTimestep();
+		CabinPressureReliefValve1.Timestep(simdt);
+		CabinPressureReliefValve2.Timestep(simdt);
 
 		//
 		// Do the "normal" Orbiter timestep, some devices are done in clbkPostStep
@@ -1438,76 +1471,77 @@ void Saturn::SystemsTimestep(double simt, double simdt, double mjd) {
 #endif
 }
 
-void Saturn::SystemsInternalTimestep(double simdt) 
+void Saturn::SystemsGraphInit()
 
 {
-	TRACESETUP("Saturn::SystemsInternalTimestep");
-
-	double mintFactor = __max(simdt / 100.0, 0.5);
-	double tFactor = __min(mintFactor, simdt);
-	while (simdt > 0) {
-
-		// Each timestep is passed to the SPSDK
-		// to perform internal computations on the 
-		// systems.
+	systemsGraph.Add("Panelsdk", [this](double dt) { Panelsdk.StepSystems(dt); });
+	systemsGraph.Add("fdaiLeft", [this](double dt) { fdaiLeft.SystemTimestep(dt); });
+	systemsGraph.Add("fdaiRight", [this](double dt) { fdaiRight.SystemTimestep(dt); });
+	systemsGraph.Add("agc", [this](double dt) { agc.SystemTimestep(dt); });
+	systemsGraph.Add("dsky", [this](double dt) { dsky.SystemTimestep(dt); });
+	systemsGraph.Add("cws", [this](double dt) { cws.SystemTimestep(dt); });
+	systemsGraph.Add("dockingprobe", [this](double dt) { dockingprobe.SystemTimestep(dt); });
+	systemsGraph.Add("imu", [this](double dt) { imu.SystemTimestep(dt); });
+	systemsGraph.Add("bmag1", [this](double dt) { bmag1.SystemTimestep(dt); });
+	systemsGraph.Add("bmag2", [this](double dt) { bmag2.SystemTimestep(dt); });
+	systemsGraph.Add("gdc", [this](double dt) { gdc.SystemTimestep(dt); });
+	systemsGraph.Add("eca", [this](double dt) { eca.SystemTimestep(dt); });
+	systemsGraph.Add("rjec", [this](double dt) { rjec.SystemTimestep(dt); });
+	systemsGraph.Add("tvsa", [this](double dt) { tvsa.SystemTimestep(dt); });
+	systemsGraph.Add("optics", [this](double dt) { optics.SystemTimestep(dt); });
+	systemsGraph.Add("pcm", [this](double dt) { pcm.SystemTimestep(dt); });
+	systemsGraph.Add("pmp", [this](double dt) { pmp.SystemTimestep(dt); });
+	systemsGraph.Add("usb", [this](double dt) { usb.SystemTimestep(dt); });
+	systemsGraph.Add("hga", [this](double dt) { hga.SystemTimestep(dt); });
+	systemsGraph.Add("vhfranging", [this](double dt) { vhfranging.SystemTimestep(dt); });
+	systemsGraph.Add("RRTsystem", [this](double dt) { RRTsystem.SystemTimestep(dt); });
+	systemsGraph.Add("sce", [this](double dt) { sce.SystemTimestep(); });
+	systemsGraph.Add("ems", [this](double dt) { ems.SystemTimestep(dt); });
+	systemsGraph.Add("els", [this](double dt) { els.SystemTimestep(dt); });
+	systemsGraph.Add("ordeal", [this](double dt) { ordeal.SystemTimestep(dt); });
+	systemsGraph.Add("SPSPropellant", [this](double dt) { SPSPropellant.SystemTimestep(dt); });
+	systemsGraph.Add("SPSEngine", [this](double dt) { SPSEngine.SystemTimestep(dt); });
+	systemsGraph.Add("CabinPressureRegulator", [this](double dt) { CabinPressureRegulator.SystemTimestep(dt); });
+	systemsGraph.Add("O2DemandRegulator", [this](double dt) { O2DemandRegulator.SystemTimestep(dt); });
+	systemsGraph.Add("CabinPressureReliefValve1", [this](double dt) { CabinPressureReliefValve1.SystemTimestep(dt); });
+	systemsGraph.Add("CabinPressureReliefValve2", [this](double dt) { CabinPressureReliefValve2.SystemTimestep(dt); });
+	systemsGraph.Add("SuitCircuitReturnValve", [this](double dt) { SuitCircuitReturnValve.SystemTimestep(dt); });
+	systemsGraph.Add("O2SMSupply", [this](double dt) { O2SMSupply.SystemTimestep(dt); });
+	systemsGraph.Add("WaterController", [this](double dt) { WaterController.SystemTimestep(dt); });
+	systemsGraph.Add("GlycolCoolingController", [this](double dt) { GlycolCoolingController.SystemTimestep(dt); });
+	systemsGraph.Add("LMTunnelVent", [this](double dt) { LMTunnelVent.SystemTimestep(dt); }, SYSTEM_RATE_VALVE);
+	systemsGraph.Add("PressureEqualizationValve", [this](double dt) { PressureEqualizationValve.SystemTimestep(dt); }, SYSTEM_RATE_VALVE);
+	systemsGraph.Add("WasteStowageVentValve", [this](double dt) { WasteStowageVentValve.SystemTimestep(dt); }, SYSTEM_RATE_VALVE);
+	systemsGraph.Add("SaturnSuitFlowValve300", [this](double dt) { SaturnSuitFlowValve300.SystemTimestep(dt); }, SYSTEM_RATE_VALVE);
+	systemsGraph.Add("SaturnSuitFlowValve301", [this](double dt) { SaturnSuitFlowValve301.SystemTimestep(dt); }, SYSTEM_RATE_VALVE);
+	systemsGraph.Add("SaturnSuitFlowValve302", [this](double dt) { SaturnSuitFlowValve302.SystemTimestep(dt); }, SYSTEM_RATE_VALVE);
+	systemsGraph.Add("CabinFans", [this](double dt) { CabinFansSystemTimestep(); });
+	systemsGraph.Add("MissionTimerDisplay", [this](double dt) { MissionTimerDisplay.SystemTimestep(dt); });
+	systemsGraph.Add("MissionTimer306Display", [this](double dt) { MissionTimer306Display.SystemTimestep(dt); });
+	systemsGraph.Add("EventTimerDisplay", [this](double dt) { EventTimerDisplay.SystemTimestep(dt); });
+	systemsGraph.Add("EventTimer306Display", [this](double dt) { EventTimer306Display.SystemTimestep(dt); });
+
+	//Do all updates after the SDK has updated, so that power use will feed back to it
+	systemsGraph.AllAfter("Panelsdk");
+
+	//Systems that do nothing while they are unpowered or idle
+	systemsGraph.SetActive("fdaiLeft", [this]() { return fdaiLeft.IsPowered(); });
+	systemsGraph.SetActive("fdaiRight", [this]() { return fdaiRight.IsPowered(); });
+	systemsGraph.SetActive("dockingprobe", [this]() { return dockingprobe.IsMoving(); });
+	systemsGraph.SetActive("bmag1", [this]() { return bmag1.IsPowered(); });
+	systemsGraph.SetActive("bmag2", [this]() { return bmag2.IsPowered(); });
+	systemsGraph.SetActive("hga", [this]() { return hga.IsPowered(); });
+	systemsGraph.SetActive("vhfranging", [this]() { return vhfranging.IsPowered(); });
+	systemsGraph.SetActive("ems", [this]() { return !ems.IsOff(); });
+}
 
-		Panelsdk.SimpleTimestep(tFactor);
+void Saturn::SystemsInternalTimestep(double simdt) 
 
-		//
-		// Do all updates after the SDK has updated, so that power use
-		// will feed back to it.
-		//
+{
+	TRACESETUP("Saturn::SystemsInternalTimestep");
 
-		fdaiLeft.SystemTimestep(tFactor);
-		fdaiRight.SystemTimestep(tFactor);
-		agc.SystemTimestep(tFactor);
-		dsky.SystemTimestep(tFactor);
-		cws.SystemTimestep(tFactor);
-		dockingprobe.SystemTimestep(tFactor);
-		imu.SystemTimestep(tFactor);
-		bmag1.SystemTimestep(tFactor);
-		bmag2.SystemTimestep(tFactor);
-		gdc.SystemTimestep(tFactor);
-		eca.SystemTimestep(tFactor);
-		rjec.SystemTimestep(tFactor);
-		tvsa.SystemTimestep(tFactor);
-		optics.SystemTimestep(tFactor);
-		pcm.SystemTimestep(tFactor);
-		pmp.SystemTimestep(tFactor);
-		usb.SystemTimestep(tFactor);
-		hga.SystemTimestep(tFactor);
-		vhfranging.SystemTimestep(tFactor);
-		RRTsystem.SystemTimestep(tFactor);
-		sce.SystemTimestep();
-		ems.SystemTimestep(tFactor);
-		els.SystemTimestep(tFactor);
-		ordeal.SystemTimestep(tFactor);
-		SPSPropellant.SystemTimestep(tFactor);
-		SPSEngine.SystemTimestep(tFactor);
-		CabinPressureRegulator.SystemTimestep(tFactor);
-		O2DemandRegulator.SystemTimestep(tFactor);
-		CabinPressureReliefValve1.SystemTimestep(tFactor);
-		CabinPressureReliefValve2.SystemTimestep(tFactor);
-		SuitCircuitReturnValve.SystemTimestep(tFactor);
-		O2SMSupply.SystemTimestep(tFactor);
-		WaterController.SystemTimestep(tFactor);
-		GlycolCoolingController.SystemTimestep(tFactor);
-		LMTunnelVent.SystemTimestep(tFactor);
-		PressureEqualizationValve.SystemTimestep(tFactor);
-		WasteStowageVentValve.SystemTimestep(tFactor);
-		SaturnSuitFlowValve300.SystemTimestep(tFactor);
-		SaturnSuitFlowValve301.SystemTimestep(tFactor);
-		SaturnSuitFlowValve302.SystemTimestep(tFactor);
-		CabinFansSystemTimestep();
-		MissionTimerDisplay.SystemTimestep(tFactor);
-		MissionTimer306Display.SystemTimestep(tFactor);
-		EventTimerDisplay.SystemTimestep(tFactor);
-		EventTimer306Display.SystemTimestep(tFactor);
-
-		simdt -= tFactor;
-		tFactor = __min(mintFactor, simdt);
-		TRACE("Internal timestep done");
-	}
+	systemsGraph.Timestep(simdt, __max(simdt / 100.0, 0.5));
+	TRACE("Internal timestep done");
 
 	//Fuel Cell Reactant Heating  TBD heaters and regulators to feed reactant
 
@@ -2318,14 +2352,23 @@ void Saturn::CabinFansSystemTimestep()
 		PrimCabinHeatExchanger->SetPumpAuto();
 		SecCabinHeatExchanger->SetPumpAuto();
 		CabinHeater->SetPumpAuto(); 
-
-		CabinFanSound();
 	} 
 	else {
 		PrimCabinHeatExchanger->SetPumpOff();
 		SecCabinHeatExchanger->SetPumpOff();
 		CabinHeater->SetPumpOff(); 
+	}
+}
+
+void Saturn::CabinFansTimestep()
+
+{
+	// Sounds only, the fans are powered in CabinFansSystemTimestep
 
+	if (CabinFansActive()) {
+		CabinFanSound();
+	}
+	else {
 		StopCabinFanSound();
 	}
 
@@ -3409,6 +3452,8 @@ void Saturn::GetECSWaterStatus(ECSWaterStatus &ws)
 void Saturn::GetECSStatus(ECSStatus &ecs)
  
 {
+	systemsStepper.Wait();
+
 	// Crew
 	ecs.crewNumber = Crew->number;
 	ecs.crewStatus = CrewStatus.GetStatus();
@@ -3438,17 +3483,20 @@ void Saturn::GetECSStatus(ECSStatus &ecs)
 
 void Saturn::SetCrewNumber(int number) {
 
+	systemsStepper.Wait();
 	Crew->number = number;
 	SetCrewMesh();
 }
 
 void Saturn::SetPrimECSTestHeaterPowerW(double power) {
 
+	systemsStepper.Wait();
 	PrimECSTestHeater->boiler_power = power;
 }
 
 void Saturn::SetSecECSTestHeaterPowerW(double power) {
 
+	systemsStepper.Wait();
 	SecECSTestHeater->boiler_power = power;
 }
 
@@ -3735,6 +3783,12 @@ void Saturn::CutLESLegs()
 
 void Saturn::SetRCSState(int Quad, int Thruster, bool Active)
 
+{
+	SetRCSLevel(Quad, Thruster, Active ? 1.0 : 0.0);
+}
+
+void Saturn::SetRCSLevel(int Quad, int Thruster, double Level)
+
 {
 	//
 	// Sanity check.
@@ -3763,8 +3817,6 @@ void Saturn::SetRCSState(int Quad, int Thruster, bool Active)
 		break;
 	}
 
-	double Level = Active ? 1.0 : 0.0;
-
 	if (th)
 		SetThrusterLevel(th, Level);
 }
@@ -3772,10 +3824,15 @@ void Saturn::SetRCSState(int Quad, int Thruster, bool Active)
 void Saturn::SetCMRCSState(int Thruster, bool Active)
 
 {
-	double Level = Active ? 1.0 : 0.0;
+	SetCMRCSLevel(Thruster, Active ? 1.0 : 0.0);
+}
+
+void Saturn::SetCMRCSLevel(int Thruster, double Level)
+
+{
 	if (th_att_cm[Thruster] == NULL) return;  // Sanity check
 	SetThrusterLevel(th_att_cm[Thruster], Level);
-	th_att_cm_commanded[Thruster] = Active;  
+	th_att_cm_commanded[Thruster] = (Level > 0.0);
 }
 
 bool Saturn::GetCMRCSStateCommanded(THRUSTER_HANDLE th) {
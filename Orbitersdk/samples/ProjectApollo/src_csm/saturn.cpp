@@ -41,7 +41,7 @@
 #include "tracer.h"
 #include "sm.h"
 #include "sivb.h"
-#include "lemcomputer.h"
+#include "LEMcomputer.h"
 #include "LEM.h"
 #include "papi.h"
 #include "mcc.h"
@@ -53,9 +53,9 @@
 #include <crtdbg.h>
 
 extern "C" {
-#include <lua\lua.h>
-#include <lua\lualib.h>
-#include <lua\lauxlib.h>
+#include <lua/lua.h>
+#include <lua/lualib.h>
+#include <lua/lauxlib.h>
 }
 
 //
@@ -163,6 +163,7 @@ Saturn::Saturn(OBJHANDLE hObj, int fmodel) : ProjectApolloConnectorVessel (hObj,
 	scdu(agc, RegOPTX, 0140, 2),
 	tcdu(agc, RegOPTY, 0141, 2),
 	cws(SMasterAlarm, Bclick, Panelsdk),
+	tlmbus(NASSP_TLMBUS_CSM),
 	dockingprobe(0, SDockingCapture, SDockingLatch, SDockingExtend, SUndock, CrashBumpS, Panelsdk),
 	MissionTimerDisplay(Panelsdk),
 	MissionTimer306Display(Panelsdk),
@@ -356,8 +357,14 @@ Saturn::Saturn(OBJHANDLE hObj, int fmodel) : ProjectApolloConnectorVessel (hObj,
 Saturn::~Saturn()
 
 {
+	systemsStepper.Wait();
+
 	TRACESETUP("~Saturn");
 
+#ifdef NASSP_PROFILE
+	systemsGraph.WriteStats(GetName());
+#endif
+
 	if (sivb)
 	{
 		delete sivb;
@@ -752,6 +759,8 @@ void Saturn::initSaturn()
 	FovFixed = false;
 	FovExternal = false;
 	FovSave = 0;
+	IsMultiThread = false;
+	IsSystemsThread = false;
 
 	//
 	// Save the last view offset set.
@@ -1158,7 +1167,11 @@ void Saturn::clbkPreStep(double simt, double simdt, double mjd)
 
 {
 	char buffer[100];
+	PROFILEFRAME(simt);
 	TRACESETUP("Saturn::clbkPreStep");
+
+	// Frame barrier for the systems worker
+	systemsStepper.Wait();
 	sprintf(buffer, "MissionTime %f, simt %f, simdt %f, time(0) %lld", MissionTime, simt, simdt, time(0)); 
 	TRACE(buffer);
 
@@ -1227,6 +1240,9 @@ void Saturn::clbkPostStep (double simt, double simdt, double mjd)
 	sprintf(buffer, "MissionTime %f, simt %f, simdt %f, time(0) %lld", MissionTime, simt, simdt, time(0)); 
 	TRACE(buffer);
 
+	// A docked LM on the same worker may have started its step already
+	systemsStepper.Wait();
+
 	if (debugConnected == false)
 	{
 		sprintf(debugString(), "Please enable the Project Apollo MFD on the modules tab of the launchpad.");
@@ -1242,7 +1258,8 @@ void Saturn::clbkPostStep (double simt, double simdt, double mjd)
 		
 		SPSEngine.Timestep(simdt);
 
-		// Better acceleration measurement stability
+		// Better acceleration measurement stability.
+		// The IMU queues its CDU and PIPA counts here, agc.Timestep picks them up in the next clbkPreStep.
 		imu.Timestep(simdt);
 		tcdu.Timestep(simdt);
 		scdu.Timestep(simdt);
@@ -1264,6 +1281,24 @@ void Saturn::clbkPostStep (double simt, double simdt, double mjd)
 		MainPanelVC.OnPostStep(simt, simdt, mjd);
 	}
 
+	// Publish to the telemetry bus
+	if (tlmbus.BeginFrame(this, MissionTime))
+	{
+		tlmbus.SetDSKY(0, dsky);
+		tlmbus.SetDSKY(1, dsky2);
+		tlmbus.SetCWSLights(0, cws.GetLeftLightStates());
+		tlmbus.SetCWSLights(1, cws.GetRightLightStates());
+		tlmbus.EndFrame();
+	}
+
+	// With the systems thread option the internal systems step over the frame Orbiter has just integrated
+	// runs on the systems worker until the next clbkPreStep
+	if (IsSystemsThread && stage >= PRELAUNCH_STAGE && !GenericFirstTimestep)
+	{
+		Panelsdk.UpdateEnvironment();
+		systemsStepper.Start(simdt);
+	}
+
 	sprintf(buffer, "End time(0) %lld", time(0)); 
 	TRACE(buffer);
 }
@@ -1271,6 +1306,8 @@ void Saturn::clbkPostStep (double simt, double simdt, double mjd)
 void Saturn::clbkSaveState(FILEHANDLE scn)
 
 {
+	systemsStepper.Wait();
+
 	VESSEL2::clbkSaveState (scn);
 
 	int i = 1;
@@ -2138,6 +2175,11 @@ bool Saturn::ProcessConfigFileLine(FILEHANDLE scn, char *line)
 			sscanf (line+11, "%d", &value);
 			IsMultiThread=(value>0)?true:false;
 		}
+		else if (!strnicmp (line, "SYSTEMSTHREAD", 13)) {
+			int value;
+			sscanf (line+13, "%d", &value);
+			IsSystemsThread=(value>0)?true:false;
+		}
 		else if (!strnicmp(line, "NOMANUALTLI", 11)) {
 			//
 			// NOMANUALTLI isn't saved in the scenario, this is solely to allow you
@@ -2976,6 +3018,8 @@ void StageTransform(VESSEL *vessel, VESSELSTATUS *vs, VECTOR3 ofs, VECTOR3 vel)
 int Saturn::clbkConsumeDirectKey(char *kstate)
 
 {
+	systemsStepper.Wait();
+
 	if (KEYMOD_SHIFT(kstate) || KEYMOD_ALT(kstate)) {
 		return 0; 
 	}
@@ -3034,6 +3078,7 @@ int Saturn::clbkConsumeDirectKey(char *kstate)
 }
 
 int Saturn::clbkConsumeBufferedKey(DWORD key, bool down, char *kstate) {
+	systemsStepper.Wait();
 
 	if (FirstTimestep) return 0;
 
@@ -4757,6 +4802,8 @@ void Saturn::StartSeparationPyros()
 
 int Saturn::clbkGeneric (int msgid, int prm, void *context)
 {
+	systemsStepper.Wait();
+
 	switch (msgid) {
 	case VMSG_LUAINTERPRETER:
 		return Saturn::Lua_InitInterpreter (context);
@@ -50,6 +50,9 @@
 #include "secs.h"
 #include "scs.h"
 #include "csm_telecom.h"
+#include "TelemetryBus.h"
+#include "SystemsStepper.h"
+#include "SystemUpdateGraph.h"
 #include "sps.h"
 #include "ecs.h"
 #include "csmrcs.h"
@@ -57,7 +60,7 @@
 #include "MechanicalAccelerometer.h"
 #include "checklistController.h"
 #include "payload.h"
-#include "csmcomputer.h"
+#include "CSMcomputer.h"
 #include "qball.h"
 #include "canard.h"
 #include "siisystems.h"
@@ -78,6 +81,7 @@
 
 class IU;
 class SICSystems;
+class MCC;
 
 namespace mission
 {
@@ -871,6 +875,23 @@ public:
 	///
 	virtual void SetCMRCSState(int Thruster, bool Active);
 
+	///
+	/// Set the thrust level of a Service Module RCS thruster.
+	/// \brief SM RCS thruster level control.
+	/// \param Quad SM RCS thruster quad.
+	/// \param Thruster Thruster number in quad.
+	/// \param Level Fraction of the timestep the thruster is on.
+	///
+	void SetRCSLevel(int Quad, int Thruster, double Level);
+
+	///
+	/// Set the thrust level of a Command Module RCS thruster.
+	/// \brief CM RCS thruster level control.
+	/// \param Thruster Thruster number to control.
+	/// \param Level Fraction of the timestep the thruster is on.
+	///
+	void SetCMRCSLevel(int Thruster, double Level);
+
 	bool GetCMRCSStateCommanded(THRUSTER_HANDLE th);
 
 	char *getOtherVesselName() { return agc.OtherVesselName;};
@@ -1051,6 +1072,7 @@ public:
 
 	//CSM to LM interface functions
 	h_Pipe* GetCMTunnelPipe() { return CMTunnel; }
+	SystemsStepper *GetSystemsStepper() { return &systemsStepper; }
 	h_Pipe* GetCSMO2Hose();
 	void ConnectTunnelToCabinVent();
 	bool GetLMDesBatLVOn();
@@ -3559,6 +3581,13 @@ protected:
 	// Telecom equipment
 	DSE  dataRecorder;
 	PCM  pcm;
+	TelemetryBus tlmbus;
+
+	// Internal systems timestep worker for the systems thread option
+	SystemsStepper systemsStepper;
+
+	// Update order and rates of the internal systems
+	SystemUpdateGraph systemsGraph;
 	PMP	 pmp;
 	USB  usb;
 	HGA  hga;
@@ -3947,6 +3976,7 @@ protected:
 	double FovSave;
 	int maxTimeAcceleration;
 	bool IsMultiThread;
+	bool IsSystemsThread;
 
 	//
 	// Helpers for drawing the telescope and sextant reticles.
@@ -4077,6 +4107,7 @@ protected:
 	void CabinFanSound();
 	void StopCabinFanSound();
 	void CabinFansSystemTimestep();
+	void CabinFansTimestep();
 	void ButtonClick();
 	void GuardClick();
 	void SetView();
@@ -4088,6 +4119,7 @@ protected:
 	void StopMasterAlarm();
 	void GenericTimestep(double simt, double simdt, double mjd);
 	void SystemsInit();
+	void SystemsGraphInit();
 	void SystemsTimestep(double simt, double simdt, double mjd);
 	void SystemsInternalTimestep(double simdt);
 	void JoystickTimestep();
@@ -4547,6 +4579,7 @@ protected:
 	friend class DockingProbe;
 	friend class SaturnWaterController;
 	friend class SaturnGlycolCoolingController;
+	friend class CabinPressureReliefValve;
 	friend class CSMLMPowerSwitch;
 	friend class SaturnPanel382Cover;
 	friend class SaturnPanel600;
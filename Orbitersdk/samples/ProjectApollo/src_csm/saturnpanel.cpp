@@ -40,7 +40,7 @@
 #include "toggleswitch.h"
 #include "apolloguidance.h"
 #include "dsky.h"
-#include "csmcomputer.h"
+#include "CSMcomputer.h"
 #include "ioChannels.h"
 
 #include "saturn.h"
@@ -688,6 +688,7 @@ int Saturn::GetRenderViewportIsWideScreen() {
 }
 
 bool Saturn::clbkLoadPanel (int id) {
+	systemsStepper.Wait();
 
 	TRACESETUP("Saturn::clbkLoadPanel");
 
@@ -3602,6 +3603,8 @@ void DeletegParam() {
 bool Saturn::clbkPanelMouseEvent (int id, int event, int mx, int my)
 
 {
+	systemsStepper.Wait();
+
 	static int ctrl = 0;
 
 	//
@@ -4344,6 +4347,8 @@ void Saturn::RenderS1bEngineLight(bool EngineOn, SURFHANDLE dest, SURFHANDLE src
 bool Saturn::clbkPanelRedrawEvent(int id, int event, SURFHANDLE surf)
 
 {
+	systemsStepper.Wait();
+
 	// Enable this to trace the redraws, but then it's running horrible slow!
 	// char tracebuffer[100];
 	// sprintf(tracebuffer, "Saturn::clbkPanelRedrawEvent id %i", id);
@@ -38,7 +38,7 @@
 #include "toggleswitch.h"
 #include "apolloguidance.h"
 #include "dsky.h"
-#include "csmcomputer.h"
+#include "CSMcomputer.h"
 #include "saturn.h"
 #include "saturnv.h"
 #include "tracer.h"
@@ -727,6 +727,8 @@ void Saturn::ReleaseSurfacesVC()
 
 bool Saturn::clbkLoadVC (int id)
 {
+	systemsStepper.Wait();
+
 	TRACESETUP("Saturn::clbkLoadVC");
 
 	// Set VC view to last saved position
@@ -1369,6 +1371,8 @@ void Saturn::RegisterActiveAreas() {
 // --------------------------------------------------------------
 bool Saturn::clbkVCMouseEvent (int id, int event, VECTOR3 &p)
 {
+	systemsStepper.Wait();
+
 	TRACESETUP("Saturn::clbkVCMouseEvent");
 	switch (id) {
 
@@ -1459,6 +1463,8 @@ bool Saturn::clbkVCMouseEvent (int id, int event, VECTOR3 &p)
 // --------------------------------------------------------------
 bool Saturn::clbkVCRedrawEvent (int id, int event, SURFHANDLE surf)
 {
+	systemsStepper.Wait();
+
 	TRACESETUP("Saturn::clbkVCRedrawEvent");
 	//int i;
 	SetCameraCatchAngle(5.0*RAD);
@@ -2991,10 +2991,14 @@ engineOffDelay(1.0)
 	SPSEnableB = false;
 	IGN1 = false;
 	IGN2 = false;
+	DutyCycleStart = 0.0;
 
 	int i = 0;
 	while (i < 20) {
 		ThrusterDemand[i] = false;
+		ThrusterTimed[i] = false;
+		ThrusterOnTime[i] = 0.0;
+		ThrusterOnCommand[i] = 0.0;
 		PoweredSwitch[i] = NULL;
 		i++;
 	}
@@ -3034,19 +3038,19 @@ bool RJEC::IsThrusterPowered(ThreePosSwitch *s) {
 	return false;
 }
 
-void RJEC::SetRCSState(int thruster, bool td, bool cm, int smquad, int smthruster, int cmthruster, ThreePosSwitch *s, bool lockout) {
+void RJEC::SetRCSState(int thruster, double td, bool cm, int smquad, int smthruster, int cmthruster, ThreePosSwitch *s, bool lockout) {
 
 	if (IsThrusterPowered(s) && !lockout) {
 		if (td != 0) { 
 			PoweredSwitch[thruster] = s;
 		}			
 		if (!cm || cmthruster < 0) {
-			sat->SetRCSState(smquad, smthruster, td); 
+			sat->SetRCSLevel(smquad, smthruster, td); 
 			if (cmthruster >= 0) {
 				sat->SetCMRCSState(cmthruster, false);
 			}
 		} else {
-			sat->SetCMRCSState(cmthruster, td);
+			sat->SetCMRCSLevel(cmthruster, td);
 			sat->SetRCSState(smquad, smthruster, false); 
 		}
 	} else {
@@ -3100,12 +3104,15 @@ void RJEC::TimeStep(double simdt){
 	*/
 
 	// Reset thruster power demand
-	bool td[20];
+	double td[20], duty[20];
 	int i;
+	double cycletime = sat->agc.GetCycleTime();
 	for (i = 0; i < 17; i++) {
-		td[i] = false;
+		td[i] = 0.0;
+		duty[i] = GetThrusterDutyCycle(i, cycletime);
 		PoweredSwitch[i] = NULL;
 	}
+	DutyCycleStart = cycletime;
 
 	//
 	// ACCEL CMD: ECA auto-control is inhibited. Auto fire commands are generated from the breakout switches.
@@ -3115,90 +3122,90 @@ void RJEC::TimeStep(double simdt){
 
 	if ((S18_1 || S18_2) && S10_1) {
 		if (sat->rhc1.GetMinusRollBreakoutSwitch() || sat->rhc2.GetMinusRollBreakoutSwitch()) {  // MINUS
-			td[10] = true;
-			td[12] = true;
-			td[14] = true;
-			td[16] = true;
+			td[10] = 1.0;
+			td[12] = 1.0;
+			td[14] = 1.0;
+			td[16] = 1.0;
 		}
 		if (sat->rhc1.GetPlusRollBreakoutSwitch() || sat->rhc2.GetPlusRollBreakoutSwitch()) { // PLUS
-			td[9] = true;
-			td[11] = true;
-			td[13] = true;
-			td[15] = true;
+			td[9] = 1.0;
+			td[11] = 1.0;
+			td[13] = 1.0;
+			td[15] = 1.0;
 		}
 	}
 	else
 	{
-		td[9] = ThrusterDemand[9];
-		td[10] = ThrusterDemand[10];
-		td[11] = ThrusterDemand[11];
-		td[12] = ThrusterDemand[12];
-		td[13] = ThrusterDemand[13];
-		td[14] = ThrusterDemand[14];
-		td[15] = ThrusterDemand[15];
-		td[16] = ThrusterDemand[16];
+		td[9] = duty[9];
+		td[10] = duty[10];
+		td[11] = duty[11];
+		td[12] = duty[12];
+		td[13] = duty[13];
+		td[14] = duty[14];
+		td[15] = duty[15];
+		td[16] = duty[16];
 	}
 
 	// Pitch
 
 	if ((S18_1 || S18_2) && S8_1) {
 		if (sat->rhc1.GetMinusPitchBreakoutSwitch() || sat->rhc2.GetMinusPitchBreakoutSwitch()) {  // MINUS
-			td[2] = true;
-			td[4] = true;
+			td[2] = 1.0;
+			td[4] = 1.0;
 		}
 		if (sat->rhc1.GetPlusPitchBreakoutSwitch() || sat->rhc2.GetPlusPitchBreakoutSwitch()) { // PLUS
-			td[1] = true;
-			td[3] = true;
+			td[1] = 1.0;
+			td[3] = 1.0;
 		}
 	}
 	else
 	{
-		td[1] = ThrusterDemand[1];
-		td[2] = ThrusterDemand[2];
-		td[3] = ThrusterDemand[3];
-		td[4] = ThrusterDemand[4];
+		td[1] = duty[1];
+		td[2] = duty[2];
+		td[3] = duty[3];
+		td[4] = duty[4];
 	}
 
 	// Yaw
 	
 	if ((S18_1 || S18_2) && S9_1) {
 		if (sat->rhc1.GetMinusYawBreakoutSwitch() || sat->rhc2.GetMinusYawBreakoutSwitch()) {  // MINUS
-			td[6] = true;
-			td[8] = true;
+			td[6] = 1.0;
+			td[8] = 1.0;
 		}
 		if (sat->rhc1.GetPlusYawBreakoutSwitch() || sat->rhc2.GetPlusYawBreakoutSwitch()) { // PLUS
-			td[5] = true;
-			td[7] = true;
+			td[5] = 1.0;
+			td[7] = 1.0;
 		}
 	}
 	else
 	{
-		td[5] = ThrusterDemand[5];
-		td[6] = ThrusterDemand[6];
-		td[7] = ThrusterDemand[7];
-		td[8] = ThrusterDemand[8];
+		td[5] = duty[5];
+		td[6] = duty[6];
+		td[7] = duty[7];
+		td[8] = duty[8];
 	}
 
 	// Ensure AC logic power, see Systems Handbook 8.2 
 	if (!sat->SIGCondDriverBiasPower1Switch.IsPowered()) {
-		td[1] = false;
-		td[2] = false;
-		td[4] = false;
-		td[6] = false;
-		td[8] = false;
-		td[9] = false;
-		td[12] = false;
-		td[14] = false;
+		td[1] = 0.0;
+		td[2] = 0.0;
+		td[4] = 0.0;
+		td[6] = 0.0;
+		td[8] = 0.0;
+		td[9] = 0.0;
+		td[12] = 0.0;
+		td[14] = 0.0;
 	}
 	if (!sat->SIGCondDriverBiasPower2Switch.IsPowered()) {
-		td[3] = false;
-		td[5] = false;
-		td[7] = false;
-		td[10] = false;
-		td[11] = false;
-		td[13] = false;
-		td[15] = false;
-		td[16] = false;
+		td[3] = 0.0;
+		td[5] = 0.0;
+		td[7] = 0.0;
+		td[10] = 0.0;
+		td[11] = 0.0;
+		td[13] = 0.0;
+		td[15] = 0.0;
+		td[16] = 0.0;
 	}
 
 	//
@@ -3213,32 +3220,32 @@ void RJEC::TimeStep(double simdt){
 
 	if ((S18_2 || thc_cw) && !sm_sep) {
 		if (sat->eca.thc_x < 16384) { // PLUS X
-			td[14] = true;
-			td[15] = true;
+			td[14] = 1.0;
+			td[15] = 1.0;
 		}
 		if (sat->eca.thc_x > 49152) { // MINUS X
-			td[16] = true;
-			td[13] = true;
+			td[16] = 1.0;
+			td[13] = 1.0;
 		}
 		if (sat->eca.thc_y > 49152) { // MINUS Y (FORWARD)
-			td[1] = true;
-			td[2] = true;
-			td[5] = true;
-			td[6] = true;
+			td[1] = 1.0;
+			td[2] = 1.0;
+			td[5] = 1.0;
+			td[6] = 1.0;
 		}
 		if (sat->eca.thc_y < 16384) { // PLUS Y (BACKWARD)
-			td[3] = true;
-			td[4] = true;
-			td[7] = true;
-			td[8] = true;
+			td[3] = 1.0;
+			td[4] = 1.0;
+			td[7] = 1.0;
+			td[8] = 1.0;
 		}
 		if (sat->eca.thc_z > 49152) { // MINUS Z (UP)
-			td[11] = true;
-			td[12] = true;
+			td[11] = 1.0;
+			td[12] = 1.0;
 		}
 		if (sat->eca.thc_z < 16384) { // PLUS Z (DOWN)
-			td[9] = true;
-			td[10] = true;
+			td[9] = 1.0;
+			td[10] = 1.0;
 		}
 	}
 
@@ -3296,7 +3303,7 @@ void RJEC::TimeStep(double simdt){
 	S25 = sat->ThrustOnButton.GetState() == 1 && scslogic1;
 	S26 = sat->dVThrust1Switch.Voltage() > SP_MIN_DCVOLTAGE;
 	S59 = sat->dVThrust2Switch.Voltage() > SP_MIN_DCVOLTAGE;
-	AB_X16 = td[1] && td[2] && td[5] && td[6];	//TBD: This can be done better with a THC class
+	AB_X16 = td[1] > 0.0 && td[2] > 0.0 && td[5] > 0.0 && td[6] > 0.0;	//TBD: This can be done better with a THC class
 	AB_X70 = sat->secs.MESCA.FireUllage() && sat->RCSLogicMnACircuitBraker.IsPowered();
 	AB_X71 = sat->secs.MESCB.FireUllage() && sat->RCSLogicMnBCircuitBraker.IsPowered();
 	DV_EMS_Set = sat->ems.IsdVMode() && sat->ems.GetdVRangeCounter() >= 0;
@@ -3338,9 +3345,48 @@ void RJEC::TimeStep(double simdt){
 void RJEC::SetThruster(int thruster, bool Active) {
 	if (thruster > 0 && thruster < 20) {
 		ThrusterDemand[thruster] = Active; // Next timestep does the work
+		ThrusterTimed[thruster] = false;
+		ThrusterOnTime[thruster] = 0.0;
 	}
 }
 
+void RJEC::SetThruster(int thruster, bool Active, double cycletime) {
+	if (thruster > 0 && thruster < 20) {
+		// Accumulate the on time between the jet commands, the AGC fires jets for less than a timestep
+		if (cycletime < DutyCycleStart) {
+			// AGC restart, the clock starts again at zero
+			DutyCycleStart = 0.0;
+		}
+		if (Active && !ThrusterDemand[thruster]) {
+			ThrusterOnCommand[thruster] = cycletime;
+		}
+		else if (!Active && ThrusterDemand[thruster] && ThrusterTimed[thruster]) {
+			ThrusterOnTime[thruster] += cycletime - max(ThrusterOnCommand[thruster], DutyCycleStart);
+		}
+		ThrusterDemand[thruster] = Active;
+		ThrusterTimed[thruster] = true;
+	}
+}
+
+double RJEC::GetThrusterDutyCycle(int thruster, double cycletime) {
+
+	double ontime, duty;
+
+	// Fraction of the AGC time since the last timestep the thruster was commanded on
+	if (!ThrusterTimed[thruster] || cycletime <= DutyCycleStart) {
+		// Untimed demand or no AGC cycles, e.g. after an AGC restart
+		duty = ThrusterDemand[thruster] ? 1.0 : 0.0;
+	} else {
+		ontime = ThrusterOnTime[thruster];
+		if (ThrusterDemand[thruster]) {
+			ontime += cycletime - max(ThrusterOnCommand[thruster], DutyCycleStart);
+		}
+		duty = min(1.0, max(0.0, ontime / (cycletime - DutyCycleStart)));
+	}
+	ThrusterOnTime[thruster] = 0.0;
+	return duty;
+}
+
 bool RJEC::GetThruster(int thruster) {
 	if (thruster > 0 && thruster < 20) {
 		return ThrusterDemand[thruster];
@@ -521,6 +521,7 @@ public: // Same stuff about speed and I'm lazy too.
 
 	bool GetThruster(int thruster);
 	void SetThruster(int thruster,bool Active);                     // Set Thruster Level for CMC
+	void SetThruster(int thruster, bool Active, double cycletime); // Same, timed with the AGC clock
 
 	bool GetSPSEnableA() { return SPSEnableA; }
 	bool GetSPSEnableB() { return SPSEnableB; }
@@ -542,6 +543,10 @@ protected:
 	DelayOffTimer engineOffDelay;
 
 	bool ThrusterDemand[20];                                        // Set when this thruster is requested to fire
+	bool ThrusterTimed[20];                                         // Set when the demand is timed with the AGC clock
+	double ThrusterOnTime[20];                                      // AGC time the thruster was on since the last timestep
+	double ThrusterOnCommand[20];                                   // AGC time of the last on command
+	double DutyCycleStart;                                          // AGC time of the last timestep
 	bool DirectPitchActive, DirectYawActive, DirectRollActive;      // Direct axis fire notification
 	bool SCSLatchUpA, SCSLatchUpB;
 	bool SPSEnableA, SPSEnableB;
@@ -550,7 +555,8 @@ protected:
 	Saturn *sat;
 	ThreePosSwitch *PoweredSwitch[20];                              // Set when power is drawn from this switch
 
-	void SetRCSState(int thruster, bool td, bool cm, int smquad, int smthruster, int cmthruster, ThreePosSwitch *s, bool lockout);
+	void SetRCSState(int thruster, double td, bool cm, int smquad, int smthruster, int cmthruster, ThreePosSwitch *s, bool lockout);
+	double GetThrusterDutyCycle(int thruster, double cycletime);
 	bool IsThrusterPowered(ThreePosSwitch *s);
 };
 
@@ -0,0 +1,139 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  Headless simulation driver
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+//############################################################################//
+// Runs a scenario without Orbiter at a fixed time step and writes the final
+// state as a new scenario:
+//
+//   nassp_headless <scenario> <dt> <duration> [<orbiter dir>] [<output scenario>]
+//
+// The driver changes to <orbiter dir>, where the vessel modules open their
+// configuration files like in Orbiter, and loads the modules from its
+// Modules directory as shared libraries. Modules and this driver are built
+// against src_headless instead of the Orbiter SDK, on Linux for example with
+//
+//   g++ -O2 -std=c++14 -DNASSP_PROFILE -Isrc_headless -Isrc_headless/posix
+//       -Isrc_aux -rdynamic src_headless/*.cpp src_headless/posix/*.cpp
+//       src_aux/profiler.cpp -ldl -lpthread -o nassp_headless
+//
+// and the modules with -shared -fPIC and the same include order, so that
+// the stand-ins in src_headless/posix replace windows.h and the DirectX
+// headers of src_aux. The SM for example builds with
+//
+//   g++ -O2 -std=c++14 -shared -fPIC -Isrc_headless -Isrc_headless/posix
+//       -Isrc_aux -Isrc_sys -Isrc_csm src_csm/sm.cpp src_csm/smjc.cpp
+//       src_sys/DelayTimer.cpp src_sys/soundlib.cpp src_sys/SoundTimeline.cpp
+//       -o Modules/ProjectApollo/sM.so
+//
+// The LEM and Saturn5 modules are built the same way from the sources of
+// their projects in Build/VC2017 and those of PanelSDK, with all source
+// directories and src_sys/PanelSDK/Internals in the include path and
+// -fpermissive for members named like their types. Their C sources (yaAGC,
+// yaAGS) are compiled with gcc. Building with NASSP_PROFILE writes the
+// timing of the profiled scopes on exit.
+//############################################################################//
+
+#include "HeadlessSim.h"
+#include "profiler.h"
+#include <string>
+#ifdef _WIN32
+#include <direct.h>
+#define getcwd _getcwd
+#define chdir _chdir
+#else
+#include <unistd.h>
+#endif
+
+//Makes a path given on the command line independent of the working directory
+static std::string AbsolutePath(const char *path)
+{
+	char cwd[MAX_PATH];
+
+	if (path[0] == '/' || path[0] == '\\' || (path[0] && path[1] == ':')) return path;
+	if (getcwd(cwd, MAX_PATH) == NULL) return path;
+	return std::string(cwd) + "/" + path;
+}
+
+int main(int argc, char *argv[])
+{
+	double dt, duration, t;
+	std::string scenario, output, debugstring;
+
+	if (argc < 4)
+	{
+		fprintf(stderr, "Usage: %s <scenario> <dt> <duration> [<orbiter dir>] [<output scenario>]\n", argv[0]);
+		return 1;
+	}
+
+	dt = atof(argv[2]);
+	duration = atof(argv[3]);
+	if (dt <= 0.0 || duration < 0.0)
+	{
+		fprintf(stderr, "Invalid time step or duration\n");
+		return 1;
+	}
+
+	scenario = AbsolutePath(argv[1]);
+	if (argc > 5) output = AbsolutePath(argv[5]);
+
+	//The vessel modules open their files relative to the Orbiter directory, as in Orbiter
+	HeadlessSim &sim = HeadlessSim::Instance();
+	if (argc > 4 && chdir(argv[4]))
+	{
+		fprintf(stderr, "Could not change to %s\n", argv[4]);
+		return 1;
+	}
+
+	if (sim.LoadScenario(scenario.c_str()))
+	{
+		fprintf(stderr, "Could not load scenario %s\n", argv[1]);
+		return 1;
+	}
+
+	PROFILEOUTPUT("ProjectApollo Profile Headless");
+
+	for (t = 0.0;t < duration - 0.5*dt;t += dt)
+	{
+		PROFILEFRAME(sim.simt);
+		{
+			PROFILESCOPE("HeadlessSim::Step");
+			sim.Step(dt);
+		}
+		//Vessels that set a debug string usually set it every frame, so only changes are printed
+		if (sim.debugstring[0] && debugstring != sim.debugstring)
+		{
+			printf("%.3f %s\n", sim.simt, sim.debugstring);
+		}
+		debugstring = sim.debugstring;
+		sim.debugstring[0] = '\0';
+	}
+
+	if (argc > 5 && sim.SaveScenario(output.c_str()))
+	{
+		fprintf(stderr, "Could not write scenario %s\n", argv[5]);
+	}
+
+	sim.Clear();
+	PROFILEDUMP();
+	return 0;
+}
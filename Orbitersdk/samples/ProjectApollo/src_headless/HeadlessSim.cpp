@@ -0,0 +1,937 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  Headless Simulation Core
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#include "HeadlessSim.h"
+#include <algorithm>
+
+#ifndef _WIN32
+#include <dlfcn.h>
+#endif
+
+//Converts between the right-handed ecliptic frame of the ephemerides and the left-handed Orbiter frame
+static inline VECTOR3 SwapYZ(const VECTOR3 &v)
+{
+	return _V(v.x, v.z, v.y);
+}
+
+//Removes leading and trailing whitespace
+static char *Trim(char *line)
+{
+	char *end;
+
+	while (*line == ' ' || *line == '\t') line++;
+	end = line + strlen(line);
+	while (end > line && (end[-1] == '\n' || end[-1] == '\r' || end[-1] == ' ' || end[-1] == '\t')) end--;
+	*end = '\0';
+	return line;
+}
+
+// ===========================================================================
+// Celestial bodies
+// ===========================================================================
+
+HeadlessBody::HeadlessBody() : HeadlessObject(OBJTP_PLANET)
+{
+	mass = size = 0.0;
+	parent = NULL;
+	a = e = i = 0.0;
+	LAN0 = LAN_dot = lp0 = lp_dot = L0 = L_dot = 0.0;
+	t0 = 51544.5;
+	T_p = 1.0;
+	L_0 = e_rel = phi_0 = T_s = e_ref = L_ref = 0.0;
+	soi = 1e30;
+	pos = vel = _V(0, 0, 0);
+	R = Obl = identity();
+	rotation = theta = 0.0;
+}
+
+void HeadlessBody::RelativeState(double mjd, VECTOR3 &r, VECTOR3 &v) const
+{
+	double dt, LAN, lp, L, w, M, E, dE, n, cosE, sinE, b, E_dot;
+	int k;
+
+	if (parent == NULL)
+	{
+		r = v = _V(0, 0, 0);
+		return;
+	}
+
+	dt = mjd - 51544.5;
+	LAN = LAN0 + LAN_dot * dt;
+	lp = lp0 + lp_dot * dt;
+	L = L0 + L_dot * dt;
+	w = lp - LAN;
+	M = fmod(L - lp, PI2);
+
+	//Kepler's equation
+	E = M;
+	for (k = 0;k < 20;k++)
+	{
+		dE = (E - e * sin(E) - M) / (1.0 - e * cos(E));
+		E -= dE;
+		if (fabs(dE) < 1e-14) break;
+	}
+
+	cosE = cos(E);
+	sinE = sin(E);
+	b = a * sqrt(1.0 - e * e);
+	n = L_dot / 86400.0;
+	E_dot = n / (1.0 - e * cosE);
+
+	//Perifocal frame
+	VECTOR3 rp = _V(a*(cosE - e), b*sinE, 0.0);
+	VECTOR3 vp = _V(-a * sinE*E_dot, b*cosE*E_dot, 0.0);
+
+	//Rz(LAN)*Rx(i)*Rz(w)
+	MATRIX3 Rw = _M(cos(w), -sin(w), 0, sin(w), cos(w), 0, 0, 0, 1);
+	MATRIX3 Ri = _M(1, 0, 0, 0, cos(i), -sin(i), 0, sin(i), cos(i));
+	MATRIX3 RO = _M(cos(LAN), -sin(LAN), 0, sin(LAN), cos(LAN), 0, 0, 0, 1);
+	MATRIX3 Q = mul(RO, mul(Ri, Rw));
+
+	r = mul(Q, rp);
+	v = mul(Q, vp);
+}
+
+void HeadlessBody::GetRotation(double mjd, MATRIX3 &Rot, MATRIX3 &Ob, double &phi, double &L_rel) const
+{
+	MATRIX3 Rot1, Rot2, R_ref, Rot3, Rot4, R_rel, R_rot;
+
+	if (T_s == 0.0)
+	{
+		Rot = Ob = identity();
+		phi = L_rel = 0.0;
+		return;
+	}
+
+	Rot1 = _M(cos(L_ref), 0, -sin(L_ref), 0, 1, 0, sin(L_ref), 0, cos(L_ref));
+	Rot2 = _M(1, 0, 0, 0, cos(e_ref), -sin(e_ref), 0, sin(e_ref), cos(e_ref));
+	R_ref = mul(Rot1, Rot2);
+	L_rel = L_0 + PI2 * (mjd - t0) / T_p;
+	Rot3 = _M(cos(L_rel), 0, -sin(L_rel), 0, 1, 0, sin(L_rel), 0, cos(L_rel));
+	Rot4 = _M(1, 0, 0, 0, cos(e_rel), -sin(e_rel), 0, sin(e_rel), cos(e_rel));
+	R_rel = mul(Rot3, Rot4);
+	phi = phi_0 + PI2 * (mjd - t0) / T_s + (L_0 - L_rel)*cos(e_rel);
+	R_rot = _M(cos(phi), 0, -sin(phi), 0, 1, 0, sin(phi), 0, cos(phi));
+	Ob = mul(R_ref, R_rel);
+	Rot = mul(Ob, R_rot);
+	phi = fmod(phi, PI2);
+	if (phi < 0.0) phi += PI2;
+}
+
+void HeadlessBody::Update(double mjd)
+{
+	VECTOR3 r, v;
+
+	RelativeState(mjd, r, v);
+	if (parent)
+	{
+		pos = parent->pos + SwapYZ(r);
+		vel = parent->vel + SwapYZ(v);
+	}
+	else
+	{
+		pos = vel = _V(0, 0, 0);
+	}
+	GetRotation(mjd, R, Obl, rotation, theta);
+}
+
+int HeadlessBody::clbkEphemeris(double mjd, int req, double *ret)
+{
+	VECTOR3 r, v;
+	int k;
+
+	for (k = 0;k < 12;k++)
+	{
+		ret[k] = 0.0;
+	}
+	if (parent == NULL)
+	{
+		return req & (EPHEM_TRUEPOS | EPHEM_TRUEVEL | EPHEM_BARYPOS | EPHEM_BARYVEL);
+	}
+
+	RelativeState(mjd, r, v);
+
+	if (parent->parent == NULL)
+	{
+		//Heliocentric, polar coordinates in AU like VSOP87
+		double rho2 = r.x*r.x + r.y*r.y;
+		double rad = length(r);
+
+		ret[0] = atan2(r.y, r.x);
+		if (ret[0] < 0.0) ret[0] += PI2;
+		ret[1] = atan2(r.z, sqrt(rho2));
+		ret[2] = rad / AU;
+		ret[3] = (r.x*v.y - r.y*v.x) / rho2;
+		ret[4] = (v.z*rho2 - r.z*(r.x*v.x + r.y*v.y)) / (sqrt(rho2)*rad*rad);
+		ret[5] = dotp(r, v) / rad / AU;
+		for (k = 0;k < 6;k++)
+		{
+			ret[k + 6] = ret[k];
+		}
+		return (req & (EPHEM_TRUEPOS | EPHEM_TRUEVEL | EPHEM_BARYPOS | EPHEM_BARYVEL)) | EPHEM_POLAR;
+	}
+
+	//Relative to the parent planet, cartesian in m like ELP82
+	for (k = 0;k < 3;k++)
+	{
+		ret[k] = ret[k + 6] = r.data[k];
+		ret[k + 3] = ret[k + 9] = v.data[k];
+	}
+	return req & (EPHEM_TRUEPOS | EPHEM_TRUEVEL | EPHEM_BARYPOS | EPHEM_BARYVEL);
+}
+
+// ===========================================================================
+// Vessels
+// ===========================================================================
+
+HeadlessVessel::HeadlessVessel() : HeadlessObject(OBJTP_VESSEL)
+{
+	iface = NULL;
+	exitfunc = NULL;
+	flightmodel = 1;
+	enablefocus = true;
+	emptymass = 0.0;
+	size = 1.0;
+	pmi = _V(1, 1, 1);
+	pos = vel = omega = _V(0, 0, 0);
+	R = identity();
+	landed = false;
+	rbody = NULL;
+	lng = lat = hdg = 0.0;
+	addforce = addtorque = _V(0, 0, 0);
+	thrust = torque = acc = _V(0, 0, 0);
+	defaultprop = NULL;
+	attmode = RCS_ROT;
+	navmodes = 0;
+	cog_elev = 0.0;
+	nmesh = nanim = 0;
+	namebuf[0] = classbuf[0] = '\0';
+}
+
+HeadlessVessel::~HeadlessVessel()
+{
+	unsigned k;
+
+	for (k = 0;k < groups.size();k++) delete groups[k];
+	for (k = 0;k < thrusters.size();k++) delete thrusters[k];
+	for (k = 0;k < propellants.size();k++) delete propellants[k];
+	for (k = 0;k < docks.size();k++) delete docks[k];
+	for (k = 0;k < attachments.size();k++) delete attachments[k];
+}
+
+double HeadlessVessel::GetMass() const
+{
+	double m = emptymass;
+
+	for (unsigned k = 0;k < propellants.size();k++)
+	{
+		m += propellants[k]->mass;
+	}
+	return m;
+}
+
+void HeadlessVessel::GetThrust(VECTOR3 &F, VECTOR3 &T) const
+{
+	F = addforce;
+	T = addtorque;
+	for (unsigned k = 0;k < thrusters.size();k++)
+	{
+		const HeadlessThruster *th = thrusters[k];
+		//Like in Orbiter, a thruster needs propellant
+		if (th->GetLevel() <= 0.0 || th->prop == NULL || th->prop->mass <= 0.0) continue;
+		VECTOR3 f = th->dir*th->GetLevel()*th->max0;
+		F += f;
+		T += crossp(th->pos, f);
+	}
+}
+
+void HeadlessVessel::ConsumePropellant(double dt)
+{
+	unsigned k;
+
+	for (k = 0;k < propellants.size();k++)
+	{
+		propellants[k]->flowrate = 0.0;
+	}
+	for (k = 0;k < thrusters.size();k++)
+	{
+		HeadlessThruster *th = thrusters[k];
+		double level = th->GetLevel();
+		th->level_ss = 0.0;
+		if (level <= 0.0 || th->prop == NULL || th->prop->mass <= 0.0 || th->isp0 <= 0.0) continue;
+		th->prop->flowrate += level*th->max0 / (th->isp0*th->prop->efficiency);
+	}
+	for (k = 0;k < propellants.size();k++)
+	{
+		HeadlessPropellant *p = propellants[k];
+		p->mass = std::max(0.0, p->mass - p->flowrate*dt);
+	}
+}
+
+void HeadlessVessel::UpdateLanded()
+{
+	const double h = 1.0;
+	double mjd = HeadlessSim::Instance().mjd;
+	double rad = rbody->size + HeadlessSim::Instance().elevation;
+	MATRIX3 Rm, Rp, Ob;
+	double phi, L_rel;
+
+	VECTOR3 up = _V(cos(lat)*cos(lng), sin(lat), cos(lat)*sin(lng));
+	VECTOR3 east = _V(-sin(lng), 0.0, cos(lng));
+	VECTOR3 north = _V(-sin(lat)*cos(lng), cos(lat), -sin(lat)*sin(lng));
+	VECTOR3 loc = up * rad;
+
+	pos = rbody->pos + mul(rbody->R, loc);
+	//Surface velocity from the planet rotation
+	rbody->GetRotation(mjd - h / 86400.0, Rm, Ob, phi, L_rel);
+	rbody->GetRotation(mjd + h / 86400.0, Rp, Ob, phi, L_rel);
+	vel = rbody->vel + (mul(Rp, loc) - mul(Rm, loc)) / (2.0*h);
+
+	//Vessel y axis up, z axis along the heading
+	VECTOR3 z = north * cos(hdg) + east * sin(hdg);
+	VECTOR3 x = crossp(up, z);
+	MATRIX3 Rloc = _M(x.x, up.x, z.x, x.y, up.y, z.y, x.z, up.z, z.z);
+	R = mul(rbody->R, Rloc);
+	omega = _V(0, 0, 0);
+}
+
+void HeadlessVessel::SetLanded(HeadlessBody *body)
+{
+	VECTOR3 loc = tmul(body->R, pos - body->pos);
+	VECTOR3 z = tmul(body->R, mul(R, _V(0, 0, 1)));
+
+	rbody = body;
+	landed = true;
+	lat = asin(loc.y / length(loc));
+	lng = atan2(loc.z, loc.x);
+
+	VECTOR3 east = _V(-sin(lng), 0.0, cos(lng));
+	VECTOR3 north = _V(-sin(lat)*cos(lng), cos(lat), -sin(lat)*sin(lng));
+	hdg = atan2(dotp(z, east), dotp(z, north));
+	if (hdg < 0.0) hdg += PI2;
+	UpdateLanded();
+}
+
+HeadlessBody *HeadlessVessel::FindGravityRef() const
+{
+	const std::vector<HeadlessBody*> &bodies = HeadlessSim::Instance().bodies;
+	HeadlessBody *ref = bodies[0];
+
+	for (unsigned k = 0;k < bodies.size();k++)
+	{
+		if (length(pos - bodies[k]->pos) < bodies[k]->soi && bodies[k]->soi < ref->soi)
+		{
+			ref = bodies[k];
+		}
+	}
+	return ref;
+}
+
+HeadlessBody *HeadlessVessel::GetHorizon(VECTOR3 &east, VECTOR3 &up, VECTOR3 &north) const
+{
+	HeadlessBody *ref = landed ? rbody : FindGravityRef();
+	if (ref->type != OBJTP_PLANET) return NULL;
+
+	//East is the direction the surface moves in, like in VESSEL::GetAirspeed
+	VECTOR3 axis = mul(ref->R, _V(0, 1, 0));
+	up = unit(pos - ref->pos);
+	east = unit(crossp(axis, up));
+	north = unit(axis - up * dotp(axis, up));
+	return ref;
+}
+
+HeadlessThrusterGroup *HeadlessVessel::FindGroup(THGROUP_TYPE thgt) const
+{
+	for (unsigned k = 0;k < groups.size();k++)
+	{
+		if (groups[k]->type == thgt) return groups[k];
+	}
+	return NULL;
+}
+
+// ===========================================================================
+// Simulation
+// ===========================================================================
+
+HeadlessSim &HeadlessSim::Instance()
+{
+	static HeadlessSim sim;
+	return sim;
+}
+
+HeadlessSim::HeadlessSim()
+{
+	HeadlessBody *sun = new HeadlessBody();
+	sun->type = OBJTP_STAR;
+	sun->name = "Sun";
+	sun->mass = 1.98855e30;
+	sun->size = 6.96e8;
+	bodies.push_back(sun);
+
+	HeadlessBody *earth = new HeadlessBody();
+	earth->name = "Earth";
+	earth->mass = 5.973698968e24;
+	earth->size = 6.37101e6;
+	earth->parent = sun;
+	earth->a = 1.00000261*AU;
+	earth->e = 0.01671123;
+	earth->lp0 = 102.93768193*RAD;
+	earth->lp_dot = 0.32327364*RAD / 36525.0;
+	earth->L0 = 100.46457166*RAD;
+	earth->L_dot = 35999.37244981*RAD / 36525.0;
+	earth->T_p = -9413040.4;
+	earth->L_0 = 0.00001553343;
+	earth->e_rel = 0.4090928023;
+	earth->phi_0 = 4.894942829;
+	earth->T_s = 86164.098904 / 86400.0;
+	earth->soi = 0.929e9;
+	bodies.push_back(earth);
+
+	HeadlessBody *moon = new HeadlessBody();
+	moon->name = "Moon";
+	moon->mass = 7.347664e22;
+	moon->size = 1.73757e6;
+	moon->parent = earth;
+	moon->a = 384400e3;
+	moon->e = 0.0549;
+	moon->i = 5.145*RAD;
+	moon->LAN0 = 125.1228*RAD;
+	moon->LAN_dot = -0.0529538083*RAD;
+	moon->lp0 = 83.1862*RAD;
+	moon->lp_dot = 0.1114035140*RAD;
+	moon->L0 = 218.3164477*RAD;
+	moon->L_dot = 13.17639648*RAD;
+	moon->T_p = -6793.468728092782;
+	moon->L_0 = 1.71817749;
+	moon->e_rel = 0.026699886264850;
+	moon->phi_0 = 4.769465382;
+	moon->T_s = 2360588.15 / 86400.0;
+	moon->e_ref = 7.259562816e-005;
+	moon->L_ref = 0.4643456618;
+	moon->soi = 66.1e6;
+	bodies.push_back(moon);
+
+	focus = NULL;
+	simt = 0.0;
+	simdt = 0.0;
+	mjd = 51544.5;
+	timeaccel = 1.0;
+	pause = false;
+	elevation = 0.0;
+	debugstring[0] = '\0';
+	rootdir = "./";
+	stepping = false;
+
+	UpdateBodies();
+}
+
+HeadlessSim::~HeadlessSim()
+{
+	Clear();
+	for (unsigned k = 0;k < bodies.size();k++)
+	{
+		delete bodies[k];
+	}
+}
+
+void HeadlessSim::SetRootDir(const std::string &dir)
+{
+	rootdir = dir;
+	if (!rootdir.empty() && rootdir[rootdir.size() - 1] != '/' && rootdir[rootdir.size() - 1] != '\\')
+	{
+		rootdir += "/";
+	}
+}
+
+std::string HeadlessSim::GetPath(const char *fname, PathRoot root) const
+{
+	static const char *subdir[] = { "", "Config/", "Scenarios/", "Textures/", "Textures2/", "Meshes/", "Modules/" };
+	std::string path = rootdir + subdir[root] + fname;
+
+#ifndef _WIN32
+	std::replace(path.begin(), path.end(), '\\', '/');
+#endif
+	return path;
+}
+
+void HeadlessSim::RegisterVesselClass(const char *classname, VESSEL_INIT_FUNC init, VESSEL_EXIT_FUNC exit)
+{
+	VesselClass vc;
+	std::string key = classname;
+
+	std::replace(key.begin(), key.end(), '/', '\\');
+	std::transform(key.begin(), key.end(), key.begin(), ::tolower);
+	vc.init = init;
+	vc.exit = exit;
+	classes[key] = vc;
+}
+
+bool HeadlessSim::GetVesselClass(const std::string &classname, VesselClass &vc)
+{
+	std::string key = classname;
+	char module[256];
+
+	std::replace(key.begin(), key.end(), '/', '\\');
+	std::transform(key.begin(), key.end(), key.begin(), ::tolower);
+
+	std::map<std::string, VesselClass>::iterator it = classes.find(key);
+	if (it != classes.end())
+	{
+		vc = it->second;
+		return true;
+	}
+
+	//Module name from the class configuration file
+	FILEHANDLE cfg = oapiOpenFile((classname + ".cfg").c_str(), FILE_IN, CONFIG);
+	if (cfg == NULL || !oapiReadItem_string(cfg, "Module", module))
+	{
+		strcpy(module, classname.c_str());
+	}
+	if (cfg) oapiCloseFile(cfg, FILE_IN);
+
+	std::map<std::string, Module>::iterator mit = modules.find(module);
+	if (mit != modules.end())
+	{
+		vc = mit->second.vc;
+		return vc.init != NULL;
+	}
+
+	Module mod;
+	typedef void(*MODULE_FUNC)(HINSTANCE hModule);
+	MODULE_FUNC initmodule;
+#ifdef _WIN32
+	std::string path = GetPath((std::string(module) + ".dll").c_str(), MODULES);
+	HMODULE h = LoadLibraryA(path.c_str());
+	mod.handle = h;
+	if (h)
+	{
+		mod.vc.init = (VESSEL_INIT_FUNC)GetProcAddress(h, "ovcInit");
+		mod.vc.exit = (VESSEL_EXIT_FUNC)GetProcAddress(h, "ovcExit");
+		initmodule = (MODULE_FUNC)GetProcAddress(h, "InitModule");
+	}
+#else
+	std::string path = GetPath((std::string(module) + ".so").c_str(), MODULES);
+	mod.handle = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+	if (mod.handle)
+	{
+		//Windows calls DllMain while it loads the library, before Orbiter calls InitModule
+		typedef BOOL(*DLLMAIN_FUNC)(HINSTANCE hModule, DWORD ul_reason_for_call, LPVOID lpReserved);
+		DLLMAIN_FUNC dllmain = (DLLMAIN_FUNC)dlsym(mod.handle, "DllMain");
+		if (dllmain) dllmain((HINSTANCE)mod.handle, DLL_PROCESS_ATTACH, NULL);
+
+		mod.vc.init = (VESSEL_INIT_FUNC)dlsym(mod.handle, "ovcInit");
+		mod.vc.exit = (VESSEL_EXIT_FUNC)dlsym(mod.handle, "ovcExit");
+		initmodule = (MODULE_FUNC)dlsym(mod.handle, "InitModule");
+	}
+#endif
+	if (mod.handle == NULL)
+	{
+		oapiWriteLogV("Headless: can't load module %s for vessel class %s", path.c_str(), classname.c_str());
+		mod.vc.init = NULL;
+		mod.vc.exit = NULL;
+		modules[module] = mod;
+		return false;
+	}
+	if (initmodule) initmodule((HINSTANCE)mod.handle);
+
+	modules[module] = mod;
+	vc = mod.vc;
+	return vc.init != NULL;
+}
+
+HeadlessVessel *HeadlessSim::CreateVessel(const char *name, const char *classname, const VESSELSTATUS2 *status, FILEHANDLE scn)
+{
+	VesselClass vc;
+
+	if (!GetVesselClass(classname, vc))
+	{
+		return NULL;
+	}
+
+	HeadlessVessel *v = new HeadlessVessel();
+	v->name = name;
+	v->classname = classname;
+	v->rbody = GetBody("Earth");
+	vessels.push_back(v);
+
+	v->iface = vc.init((OBJHANDLE)v, v->flightmodel);
+	v->exitfunc = vc.exit;
+	if (v->iface == NULL)
+	{
+		vessels.pop_back();
+		delete v;
+		return NULL;
+	}
+
+	VESSEL2 *v2 = dynamic_cast<VESSEL2*>(v->iface);
+
+	FILEHANDLE cfg = oapiOpenFile((std::string(classname) + ".cfg").c_str(), FILE_IN, CONFIG);
+	if (v2) v2->clbkSetClassCaps(cfg);
+	if (cfg) oapiCloseFile(cfg, FILE_IN);
+
+	if (scn)
+	{
+		VESSELSTATUS2 vs;
+		memset(&vs, 0, sizeof(vs));
+		vs.version = 2;
+		vs.rbody = (OBJHANDLE)v->rbody;
+		if (v2)
+		{
+			v2->clbkLoadStateEx(scn, &vs);
+			v2->clbkSetStateEx(&vs);
+		}
+		else
+		{
+			char *line;
+			while (oapiReadScenario_nextline(scn, line))
+			{
+				v->iface->ParseScenarioLineEx(line, &vs);
+			}
+			v->iface->DefSetStateEx(&vs);
+		}
+		//Allocated by ParseScenarioLineEx
+		delete[] vs.fuel;
+		delete[] vs.thruster;
+	}
+	else if (status)
+	{
+		if (v2) v2->clbkSetStateEx(status);
+		else v->iface->DefSetStateEx(status);
+	}
+
+	return v;
+}
+
+bool HeadlessSim::DeleteVessel(HeadlessVessel *v)
+{
+	std::vector<HeadlessVessel*>::iterator it = std::find(vessels.begin(), vessels.end(), v);
+	if (it == vessels.end()) return false;
+
+	if (stepping)
+	{
+		if (std::find(deleted.begin(), deleted.end(), v) == deleted.end()) deleted.push_back(v);
+		return true;
+	}
+
+	vessels.erase(it);
+	if (focus == v) focus = vessels.empty() ? NULL : vessels[0];
+	if (v->exitfunc) v->exitfunc(v->iface);
+	else delete v->iface;
+	delete v;
+	return true;
+}
+
+void HeadlessSim::Clear()
+{
+	while (!vessels.empty())
+	{
+		DeleteVessel(vessels.back());
+	}
+	focus = NULL;
+
+	for (std::map<std::string, Module>::iterator it = modules.begin();it != modules.end();it++)
+	{
+		if (it->second.handle == NULL) continue;
+		typedef void(*MODULE_FUNC)(HINSTANCE hModule);
+#ifdef _WIN32
+		MODULE_FUNC exitmodule = (MODULE_FUNC)GetProcAddress((HMODULE)it->second.handle, "ExitModule");
+		if (exitmodule) exitmodule((HINSTANCE)it->second.handle);
+		FreeLibrary((HMODULE)it->second.handle);
+#else
+		MODULE_FUNC exitmodule = (MODULE_FUNC)dlsym(it->second.handle, "ExitModule");
+		if (exitmodule) exitmodule((HINSTANCE)it->second.handle);
+		typedef BOOL(*DLLMAIN_FUNC)(HINSTANCE hModule, DWORD ul_reason_for_call, LPVOID lpReserved);
+		DLLMAIN_FUNC dllmain = (DLLMAIN_FUNC)dlsym(it->second.handle, "DllMain");
+		if (dllmain) dllmain((HINSTANCE)it->second.handle, DLL_PROCESS_DETACH, NULL);
+		dlclose(it->second.handle);
+#endif
+	}
+	modules.clear();
+}
+
+HeadlessBody *HeadlessSim::GetBody(const char *name) const
+{
+	for (unsigned k = 0;k < bodies.size();k++)
+	{
+		if (_stricmp(bodies[k]->name.c_str(), name) == 0) return bodies[k];
+	}
+	return NULL;
+}
+
+HeadlessVessel *HeadlessSim::GetVessel(const char *name) const
+{
+	for (unsigned k = 0;k < vessels.size();k++)
+	{
+		if (_stricmp(vessels[k]->name.c_str(), name) == 0) return vessels[k];
+	}
+	return NULL;
+}
+
+bool HeadlessSim::IsBody(OBJHANDLE hObj) const
+{
+	return std::find(bodies.begin(), bodies.end(), (HeadlessBody*)(HeadlessObject*)hObj) != bodies.end();
+}
+
+bool HeadlessSim::IsVessel(OBJHANDLE hObj) const
+{
+	return std::find(vessels.begin(), vessels.end(), (HeadlessVessel*)(HeadlessObject*)hObj) != vessels.end();
+}
+
+bool HeadlessSim::LoadScenario(const char *path)
+{
+	HeadlessFile scn;
+	char buffer[1024], *line;
+	std::string focusname;
+
+	scn.fp = fopen(path, "rt");
+	if (scn.fp == NULL)
+	{
+		oapiWriteLogV("Headless: can't open scenario %s", path);
+		return true;
+	}
+	scn.mode = FILE_IN;
+
+	Clear();
+	simt = 0.0;
+
+	while (fgets(buffer, sizeof(buffer), scn.fp))
+	{
+		line = Trim(buffer);
+		if (strcmp(line, "BEGIN_ENVIRONMENT") == 0)
+		{
+			while (fgets(buffer, sizeof(buffer), scn.fp))
+			{
+				line = Trim(buffer);
+				if (strcmp(line, "END_ENVIRONMENT") == 0) break;
+				sscanf(line, "Date MJD %lf", &mjd);
+			}
+			UpdateBodies();
+		}
+		else if (strcmp(line, "BEGIN_FOCUS") == 0)
+		{
+			while (fgets(buffer, sizeof(buffer), scn.fp))
+			{
+				line = Trim(buffer);
+				if (strcmp(line, "END_FOCUS") == 0) break;
+				if (!strncmp(line, "Ship ", 5)) focusname = Trim(line + 5);
+			}
+		}
+		else if (strcmp(line, "BEGIN_SHIPS") == 0)
+		{
+			while (fgets(buffer, sizeof(buffer), scn.fp))
+			{
+				line = Trim(buffer);
+				if (strcmp(line, "END_SHIPS") == 0) break;
+
+				char *sep = strchr(line, ':');
+				if (sep == NULL) continue;
+				*sep = '\0';
+				std::string name = line, classname = sep + 1;
+
+				if (CreateVessel(name.c_str(), classname.c_str(), NULL, (FILEHANDLE)&scn) == NULL)
+				{
+					oapiWriteLogV("Headless: vessel %s of class %s not created", name.c_str(), classname.c_str());
+					//Skip the vessel state
+					while (oapiReadScenario_nextline((FILEHANDLE)&scn, line));
+				}
+			}
+		}
+	}
+	fclose(scn.fp);
+
+	focus = GetVessel(focusname.c_str());
+	if (focus == NULL && !vessels.empty()) focus = vessels[0];
+
+	for (unsigned k = 0;k < vessels.size();k++)
+	{
+		VESSEL2 *v2 = dynamic_cast<VESSEL2*>(vessels[k]->iface);
+		if (v2) v2->clbkPostCreation();
+	}
+	return false;
+}
+
+bool HeadlessSim::SaveScenario(const char *path)
+{
+	HeadlessFile scn;
+
+	scn.fp = fopen(path, "wt");
+	if (scn.fp == NULL) return true;
+	scn.mode = FILE_OUT;
+
+	fprintf(scn.fp, "BEGIN_DESC\nWritten by the headless simulation\nEND_DESC\n\n");
+	fprintf(scn.fp, "BEGIN_ENVIRONMENT\n  System Sol\n  Date MJD %.10f\nEND_ENVIRONMENT\n\n", mjd);
+	if (focus) fprintf(scn.fp, "BEGIN_FOCUS\n  Ship %s\nEND_FOCUS\n\n", focus->name.c_str());
+	fprintf(scn.fp, "BEGIN_SHIPS\n");
+	for (unsigned k = 0;k < vessels.size();k++)
+	{
+		HeadlessVessel *v = vessels[k];
+		VESSEL2 *v2 = dynamic_cast<VESSEL2*>(v->iface);
+
+		fprintf(scn.fp, "%s:%s\n", v->name.c_str(), v->classname.c_str());
+		if (v2) v2->clbkSaveState((FILEHANDLE)&scn);
+		else v->iface->SaveDefaultState((FILEHANDLE)&scn);
+		fprintf(scn.fp, "END\n");
+	}
+	fprintf(scn.fp, "END_SHIPS\n");
+	fclose(scn.fp);
+	return false;
+}
+
+void HeadlessSim::UpdateBodies()
+{
+	//Parents come first
+	for (unsigned k = 0;k < bodies.size();k++)
+	{
+		bodies[k]->Update(mjd);
+	}
+}
+
+VECTOR3 HeadlessSim::Gravity(const VECTOR3 &pos) const
+{
+	VECTOR3 g = _V(0, 0, 0);
+
+	for (unsigned k = 0;k < bodies.size();k++)
+	{
+		VECTOR3 d = bodies[k]->pos - pos;
+		double r = length(d);
+		g += d * (GGRAV*bodies[k]->mass / (r*r*r));
+	}
+	return g;
+}
+
+void HeadlessSim::BeginMove(HeadlessVessel *v, double dt)
+{
+	double m = v->GetMass();
+
+	v->GetThrust(v->thrust, v->torque);
+
+	if (v->landed)
+	{
+		//Lift off when the thrust exceeds the weight
+		VECTOR3 up = unit(v->pos - v->rbody->pos);
+		if (m <= 0.0 || dotp(mul(v->R, v->thrust), up) <= m * length(Gravity(v->pos)))
+		{
+			return;
+		}
+		v->landed = false;
+	}
+
+	//Velocity Verlet, the thrust is held constant over the step
+	v->acc = Gravity(v->pos) + mul(v->R, v->thrust) / m;
+	v->pos += v->vel*dt + v->acc * (0.5*dt*dt);
+}
+
+void HeadlessSim::EndMove(HeadlessVessel *v, double dt)
+{
+	double m = v->GetMass();
+	double angle;
+
+	if (v->landed)
+	{
+		v->UpdateLanded();
+		return;
+	}
+
+	VECTOR3 a1 = Gravity(v->pos) + mul(v->R, v->thrust) / m;
+	v->vel += (v->acc + a1)*(0.5*dt);
+
+	//Angular acceleration, without gyroscopic coupling. The torque is crossp(r, F), so it has the opposite sign of omega.
+	VECTOR3 dw = _V(v->torque.x / (v->pmi.x*m), v->torque.y / (v->pmi.y*m), v->torque.z / (v->pmi.z*m));
+	v->omega -= dw * dt;
+
+	angle = length(v->omega)*dt;
+	if (angle > 0.0)
+	{
+		VECTOR3 u = -unit(v->omega);
+		MATRIX3 K = _M(0, -u.z, u.y, u.z, 0, -u.x, -u.y, u.x, 0);
+		MATRIX3 K2 = mul(K, K);
+		MATRIX3 Rot = identity();
+		for (int k = 0;k < 9;k++)
+		{
+			Rot.data[k] += sin(angle)*K.data[k] + (1.0 - cos(angle))*K2.data[k];
+		}
+		v->R = mul(v->R, Rot);
+
+		//Keep the matrix orthonormal
+		VECTOR3 x = _V(v->R.m11, v->R.m21, v->R.m31);
+		VECTOR3 y = _V(v->R.m12, v->R.m22, v->R.m32);
+		x = unit(x);
+		y = unit(y - x * dotp(x, y));
+		VECTOR3 z = crossp(x, y);
+		v->R = _M(x.x, y.x, z.x, x.y, y.y, z.y, x.z, y.z, z.z);
+	}
+
+	//Touchdown
+	v->rbody = v->FindGravityRef();
+	VECTOR3 rrel = v->pos - v->rbody->pos;
+	if (v->rbody->type == OBJTP_PLANET && length(rrel) < v->rbody->size + elevation && dotp(rrel, v->vel - v->rbody->vel) < 0.0)
+	{
+		v->SetLanded(v->rbody);
+	}
+}
+
+void HeadlessSim::Step(double dt)
+{
+	unsigned k;
+	double tn = simt + dt;
+	double mjdn = mjd + dt / 86400.0;
+
+	simdt = dt;
+	stepping = true;
+
+	for (k = 0;k < vessels.size();k++)
+	{
+		VESSEL2 *v2 = dynamic_cast<VESSEL2*>(vessels[k]->iface);
+		if (v2) v2->clbkPreStep(tn, dt, mjdn);
+	}
+
+	for (k = 0;k < vessels.size();k++)
+	{
+		BeginMove(vessels[k], dt);
+	}
+
+	simt = tn;
+	mjd = mjdn;
+	UpdateBodies();
+
+	for (k = 0;k < vessels.size();k++)
+	{
+		HeadlessVessel *v = vessels[k];
+		EndMove(v, dt);
+		v->ConsumePropellant(dt);
+		v->addforce = v->addtorque = _V(0, 0, 0);
+	}
+
+	for (k = 0;k < vessels.size();k++)
+	{
+		VESSEL2 *v2 = dynamic_cast<VESSEL2*>(vessels[k]->iface);
+		if (v2) v2->clbkPostStep(simt, dt, mjd);
+	}
+
+	stepping = false;
+	for (k = 0;k < deleted.size();k++)
+	{
+		DeleteVessel(deleted[k]);
+	}
+	deleted.clear();
+}
@@ -0,0 +1,284 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  Headless Simulation Core (Header)
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#pragma once
+
+//############################################################################//
+// Minimal simulation behind the headless Orbiter API. It loads vessel modules
+// the same way Orbiter does (Config/<class>.cfg -> Modules/<module>.so, then
+// ovcInit/ovcExit), reads and writes scenario files and steps the vessels at a
+// fixed time step. Modules linked into the executable can be registered with
+// RegisterVesselClass instead.
+//
+// The Sun, Earth and Moon are the only celestial bodies. The Earth and Moon
+// follow two-body orbits with precessing node and perigee, and rotate with the
+// same rotation model Orbiter uses. Vessels are point masses moved by gravity
+// and thrust, there is no atmosphere and the surface elevation is a constant.
+//############################################################################//
+
+#include "Orbitersdk.h"
+#include <string>
+#include <vector>
+#include <map>
+
+typedef VESSEL *(*VESSEL_INIT_FUNC)(OBJHANDLE hVessel, int flightmodel);
+typedef void(*VESSEL_EXIT_FUNC)(VESSEL *vessel);
+
+struct HeadlessObject
+{
+	HeadlessObject(int t) : type(t) {}
+	virtual ~HeadlessObject() {}
+
+	//OBJTP_*
+	int type;
+	std::string name;
+};
+
+class HeadlessBody : public HeadlessObject, public CELBODY
+{
+public:
+	HeadlessBody();
+
+	//Updates position, velocity and rotation to mjd
+	void Update(double mjd);
+	//Rotation matrix and rotation angle at mjd
+	void GetRotation(double mjd, MATRIX3 &Rot, MATRIX3 &Obl, double &phi, double &L_rel) const;
+	int clbkEphemeris(double mjd, int req, double *ret);
+
+	double mass;
+	double size;
+	HeadlessBody *parent;
+
+	//Orbit relative to the parent, right-handed ecliptic frame. Angles in rad, rates in rad/day
+	double a, e, i;
+	double LAN0, LAN_dot;
+	double lp0, lp_dot;
+	double L0, L_dot;
+
+	//Rotation model, same parameters as in Orbiter's planet configuration
+	double t0, T_p, L_0, e_rel, phi_0, T_s, e_ref, L_ref;
+
+	//Sphere of influence radius
+	double soi;
+
+	//State at the last update, global frame
+	VECTOR3 pos, vel;
+	MATRIX3 R, Obl;
+	double rotation, theta;
+
+protected:
+	//Position and velocity relative to the parent, right-handed ecliptic frame
+	void RelativeState(double mjd, VECTOR3 &r, VECTOR3 &v) const;
+};
+
+struct HeadlessPropellant
+{
+	double maxmass;
+	double mass;
+	double efficiency;
+	double flowrate;
+};
+
+struct HeadlessThruster
+{
+	VECTOR3 pos;
+	VECTOR3 dir;
+	double max0;
+	double isp0;
+	double level;
+	//Additional level for the current step only, from SetThrusterLevel_SingleStep
+	double level_ss;
+	HeadlessPropellant *prop;
+
+	double GetLevel() const { return level + level_ss < 1.0 ? level + level_ss : 1.0; }
+};
+
+struct HeadlessThrusterGroup
+{
+	THGROUP_TYPE type;
+	std::vector<HeadlessThruster*> thrusters;
+};
+
+//Docking ports and attachment points only keep their parameters, vessels never dock or attach
+struct HeadlessDock
+{
+	VECTOR3 pos, dir, rot;
+};
+
+struct HeadlessAttachment
+{
+	bool toparent;
+	VECTOR3 pos, dir, rot;
+	std::string id;
+};
+
+class HeadlessVessel : public HeadlessObject
+{
+public:
+	HeadlessVessel();
+	~HeadlessVessel();
+
+	double GetMass() const;
+	//Thrust force and torque in vessel coordinates
+	void GetThrust(VECTOR3 &F, VECTOR3 &T) const;
+	//Consumes propellant for a time step
+	void ConsumePropellant(double dt);
+	//Updates the global state of a landed vessel
+	void UpdateLanded();
+	//Switches to landed at the current position
+	void SetLanded(HeadlessBody *body);
+	//Gravity reference body at the current position
+	HeadlessBody *FindGravityRef() const;
+	//Local horizon directions in the global frame. Returns the planet, or NULL if there is no surface
+	HeadlessBody *GetHorizon(VECTOR3 &east, VECTOR3 &up, VECTOR3 &north) const;
+
+	HeadlessThrusterGroup *FindGroup(THGROUP_TYPE thgt) const;
+
+	std::string classname;
+	VESSEL *iface;
+	VESSEL_EXIT_FUNC exitfunc;
+	int flightmodel;
+	bool enablefocus;
+
+	double emptymass;
+	double size;
+	VECTOR3 pmi;
+
+	//Global position and velocity
+	VECTOR3 pos, vel;
+	//Vessel to global rotation
+	MATRIX3 R;
+	//Angular velocity in vessel coordinates, with Orbiter's sign: the opposite of the
+	//right-handed crossp(omega, p) for the rate of change of a vessel vector p
+	VECTOR3 omega;
+
+	bool landed;
+	HeadlessBody *rbody;
+	double lng, lat, hdg;
+
+	//Forces added with AddForce during the current step, vessel coordinates
+	VECTOR3 addforce, addtorque;
+	//Thrust, torque and acceleration at the start of the current step
+	VECTOR3 thrust, torque, acc;
+
+	std::vector<HeadlessPropellant*> propellants;
+	std::vector<HeadlessThruster*> thrusters;
+	std::vector<HeadlessThrusterGroup*> groups;
+	HeadlessPropellant *defaultprop;
+	std::vector<HeadlessDock*> docks;
+	std::vector<HeadlessAttachment*> attachments;
+
+	//RCS_* mode of the manual attitude controls and the NAVMODE_* bits that are active
+	int attmode;
+	DWORD navmodes;
+	double cog_elev;
+
+	//Number of meshes and animations, for the indices returned to the vessel
+	UINT nmesh, nanim;
+
+	//Buffers for the returned names
+	mutable char namebuf[256];
+	mutable char classbuf[256];
+};
+
+struct HeadlessFile
+{
+	FILE *fp;
+	FileAccessMode mode;
+	char line[1024];
+};
+
+class HeadlessSim
+{
+public:
+	static HeadlessSim &Instance();
+
+	//Directory of the Orbiter installation with the Config, Modules and Scenarios folders
+	void SetRootDir(const std::string &dir);
+	std::string GetPath(const char *fname, PathRoot root) const;
+
+	//Makes a vessel class available without loading a module
+	void RegisterVesselClass(const char *classname, VESSEL_INIT_FUNC init, VESSEL_EXIT_FUNC exit);
+
+	//Loads a scenario and creates its vessels. Returns true on error
+	bool LoadScenario(const char *path);
+	//Writes the current state as a scenario. Returns true on error
+	bool SaveScenario(const char *path);
+	//Advances the simulation by dt
+	void Step(double dt);
+	//Deletes all vessels and unloads the modules
+	void Clear();
+
+	HeadlessVessel *CreateVessel(const char *name, const char *classname, const VESSELSTATUS2 *status, FILEHANDLE scn);
+	bool DeleteVessel(HeadlessVessel *v);
+
+	HeadlessBody *GetBody(const char *name) const;
+	HeadlessVessel *GetVessel(const char *name) const;
+	bool IsBody(OBJHANDLE hObj) const;
+	bool IsVessel(OBJHANDLE hObj) const;
+
+	std::vector<HeadlessBody*> bodies;
+	std::vector<HeadlessVessel*> vessels;
+	HeadlessVessel *focus;
+
+	double simt, simdt, mjd;
+	double timeaccel;
+	bool pause;
+	//Returned by oapiSurfaceElevation
+	double elevation;
+
+	char debugstring[256];
+
+protected:
+	HeadlessSim();
+	~HeadlessSim();
+
+	struct VesselClass
+	{
+		VESSEL_INIT_FUNC init;
+		VESSEL_EXIT_FUNC exit;
+	};
+
+	struct Module
+	{
+		void *handle;
+		VesselClass vc;
+	};
+
+	//Looks up a registered class or loads its module
+	bool GetVesselClass(const std::string &classname, VesselClass &vc);
+	void UpdateBodies();
+	//Gravitational acceleration from all bodies
+	VECTOR3 Gravity(const VECTOR3 &pos) const;
+	//First half of the vessel motion, before the bodies move
+	void BeginMove(HeadlessVessel *v, double dt);
+	//Second half of the vessel motion, after the bodies moved
+	void EndMove(HeadlessVessel *v, double dt);
+
+	std::string rootdir;
+	std::map<std::string, VesselClass> classes;
+	std::map<std::string, Module> modules;
+	//Vessels deleted during a step, removed after it
+	std::vector<HeadlessVessel*> deleted;
+	bool stepping;
+};
@@ -0,0 +1,699 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  Headless Orbiter API stand-in
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#include "HeadlessSim.h"
+
+#define SIM HeadlessSim::Instance()
+
+static HeadlessObject *Object(OBJHANDLE hObj)
+{
+	return (HeadlessObject*)hObj;
+}
+
+//Body or NULL
+static HeadlessBody *Body(OBJHANDLE hObj)
+{
+	if (hObj == NULL || !SIM.IsBody(hObj)) return NULL;
+	return (HeadlessBody*)Object(hObj);
+}
+
+//Vessel or NULL
+static HeadlessVessel *Vessel(OBJHANDLE hObj)
+{
+	if (hObj == NULL || !SIM.IsVessel(hObj)) return NULL;
+	return (HeadlessVessel*)Object(hObj);
+}
+
+// ===========================================================================
+// Objects
+// ===========================================================================
+
+OBJHANDLE oapiGetObjectByName(const char *name)
+{
+	HeadlessBody *b = SIM.GetBody(name);
+	if (b) return (OBJHANDLE)(HeadlessObject*)b;
+	return (OBJHANDLE)(HeadlessObject*)SIM.GetVessel(name);
+}
+
+OBJHANDLE oapiGetGbodyByName(const char *name)
+{
+	return (OBJHANDLE)(HeadlessObject*)SIM.GetBody(name);
+}
+
+OBJHANDLE oapiGetGbodyByIndex(int index)
+{
+	if (index < 0 || index >= (int)SIM.bodies.size()) return NULL;
+	return (OBJHANDLE)(HeadlessObject*)SIM.bodies[index];
+}
+
+DWORD oapiGetGbodyCount()
+{
+	return (DWORD)SIM.bodies.size();
+}
+
+OBJHANDLE oapiGetGbodyParent(OBJHANDLE hBody)
+{
+	HeadlessBody *b = Body(hBody);
+	if (b == NULL || b->parent == NULL) return NULL;
+	return (OBJHANDLE)(HeadlessObject*)b->parent;
+}
+
+void oapiGetObjectName(OBJHANDLE hObj, char *name, int n)
+{
+	if (n <= 0) return;
+	if (hObj == NULL)
+	{
+		name[0] = '\0';
+		return;
+	}
+	snprintf(name, n, "%s", Object(hObj)->name.c_str());
+}
+
+int oapiGetObjectType(OBJHANDLE hObj)
+{
+	if (Body(hObj) || Vessel(hObj)) return Object(hObj)->type;
+	return OBJTP_INVALID;
+}
+
+double oapiGetMass(OBJHANDLE hObj)
+{
+	HeadlessBody *b = Body(hObj);
+	if (b) return b->mass;
+	HeadlessVessel *v = Vessel(hObj);
+	if (v) return v->GetMass();
+	return 0.0;
+}
+
+double oapiGetSize(OBJHANDLE hObj)
+{
+	HeadlessBody *b = Body(hObj);
+	if (b) return b->size;
+	HeadlessVessel *v = Vessel(hObj);
+	if (v) return v->size;
+	return 0.0;
+}
+
+void oapiGetGlobalPos(OBJHANDLE hObj, VECTOR3 *pos)
+{
+	HeadlessBody *b = Body(hObj);
+	HeadlessVessel *v;
+
+	if (b) *pos = b->pos;
+	else if ((v = Vessel(hObj)) != NULL) *pos = v->pos;
+	else *pos = _V(0, 0, 0);
+}
+
+void oapiGetGlobalVel(OBJHANDLE hObj, VECTOR3 *vel)
+{
+	HeadlessBody *b = Body(hObj);
+	HeadlessVessel *v;
+
+	if (b) *vel = b->vel;
+	else if ((v = Vessel(hObj)) != NULL) *vel = v->vel;
+	else *vel = _V(0, 0, 0);
+}
+
+void oapiGetRelativePos(OBJHANDLE hObj, OBJHANDLE hRef, VECTOR3 *pos)
+{
+	VECTOR3 p1, p2;
+
+	oapiGetGlobalPos(hObj, &p1);
+	oapiGetGlobalPos(hRef, &p2);
+	*pos = p1 - p2;
+}
+
+void oapiGetRelativeVel(OBJHANDLE hObj, OBJHANDLE hRef, VECTOR3 *vel)
+{
+	VECTOR3 v1, v2;
+
+	oapiGetGlobalVel(hObj, &v1);
+	oapiGetGlobalVel(hRef, &v2);
+	*vel = v1 - v2;
+}
+
+void oapiGetRotationMatrix(OBJHANDLE hObj, MATRIX3 *mat)
+{
+	HeadlessBody *b = Body(hObj);
+	HeadlessVessel *v;
+
+	if (b) *mat = b->R;
+	else if ((v = Vessel(hObj)) != NULL) *mat = v->R;
+	else *mat = identity();
+}
+
+// ===========================================================================
+// Vessels
+// ===========================================================================
+
+OBJHANDLE oapiGetVesselByName(const char *name)
+{
+	return (OBJHANDLE)(HeadlessObject*)SIM.GetVessel(name);
+}
+
+OBJHANDLE oapiGetVesselByIndex(int index)
+{
+	if (index < 0 || index >= (int)SIM.vessels.size()) return NULL;
+	return (OBJHANDLE)(HeadlessObject*)SIM.vessels[index];
+}
+
+DWORD oapiGetVesselCount()
+{
+	return (DWORD)SIM.vessels.size();
+}
+
+bool oapiIsVessel(OBJHANDLE hVessel)
+{
+	return Vessel(hVessel) != NULL;
+}
+
+BOOL oapiGetAltitude(OBJHANDLE hVessel, double *alt)
+{
+	HeadlessVessel *v = Vessel(hVessel);
+	if (v == NULL) return FALSE;
+	*alt = v->iface->GetAltitude();
+	return TRUE;
+}
+
+VESSEL *oapiGetVesselInterface(OBJHANDLE hVessel)
+{
+	HeadlessVessel *v = Vessel(hVessel);
+	return v ? v->iface : NULL;
+}
+
+OBJHANDLE oapiGetFocusObject()
+{
+	return (OBJHANDLE)(HeadlessObject*)SIM.focus;
+}
+
+VESSEL *oapiGetFocusInterface()
+{
+	return SIM.focus ? SIM.focus->iface : NULL;
+}
+
+OBJHANDLE oapiSetFocusObject(OBJHANDLE hVessel)
+{
+	HeadlessVessel *v = Vessel(hVessel);
+	HeadlessVessel *old = SIM.focus;
+
+	if (v == NULL || v == old) return (OBJHANDLE)(HeadlessObject*)old;
+
+	SIM.focus = v;
+	VESSEL2 *v2;
+	if (old && (v2 = dynamic_cast<VESSEL2*>(old->iface)) != NULL) v2->clbkFocusChanged(false, hVessel, (OBJHANDLE)(HeadlessObject*)old);
+	if ((v2 = dynamic_cast<VESSEL2*>(v->iface)) != NULL) v2->clbkFocusChanged(true, hVessel, (OBJHANDLE)(HeadlessObject*)old);
+	return (OBJHANDLE)(HeadlessObject*)old;
+}
+
+OBJHANDLE oapiCreateVessel(const char *name, const char *classname, const VESSELSTATUS &status)
+{
+	VESSELSTATUS2 vs2;
+
+	memset(&vs2, 0, sizeof(vs2));
+	vs2.version = 2;
+	vs2.rbody = status.rbody;
+	vs2.base = status.base;
+	vs2.port = status.port;
+	vs2.status = status.status;
+	vs2.rpos = status.rpos;
+	vs2.rvel = status.rvel;
+	vs2.vrot = status.vrot;
+	vs2.arot = status.arot;
+	//Landed vessels keep their position in the first vdata vector, longitude and latitude
+	if (status.status == 1)
+	{
+		vs2.surf_lng = status.vdata[0].x;
+		vs2.surf_lat = status.vdata[0].y;
+		vs2.surf_hdg = status.vdata[0].z;
+	}
+	return oapiCreateVesselEx(name, classname, &vs2);
+}
+
+OBJHANDLE oapiCreateVesselEx(const char *name, const char *classname, const void *status)
+{
+	HeadlessVessel *v = SIM.CreateVessel(name, classname, (const VESSELSTATUS2*)status, NULL);
+	if (v == NULL) return NULL;
+
+	VESSEL2 *v2 = dynamic_cast<VESSEL2*>(v->iface);
+	if (v2) v2->clbkPostCreation();
+	return (OBJHANDLE)(HeadlessObject*)v;
+}
+
+bool oapiDeleteVessel(OBJHANDLE hVessel, OBJHANDLE hAlternativeCameraTarget)
+{
+	HeadlessVessel *v = Vessel(hVessel);
+	if (v == NULL) return false;
+	return SIM.DeleteVessel(v);
+}
+
+// ===========================================================================
+// Celestial bodies
+// ===========================================================================
+
+CELBODY *oapiGetCelbodyInterface(OBJHANDLE hBody)
+{
+	return Body(hBody);
+}
+
+double oapiGetPlanetPeriod(OBJHANDLE hPlanet)
+{
+	HeadlessBody *b = Body(hPlanet);
+	return b ? b->T_s*86400.0 : 0.0;
+}
+
+double oapiGetPlanetObliquity(OBJHANDLE hPlanet)
+{
+	HeadlessBody *b = Body(hPlanet);
+	//Obliquity of the rotation axis against the ecliptic
+	return b ? acos(b->Obl.m22) : 0.0;
+}
+
+double oapiGetPlanetTheta(OBJHANDLE hPlanet)
+{
+	HeadlessBody *b = Body(hPlanet);
+	return b ? b->theta : 0.0;
+}
+
+void oapiGetPlanetObliquityMatrix(OBJHANDLE hPlanet, MATRIX3 *mat)
+{
+	HeadlessBody *b = Body(hPlanet);
+	*mat = b ? b->Obl : identity();
+}
+
+//The bodies are point masses, so there are no harmonics. Code that adds the J2 terms itself leaves them out too.
+DWORD oapiGetPlanetJCoeffCount(OBJHANDLE hPlanet)
+{
+	return 0;
+}
+
+double oapiGetPlanetJCoeff(OBJHANDLE hPlanet, DWORD n)
+{
+	return 0.0;
+}
+
+double oapiGetPlanetCurrentRotation(OBJHANDLE hPlanet)
+{
+	HeadlessBody *b = Body(hPlanet);
+	return b ? b->rotation : 0.0;
+}
+
+double oapiSurfaceElevation(OBJHANDLE hPlanet, double lng, double lat)
+{
+	return SIM.elevation;
+}
+
+void oapiLocalToEqu(OBJHANDLE hObj, VECTOR3 loc, double *lng, double *lat, double *rad)
+{
+	double r = length(loc);
+
+	*rad = r;
+	*lat = r > 0.0 ? asin(loc.y / r) : 0.0;
+	*lng = atan2(loc.z, loc.x);
+}
+
+void oapiEquToLocal(OBJHANDLE hObj, double lng, double lat, double rad, VECTOR3 *loc)
+{
+	*loc = _V(cos(lat)*cos(lng), sin(lat), cos(lat)*sin(lng))*rad;
+}
+
+void oapiLocalToGlobal(OBJHANDLE hObj, const VECTOR3 *local, VECTOR3 *global)
+{
+	MATRIX3 R;
+	VECTOR3 pos;
+
+	oapiGetRotationMatrix(hObj, &R);
+	oapiGetGlobalPos(hObj, &pos);
+	*global = mul(R, *local) + pos;
+}
+
+void oapiGlobalToLocal(OBJHANDLE hObj, const VECTOR3 *global, VECTOR3 *local)
+{
+	MATRIX3 R;
+	VECTOR3 pos;
+
+	oapiGetRotationMatrix(hObj, &R);
+	oapiGetGlobalPos(hObj, &pos);
+	*local = tmul(R, *global - pos);
+}
+
+void oapiEquToGlobal(OBJHANDLE hObj, double lng, double lat, double rad, VECTOR3 *glob)
+{
+	VECTOR3 loc;
+
+	oapiEquToLocal(hObj, lng, lat, rad, &loc);
+	oapiLocalToGlobal(hObj, &loc, glob);
+}
+
+void oapiGlobalToEqu(OBJHANDLE hObj, VECTOR3 glob, double *lng, double *lat, double *rad)
+{
+	VECTOR3 loc;
+
+	oapiGlobalToLocal(hObj, &glob, &loc);
+	oapiLocalToEqu(hObj, loc, lng, lat, rad);
+}
+
+bool oapiGetHeading(OBJHANDLE hVessel, double *heading)
+{
+	HeadlessVessel *v = Vessel(hVessel);
+	VECTOR3 east, up, north;
+
+	if (v == NULL || v->GetHorizon(east, up, north) == NULL) return false;
+
+	VECTOR3 fwd = mul(v->R, _V(0, 0, 1));
+	*heading = atan2(dotp(fwd, east), dotp(fwd, north));
+	if (*heading < 0.0) *heading += PI2;
+	return true;
+}
+
+// ===========================================================================
+// Time
+// ===========================================================================
+
+double oapiGetSimTime()
+{
+	return SIM.simt;
+}
+
+double oapiGetSimStep()
+{
+	return SIM.simdt;
+}
+
+//There is no real time, the system time runs with the simulation so runs are repeatable
+double oapiGetSysTime()
+{
+	return SIM.simt;
+}
+
+double oapiGetSysStep()
+{
+	return SIM.simdt;
+}
+
+double oapiGetSimMJD()
+{
+	return SIM.mjd;
+}
+
+double oapiGetSysMJD()
+{
+	return SIM.mjd;
+}
+
+double oapiGetTimeAcceleration()
+{
+	return SIM.timeaccel;
+}
+
+void oapiSetTimeAcceleration(double warp)
+{
+	SIM.timeaccel = warp;
+}
+
+bool oapiGetPause()
+{
+	return SIM.pause;
+}
+
+void oapiSetPause(bool pause)
+{
+	SIM.pause = pause;
+}
+
+// ===========================================================================
+// Output
+// ===========================================================================
+
+char *oapiDebugString()
+{
+	return SIM.debugstring;
+}
+
+void oapiWriteLog(const char *line)
+{
+	fprintf(stderr, "%s\n", line);
+}
+
+void oapiWriteLogV(const char *format, ...)
+{
+	va_list args;
+	va_start(args, format);
+	vfprintf(stderr, format, args);
+	va_end(args);
+	fprintf(stderr, "\n");
+}
+
+// ===========================================================================
+// Files
+// ===========================================================================
+
+FILEHANDLE oapiOpenFile(const char *fname, FileAccessMode mode, PathRoot root)
+{
+	static const char *fmode[] = { "rt", "wt", "at", "rt" };
+	std::string path = SIM.GetPath(fname, root);
+	FILE *fp = fopen(path.c_str(), fmode[mode]);
+
+	if (fp == NULL)
+	{
+		if (mode != FILE_IN_ZEROONFAIL) return NULL;
+		//Reads nothing
+		fp = tmpfile();
+		if (fp == NULL) return NULL;
+	}
+
+	HeadlessFile *f = new HeadlessFile;
+	f->fp = fp;
+	f->mode = mode;
+	f->line[0] = '\0';
+	return (FILEHANDLE)f;
+}
+
+void oapiCloseFile(FILEHANDLE f, FileAccessMode mode)
+{
+	HeadlessFile *hf = (HeadlessFile*)f;
+	if (hf == NULL) return;
+	fclose(hf->fp);
+	delete hf;
+}
+
+//Finds "item = value" in a configuration file, comments start with ';'
+static bool FindItem(FILEHANDLE f, const char *item, char *value)
+{
+	HeadlessFile *hf = (HeadlessFile*)f;
+	char buffer[1024], *key, *val, *end;
+
+	if (hf == NULL) return false;
+
+	rewind(hf->fp);
+	while (fgets(buffer, sizeof(buffer), hf->fp))
+	{
+		if ((end = strchr(buffer, ';')) != NULL) *end = '\0';
+		if ((val = strchr(buffer, '=')) == NULL) continue;
+		*val++ = '\0';
+
+		key = buffer;
+		while (*key == ' ' || *key == '\t') key++;
+		end = key + strlen(key);
+		while (end > key && (end[-1] == ' ' || end[-1] == '\t')) end--;
+		*end = '\0';
+		if (_stricmp(key, item) != 0) continue;
+
+		while (*val == ' ' || *val == '\t') val++;
+		end = val + strlen(val);
+		while (end > val && (end[-1] == '\n' || end[-1] == '\r' || end[-1] == ' ' || end[-1] == '\t')) end--;
+		*end = '\0';
+		strcpy(value, val);
+		return true;
+	}
+	return false;
+}
+
+bool oapiReadItem_string(FILEHANDLE f, const char *item, char *string)
+{
+	return FindItem(f, item, string);
+}
+
+bool oapiReadItem_float(FILEHANDLE f, const char *item, double &val)
+{
+	char buffer[1024];
+	return FindItem(f, item, buffer) && sscanf(buffer, "%lf", &val) == 1;
+}
+
+bool oapiReadItem_int(FILEHANDLE f, const char *item, int &val)
+{
+	char buffer[1024];
+	return FindItem(f, item, buffer) && sscanf(buffer, "%d", &val) == 1;
+}
+
+bool oapiReadItem_bool(FILEHANDLE f, const char *item, bool &val)
+{
+	char buffer[1024];
+
+	if (!FindItem(f, item, buffer)) return false;
+	if (!_stricmp(buffer, "TRUE")) val = true;
+	else if (!_stricmp(buffer, "FALSE")) val = false;
+	else return false;
+	return true;
+}
+
+bool oapiReadItem_vec(FILEHANDLE f, const char *item, VECTOR3 &val)
+{
+	char buffer[1024];
+	return FindItem(f, item, buffer) && sscanf(buffer, "%lf%lf%lf", &val.x, &val.y, &val.z) == 3;
+}
+
+void oapiWriteItem_string(FILEHANDLE f, const char *item, const char *string)
+{
+	fprintf(((HeadlessFile*)f)->fp, "%s = %s\n", item, string);
+}
+
+void oapiWriteItem_float(FILEHANDLE f, const char *item, double val)
+{
+	fprintf(((HeadlessFile*)f)->fp, "%s = %g\n", item, val);
+}
+
+void oapiWriteItem_int(FILEHANDLE f, const char *item, int val)
+{
+	fprintf(((HeadlessFile*)f)->fp, "%s = %d\n", item, val);
+}
+
+void oapiWriteItem_bool(FILEHANDLE f, const char *item, bool val)
+{
+	fprintf(((HeadlessFile*)f)->fp, "%s = %s\n", item, val ? "TRUE" : "FALSE");
+}
+
+void oapiWriteItem_vec(FILEHANDLE f, const char *item, const VECTOR3 &val)
+{
+	fprintf(((HeadlessFile*)f)->fp, "%s = %g %g %g\n", item, val.x, val.y, val.z);
+}
+
+void oapiWriteLine(FILEHANDLE f, const char *line)
+{
+	fprintf(((HeadlessFile*)f)->fp, "%s\n", line);
+}
+
+// ===========================================================================
+// Scenario files
+// ===========================================================================
+
+bool oapiReadScenario_nextline(FILEHANDLE scn, char *&line)
+{
+	HeadlessFile *f = (HeadlessFile*)scn;
+	char *l, *end;
+
+	//A file that could not be opened reads as empty
+	if (f == NULL || fgets(f->line, sizeof(f->line), f->fp) == NULL) return false;
+
+	l = f->line;
+	while (*l == ' ' || *l == '\t') l++;
+	end = l + strlen(l);
+	while (end > l && (end[-1] == '\n' || end[-1] == '\r' || end[-1] == ' ' || end[-1] == '\t')) end--;
+	*end = '\0';
+
+	//End of the current block
+	if (strcmp(l, "END") == 0) return false;
+
+	line = l;
+	return true;
+}
+
+void oapiWriteScenario_string(FILEHANDLE scn, const char *item, const char *string)
+{
+	fprintf(((HeadlessFile*)scn)->fp, "  %s %s\n", item, string);
+}
+
+void oapiWriteScenario_int(FILEHANDLE scn, const char *item, int i)
+{
+	fprintf(((HeadlessFile*)scn)->fp, "  %s %d\n", item, i);
+}
+
+void oapiWriteScenario_float(FILEHANDLE scn, const char *item, double d)
+{
+	fprintf(((HeadlessFile*)scn)->fp, "  %s %0.12g\n", item, d);
+}
+
+void oapiWriteScenario_vec(FILEHANDLE scn, const char *item, const VECTOR3 &vec)
+{
+	fprintf(((HeadlessFile*)scn)->fp, "  %s %0.12g %0.12g %0.12g\n", item, vec.x, vec.y, vec.z);
+}
+
+// ===========================================================================
+// Panels and surfaces
+// ===========================================================================
+
+void oapiTriggerPanelRedrawArea(int panel_id, int area_id) {}
+void oapiTriggerRedrawArea(int panel_id, int vc_id, int area_id) {}
+SURFHANDLE oapiCreateSurface(int width, int height) { return NULL; }
+void oapiDestroySurface(SURFHANDLE surf) {}
+void oapiBlt(SURFHANDLE tgt, SURFHANDLE src, int tgtx, int tgty, int srcx, int srcy, int w, int h, DWORD ck) {}
+MESHHANDLE oapiLoadMeshGlobal(const char *fname) { return NULL; }
+SURFHANDLE oapiRegisterExhaustTexture(const char *name) { return NULL; }
+SURFHANDLE oapiRegisterReentryTexture(const char *name) { return NULL; }
+bool oapiCameraInternal() { return false; }
+double oapiCameraAperture() { return 0.0; }
+void oapiCameraSetAperture(double aperture) {}
+int oapiGetOrbiterVersion() { return 160828; }
+int oapiGetHUDMode() { return HUD_NONE; }
+bool oapiSetHUDMode(int mode) { return false; }
+SURFHANDLE oapiCreateSurface(HBITMAP hBmp, bool release_bmp) { return NULL; }
+SURFHANDLE oapiLoadTexture(const char *fname, bool dynamic) { return NULL; }
+SURFHANDLE oapiGetTextureHandle(MESHHANDLE hMesh, DWORD texidx) { return NULL; }
+HDC oapiGetDC(SURFHANDLE surf) { return NULL; }
+void oapiReleaseDC(SURFHANDLE surf, HDC hDC) {}
+void oapiSetSurfaceColourKey(SURFHANDLE surf, DWORD ck) {}
+void oapiClearSurface(SURFHANDLE surf, DWORD col) {}
+bool oapiColourFill(SURFHANDLE tgt, DWORD fillcolor, int tgtx, int tgty, int w, int h) { return false; }
+DWORD oapiGetColour(DWORD red, DWORD green, DWORD blue) { return (red << 16) | (green << 8) | blue; }
+void oapiRegisterPanelBackground(HBITMAP hBmp, DWORD flag, DWORD ck) {}
+void oapiRegisterPanelArea(int id, const RECT &pos, int draw_event, int mouse_event, int bkmode) {}
+void oapiSetPanelNeighbours(int left, int right, int top, int bottom) {}
+bool oapiSetPanel(int id) { return false; }
+double oapiGetPanelScale() { return 1.0; }
+void oapiVCRegisterArea(int id, const RECT &tgtrect, int draw_event, int mouse_event, int bkmode, SURFHANDLE tgt) {}
+void oapiVCRegisterArea(int id, int draw_event, int mouse_event) {}
+void oapiVCSetAreaClickmode_Spherical(int id, const VECTOR3 &cnt, double rad) {}
+void oapiVCSetAreaClickmode_Quadrilateral(int id, const VECTOR3 &p1, const VECTOR3 &p2, const VECTOR3 &p3, const VECTOR3 &p4) {}
+void oapiVCSetNeighbours(int left, int right, int top, int bottom) {}
+void oapiRegisterMFD(int id, const MFDSPEC &spec) {}
+int oapiGetMFDMode(int id) { return MFD_NONE; }
+const char *oapiMFDButtonLabel(int mfd, int bt) { return NULL; }
+bool oapiProcessMFDButton(int mfd, int bt, int event) { return false; }
+bool oapiSendMFDKey(int mfd, DWORD key) { return false; }
+void oapiToggleMFD_on(int mfd) {}
+int oapiCockpitMode() { return COCKPIT_GENERIC; }
+void oapiCameraAttach(OBJHANDLE hObj, int mode) {}
+void oapiCameraSetCockpitDir(double polar, double azimuth, bool transition) {}
+
+void oapiGetViewportSize(DWORD *w, DWORD *h, DWORD *bpp)
+{
+	*w = *h = 0;
+	if (bpp) *bpp = 0;
+}
+
+// ===========================================================================
+// Meshes and particles
+// ===========================================================================
+
+int oapiEditMeshGroup(DEVMESHHANDLE hMesh, DWORD grpidx, GROUPEDITSPEC *ges) { return -1; }
+MATERIAL *oapiMeshMaterial(MESHHANDLE hMesh, DWORD idx) { return NULL; }
+int oapiSetMaterial(DEVMESHHANDLE hMesh, int matidx, const MATERIAL *mat) { return -1; }
+SURFHANDLE oapiRegisterParticleTexture(const char *name) { return NULL; }
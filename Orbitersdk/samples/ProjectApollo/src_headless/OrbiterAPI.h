@@ -0,0 +1,906 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  Headless Orbiter API stand-in (Header)
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#pragma once
+
+//############################################################################//
+// Replacement for the parts of the Orbiter SDK used by the vessel systems and
+// the RTCC, for running them without Orbiter (see HeadlessSim.h). Put
+// src_headless ahead of the Orbiter SDK include directory to use it. Types,
+// names and signatures follow the Orbiter 2016 SDK, so code compiled against
+// this header doesn't need to change. Panels, virtual cockpits, MFDs, meshes
+// and particle streams have their types and functions so that vessel modules
+// compile unchanged, but nothing is displayed: registering does nothing and
+// surfaces and meshes are dummies.
+//############################################################################//
+
+#include <math.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stddef.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#define DLLCLBK extern "C" __declspec(dllexport)
+#else
+//Windows types and functions used in the SDK interface and in module code
+#include "posix/windows.h"
+
+#define DLLCLBK extern "C" __attribute__((visibility("default")))
+
+//MSVC runtime functions used throughout the module code
+#define _stricmp strcasecmp
+#define stricmp strcasecmp
+#define _strnicmp strncasecmp
+#define strnicmp strncasecmp
+#define __max(a, b) (((a) > (b)) ? (a) : (b))
+#define __min(a, b) (((a) < (b)) ? (a) : (b))
+#define _isnan isnan
+#define _snprintf snprintf
+#define __int64 long long
+//Only for formats without %s, %c and %[, which take a buffer size in the MSVC version
+#define sscanf_s sscanf
+
+#include <strings.h>
+#include <float.h>
+#include <type_traits>
+
+//Instead of the min and max macros of windows.h, which would break the standard headers
+template <class A, class B> inline typename std::common_type<A, B>::type min(A a, B b) { return a < b ? a : b; }
+template <class A, class B> inline typename std::common_type<A, B>::type max(A a, B b) { return a > b ? a : b; }
+
+inline int sprintf_s(char *buffer, size_t size, const char *format, ...)
+{
+	va_list args;
+	va_start(args, format);
+	int n = vsnprintf(buffer, size, format, args);
+	va_end(args);
+	return n;
+}
+
+template <size_t N> int sprintf_s(char(&buffer)[N], const char *format, ...)
+{
+	va_list args;
+	va_start(args, format);
+	int n = vsnprintf(buffer, N, format, args);
+	va_end(args);
+	return n;
+}
+
+inline int strcpy_s(char *dest, size_t size, const char *src)
+{
+	snprintf(dest, size, "%s", src);
+	return 0;
+}
+
+template <size_t N> int strcpy_s(char(&dest)[N], const char *src)
+{
+	snprintf(dest, N, "%s", src);
+	return 0;
+}
+#endif
+
+#define OAPIFUNC
+
+// ===========================================================================
+// Constants
+// ===========================================================================
+
+const double PI = 3.14159265358979323846;
+const double PI05 = 1.57079632679489661923;
+const double PI2 = 6.28318530717958647693;
+const double RAD = PI / 180.0;
+const double DEG = 180.0 / PI;
+const double C0 = 299792458.0;
+const double TAUA = 499.004783806;
+const double AU = C0 * TAUA;
+const double GGRAV = 6.67259e-11;
+const double G = 9.81;
+const double ATMP = 101.4e3;
+const double ATMD = 1.293;
+
+// ===========================================================================
+// Vectors and matrices
+// ===========================================================================
+
+typedef union {
+	double data[3];
+	struct { double x, y, z; };
+} VECTOR3;
+
+typedef union {
+	double data[4];
+	struct { double x, y, z, w; };
+} VECTOR4;
+
+typedef union {
+	double data[9];
+	struct { double m11, m12, m13, m21, m22, m23, m31, m32, m33; };
+} MATRIX3;
+
+typedef union {
+	double data[16];
+	struct { double m11, m12, m13, m14, m21, m22, m23, m24, m31, m32, m33, m34, m41, m42, m43, m44; };
+} MATRIX4;
+
+inline VECTOR3 _V(double x, double y, double z)
+{
+	VECTOR3 vec = { x, y, z };
+	return vec;
+}
+
+inline MATRIX3 _M(double m11, double m12, double m13, double m21, double m22, double m23, double m31, double m32, double m33)
+{
+	MATRIX3 mat = { m11, m12, m13, m21, m22, m23, m31, m32, m33 };
+	return mat;
+}
+
+inline VECTOR3 operator+ (const VECTOR3 &a, const VECTOR3 &b) { return _V(a.x + b.x, a.y + b.y, a.z + b.z); }
+inline VECTOR3 operator- (const VECTOR3 &a, const VECTOR3 &b) { return _V(a.x - b.x, a.y - b.y, a.z - b.z); }
+inline VECTOR3 operator* (const VECTOR3 &a, const double f) { return _V(a.x*f, a.y*f, a.z*f); }
+inline VECTOR3 operator* (const double f, const VECTOR3 &a) { return _V(a.x*f, a.y*f, a.z*f); }
+inline VECTOR3 operator/ (const VECTOR3 &a, const double f) { return _V(a.x / f, a.y / f, a.z / f); }
+inline VECTOR3 operator- (const VECTOR3 &a) { return _V(-a.x, -a.y, -a.z); }
+inline VECTOR3 &operator+= (VECTOR3 &a, const VECTOR3 &b) { a.x += b.x; a.y += b.y; a.z += b.z; return a; }
+inline VECTOR3 &operator-= (VECTOR3 &a, const VECTOR3 &b) { a.x -= b.x; a.y -= b.y; a.z -= b.z; return a; }
+inline VECTOR3 &operator*= (VECTOR3 &a, const double f) { a.x *= f; a.y *= f; a.z *= f; return a; }
+inline VECTOR3 &operator/= (VECTOR3 &a, const double f) { a.x /= f; a.y /= f; a.z /= f; return a; }
+
+inline double dotp(const VECTOR3 &a, const VECTOR3 &b) { return a.x*b.x + a.y*b.y + a.z*b.z; }
+inline VECTOR3 crossp(const VECTOR3 &a, const VECTOR3 &b) { return _V(a.y*b.z - b.y*a.z, a.z*b.x - b.z*a.x, a.x*b.y - b.x*a.y); }
+inline double length(const VECTOR3 &a) { return sqrt(a.x*a.x + a.y*a.y + a.z*a.z); }
+inline double dist(const VECTOR3 &a, const VECTOR3 &b) { return length(a - b); }
+inline void normalise(VECTOR3 &a) { a /= length(a); }
+inline VECTOR3 unit(const VECTOR3 &a) { return a / length(a); }
+
+inline MATRIX3 identity() { return _M(1, 0, 0, 0, 1, 0, 0, 0, 1); }
+
+inline MATRIX3 operator* (const MATRIX3 &A, double s)
+{
+	MATRIX3 M;
+	for (int i = 0;i < 9;i++) M.data[i] = A.data[i] * s;
+	return M;
+}
+
+inline MATRIX3 operator/ (const MATRIX3 &A, double s)
+{
+	MATRIX3 M;
+	for (int i = 0;i < 9;i++) M.data[i] = A.data[i] / s;
+	return M;
+}
+
+inline MATRIX3 &operator*= (MATRIX3 &A, double s)
+{
+	for (int i = 0;i < 9;i++) A.data[i] *= s;
+	return A;
+}
+
+inline MATRIX3 &operator/= (MATRIX3 &A, double s)
+{
+	for (int i = 0;i < 9;i++) A.data[i] /= s;
+	return A;
+}
+
+inline VECTOR3 mul(const MATRIX3 &A, const VECTOR3 &b)
+{
+	return _V(
+		A.m11*b.x + A.m12*b.y + A.m13*b.z,
+		A.m21*b.x + A.m22*b.y + A.m23*b.z,
+		A.m31*b.x + A.m32*b.y + A.m33*b.z);
+}
+
+inline VECTOR3 tmul(const MATRIX3 &A, const VECTOR3 &b)
+{
+	return _V(
+		A.m11*b.x + A.m21*b.y + A.m31*b.z,
+		A.m12*b.x + A.m22*b.y + A.m32*b.z,
+		A.m13*b.x + A.m23*b.y + A.m33*b.z);
+}
+
+inline MATRIX3 mul(const MATRIX3 &A, const MATRIX3 &B)
+{
+	MATRIX3 mat = {
+		A.m11*B.m11 + A.m12*B.m21 + A.m13*B.m31, A.m11*B.m12 + A.m12*B.m22 + A.m13*B.m32, A.m11*B.m13 + A.m12*B.m23 + A.m13*B.m33,
+		A.m21*B.m11 + A.m22*B.m21 + A.m23*B.m31, A.m21*B.m12 + A.m22*B.m22 + A.m23*B.m32, A.m21*B.m13 + A.m22*B.m23 + A.m23*B.m33,
+		A.m31*B.m11 + A.m32*B.m21 + A.m33*B.m31, A.m31*B.m12 + A.m32*B.m22 + A.m33*B.m32, A.m31*B.m13 + A.m32*B.m23 + A.m33*B.m33
+	};
+	return mat;
+}
+
+// ===========================================================================
+// Handles and enumerations
+// ===========================================================================
+
+typedef void *OBJHANDLE;
+typedef void *VISHANDLE;
+typedef void *MESHHANDLE;
+typedef void *DEVMESHHANDLE;
+typedef void *SURFHANDLE;
+typedef void *FILEHANDLE;
+typedef void *THRUSTER_HANDLE;
+typedef void *THGROUP_HANDLE;
+typedef void *PROPELLANT_HANDLE;
+typedef void *DOCKHANDLE;
+typedef void *ATTACHMENTHANDLE;
+typedef void *NOTEHANDLE;
+typedef void *PSTREAM_HANDLE;
+typedef void *ANIMATIONCOMPONENT_HANDLE;
+typedef void *AIRFOILHANDLE;
+typedef void *BEACONHANDLE;
+
+typedef double(*LiftCoeffFunc)(double aoa);
+typedef void(*AirfoilCoeffFunc)(double aoa, double M, double Re, double *cl, double *cm, double *cd);
+
+inline RECT _R(int left, int top, int right, int bottom)
+{
+	RECT r = { left, top, right, bottom };
+	return r;
+}
+
+#define OBJTP_INVALID 0
+#define OBJTP_GENERIC 1
+#define OBJTP_CBODY 2
+#define OBJTP_STAR 3
+#define OBJTP_PLANET 4
+#define OBJTP_VESSEL 10
+#define OBJTP_SURFBASE 20
+
+enum FileAccessMode { FILE_IN, FILE_OUT, FILE_APP, FILE_IN_ZEROONFAIL };
+
+enum PathRoot { ROOT, CONFIG, SCENARIOS, TEXTURES, TEXTURES2, MESHES, MODULES };
+
+enum THGROUP_TYPE {
+	THGROUP_MAIN, THGROUP_RETRO, THGROUP_HOVER,
+	THGROUP_ATT_PITCHUP, THGROUP_ATT_PITCHDOWN, THGROUP_ATT_YAWLEFT, THGROUP_ATT_YAWRIGHT,
+	THGROUP_ATT_BANKLEFT, THGROUP_ATT_BANKRIGHT, THGROUP_ATT_RIGHT, THGROUP_ATT_LEFT,
+	THGROUP_ATT_UP, THGROUP_ATT_DOWN, THGROUP_ATT_FORWARD, THGROUP_ATT_BACK,
+	THGROUP_USER = 0x40
+};
+
+enum ENGINETYPE { ENGINE_MAIN, ENGINE_RETRO, ENGINE_HOVER, ENGINE_ATTITUDE };
+
+enum REFFRAME { FRAME_GLOBAL, FRAME_LOCAL, FRAME_REFLOCAL, FRAME_HORIZON };
+
+enum AltitudeMode { ALTMODE_MEANRAD, ALTMODE_GROUND };
+
+enum AIRFOIL_ORIENTATION { LIFT_VERTICAL, LIFT_HORIZONTAL };
+
+#define RCS_NONE 0
+#define RCS_ROT 1
+#define RCS_LIN 2
+
+#define ATTMODE_DISABLED 0
+#define ATTMODE_ROT 1
+#define ATTMODE_LIN 2
+
+#define NAVMODE_KILLROT 1
+#define NAVMODE_HLEVEL 2
+#define NAVMODE_PROGRADE 3
+#define NAVMODE_RETROGRADE 4
+#define NAVMODE_NORMAL 5
+#define NAVMODE_ANTINORMAL 6
+#define NAVMODE_HOLDALT 7
+
+#define MANCTRL_ATTMODE 0
+#define MANCTRL_REVMODE 1
+#define MANCTRL_ROTMODE 2
+#define MANCTRL_LINMODE 3
+#define MANCTRL_ANYMODE 4
+#define MANCTRL_KEYBOARD 0
+#define MANCTRL_JOYSTICK 1
+#define MANCTRL_ANYDEVICE 2
+
+#define HUD_NONE 0
+#define HUD_ORBIT 1
+#define HUD_SURFACE 2
+#define HUD_DOCKING 3
+
+#define COCKPIT_GENERIC 1
+#define COCKPIT_PANELS 2
+#define COCKPIT_VIRTUAL 3
+
+//clbkGeneric messages
+#define VMSG_LUAINTERPRETER 0x0001
+#define VMSG_LUAINSTANCE 0x0002
+#define VMSG_USER 0x1000
+
+#define CAM_COCKPIT 0
+#define CAM_TARGETRELATIVE 1
+#define CAM_ABSDIRECTION 2
+#define CAM_GLOBALFRAME 3
+
+// ===========================================================================
+// Vessel state
+// ===========================================================================
+
+typedef struct {
+	VECTOR3 rpos;
+	VECTOR3 rvel;
+	VECTOR3 vrot;
+	VECTOR3 arot;
+	double fuel;
+	double eng_main;
+	double eng_hovr;
+	OBJHANDLE rbody;
+	OBJHANDLE base;
+	int port;
+	int status;
+	VECTOR3 vdata[10];
+	double fdata[10];
+	DWORD flag[10];
+} VESSELSTATUS;
+
+typedef struct {
+	DWORD version;
+	DWORD flag;
+	OBJHANDLE rbody;
+	OBJHANDLE base;
+	int port;
+	int status;
+	VECTOR3 rpos;
+	VECTOR3 rvel;
+	VECTOR3 vrot;
+	VECTOR3 arot;
+	double surf_lng, surf_lat, surf_hdg;
+	DWORD nfuel;
+	struct FUELSPEC {
+		DWORD idx;
+		double level;
+	} *fuel;
+	DWORD nthruster;
+	struct THRUSTSPEC {
+		DWORD idx;
+		double level;
+	} *thruster;
+	DWORD ndockinfo;
+	struct DOCKINFOSPEC {
+		DWORD idx;
+		DWORD ridx;
+		OBJHANDLE rvessel;
+	} *dockinfo;
+	DWORD xpdr;
+} VESSELSTATUS2;
+
+#define VS_FUELRESET 0x0001
+#define VS_FUELLIST 0x0002
+#define VS_THRUSTRESET 0x0004
+#define VS_THRUSTLIST 0x0008
+#define VS_DOCKINFOLIST 0x0010
+
+// ===========================================================================
+// Meshes, animations and lights
+// ===========================================================================
+
+//Animation components are accepted and ignored by the vessel interface, the classes only carry the parameters
+class MGROUP_TRANSFORM
+{
+public:
+	enum TYPE { NULLTRANSFORM, ROTATE, TRANSLATE, SCALE };
+
+	MGROUP_TRANSFORM() : mesh(0), grp(0), ngrp(0) {}
+	MGROUP_TRANSFORM(UINT _mesh, UINT *_grp, UINT _ngrp) : mesh(_mesh), grp(_grp), ngrp(_ngrp) {}
+	virtual ~MGROUP_TRANSFORM() {}
+	virtual TYPE Type() const { return NULLTRANSFORM; }
+
+	UINT mesh;
+	UINT *grp;
+	UINT ngrp;
+};
+
+class MGROUP_ROTATE : public MGROUP_TRANSFORM
+{
+public:
+	MGROUP_ROTATE(UINT _mesh, UINT *_grp, UINT _ngrp, const VECTOR3 &_ref, const VECTOR3 &_axis, float _angle)
+		: MGROUP_TRANSFORM(_mesh, _grp, _ngrp), ref(_ref), axis(_axis), angle(_angle) {}
+	TYPE Type() const { return ROTATE; }
+
+	VECTOR3 ref;
+	VECTOR3 axis;
+	float angle;
+};
+
+class MGROUP_TRANSLATE : public MGROUP_TRANSFORM
+{
+public:
+	MGROUP_TRANSLATE(UINT _mesh, UINT *_grp, UINT _ngrp, const VECTOR3 &_shift)
+		: MGROUP_TRANSFORM(_mesh, _grp, _ngrp), shift(_shift) {}
+	TYPE Type() const { return TRANSLATE; }
+
+	VECTOR3 shift;
+};
+
+class MGROUP_SCALE : public MGROUP_TRANSFORM
+{
+public:
+	MGROUP_SCALE(UINT _mesh, UINT *_grp, UINT _ngrp, const VECTOR3 &_ref, const VECTOR3 &_scale)
+		: MGROUP_TRANSFORM(_mesh, _grp, _ngrp), ref(_ref), scale(_scale) {}
+	TYPE Type() const { return SCALE; }
+
+	VECTOR3 ref;
+	VECTOR3 scale;
+};
+
+#define MESHVIS_NEVER 0x00
+#define MESHVIS_EXTERNAL 0x01
+#define MESHVIS_COCKPIT 0x02
+#define MESHVIS_ALWAYS (MESHVIS_EXTERNAL | MESHVIS_COCKPIT)
+#define MESHVIS_VC 0x04
+#define MESHVIS_EXTPASS 0x10
+
+#define BEACONSHAPE_COMPACT 0
+#define BEACONSHAPE_DIFFUSE 1
+#define BEACONSHAPE_STAR 2
+
+typedef struct {
+	DWORD shape;
+	VECTOR3 *pos;
+	VECTOR3 *col;
+	double size;
+	double falloff;
+	double period;
+	double duration;
+	double tofs;
+	bool active;
+} BEACONLIGHTSPEC;
+
+typedef struct {
+	float x, y, z;
+	float nx, ny, nz;
+	float tu, tv;
+} NTVERTEX;
+
+typedef struct {
+	float r, g, b, a;
+} COLOUR4;
+
+typedef struct {
+	COLOUR4 diffuse;
+	COLOUR4 ambient;
+	COLOUR4 specular;
+	COLOUR4 emissive;
+	float power;
+} MATERIAL;
+
+#define GRPEDIT_SETUSERFLAG 0x00001
+#define GRPEDIT_ADDUSERFLAG 0x00002
+#define GRPEDIT_DELUSERFLAG 0x00004
+#define GRPEDIT_VTXCRDX 0x00008
+#define GRPEDIT_VTXCRDY 0x00010
+#define GRPEDIT_VTXCRDZ 0x00020
+#define GRPEDIT_VTXCRD (GRPEDIT_VTXCRDX | GRPEDIT_VTXCRDY | GRPEDIT_VTXCRDZ)
+#define GRPEDIT_VTXTEXU 0x00400
+#define GRPEDIT_VTXTEXV 0x00800
+#define GRPEDIT_VTXTEX (GRPEDIT_VTXTEXU | GRPEDIT_VTXTEXV)
+
+typedef struct {
+	DWORD flags;
+	DWORD UsrFlag;
+	NTVERTEX *Vtx;
+	DWORD nVtx;
+	WORD *vIdx;
+} GROUPEDITSPEC;
+
+typedef struct {
+	VECTOR3 pos;
+	double stiffness;
+	double damping;
+	double mu;
+	double mu_lng;
+} TOUCHDOWNVTX;
+
+// ===========================================================================
+// Particle streams and exhaust
+// ===========================================================================
+
+typedef struct {
+	DWORD flags;
+	double srcsize;
+	double srcrate;
+	double v0;
+	double srcspread;
+	double lifetime;
+	double growthrate;
+	double atmslowdown;
+	enum LTYPE { EMISSIVE, DIFFUSE } ltype;
+	enum LEVELMAP { LVL_FLAT, LVL_LIN, LVL_SQRT, LVL_PLIN, LVL_PSQRT } levelmap;
+	double lmin, lmax;
+	enum ATMSMAP { ATM_FLAT, ATM_PLIN, ATM_PLOG } atmsmap;
+	double amin, amax;
+	SURFHANDLE tex;
+} PARTICLESTREAMSPEC;
+
+#define EXHAUST_CONSTANTLEVEL 0x0001
+#define EXHAUST_CONSTANTPOS 0x0002
+#define EXHAUST_CONSTANTDIR 0x0004
+
+typedef struct {
+	THRUSTER_HANDLE th;
+	double *level;
+	VECTOR3 *lpos;
+	VECTOR3 *ldir;
+	double lsize, wsize;
+	double lofs;
+	double modulate;
+	SURFHANDLE tex;
+	DWORD flags;
+	UINT id;
+} EXHAUSTSPEC;
+
+// ===========================================================================
+// Panels, virtual cockpits and MFDs
+// ===========================================================================
+
+#define SURF_NO_CK 0xFFFFFFFF
+#define SURF_PREDEF_CK 0xFFFFFFFE
+
+#define PANEL_REDRAW_NEVER 0x00
+#define PANEL_REDRAW_ALWAYS 0x01
+#define PANEL_REDRAW_MOUSE 0x02
+#define PANEL_REDRAW_INIT 0x03
+#define PANEL_REDRAW_USER 0x04
+#define PANEL_REDRAW_GDI 0x08
+#define PANEL_REDRAW_SKETCHPAD 0x10
+
+#define PANEL_MOUSE_IGNORE 0x00
+#define PANEL_MOUSE_LBDOWN 0x01
+#define PANEL_MOUSE_RBDOWN 0x02
+#define PANEL_MOUSE_LBUP 0x04
+#define PANEL_MOUSE_RBUP 0x08
+#define PANEL_MOUSE_LBPRESSED 0x10
+#define PANEL_MOUSE_RBPRESSED 0x20
+#define PANEL_MOUSE_DOWN (PANEL_MOUSE_LBDOWN | PANEL_MOUSE_RBDOWN)
+#define PANEL_MOUSE_UP (PANEL_MOUSE_LBUP | PANEL_MOUSE_RBUP)
+#define PANEL_MOUSE_PRESSED (PANEL_MOUSE_LBPRESSED | PANEL_MOUSE_RBPRESSED)
+#define PANEL_MOUSE_ONREPLAY 0x40
+
+#define PANEL_MAP_NONE 0x00
+#define PANEL_MAP_BACKGROUND 0x01
+#define PANEL_MAP_CURRENT 0x02
+#define PANEL_MAP_BGONREQUEST 0x03
+#define PANEL_MAP_DIRECT 0x04
+
+#define PANEL_ATTACH_BOTTOM 0x0001
+#define PANEL_ATTACH_TOP 0x0002
+#define PANEL_ATTACH_LEFT 0x0004
+#define PANEL_ATTACH_RIGHT 0x0008
+#define PANEL_MOVEOUT_BOTTOM 0x0010
+#define PANEL_MOVEOUT_TOP 0x0020
+#define PANEL_MOVEOUT_LEFT 0x0040
+#define PANEL_MOVEOUT_RIGHT 0x0080
+
+#define MFD_NONE -1
+#define MFD_LEFT 0
+#define MFD_RIGHT 1
+#define MFD_USER1 2
+#define MFD_USER2 3
+#define MFD_USER3 4
+#define MFD_USER4 5
+#define MFD_USER5 6
+#define MFD_USER6 7
+#define MFD_USER7 8
+#define MFD_USER8 9
+#define MFD_USER9 10
+#define MFD_USER10 11
+
+#define MFD_ORBIT 1
+#define MFD_SURFACE 2
+#define MFD_MAP 3
+#define MFD_HSI 4
+#define MFD_LANDING 5
+#define MFD_DOCKING 6
+#define MFD_OPLANEALIGN 7
+#define MFD_OSYNC 8
+#define MFD_TRANSFER 9
+#define MFD_COMMS 10
+#define MFD_USERTYPE 64
+
+typedef struct {
+	RECT pos;
+	int nbt_left, nbt_right;
+	int bt_yofs, bt_ydist;
+} MFDSPEC;
+
+// ===========================================================================
+// Keyboard, DirectInput key codes
+// ===========================================================================
+
+#define OAPI_KEY_ESCAPE 0x01
+#define OAPI_KEY_1 0x02
+#define OAPI_KEY_2 0x03
+#define OAPI_KEY_3 0x04
+#define OAPI_KEY_4 0x05
+#define OAPI_KEY_5 0x06
+#define OAPI_KEY_6 0x07
+#define OAPI_KEY_7 0x08
+#define OAPI_KEY_8 0x09
+#define OAPI_KEY_9 0x0A
+#define OAPI_KEY_0 0x0B
+#define OAPI_KEY_MINUS 0x0C
+#define OAPI_KEY_EQUALS 0x0D
+#define OAPI_KEY_BACK 0x0E
+#define OAPI_KEY_TAB 0x0F
+#define OAPI_KEY_Q 0x10
+#define OAPI_KEY_W 0x11
+#define OAPI_KEY_E 0x12
+#define OAPI_KEY_R 0x13
+#define OAPI_KEY_T 0x14
+#define OAPI_KEY_Y 0x15
+#define OAPI_KEY_U 0x16
+#define OAPI_KEY_I 0x17
+#define OAPI_KEY_O 0x18
+#define OAPI_KEY_P 0x19
+#define OAPI_KEY_LBRACKET 0x1A
+#define OAPI_KEY_RBRACKET 0x1B
+#define OAPI_KEY_RETURN 0x1C
+#define OAPI_KEY_LCONTROL 0x1D
+#define OAPI_KEY_A 0x1E
+#define OAPI_KEY_S 0x1F
+#define OAPI_KEY_D 0x20
+#define OAPI_KEY_F 0x21
+#define OAPI_KEY_G 0x22
+#define OAPI_KEY_H 0x23
+#define OAPI_KEY_J 0x24
+#define OAPI_KEY_K 0x25
+#define OAPI_KEY_L 0x26
+#define OAPI_KEY_SEMICOLON 0x27
+#define OAPI_KEY_APOSTROPHE 0x28
+#define OAPI_KEY_GRAVE 0x29
+#define OAPI_KEY_LSHIFT 0x2A
+#define OAPI_KEY_BACKSLASH 0x2B
+#define OAPI_KEY_Z 0x2C
+#define OAPI_KEY_X 0x2D
+#define OAPI_KEY_C 0x2E
+#define OAPI_KEY_V 0x2F
+#define OAPI_KEY_B 0x30
+#define OAPI_KEY_N 0x31
+#define OAPI_KEY_M 0x32
+#define OAPI_KEY_COMMA 0x33
+#define OAPI_KEY_PERIOD 0x34
+#define OAPI_KEY_SLASH 0x35
+#define OAPI_KEY_RSHIFT 0x36
+#define OAPI_KEY_MULTIPLY 0x37
+#define OAPI_KEY_LALT 0x38
+#define OAPI_KEY_SPACE 0x39
+#define OAPI_KEY_CAPITAL 0x3A
+#define OAPI_KEY_F1 0x3B
+#define OAPI_KEY_F2 0x3C
+#define OAPI_KEY_F3 0x3D
+#define OAPI_KEY_F4 0x3E
+#define OAPI_KEY_F5 0x3F
+#define OAPI_KEY_F6 0x40
+#define OAPI_KEY_F7 0x41
+#define OAPI_KEY_F8 0x42
+#define OAPI_KEY_F9 0x43
+#define OAPI_KEY_F10 0x44
+#define OAPI_KEY_NUMLOCK 0x45
+#define OAPI_KEY_SCROLL 0x46
+#define OAPI_KEY_NUMPAD7 0x47
+#define OAPI_KEY_NUMPAD8 0x48
+#define OAPI_KEY_NUMPAD9 0x49
+#define OAPI_KEY_SUBTRACT 0x4A
+#define OAPI_KEY_NUMPAD4 0x4B
+#define OAPI_KEY_NUMPAD5 0x4C
+#define OAPI_KEY_NUMPAD6 0x4D
+#define OAPI_KEY_ADD 0x4E
+#define OAPI_KEY_NUMPAD1 0x4F
+#define OAPI_KEY_NUMPAD2 0x50
+#define OAPI_KEY_NUMPAD3 0x51
+#define OAPI_KEY_NUMPAD0 0x52
+#define OAPI_KEY_DECIMAL 0x53
+#define OAPI_KEY_OEM_102 0x56
+#define OAPI_KEY_F11 0x57
+#define OAPI_KEY_F12 0x58
+#define OAPI_KEY_NUMPADENTER 0x9C
+#define OAPI_KEY_RCONTROL 0x9D
+#define OAPI_KEY_DIVIDE 0xB5
+#define OAPI_KEY_SYSRQ 0xB7
+#define OAPI_KEY_RALT 0xB8
+#define OAPI_KEY_PAUSE 0xC5
+#define OAPI_KEY_HOME 0xC7
+#define OAPI_KEY_UP 0xC8
+#define OAPI_KEY_PRIOR 0xC9
+#define OAPI_KEY_LEFT 0xCB
+#define OAPI_KEY_RIGHT 0xCD
+#define OAPI_KEY_END 0xCF
+#define OAPI_KEY_DOWN 0xD0
+#define OAPI_KEY_NEXT 0xD1
+#define OAPI_KEY_INSERT 0xD2
+#define OAPI_KEY_DELETE 0xD3
+
+#define KEYDOWN(buf, key) (buf[key] & 0x80)
+#define KEYMOD_LSHIFT(buf) (KEYDOWN(buf, OAPI_KEY_LSHIFT))
+#define KEYMOD_RSHIFT(buf) (KEYDOWN(buf, OAPI_KEY_RSHIFT))
+#define KEYMOD_SHIFT(buf) (KEYMOD_LSHIFT(buf) || KEYMOD_RSHIFT(buf))
+#define KEYMOD_LCONTROL(buf) (KEYDOWN(buf, OAPI_KEY_LCONTROL))
+#define KEYMOD_RCONTROL(buf) (KEYDOWN(buf, OAPI_KEY_RCONTROL))
+#define KEYMOD_CONTROL(buf) (KEYMOD_LCONTROL(buf) || KEYMOD_RCONTROL(buf))
+#define KEYMOD_LALT(buf) (KEYDOWN(buf, OAPI_KEY_LALT))
+#define KEYMOD_RALT(buf) (KEYDOWN(buf, OAPI_KEY_RALT))
+#define KEYMOD_ALT(buf) (KEYMOD_LALT(buf) || KEYMOD_RALT(buf))
+
+// ===========================================================================
+// Celestial bodies
+// ===========================================================================
+
+#define EPHEM_TRUEPOS 0x01
+#define EPHEM_TRUEVEL 0x02
+#define EPHEM_BARYPOS 0x04
+#define EPHEM_BARYVEL 0x08
+#define EPHEM_POLAR 0x10
+
+//Ephemeris interface of a celestial body. Data layout and units follow the VSOP87 (Earth) and ELP82 (Moon) modules
+//of Orbiter: the Earth returns heliocentric polar coordinates (longitude, latitude, AU), the Moon geocentric
+//cartesian coordinates in a right-handed ecliptic frame (m). The return value holds the EPHEM flags of the data.
+class CELBODY
+{
+public:
+	CELBODY() {}
+	virtual ~CELBODY() {}
+	virtual int clbkEphemeris(double mjd, int req, double *ret) = 0;
+};
+
+// ===========================================================================
+// API functions
+// ===========================================================================
+
+class VESSEL;
+
+//Objects
+OAPIFUNC OBJHANDLE oapiGetObjectByName(const char *name);
+OAPIFUNC OBJHANDLE oapiGetGbodyByName(const char *name);
+OAPIFUNC OBJHANDLE oapiGetGbodyByIndex(int index);
+OAPIFUNC DWORD oapiGetGbodyCount();
+OAPIFUNC OBJHANDLE oapiGetGbodyParent(OBJHANDLE hBody);
+OAPIFUNC void oapiGetObjectName(OBJHANDLE hObj, char *name, int n);
+OAPIFUNC int oapiGetObjectType(OBJHANDLE hObj);
+OAPIFUNC double oapiGetMass(OBJHANDLE hObj);
+OAPIFUNC double oapiGetSize(OBJHANDLE hObj);
+OAPIFUNC void oapiGetGlobalPos(OBJHANDLE hObj, VECTOR3 *pos);
+OAPIFUNC void oapiGetGlobalVel(OBJHANDLE hObj, VECTOR3 *vel);
+OAPIFUNC void oapiGetRelativePos(OBJHANDLE hObj, OBJHANDLE hRef, VECTOR3 *pos);
+OAPIFUNC void oapiGetRelativeVel(OBJHANDLE hObj, OBJHANDLE hRef, VECTOR3 *vel);
+OAPIFUNC void oapiGetRotationMatrix(OBJHANDLE hObj, MATRIX3 *mat);
+
+//Vessels
+OAPIFUNC OBJHANDLE oapiGetVesselByName(const char *name);
+OAPIFUNC OBJHANDLE oapiGetVesselByIndex(int index);
+OAPIFUNC DWORD oapiGetVesselCount();
+OAPIFUNC bool oapiIsVessel(OBJHANDLE hVessel);
+OAPIFUNC BOOL oapiGetAltitude(OBJHANDLE hVessel, double *alt);
+OAPIFUNC VESSEL *oapiGetVesselInterface(OBJHANDLE hVessel);
+OAPIFUNC OBJHANDLE oapiGetFocusObject();
+OAPIFUNC VESSEL *oapiGetFocusInterface();
+OAPIFUNC OBJHANDLE oapiSetFocusObject(OBJHANDLE hVessel);
+OAPIFUNC OBJHANDLE oapiCreateVessel(const char *name, const char *classname, const VESSELSTATUS &status);
+OAPIFUNC OBJHANDLE oapiCreateVesselEx(const char *name, const char *classname, const void *status);
+OAPIFUNC bool oapiDeleteVessel(OBJHANDLE hVessel, OBJHANDLE hAlternativeCameraTarget = 0);
+
+//Celestial bodies
+OAPIFUNC CELBODY *oapiGetCelbodyInterface(OBJHANDLE hBody);
+OAPIFUNC double oapiGetPlanetPeriod(OBJHANDLE hPlanet);
+OAPIFUNC double oapiGetPlanetObliquity(OBJHANDLE hPlanet);
+OAPIFUNC double oapiGetPlanetTheta(OBJHANDLE hPlanet);
+OAPIFUNC void oapiGetPlanetObliquityMatrix(OBJHANDLE hPlanet, MATRIX3 *mat);
+OAPIFUNC DWORD oapiGetPlanetJCoeffCount(OBJHANDLE hPlanet);
+OAPIFUNC double oapiGetPlanetJCoeff(OBJHANDLE hPlanet, DWORD n);
+OAPIFUNC double oapiGetPlanetCurrentRotation(OBJHANDLE hPlanet);
+OAPIFUNC double oapiSurfaceElevation(OBJHANDLE hPlanet, double lng, double lat);
+OAPIFUNC void oapiLocalToEqu(OBJHANDLE hObj, VECTOR3 loc, double *lng, double *lat, double *rad);
+OAPIFUNC void oapiEquToLocal(OBJHANDLE hObj, double lng, double lat, double rad, VECTOR3 *loc);
+OAPIFUNC void oapiLocalToGlobal(OBJHANDLE hObj, const VECTOR3 *local, VECTOR3 *global);
+OAPIFUNC void oapiGlobalToLocal(OBJHANDLE hObj, const VECTOR3 *global, VECTOR3 *local);
+OAPIFUNC void oapiEquToGlobal(OBJHANDLE hObj, double lng, double lat, double rad, VECTOR3 *glob);
+OAPIFUNC void oapiGlobalToEqu(OBJHANDLE hObj, VECTOR3 glob, double *lng, double *lat, double *rad);
+OAPIFUNC bool oapiGetHeading(OBJHANDLE hVessel, double *heading);
+
+//Time
+OAPIFUNC double oapiGetSimTime();
+OAPIFUNC double oapiGetSimStep();
+OAPIFUNC double oapiGetSysTime();
+OAPIFUNC double oapiGetSysStep();
+OAPIFUNC double oapiGetSimMJD();
+OAPIFUNC double oapiGetSysMJD();
+OAPIFUNC double oapiGetTimeAcceleration();
+OAPIFUNC void oapiSetTimeAcceleration(double warp);
+OAPIFUNC bool oapiGetPause();
+OAPIFUNC void oapiSetPause(bool pause);
+
+//Output
+OAPIFUNC char *oapiDebugString();
+OAPIFUNC void oapiWriteLog(const char *line);
+OAPIFUNC void oapiWriteLogV(const char *format, ...);
+
+//Files
+OAPIFUNC FILEHANDLE oapiOpenFile(const char *fname, FileAccessMode mode, PathRoot root = ROOT);
+OAPIFUNC void oapiCloseFile(FILEHANDLE f, FileAccessMode mode);
+OAPIFUNC bool oapiReadItem_string(FILEHANDLE f, const char *item, char *string);
+OAPIFUNC bool oapiReadItem_float(FILEHANDLE f, const char *item, double &val);
+OAPIFUNC bool oapiReadItem_int(FILEHANDLE f, const char *item, int &val);
+OAPIFUNC bool oapiReadItem_bool(FILEHANDLE f, const char *item, bool &val);
+OAPIFUNC bool oapiReadItem_vec(FILEHANDLE f, const char *item, VECTOR3 &val);
+OAPIFUNC void oapiWriteItem_string(FILEHANDLE f, const char *item, const char *string);
+OAPIFUNC void oapiWriteItem_float(FILEHANDLE f, const char *item, double val);
+OAPIFUNC void oapiWriteItem_int(FILEHANDLE f, const char *item, int val);
+OAPIFUNC void oapiWriteItem_bool(FILEHANDLE f, const char *item, bool val);
+OAPIFUNC void oapiWriteItem_vec(FILEHANDLE f, const char *item, const VECTOR3 &val);
+OAPIFUNC void oapiWriteLine(FILEHANDLE f, const char *line);
+
+//Scenario files
+OAPIFUNC bool oapiReadScenario_nextline(FILEHANDLE scn, char *&line);
+OAPIFUNC void oapiWriteScenario_string(FILEHANDLE scn, const char *item, const char *string);
+OAPIFUNC void oapiWriteScenario_int(FILEHANDLE scn, const char *item, int i);
+OAPIFUNC void oapiWriteScenario_float(FILEHANDLE scn, const char *item, double d);
+OAPIFUNC void oapiWriteScenario_vec(FILEHANDLE scn, const char *item, const VECTOR3 &vec);
+
+//Panels and surfaces, no-ops without a display
+OAPIFUNC void oapiTriggerPanelRedrawArea(int panel_id, int area_id);
+OAPIFUNC void oapiTriggerRedrawArea(int panel_id, int vc_id, int area_id);
+OAPIFUNC SURFHANDLE oapiCreateSurface(int width, int height);
+OAPIFUNC void oapiDestroySurface(SURFHANDLE surf);
+OAPIFUNC void oapiBlt(SURFHANDLE tgt, SURFHANDLE src, int tgtx, int tgty, int srcx, int srcy, int w, int h, DWORD ck = 0xFFFFFFFF);
+OAPIFUNC MESHHANDLE oapiLoadMeshGlobal(const char *fname);
+OAPIFUNC SURFHANDLE oapiRegisterExhaustTexture(const char *name);
+OAPIFUNC SURFHANDLE oapiRegisterReentryTexture(const char *name);
+OAPIFUNC bool oapiCameraInternal();
+OAPIFUNC double oapiCameraAperture();
+OAPIFUNC void oapiCameraSetAperture(double aperture);
+OAPIFUNC int oapiGetOrbiterVersion();
+OAPIFUNC int oapiGetHUDMode();
+OAPIFUNC bool oapiSetHUDMode(int mode);
+OAPIFUNC SURFHANDLE oapiCreateSurface(HBITMAP hBmp, bool release_bmp = true);
+OAPIFUNC SURFHANDLE oapiLoadTexture(const char *fname, bool dynamic = false);
+OAPIFUNC SURFHANDLE oapiGetTextureHandle(MESHHANDLE hMesh, DWORD texidx);
+OAPIFUNC HDC oapiGetDC(SURFHANDLE surf);
+OAPIFUNC void oapiReleaseDC(SURFHANDLE surf, HDC hDC);
+OAPIFUNC void oapiSetSurfaceColourKey(SURFHANDLE surf, DWORD ck);
+OAPIFUNC void oapiClearSurface(SURFHANDLE surf, DWORD col = 0);
+OAPIFUNC bool oapiColourFill(SURFHANDLE tgt, DWORD fillcolor, int tgtx = 0, int tgty = 0, int w = 0, int h = 0);
+OAPIFUNC DWORD oapiGetColour(DWORD red, DWORD green, DWORD blue);
+OAPIFUNC void oapiRegisterPanelBackground(HBITMAP hBmp, DWORD flag = PANEL_ATTACH_BOTTOM | PANEL_MOVEOUT_BOTTOM, DWORD ck = SURF_NO_CK);
+OAPIFUNC void oapiRegisterPanelArea(int id, const RECT &pos, int draw_event = PANEL_REDRAW_NEVER, int mouse_event = PANEL_MOUSE_IGNORE, int bkmode = PANEL_MAP_NONE);
+OAPIFUNC void oapiSetPanelNeighbours(int left, int right, int top, int bottom);
+OAPIFUNC bool oapiSetPanel(int id);
+OAPIFUNC double oapiGetPanelScale();
+OAPIFUNC void oapiVCRegisterArea(int id, const RECT &tgtrect, int draw_event, int mouse_event, int bkmode, SURFHANDLE tgt);
+OAPIFUNC void oapiVCRegisterArea(int id, int draw_event, int mouse_event);
+OAPIFUNC void oapiVCSetAreaClickmode_Spherical(int id, const VECTOR3 &cnt, double rad);
+OAPIFUNC void oapiVCSetAreaClickmode_Quadrilateral(int id, const VECTOR3 &p1, const VECTOR3 &p2, const VECTOR3 &p3, const VECTOR3 &p4);
+OAPIFUNC void oapiVCSetNeighbours(int left, int right, int top, int bottom);
+OAPIFUNC void oapiRegisterMFD(int id, const MFDSPEC &spec);
+OAPIFUNC int oapiGetMFDMode(int id);
+OAPIFUNC const char *oapiMFDButtonLabel(int mfd, int bt);
+OAPIFUNC bool oapiProcessMFDButton(int mfd, int bt, int event);
+OAPIFUNC bool oapiSendMFDKey(int mfd, DWORD key);
+OAPIFUNC void oapiToggleMFD_on(int mfd);
+OAPIFUNC int oapiCockpitMode();
+OAPIFUNC void oapiCameraAttach(OBJHANDLE hObj, int mode);
+OAPIFUNC void oapiCameraSetCockpitDir(double polar, double azimuth, bool transition = false);
+OAPIFUNC void oapiGetViewportSize(DWORD *w, DWORD *h, DWORD *bpp = 0);
+
+//Meshes and particles, no-ops without a display
+OAPIFUNC int oapiEditMeshGroup(DEVMESHHANDLE hMesh, DWORD grpidx, GROUPEDITSPEC *ges);
+OAPIFUNC MATERIAL *oapiMeshMaterial(MESHHANDLE hMesh, DWORD idx);
+OAPIFUNC int oapiSetMaterial(DEVMESHHANDLE hMesh, int matidx, const MATERIAL *mat);
+OAPIFUNC SURFHANDLE oapiRegisterParticleTexture(const char *name);
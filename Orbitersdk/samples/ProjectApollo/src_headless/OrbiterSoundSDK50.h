@@ -0,0 +1,76 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  Headless OrbiterSound SDK stand-in (Header)
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#pragma once
+
+//############################################################################//
+// Replacement for the OrbiterSound 5.0 SDK header with the functions and
+// constants used by soundlib. There is no sound without Orbiter, so
+// ConnectToOrbiterSoundDLL fails and SoundLib treats OrbiterSound as not
+// installed, like it does on Windows when the DLL is missing.
+//############################################################################//
+
+#include "OrbiterAPI.h"
+
+#define NOLOOP	0
+#define LOOP	1
+
+//Options of SoundOptionOnOff
+#define PLAYCOUNTDOWNWHENTAKEOFF	1
+#define PLAYCABINAIRCONDITIONING	2
+#define PLAYCABINRANDOMAMBIANCE		3
+#define PLAYRADIOATC				4
+#define PLAYWHENATTITUDEMODECHANGE	5
+#define PLAYGPWS					6
+#define PLAYMAINTHRUST				7
+#define PLAYHOVERTHRUST				8
+#define PLAYATTITUDETHRUST			9
+#define PLAYDOCKINGSOUND			10
+#define PLAYRADARBIP				11
+#define PLAYWINDAIRSPEED			12
+#define PLAYDOCKLANDCLANK			13
+#define PLAYLANDINGANDGROUNDSOUND	14
+#define PLAYWINDAMBIANCEWHENLANDED	15
+#define MUTEORBITERSOUND			16
+#define DISPLAYTIMER				17
+
+typedef enum
+{
+	DEFAULT,
+	INTERNAL_ONLY,
+	BOTHVIEW_FADED_CLOSE,
+	BOTHVIEW_FADED_MEDIUM,
+	BOTHVIEW_FADED_FAR,
+	EXTERNAL_ONLY_FADED_CLOSE,
+	EXTERNAL_ONLY_FADED_MEDIUM,
+	EXTERNAL_ONLY_FADED_FAR,
+	RADIO_SOUND,
+} EXTENDEDPLAY;
+
+inline int ConnectToOrbiterSoundDLL(OBJHANDLE Obj) { return -1; }
+inline BOOL SetMyDefaultWaveDirectory(char *MySoundDirectory) { return FALSE; }
+inline BOOL RequestLoadVesselWave(int MyID, int WavNumber, char *SoundName, EXTENDEDPLAY extended) { return FALSE; }
+inline BOOL PlayVesselWave(int MyID, int WavNumber, int Loop = NOLOOP, int Volume = 255, int Frequency = 0) { return FALSE; }
+inline BOOL StopVesselWave(int MyID, int WavNumber) { return FALSE; }
+inline BOOL IsPlaying(int MyID, int WavNumber) { return FALSE; }
+inline BOOL SoundOptionOnOff(int MyID, int Option, BOOL Status = TRUE) { return FALSE; }
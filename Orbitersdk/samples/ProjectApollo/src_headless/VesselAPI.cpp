@@ -0,0 +1,1488 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  Headless Orbiter API stand-in, vessel interface
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#include "HeadlessSim.h"
+#include <algorithm>
+
+#define SIM HeadlessSim::Instance()
+
+static inline HeadlessThruster *TH(THRUSTER_HANDLE th) { return (HeadlessThruster*)th; }
+static inline HeadlessPropellant *PH(PROPELLANT_HANDLE ph) { return (HeadlessPropellant*)ph; }
+static inline HeadlessThrusterGroup *TG(THGROUP_HANDLE thg) { return (HeadlessThrusterGroup*)thg; }
+
+//Orientation angles, R = Rx(alpha) Ry(beta) Rz(gamma) with Orbiter's left-handed rotations,
+//e.g. Rx(alpha) = [1 0 0; 0 cos sin; 0 -sin cos]
+static MATRIX3 EulerToMatrix(const VECTOR3 &arot)
+{
+	double sa = sin(arot.x), ca = cos(arot.x);
+	double sb = sin(arot.y), cb = cos(arot.y);
+	double sg = sin(arot.z), cg = cos(arot.z);
+
+	return _M(cb*cg, cb*sg, -sb,
+		sa*sb*cg - ca*sg, sa*sb*sg + ca*cg, sa*cb,
+		ca*sb*cg + sa*sg, ca*sb*sg - sa*cg, ca*cb);
+}
+
+static VECTOR3 MatrixToEuler(const MATRIX3 &R)
+{
+	return _V(atan2(R.m23, R.m33), -asin(std::max(-1.0, std::min(1.0, R.m13))), atan2(R.m12, R.m11));
+}
+
+// ===========================================================================
+// General
+// ===========================================================================
+
+VESSEL::VESSEL(OBJHANDLE hVessel, int fmodel)
+{
+	vessel = (HeadlessVessel*)(HeadlessObject*)hVessel;
+	vessel->flightmodel = fmodel;
+}
+
+VESSEL::~VESSEL()
+{
+}
+
+const OBJHANDLE VESSEL::GetHandle() const
+{
+	return (OBJHANDLE)(HeadlessObject*)vessel;
+}
+
+char *VESSEL::GetName() const
+{
+	snprintf(vessel->namebuf, sizeof(vessel->namebuf), "%s", vessel->name.c_str());
+	return vessel->namebuf;
+}
+
+char *VESSEL::GetClassName() const
+{
+	snprintf(vessel->classbuf, sizeof(vessel->classbuf), "%s", vessel->classname.c_str());
+	return vessel->classbuf;
+}
+
+int VESSEL::GetFlightModel() const
+{
+	return vessel->flightmodel;
+}
+
+bool VESSEL::GetEnableFocus() const
+{
+	return vessel->enablefocus;
+}
+
+void VESSEL::SetEnableFocus(bool enable) const
+{
+	vessel->enablefocus = enable;
+}
+
+// ===========================================================================
+// Mass and shape
+// ===========================================================================
+
+double VESSEL::GetSize() const
+{
+	return vessel->size;
+}
+
+void VESSEL::SetSize(double size) const
+{
+	vessel->size = size;
+}
+
+double VESSEL::GetEmptyMass() const
+{
+	return vessel->emptymass;
+}
+
+void VESSEL::SetEmptyMass(double m) const
+{
+	vessel->emptymass = m;
+}
+
+double VESSEL::GetMass() const
+{
+	return vessel->GetMass();
+}
+
+void VESSEL::GetPMI(VECTOR3 &pmi) const
+{
+	pmi = vessel->pmi;
+}
+
+void VESSEL::SetPMI(const VECTOR3 &pmi) const
+{
+	vessel->pmi = pmi;
+}
+
+// ===========================================================================
+// State
+// ===========================================================================
+
+void VESSEL::GetGlobalPos(VECTOR3 &pos) const
+{
+	pos = vessel->pos;
+}
+
+void VESSEL::GetGlobalVel(VECTOR3 &vel) const
+{
+	vel = vessel->vel;
+}
+
+void VESSEL::GetRelativePos(OBJHANDLE hRef, VECTOR3 &pos) const
+{
+	oapiGetRelativePos(GetHandle(), hRef, &pos);
+}
+
+void VESSEL::GetRelativeVel(OBJHANDLE hRef, VECTOR3 &vel) const
+{
+	oapiGetRelativeVel(GetHandle(), hRef, &vel);
+}
+
+OBJHANDLE VESSEL::GetGravityRef() const
+{
+	if (vessel->landed) return (OBJHANDLE)(HeadlessObject*)vessel->rbody;
+	return (OBJHANDLE)(HeadlessObject*)vessel->FindGravityRef();
+}
+
+OBJHANDLE VESSEL::GetSurfaceRef() const
+{
+	HeadlessBody *ref = vessel->landed ? vessel->rbody : vessel->FindGravityRef();
+
+	//The Sun has no surface
+	if (ref->type != OBJTP_PLANET) return NULL;
+	return (OBJHANDLE)(HeadlessObject*)ref;
+}
+
+double VESSEL::GetAltitude() const
+{
+	OBJHANDLE hRef = GetSurfaceRef();
+	if (hRef == NULL) return 0.0;
+
+	HeadlessBody *ref = (HeadlessBody*)(HeadlessObject*)hRef;
+	return length(vessel->pos - ref->pos) - ref->size - SIM.elevation;
+}
+
+double VESSEL::GetAltitude(AltitudeMode mode, int *reslvl) const
+{
+	if (mode == ALTMODE_GROUND) return GetAltitude();
+
+	OBJHANDLE hRef = GetSurfaceRef();
+	if (hRef == NULL) return 0.0;
+
+	HeadlessBody *ref = (HeadlessBody*)(HeadlessObject*)hRef;
+	return length(vessel->pos - ref->pos) - ref->size;
+}
+
+OBJHANDLE VESSEL::GetEquPos(double &longitude, double &latitude, double &radius) const
+{
+	OBJHANDLE hRef = GetSurfaceRef();
+	if (hRef == NULL) return NULL;
+
+	oapiGlobalToEqu(hRef, vessel->pos, &longitude, &latitude, &radius);
+	return hRef;
+}
+
+void VESSEL::GetRotationMatrix(MATRIX3 &R) const
+{
+	R = vessel->R;
+}
+
+void VESSEL::SetRotationMatrix(const MATRIX3 &R) const
+{
+	vessel->R = R;
+}
+
+void VESSEL::GetGlobalOrientation(VECTOR3 &arot) const
+{
+	arot = MatrixToEuler(vessel->R);
+}
+
+void VESSEL::SetGlobalOrientation(const VECTOR3 &arot) const
+{
+	vessel->R = EulerToMatrix(arot);
+}
+
+void VESSEL::GetAngularVel(VECTOR3 &avel) const
+{
+	avel = vessel->omega;
+}
+
+void VESSEL::SetAngularVel(const VECTOR3 &avel) const
+{
+	vessel->omega = avel;
+}
+
+void VESSEL::GlobalRot(const VECTOR3 &rloc, VECTOR3 &rglob) const
+{
+	rglob = mul(vessel->R, rloc);
+}
+
+void VESSEL::Local2Global(const VECTOR3 &local, VECTOR3 &global) const
+{
+	global = mul(vessel->R, local) + vessel->pos;
+}
+
+void VESSEL::Global2Local(const VECTOR3 &global, VECTOR3 &local) const
+{
+	local = tmul(vessel->R, global - vessel->pos);
+}
+
+void VESSEL::Local2Rel(const VECTOR3 &local, VECTOR3 &rel) const
+{
+	VECTOR3 rpos;
+
+	GetRelativePos(GetGravityRef(), rpos);
+	rel = mul(vessel->R, local) + rpos;
+}
+
+DWORD VESSEL::GetFlightStatus() const
+{
+	return vessel->landed ? 1 : 0;
+}
+
+bool VESSEL::GroundContact() const
+{
+	return vessel->landed;
+}
+
+void VESSEL::GetStatus(VESSELSTATUS &status) const
+{
+	VESSELSTATUS2 vs2;
+
+	memset(&vs2, 0, sizeof(vs2));
+	vs2.version = 2;
+	GetStatusEx(&vs2);
+
+	memset(&status, 0, sizeof(status));
+	status.rbody = vs2.rbody;
+	status.base = vs2.base;
+	status.port = vs2.port;
+	status.status = vs2.status;
+	status.rpos = vs2.rpos;
+	status.rvel = vs2.rvel;
+	status.vrot = vs2.vrot;
+	status.arot = vs2.arot;
+	status.vdata[0] = _V(vs2.surf_lng, vs2.surf_lat, vs2.surf_hdg);
+	if (vessel->defaultprop && vessel->defaultprop->maxmass > 0.0) status.fuel = vessel->defaultprop->mass / vessel->defaultprop->maxmass;
+	status.eng_main = GetThrusterGroupLevel(THGROUP_MAIN);
+	status.eng_hovr = GetThrusterGroupLevel(THGROUP_HOVER);
+}
+
+void VESSEL::GetStatusEx(void *status) const
+{
+	VESSELSTATUS2 *vs = (VESSELSTATUS2*)status;
+	OBJHANDLE hRef = GetGravityRef();
+
+	vs->flag = 0;
+	vs->rbody = hRef;
+	vs->base = NULL;
+	vs->port = 0;
+	vs->status = vessel->landed ? 1 : 0;
+	GetRelativePos(hRef, vs->rpos);
+	GetRelativeVel(hRef, vs->rvel);
+	vs->vrot = vessel->omega;
+	vs->arot = MatrixToEuler(vessel->R);
+	vs->surf_lng = vessel->lng;
+	vs->surf_lat = vessel->lat;
+	vs->surf_hdg = vessel->hdg;
+	vs->xpdr = 0;
+
+	//Lists are only filled in when the caller provides them
+	if (vs->fuel)
+	{
+		for (DWORD k = 0;k < vs->nfuel && k < vessel->propellants.size();k++)
+		{
+			HeadlessPropellant *p = vessel->propellants[k];
+			vs->fuel[k].idx = k;
+			vs->fuel[k].level = p->maxmass > 0.0 ? p->mass / p->maxmass : 0.0;
+		}
+	}
+	if (vs->thruster)
+	{
+		for (DWORD k = 0;k < vs->nthruster && k < vessel->thrusters.size();k++)
+		{
+			vs->thruster[k].idx = k;
+			vs->thruster[k].level = vessel->thrusters[k]->level;
+		}
+	}
+}
+
+void VESSEL::DefSetState(const VESSELSTATUS *status) const
+{
+	VESSELSTATUS2 vs2;
+
+	memset(&vs2, 0, sizeof(vs2));
+	vs2.version = 2;
+	vs2.rbody = status->rbody;
+	vs2.base = status->base;
+	vs2.port = status->port;
+	vs2.status = status->status;
+	vs2.rpos = status->rpos;
+	vs2.rvel = status->rvel;
+	vs2.vrot = status->vrot;
+	vs2.arot = status->arot;
+	vs2.surf_lng = status->vdata[0].x;
+	vs2.surf_lat = status->vdata[0].y;
+	vs2.surf_hdg = status->vdata[0].z;
+	DefSetStateEx(&vs2);
+}
+
+double VESSEL::GetPitch() const
+{
+	VECTOR3 east, up, north;
+
+	if (vessel->GetHorizon(east, up, north) == NULL) return 0.0;
+	return asin(dotp(mul(vessel->R, _V(0, 0, 1)), up));
+}
+
+double VESSEL::GetBank() const
+{
+	VECTOR3 east, up, north;
+
+	if (vessel->GetHorizon(east, up, north) == NULL) return 0.0;
+	return atan2(dotp(mul(vessel->R, _V(1, 0, 0)), up), dotp(mul(vessel->R, _V(0, 1, 0)), up));
+}
+
+bool VESSEL::GetAirspeedVector(REFFRAME frame, VECTOR3 &v) const
+{
+	VECTOR3 east, up, north;
+	HeadlessBody *ref = vessel->GetHorizon(east, up, north);
+
+	if (ref == NULL)
+	{
+		v = _V(0, 0, 0);
+		return false;
+	}
+
+	//Ground relative velocity, as in GetAirspeed
+	VECTOR3 r = vessel->pos - ref->pos;
+	VECTOR3 w = mul(ref->R, _V(0, PI2 / (ref->T_s*86400.0), 0));
+	VECTOR3 vg = vessel->vel - ref->vel - crossp(w, r);
+
+	switch (frame)
+	{
+	case FRAME_GLOBAL:
+		v = vg;
+		break;
+	case FRAME_LOCAL:
+		v = tmul(vessel->R, vg);
+		break;
+	case FRAME_REFLOCAL:
+		v = tmul(ref->R, vg);
+		break;
+	case FRAME_HORIZON:
+		v = _V(dotp(vg, east), dotp(vg, up), dotp(vg, north));
+		break;
+	}
+	return true;
+}
+
+//Without wind, the same as the airspeed
+bool VESSEL::GetGroundspeedVector(REFFRAME frame, VECTOR3 &v) const
+{
+	return GetAirspeedVector(frame, v);
+}
+
+bool VESSEL::NonsphericalGravityEnabled() const
+{
+	return false;
+}
+
+void VESSEL::DefSetStateEx(const void *status) const
+{
+	const VESSELSTATUS2 *vs = (const VESSELSTATUS2*)status;
+	HeadlessBody *ref = NULL;
+	DWORD k;
+
+	if (vs->rbody && SIM.IsBody(vs->rbody)) ref = (HeadlessBody*)(HeadlessObject*)vs->rbody;
+	if (ref == NULL) ref = SIM.GetBody("Earth");
+
+	if (vs->status == 1 && ref->type == OBJTP_PLANET)
+	{
+		vessel->landed = true;
+		vessel->rbody = ref;
+		vessel->lng = vs->surf_lng;
+		vessel->lat = vs->surf_lat;
+		vessel->hdg = vs->surf_hdg;
+		vessel->UpdateLanded();
+	}
+	else
+	{
+		vessel->landed = false;
+		vessel->rbody = ref;
+		vessel->pos = ref->pos + vs->rpos;
+		vessel->vel = ref->vel + vs->rvel;
+		vessel->R = EulerToMatrix(vs->arot);
+		vessel->omega = vs->vrot;
+	}
+
+	if (vs->flag & VS_FUELRESET)
+	{
+		for (k = 0;k < vessel->propellants.size();k++) vessel->propellants[k]->mass = 0.0;
+	}
+	if ((vs->flag & VS_FUELLIST) && vs->fuel)
+	{
+		for (k = 0;k < vs->nfuel;k++)
+		{
+			if (vs->fuel[k].idx >= vessel->propellants.size()) continue;
+			HeadlessPropellant *p = vessel->propellants[vs->fuel[k].idx];
+			p->mass = p->maxmass*vs->fuel[k].level;
+		}
+	}
+	if (vs->flag & VS_THRUSTRESET)
+	{
+		for (k = 0;k < vessel->thrusters.size();k++) vessel->thrusters[k]->level = 0.0;
+	}
+	if ((vs->flag & VS_THRUSTLIST) && vs->thruster)
+	{
+		for (k = 0;k < vs->nthruster;k++)
+		{
+			if (vs->thruster[k].idx >= vessel->thrusters.size()) continue;
+			vessel->thrusters[vs->thruster[k].idx]->level = vs->thruster[k].level;
+		}
+	}
+}
+
+// ===========================================================================
+// Atmosphere
+// ===========================================================================
+
+double VESSEL::GetAtmPressure() const { return 0.0; }
+double VESSEL::GetAtmDensity() const { return 0.0; }
+double VESSEL::GetAtmTemperature() const { return 0.0; }
+double VESSEL::GetDynPressure() const { return 0.0; }
+double VESSEL::GetMachNumber() const { return 0.0; }
+
+double VESSEL::GetAirspeed() const
+{
+	OBJHANDLE hRef = GetSurfaceRef();
+	if (hRef == NULL) return 0.0;
+
+	//Ground relative speed, the atmosphere rotates with the planet
+	HeadlessBody *ref = (HeadlessBody*)(HeadlessObject*)hRef;
+	VECTOR3 r = vessel->pos - ref->pos;
+	VECTOR3 w = mul(ref->R, _V(0, PI2 / (ref->T_s*86400.0), 0));
+	return length(vessel->vel - ref->vel - crossp(w, r));
+}
+
+double VESSEL::GetAOA() const
+{
+	VECTOR3 v;
+
+	if (!GetAirspeedVector(FRAME_LOCAL, v) || length(v) == 0.0) return 0.0;
+	return atan2(-v.y, v.z);
+}
+
+// ===========================================================================
+// Forces
+// ===========================================================================
+
+bool VESSEL::GetThrustVector(VECTOR3 &T) const
+{
+	VECTOR3 torque;
+
+	vessel->GetThrust(T, torque);
+	T -= vessel->addforce;
+	return length(T) > 0.0;
+}
+
+bool VESSEL::GetWeightVector(VECTOR3 &G) const
+{
+	VECTOR3 g = _V(0, 0, 0);
+
+	for (unsigned k = 0;k < SIM.bodies.size();k++)
+	{
+		VECTOR3 d = SIM.bodies[k]->pos - vessel->pos;
+		double r = length(d);
+		g += d * (GGRAV*SIM.bodies[k]->mass / (r*r*r));
+	}
+	G = tmul(vessel->R, g)*vessel->GetMass();
+	return true;
+}
+
+bool VESSEL::GetForceVector(VECTOR3 &F) const
+{
+	VECTOR3 T, G;
+
+	vessel->GetThrust(F, T);
+	GetWeightVector(G);
+	F += G;
+	return true;
+}
+
+void VESSEL::AddForce(const VECTOR3 &F, const VECTOR3 &r) const
+{
+	vessel->addforce += F;
+	vessel->addtorque += crossp(r, F);
+}
+
+void VESSEL::ShiftCentreOfMass(const VECTOR3 &shift) const
+{
+	vessel->pos += mul(vessel->R, shift);
+}
+
+//Moves the vessel frame, with everything defined in it, so that the centre of mass stays in place
+void VESSEL::ShiftCG(const VECTOR3 &shift) const
+{
+	unsigned k;
+
+	for (k = 0;k < vessel->thrusters.size();k++) vessel->thrusters[k]->pos -= shift;
+	for (k = 0;k < vessel->docks.size();k++) vessel->docks[k]->pos -= shift;
+	for (k = 0;k < vessel->attachments.size();k++) vessel->attachments[k]->pos -= shift;
+	ShiftCentreOfMass(shift);
+}
+
+void VESSEL::SetCOG_elev(double h) const
+{
+	vessel->cog_elev = h;
+}
+
+double VESSEL::GetCOG_elev() const
+{
+	return vessel->cog_elev;
+}
+
+//Landed vessels stay where they are, so the touchdown points and the friction aren't needed
+void VESSEL::SetTouchdownPoints(const VECTOR3 &pt1, const VECTOR3 &pt2, const VECTOR3 &pt3) const {}
+void VESSEL::SetTouchdownPoints(const TOUCHDOWNVTX *tdvtx, DWORD ntdvtx) const {}
+void VESSEL::SetSurfaceFrictionCoeff(double mu_lng, double mu_lat) const {}
+
+// ===========================================================================
+// Propellant resources
+// ===========================================================================
+
+PROPELLANT_HANDLE VESSEL::CreatePropellantResource(double maxmass, double mass, double efficiency) const
+{
+	HeadlessPropellant *p = new HeadlessPropellant;
+
+	p->maxmass = maxmass;
+	p->mass = mass < 0.0 ? maxmass : mass;
+	p->efficiency = efficiency;
+	p->flowrate = 0.0;
+	vessel->propellants.push_back(p);
+	if (vessel->defaultprop == NULL) vessel->defaultprop = p;
+	return (PROPELLANT_HANDLE)p;
+}
+
+void VESSEL::DelPropellantResource(PROPELLANT_HANDLE &ph) const
+{
+	std::vector<HeadlessPropellant*> &props = vessel->propellants;
+	std::vector<HeadlessPropellant*>::iterator it = std::find(props.begin(), props.end(), PH(ph));
+	if (it == props.end()) return;
+
+	for (unsigned k = 0;k < vessel->thrusters.size();k++)
+	{
+		if (vessel->thrusters[k]->prop == PH(ph)) vessel->thrusters[k]->prop = NULL;
+	}
+	if (vessel->defaultprop == PH(ph)) vessel->defaultprop = NULL;
+	props.erase(it);
+	delete PH(ph);
+	ph = NULL;
+}
+
+void VESSEL::ClearPropellantResources() const
+{
+	while (!vessel->propellants.empty())
+	{
+		PROPELLANT_HANDLE ph = vessel->propellants.back();
+		DelPropellantResource(ph);
+	}
+}
+
+DWORD VESSEL::GetPropellantCount() const
+{
+	return (DWORD)vessel->propellants.size();
+}
+
+PROPELLANT_HANDLE VESSEL::GetPropellantHandleByIndex(DWORD idx) const
+{
+	if (idx >= vessel->propellants.size()) return NULL;
+	return vessel->propellants[idx];
+}
+
+double VESSEL::GetPropellantMaxMass(PROPELLANT_HANDLE ph) const
+{
+	return ph ? PH(ph)->maxmass : 0.0;
+}
+
+void VESSEL::SetPropellantMaxMass(PROPELLANT_HANDLE ph, double maxmass) const
+{
+	if (ph == NULL) return;
+	PH(ph)->maxmass = maxmass;
+	if (PH(ph)->mass > maxmass) PH(ph)->mass = maxmass;
+}
+
+double VESSEL::GetPropellantMass(PROPELLANT_HANDLE ph) const
+{
+	return ph ? PH(ph)->mass : 0.0;
+}
+
+void VESSEL::SetPropellantMass(PROPELLANT_HANDLE ph, double mass) const
+{
+	if (ph) PH(ph)->mass = std::max(0.0, std::min(mass, PH(ph)->maxmass));
+}
+
+double VESSEL::GetPropellantEfficiency(PROPELLANT_HANDLE ph) const
+{
+	return ph ? PH(ph)->efficiency : 0.0;
+}
+
+void VESSEL::SetPropellantEfficiency(PROPELLANT_HANDLE ph, double efficiency) const
+{
+	if (ph) PH(ph)->efficiency = efficiency;
+}
+
+double VESSEL::GetPropellantFlowrate(PROPELLANT_HANDLE ph) const
+{
+	return ph ? PH(ph)->flowrate : 0.0;
+}
+
+double VESSEL::GetTotalPropellantMass() const
+{
+	double m = 0.0;
+
+	for (unsigned k = 0;k < vessel->propellants.size();k++) m += vessel->propellants[k]->mass;
+	return m;
+}
+
+double VESSEL::GetTotalPropellantFlowrate() const
+{
+	double f = 0.0;
+
+	for (unsigned k = 0;k < vessel->propellants.size();k++) f += vessel->propellants[k]->flowrate;
+	return f;
+}
+
+void VESSEL::SetDefaultPropellantResource(PROPELLANT_HANDLE ph) const
+{
+	vessel->defaultprop = PH(ph);
+}
+
+double VESSEL::GetFuelMass() const
+{
+	return vessel->defaultprop ? vessel->defaultprop->mass : 0.0;
+}
+
+double VESSEL::GetMaxFuelMass() const
+{
+	return vessel->defaultprop ? vessel->defaultprop->maxmass : 0.0;
+}
+
+// ===========================================================================
+// Thrusters
+// ===========================================================================
+
+THRUSTER_HANDLE VESSEL::CreateThruster(const VECTOR3 &pos, const VECTOR3 &dir, double maxth0, PROPELLANT_HANDLE hp, double isp0, double isp_ref, double p_ref) const
+{
+	HeadlessThruster *th = new HeadlessThruster;
+
+	th->pos = pos;
+	th->dir = unit(dir);
+	th->max0 = maxth0;
+	//Without an Isp the thruster doesn't consume propellant
+	th->isp0 = isp0;
+	th->level = th->level_ss = 0.0;
+	th->prop = PH(hp);
+	vessel->thrusters.push_back(th);
+	return (THRUSTER_HANDLE)th;
+}
+
+bool VESSEL::DelThruster(THRUSTER_HANDLE &th) const
+{
+	std::vector<HeadlessThruster*> &ths = vessel->thrusters;
+	std::vector<HeadlessThruster*>::iterator it = std::find(ths.begin(), ths.end(), TH(th));
+	if (it == ths.end()) return false;
+
+	for (unsigned k = 0;k < vessel->groups.size();k++)
+	{
+		std::vector<HeadlessThruster*> &gth = vessel->groups[k]->thrusters;
+		gth.erase(std::remove(gth.begin(), gth.end(), TH(th)), gth.end());
+	}
+	ths.erase(it);
+	delete TH(th);
+	th = NULL;
+	return true;
+}
+
+void VESSEL::ClearThrusterDefinitions() const
+{
+	unsigned k;
+
+	for (k = 0;k < vessel->groups.size();k++) delete vessel->groups[k];
+	vessel->groups.clear();
+	for (k = 0;k < vessel->thrusters.size();k++) delete vessel->thrusters[k];
+	vessel->thrusters.clear();
+}
+
+DWORD VESSEL::GetThrusterCount() const
+{
+	return (DWORD)vessel->thrusters.size();
+}
+
+THRUSTER_HANDLE VESSEL::GetThrusterHandleByIndex(DWORD idx) const
+{
+	if (idx >= vessel->thrusters.size()) return NULL;
+	return vessel->thrusters[idx];
+}
+
+PROPELLANT_HANDLE VESSEL::GetThrusterResource(THRUSTER_HANDLE th) const
+{
+	return TH(th)->prop;
+}
+
+void VESSEL::SetThrusterResource(THRUSTER_HANDLE th, PROPELLANT_HANDLE ph) const
+{
+	TH(th)->prop = PH(ph);
+}
+
+void VESSEL::GetThrusterRef(THRUSTER_HANDLE th, VECTOR3 &pos) const
+{
+	pos = TH(th)->pos;
+}
+
+void VESSEL::SetThrusterRef(THRUSTER_HANDLE th, const VECTOR3 &pos) const
+{
+	TH(th)->pos = pos;
+}
+
+void VESSEL::GetThrusterDir(THRUSTER_HANDLE th, VECTOR3 &dir) const
+{
+	dir = TH(th)->dir;
+}
+
+void VESSEL::SetThrusterDir(THRUSTER_HANDLE th, const VECTOR3 &dir) const
+{
+	TH(th)->dir = unit(dir);
+}
+
+double VESSEL::GetThrusterMax0(THRUSTER_HANDLE th) const
+{
+	return TH(th)->max0;
+}
+
+//In vacuum, which is everywhere
+double VESSEL::GetThrusterMax(THRUSTER_HANDLE th) const
+{
+	return TH(th)->max0;
+}
+
+void VESSEL::SetThrusterMax0(THRUSTER_HANDLE th, double maxth0) const
+{
+	TH(th)->max0 = maxth0;
+}
+
+double VESSEL::GetThrusterIsp0(THRUSTER_HANDLE th) const
+{
+	return TH(th)->isp0;
+}
+
+void VESSEL::SetThrusterIsp(THRUSTER_HANDLE th, double isp) const
+{
+	TH(th)->isp0 = isp;
+}
+
+void VESSEL::SetThrusterIsp(THRUSTER_HANDLE th, double isp0, double isp_ref, double p_ref) const
+{
+	TH(th)->isp0 = isp0;
+}
+
+double VESSEL::GetThrusterLevel(THRUSTER_HANDLE th) const
+{
+	return TH(th)->GetLevel();
+}
+
+void VESSEL::SetThrusterLevel(THRUSTER_HANDLE th, double level) const
+{
+	TH(th)->level = std::max(0.0, std::min(1.0, level));
+}
+
+void VESSEL::IncThrusterLevel(THRUSTER_HANDLE th, double dlevel) const
+{
+	SetThrusterLevel(th, TH(th)->level + dlevel);
+}
+
+void VESSEL::SetThrusterLevel_SingleStep(THRUSTER_HANDLE th, double level) const
+{
+	TH(th)->level_ss = std::max(0.0, std::min(1.0, level));
+}
+
+void VESSEL::GetThrusterMoment(THRUSTER_HANDLE th, VECTOR3 &F, VECTOR3 &T) const
+{
+	F = TH(th)->dir*TH(th)->GetLevel()*TH(th)->max0;
+	T = crossp(TH(th)->pos, F);
+}
+
+// ===========================================================================
+// Thruster groups
+// ===========================================================================
+
+THGROUP_HANDLE VESSEL::CreateThrusterGroup(THRUSTER_HANDLE *th, int nth, THGROUP_TYPE thgt) const
+{
+	HeadlessThrusterGroup *tg;
+
+	//Only one group per predefined type
+	if (thgt < THGROUP_USER && (tg = vessel->FindGroup(thgt)) != NULL)
+	{
+		THGROUP_HANDLE thg = tg;
+		DelThrusterGroup(thg);
+	}
+
+	tg = new HeadlessThrusterGroup;
+	tg->type = thgt;
+	for (int k = 0;k < nth;k++)
+	{
+		tg->thrusters.push_back(TH(th[k]));
+	}
+	vessel->groups.push_back(tg);
+	return (THGROUP_HANDLE)tg;
+}
+
+bool VESSEL::DelThrusterGroup(THGROUP_HANDLE &thg, bool delth) const
+{
+	std::vector<HeadlessThrusterGroup*> &groups = vessel->groups;
+	std::vector<HeadlessThrusterGroup*>::iterator it = std::find(groups.begin(), groups.end(), TG(thg));
+	if (it == groups.end()) return false;
+
+	if (delth)
+	{
+		std::vector<HeadlessThruster*> ths = TG(thg)->thrusters;
+		for (unsigned k = 0;k < ths.size();k++)
+		{
+			THRUSTER_HANDLE h = ths[k];
+			DelThruster(h);
+		}
+	}
+	groups.erase(std::find(groups.begin(), groups.end(), TG(thg)));
+	delete TG(thg);
+	thg = NULL;
+	return true;
+}
+
+bool VESSEL::DelThrusterGroup(THGROUP_TYPE thgt, bool delth) const
+{
+	THGROUP_HANDLE thg = vessel->FindGroup(thgt);
+	return DelThrusterGroup(thg, delth);
+}
+
+THGROUP_HANDLE VESSEL::GetThrusterGroupHandle(THGROUP_TYPE thgt) const
+{
+	return vessel->FindGroup(thgt);
+}
+
+DWORD VESSEL::GetGroupThrusterCount(THGROUP_HANDLE thg) const
+{
+	return thg ? (DWORD)TG(thg)->thrusters.size() : 0;
+}
+
+THRUSTER_HANDLE VESSEL::GetGroupThruster(THGROUP_HANDLE thg, DWORD idx) const
+{
+	if (thg == NULL || idx >= TG(thg)->thrusters.size()) return NULL;
+	return TG(thg)->thrusters[idx];
+}
+
+THRUSTER_HANDLE VESSEL::GetGroupThruster(THGROUP_TYPE thgt, DWORD idx) const
+{
+	return GetGroupThruster((THGROUP_HANDLE)vessel->FindGroup(thgt), idx);
+}
+
+void VESSEL::SetThrusterGroupLevel(THGROUP_HANDLE thg, double level) const
+{
+	if (thg == NULL) return;
+	for (unsigned k = 0;k < TG(thg)->thrusters.size();k++)
+	{
+		SetThrusterLevel(TG(thg)->thrusters[k], level);
+	}
+}
+
+void VESSEL::SetThrusterGroupLevel(THGROUP_TYPE thgt, double level) const
+{
+	SetThrusterGroupLevel(GetThrusterGroupHandle(thgt), level);
+}
+
+double VESSEL::GetThrusterGroupLevel(THGROUP_HANDLE thg) const
+{
+	if (thg == NULL || TG(thg)->thrusters.empty()) return 0.0;
+
+	double level = 0.0;
+	for (unsigned k = 0;k < TG(thg)->thrusters.size();k++)
+	{
+		level += TG(thg)->thrusters[k]->GetLevel();
+	}
+	return level / TG(thg)->thrusters.size();
+}
+
+double VESSEL::GetThrusterGroupLevel(THGROUP_TYPE thgt) const
+{
+	return GetThrusterGroupLevel(GetThrusterGroupHandle(thgt));
+}
+
+void VESSEL::SetEngineLevel(ENGINETYPE eng, double level) const
+{
+	switch (eng)
+	{
+	case ENGINE_MAIN:
+		SetThrusterGroupLevel(THGROUP_MAIN, level);
+		break;
+	case ENGINE_RETRO:
+		SetThrusterGroupLevel(THGROUP_RETRO, level);
+		break;
+	case ENGINE_HOVER:
+		SetThrusterGroupLevel(THGROUP_HOVER, level);
+		break;
+	default:
+		break;
+	}
+}
+
+// ===========================================================================
+// Manual attitude control
+// ===========================================================================
+
+int VESSEL::GetAttitudeMode() const
+{
+	return vessel->attmode;
+}
+
+bool VESSEL::SetAttitudeMode(int mode) const
+{
+	if (mode < RCS_NONE || mode > RCS_LIN) return false;
+	vessel->attmode = mode;
+	return true;
+}
+
+double VESSEL::GetManualControlLevel(THGROUP_TYPE thgt, DWORD mode, DWORD device) const
+{
+	return 0.0;
+}
+
+void VESSEL::SetAttitudeRotLevel(const VECTOR3 &th) const {}
+void VESSEL::SetAttitudeRotLevel(int axis, double th) const {}
+void VESSEL::SetAttitudeLinLevel(const VECTOR3 &th) const {}
+void VESSEL::SetAttitudeLinLevel(int axis, double th) const {}
+
+bool VESSEL::ActivateNavmode(int mode)
+{
+	if (mode < NAVMODE_KILLROT || mode > NAVMODE_HOLDALT) return false;
+	vessel->navmodes |= 1 << mode;
+	return true;
+}
+
+bool VESSEL::DeactivateNavmode(int mode)
+{
+	if (!GetNavmodeState(mode)) return false;
+	vessel->navmodes &= ~(1 << mode);
+	return true;
+}
+
+bool VESSEL::GetNavmodeState(int mode)
+{
+	if (mode < NAVMODE_KILLROT || mode > NAVMODE_HOLDALT) return false;
+	return (vessel->navmodes & (1 << mode)) != 0;
+}
+
+// ===========================================================================
+// Scenario state
+// ===========================================================================
+
+//Reads "idx:level idx:level ..." into a fuel or thruster list
+template <class SPEC> static void ParseLevelList(const char *s, SPEC *&list, DWORD &n)
+{
+	std::vector<SPEC> specs;
+	unsigned idx;
+	double level;
+	int len;
+
+	while (sscanf(s, " %u:%lf%n", &idx, &level, &len) == 2)
+	{
+		SPEC spec;
+		spec.idx = idx;
+		spec.level = level;
+		specs.push_back(spec);
+		s += len;
+	}
+
+	//The list belongs to the vessel status, HeadlessSim::CreateVessel frees it
+	delete[] list;
+	list = new SPEC[specs.size() + 1];
+	for (unsigned k = 0;k < specs.size();k++) list[k] = specs[k];
+	n = (DWORD)specs.size();
+}
+
+void VESSEL::ParseScenarioLineEx(char *line, void *status) const
+{
+	VESSELSTATUS2 *vs = (VESSELSTATUS2*)status;
+	char buffer[256];
+	VECTOR3 v;
+
+	if (!_strnicmp(line, "STATUS", 6))
+	{
+		if (sscanf(line + 6, "%255s", buffer) == 1)
+		{
+			vs->status = _stricmp(buffer, "Landed") == 0 ? 1 : 0;
+			//Orbiting <body> or Landed <body>
+			char body[256];
+			if (sscanf(line + 6, "%*s %255s", body) == 1)
+			{
+				HeadlessBody *b = SIM.GetBody(body);
+				if (b) vs->rbody = (OBJHANDLE)(HeadlessObject*)b;
+			}
+		}
+	}
+	else if (!_strnicmp(line, "RPOS", 4))
+	{
+		sscanf(line + 4, "%lf%lf%lf", &vs->rpos.x, &vs->rpos.y, &vs->rpos.z);
+	}
+	else if (!_strnicmp(line, "RVEL", 4))
+	{
+		sscanf(line + 4, "%lf%lf%lf", &vs->rvel.x, &vs->rvel.y, &vs->rvel.z);
+	}
+	else if (!_strnicmp(line, "AROT", 4))
+	{
+		if (sscanf(line + 4, "%lf%lf%lf", &v.x, &v.y, &v.z) == 3) vs->arot = v * RAD;
+	}
+	else if (!_strnicmp(line, "VROT", 4))
+	{
+		if (sscanf(line + 4, "%lf%lf%lf", &v.x, &v.y, &v.z) == 3) vs->vrot = v * RAD;
+	}
+	else if (!_strnicmp(line, "POS", 3))
+	{
+		if (sscanf(line + 3, "%lf%lf", &v.x, &v.y) == 2)
+		{
+			vs->surf_lng = v.x*RAD;
+			vs->surf_lat = v.y*RAD;
+		}
+	}
+	else if (!_strnicmp(line, "HEADING", 7))
+	{
+		if (sscanf(line + 7, "%lf", &v.x) == 1) vs->surf_hdg = v.x*RAD;
+	}
+	else if (!_strnicmp(line, "FUEL", 4))
+	{
+		//All tanks at the same level
+		if (sscanf(line + 4, "%lf", &v.x) == 1)
+		{
+			for (unsigned k = 0;k < vessel->propellants.size();k++)
+			{
+				vessel->propellants[k]->mass = vessel->propellants[k]->maxmass*v.x;
+			}
+		}
+	}
+	else if (!_strnicmp(line, "PRPLEVEL", 8))
+	{
+		ParseLevelList(line + 8, vs->fuel, vs->nfuel);
+		vs->flag |= VS_FUELLIST;
+	}
+	else if (!_strnicmp(line, "THLEVEL", 7))
+	{
+		ParseLevelList(line + 7, vs->thruster, vs->nthruster);
+		vs->flag |= VS_THRUSTLIST;
+	}
+}
+
+void VESSEL::SaveDefaultState(FILEHANDLE scn) const
+{
+	char buffer[1024];
+	unsigned k;
+	int n;
+
+	if (vessel->landed)
+	{
+		snprintf(buffer, sizeof(buffer), "Landed %s", vessel->rbody->name.c_str());
+		oapiWriteScenario_string(scn, "STATUS", buffer);
+		snprintf(buffer, sizeof(buffer), "%0.10f %0.10f", vessel->lng*DEG, vessel->lat*DEG);
+		oapiWriteScenario_string(scn, "POS", buffer);
+		oapiWriteScenario_float(scn, "HEADING", vessel->hdg*DEG);
+	}
+	else
+	{
+		HeadlessBody *ref = vessel->FindGravityRef();
+		snprintf(buffer, sizeof(buffer), "Orbiting %s", ref->name.c_str());
+		oapiWriteScenario_string(scn, "STATUS", buffer);
+		oapiWriteScenario_vec(scn, "RPOS", vessel->pos - ref->pos);
+		oapiWriteScenario_vec(scn, "RVEL", vessel->vel - ref->vel);
+		oapiWriteScenario_vec(scn, "AROT", MatrixToEuler(vessel->R)*DEG);
+		if (length(vessel->omega) > 0.0) oapiWriteScenario_vec(scn, "VROT", vessel->omega*DEG);
+	}
+
+	n = 0;
+	buffer[0] = '\0';
+	for (k = 0;k < vessel->propellants.size() && n < (int)sizeof(buffer) - 32;k++)
+	{
+		HeadlessPropellant *p = vessel->propellants[k];
+		if (p->maxmass <= 0.0) continue;
+		n += snprintf(buffer + n, sizeof(buffer) - n, "%s%u:%0.6f", n ? " " : "", k, p->mass / p->maxmass);
+	}
+	if (n) oapiWriteScenario_string(scn, "PRPLEVEL", buffer);
+
+	n = 0;
+	buffer[0] = '\0';
+	for (k = 0;k < vessel->thrusters.size() && n < (int)sizeof(buffer) - 32;k++)
+	{
+		if (vessel->thrusters[k]->level <= 0.0) continue;
+		n += snprintf(buffer + n, sizeof(buffer) - n, "%s%u:%0.6f", n ? " " : "", k, vessel->thrusters[k]->level);
+	}
+	if (n) oapiWriteScenario_string(scn, "THLEVEL", buffer);
+}
+
+// ===========================================================================
+// Docking
+// ===========================================================================
+
+static inline HeadlessDock *DH(DOCKHANDLE hDock) { return (HeadlessDock*)hDock; }
+static inline HeadlessAttachment *AH(ATTACHMENTHANDLE attachment) { return (HeadlessAttachment*)attachment; }
+
+DOCKHANDLE VESSEL::CreateDock(const VECTOR3 &pos, const VECTOR3 &dir, const VECTOR3 &rot) const
+{
+	HeadlessDock *d = new HeadlessDock;
+
+	d->pos = pos;
+	d->dir = dir;
+	d->rot = rot;
+	vessel->docks.push_back(d);
+	return (DOCKHANDLE)d;
+}
+
+bool VESSEL::DelDock(DOCKHANDLE hDock) const
+{
+	std::vector<HeadlessDock*>::iterator it = std::find(vessel->docks.begin(), vessel->docks.end(), DH(hDock));
+
+	if (it == vessel->docks.end()) return false;
+	delete *it;
+	vessel->docks.erase(it);
+	return true;
+}
+
+//The first dock, created if there is none
+void VESSEL::SetDockParams(const VECTOR3 &pos, const VECTOR3 &dir, const VECTOR3 &rot) const
+{
+	if (vessel->docks.empty()) CreateDock(pos, dir, rot);
+	else SetDockParams((DOCKHANDLE)vessel->docks[0], pos, dir, rot);
+}
+
+void VESSEL::SetDockParams(DOCKHANDLE hDock, const VECTOR3 &pos, const VECTOR3 &dir, const VECTOR3 &rot) const
+{
+	DH(hDock)->pos = pos;
+	DH(hDock)->dir = dir;
+	DH(hDock)->rot = rot;
+}
+
+void VESSEL::GetDockParams(DOCKHANDLE hDock, VECTOR3 &pos, VECTOR3 &dir, VECTOR3 &rot) const
+{
+	pos = DH(hDock)->pos;
+	dir = DH(hDock)->dir;
+	rot = DH(hDock)->rot;
+}
+
+void VESSEL::SetDockMode(int mode) const {}
+
+UINT VESSEL::DockCount() const
+{
+	return (UINT)vessel->docks.size();
+}
+
+UINT VESSEL::DockingStatus(UINT port) const
+{
+	return 0;
+}
+
+DOCKHANDLE VESSEL::GetDockHandle(UINT n) const
+{
+	if (n >= vessel->docks.size()) return NULL;
+	return (DOCKHANDLE)vessel->docks[n];
+}
+
+OBJHANDLE VESSEL::GetDockStatus(DOCKHANDLE hDock) const
+{
+	return NULL;
+}
+
+//Returns the error Orbiter gives for a target that isn't a vessel
+int VESSEL::Dock(OBJHANDLE target, UINT n, UINT tgtn, UINT mode) const
+{
+	return 3;
+}
+
+bool VESSEL::Undock(UINT n, const OBJHANDLE exclude) const
+{
+	return false;
+}
+
+// ===========================================================================
+// Attachments
+// ===========================================================================
+
+ATTACHMENTHANDLE VESSEL::CreateAttachment(bool toparent, const VECTOR3 &pos, const VECTOR3 &dir, const VECTOR3 &rot, const char *id, bool loose) const
+{
+	HeadlessAttachment *a = new HeadlessAttachment;
+
+	a->toparent = toparent;
+	a->pos = pos;
+	a->dir = dir;
+	a->rot = rot;
+	a->id = id;
+	vessel->attachments.push_back(a);
+	return (ATTACHMENTHANDLE)a;
+}
+
+bool VESSEL::DelAttachment(ATTACHMENTHANDLE attachment) const
+{
+	std::vector<HeadlessAttachment*>::iterator it = std::find(vessel->attachments.begin(), vessel->attachments.end(), AH(attachment));
+
+	if (it == vessel->attachments.end()) return false;
+	delete *it;
+	vessel->attachments.erase(it);
+	return true;
+}
+
+void VESSEL::SetAttachmentParams(ATTACHMENTHANDLE attachment, const VECTOR3 &pos, const VECTOR3 &dir, const VECTOR3 &rot) const
+{
+	AH(attachment)->pos = pos;
+	AH(attachment)->dir = dir;
+	AH(attachment)->rot = rot;
+}
+
+void VESSEL::GetAttachmentParams(ATTACHMENTHANDLE attachment, VECTOR3 &pos, VECTOR3 &dir, VECTOR3 &rot) const
+{
+	pos = AH(attachment)->pos;
+	dir = AH(attachment)->dir;
+	rot = AH(attachment)->rot;
+}
+
+const char *VESSEL::GetAttachmentId(ATTACHMENTHANDLE attachment) const
+{
+	return AH(attachment)->id.c_str();
+}
+
+OBJHANDLE VESSEL::GetAttachmentStatus(ATTACHMENTHANDLE attachment) const
+{
+	return NULL;
+}
+
+DWORD VESSEL::AttachmentCount(bool toparent) const
+{
+	DWORD n = 0;
+
+	for (unsigned k = 0;k < vessel->attachments.size();k++)
+	{
+		if (vessel->attachments[k]->toparent == toparent) n++;
+	}
+	return n;
+}
+
+ATTACHMENTHANDLE VESSEL::GetAttachmentHandle(bool toparent, DWORD i) const
+{
+	for (unsigned k = 0;k < vessel->attachments.size();k++)
+	{
+		if (vessel->attachments[k]->toparent == toparent && i-- == 0) return (ATTACHMENTHANDLE)vessel->attachments[k];
+	}
+	return NULL;
+}
+
+bool VESSEL::AttachChild(OBJHANDLE child, ATTACHMENTHANDLE attachment, ATTACHMENTHANDLE child_attachment) const
+{
+	return false;
+}
+
+bool VESSEL::DetachChild(ATTACHMENTHANDLE attachment, double vel) const
+{
+	return false;
+}
+
+// ===========================================================================
+// Radios
+// ===========================================================================
+
+bool VESSEL::EnableTransponder(bool enable) const
+{
+	return true;
+}
+
+bool VESSEL::InitNavRadios(DWORD nnav) const
+{
+	return true;
+}
+
+// ===========================================================================
+// Aerodynamics
+// ===========================================================================
+
+void VESSEL::SetCW(double cw_z_pos, double cw_z_neg, double cw_x, double cw_y) const {}
+void VESSEL::SetCrossSections(const VECTOR3 &cs) const {}
+void VESSEL::SetRotDrag(const VECTOR3 &rd) const {}
+void VESSEL::SetPitchMomentScale(double scale) const {}
+void VESSEL::SetYawMomentScale(double scale) const {}
+void VESSEL::SetLiftCoeffFunc(LiftCoeffFunc lcf) const {}
+void VESSEL::SetReentryTexture(SURFHANDLE tex, double plimit, double lscale, double wscale) const {}
+AIRFOILHANDLE VESSEL::CreateAirfoil(AIRFOIL_ORIENTATION align, const VECTOR3 &ref, AirfoilCoeffFunc cf, double c, double S, double A) const { return NULL; }
+void VESSEL::ClearAirfoilDefinitions() const {}
+void VESSEL::ClearVariableDragElements() const {}
+
+// ===========================================================================
+// Meshes, animations and exhaust
+// ===========================================================================
+
+UINT VESSEL::AddMesh(MESHHANDLE hMesh, const VECTOR3 *ofs) const
+{
+	return vessel->nmesh++;
+}
+
+UINT VESSEL::AddMesh(const char *meshname, const VECTOR3 *ofs) const
+{
+	return vessel->nmesh++;
+}
+
+//The index is always free, so the mesh goes in at the end
+UINT VESSEL::InsertMesh(MESHHANDLE hMesh, UINT idx, const VECTOR3 *ofs) const
+{
+	if (idx >= vessel->nmesh) vessel->nmesh = idx + 1;
+	return idx;
+}
+
+UINT VESSEL::InsertMesh(const char *meshname, UINT idx, const VECTOR3 *ofs) const
+{
+	return InsertMesh((MESHHANDLE)NULL, idx, ofs);
+}
+
+bool VESSEL::DelMesh(UINT idx, bool retain_anim) const
+{
+	return idx < vessel->nmesh;
+}
+
+void VESSEL::ClearMeshes(bool retain_anim) const
+{
+	vessel->nmesh = 0;
+	if (!retain_anim) vessel->nanim = 0;
+}
+
+UINT VESSEL::GetMeshCount() const
+{
+	return vessel->nmesh;
+}
+
+bool VESSEL::ShiftMesh(UINT idx, const VECTOR3 &ofs) const
+{
+	return idx < vessel->nmesh;
+}
+
+bool VESSEL::GetMeshOffset(UINT idx, VECTOR3 &ofs) const
+{
+	ofs = _V(0, 0, 0);
+	return idx < vessel->nmesh;
+}
+
+DEVMESHHANDLE VESSEL::GetDevMesh(VISHANDLE vis, UINT idx) const
+{
+	return NULL;
+}
+
+bool VESSEL::SetMeshVisibilityMode(UINT idx, WORD mode) const
+{
+	return idx < vessel->nmesh;
+}
+
+void VESSEL::SetClipRadius(double rad) const {}
+void VESSEL::SetVisibilityLimit(double vislimit, double spotlimit) const {}
+
+UINT VESSEL::CreateAnimation(double initial_state) const
+{
+	return vessel->nanim++;
+}
+
+bool VESSEL::DelAnimation(UINT anim) const
+{
+	return anim < vessel->nanim;
+}
+
+ANIMATIONCOMPONENT_HANDLE VESSEL::AddAnimationComponent(UINT anim, double state0, double state1, MGROUP_TRANSFORM *trans, ANIMATIONCOMPONENT_HANDLE parent) const
+{
+	//Any non-NULL handle, so the vessel can use it as the parent of the next component
+	return (ANIMATIONCOMPONENT_HANDLE)trans;
+}
+
+bool VESSEL::SetAnimation(UINT anim, double state) const
+{
+	return anim < vessel->nanim;
+}
+
+UINT VESSEL::AddExhaust(THRUSTER_HANDLE th, double lscale, double wscale, SURFHANDLE tex) const
+{
+	return 0;
+}
+
+UINT VESSEL::AddExhaust(THRUSTER_HANDLE th, double lscale, double wscale, double lofs, SURFHANDLE tex) const
+{
+	return 0;
+}
+
+UINT VESSEL::AddExhaust(THRUSTER_HANDLE th, double lscale, double wscale, const VECTOR3 &pos, const VECTOR3 &dir, SURFHANDLE tex) const
+{
+	return 0;
+}
+
+UINT VESSEL::AddExhaust(EXHAUSTSPEC *spec)
+{
+	return 0;
+}
+
+void VESSEL::ClearExhaustRefs() const {}
+void VESSEL::ClearAttExhaustRefs() const {}
+PSTREAM_HANDLE VESSEL::AddExhaustStream(THRUSTER_HANDLE th, PARTICLESTREAMSPEC *pss) const { return NULL; }
+PSTREAM_HANDLE VESSEL::AddExhaustStream(THRUSTER_HANDLE th, const VECTOR3 &pos, PARTICLESTREAMSPEC *pss) const { return NULL; }
+PSTREAM_HANDLE VESSEL::AddParticleStream(PARTICLESTREAMSPEC *pss, const VECTOR3 &pos, const VECTOR3 &dir, double *lvl) const { return NULL; }
+bool VESSEL::DelExhaustStream(PSTREAM_HANDLE ch) const { return ch != NULL; }
+void VESSEL::AddBeacon(BEACONLIGHTSPEC *bs) {}
+void VESSEL::ClearBeacons() {}
+
+// ===========================================================================
+// Cockpit camera
+// ===========================================================================
+
+void VESSEL::SetCameraOffset(const VECTOR3 &co) const {}
+void VESSEL::SetCameraDefaultDirection(const VECTOR3 &cd) const {}
+void VESSEL::SetCameraDefaultDirection(const VECTOR3 &cd, double tilt) const {}
+void VESSEL::SetCameraRotationRange(double left, double right, double up, double down) const {}
+void VESSEL::SetCameraMovement(const VECTOR3 &fwdpos, double fwdphi, double fwdtht, const VECTOR3 &lpos, double lphi, double ltht, const VECTOR3 &rpos, double rphi, double rtht) const {}
+void VESSEL::SetCameraCatchAngle(double cangle) const {}
+
+// ===========================================================================
+// VESSEL2 default callbacks
+// ===========================================================================
+
+void VESSEL2::clbkSaveState(FILEHANDLE scn)
+{
+	SaveDefaultState(scn);
+}
+
+void VESSEL2::clbkLoadStateEx(FILEHANDLE scn, void *status)
+{
+	char *line;
+
+	while (oapiReadScenario_nextline(scn, line))
+	{
+		ParseScenarioLineEx(line, status);
+	}
+}
+
+void VESSEL2::clbkSetStateEx(const void *status)
+{
+	DefSetStateEx(status);
+}
@@ -0,0 +1,301 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  Headless Orbiter API stand-in, vessel interface (Header)
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#pragma once
+
+#include "OrbiterAPI.h"
+
+class HeadlessVessel;
+
+//Vessel interface with the state, propellant and thruster functions of the Orbiter SDK. Meshes, animations,
+//exhaust, cameras, attachments and docking aren't simulated, their functions keep what the rest of the
+//interface reports back and otherwise do nothing.
+class VESSEL
+{
+public:
+	VESSEL(OBJHANDLE hVessel, int fmodel = 1);
+	virtual ~VESSEL();
+
+	const OBJHANDLE GetHandle() const;
+	char *GetName() const;
+	char *GetClassName() const;
+	int GetFlightModel() const;
+	bool GetEnableFocus() const;
+	void SetEnableFocus(bool enable) const;
+
+	//Mass and shape
+	double GetSize() const;
+	void SetSize(double size) const;
+	double GetEmptyMass() const;
+	void SetEmptyMass(double m) const;
+	double GetMass() const;
+	void GetPMI(VECTOR3 &pmi) const;
+	void SetPMI(const VECTOR3 &pmi) const;
+
+	//State
+	void GetGlobalPos(VECTOR3 &pos) const;
+	void GetGlobalVel(VECTOR3 &vel) const;
+	void GetRelativePos(OBJHANDLE hRef, VECTOR3 &pos) const;
+	void GetRelativeVel(OBJHANDLE hRef, VECTOR3 &vel) const;
+	OBJHANDLE GetGravityRef() const;
+	OBJHANDLE GetSurfaceRef() const;
+	double GetAltitude() const;
+	double GetAltitude(AltitudeMode mode, int *reslvl = 0) const;
+	OBJHANDLE GetEquPos(double &longitude, double &latitude, double &radius) const;
+	void GetRotationMatrix(MATRIX3 &R) const;
+	void SetRotationMatrix(const MATRIX3 &R) const;
+	void GetGlobalOrientation(VECTOR3 &arot) const;
+	void SetGlobalOrientation(const VECTOR3 &arot) const;
+	void GetAngularVel(VECTOR3 &avel) const;
+	void SetAngularVel(const VECTOR3 &avel) const;
+	void GlobalRot(const VECTOR3 &rloc, VECTOR3 &rglob) const;
+	void Local2Global(const VECTOR3 &local, VECTOR3 &global) const;
+	void Global2Local(const VECTOR3 &global, VECTOR3 &local) const;
+	void Local2Rel(const VECTOR3 &local, VECTOR3 &rel) const;
+	DWORD GetFlightStatus() const;
+	bool GroundContact() const;
+	void GetStatus(VESSELSTATUS &status) const;
+	void GetStatusEx(void *status) const;
+	void DefSetState(const VESSELSTATUS *status) const;
+	void DefSetStateEx(const void *status) const;
+	double GetPitch() const;
+	double GetBank() const;
+	bool GetAirspeedVector(REFFRAME frame, VECTOR3 &v) const;
+	bool GetGroundspeedVector(REFFRAME frame, VECTOR3 &v) const;
+	bool NonsphericalGravityEnabled() const;
+
+	//Atmosphere, there is none
+	double GetAtmPressure() const;
+	double GetAtmDensity() const;
+	double GetAtmTemperature() const;
+	double GetDynPressure() const;
+	double GetMachNumber() const;
+	double GetAirspeed() const;
+	double GetAOA() const;
+
+	//Forces
+	bool GetThrustVector(VECTOR3 &T) const;
+	bool GetWeightVector(VECTOR3 &G) const;
+	bool GetForceVector(VECTOR3 &F) const;
+	void AddForce(const VECTOR3 &F, const VECTOR3 &r) const;
+	void ShiftCentreOfMass(const VECTOR3 &shift) const;
+	void ShiftCG(const VECTOR3 &shift) const;
+	void SetCOG_elev(double h) const;
+	double GetCOG_elev() const;
+	void SetTouchdownPoints(const VECTOR3 &pt1, const VECTOR3 &pt2, const VECTOR3 &pt3) const;
+	void SetTouchdownPoints(const TOUCHDOWNVTX *tdvtx, DWORD ntdvtx) const;
+	void SetSurfaceFrictionCoeff(double mu_lng, double mu_lat) const;
+
+	//Propellant resources
+	PROPELLANT_HANDLE CreatePropellantResource(double maxmass, double mass = -1.0, double efficiency = 1.0) const;
+	void DelPropellantResource(PROPELLANT_HANDLE &ph) const;
+	void ClearPropellantResources() const;
+	DWORD GetPropellantCount() const;
+	PROPELLANT_HANDLE GetPropellantHandleByIndex(DWORD idx) const;
+	double GetPropellantMaxMass(PROPELLANT_HANDLE ph) const;
+	void SetPropellantMaxMass(PROPELLANT_HANDLE ph, double maxmass) const;
+	double GetPropellantMass(PROPELLANT_HANDLE ph) const;
+	void SetPropellantMass(PROPELLANT_HANDLE ph, double mass) const;
+	double GetPropellantEfficiency(PROPELLANT_HANDLE ph) const;
+	void SetPropellantEfficiency(PROPELLANT_HANDLE ph, double efficiency) const;
+	double GetPropellantFlowrate(PROPELLANT_HANDLE ph) const;
+	double GetTotalPropellantMass() const;
+	double GetTotalPropellantFlowrate() const;
+	void SetDefaultPropellantResource(PROPELLANT_HANDLE ph) const;
+	double GetFuelMass() const;
+	double GetMaxFuelMass() const;
+
+	//Thrusters
+	THRUSTER_HANDLE CreateThruster(const VECTOR3 &pos, const VECTOR3 &dir, double maxth0, PROPELLANT_HANDLE hp = NULL, double isp0 = 0.0, double isp_ref = 0.0, double p_ref = 101.4e3) const;
+	bool DelThruster(THRUSTER_HANDLE &th) const;
+	void ClearThrusterDefinitions() const;
+	DWORD GetThrusterCount() const;
+	THRUSTER_HANDLE GetThrusterHandleByIndex(DWORD idx) const;
+	PROPELLANT_HANDLE GetThrusterResource(THRUSTER_HANDLE th) const;
+	void SetThrusterResource(THRUSTER_HANDLE th, PROPELLANT_HANDLE ph) const;
+	void GetThrusterRef(THRUSTER_HANDLE th, VECTOR3 &pos) const;
+	void SetThrusterRef(THRUSTER_HANDLE th, const VECTOR3 &pos) const;
+	void GetThrusterDir(THRUSTER_HANDLE th, VECTOR3 &dir) const;
+	void SetThrusterDir(THRUSTER_HANDLE th, const VECTOR3 &dir) const;
+	double GetThrusterMax0(THRUSTER_HANDLE th) const;
+	double GetThrusterMax(THRUSTER_HANDLE th) const;
+	void SetThrusterMax0(THRUSTER_HANDLE th, double maxth0) const;
+	double GetThrusterIsp0(THRUSTER_HANDLE th) const;
+	void SetThrusterIsp(THRUSTER_HANDLE th, double isp) const;
+	void SetThrusterIsp(THRUSTER_HANDLE th, double isp0, double isp_ref, double p_ref = 101.4e3) const;
+	double GetThrusterLevel(THRUSTER_HANDLE th) const;
+	void SetThrusterLevel(THRUSTER_HANDLE th, double level) const;
+	void IncThrusterLevel(THRUSTER_HANDLE th, double dlevel) const;
+	void SetThrusterLevel_SingleStep(THRUSTER_HANDLE th, double level) const;
+	void GetThrusterMoment(THRUSTER_HANDLE th, VECTOR3 &F, VECTOR3 &T) const;
+
+	//Thruster groups
+	THGROUP_HANDLE CreateThrusterGroup(THRUSTER_HANDLE *th, int nth, THGROUP_TYPE thgt) const;
+	bool DelThrusterGroup(THGROUP_HANDLE &thg, bool delth = false) const;
+	bool DelThrusterGroup(THGROUP_TYPE thgt, bool delth = false) const;
+	THGROUP_HANDLE GetThrusterGroupHandle(THGROUP_TYPE thgt) const;
+	DWORD GetGroupThrusterCount(THGROUP_HANDLE thg) const;
+	THRUSTER_HANDLE GetGroupThruster(THGROUP_HANDLE thg, DWORD idx) const;
+	THRUSTER_HANDLE GetGroupThruster(THGROUP_TYPE thgt, DWORD idx) const;
+	void SetThrusterGroupLevel(THGROUP_HANDLE thg, double level) const;
+	void SetThrusterGroupLevel(THGROUP_TYPE thgt, double level) const;
+	double GetThrusterGroupLevel(THGROUP_HANDLE thg) const;
+	double GetThrusterGroupLevel(THGROUP_TYPE thgt) const;
+	void SetEngineLevel(ENGINETYPE eng, double level) const;
+
+	//Manual attitude control. There is no keyboard or joystick, so the manual levels are zero, and the
+	//navigation modes are remembered but don't fire thrusters
+	int GetAttitudeMode() const;
+	bool SetAttitudeMode(int mode) const;
+	double GetManualControlLevel(THGROUP_TYPE thgt, DWORD mode = MANCTRL_ATTMODE, DWORD device = MANCTRL_ANYDEVICE) const;
+	void SetAttitudeRotLevel(const VECTOR3 &th) const;
+	void SetAttitudeRotLevel(int axis, double th) const;
+	void SetAttitudeLinLevel(const VECTOR3 &th) const;
+	void SetAttitudeLinLevel(int axis, double th) const;
+	bool ActivateNavmode(int mode);
+	bool DeactivateNavmode(int mode);
+	bool GetNavmodeState(int mode);
+
+	//Docking, a vessel is never docked
+	DOCKHANDLE CreateDock(const VECTOR3 &pos, const VECTOR3 &dir, const VECTOR3 &rot) const;
+	bool DelDock(DOCKHANDLE hDock) const;
+	void SetDockParams(const VECTOR3 &pos, const VECTOR3 &dir, const VECTOR3 &rot) const;
+	void SetDockParams(DOCKHANDLE hDock, const VECTOR3 &pos, const VECTOR3 &dir, const VECTOR3 &rot) const;
+	void GetDockParams(DOCKHANDLE hDock, VECTOR3 &pos, VECTOR3 &dir, VECTOR3 &rot) const;
+	void SetDockMode(int mode) const;
+	UINT DockCount() const;
+	UINT DockingStatus(UINT port) const;
+	DOCKHANDLE GetDockHandle(UINT n) const;
+	OBJHANDLE GetDockStatus(DOCKHANDLE hDock) const;
+	int Dock(OBJHANDLE target, UINT n, UINT tgtn, UINT mode) const;
+	bool Undock(UINT n, const OBJHANDLE exclude = 0) const;
+
+	//Attachments, a vessel is never attached
+	ATTACHMENTHANDLE CreateAttachment(bool toparent, const VECTOR3 &pos, const VECTOR3 &dir, const VECTOR3 &rot, const char *id, bool loose = false) const;
+	bool DelAttachment(ATTACHMENTHANDLE attachment) const;
+	void SetAttachmentParams(ATTACHMENTHANDLE attachment, const VECTOR3 &pos, const VECTOR3 &dir, const VECTOR3 &rot) const;
+	void GetAttachmentParams(ATTACHMENTHANDLE attachment, VECTOR3 &pos, VECTOR3 &dir, VECTOR3 &rot) const;
+	const char *GetAttachmentId(ATTACHMENTHANDLE attachment) const;
+	OBJHANDLE GetAttachmentStatus(ATTACHMENTHANDLE attachment) const;
+	DWORD AttachmentCount(bool toparent) const;
+	ATTACHMENTHANDLE GetAttachmentHandle(bool toparent, DWORD i) const;
+	bool AttachChild(OBJHANDLE child, ATTACHMENTHANDLE attachment, ATTACHMENTHANDLE child_attachment) const;
+	bool DetachChild(ATTACHMENTHANDLE attachment, double vel = 0.0) const;
+
+	//Radios
+	bool EnableTransponder(bool enable) const;
+	bool InitNavRadios(DWORD nnav) const;
+
+	//Aerodynamics, ignored without an atmosphere
+	void SetCW(double cw_z_pos, double cw_z_neg, double cw_x, double cw_y) const;
+	void SetCrossSections(const VECTOR3 &cs) const;
+	void SetRotDrag(const VECTOR3 &rd) const;
+	void SetPitchMomentScale(double scale) const;
+	void SetYawMomentScale(double scale) const;
+	void SetLiftCoeffFunc(LiftCoeffFunc lcf) const;
+	void SetReentryTexture(SURFHANDLE tex, double plimit = 6e7, double lscale = 1.0, double wscale = 1.0) const;
+	AIRFOILHANDLE CreateAirfoil(AIRFOIL_ORIENTATION align, const VECTOR3 &ref, AirfoilCoeffFunc cf, double c, double S, double A) const;
+	void ClearAirfoilDefinitions() const;
+	void ClearVariableDragElements() const;
+
+	//Meshes, animations and exhaust. Indices are counted like in Orbiter, nothing is displayed
+	UINT AddMesh(MESHHANDLE hMesh, const VECTOR3 *ofs = 0) const;
+	UINT AddMesh(const char *meshname, const VECTOR3 *ofs = 0) const;
+	UINT InsertMesh(MESHHANDLE hMesh, UINT idx, const VECTOR3 *ofs = 0) const;
+	UINT InsertMesh(const char *meshname, UINT idx, const VECTOR3 *ofs = 0) const;
+	bool DelMesh(UINT idx, bool retain_anim = false) const;
+	void ClearMeshes(bool retain_anim = false) const;
+	UINT GetMeshCount() const;
+	bool ShiftMesh(UINT idx, const VECTOR3 &ofs) const;
+	bool GetMeshOffset(UINT idx, VECTOR3 &ofs) const;
+	DEVMESHHANDLE GetDevMesh(VISHANDLE vis, UINT idx) const;
+	bool SetMeshVisibilityMode(UINT idx, WORD mode) const;
+	void SetClipRadius(double rad) const;
+	void SetVisibilityLimit(double vislimit, double spotlimit = -1) const;
+	UINT CreateAnimation(double initial_state) const;
+	bool DelAnimation(UINT anim) const;
+	ANIMATIONCOMPONENT_HANDLE AddAnimationComponent(UINT anim, double state0, double state1, MGROUP_TRANSFORM *trans, ANIMATIONCOMPONENT_HANDLE parent = NULL) const;
+	bool SetAnimation(UINT anim, double state) const;
+	UINT AddExhaust(THRUSTER_HANDLE th, double lscale, double wscale, SURFHANDLE tex = 0) const;
+	UINT AddExhaust(THRUSTER_HANDLE th, double lscale, double wscale, double lofs, SURFHANDLE tex = 0) const;
+	UINT AddExhaust(THRUSTER_HANDLE th, double lscale, double wscale, const VECTOR3 &pos, const VECTOR3 &dir, SURFHANDLE tex = 0) const;
+	UINT AddExhaust(EXHAUSTSPEC *spec);
+	void ClearExhaustRefs() const;
+	void ClearAttExhaustRefs() const;
+	PSTREAM_HANDLE AddExhaustStream(THRUSTER_HANDLE th, PARTICLESTREAMSPEC *pss = 0) const;
+	PSTREAM_HANDLE AddExhaustStream(THRUSTER_HANDLE th, const VECTOR3 &pos, PARTICLESTREAMSPEC *pss = 0) const;
+	PSTREAM_HANDLE AddParticleStream(PARTICLESTREAMSPEC *pss, const VECTOR3 &pos, const VECTOR3 &dir, double *lvl) const;
+	bool DelExhaustStream(PSTREAM_HANDLE ch) const;
+	void AddBeacon(BEACONLIGHTSPEC *bs);
+	void ClearBeacons();
+
+	//Cockpit camera
+	void SetCameraOffset(const VECTOR3 &co) const;
+	void SetCameraDefaultDirection(const VECTOR3 &cd) const;
+	void SetCameraDefaultDirection(const VECTOR3 &cd, double tilt) const;
+	void SetCameraRotationRange(double left, double right, double up, double down) const;
+	void SetCameraMovement(const VECTOR3 &fwdpos, double fwdphi, double fwdtht, const VECTOR3 &lpos, double lphi, double ltht, const VECTOR3 &rpos, double rphi, double rtht) const;
+	void SetCameraCatchAngle(double cangle) const;
+
+	//Scenario state
+	void ParseScenarioLineEx(char *line, void *status) const;
+	void SaveDefaultState(FILEHANDLE scn) const;
+
+protected:
+	HeadlessVessel *vessel;
+};
+
+class VESSEL2 : public VESSEL
+{
+public:
+	VESSEL2(OBJHANDLE hVessel, int fmodel = 1) : VESSEL(hVessel, fmodel) {}
+
+	virtual void clbkSetClassCaps(FILEHANDLE cfg) {}
+	virtual void clbkSaveState(FILEHANDLE scn);
+	virtual void clbkLoadStateEx(FILEHANDLE scn, void *status);
+	virtual void clbkSetStateEx(const void *status);
+	virtual void clbkPostCreation() {}
+	virtual void clbkFocusChanged(bool getfocus, OBJHANDLE hNewVessel, OBJHANDLE hOldVessel) {}
+	virtual void clbkPreStep(double simt, double simdt, double mjd) {}
+	virtual void clbkPostStep(double simt, double simdt, double mjd) {}
+	virtual int clbkConsumeDirectKey(char *keystate) { return 0; }
+	virtual int clbkConsumeBufferedKey(DWORD key, bool down, char *kstate) { return 0; }
+};
+
+class VESSEL3 : public VESSEL2
+{
+public:
+	VESSEL3(OBJHANDLE hVessel, int fmodel = 1) : VESSEL2(hVessel, fmodel) {}
+
+	virtual int clbkGeneric(int msgid = 0, int prm = 0, void *context = NULL) { return 0; }
+
+	bool TriggerPanelRedrawArea(int panel_id, int area_id) { return false; }
+};
+
+class VESSEL4 : public VESSEL3
+{
+public:
+	VESSEL4(OBJHANDLE hVessel, int fmodel = 1) : VESSEL3(hVessel, fmodel) {}
+
+	virtual int clbkNavProcess(int mode) { return mode; }
+};
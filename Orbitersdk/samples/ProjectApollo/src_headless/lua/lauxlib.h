@@ -0,0 +1,41 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  Headless Lua stand-in (Header)
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#pragma once
+
+
+#include "lua.h"
+
+typedef struct luaL_Reg
+{
+	const char *name;
+	lua_CFunction func;
+} luaL_Reg;
+
+#define luaL_reg luaL_Reg
+
+static inline int luaL_newmetatable(lua_State *L, const char *tname) { return 0; }
+static inline void luaL_openlib(lua_State *L, const char *libname, const luaL_Reg *l, int nup) {}
+static inline int luaL_dofile(lua_State *L, const char *filename) { return 1; }
+
+#define luaL_getmetatable(L,n) lua_pushstring(L, (n))
@@ -0,0 +1,57 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  Headless Lua stand-in (Header)
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#pragma once
+
+
+//############################################################################//
+// Replacement for the Lua 5.1 headers of the Orbiter SDK with the calls of
+// the vessel script interfaces. Without Orbiter there is no script
+// interpreter, so the VMSG_LUAINTERPRETER and VMSG_LUAINSTANCE messages are
+// never sent and none of these functions is called. They do nothing.
+//############################################################################//
+
+#include <stddef.h>
+
+typedef struct lua_State lua_State;
+typedef double lua_Number;
+typedef ptrdiff_t lua_Integer;
+typedef int (*lua_CFunction)(lua_State *L);
+
+static inline void lua_settop(lua_State *L, int idx) {}
+static inline void lua_pushvalue(lua_State *L, int idx) {}
+static inline void lua_pushnumber(lua_State *L, lua_Number n) {}
+static inline void lua_pushstring(lua_State *L, const char *s) {}
+static inline void lua_settable(lua_State *L, int idx) {}
+static inline int lua_setmetatable(lua_State *L, int objindex) { return 0; }
+static inline int lua_type(lua_State *L, int idx) { return 0; }
+static inline void *lua_touserdata(lua_State *L, int idx) { return 0; }
+static inline const char *lua_tolstring(lua_State *L, int idx, size_t *len) { return 0; }
+static inline lua_Integer lua_tointeger(lua_State *L, int idx) { return 0; }
+static inline int lua_toboolean(lua_State *L, int idx) { return 0; }
+
+#define LUA_TNIL 0
+
+#define lua_pop(L,n) lua_settop(L, -(n)-1)
+#define lua_isnil(L,n) (lua_type(L, (n)) == LUA_TNIL)
+#define lua_tostring(L,i) lua_tolstring(L, (i), 0)
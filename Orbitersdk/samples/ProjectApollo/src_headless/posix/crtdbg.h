@@ -0,0 +1,32 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  Headless crtdbg.h stand-in (Header)
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#pragma once
+
+//The MSVC debug heap. Without it the flags change nothing.
+#define _CRTDBG_ALLOC_MEM_DF 0x01
+#define _CRTDBG_CHECK_ALWAYS_DF 0x04
+#define _CRTDBG_LEAK_CHECK_DF 0x20
+#define _CRTDBG_REPORT_FLAG -1
+
+inline int _CrtSetDbgFlag(int newFlag) { return 0; }
@@ -0,0 +1,45 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  Headless DirectX stand-in
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+//With INITGUID, the DEFINE_GUIDs of the headers define the GUIDs, which is what dxguid.lib does on Windows
+#define INITGUID
+#define DIRECTINPUT_VERSION 0x0800
+#include "windows.h"
+#include "dinput.h"
+#include "dsound.h"
+
+//Nothing reads the format, because no joystick is ever created
+extern "C" const DIDATAFORMAT c_dfDIJoystick2 = { sizeof(DIDATAFORMAT), sizeof(DIOBJECTDATAFORMAT), DIDF_ABSAXIS, sizeof(DIJOYSTATE2), 0, NULL };
+
+//There are neither input nor sound devices. The vessels check the result and run without joysticks and sound.
+HRESULT WINAPI DirectInput8Create(HINSTANCE hinst, DWORD dwVersion, REFIID riidltf, LPVOID *ppvOut, LPUNKNOWN punkOuter)
+{
+	if (ppvOut) *ppvOut = NULL;
+	return DIERR_GENERIC;
+}
+
+HRESULT WINAPI DirectSoundCreate8(LPCGUID pcGuidDevice, LPDIRECTSOUND8 *ppDS8, LPUNKNOWN pUnkOuter)
+{
+	if (ppDS8) *ppDS8 = NULL;
+	return DSERR_NODRIVER;
+}
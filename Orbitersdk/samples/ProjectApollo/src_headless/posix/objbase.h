@@ -0,0 +1,85 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  Headless COM stand-in (Header)
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#pragma once
+
+//############################################################################//
+// Replacement for the parts of objbase.h that the DirectX headers in src_aux
+// (dinput.h and dsound.h) need: GUIDs, IUnknown and the interface
+// declaration macros. With it those headers compile unchanged, and the
+// DirectSound and DirectInput interfaces are plain C++ classes. Creating a
+// device always fails (directx.cpp), so the sound and joystick code takes
+// its no-device paths.
+//############################################################################//
+
+#include "windows.h"
+
+typedef struct _GUID
+{
+	DWORD Data1;
+	WORD Data2;
+	WORD Data3;
+	BYTE Data4[8];
+} GUID, *LPGUID;
+
+typedef const GUID *LPCGUID;
+typedef GUID IID;
+typedef GUID CLSID;
+typedef const GUID &REFGUID;
+typedef const IID &REFIID;
+typedef const CLSID &REFCLSID;
+
+inline bool operator== (const GUID &a, const GUID &b) { return memcmp(&a, &b, sizeof(GUID)) == 0; }
+inline bool operator!= (const GUID &a, const GUID &b) { return !(a == b); }
+inline BOOL IsEqualGUID(REFGUID a, REFGUID b) { return a == b; }
+
+//The GUIDs of dxguid.lib are defined once by directx.cpp, which includes the headers with INITGUID
+#ifdef INITGUID
+#define DEFINE_GUID(name, l, w1, w2, b1, b2, b3, b4, b5, b6, b7, b8) \
+	extern "C" const GUID name = { l, w1, w2, { b1, b2, b3, b4, b5, b6, b7, b8 } }
+#else
+#define DEFINE_GUID(name, l, w1, w2, b1, b2, b3, b4, b5, b6, b7, b8) extern "C" const GUID name
+#endif
+
+DEFINE_GUID(GUID_NULL, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+
+#define interface struct
+#define STDMETHODCALLTYPE
+#define STDAPI extern "C" HRESULT
+#define STDMETHOD(method) virtual HRESULT STDMETHODCALLTYPE method
+#define STDMETHOD_(type, method) virtual type STDMETHODCALLTYPE method
+#define PURE = 0
+#define THIS_
+#define THIS void
+#define DECLARE_INTERFACE(iface) interface iface
+#define DECLARE_INTERFACE_(iface, baseiface) interface iface : public baseiface
+
+interface IUnknown
+{
+	virtual ~IUnknown() {}
+	STDMETHOD(QueryInterface)(REFIID riid, LPVOID *ppvObj) PURE;
+	STDMETHOD_(ULONG, AddRef)(THIS) PURE;
+	STDMETHOD_(ULONG, Release)(THIS) PURE;
+};
+
+typedef IUnknown *LPUNKNOWN;
@@ -0,0 +1,413 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  Headless Windows API stand-in
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#include "windows.h"
+#include <errno.h>
+#include <stdio.h>
+#include <time.h>
+#include <unistd.h>
+#include <dlfcn.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+//Kernel objects behind a HANDLE. A thread is signaled when it has finished, an event when it is set.
+struct HeadlessHandle
+{
+	virtual ~HeadlessHandle() {}
+
+	std::mutex m;
+	std::condition_variable cv;
+	bool signaled = false;
+	bool manualreset = true;
+	int waiters = 0;
+};
+
+struct HeadlessThreadHandle : public HeadlessHandle
+{
+	std::thread t;
+	bool suspended = false;
+};
+
+static bool Wait(HeadlessHandle *h, DWORD ms)
+{
+	std::unique_lock<std::mutex> lock(h->m);
+	bool signaled;
+
+	h->waiters++;
+	if (ms == INFINITE)
+	{
+		h->cv.wait(lock, [h] { return h->signaled; });
+		signaled = true;
+	}
+	else
+	{
+		signaled = h->cv.wait_for(lock, std::chrono::milliseconds(ms), [h] { return h->signaled; });
+	}
+	h->waiters--;
+	if (signaled && !h->manualreset) h->signaled = false;
+	return signaled;
+}
+
+// ===========================================================================
+// Threads
+// ===========================================================================
+
+HANDLE CreateThread(void *lpThreadAttributes, size_t dwStackSize, LPTHREAD_START_ROUTINE lpStartAddress, LPVOID lpParameter, DWORD dwCreationFlags, LPDWORD lpThreadId)
+{
+	HeadlessThreadHandle *h = new HeadlessThreadHandle;
+	static DWORD nextid = 1;
+
+	h->suspended = (dwCreationFlags & CREATE_SUSPENDED) != 0;
+	h->t = std::thread([h, lpStartAddress, lpParameter]
+	{
+		{
+			std::unique_lock<std::mutex> lock(h->m);
+			h->cv.wait(lock, [h] { return !h->suspended; });
+		}
+		lpStartAddress(lpParameter);
+		std::lock_guard<std::mutex> lock(h->m);
+		h->signaled = true;
+		h->cv.notify_all();
+	});
+	if (lpThreadId) *lpThreadId = nextid++;
+	return (HANDLE)(HeadlessHandle*)h;
+}
+
+DWORD ResumeThread(HANDLE hThread)
+{
+	HeadlessThreadHandle *h = dynamic_cast<HeadlessThreadHandle*>((HeadlessHandle*)hThread);
+	if (h == NULL) return (DWORD)-1;
+
+	std::lock_guard<std::mutex> lock(h->m);
+	DWORD prev = h->suspended ? 1 : 0;
+	h->suspended = false;
+	h->cv.notify_all();
+	return prev;
+}
+
+void Sleep(DWORD dwMilliseconds)
+{
+	std::this_thread::sleep_for(std::chrono::milliseconds(dwMilliseconds));
+}
+
+DWORD GetTickCount()
+{
+	return (DWORD)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// ===========================================================================
+// Events
+// ===========================================================================
+
+HANDLE CreateEvent(void *lpEventAttributes, BOOL bManualReset, BOOL bInitialState, LPCSTR lpName)
+{
+	HeadlessHandle *h = new HeadlessHandle;
+	h->manualreset = bManualReset != FALSE;
+	h->signaled = bInitialState != FALSE;
+	return (HANDLE)h;
+}
+
+BOOL SetEvent(HANDLE hEvent)
+{
+	HeadlessHandle *h = (HeadlessHandle*)hEvent;
+	std::lock_guard<std::mutex> lock(h->m);
+	h->signaled = true;
+	h->cv.notify_all();
+	return TRUE;
+}
+
+BOOL ResetEvent(HANDLE hEvent)
+{
+	HeadlessHandle *h = (HeadlessHandle*)hEvent;
+	std::lock_guard<std::mutex> lock(h->m);
+	h->signaled = false;
+	return TRUE;
+}
+
+DWORD WaitForSingleObject(HANDLE hHandle, DWORD dwMilliseconds)
+{
+	return Wait((HeadlessHandle*)hHandle, dwMilliseconds) ? WAIT_OBJECT_0 : WAIT_TIMEOUT;
+}
+
+BOOL CloseHandle(HANDLE hObject)
+{
+	HeadlessHandle *h = (HeadlessHandle*)hObject;
+	HeadlessThreadHandle *th = dynamic_cast<HeadlessThreadHandle*>(h);
+
+	if (h == NULL || hObject == INVALID_HANDLE_VALUE) return FALSE;
+	//Windows lets a thread run on when its handle is closed
+	if (th && th->t.joinable())
+	{
+		if (th->signaled) th->t.join();
+		else th->t.detach();
+	}
+	//A thread still waiting on the object keeps it, e.g. the AGC thread on its time step event when the vessel is deleted
+	{
+		std::lock_guard<std::mutex> lock(h->m);
+		if (h->waiters > 0) return TRUE;
+	}
+	if (th == NULL || th->signaled) delete h;
+	return TRUE;
+}
+
+// ===========================================================================
+// Critical sections
+// ===========================================================================
+
+void InitializeCriticalSection(LPCRITICAL_SECTION lpCriticalSection)
+{
+	lpCriticalSection->impl = new std::recursive_mutex;
+}
+
+void DeleteCriticalSection(LPCRITICAL_SECTION lpCriticalSection)
+{
+	delete (std::recursive_mutex*)lpCriticalSection->impl;
+	lpCriticalSection->impl = NULL;
+}
+
+void EnterCriticalSection(LPCRITICAL_SECTION lpCriticalSection)
+{
+	((std::recursive_mutex*)lpCriticalSection->impl)->lock();
+}
+
+void LeaveCriticalSection(LPCRITICAL_SECTION lpCriticalSection)
+{
+	((std::recursive_mutex*)lpCriticalSection->impl)->unlock();
+}
+
+// ===========================================================================
+// Modules
+// ===========================================================================
+
+HMODULE GetModuleHandle(LPCSTR lpModuleName)
+{
+	//Only the main program, the way the modules ask for Orbiter itself
+	if (lpModuleName == NULL) return dlopen(NULL, RTLD_LAZY);
+	return NULL;
+}
+
+FARPROC GetProcAddress(HMODULE hModule, LPCSTR lpProcName)
+{
+	if (hModule == NULL) return NULL;
+	return (FARPROC)dlsym(hModule, lpProcName);
+}
+
+HWND GetActiveWindow()
+{
+	return NULL;
+}
+
+SHORT GetKeyState(int nVirtKey)
+{
+	return 0;
+}
+
+// ===========================================================================
+// Memory, files and shared memory
+// ===========================================================================
+
+HLOCAL LocalAlloc(UINT uFlags, SIZE_T uBytes)
+{
+	return (uFlags & LMEM_ZEROINIT) ? calloc(1, uBytes) : malloc(uBytes);
+}
+
+HLOCAL LocalFree(HLOCAL hMem)
+{
+	free(hMem);
+	return NULL;
+}
+
+HGLOBAL GlobalAlloc(UINT uFlags, SIZE_T dwBytes)
+{
+	return (uFlags & GMEM_ZEROINIT) ? calloc(1, dwBytes) : malloc(dwBytes);
+}
+
+HGLOBAL GlobalFree(HGLOBAL hMem)
+{
+	free(hMem);
+	return NULL;
+}
+
+//Takes the place of the C library function for the whole program and its modules, backslashes are path separators
+extern "C" FILE *fopen(const char *filename, const char *mode)
+{
+	typedef FILE *(*FOPEN_FUNC)(const char *, const char *);
+	static FOPEN_FUNC next = (FOPEN_FUNC)dlsym(RTLD_NEXT, "fopen");
+	char path[MAX_PATH];
+	size_t k;
+
+	for (k = 0;filename[k] && k < MAX_PATH - 1;k++)
+	{
+		path[k] = filename[k] == '\\' ? '/' : filename[k];
+	}
+	path[k] = '\0';
+	return next(path, mode);
+}
+
+//The Win32 files are the ones of the DSKY and panel export code, none of which runs headless
+HANDLE CreateFile(LPCSTR lpFileName, DWORD dwDesiredAccess, DWORD dwShareMode, void *lpSecurityAttributes, DWORD dwCreationDisposition, DWORD dwFlagsAndAttributes, HANDLE hTemplateFile)
+{
+	return INVALID_HANDLE_VALUE;
+}
+
+BOOL WriteFile(HANDLE hFile, LPCVOID lpBuffer, DWORD nNumberOfBytesToWrite, LPDWORD lpNumberOfBytesWritten, void *lpOverlapped)
+{
+	if (lpNumberOfBytesWritten) *lpNumberOfBytesWritten = 0;
+	return FALSE;
+}
+
+//There is no other process to share memory with
+HANDLE OpenFileMapping(DWORD dwDesiredAccess, BOOL bInheritHandle, LPCSTR lpName)
+{
+	return NULL;
+}
+
+LPVOID MapViewOfFile(HANDLE hFileMappingObject, DWORD dwDesiredAccess, DWORD dwFileOffsetHigh, DWORD dwFileOffsetLow, SIZE_T dwNumberOfBytesToMap)
+{
+	return NULL;
+}
+
+BOOL UnmapViewOfFile(LPCVOID lpBaseAddress)
+{
+	return FALSE;
+}
+
+char *_strdate(char *datestr)
+{
+	time_t t = time(NULL);
+	strftime(datestr, 9, "%m/%d/%y", localtime(&t));
+	return datestr;
+}
+
+char *_strtime(char *timestr)
+{
+	time_t t = time(NULL);
+	strftime(timestr, 9, "%H:%M:%S", localtime(&t));
+	return timestr;
+}
+
+// ===========================================================================
+// GDI. Every object is the same dummy, so that the code that checks its
+// handles goes on, and nothing is drawn.
+// ===========================================================================
+
+static int GdiObject;
+
+HGDIOBJ GetStockObject(int i) { return &GdiObject; }
+HGDIOBJ SelectObject(HDC hdc, HGDIOBJ h) { return &GdiObject; }
+BOOL DeleteObject(HGDIOBJ ho) { return TRUE; }
+int GetObject(HANDLE h, int c, LPVOID pv) { if (pv) memset(pv, 0, c); return 0; }
+HPEN CreatePen(int iStyle, int cWidth, COLORREF color) { return &GdiObject; }
+HBRUSH CreateSolidBrush(COLORREF color) { return &GdiObject; }
+HFONT CreateFont(int cHeight, int cWidth, int cEscapement, int cOrientation, int cWeight, DWORD bItalic, DWORD bUnderline, DWORD bStrikeOut, DWORD iCharSet, DWORD iOutPrecision, DWORD iClipPrecision, DWORD iQuality, DWORD iPitchAndFamily, LPCSTR pszFaceName) { return &GdiObject; }
+HDC CreateCompatibleDC(HDC hdc) { return &GdiObject; }
+BOOL DeleteDC(HDC hdc) { return TRUE; }
+HBITMAP CreateCompatibleBitmap(HDC hdc, int cx, int cy) { return &GdiObject; }
+HBITMAP CreateBitmap(int nWidth, int nHeight, UINT nPlanes, UINT nBitCount, const void *lpBits) { return &GdiObject; }
+HBITMAP CreateDIBSection(HDC hdc, const BITMAPINFO *pbmi, UINT usage, void **ppvBits, HANDLE hSection, DWORD offset) { if (ppvBits) *ppvBits = NULL; return NULL; }
+int GetDIBits(HDC hdc, HBITMAP hbm, UINT start, UINT cLines, LPVOID lpvBits, LPBITMAPINFO lpbmi, UINT usage) { return 0; }
+int SetDIBits(HDC hdc, HBITMAP hbm, UINT start, UINT cLines, const void *lpBits, const BITMAPINFO *lpbmi, UINT ColorUse) { return 0; }
+//No resources to load them from
+HBITMAP LoadBitmap(HINSTANCE hInstance, LPCSTR lpBitmapName) { return NULL; }
+HANDLE LoadImage(HINSTANCE hInst, LPCSTR name, UINT type, int cx, int cy, UINT fuLoad) { return NULL; }
+BOOL GdiFlush() { return TRUE; }
+
+int SetMapMode(HDC hdc, int iMode) { return MM_TEXT; }
+int GetMapMode(HDC hdc) { return MM_TEXT; }
+BOOL DPtoLP(HDC hdc, LPPOINT lppt, int c) { return TRUE; }
+COLORREF SetTextColor(HDC hdc, COLORREF color) { return 0; }
+COLORREF SetBkColor(HDC hdc, COLORREF color) { return 0; }
+int SetBkMode(HDC hdc, int mode) { return TRANSPARENT; }
+UINT SetTextAlign(HDC hdc, UINT align) { return TA_LEFT; }
+BOOL MoveToEx(HDC hdc, int x, int y, LPPOINT lppt) { return TRUE; }
+BOOL LineTo(HDC hdc, int x, int y) { return TRUE; }
+BOOL Ellipse(HDC hdc, int left, int top, int right, int bottom) { return TRUE; }
+BOOL Rectangle(HDC hdc, int left, int top, int right, int bottom) { return TRUE; }
+BOOL Polygon(HDC hdc, const POINT *apt, int cpt) { return TRUE; }
+BOOL Polyline(HDC hdc, const POINT *apt, int cpt) { return TRUE; }
+int FillRect(HDC hDC, const RECT *lprc, HBRUSH hbr) { return 1; }
+BOOL TextOut(HDC hdc, int x, int y, LPCSTR lpString, int c) { return TRUE; }
+BOOL ExtTextOut(HDC hdc, int x, int y, UINT options, const RECT *lprect, LPCSTR lpString, UINT c, const INT *lpDx) { return TRUE; }
+BOOL BitBlt(HDC hdc, int x, int y, int cx, int cy, HDC hdcSrc, int x1, int y1, DWORD rop) { return TRUE; }
+
+// ===========================================================================
+// Multimedia file I/O. The sound files are never opened, like in an Orbiter
+// without sound.
+// ===========================================================================
+
+HMMIO mmioOpen(LPSTR pszFileName, LPMMIOINFO pmmioinfo, DWORD fdwOpen) { return NULL; }
+MMRESULT mmioClose(HMMIO hmmio, UINT fuClose) { return MMSYSERR_NOERROR; }
+LONG mmioRead(HMMIO hmmio, HPSTR pch, LONG cch) { return -1; }
+LONG mmioSeek(HMMIO hmmio, LONG lOffset, int iOrigin) { return -1; }
+MMRESULT mmioDescend(HMMIO hmmio, LPMMCKINFO pmmcki, const MMCKINFO *pmmckiParent, UINT fuDescend) { return MMSYSERR_ERROR; }
+MMRESULT mmioAscend(HMMIO hmmio, LPMMCKINFO pmmcki, UINT fuAscend) { return MMSYSERR_ERROR; }
+MMRESULT mmioCreateChunk(HMMIO hmmio, LPMMCKINFO pmmcki, UINT fuCreate) { return MMSYSERR_ERROR; }
+MMRESULT mmioGetInfo(HMMIO hmmio, LPMMIOINFO pmmioinfo, UINT fuInfo) { return MMSYSERR_ERROR; }
+MMRESULT mmioSetInfo(HMMIO hmmio, const MMIOINFO *pmmioinfo, UINT fuInfo) { return MMSYSERR_ERROR; }
+MMRESULT mmioAdvance(HMMIO hmmio, LPMMIOINFO pmmioinfo, UINT fuAdvance) { return MMSYSERR_ERROR; }
+
+// ===========================================================================
+// Sockets
+// ===========================================================================
+
+int WSAStartup(WORD wVersionRequested, LPWSADATA lpWSAData)
+{
+	if (lpWSAData)
+	{
+		lpWSAData->wVersion = wVersionRequested;
+		lpWSAData->wHighVersion = wVersionRequested;
+	}
+	return WSASYSNOTREADY;
+}
+
+int WSACleanup()
+{
+	return 0;
+}
+
+int WSAGetLastError()
+{
+	return errno;
+}
+
+int closesocket(SOCKET s)
+{
+	return close(s);
+}
+
+int ioctlsocket(SOCKET s, long cmd, u_long *argp)
+{
+	return ioctl(s, cmd, argp);
+}
+
+// ===========================================================================
+// Virtual AGC. The AGC and AEA engines unblock stdin outside of Windows for
+// the keyboard input of the standalone yaAGC, which is what the SocketAPI.c
+// of Virtual AGC does. The vessels don't read stdin, and a non-blocking stdin
+// would stay that way for the shell after the driver exits, so it is left as
+// it is, like in the Windows build.
+// ===========================================================================
+
+extern "C" void UnblockSocket(int SocketNum) {}
@@ -0,0 +1,561 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  Headless Windows API stand-in (Header)
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#pragma once
+
+//############################################################################//
+// Replacement for the parts of windows.h used by the vessel systems, the
+// Panel SDK and the RTCC, for building them without the Windows SDK. The
+// headers in src_headless/posix only stand in for system headers, so only
+// non-Windows builds put this directory in the include path, ahead of
+// src_aux; on Windows the real SDK headers are used.
+//
+// The types have the Win32 names. The threads, critical sections and events
+// of thread.h run on the C++ standard library (windows.cpp). GDI handles are
+// opaque and the drawing functions do nothing, since nothing is drawn
+// without Orbiter. windows.cpp replaces fopen, so that the backslash paths
+// of the vessel code open the files relative to the Orbiter directory like
+// on Windows. Win32 files, resources, shared memory, sound files and
+// sockets are never available, so the code that uses them takes its error
+// paths. As with the real windows.h, objbase.h comes along for the COM
+// interfaces of the DirectX headers.
+//############################################################################//
+
+#ifdef _WIN32
+#error "src_headless/posix/windows.h is a stand-in for non-Windows builds only"
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <wchar.h>
+
+typedef unsigned long DWORD;
+typedef unsigned short WORD;
+typedef unsigned char BYTE;
+typedef short SHORT;
+typedef int INT;
+typedef unsigned int UINT;
+typedef int BOOL;
+typedef long LONG;
+typedef long long LONGLONG;
+typedef unsigned long long ULONGLONG;
+typedef char CHAR;
+typedef wchar_t WCHAR;
+typedef float FLOAT;
+typedef void VOID;
+typedef unsigned long ULONG;
+//32 bits as on Windows, so that the severity bit of MAKE_HRESULT makes it negative
+typedef int32_t HRESULT;
+typedef uintptr_t WPARAM;
+typedef intptr_t LPARAM;
+typedef intptr_t LRESULT;
+typedef uintptr_t DWORD_PTR;
+typedef uintptr_t UINT_PTR;
+typedef uintptr_t ULONG_PTR;
+typedef intptr_t LONG_PTR;
+typedef size_t SIZE_T;
+typedef char *LPSTR;
+typedef const char *LPCSTR;
+typedef WCHAR *LPWSTR;
+typedef const WCHAR *LPCWSTR;
+typedef void *LPVOID;
+typedef const void *LPCVOID;
+typedef BYTE *LPBYTE;
+typedef BYTE *PBYTE;
+typedef WORD *LPWORD;
+typedef DWORD *LPDWORD;
+typedef DWORD *PDWORD;
+typedef LONG *LPLONG;
+typedef ULONG *PULONG;
+typedef DWORD COLORREF;
+typedef unsigned char boolean;
+typedef char TCHAR;
+typedef char *LPTSTR;
+typedef const char *LPCTSTR;
+
+typedef void *HANDLE;
+typedef void *HINSTANCE;
+typedef void *HMODULE;
+typedef void *HWND;
+typedef void *HDC;
+typedef void *HFONT;
+typedef void *HBRUSH;
+typedef void *HPEN;
+typedef void *HBITMAP;
+typedef void *HGDIOBJ;
+typedef void *HMENU;
+typedef void *HICON;
+typedef void *HCURSOR;
+typedef void *HLOCAL;
+typedef void *HGLOBAL;
+typedef void *HKEY;
+typedef intptr_t (*FARPROC)();
+
+#ifndef TRUE
+#define TRUE 1
+#define FALSE 0
+#endif
+
+#define WINAPI
+#define CALLBACK
+#define PASCAL
+#define APIENTRY
+#define __cdecl
+#define __stdcall
+#define FAR
+#define NEAR
+#define CONST const
+#define IN
+#define OUT
+#define OPTIONAL
+#define INFINITE 0xFFFFFFFF
+#define CREATE_SUSPENDED 0x00000004
+#define S_OK 0
+#define S_FALSE 1
+#define E_FAIL ((HRESULT)0x80004005)
+#define E_NOTIMPL ((HRESULT)0x80004001)
+#define NO_ERROR 0
+#define SUCCEEDED(hr) (((HRESULT)(hr)) >= 0)
+#define FAILED(hr) (((HRESULT)(hr)) < 0)
+#define MAKE_HRESULT(sev, fac, code) ((HRESULT)(((unsigned long)(sev) << 31) | ((unsigned long)(fac) << 16) | ((unsigned long)(code))))
+#define MAX_PATH 260
+
+#define RGB(r, g, b) ((COLORREF)(((BYTE)(r) | ((WORD)((BYTE)(g)) << 8)) | (((DWORD)(BYTE)(b)) << 16)))
+#define GetRValue(rgb) ((BYTE)(rgb))
+#define GetGValue(rgb) ((BYTE)(((WORD)(rgb)) >> 8))
+#define GetBValue(rgb) ((BYTE)((rgb) >> 16))
+#define MAKEWORD(a, b) ((WORD)(((BYTE)(((DWORD_PTR)(a)) & 0xff)) | ((WORD)((BYTE)(((DWORD_PTR)(b)) & 0xff))) << 8))
+#define LOWORD(l) ((WORD)(((DWORD_PTR)(l)) & 0xffff))
+#define HIWORD(l) ((WORD)((((DWORD_PTR)(l)) >> 16) & 0xffff))
+#define ZeroMemory(dest, len) memset((dest), 0, (len))
+#define MAKEINTRESOURCE(i) ((LPSTR)((ULONG_PTR)((WORD)(i))))
+
+typedef struct _FILETIME
+{
+	DWORD dwLowDateTime;
+	DWORD dwHighDateTime;
+} FILETIME;
+
+typedef struct tagRECT
+{
+	LONG left, top, right, bottom;
+} RECT, *LPRECT;
+
+typedef struct tagPOINT
+{
+	LONG x, y;
+} POINT, *LPPOINT;
+
+typedef struct tagSIZE
+{
+	LONG cx, cy;
+} SIZE;
+
+typedef struct tagBITMAPINFOHEADER
+{
+	DWORD biSize;
+	LONG biWidth;
+	LONG biHeight;
+	WORD biPlanes;
+	WORD biBitCount;
+	DWORD biCompression;
+	DWORD biSizeImage;
+	LONG biXPelsPerMeter;
+	LONG biYPelsPerMeter;
+	DWORD biClrUsed;
+	DWORD biClrImportant;
+} BITMAPINFOHEADER;
+
+typedef struct tagRGBQUAD
+{
+	BYTE rgbBlue;
+	BYTE rgbGreen;
+	BYTE rgbRed;
+	BYTE rgbReserved;
+} RGBQUAD;
+
+typedef struct tagBITMAPINFO
+{
+	BITMAPINFOHEADER bmiHeader;
+	RGBQUAD bmiColors[1];
+} BITMAPINFO, *PBITMAPINFO, *LPBITMAPINFO;
+
+typedef BITMAPINFOHEADER *PBITMAPINFOHEADER;
+
+#pragma pack(push, 2)
+typedef struct tagBITMAPFILEHEADER
+{
+	WORD bfType;
+	DWORD bfSize;
+	WORD bfReserved1;
+	WORD bfReserved2;
+	DWORD bfOffBits;
+} BITMAPFILEHEADER;
+#pragma pack(pop)
+
+typedef struct tagBITMAP
+{
+	LONG bmType;
+	LONG bmWidth;
+	LONG bmHeight;
+	LONG bmWidthBytes;
+	WORD bmPlanes;
+	WORD bmBitsPixel;
+	LPVOID bmBits;
+} BITMAP;
+
+//The ANSI names, as with windows.h outside of UNICODE builds. The Orbiter SDK member functions of the same
+//name are renamed along with them.
+#define GetClassName GetClassNameA
+
+// ===========================================================================
+// Modules
+// ===========================================================================
+
+#define DLL_PROCESS_DETACH 0
+#define DLL_PROCESS_ATTACH 1
+#define DLL_THREAD_ATTACH 2
+#define DLL_THREAD_DETACH 3
+
+//C linkage, so that the loader in HeadlessSim finds the DllMain of a module by name and calls it like Windows does
+extern "C" BOOL WINAPI DllMain(HINSTANCE hModule, DWORD ul_reason_for_call, LPVOID lpReserved);
+
+HMODULE GetModuleHandle(LPCSTR lpModuleName);
+FARPROC GetProcAddress(HMODULE hModule, LPCSTR lpProcName);
+HWND GetActiveWindow();
+
+// ===========================================================================
+// Keyboard, never pressed
+// ===========================================================================
+
+#define VK_SHIFT 0x10
+#define VK_CONTROL 0x11
+#define VK_MENU 0x12
+
+SHORT GetKeyState(int nVirtKey);
+
+// ===========================================================================
+// Memory, files and shared memory
+// ===========================================================================
+
+#define LMEM_FIXED 0x0000
+#define LMEM_ZEROINIT 0x0040
+#define LPTR (LMEM_FIXED | LMEM_ZEROINIT)
+
+#define INVALID_HANDLE_VALUE ((HANDLE)(LONG_PTR)-1)
+#define GENERIC_READ 0x80000000
+#define GENERIC_WRITE 0x40000000
+#define CREATE_NEW 1
+#define CREATE_ALWAYS 2
+#define OPEN_EXISTING 3
+#define FILE_ATTRIBUTE_NORMAL 0x00000080
+#define FILE_MAP_WRITE 0x0002
+#define FILE_MAP_READ 0x0004
+
+#define GMEM_FIXED 0x0000
+#define GMEM_ZEROINIT 0x0040
+#define GPTR (GMEM_FIXED | GMEM_ZEROINIT)
+
+HLOCAL LocalAlloc(UINT uFlags, SIZE_T uBytes);
+HLOCAL LocalFree(HLOCAL hMem);
+HGLOBAL GlobalAlloc(UINT uFlags, SIZE_T dwBytes);
+HGLOBAL GlobalFree(HGLOBAL hMem);
+
+HANDLE CreateFile(LPCSTR lpFileName, DWORD dwDesiredAccess, DWORD dwShareMode, void *lpSecurityAttributes, DWORD dwCreationDisposition, DWORD dwFlagsAndAttributes, HANDLE hTemplateFile);
+BOOL WriteFile(HANDLE hFile, LPCVOID lpBuffer, DWORD nNumberOfBytesToWrite, LPDWORD lpNumberOfBytesWritten, void *lpOverlapped);
+HANDLE OpenFileMapping(DWORD dwDesiredAccess, BOOL bInheritHandle, LPCSTR lpName);
+LPVOID MapViewOfFile(HANDLE hFileMappingObject, DWORD dwDesiredAccess, DWORD dwFileOffsetHigh, DWORD dwFileOffsetLow, SIZE_T dwNumberOfBytesToMap);
+BOOL UnmapViewOfFile(LPCVOID lpBaseAddress);
+
+char *_strdate(char *datestr);
+char *_strtime(char *timestr);
+
+// ===========================================================================
+// GDI
+// ===========================================================================
+
+#define WHITE_BRUSH 0
+#define LTGRAY_BRUSH 1
+#define GRAY_BRUSH 2
+#define DKGRAY_BRUSH 3
+#define BLACK_BRUSH 4
+#define NULL_BRUSH 5
+#define WHITE_PEN 6
+#define BLACK_PEN 7
+#define NULL_PEN 8
+#define DEFAULT_GUI_FONT 17
+
+#define PS_SOLID 0
+#define PS_DASH 1
+#define PS_DOT 2
+#define PS_NULL 5
+
+#define TRANSPARENT 1
+#define OPAQUE 2
+
+#define TA_LEFT 0
+#define TA_RIGHT 2
+#define TA_CENTER 6
+#define TA_TOP 0
+#define TA_BOTTOM 8
+#define TA_BASELINE 24
+
+#define ETO_OPAQUE 0x0002
+#define ETO_CLIPPED 0x0004
+
+#define SRCCOPY 0x00CC0020
+#define SRCPAINT 0x00EE0086
+#define SRCAND 0x008800C6
+#define SRCINVERT 0x00660046
+#define NOTSRCCOPY 0x00330008
+
+#define FW_DONTCARE 0
+#define FW_THIN 100
+#define FW_LIGHT 300
+#define FW_NORMAL 400
+#define FW_MEDIUM 500
+#define FW_SEMIBOLD 600
+#define FW_BOLD 700
+#define FW_HEAVY 900
+
+#define ANSI_CHARSET 0
+#define DEFAULT_CHARSET 1
+#define OUT_DEFAULT_PRECIS 0
+#define OUT_TT_PRECIS 4
+#define OUT_RASTER_PRECIS 6
+#define CLIP_DEFAULT_PRECIS 0
+#define DEFAULT_QUALITY 0
+#define DRAFT_QUALITY 1
+#define PROOF_QUALITY 2
+#define NONANTIALIASED_QUALITY 3
+#define ANTIALIASED_QUALITY 4
+#define DEFAULT_PITCH 0
+#define FIXED_PITCH 1
+#define VARIABLE_PITCH 2
+#define FF_DONTCARE 0x00
+#define FF_ROMAN 0x10
+#define FF_SWISS 0x20
+#define FF_MODERN 0x30
+
+#define BI_RGB 0
+#define DIB_RGB_COLORS 0
+#define MM_TEXT 1
+#define IMAGE_BITMAP 0
+#define LR_DEFAULTCOLOR 0x0000
+#define LR_LOADFROMFILE 0x0010
+#define LR_CREATEDIBSECTION 0x2000
+
+HGDIOBJ GetStockObject(int i);
+HGDIOBJ SelectObject(HDC hdc, HGDIOBJ h);
+BOOL DeleteObject(HGDIOBJ ho);
+int GetObject(HANDLE h, int c, LPVOID pv);
+HPEN CreatePen(int iStyle, int cWidth, COLORREF color);
+HBRUSH CreateSolidBrush(COLORREF color);
+HFONT CreateFont(int cHeight, int cWidth, int cEscapement, int cOrientation, int cWeight, DWORD bItalic, DWORD bUnderline, DWORD bStrikeOut, DWORD iCharSet, DWORD iOutPrecision, DWORD iClipPrecision, DWORD iQuality, DWORD iPitchAndFamily, LPCSTR pszFaceName);
+HDC CreateCompatibleDC(HDC hdc);
+BOOL DeleteDC(HDC hdc);
+HBITMAP CreateCompatibleBitmap(HDC hdc, int cx, int cy);
+HBITMAP CreateBitmap(int nWidth, int nHeight, UINT nPlanes, UINT nBitCount, const void *lpBits);
+HBITMAP CreateDIBSection(HDC hdc, const BITMAPINFO *pbmi, UINT usage, void **ppvBits, HANDLE hSection, DWORD offset);
+int GetDIBits(HDC hdc, HBITMAP hbm, UINT start, UINT cLines, LPVOID lpvBits, LPBITMAPINFO lpbmi, UINT usage);
+int SetDIBits(HDC hdc, HBITMAP hbm, UINT start, UINT cLines, const void *lpBits, const BITMAPINFO *lpbmi, UINT ColorUse);
+HBITMAP LoadBitmap(HINSTANCE hInstance, LPCSTR lpBitmapName);
+HANDLE LoadImage(HINSTANCE hInst, LPCSTR name, UINT type, int cx, int cy, UINT fuLoad);
+BOOL GdiFlush();
+
+int SetMapMode(HDC hdc, int iMode);
+int GetMapMode(HDC hdc);
+BOOL DPtoLP(HDC hdc, LPPOINT lppt, int c);
+COLORREF SetTextColor(HDC hdc, COLORREF color);
+COLORREF SetBkColor(HDC hdc, COLORREF color);
+int SetBkMode(HDC hdc, int mode);
+UINT SetTextAlign(HDC hdc, UINT align);
+BOOL MoveToEx(HDC hdc, int x, int y, LPPOINT lppt);
+BOOL LineTo(HDC hdc, int x, int y);
+BOOL Ellipse(HDC hdc, int left, int top, int right, int bottom);
+BOOL Rectangle(HDC hdc, int left, int top, int right, int bottom);
+BOOL Polygon(HDC hdc, const POINT *apt, int cpt);
+BOOL Polyline(HDC hdc, const POINT *apt, int cpt);
+int FillRect(HDC hDC, const RECT *lprc, HBRUSH hbr);
+BOOL TextOut(HDC hdc, int x, int y, LPCSTR lpString, int c);
+BOOL ExtTextOut(HDC hdc, int x, int y, UINT options, const RECT *lprect, LPCSTR lpString, UINT c, const INT *lpDx);
+BOOL BitBlt(HDC hdc, int x, int y, int cx, int cy, HDC hdcSrc, int x1, int y1, DWORD rop);
+
+// ===========================================================================
+// Multimedia file I/O and wave formats
+// ===========================================================================
+
+typedef UINT MMRESULT;
+typedef DWORD FOURCC;
+typedef char *HPSTR;
+typedef void *HMMIO;
+
+#define mmioFOURCC(ch0, ch1, ch2, ch3) ((FOURCC)(BYTE)(ch0) | ((FOURCC)(BYTE)(ch1) << 8) | ((FOURCC)(BYTE)(ch2) << 16) | ((FOURCC)(BYTE)(ch3) << 24))
+#define FOURCC_RIFF mmioFOURCC('R', 'I', 'F', 'F')
+#define FOURCC_LIST mmioFOURCC('L', 'I', 'S', 'T')
+
+#define MMSYSERR_NOERROR 0
+#define MMSYSERR_ERROR 1
+#define MMIO_READ 0x00000000
+#define MMIO_WRITE 0x00000001
+#define MMIO_READWRITE 0x00000002
+#define MMIO_ALLOCBUF 0x00010000
+#define MMIO_DIRTY 0x10000000
+#define MMIO_FINDCHUNK 0x0010
+#define MMIO_FINDRIFF 0x0020
+#define MMIO_FINDLIST 0x0040
+#define MMIO_CREATERIFF 0x0020
+#define MMIO_CREATELIST 0x0040
+
+typedef struct _MMIOINFO
+{
+	DWORD dwFlags;
+	FOURCC fccIOProc;
+	void *pIOProc;
+	UINT wErrorRet;
+	HANDLE htask;
+	LONG cchBuffer;
+	HPSTR pchBuffer;
+	HPSTR pchNext;
+	HPSTR pchEndRead;
+	HPSTR pchEndWrite;
+	LONG lBufOffset;
+	LONG lDiskOffset;
+	DWORD adwInfo[3];
+	DWORD dwReserved1;
+	DWORD dwReserved2;
+	HMMIO hmmio;
+} MMIOINFO, *LPMMIOINFO;
+
+typedef struct _MMCKINFO
+{
+	FOURCC ckid;
+	DWORD cksize;
+	FOURCC fccType;
+	DWORD dwDataOffset;
+	DWORD dwFlags;
+} MMCKINFO, *LPMMCKINFO;
+
+HMMIO mmioOpen(LPSTR pszFileName, LPMMIOINFO pmmioinfo, DWORD fdwOpen);
+MMRESULT mmioClose(HMMIO hmmio, UINT fuClose);
+LONG mmioRead(HMMIO hmmio, HPSTR pch, LONG cch);
+LONG mmioSeek(HMMIO hmmio, LONG lOffset, int iOrigin);
+MMRESULT mmioDescend(HMMIO hmmio, LPMMCKINFO pmmcki, const MMCKINFO *pmmckiParent, UINT fuDescend);
+MMRESULT mmioAscend(HMMIO hmmio, LPMMCKINFO pmmcki, UINT fuAscend);
+MMRESULT mmioCreateChunk(HMMIO hmmio, LPMMCKINFO pmmcki, UINT fuCreate);
+MMRESULT mmioGetInfo(HMMIO hmmio, LPMMIOINFO pmmioinfo, UINT fuInfo);
+MMRESULT mmioSetInfo(HMMIO hmmio, const MMIOINFO *pmmioinfo, UINT fuInfo);
+MMRESULT mmioAdvance(HMMIO hmmio, LPMMIOINFO pmmioinfo, UINT fuAdvance);
+
+#define WAVE_FORMAT_PCM 1
+
+typedef struct waveformat_tag
+{
+	WORD wFormatTag;
+	WORD nChannels;
+	DWORD nSamplesPerSec;
+	DWORD nAvgBytesPerSec;
+	WORD nBlockAlign;
+} WAVEFORMAT;
+
+typedef struct pcmwaveformat_tag
+{
+	WAVEFORMAT wf;
+	WORD wBitsPerSample;
+} PCMWAVEFORMAT;
+
+typedef struct tWAVEFORMATEX
+{
+	WORD wFormatTag;
+	WORD nChannels;
+	DWORD nSamplesPerSec;
+	DWORD nAvgBytesPerSec;
+	WORD nBlockAlign;
+	WORD wBitsPerSample;
+	WORD cbSize;
+} WAVEFORMATEX, *LPWAVEFORMATEX;
+
+// ===========================================================================
+// Threads, critical sections and events
+// ===========================================================================
+
+typedef DWORD (WINAPI *LPTHREAD_START_ROUTINE)(LPVOID lpThreadParameter);
+
+struct CRITICAL_SECTION
+{
+	void *impl;
+};
+typedef CRITICAL_SECTION *LPCRITICAL_SECTION;
+
+HANDLE CreateThread(void *lpThreadAttributes, size_t dwStackSize, LPTHREAD_START_ROUTINE lpStartAddress, LPVOID lpParameter, DWORD dwCreationFlags, LPDWORD lpThreadId);
+DWORD ResumeThread(HANDLE hThread);
+HANDLE CreateEvent(void *lpEventAttributes, BOOL bManualReset, BOOL bInitialState, LPCSTR lpName);
+BOOL SetEvent(HANDLE hEvent);
+BOOL ResetEvent(HANDLE hEvent);
+DWORD WaitForSingleObject(HANDLE hHandle, DWORD dwMilliseconds);
+BOOL CloseHandle(HANDLE hObject);
+void Sleep(DWORD dwMilliseconds);
+DWORD GetTickCount();
+
+void InitializeCriticalSection(LPCRITICAL_SECTION lpCriticalSection);
+void DeleteCriticalSection(LPCRITICAL_SECTION lpCriticalSection);
+void EnterCriticalSection(LPCRITICAL_SECTION lpCriticalSection);
+void LeaveCriticalSection(LPCRITICAL_SECTION lpCriticalSection);
+
+#define WAIT_OBJECT_0 0
+#define WAIT_TIMEOUT 258
+
+// ===========================================================================
+// Sockets. The BSD socket calls are the same, but WSAStartup fails: the
+// telemetry servers stay off, so that several headless runs don't compete
+// for their ports.
+// ===========================================================================
+
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <sys/socket.h>
+#include <sys/ioctl.h>
+
+typedef int SOCKET;
+typedef struct sockaddr SOCKADDR;
+typedef struct sockaddr_in SOCKADDR_IN;
+
+typedef struct WSAData
+{
+	WORD wVersion;
+	WORD wHighVersion;
+} WSADATA, *LPWSADATA;
+
+#define INVALID_SOCKET (-1)
+#define SOCKET_ERROR (-1)
+#define WSASYSNOTREADY 10091
+
+int WSAStartup(WORD wVersionRequested, LPWSADATA lpWSAData);
+int WSACleanup();
+int WSAGetLastError();
+int closesocket(SOCKET s);
+int ioctlsocket(SOCKET s, long cmd, u_long *argp);
+
+#include "objbase.h"
@@ -0,0 +1,112 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  FDAI ball renderer benchmark
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+//############################################################################//
+// Renders the FDAI ball at a sequence of attitudes, reports the time per
+// frame and writes some of the frames as PPM images for comparison:
+//
+//   fdai_bench <ball texture> <frames> [<output prefix>]
+//
+// Built on Linux for example with
+//
+//   g++ -O2 -Isrc_sys src_headless/tools/FDAIBallBench.cpp src_sys/FDAIBall.cpp -o fdai_bench
+//
+// Add -DFDAIBALL_NO_SIMD for the scalar reference renderer.
+//############################################################################//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include "FDAIBall.h"
+
+static bool WritePPM(const char *filename, const unsigned *pixels, int size)
+{
+	FILE *file = fopen(filename, "wb");
+	int i;
+
+	if (file == NULL) return false;
+	fprintf(file, "P6\n%d %d\n255\n", size, size);
+	for (i = 0;i < size * size;i++)
+	{
+		fputc((pixels[i] >> 16) & 0xFF, file);
+		fputc((pixels[i] >> 8) & 0xFF, file);
+		fputc(pixels[i] & 0xFF, file);
+	}
+	fclose(file);
+	return true;
+}
+
+int main(int argc, char *argv[])
+{
+	const int size = 180;
+	const int images = 8;
+	char filename[256];
+	int frames, i;
+
+	if (argc < 3)
+	{
+		fprintf(stderr, "Usage: %s <ball texture> <frames> [<output prefix>]\n", argv[0]);
+		return 1;
+	}
+	frames = atoi(argv[2]);
+
+	FDAIBall ball;
+	ball.Init(size);
+	if (!ball.LoadTexture(argv[1]))
+	{
+		fprintf(stderr, "Could not load texture %s\n", argv[1]);
+		return 1;
+	}
+
+	unsigned *pixels = new unsigned[size * size];
+	memset(pixels, 0, size * size * sizeof(unsigned));
+
+	//Attitudes sweep all three axes at different rates
+	auto start = std::chrono::steady_clock::now();
+	for (i = 0;i < frames;i++)
+	{
+		ball.Render(0.013*i, 0.007*i, 0.021*i, pixels, size);
+	}
+	auto end = std::chrono::steady_clock::now();
+	double t = std::chrono::duration<double>(end - start).count();
+	printf("%d frames, %.3f ms per frame\n", frames, frames > 0 ? t / frames * 1000.0 : 0.0);
+
+	if (argc > 3)
+	{
+		for (i = 0;i < images;i++)
+		{
+			memset(pixels, 0, size * size * sizeof(unsigned));
+			ball.Render(0.8*i, 0.35*i, 1.1*i, pixels, size);
+			sprintf(filename, "%s%d.ppm", argv[3], i);
+			if (!WritePPM(filename, pixels, size))
+			{
+				fprintf(stderr, "Could not write %s\n", filename);
+				break;
+			}
+		}
+	}
+
+	delete[] pixels;
+	return 0;
+}
@@ -0,0 +1,417 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  Generalized iterator linear algebra benchmark
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+//############################################################################//
+// Compares the fixed capacity linear algebra of the generalized iterator and
+// OrbMech::SolveSeries with the heap allocated code they replaced and times
+// both:
+//
+//   geniter_bench [<scale>]
+//
+// One step of the iterator is the weighted normal matrix P^T W_Y P and the
+// right hand side, the coefficient matrix with lambda*W_X on the diagonal
+// and the solution of the linear system. The old step allocated its work
+// arrays with new on every call and solved with OrbMech::LUPDecompose, it is
+// kept below as the baseline. Random partials of several sizes up to
+// MGENITER x NGENITER go through both steps, as do random least squares
+// polynomial fits through SolveSeries and the old SolveSystem path. The
+// largest differences of the solutions are reported. Last the whole
+// GenIterator::GeneralizedIterator is timed on a small nonlinear system.
+// <scale> multiplies the number of repetitions (default 1). Built on Linux
+// for example with
+//
+//   g++ -O2 -Isrc_headless -Isrc_sys -Isrc_rtccmfd -include strings.h
+//       src_headless/tools/GenIteratorBench.cpp src_rtccmfd/OrbMech.cpp
+//       src_rtccmfd/GeneralizedIterator.cpp src_headless/OrbiterAPI.cpp
+//       src_headless/VesselAPI.cpp src_headless/HeadlessSim.cpp
+//       -o geniter_bench
+//############################################################################//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <vector>
+#include "Orbitersdk.h"
+#include "OrbMech.h"
+#include "GeneralizedIterator.h"
+
+//The iterator step and the polynomial fit before the fixed capacity matrices. The work arrays that leaked are freed here
+namespace Baseline
+{
+	void tmat_mul_mat(double **A, double **B, int m, int n, int p, double **C)
+	{
+		int i, j, k;
+
+		for (i = 0;i < m;i++)
+		{
+			for (j = 0;j < p;j++)
+			{
+				C[i][j] = 0.0;
+				for (k = 0;k < n;k++)
+				{
+					C[i][j] += A[k][i] * B[k][j];
+				}
+			}
+		}
+	}
+
+	void diag_mul_mat(const std::vector<double> &a, double **B, int m, int n, double **C)
+	{
+		int i, j;
+
+		for (i = 0;i < m;i++)
+		{
+			for (j = 0;j < n;j++)
+			{
+				C[i][j] = a[i] * B[i][j];
+			}
+		}
+	}
+
+	void tmat_mul_vec(double **A, double *b, int m, int n, double *c)
+	{
+		for (int i = 0;i < m;i++)
+		{
+			c[i] = 0.0;
+			for (int j = 0;j < n;j++)
+			{
+				c[i] += A[j][i] * b[j];
+			}
+		}
+	}
+
+	void MatrixMultiply(double **P, const std::vector<double> &W_Y, const std::vector<double> &dy, int m, int n, double **C, double *c)
+	{
+		double *b = new double[n];
+		double **B = new double*[n];
+		int i;
+
+		for (i = 0;i < n;i++)
+		{
+			B[i] = new double[m];
+			b[i] = W_Y[i] * dy[i];
+		}
+		tmat_mul_vec(P, b, m, n, c);
+		diag_mul_mat(W_Y, P, n, m, B);
+		tmat_mul_mat(P, B, m, n, m, C);
+
+		for (i = 0;i < n;i++)
+		{
+			delete[] B[i];
+		}
+		delete[] b;
+		delete[] B;
+	}
+
+	void ComputeCoefficients(double **CARR, const std::vector<double> &W_X, double lambda, int m, double **D)
+	{
+		double *A = new double[m];
+		int i, j;
+
+		for (i = 0;i < m;i++)
+		{
+			A[i] = W_X[i] * lambda;
+		}
+		for (i = 0;i < m;i++)
+		{
+			for (j = 0;j < m;j++)
+			{
+				D[i][j] = CARR[i][j];
+				if (i == j)
+				{
+					D[i][j] += A[i];
+				}
+			}
+		}
+		delete[] A;
+	}
+
+	bool SolveEquations(double **D, double *c, int m, std::vector<double> &dx)
+	{
+		int *PP = new int[m + 1];
+
+		if (OrbMech::LUPDecompose(D, m, 0.0, PP) == 0)
+		{
+			delete[] PP;
+			return true;
+		}
+		OrbMech::LUPSolve(D, PP, c, m, dx);
+		delete[] PP;
+		return false;
+	}
+
+	bool SolveSeries(double *x, double *y, int ndata, double *out, int m)
+	{
+		double *v = new double[m];
+		double *q = new double[m];
+		double *M = new double[m*m];
+
+		memset(M, 0, m*m * sizeof(double));
+		memset(q, 0, m * sizeof(double));
+
+		for (int i = 0;i<ndata;i++) {
+			v[0] = 1.0;
+			for (int f = 1;f<m;f++) v[f] = v[f - 1] * x[i];
+			for (int f = 0;f<m;f++) for (int g = 0;g<m;g++) M[f*m + g] += (v[f] * v[g]);
+			for (int f = 0;f<m;f++) q[f] += (v[f] * y[i]);
+		}
+
+		bool bRet = OrbMech::SolveSystem(m, M, q, out, NULL);
+		delete[]v; delete[]q; delete[]M;
+		return bRet;
+	}
+}
+
+static double Random(double range)
+{
+	return ((double)rand() / RAND_MAX * 2.0 - 1.0) * range;
+}
+
+static double MaxRelDiff(const std::vector<double> &a, const std::vector<double> &b)
+{
+	double d, scale = 0.0, dmax = 0.0;
+	unsigned i;
+
+	for (i = 0;i < a.size();i++)
+	{
+		if (fabs(a[i]) > scale) scale = fabs(a[i]);
+	}
+	for (i = 0;i < a.size();i++)
+	{
+		d = fabs(a[i] - b[i]);
+		if (d > dmax) dmax = d;
+	}
+	return scale > 0.0 ? dmax / scale : dmax;
+}
+
+//One iterator step with N dependent and M independent variables
+static void IteratorStep(int N, int M, int reps)
+{
+	std::vector<double> W_Y(N), W_X(M), dy(N), dx_old(M), dx_new(M);
+	GenIterator::GeneralizedIteratorWorkspace ws;
+	double **P, **CARR, **DARR, *CVEC, lambda = 1e-3, sink = 0.0;
+	int i, j, r;
+
+	P = new double*[N];
+	for (i = 0;i < N;i++)
+	{
+		P[i] = new double[M];
+	}
+	CARR = new double*[M];
+	DARR = new double*[M];
+	CVEC = new double[M];
+	for (i = 0;i < M;i++)
+	{
+		CARR[i] = new double[M];
+		DARR[i] = new double[M];
+	}
+
+	ws.P.Resize(N, M);
+	for (i = 0;i < N;i++)
+	{
+		W_Y[i] = 0.5 + fabs(Random(1.0));
+		dy[i] = Random(1.0);
+		for (j = 0;j < M;j++)
+		{
+			P[i][j] = ws.P(i, j) = Random(1.0);
+		}
+	}
+	for (j = 0;j < M;j++)
+	{
+		W_X[j] = 0.5 + fabs(Random(1.0));
+	}
+
+	//Accuracy
+	Baseline::MatrixMultiply(P, W_Y, dy, M, N, CARR, CVEC);
+	Baseline::ComputeCoefficients(CARR, W_X, lambda, M, DARR);
+	bool err_old = Baseline::SolveEquations(DARR, CVEC, M, dx_old);
+	GenIterator::MatrixMultiply(ws, W_Y, dy);
+	GenIterator::ComputeCoefficients(ws, W_X, lambda);
+	bool err_new = GenIterator::SolveEquations(ws, dx_new);
+
+	//Throughput
+	auto t0 = std::chrono::steady_clock::now();
+	for (r = 0;r < reps;r++)
+	{
+		Baseline::MatrixMultiply(P, W_Y, dy, M, N, CARR, CVEC);
+		Baseline::ComputeCoefficients(CARR, W_X, lambda, M, DARR);
+		Baseline::SolveEquations(DARR, CVEC, M, dx_old);
+		sink += dx_old[0];
+	}
+	auto t1 = std::chrono::steady_clock::now();
+	for (r = 0;r < reps;r++)
+	{
+		GenIterator::MatrixMultiply(ws, W_Y, dy);
+		GenIterator::ComputeCoefficients(ws, W_X, lambda);
+		GenIterator::SolveEquations(ws, dx_new);
+		sink += dx_new[0];
+	}
+	auto t2 = std::chrono::steady_clock::now();
+
+	double to = std::chrono::duration<double>(t1 - t0).count() / reps;
+	double tn = std::chrono::duration<double>(t2 - t1).count() / reps;
+	printf("%3d x %-3d %10.1f %10.1f %8.2fx  %.2e%s\n", N, M, to*1e9, tn*1e9, to / tn, MaxRelDiff(dx_old, dx_new),
+		err_old || err_new ? "  singular" : (sink == 0.12345 ? " " : ""));
+
+	for (i = 0;i < N;i++)
+	{
+		delete[] P[i];
+	}
+	for (i = 0;i < M;i++)
+	{
+		delete[] CARR[i];
+		delete[] DARR[i];
+	}
+	delete[] P;
+	delete[] CARR;
+	delete[] DARR;
+	delete[] CVEC;
+}
+
+//Least squares fit of a polynomial with m coefficients to ndata points
+static void Series(int ndata, int m, int reps)
+{
+	std::vector<double> x(ndata), y(ndata), c_old(m), c_new(m);
+	double sink = 0.0;
+	int i, r;
+
+	for (i = 0;i < ndata;i++)
+	{
+		x[i] = (double)i / (double)(ndata - 1) + Random(0.001);
+		y[i] = 1.0 + x[i] - 0.5*x[i] * x[i] + Random(0.01);
+	}
+
+	bool ok_old = Baseline::SolveSeries(x.data(), y.data(), ndata, c_old.data(), m);
+	bool ok_new = OrbMech::SolveSeries(x.data(), y.data(), ndata, c_new.data(), m);
+
+	auto t0 = std::chrono::steady_clock::now();
+	for (r = 0;r < reps;r++)
+	{
+		Baseline::SolveSeries(x.data(), y.data(), ndata, c_old.data(), m);
+		sink += c_old[0];
+	}
+	auto t1 = std::chrono::steady_clock::now();
+	for (r = 0;r < reps;r++)
+	{
+		OrbMech::SolveSeries(x.data(), y.data(), ndata, c_new.data(), m);
+		sink += c_new[0];
+	}
+	auto t2 = std::chrono::steady_clock::now();
+
+	double to = std::chrono::duration<double>(t1 - t0).count() / reps;
+	double tn = std::chrono::duration<double>(t2 - t1).count() / reps;
+	printf("%3d pts %2d %10.1f %10.1f %8.2fx  %.2e%s\n", ndata, m, to*1e9, tn*1e9, to / tn, MaxRelDiff(c_old, c_new),
+		!ok_old || !ok_new ? "  failed" : (sink == 0.12345 ? " " : ""));
+}
+
+struct TestSystem
+{
+	int M;
+	int calls;
+};
+
+//y_i = x_i + 0.2 sin(x_i+1), coupled enough to need a few iterations
+static bool TestEvaluation(void *data, std::vector<double> &x, void *constants, std::vector<double> &y, bool select)
+{
+	TestSystem *sys = (TestSystem*)data;
+	int i;
+
+	sys->calls++;
+	for (i = 0;i < sys->M;i++)
+	{
+		y[i] = x[i] + 0.2*sin(x[(i + 1) % sys->M]);
+	}
+	return false;
+}
+
+static void Iterator(int M, int reps)
+{
+	GenIterator::GeneralizedIteratorBlock block;
+	std::vector<double> x_res, y_res;
+	TestSystem sys;
+	double target, res = 0.0;
+	bool err = false;
+	int i, r;
+
+	sys.M = M;
+	for (i = 0;i < M;i++)
+	{
+		target = 0.5 + 0.1*i;
+		block.IndVarSwitch[i] = true;
+		block.IndVarGuess[i] = 0.0;
+		block.IndVarStep[i] = 1e-6;
+		block.IndVarWeight[i] = 1.0;
+		block.DepVarSwitch[i] = true;
+		block.DepVarLowerLimit[i] = target - 1e-6;
+		block.DepVarUpperLimit[i] = target + 1e-6;
+		block.DepVarClass[i] = 1;
+		block.DepVarWeight[i] = 1.0;
+	}
+
+	sys.calls = 0;
+	auto t0 = std::chrono::steady_clock::now();
+	for (r = 0;r < reps;r++)
+	{
+		err |= GenIterator::GeneralizedIterator(TestEvaluation, block, NULL, &sys, x_res, y_res);
+	}
+	auto t1 = std::chrono::steady_clock::now();
+
+	for (i = 0;i < M;i++)
+	{
+		if (fabs(y_res[i] - (0.5 + 0.1*i)) > res) res = fabs(y_res[i] - (0.5 + 0.1*i));
+	}
+	printf("%3d x %-3d %10.1f %8d  %.2e%s\n", M, M, std::chrono::duration<double>(t1 - t0).count() / reps * 1e6, sys.calls / reps, res, err ? "  failed" : "");
+}
+
+int main(int argc, char *argv[])
+{
+	double scale = 1.0;
+	int i;
+
+	if (argc > 1) scale = atof(argv[1]);
+	if (scale <= 0.0) scale = 1.0;
+
+	const int steps[][2] = { { 3, 3 }, { 6, 4 }, { 8, 8 }, { 12, 8 }, { 20, 20 }, { GenIterator::NGENITER, GenIterator::MGENITER } };
+	printf("Iterator step  old (ns)   new (ns)  speedup  largest relative difference\n");
+	for (i = 0;i < 6;i++)
+	{
+		//About the same amount of arithmetic for every size
+		int reps = (int)(scale * 2e7 / (steps[i][0] * steps[i][1] * steps[i][1] + 100));
+		IteratorStep(steps[i][0], steps[i][1], reps > 10 ? reps : 10);
+	}
+
+	const int series[][2] = { { 20, 3 }, { 50, 4 }, { 100, 8 } };
+	printf("\nSolveSeries    old (ns)   new (ns)  speedup  largest relative difference\n");
+	for (i = 0;i < 3;i++)
+	{
+		int reps = (int)(scale * 2e7 / (series[i][0] * series[i][1] * series[i][1] + 100));
+		Series(series[i][0], series[i][1], reps > 10 ? reps : 10);
+	}
+
+	printf("\nGeneralizedIterator  us/call  evals/call  largest residual\n");
+	Iterator(3, (int)(scale * 20000));
+	Iterator(8, (int)(scale * 2000));
+	return 0;
+}
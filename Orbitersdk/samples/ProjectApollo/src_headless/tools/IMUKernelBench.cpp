@@ -0,0 +1,390 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  IMU attitude kernel benchmark
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+//############################################################################//
+// Compares the quaternion gimbal calculation of imukernel.cpp with the Euler
+// angle matrices of imumath.cpp, which are copied here unchanged, and times
+// both:
+//
+//   imu_bench <attitudes> [<body rate in deg/s>]
+//
+// The first test feeds random attitudes and stable member orientations
+// through both and reports the largest CDU count difference. The second
+// times whole IMU frames at frame lengths from 20 ms to 2 s, with the
+// vessel turning at a constant body rate of up to the given rate (default
+// 10 deg/s): the Euler angle matrices with one step per frame, the first
+// quaternion kernel with Euler angles and a sub-step every 20 ms, and the
+// current one, which takes the attitude from the rotation matrix and only
+// splits frames in which the vessel turns by more than IMU_SUBSTEP_ANGLE.
+// For each it reports the largest CDU error at the keyframes and halfway
+// between them, where the AGC interpolates the counts linearly, leaving out
+// frames beyond the 70 degree middle gimbal warning. Built on Linux for
+// example with
+//
+//   g++ -O2 -Isrc_headless -Isrc_sys src_headless/tools/IMUKernelBench.cpp
+//       src_sys/imukernel.cpp -o imu_bench
+//############################################################################//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <chrono>
+#include "Orbitersdk.h"
+#include "imukernel.h"
+
+static const double TWO_PI = PI * 2.0;
+
+//
+// imumath.cpp
+//
+
+static MATRIX3 getRotationMatrixX(double angle)
+{
+	return _M(1, 0, 0, 0, cos(angle), -sin(angle), 0, sin(angle), cos(angle));
+}
+
+static MATRIX3 getRotationMatrixY(double angle)
+{
+	return _M(cos(angle), 0, sin(angle), 0, 1, 0, -sin(angle), 0, cos(angle));
+}
+
+static MATRIX3 getRotationMatrixZ(double angle)
+{
+	return _M(cos(angle), -sin(angle), 0, sin(angle), cos(angle), 0, 0, 0, 1);
+}
+
+static VECTOR3 getRotationAnglesXZY(MATRIX3 m)
+{
+	VECTOR3 v;
+
+	v.z = asin(-m.m12);
+
+	if (m.m11 * cos(v.z) > 0) {
+		v.y = atan(m.m13 / m.m11);
+	} else {
+		v.y = atan(m.m13 / m.m11) + PI;
+	}
+
+	if (m.m22 * cos(v.z) > 0) {
+		v.x = atan(m.m32 / m.m22);
+	} else {
+		v.x = atan(m.m32 / m.m22) + PI;
+	}
+	return v;
+}
+
+//CSM navigation base
+static MATRIX3 getOrbiterLocalToNavigationBaseTransformation()
+{
+	return _M(0, 0, 1, 1, 0, 0, 0, -1, 0);
+}
+
+static int radToGyroPulses(double angle)
+{
+	return (int)((angle * 2097152.0) / TWO_PI);
+}
+
+static int CDUCount(double angle)
+{
+	angle = fmod(angle, TWO_PI);
+	if (angle < 0) angle += TWO_PI;
+	if (angle >= TWO_PI) angle -= TWO_PI;
+	return ((int)(((double)radToGyroPulses(angle)) / 64.0)) & 077777;
+}
+
+static int CDUDiff(int a, int b)
+{
+	int d = ((b - a + 040000) & 077777) - 040000;
+	return d < 0 ? -d : d;
+}
+
+//Gimbal angles as in IMU::Timestep before the quaternion kernel
+static void MatrixGimbals(const VECTOR3 &arot, const MATRIX3 &ref, int cdu[3])
+{
+	MATRIX3 t = ref;
+	t = mul(getRotationMatrixX(arot.x), t);
+	t = mul(getRotationMatrixY(arot.y), t);
+	t = mul(getRotationMatrixZ(arot.z), t);
+	t = mul(getOrbiterLocalToNavigationBaseTransformation(), t);
+
+	VECTOR3 a = getRotationAnglesXZY(t);
+	cdu[0] = CDUCount(-a.x);
+	cdu[1] = CDUCount(-a.y);
+	cdu[2] = CDUCount(-a.z);
+}
+
+static void QuatGimbals(const IMUQuat &q, const MATRIX3 &ref, int cdu[3])
+{
+	MATRIX3 t = mul(getOrbiterLocalToNavigationBaseTransformation(), mul(IMUQuatToMatrix(q), ref));
+
+	VECTOR3 a = IMUGimbalAnglesXZY(t);
+	cdu[0] = CDUCount(-a.x);
+	cdu[1] = CDUCount(-a.y);
+	cdu[2] = CDUCount(-a.z);
+}
+
+static double Random(double range)
+{
+	return ((double)rand() / RAND_MAX * 2.0 - 1.0) * range;
+}
+
+//Rotation around a unit axis, Rodrigues formula
+static MATRIX3 AxisAngle(const VECTOR3 &u, double a)
+{
+	double c = cos(a), s = sin(a), k = 1.0 - c;
+
+	return _M(c + u.x*u.x*k, u.x*u.y*k - u.z*s, u.x*u.z*k + u.y*s,
+		u.y*u.x*k + u.z*s, c + u.y*u.y*k, u.y*u.z*k - u.x*s,
+		u.z*u.x*k - u.y*s, u.z*u.y*k + u.x*s, c + u.z*u.z*k);
+}
+
+//Orbiter global orientation angles of a global to vessel matrix Rz * Ry * Rx
+static VECTOR3 EulerAngles(const MATRIX3 &m)
+{
+	return _V(atan2(m.m32, m.m33), asin(-m.m31), atan2(m.m21, m.m11));
+}
+
+static MATRIX3 EulerMatrix(const VECTOR3 &e)
+{
+	return mul(getRotationMatrixZ(e.z), mul(getRotationMatrixY(e.y), getRotationMatrixX(e.x)));
+}
+
+static MATRIX3 Transpose(const MATRIX3 &m)
+{
+	return _M(m.m11, m.m21, m.m31, m.m12, m.m22, m.m32, m.m13, m.m23, m.m33);
+}
+
+//Middle gimbal beyond the AGC gimbal lock warning
+static bool NearGimbalLock(const int cdu[3])
+{
+	return fabs(sin(cdu[2] * TWO_PI / 32768.0)) > sin(70.0 * RAD);
+}
+
+//Halfway between two CDU counts, the shorter way round
+static int CDUMid(int a, int b)
+{
+	int d = ((b - a + 040000) & 077777) - 040000;
+	return (a + d / 2) & 077777;
+}
+
+//One IMU frame, from attitude m0 turning by angle around axis
+struct Frame
+{
+	MATRIX3 m0, ref;
+	VECTOR3 axis;
+	double angle;
+	//Start and end attitude as Orbiter global orientation angles and local to global rotation matrix
+	VECTOR3 e0, e1;
+	MATRIX3 r1;
+	IMUQuat last;
+};
+
+//Euler angles, one keyframe per frame
+static int MatrixFrame(const Frame &f, double simdt, int cdu[][3])
+{
+	MatrixGimbals(f.e1, f.ref, cdu[0]);
+	return 1;
+}
+
+//Keyframes from q over n sub-steps of dq, the last one is end exactly
+static void QuatKeyframes(IMUQuat q, const IMUQuat &dq, const IMUQuat &end, const MATRIX3 &ref, int n, int cdu[][3])
+{
+	int k;
+
+	for (k = 0;k < n;k++)
+	{
+		q = (k == n - 1) ? end : IMUQuatNormalize(IMUQuatMul(dq, q));
+		QuatGimbals(q, ref, cdu[k]);
+	}
+}
+
+//First quaternion kernel, Euler angles and one sub-step every 20 ms
+static int EulerQuatFrame(const Frame &f, double simdt, int cdu[][3])
+{
+	int n = (int)ceil(simdt / 0.02);
+	if (n > IMU_MAX_SUBSTEPS) n = IMU_MAX_SUBSTEPS;
+
+	IMUQuat q1 = IMUQuatEuler(f.e1.x, f.e1.y, f.e1.z);
+	IMUQuat dq = IMUQuatRoot(IMUQuatMul(q1, IMUQuatConj(f.last)), n);
+	QuatKeyframes(f.last, dq, q1, f.ref, n, cdu);
+	return n;
+}
+
+//Current kernel as in IMU::Timestep
+static int QuatFrame(const Frame &f, double simdt, int cdu[][3])
+{
+	IMUQuat q1 = IMUQuatConj(IMUQuatFromMatrix(f.r1));
+	IMUQuat dq = IMUQuatMul(q1, IMUQuatConj(f.last));
+	int n = IMUSubSteps(simdt, dq);
+
+	if (n > 1) dq = IMUQuatRoot(dq, n);
+	QuatKeyframes(f.last, dq, q1, f.ref, n, cdu);
+	return n;
+}
+
+typedef int (*FrameFunc)(const Frame &f, double simdt, int cdu[][3]);
+
+//Times one frame calculation over all frames and checks its keyframes against the exact attitude
+static void RunFrames(const char *name, FrameFunc func, Frame *frames, int n, double simdt)
+{
+	static int cdu[IMU_MAX_SUBSTEPS][3];
+	int i, j, k, steps, keyerr = 0, miderr = 0;
+	long total = 0;
+	volatile int sink = 0;
+	int exact[3], start[3], prev[3];
+
+	auto t0 = std::chrono::steady_clock::now();
+	for (i = 0;i < n;i++)
+	{
+		total += func(frames[i], simdt, cdu);
+		sink += cdu[0][0];
+	}
+	auto t1 = std::chrono::steady_clock::now();
+	double t = std::chrono::duration<double>(t1 - t0).count();
+
+	for (i = 0;i < n;i++)
+	{
+		const Frame &f = frames[i];
+
+		steps = func(f, simdt, cdu);
+		MatrixGimbals(f.e0, f.ref, start);
+		if (NearGimbalLock(start) || NearGimbalLock(cdu[steps - 1])) continue;
+		for (k = 0;k < steps;k++)
+		{
+			for (j = 0;j < 3;j++) prev[j] = k == 0 ? start[j] : cdu[k - 1][j];
+
+			MatrixGimbals(EulerAngles(mul(AxisAngle(f.axis, f.angle * (k + 1) / steps), f.m0)), f.ref, exact);
+			for (j = 0;j < 3;j++)
+			{
+				int d = CDUDiff(exact[j], cdu[k][j]);
+				if (d > keyerr) keyerr = d;
+			}
+			MatrixGimbals(EulerAngles(mul(AxisAngle(f.axis, f.angle * (k + 0.5) / steps), f.m0)), f.ref, exact);
+			for (j = 0;j < 3;j++)
+			{
+				int d = CDUDiff(exact[j], CDUMid(prev[j], cdu[k][j]));
+				if (d > miderr) miderr = d;
+			}
+		}
+	}
+	printf("  %-18s %8.1f ns per frame, %5.2f keyframes, largest error %d counts at keyframes, %d halfway\n",
+		name, t / n * 1e9, (double)total / n, keyerr, miderr);
+}
+
+int main(int argc, char *argv[])
+{
+	int n, i, j, l, frames;
+	int a[3], b[3];
+	int maxdiff = 0;
+	double maxrate = 10.0 * RAD;
+	const double lengths[] = { 0.02, 0.1, 0.5, 2.0 };
+	volatile int sink = 0;
+
+	if (argc < 2)
+	{
+		fprintf(stderr, "Usage: %s <attitudes> [<body rate in deg/s>]\n", argv[0]);
+		return 1;
+	}
+	n = atoi(argv[1]);
+	if (argc > 2) maxrate = atof(argv[2]) * RAD;
+
+	VECTOR3 *arot = new VECTOR3[n];
+	MATRIX3 *rot = new MATRIX3[n];
+	MATRIX3 *ref = new MATRIX3[n];
+	for (i = 0;i < n;i++)
+	{
+		arot[i] = _V(Random(PI), Random(PI / 2.0), Random(PI));
+		//What GetRotationMatrix returns for these angles, the transpose of the global to vessel rotation
+		rot[i] = Transpose(EulerMatrix(arot[i]));
+		ref[i] = EulerMatrix(_V(Random(PI), Random(PI / 2.0), Random(PI)));
+	}
+
+	//Accuracy against imumath.cpp. Away from gimbal lock both should agree to the count.
+	for (i = 0;i < n;i++)
+	{
+		MatrixGimbals(arot[i], ref[i], a);
+		QuatGimbals(IMUQuatConj(IMUQuatFromMatrix(rot[i])), ref[i], b);
+		for (j = 0;j < 3;j++)
+		{
+			int d = CDUDiff(a[j], b[j]);
+			if (d > maxdiff) maxdiff = d;
+		}
+	}
+	printf("%d attitudes, largest CDU difference %d counts\n", n, maxdiff);
+
+	//Throughput of a single attitude
+	auto start = std::chrono::steady_clock::now();
+	for (i = 0;i < n;i++)
+	{
+		MatrixGimbals(arot[i], ref[i], a);
+		sink += a[0];
+	}
+	auto mid = std::chrono::steady_clock::now();
+	for (i = 0;i < n;i++)
+	{
+		QuatGimbals(IMUQuatEuler(arot[i].x, arot[i].y, arot[i].z), ref[i], b);
+		sink += b[0];
+	}
+	auto mid2 = std::chrono::steady_clock::now();
+	for (i = 0;i < n;i++)
+	{
+		QuatGimbals(IMUQuatConj(IMUQuatFromMatrix(rot[i])), ref[i], b);
+		sink += b[0];
+	}
+	auto end = std::chrono::steady_clock::now();
+	printf("imumath %.1f ns, quaternion from Euler angles %.1f ns, from rotation matrix %.1f ns per attitude\n",
+		std::chrono::duration<double>(mid - start).count() / n * 1e9,
+		std::chrono::duration<double>(mid2 - mid).count() / n * 1e9,
+		std::chrono::duration<double>(end - mid2).count() / n * 1e9);
+
+	//Whole frames at a constant body rate
+	frames = n / 10 + 1;
+	Frame *f = new Frame[frames];
+	for (l = 0;l < (int)(sizeof(lengths) / sizeof(lengths[0]));l++)
+	{
+		double simdt = lengths[l];
+
+		for (i = 0;i < frames;i++)
+		{
+			f[i].m0 = EulerMatrix(arot[i]);
+			f[i].ref = ref[i];
+			f[i].axis = unit(_V(Random(1.0), Random(1.0), Random(1.0)));
+			f[i].angle = Random(maxrate) * simdt;
+			f[i].e0 = arot[i];
+			MATRIX3 m1 = mul(AxisAngle(f[i].axis, f[i].angle), f[i].m0);
+			f[i].e1 = EulerAngles(m1);
+			f[i].r1 = Transpose(m1);
+			f[i].last = IMUQuatEuler(arot[i].x, arot[i].y, arot[i].z);
+		}
+		printf("%.2f s frames:\n", simdt);
+		RunFrames("imumath", MatrixFrame, f, frames, simdt);
+		RunFrames("Euler quaternion", EulerQuatFrame, f, frames, simdt);
+		RunFrames("matrix quaternion", QuatFrame, f, frames, simdt);
+	}
+
+	delete[] f;
+	delete[] arot;
+	delete[] rot;
+	delete[] ref;
+	return sink == 12345 ? 2 : 0;
+}
@@ -0,0 +1,142 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  Batch conic propagation benchmark
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+//############################################################################//
+// Compares the batch conic functions of OrbMech with the scalar ones and
+// times both:
+//
+//   kepler_bench [<states>]
+//
+// Random Earth orbits from low orbit to translunar are propagated by random
+// times of up to a day, once with rv_from_r0v0 per state and once with
+// rv_from_r0v0_batch. Positions a fraction of an orbit later are then fed
+// into elegant_lambert and elegant_lambert_batch. The largest differences
+// between both paths are reported. GCC only turns the masked lane updates
+// of the batch functions into vector selects without trapping math, and
+// the square roots only without errno; MSVC does both with /fp:precise.
+// Built on Linux for example with
+//
+//   g++ -O2 -fno-trapping-math -fno-math-errno -Isrc_headless -Isrc_sys
+//       -Isrc_rtccmfd -include strings.h
+//       src_headless/tools/KeplerBatchBench.cpp src_rtccmfd/OrbMech.cpp
+//       src_headless/OrbiterAPI.cpp src_headless/VesselAPI.cpp
+//       src_headless/HeadlessSim.cpp -o kepler_bench
+//############################################################################//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <chrono>
+#include <vector>
+#include "Orbitersdk.h"
+#include "OrbMech.h"
+
+static double Random(double range)
+{
+	return ((double)rand() / RAND_MAX * 2.0 - 1.0) * range;
+}
+
+int main(int argc, char *argv[])
+{
+	const double mu = OrbMech::mu_Earth;
+	double r, v, dr, dv, maxdr = 0.0, maxdv = 0.0, maxdl = 0.0;
+	VECTOR3 R, V;
+	int n = 10000, i;
+
+	if (argc > 1) n = atoi(argv[1]);
+	if (n < 1) n = 1;
+
+	OrbMech::ConicBatch sv0, sv1;
+	std::vector<double> dt(n), dtl(n);
+	std::vector<VECTOR3> R1(n), V1(n), R2(n), Vs(n), Vb(n);
+
+	sv0.resize(n);
+	for (i = 0;i < n;i++)
+	{
+		r = 6.6e6 + fabs(Random(3e8));
+		//Between circular and just below escape speed
+		v = sqrt(mu / r) * (1.0 + 0.4 * fabs(Random(1.0)));
+		R = unit(_V(Random(1.0), Random(1.0), Random(1.0))) * r;
+		V = unit(crossp(R, _V(Random(1.0), Random(1.0), Random(1.0)))) * v;
+		sv0.set(i, R, V);
+		dt[i] = fabs(Random(86400.0)) + 60.0;
+		dtl[i] = OrbMech::period(R, V, mu) * (0.05 + 0.4 * fabs(Random(1.0)));
+	}
+
+	//Accuracy
+	OrbMech::rv_from_r0v0_batch(sv0, dt.data(), sv1, mu);
+	for (i = 0;i < n;i++)
+	{
+		VECTOR3 Rb, Vb1;
+		sv0.get(i, R1[i], V1[i]);
+		OrbMech::rv_from_r0v0(R1[i], V1[i], dt[i], R, V, mu);
+		sv1.get(i, Rb, Vb1);
+		dr = length(R - Rb) / length(R);
+		dv = length(V - Vb1) / length(V);
+		if (dr > maxdr) maxdr = dr;
+		if (dv > maxdv) maxdv = dv;
+	}
+	printf("%d states, largest relative difference position %.2e, velocity %.2e\n", n, maxdr, maxdv);
+
+	OrbMech::rv_from_r0v0_batch(sv0, dtl.data(), sv1, mu);
+	for (i = 0;i < n;i++)
+	{
+		sv1.get(i, R2[i], V);
+	}
+	OrbMech::elegant_lambert_batch(n, R1.data(), V1.data(), R2.data(), dtl.data(), 0, true, mu, Vb.data());
+	for (i = 0;i < n;i++)
+	{
+		Vs[i] = OrbMech::elegant_lambert(R1[i], V1[i], R2[i], dtl[i], 0, true, mu);
+		dv = length(Vs[i] - Vb[i]) / length(Vs[i]);
+		if (dv > maxdl) maxdl = dv;
+	}
+	printf("%d Lambert transfers, largest relative difference %.2e\n", n, maxdl);
+
+	//Throughput
+	double sink = 0.0;
+	auto t0 = std::chrono::steady_clock::now();
+	for (i = 0;i < n;i++)
+	{
+		OrbMech::rv_from_r0v0(R1[i], V1[i], dt[i], R, V, mu);
+		sink += R.x;
+	}
+	auto t1 = std::chrono::steady_clock::now();
+	OrbMech::rv_from_r0v0_batch(sv0, dt.data(), sv1, mu);
+	sink += sv1.rx[0];
+	auto t2 = std::chrono::steady_clock::now();
+	for (i = 0;i < n;i++)
+	{
+		Vs[i] = OrbMech::elegant_lambert(R1[i], V1[i], R2[i], dtl[i], 0, true, mu);
+	}
+	auto t3 = std::chrono::steady_clock::now();
+	OrbMech::elegant_lambert_batch(n, R1.data(), V1.data(), R2.data(), dtl.data(), 0, true, mu, Vb.data());
+	auto t4 = std::chrono::steady_clock::now();
+
+	double ts = std::chrono::duration<double>(t1 - t0).count();
+	double tb = std::chrono::duration<double>(t2 - t1).count();
+	double tls = std::chrono::duration<double>(t3 - t2).count();
+	double tlb = std::chrono::duration<double>(t4 - t3).count();
+	printf("rv_from_r0v0 %.1f ns, batch %.1f ns per state (%.2fx)\n", ts / n * 1e9, tb / n * 1e9, ts / tb);
+	printf("elegant_lambert %.1f ns, batch %.1f ns per transfer (%.2fx)\n", tls / n * 1e9, tlb / n * 1e9, tls / tlb);
+	return sink == 0.12345 ? 1 : 0;
+}
@@ -0,0 +1,624 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  LM powered flight simulation benchmark
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+//############################################################################//
+// Compares the variable step LM powered flight simulation with the fixed
+// step AscDescIntegrator and times the targeting tables:
+//
+//   lmpoweredflight_bench [<threads>]
+//
+// Descents are flown to a grid of landing sites around a nominal one, from
+// a 60 by 8 NM descent orbit, with the ignition found like
+// RTCC::PDIIgnitionAlgorithm but with a conic coast. Ascents are flown at a
+// range of liftoff times below a CSM in a 60 NM orbit. The Moon pole is the
+// z axis. Both integrators are compared with a tight tolerance run of the
+// variable step integrator with the same models as the old one, point mass
+// gravity and no thrust transients. The fixed step is also split into 8 and
+// 64 steps per guidance cycle, to show what it takes to get close. The full model with harmonics and
+// transients is flown as well, serially and on the worker pool, and the
+// results of both have to be identical.
+//
+// Last, RTCC::PoweredDescentTable and RTCC::LunarAscentTable fly the same
+// kind of cases in the RTCC frame, with the RTCC ignition algorithm and the
+// coasting integrator. Every case is also flown by the fixed step
+// RTCC::PoweredDescentProcessor or RTCC::LunarAscentProcessor. Built on
+// Linux for example with
+//
+//   g++ -O2 -pthread -fpermissive -Isrc_headless -Isrc_headless/posix
+//       -Isrc_aux -Isrc_sys -Isrc_mfd -Isrc_lm -Isrc_moon -Isrc_csm
+//       -Isrc_launch -Isrc_landing -Isrc_saturn -Isrc_rtccmfd
+//       -include strings.h src_headless/tools/LMPoweredFlightBench.cpp
+//       src_launch/rtcc.cpp src_rtccmfd/CSMLMGuidanceSim.cpp
+//       src_rtccmfd/CoastNumericalIntegrator.cpp
+//       src_rtccmfd/EnckeIntegrator.cpp src_rtccmfd/EntryCalculations.cpp
+//       src_rtccmfd/EntryDispersion.cpp src_rtccmfd/GeneralizedIterator.cpp
+//       src_rtccmfd/LDPP.cpp src_rtccmfd/LMGuidanceSim.cpp
+//       src_rtccmfd/LOITargeting.cpp src_rtccmfd/LWP.cpp
+//       src_rtccmfd/OrbMech.cpp src_rtccmfd/PatchPointKernel.cpp
+//       src_rtccmfd/RTCCModule.cpp src_rtccmfd/ReentryNumericalIntegrator.cpp
+//       src_rtccmfd/SunMoonEphemeris.cpp src_rtccmfd/TLIGuidanceSim.cpp
+//       src_rtccmfd/TLMCC.cpp src_rtccmfd/rtcc_intermediate_library_programs.cpp
+//       src_rtccmfd/rtcc_library_programs.cpp src_sys/ScenarioCodec.cpp
+//       src_headless/OrbiterAPI.cpp src_headless/VesselAPI.cpp
+//       src_headless/HeadlessSim.cpp -o lmpoweredflight_bench
+//############################################################################//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <vector>
+#include <algorithm>
+#include "Orbitersdk.h"
+#include "OrbMech.h"
+#include "LMGuidanceSim.h"
+#include "WorkerPool.h"
+#include "rtcc.h"
+
+static const double mu_M = OrbMech::mu_Moon;
+static const double w_M = OrbMech::w_Moon;
+
+static LGCDescentConstants Targets;
+static LGCIgnitionConstants IgnTargets;
+
+//Moon fixed to inertial at time t
+static VECTOR3 MoonToInertial(VECTOR3 R, double t)
+{
+	double c = cos(w_M*t), s = sin(w_M*t);
+	return _V(c*R.x - s * R.y, s*R.x + c * R.y, R.z);
+}
+
+//RTCC::PDIIgnitionAlgorithm with a conic coast. The state R, V is at t = 0
+static bool PDIIgnition(VECTOR3 R, VECTOR3 V, double m, VECTOR3 R_LS, double TLAND, LMDescentCase &c)
+{
+	MATRIX3 C_GP, REFSMMAT;
+	VECTOR3 U_FDP, dV_TrP, R_TG, V_TG, A_TG, R_LSI, R_LSP, W_I, W_P, R_P, G_P, V_P, R_G, V_SURFP, V_G, A_G, A_FDP;
+	VECTOR3 C_XGP, C_YGP, C_ZGP, U_XSM, U_YSM, U_ZSM, R_I, V_I, R_D, V_D;
+	double GUIDDURN, AF_TRIM, DELTTRIM, TTT, t_pip, dt_I, FRAC, t_I, PIPTIME, t_pipold, eps, dTTT, TTT_P, TEM, q, t_UL;
+	double J_TZG, A_TZG, V_TZG, R_TZG;
+	int n1, n2, COUNT_TTT;
+
+	GUIDDURN = 664.4;
+	AF_TRIM = 0.350133;
+	DELTTRIM = 26.0;
+	FRAC = 43455.0;
+	t_UL = 7.9;
+	n1 = 40;
+	U_FDP = dV_TrP = _V(0, 0, 0);
+	C_GP = _M(1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0);
+	TTT = 0.0;
+	t_pip = TLAND;
+	dt_I = 1.0;
+	J_TZG = Targets.JBRFGZ;
+	A_TZG = Targets.ABRFG.z;
+	V_TZG = Targets.VBRFG.z;
+	R_TG = Targets.RBRFG;
+	R_TZG = Targets.RBRFG.z;
+	V_TG = Targets.VBRFG;
+	A_TG = Targets.ABRFG;
+
+	R_LSI = MoonToInertial(R_LS, TLAND);
+	U_XSM = unit(R_LSI);
+	U_ZSM = unit(crossp(crossp(R, V), U_XSM));
+	U_YSM = crossp(U_ZSM, U_XSM);
+	REFSMMAT = _M(U_XSM.x, U_XSM.y, U_XSM.z, U_YSM.x, U_YSM.y, U_YSM.z, U_ZSM.x, U_ZSM.y, U_ZSM.z);
+
+	R_LSP = mul(REFSMMAT, R_LSI);
+	t_I = TLAND - GUIDDURN;
+	W_I = _V(0, 0, 1);
+	W_P = mul(REFSMMAT, W_I)*w_M;
+	OrbMech::rv_from_r0v0(R, V, t_I, R_I, V_I, mu_M);
+
+	while (abs(dt_I) > 0.08 && n1 > 0)
+	{
+		PIPTIME = t_I;
+		R_P = mul(REFSMMAT, R_I);
+		G_P = -R_P / pow(length(R_P), 3.0)*mu_M;
+
+		n2 = 2;
+		t_pipold = t_pip;
+		t_pip = PIPTIME;
+		R_LSP = unit(R_LSP + crossp(W_P, R_LSP)*(t_pip - t_pipold))*length(R_LS);
+		TTT = TTT + t_pip - t_pipold;
+
+		while (n2 > 0)
+		{
+			V_P = mul(REFSMMAT, V_I) + dV_TrP;
+			R_G = mul(C_GP, R_P - R_LSP);
+			V_SURFP = V_P - crossp(W_P, R_P);
+			V_G = mul(C_GP, V_SURFP);
+
+			COUNT_TTT = 0;
+			eps = abs(TTT / 128.0);
+			do
+			{
+				dTTT = -(J_TZG*pow(TTT, 3.0) + 6.0*A_TZG*TTT*TTT + (18.0*V_TZG + 6.0*V_G.z)*TTT + 24.0*(R_TZG - R_G.z)) / (3.0*J_TZG*TTT*TTT + 12.0*A_TZG*TTT + 18.0*V_TZG + 6.0*V_G.z);
+				TTT += dTTT;
+				COUNT_TTT++;
+			} while (abs(dTTT) > eps && COUNT_TTT < 8);
+
+			if (COUNT_TTT == 8)
+			{
+				return false;
+			}
+
+			TTT_P = TTT + 2.2;
+			A_G = (R_TG - R_G)*(-24.0*TTT_P / pow(TTT, 3.0) + 36.0*TTT_P*TTT_P / pow(TTT, 4.0));
+			A_G += V_TG * (-18.0*TTT_P / TTT / TTT + 24.0*TTT_P*TTT_P / pow(TTT, 3.0));
+			A_G += V_G * (-6.0*TTT_P / TTT / TTT + 12.0*TTT_P*TTT_P / pow(TTT, 3.0));
+			A_G += A_TG * (6.0*TTT_P*TTT_P / TTT / TTT - 6.0*TTT_P / TTT + 1.0);
+
+			A_FDP = tmul(C_GP, A_G) - G_P;
+			TEM = FRAC * FRAC / m / m - A_FDP.x*A_FDP.x - A_FDP.y*A_FDP.y;
+			if (TEM < 0.0)
+			{
+				TEM = 0.0;
+			}
+			if (sqrt(TEM) + A_FDP.z < 0.0)
+			{
+				A_FDP.z = -sqrt(TEM);
+			}
+			U_FDP = A_FDP;
+
+			C_XGP = unit(R_LSP);
+			C_YGP = unit(crossp(unit(V_SURFP*TTT / 4.0 + R_LSP - R_P), R_LSP));
+			C_ZGP = crossp(C_XGP, C_YGP);
+			C_GP = _M(C_XGP.x, C_YGP.x, C_ZGP.x, C_XGP.y, C_YGP.y, C_ZGP.y, C_XGP.z, C_YGP.z, C_ZGP.z);
+
+			dV_TrP = unit(U_FDP)*DELTTRIM*AF_TRIM;
+			n2--;
+		}
+
+		n1--;
+		q = IgnTargets.K_X * (R_G.x - IgnTargets.r_IGXG) + IgnTargets.K_Y * R_G.y*R_G.y + R_G.z - IgnTargets.r_IGZG + IgnTargets.K_V * (length(V_G) - IgnTargets.v_IGG);
+		dt_I = -q / (V_G.z + IgnTargets.K_X * V_G.x);
+		t_I += dt_I;
+		OrbMech::rv_from_r0v0(R, V, t_I, R_I, V_I, mu_M);
+	}
+
+	if (n1 == 0)
+	{
+		return false;
+	}
+
+	//Like RTCC::PoweredDescentProcessor
+	c.t_IG = t_I - DELTTRIM;
+	c.t0 = c.t_IG - t_UL;
+	OrbMech::rv_from_r0v0(R, V, c.t0, R_D, V_D, mu_M);
+	c.R = R_D;
+	c.V = V_D;
+	c.m = m;
+	c.t_go = -TTT;
+	c.REFSMMAT = REFSMMAT;
+	c.W = mul(REFSMMAT, W_I)*w_M;
+	c.R_LSP = mul(REFSMMAT, MoonToInertial(R_LS, c.t_IG));
+	c.U_FDP = tmul(REFSMMAT, unit(U_FDP));
+	c.U_Pole = W_I;
+	return true;
+}
+
+//AscDescIntegrator with the guidance cycle split into n steps
+class SubstepIntegrator
+{
+public:
+	SubstepIntegrator(int n) : n(n) {}
+	void Init(VECTOR3 U_TD_init) { U_TD_cur = U_TD_init; }
+	bool Integration(VECTOR3 &R, VECTOR3 &V, double &mnow, double &t_total, VECTOR3 U_TD, double t_remain, double Thrust, double Isp)
+	{
+		VECTOR3 k, DVDT, G_P, G_PDT;
+		double T = min(2.0, t_remain), dt = T / n, max_rate = 10.0*RAD;
+		int i;
+
+		for (i = 0;i < n;i++)
+		{
+			if (acos2(dotp(U_TD, U_TD_cur)) < max_rate*dt)
+			{
+				U_TD_cur = U_TD;
+			}
+			else
+			{
+				k = unit(crossp(U_TD_cur, U_TD));
+				U_TD_cur = U_TD_cur * cos(max_rate*dt) + crossp(k, U_TD_cur)*sin(max_rate*dt) + k * dotp(k, U_TD_cur)*(1.0 - cos(max_rate*dt));
+			}
+			DVDT = U_TD_cur * Thrust / mnow * dt;
+			G_P = -R * mu_M / pow(length(R), 3);
+			R = R + (V + G_P * dt / 2.0 + DVDT / 2.0)*dt;
+			G_PDT = -R * mu_M / pow(length(R), 3);
+			V = V + (G_PDT + G_P)*dt / 2.0 + DVDT;
+			mnow -= Thrust / Isp * dt;
+		}
+		t_total += T;
+		return t_remain <= 2.0;
+	}
+protected:
+	int n;
+	VECTOR3 U_TD_cur;
+};
+
+//Like RTCC::PoweredDescentProcessor and RTCC::LunarAscentProcessor with the fixed step
+static void FixedDescent(const LMDescentCase &c, int nsub, LMPoweredFlightResult &res)
+{
+	DescentGuidance descguid;
+	SubstepIntegrator integ(nsub);
+	VECTOR3 U_FDP;
+	double t_go = c.t_go, T, isp;
+	bool stop = false;
+
+	res = LMPoweredFlightResult();
+	res.R = c.R;
+	res.V = c.V;
+	res.m = c.m;
+	res.t_CO = c.t0;
+	descguid.Init(c.R, c.V, c.m, c.t_IG, c.REFSMMAT, c.R_LSP, c.t_IG, c.W, c.t_go, &Targets);
+	integ.Init(c.U_FDP);
+	while (stop == false && res.Cycles < 3000)
+	{
+		descguid.Guidance(res.R, res.V, res.m, res.t_CO, U_FDP, t_go, T, isp);
+		stop = integ.Integration(res.R, res.V, res.m, res.t_CO, U_FDP, t_go, T, isp);
+		res.Cycles++;
+	}
+	res.Err = !stop;
+}
+
+static void FixedAscent(const LMAscentCase &c, int nsub, LMPoweredFlightResult &res)
+{
+	AscentGuidance asc;
+	SubstepIntegrator integ(nsub);
+	VECTOR3 U_FDP;
+	double t_go, T, isp;
+	bool stop = false;
+
+	res = LMPoweredFlightResult();
+	res.R = c.R;
+	res.V = c.V;
+	res.m = c.m;
+	res.t_CO = c.t0;
+	asc.Init(c.R_C, c.V_C, c.m, c.r_LS, c.v_LH, c.v_LV);
+	integ.Init(unit(c.R));
+	while (stop == false && res.Cycles < 3000)
+	{
+		asc.Guidance(res.R, res.V, res.m, res.t_CO, U_FDP, t_go, T, isp);
+		stop = integ.Integration(res.R, res.V, res.m, res.t_CO, U_FDP, t_go, T, isp);
+		res.Cycles++;
+	}
+	res.Err = !stop;
+}
+
+static double Seconds(std::chrono::steady_clock::time_point t0)
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+}
+
+struct Comparison
+{
+	double dr_med, dr_max, dv_max, dm_max;
+	int cycles, err;
+};
+
+//The flights end when the guidance time to go runs out, so a different number of guidance cycles moves the cutoff by a
+//part of a cycle. The median shows the integration error, the largest differences come from those cases.
+static Comparison Compare(const std::vector<LMPoweredFlightResult> &a, const std::vector<LMPoweredFlightResult> &ref)
+{
+	Comparison c = { 0.0, 0.0, 0.0, 0.0, 0, 0 };
+	std::vector<double> dr;
+	unsigned i;
+
+	for (i = 0;i < a.size();i++)
+	{
+		if (a[i].Err || ref[i].Err)
+		{
+			c.err++;
+			continue;
+		}
+		dr.push_back(length(a[i].R - ref[i].R));
+		c.dr_max = max(c.dr_max, dr.back());
+		c.dv_max = max(c.dv_max, length(a[i].V - ref[i].V));
+		c.dm_max = max(c.dm_max, abs(a[i].m - ref[i].m));
+		if (a[i].Cycles != ref[i].Cycles) c.cycles++;
+	}
+	if (dr.size())
+	{
+		std::nth_element(dr.begin(), dr.begin() + dr.size() / 2, dr.end());
+		c.dr_med = dr[dr.size() / 2];
+	}
+	return c;
+}
+
+static void PrintComparison(const char *name, const Comparison &c, double t, int n, double steps)
+{
+	printf("  %-26s %9.3f %9.3f m %9.5f m/s %8.4f kg %4d %8.1f us %7.1f", name, c.dr_med, c.dr_max, c.dv_max, c.dm_max, c.cycles, t / n * 1e6, steps);
+	if (c.err) printf(" %d failed", c.err);
+	printf("\n");
+}
+
+static bool Identical(const std::vector<LMPoweredFlightResult> &a, const std::vector<LMPoweredFlightResult> &b)
+{
+	unsigned i;
+
+	for (i = 0;i < a.size();i++)
+	{
+		if (memcmp(&a[i].R, &b[i].R, sizeof(VECTOR3)) || memcmp(&a[i].V, &b[i].V, sizeof(VECTOR3)) || a[i].m != b[i].m || a[i].t_CO != b[i].t_CO || a[i].Err != b[i].Err) return false;
+	}
+	return true;
+}
+
+static double MeanSteps(const std::vector<LMPoweredFlightResult> &res)
+{
+	double s = 0.0;
+	unsigned i;
+
+	for (i = 0;i < res.size();i++)
+	{
+		s += res[i].Steps;
+	}
+	return res.size() ? s / res.size() : 0.0;
+}
+
+static void PrintTableComparison(const char *name, double dt_IG, double dt_CO, double dm, double ddv, int err, double t_proc, double t_table, int n)
+{
+	printf("  %-8s %8.3f s %8.3f s %8.3f kg %8.3f m/s %9.1f us %9.1f us", name, dt_IG, dt_CO, dm, ddv, t_proc / n * 1e6, t_table / n * 1e6);
+	if (err) printf(" %d failed", err);
+	printf("\n");
+}
+
+//The RTCC table wrappers against the fixed step RTCC processors. The states are in the RTCC frame around the Moon of
+//HeadlessSim. The pericynthion of the descent orbit is at selenographic longitude 0, 15 degrees ahead of the nominal site.
+static void RTCCTables()
+{
+	RTCC *rtcc = new RTCC();
+	std::vector<VECTOR3> R_LS;
+	std::vector<double> TLAND, t_liftoff;
+	std::vector<LMPoweredFlightResult> res;
+	LMPoweredFlightOptions opt;
+	RTCCNIAuxOutputTable aux;
+	SV sv, sv_CSM, sv_PDI, sv_land, sv_IG, sv_Ins;
+	MATRIX3 Rot;
+	VECTOR3 U_Pole, R_LSA;
+	double GETbase, r_LS, r_p, r_a, a, incl, dv, theta, dt_asc, t_proc, t_table, dt_IG, dt_CO, dm, ddv;
+	int err;
+	unsigned i, j;
+	std::chrono::steady_clock::time_point t0;
+
+	GETbase = 40418.5;
+	r_LS = OrbMech::R_Moon - 1.9e3;
+	r_p = OrbMech::R_Moon + 50000.0*0.3048;
+	r_a = OrbMech::R_Moon + 60.0*1852.0;
+	a = (r_p + r_a) / 2.0;
+	incl = 1.5*RAD;
+
+	sv.gravref = oapiGetObjectByName("Moon");
+	sv.MJD = OrbMech::MJDfromGET(100.0*3600.0, GETbase);
+	sv.mass = 15100.0;
+	Rot = OrbMech::GetRotationMatrix(BODY_MOON, sv.MJD);
+	sv.R = rhmul(Rot, _V(r_p, 0, 0));
+	sv.V = rhmul(Rot, _V(0, cos(incl), sin(incl)))*sqrt(mu_M*(2.0 / r_p - 1.0 / a));
+	for (i = 0;i < 5;i++)
+	{
+		for (j = 0;j < 5;j++)
+		{
+			R_LS.push_back(OrbMech::r_from_latlong((-0.5 + 0.25*i)*RAD, (13.0 + 1.0*j)*RAD, r_LS));
+		}
+	}
+	TLAND.push_back(100.0*3600.0 + 720.0);
+
+	t0 = std::chrono::steady_clock::now();
+	rtcc->PoweredDescentTable(sv, GETbase, R_LS, TLAND, opt, res);
+	t_table = Seconds(t0);
+
+	dt_IG = dt_CO = dm = ddv = 0.0;
+	err = 0;
+	t0 = std::chrono::steady_clock::now();
+	for (i = 0;i < R_LS.size();i++)
+	{
+		if (!rtcc->PoweredDescentProcessor(R_LS[i], TLAND[0], sv, GETbase, aux, NULL, sv_PDI, sv_land, dv) || res[i].Err)
+		{
+			err++;
+			continue;
+		}
+		dt_IG = max(dt_IG, abs(res[i].t_IG - OrbMech::GETfromMJD(sv_PDI.MJD, GETbase)));
+		dt_CO = max(dt_CO, abs(res[i].t_CO - OrbMech::GETfromMJD(sv_land.MJD, GETbase)));
+		dm = max(dm, abs(res[i].m - sv_land.mass));
+		ddv = max(ddv, abs(res[i].DV - dv));
+	}
+	t_proc = Seconds(t0);
+
+	printf("RTCC tables, largest difference to the fixed step RTCC processors:\n");
+	printf("  %-8s %10s %10s %11s %12s %12s %12s\n", "", "ignition", "cutoff", "mass", "DV", "processor", "table");
+	PrintTableComparison("descent", dt_IG, dt_CO, dm, ddv, err, t_proc, t_table, R_LS.size());
+
+	//The CSM passes over the ascent site 30 minutes after the first liftoff
+	R_LSA = OrbMech::r_from_latlong(0.5*RAD, 15.0*RAD, r_LS);
+	sv_CSM.gravref = sv.gravref;
+	sv_CSM.MJD = OrbMech::MJDfromGET(130.0*3600.0, GETbase);
+	sv_CSM.mass = 15000.0;
+	Rot = OrbMech::GetRotationMatrix(BODY_MOON, sv_CSM.MJD);
+	U_Pole = _V(0, 0, 1);
+	sv_CSM.R = rhmul(Rot, unit(R_LSA)*r_a);
+	sv_CSM.V = rhmul(Rot, unit(crossp(U_Pole, R_LSA)))*sqrt(mu_M / r_a);
+	for (i = 0;i < 61;i++)
+	{
+		t_liftoff.push_back(130.0*3600.0 - 1800.0 + 60.0*i);
+	}
+
+	t0 = std::chrono::steady_clock::now();
+	rtcc->LunarAscentTable(R_LSA, 4800.0, sv_CSM, GETbase, t_liftoff, 5509.5*0.3048, 19.5*0.3048, opt, res);
+	t_table = Seconds(t0);
+
+	dt_CO = dm = ddv = 0.0;
+	err = 0;
+	t0 = std::chrono::steady_clock::now();
+	for (i = 0;i < t_liftoff.size();i++)
+	{
+		rtcc->LunarAscentProcessor(R_LSA, 4800.0, sv_CSM, GETbase, t_liftoff[i], 5509.5*0.3048, 19.5*0.3048, theta, dt_asc, dv, sv_IG, sv_Ins);
+		if (res[i].Err)
+		{
+			err++;
+			continue;
+		}
+		dt_CO = max(dt_CO, abs(res[i].t_CO - dt_asc));
+		dm = max(dm, abs(res[i].m - sv_Ins.mass));
+		ddv = max(ddv, abs(res[i].DV - dv));
+	}
+	t_proc = Seconds(t0);
+	PrintTableComparison("ascent", 0.0, dt_CO, dm, ddv, err, t_proc, t_table, t_liftoff.size());
+
+	delete rtcc;
+}
+
+int main(int argc, char *argv[])
+{
+	unsigned threads = argc > 1 ? atoi(argv[1]) : 0;
+	std::vector<LMDescentCase> desc;
+	std::vector<LMAscentCase> asc;
+	std::vector<LMPoweredFlightResult> res_fix, res_new, res_ref, res_full, res_par;
+	std::vector<double> dlat, dlng;
+	LMDescentCase dc;
+	LMAscentCase ac;
+	VECTOR3 R_LS, R, V, R_C, V_C;
+	double r_LS, r_p, r_a, a, incl, TLAND, t;
+	unsigned i, j, n;
+
+	//
+	// Descent cases. The orbit has its pericynthion at 50000 ft about 15 degrees ahead of the nominal site.
+	//
+
+	r_LS = OrbMech::R_Moon - 1.9e3;
+	r_p = OrbMech::R_Moon + 50000.0*0.3048;
+	r_a = OrbMech::R_Moon + 60.0*1852.0;
+	a = (r_p + r_a) / 2.0;
+	incl = 1.5*RAD;
+	R = _V(r_p, 0, 0);
+	V = _V(0, cos(incl), sin(incl))*sqrt(mu_M*(2.0 / r_p - 1.0 / a));
+	//Nominal landing time, the Moon turns under the orbit until then
+	TLAND = 720.0;
+
+	for (i = 0;i < 11;i++) dlat.push_back((-0.5 + 0.1*i)*RAD);
+	for (i = 0;i < 11;i++) dlng.push_back((-2.0 + 0.4*i)*RAD);
+	for (i = 0;i < dlat.size();i++)
+	{
+		for (j = 0;j < dlng.size();j++)
+		{
+			R_LS = OrbMech::r_from_latlong(dlat[i], 15.0*RAD + dlng[j] - w_M * TLAND, r_LS);
+			if (!PDIIgnition(R, V, 15100.0, R_LS, TLAND + dlng[j] / (2.0*PI / OrbMech::period(R, V, mu_M)), dc))
+			{
+				printf("No ignition for site %d %d\n", i, j);
+				continue;
+			}
+			desc.push_back(dc);
+		}
+	}
+
+	//
+	// Ascent cases. The CSM orbit passes over the site at t = 0, later liftoffs are out of plane.
+	//
+
+	r_a = OrbMech::R_Moon + 60.0*1852.0;
+	R_C = _V(r_a, 0, 0);
+	V_C = _V(0, cos(incl), sin(incl))*sqrt(mu_M / r_a);
+	for (i = 0;i < 121;i++)
+	{
+		t = -1800.0 + 30.0*i;
+		OrbMech::rv_from_r0v0(R_C, V_C, t, ac.R_C, ac.V_C, mu_M);
+		ac.R = MoonToInertial(OrbMech::r_from_latlong(0.5*RAD, -12.0*RAD, r_LS), t);
+		ac.U_Pole = _V(0, 0, 1);
+		ac.V = crossp(ac.U_Pole, ac.R)*w_M;
+		ac.m = 4800.0;
+		ac.t0 = 0.0;
+		ac.r_LS = r_LS;
+		ac.v_LH = 5509.5*0.3048;
+		ac.v_LV = 19.5*0.3048;
+		asc.push_back(ac);
+	}
+
+	//
+	// Models
+	//
+
+	LMPoweredFlightOptions pm, ref, full;
+	pm.Harmonics = false;
+	pm.TauThrottle = pm.ThrottleRate = pm.TauBuildup = 0.0;
+	ref = pm;
+	ref.TolR = 1e-7;
+	ref.TolV = 1e-10;
+	LMPoweredFlightSim sim_pm(pm), sim_ref(ref), sim_full(full);
+
+	for (int k = 0;k < 2;k++)
+	{
+		std::chrono::steady_clock::time_point t0;
+		bool d = k == 0;
+		n = d ? desc.size() : asc.size();
+		printf("%s, %d cases. Difference of the cutoff state to the tight tolerance run:\n", d ? "Descent" : "Ascent", n);
+		printf("  %-26s %9s %9s   %9s     %8s    %4s %8s    %7s\n", "", "median", "largest", "", "", "cyc", "time", "steps");
+
+		//1 substep is the same as AscDescIntegrator
+		for (j = 0;j < 3;j++)
+		{
+			int nsub = j == 0 ? 1 : (j == 1 ? 8 : 64);
+			char name[32];
+
+			res_fix.resize(n);
+			t0 = std::chrono::steady_clock::now();
+			for (i = 0;i < n;i++)
+			{
+				if (d) FixedDescent(desc[i], nsub, res_fix[i]); else FixedAscent(asc[i], nsub, res_fix[i]);
+			}
+			double t_old = Seconds(t0);
+			if (j == 0)
+			{
+				if (d) sim_ref.DescentTable(desc, &Targets, res_ref); else sim_ref.AscentTable(asc, res_ref);
+			}
+			sprintf(name, "fixed %g s step", 2.0 / nsub);
+			PrintComparison(name, Compare(res_fix, res_ref), t_old, n, nsub * res_fix[0].Cycles);
+		}
+
+		t0 = std::chrono::steady_clock::now();
+		if (d) sim_pm.DescentTable(desc, &Targets, res_new, 1); else sim_pm.AscentTable(asc, res_new, 1);
+		double t_new = Seconds(t0);
+
+		t0 = std::chrono::steady_clock::now();
+		if (d) sim_full.DescentTable(desc, &Targets, res_full, 1); else sim_full.AscentTable(asc, res_full, 1);
+		double t_full = Seconds(t0);
+
+		t0 = std::chrono::steady_clock::now();
+		if (d) sim_full.DescentTable(desc, &Targets, res_par, threads); else sim_full.AscentTable(asc, res_par, threads);
+		double t_par = Seconds(t0);
+
+		PrintComparison("variable step", Compare(res_new, res_ref), t_new, n, MeanSteps(res_new));
+		PrintComparison("harmonics and transients", Compare(res_full, res_ref), t_full, n, MeanSteps(res_full));
+		printf("  full model on %u threads: %.1f ms against %.1f ms serial, %s\n", threads ? threads : WorkerPool::DefaultThreadCount(), t_par*1e3, t_full*1e3,
+			Identical(res_full, res_par) ? "identical results" : "DIFFERENT RESULTS");
+
+		//Sample of the targeting table
+		printf("  %6s %9s %9s %9s %9s\n", d ? "case" : "liftoff", "t_IG", "t_CO", "mass", "DV");
+		for (i = 0;i < n;i += n / 5)
+		{
+			if (d) printf("  %6d", i); else printf("  %6.0f", -1800.0 + 30.0*i);
+			printf(" %9.1f %9.1f %9.1f %9.1f\n", res_full[i].t_IG, res_full[i].t_CO, res_full[i].m, res_full[i].DV);
+		}
+		if (!Identical(res_full, res_par)) return 1;
+	}
+
+	RTCCTables();
+	return 0;
+}
@@ -0,0 +1,1234 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  LVDC ascent simulator
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+//############################################################################//
+// Flies the LVDC flight program of the Saturn IB and the Saturn V from
+// T-20 seconds to orbit without Orbiter:
+//
+//   lvdc_ascent [<Orbiter directory>] [1b|v] [-log]
+//
+// The LVDC runs unchanged with the default flight sequence program of the
+// Orbiter directory, which is the current directory if none is given. Its
+// log is only written with -log, to lvlog1b.txt or lvlog.txt in the current
+// directory; otherwise the LVDC opens it in the temporary directory, so the
+// log of the last Orbiter session is left alone. The LVDA and the IU are replaced here by a
+// point mass vehicle: the stages with their dry mass, propellant and engines,
+// switch selector channels for the engine cutoffs, mixture ratio shifts and
+// separations, and the discretes the flight program waits for. The vehicle flies through a US 1976 standard
+// atmosphere on a J2 to J4 gravity field. The LVIMU is perfect, its platform
+// is the plumbline system the LVDC sets up at guidance reference release, and
+// the vehicle follows the attitude error with a first order lag instead of
+// a flight control computer.
+//
+// At S-IVB cutoff the state is compared with the terminal conditions of the
+// LVDC and with its navigation state. The time the LVDC takes per step is
+// measured. The return value is nonzero if a vehicle didn't reach its
+// target. Built on Linux for example with
+//
+//   g++ -O2 -Isrc_headless -Isrc_sys -Isrc_saturn -Isrc_rtccmfd
+//       -include strings.h src_headless/tools/LVDCAscentSim.cpp
+//       src_saturn/LVDC.cpp src_rtccmfd/OrbMech.cpp
+//       src_headless/OrbiterAPI.cpp src_headless/VesselAPI.cpp
+//       src_headless/HeadlessSim.cpp -o lvdc_ascent
+//############################################################################//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include "Orbitersdk.h"
+#include "nasspdefs.h"
+#include "OrbMech.h"
+#include "LVDA.h"
+#include "LVDC.h"
+#include "HeadlessSim.h"
+
+#ifdef _WIN32
+#include <direct.h>
+#define NULL_DEVICE "NUL"
+#define chdir _chdir
+#define getcwd _getcwd
+#else
+#include <unistd.h>
+#define NULL_DEVICE "/dev/null"
+#endif
+
+//Earth, WGS 84
+#define ASC_MU 3.986004418e14
+#define ASC_RE 6378137.0
+#define ASC_FLAT (1.0 / 298.257223563)
+#define ASC_OMEGA 7.2921151467e-5
+#define ASC_G0 9.80665
+
+static const double ASC_J[5] = { 0.0, 0.0, 1.0826267e-3, -2.5327e-6, -1.6196e-6 };
+
+//Engine states
+#define ENGINE_OFF 0
+#define ENGINE_START 1
+#define ENGINE_RUN 2
+#define ENGINE_STOP 3
+
+//Steps of the state kept to compare with the LVDC navigation
+#define ASC_HISTORY 512
+
+//US Standard Atmosphere 1976 up to 86 km, isothermal above
+static void Atmosphere(double h, double &p, double &rho, double &a)
+{
+	static const double hb[8] = { 0.0, 11000.0, 20000.0, 32000.0, 47000.0, 51000.0, 71000.0, 84852.0 };
+	static const double Tb[8] = { 288.15, 216.65, 216.65, 228.65, 270.65, 270.65, 214.65, 186.946 };
+	static const double Lb[8] = { -0.0065, 0.0, 0.001, 0.0028, 0.0, -0.0028, -0.002, 0.0 };
+	static const double pb[8] = { 101325.0, 22632.06, 5474.889, 868.0187, 110.9063, 66.93887, 3.956420, 0.3733836 };
+	const double R = 287.053;
+	double hg, T;
+	int i;
+
+	//Geopotential altitude
+	hg = 6356766.0*h / (6356766.0 + h);
+	for (i = 7;i > 0 && hg < hb[i];i--);
+	T = Tb[i] + Lb[i] * (hg - hb[i]);
+	if (Lb[i] == 0.0) p = pb[i] * exp(-ASC_G0 * (hg - hb[i]) / (R*Tb[i]));
+	else p = pb[i] * pow(Tb[i] / T, ASC_G0 / (R*Lb[i]));
+	rho = p / (R*T);
+	a = sqrt(1.4*R*T);
+}
+
+static double Interpolate(const double *x, const double *y, int n, double v)
+{
+	int i;
+
+	if (v <= x[0]) return y[0];
+	for (i = 1;i < n;i++)
+	{
+		if (v < x[i]) return y[i - 1] + (y[i] - y[i - 1])*(v - x[i - 1]) / (x[i] - x[i - 1]);
+	}
+	return y[n - 1];
+}
+
+static double DragCoefficient(double mach)
+{
+	static const double M[9] = { 0.0, 0.6, 0.9, 1.1, 1.3, 2.0, 3.0, 5.0, 10.0 };
+	static const double Cd[9] = { 0.30, 0.32, 0.45, 0.70, 0.68, 0.52, 0.40, 0.30, 0.25 };
+
+	return Interpolate(M, Cd, 9, mach);
+}
+
+//J-2 mixture ratio tables, as in the S-II and S-IVB systems
+static const double J2MR[5] = { 4.0, 4.3, 5.0, 5.5, 6.0 };
+static const double J2MRThrust[5] = { 0.7, 0.7391, 0.898, 1.0, 1.1 };
+static const double J2MRISP[5] = { 437.6*ASC_G0, 432.6*ASC_G0, 426.5*ASC_G0, 423.4*ASC_G0, 421.4*ASC_G0 };
+static const double J2200MR[3] = { 4.5, 5.0, 5.5 };
+static const double J2200MRThrust[3] = { 770000.0 / 1009902.0, 889951.0 / 1009902.0, 1.0 };
+static const double J2200MRISP[3] = { 428.0*ASC_G0, 426.0*ASC_G0, 424.0*ASC_G0 };
+
+struct StageData
+{
+	const char *Name;
+	double DryMass;
+	double Propellant;
+	int Engines;
+	//Engines that count as inboard engines for the engine out discretes
+	int Inboard;
+	//Vacuum thrust per engine, at a mixture ratio of 5.5 for J-2 engines
+	double Thrust;
+	double ISPVac, ISPSL;
+	//Time from the start command to the start of the thrust buildup and duration of the buildup
+	double StartDelay, StartRamp;
+	//Mixture ratio tables, J-2 engines only
+	const double *MR, *MRThrust, *MRISP;
+	int MRPoints;
+	//Mixture ratios of the PU valve positions
+	double MRClosed, MRNull, MROpen;
+	//Propellant left at the low level and depletion sensors
+	double LowLevel, Depletion;
+};
+
+//Saturn IB, as in Saturn1b.cpp and sivbsystems.cpp
+static const StageData S1BStages[3] = {
+	{ "S-IB", 41874.0, 411953.0, 8, 4, 1008000.0, 294.0*ASC_G0, 262.0*ASC_G0, 0.0, 1.5, NULL, NULL, NULL, 0, 0.0, 0.0, 0.0, 24000.0, 4211.152 },
+	{ "", 0.0, 0.0, 0, 0, 0.0, 0.0, 0.0, 0.0, 0.0, NULL, NULL, NULL, 0, 0.0, 0.0, 0.0, 0.0, 0.0 },
+	{ "S-IVB", 12495.0, 105795.0, 1, 0, 1009902.0, 0.0, 0.0, 3.0, 2.8, J2200MR, J2200MRThrust, J2200MRISP, 3, 5.5, 5.0, 4.5, 0.0, 0.0 },
+};
+
+//Saturn V, as in Saturn5.cpp, siisystems.cpp and sivbsystems.cpp
+static const StageData SVStages[3] = {
+	{ "S-IC", 134602.0, 2146040.0, 5, 1, 8062309.0, 2979.4, 2601.3, 5.0, 2.5, NULL, NULL, NULL, 0, 0.0, 0.0, 0.0, 30000.0, 30000.0 },
+	{ "S-II", 41269.0, 443500.0, 5, 1, 1023000.0, 0.0, 0.0, 3.0, 2.8, J2MR, J2MRThrust, J2MRISP, 5, 5.5, 5.0, 4.5, 0.0, 7368.0 },
+	{ "S-IVB", 13439.0, 107428.0, 1, 0, 1023000.0, 0.0, 0.0, 3.0, 2.8, J2MR, J2MRThrust, J2MRISP, 5, 5.5, 4.946, 4.5, 0.0, 0.0 },
+};
+
+struct VehicleData
+{
+	const char *Name;
+	const StageData *Stages;
+	//S-II aft interstage, CSM and LM, launch escape tower
+	double Interstage, Payload, LES;
+	//Reference area for drag
+	double Area;
+	//First stage ignition before T-0
+	double Ignition;
+	//LES jettison after first stage separation
+	double LESJettison;
+};
+
+static const VehicleData Saturn1B = { "Saturn IB", S1BStages, 0.0, 5430.0 + 111.0 + 3900.0 + 4430.0, 4050.0, 34.2, 3.0, 25.0 };
+static const VehicleData SaturnV = { "Saturn V", SVStages, 3982.0, 5430.0 + 111.0 + 4100.0 + 18500.0 + 15094.0, 4050.0, 80.1, 8.9, 35.0 };
+
+struct Engine
+{
+	int State;
+	double Time;
+	double Level;
+};
+
+struct VehicleStage
+{
+	const StageData *Data;
+	bool Attached;
+	double Propellant;
+	double MR;
+	Engine E[8];
+	bool LowLevelArmed, DepletionArmed, Depleted;
+
+	bool ThrustOK(int i) const { return E[i].Level >= (Data->MR ? 0.65 : 0.9); }
+	bool InboardOut() const
+	{
+		int i;
+		for (i = Data->Engines - Data->Inboard;i < Data->Engines;i++) if (!ThrustOK(i)) return true;
+		return false;
+	}
+	bool OutboardOut() const
+	{
+		int i;
+		for (i = 0;i < Data->Engines - Data->Inboard;i++) if (!ThrustOK(i)) return true;
+		return false;
+	}
+	bool AllOut(int first, int last) const
+	{
+		int i;
+		for (i = first;i < last;i++) if (ThrustOK(i)) return false;
+		return true;
+	}
+};
+
+// ****************************************************************
+// The point mass vehicle in place of the IU and the stages.
+// Positions, velocities and the PIPAs are in the plumbline system
+// of guidance reference release.
+// ****************************************************************
+
+class IU
+{
+public:
+	IU() : lvdc(NULL) {}
+
+	void Init(const VehicleData &v, LVDC *l, double mjd)
+	{
+		int i;
+
+		lvdc = l;
+		veh = &v;
+		for (i = 0;i < 3;i++)
+		{
+			stages[i].Data = &v.Stages[i];
+			stages[i].Attached = v.Stages[i].Engines > 0;
+			stages[i].Propellant = v.Stages[i].Propellant;
+			stages[i].MR = v.Stages[i].MRNull;
+			memset(stages[i].E, 0, sizeof(stages[i].E));
+			stages[i].LowLevelArmed = stages[i].DepletionArmed = stages[i].Depleted = false;
+		}
+		Interstage = v.Interstage > 0.0;
+		LES = true;
+		SIISIVBSepArmed = InterstageSepArmed = false;
+		StageNo = PRELAUNCH_STAGE;
+		MJD = mjd;
+		SimT = 0.0;
+		T_GRR = T_Sep = -1.0;
+		GRR = Released = Aligned = false;
+		PIPA = Gimbal = AttErr = _V(0, 0, 0);
+		R = V = _V(0, 0, 0);
+		MaxQ = MaxQTime = 0.0;
+		Hist = 0;
+		memset(HistMJD, 0, sizeof(HistMJD));
+		HeadlessSim::Instance().mjd = MJD;
+	}
+
+	//Launch site, from the LVDC
+	void SetSite(double lat, double lng, double rad)
+	{
+		Lat = lat;
+		Lng = lng;
+		RadPad = rad;
+	}
+
+	void Step(double simdt)
+	{
+		SimT += simdt;
+		MJD += simdt / 86400.0;
+		HeadlessSim::Instance().mjd = MJD;
+
+		Sequence();
+		Engines(simdt);
+		if (Aligned)
+		{
+			if (Released) Flight(simdt);
+			else Pad();
+		}
+		Propellant(simdt);
+
+		Hist = (Hist + 1) % ASC_HISTORY;
+		HistMJD[Hist] = MJD;
+		HistR[Hist] = R;
+		HistV[Hist] = V;
+	}
+
+	//State at the time the LVIMU was read for the last navigation cycle
+	bool StateAt(double mjd, VECTOR3 &r, VECTOR3 &v) const
+	{
+		int i, k;
+
+		for (i = 0;i < ASC_HISTORY;i++)
+		{
+			k = (Hist - i + ASC_HISTORY) % ASC_HISTORY;
+			if (fabs(HistMJD[k] - mjd)*86400.0 < 0.001)
+			{
+				r = HistR[k];
+				v = HistV[k];
+				return true;
+			}
+		}
+		return false;
+	}
+
+	//Time from T-0
+	double T() const { return SimT - (T_GRR + 17.0); }
+
+	double Mass() const
+	{
+		double m = veh->Payload;
+		int i;
+
+		for (i = 0;i < 3;i++)
+		{
+			if (stages[i].Attached) m += stages[i].Data->DryMass + stages[i].Propellant;
+		}
+		if (Interstage) m += veh->Interstage;
+		if (LES) m += veh->LES;
+		return m;
+	}
+
+	double Altitude(const VECTOR3 &r) const
+	{
+		double s = dotp(r, Pole) / length(r);
+		return length(r) - ASC_RE * (1.0 - ASC_FLAT * s*s);
+	}
+
+	VECTOR3 Gravity(const VECTOR3 &r) const
+	{
+		double rr = length(r), s = dotp(r, Pole) / rr, q, P[5], dP[5];
+		VECTOR3 u = r / rr, a = -u * ASC_MU / (rr*rr);
+		int n;
+
+		P[0] = 1.0; P[1] = s;
+		dP[0] = 0.0; dP[1] = 1.0;
+		for (n = 2;n <= 4;n++)
+		{
+			P[n] = ((2 * n - 1)*s*P[n - 1] - (n - 1)*P[n - 2]) / n;
+			dP[n] = n * P[n - 1] + s * dP[n - 1];
+			q = ASC_MU * ASC_J[n] * pow(ASC_RE / rr, n) / (rr*rr);
+			a += (u*((n + 1)*P[n] + s * dP[n]) - Pole * dP[n])*q;
+		}
+		return a;
+	}
+
+	//Switch selector channels the point mass reacts to
+	void SwitchSelector(int stage, int channel)
+	{
+		bool sv = veh == &SaturnV;
+		VehicleStage &s1 = stages[0], &s2 = stages[1], &s4 = stages[2];
+
+		if (stage == SWITCH_SELECTOR_SI && s1.Attached)
+		{
+			if (sv)
+			{
+				if (channel == 8 || channel == 16) StopEngine(s1, 4);
+				else if (channel == 9 || channel == 14) s1.DepletionArmed = true;
+				else if (channel == 15 || channel == 19) Separate(0);
+			}
+			else
+			{
+				if (channel == 18) StopEngines(s1, 0, 4);
+				else if (channel == 98) StopEngines(s1, 4, 8);
+				else if (channel == 79 || channel == 97) s1.DepletionArmed = true;
+				else if (channel == 104) s1.LowLevelArmed = true;
+				else if (channel == 23) Separate(0);
+			}
+		}
+		else if (stage == SWITCH_SELECTOR_SII && sv && s2.Attached)
+		{
+			if (channel == 3 || channel == 42) s2.DepletionArmed = true;
+			else if (channel == 8) SIISIVBSepArmed = true;
+			else if (channel == 5 && SIISIVBSepArmed) Separate(1);
+			else if (channel == 11) InterstageSepArmed = true;
+			else if (channel == 23 && InterstageSepArmed && Interstage)
+			{
+				Interstage = false;
+				StageNo = LAUNCH_STAGE_TWO_ISTG_JET;
+				Event("S-II aft interstage jettison");
+			}
+			else if (channel == 33) StartEngines(s2);
+			else if (channel == 15) StopEngine(s2, 4);
+			else if (channel == 18) StopEngines(s2, 0, 5);
+			else if (channel == 56) s2.MR = s2.Data->MROpen;
+			else if (channel == 58) s2.MR = s2.Data->MRNull;
+			else if (channel == 59) s2.MR = s2.Data->MRClosed;
+		}
+		else if (stage == SWITCH_SELECTOR_SIVB && s4.Attached)
+		{
+			if (channel == 9) StartEngines(s4);
+			else if (channel == 12 || (!sv && channel == 43)) StopEngines(s4, 0, 1);
+			else if (sv)
+			{
+				if (channel == 17) s4.MR = s4.Data->MROpen;
+				else if (channel == 18) s4.MR = s4.Data->MRNull;
+			}
+			else
+			{
+				if (channel == 32) s4.MR = s4.Data->MROpen;
+				else if (channel == 34) s4.MR = s4.Data->MRClosed;
+				else if (channel == 33 || channel == 35) s4.MR = s4.Data->MRNull;
+			}
+		}
+	}
+
+	//Platform set up at guidance reference release
+	VECTOR3 GetTheodoliteAlignment(double azimuth)
+	{
+		MATRIX3 Rot = OrbMech::GetRotationMatrix(BODY_EARTH, MJD);
+		double OGA = PI05 - azimuth;
+
+		//Plumbline system to the Orbiter frame
+		M = OrbMech::Orbiter2PACSS13(MJD, Lat, Lng, azimuth);
+		Pole = unit(mul(M, mul(Rot, _V(0, 1, 0))));
+		R0 = _V(RadPad, 0, 0);
+		T_Align = SimT;
+		Aligned = true;
+		Pad();
+
+		while (OGA < 0) OGA += PI2;
+		return _V(OGA, 0, 0);
+	}
+
+	void ZeroPIPA() { PIPA = _V(0, 0, 0); }
+
+	VECTOR3 GetPIPA() { return PIPA; }
+
+	bool Liftoff() const { return Released; }
+
+	bool GuidanceReferenceRelease() const { return GRR; }
+
+	void SetAttitudeError(VECTOR3 e) { AttErr = e; }
+
+	void Event(const char *name) const
+	{
+		printf("  T%+8.2f  %s\n", T(), name);
+	}
+
+	LVDC *GetLVDC() { return lvdc; }
+
+	LVDC *lvdc;
+	const VehicleData *veh;
+	VehicleStage stages[3];
+	bool Interstage, LES, SIISIVBSepArmed, InterstageSepArmed;
+	int StageNo;
+	double MJD, SimT, T_GRR, T_Align, T_Sep;
+	bool GRR, Released, Aligned;
+	double Lat, Lng, RadPad;
+	MATRIX3 M;
+	VECTOR3 Pole, R0, R, V, PIPA, Gimbal, AttErr;
+	double MaxQ, MaxQTime;
+
+protected:
+	int Hist;
+	double HistMJD[ASC_HISTORY];
+	VECTOR3 HistR[ASC_HISTORY], HistV[ASC_HISTORY];
+
+	void Sequence()
+	{
+		//Guidance reference release at T-17 s, 3 seconds after the start
+		if (!GRR && SimT >= 3.0)
+		{
+			GRR = true;
+			T_GRR = SimT;
+		}
+		if (!GRR) return;
+
+		//Ground start of the first stage engines
+		if (stages[0].E[0].State == ENGINE_OFF && T() >= -veh->Ignition && stages[0].Propellant > 0.0)
+		{
+			StartEngines(stages[0]);
+			Event("First stage ignition");
+		}
+		//Hold-down release at T-0 with enough thrust
+		if (!Released && Aligned && T() >= 0.0 && Thrust(101325.0) > Mass()*ASC_G0)
+		{
+			Released = true;
+			StageNo = LAUNCH_STAGE_ONE;
+			Event("Liftoff");
+		}
+		if (LES && T_Sep >= 0.0 && SimT >= T_Sep + veh->LESJettison)
+		{
+			LES = false;
+			Event("LES jettison");
+		}
+	}
+
+	void StartEngines(VehicleStage &s)
+	{
+		int i;
+
+		for (i = 0;i < s.Data->Engines;i++)
+		{
+			if (s.E[i].State == ENGINE_OFF)
+			{
+				s.E[i].State = ENGINE_START;
+				s.E[i].Time = 0.0;
+			}
+		}
+	}
+
+	void StopEngine(VehicleStage &s, int i)
+	{
+		if (s.E[i].State == ENGINE_START || s.E[i].State == ENGINE_RUN)
+		{
+			s.E[i].State = ENGINE_STOP;
+			s.E[i].Time = 0.0;
+		}
+	}
+
+	void StopEngines(VehicleStage &s, int first, int last)
+	{
+		int i;
+		for (i = first;i < last && i < s.Data->Engines;i++) StopEngine(s, i);
+	}
+
+	void Separate(int i)
+	{
+		char buf[64];
+
+		if (!stages[i].Attached) return;
+		stages[i].Attached = false;
+		if (i == 1) Interstage = false;
+		if (i == 0) T_Sep = SimT;
+		if (i == 0 && stages[1].Attached) StageNo = LAUNCH_STAGE_TWO;
+		else StageNo = LAUNCH_STAGE_SIVB;
+		sprintf(buf, "%s separation", stages[i].Data->Name);
+		Event(buf);
+	}
+
+	void Engines(double simdt)
+	{
+		int i, j;
+		double t;
+
+		for (i = 0;i < 3;i++)
+		{
+			VehicleStage &s = stages[i];
+			if (!s.Attached) continue;
+			for (j = 0;j < s.Data->Engines;j++)
+			{
+				Engine &e = s.E[j];
+				e.Time += simdt;
+				t = e.Time;
+				if (e.State == ENGINE_START)
+				{
+					e.Level = (t - s.Data->StartDelay) / s.Data->StartRamp;
+					if (e.Level <= 0.0) e.Level = 0.0;
+					if (e.Level >= 1.0)
+					{
+						e.Level = 1.0;
+						e.State = ENGINE_RUN;
+					}
+				}
+				else if (e.State == ENGINE_STOP)
+				{
+					//Thrust decay after cutoff, the J-2 curve of the S-IVB systems for all engines
+					if (t < 0.25) e.Level = 1.0 - 3.3048*t;
+					else if (t < 1.5) e.Level = 0.1738 - (t - 0.25)*0.1390;
+					else e.Level = 0.0;
+					if (e.Level <= 0.0)
+					{
+						e.Level = 0.0;
+						e.State = ENGINE_OFF;
+					}
+				}
+			}
+
+			//Propellant depletion sensors, on the Saturn V also when the engines they cut off are all out
+			if (s.Data->Depletion > 0.0 && s.DepletionArmed && !s.Depleted &&
+				(s.Propellant < s.Data->Depletion || (veh == &SaturnV && s.AllOut(0, i == 0 ? s.Data->Engines - s.Data->Inboard : s.Data->Engines))))
+			{
+				s.Depleted = true;
+				if (i == 0) StopEngines(s, 0, s.Data->Engines - s.Data->Inboard);
+				else StopEngines(s, 0, s.Data->Engines);
+			}
+			if (s.Propellant <= 0.0) StopEngines(s, 0, s.Data->Engines);
+		}
+	}
+
+	double EngineThrust(const VehicleStage &s, double p, double &mdot) const
+	{
+		double F, isp, ispvac, isp_sl, f = 0.0;
+		int i;
+
+		if (s.Data->MR)
+		{
+			F = s.Data->Thrust*Interpolate(s.Data->MR, s.Data->MRThrust, s.Data->MRPoints, s.MR);
+			ispvac = isp_sl = Interpolate(s.Data->MR, s.Data->MRISP, s.Data->MRPoints, s.MR);
+		}
+		else
+		{
+			F = s.Data->Thrust;
+			ispvac = s.Data->ISPVac;
+			isp_sl = s.Data->ISPSL;
+		}
+		isp = ispvac - (ispvac - isp_sl)*p / 101325.0;
+		for (i = 0;i < s.Data->Engines;i++) f += s.E[i].Level;
+		mdot = f * F / ispvac;
+		return mdot * isp;
+	}
+
+	double Thrust(double p) const
+	{
+		double F = 0.0, mdot;
+		int i;
+
+		for (i = 0;i < 3;i++)
+		{
+			if (stages[i].Attached) F += EngineThrust(stages[i], p, mdot);
+		}
+		return F;
+	}
+
+	void Propellant(double simdt)
+	{
+		double mdot;
+		int i;
+
+		for (i = 0;i < 3;i++)
+		{
+			if (!stages[i].Attached) continue;
+			EngineThrust(stages[i], 0.0, mdot);
+			stages[i].Propellant -= mdot * simdt;
+			if (stages[i].Propellant < 0.0) stages[i].Propellant = 0.0;
+		}
+	}
+
+	//Held down on the rotating Earth
+	void Pad()
+	{
+		double th = (SimT - T_Align)*ASC_OMEGA;
+		VECTOR3 w = Pole * ASC_OMEGA;
+
+		R = R0 * cos(th) + crossp(Pole, R0)*sin(th) + Pole * dotp(Pole, R0)*(1.0 - cos(th));
+		V = crossp(w, R);
+		//The pad holds the vehicle up
+		PIPA += (crossp(w, V) - Gravity(R))*LVDC_TIMESTEP;
+	}
+
+	//Sensed acceleration from thrust and drag
+	VECTOR3 Sensed(const VECTOR3 &r, const VECTOR3 &v, double m, const VECTOR3 &dir, bool record)
+	{
+		double h = Altitude(r), p, rho, a, q;
+		VECTOR3 vrel = v - crossp(Pole*ASC_OMEGA, r);
+
+		Atmosphere(h, p, rho, a);
+		q = 0.5*rho*dotp(vrel, vrel);
+		if (record && q > MaxQ)
+		{
+			MaxQ = q;
+			MaxQTime = T();
+		}
+		if (q <= 0.0) return dir * Thrust(p) / m;
+		return (dir*Thrust(p) - unit(vrel)*q*DragCoefficient(length(vrel) / a)*veh->Area) / m;
+	}
+
+	void Flight(double simdt)
+	{
+		VECTOR3 dir, k1r, k1v, k2r, k2v, k3r, k3v, k4r, k4v, s1, s2, s3, s4, d, rate;
+		double mdot = 0.0, md, m, A1, A2, A3, A4, A5;
+		int i;
+
+		for (i = 0;i < 3;i++)
+		{
+			if (stages[i].Attached)
+			{
+				EngineThrust(stages[i], 0.0, md);
+				mdot += md;
+			}
+		}
+		m = Mass() - mdot * simdt / 2.0;
+		dir = _V(cos(Gimbal.y)*cos(Gimbal.z), sin(Gimbal.z), -sin(Gimbal.y)*cos(Gimbal.z));
+
+		//Runge-Kutta 4
+		s1 = Sensed(R, V, m, dir, true);
+		k1r = V; k1v = s1 + Gravity(R);
+		s2 = Sensed(R + k1r * simdt / 2.0, V + k1v * simdt / 2.0, m, dir, false);
+		k2r = V + k1v * simdt / 2.0; k2v = s2 + Gravity(R + k1r * simdt / 2.0);
+		s3 = Sensed(R + k2r * simdt / 2.0, V + k2v * simdt / 2.0, m, dir, false);
+		k3r = V + k2v * simdt / 2.0; k3v = s3 + Gravity(R + k2r * simdt / 2.0);
+		s4 = Sensed(R + k3r * simdt, V + k3v * simdt, m, dir, false);
+		k4r = V + k3v * simdt; k4v = s4 + Gravity(R + k3r * simdt);
+		R += (k1r + k2r * 2.0 + k3r * 2.0 + k4r)*simdt / 6.0;
+		V += (k1v + k2v * 2.0 + k3v * 2.0 + k4v)*simdt / 6.0;
+		PIPA += (s1 + s2 * 2.0 + s3 * 2.0 + s4)*simdt / 6.0;
+
+		//Gimbal angle errors from the attitude error the LVDC computed with the same matrix
+		A1 = cos(Gimbal.x)*cos(Gimbal.z);
+		A2 = sin(Gimbal.x);
+		A3 = sin(Gimbal.z);
+		A4 = sin(Gimbal.x)*cos(Gimbal.z);
+		A5 = cos(Gimbal.x);
+		d.y = (A5*AttErr.y - A2 * AttErr.z) / cos(Gimbal.z);
+		d.z = (A4*AttErr.y + A1 * AttErr.z) / cos(Gimbal.z);
+		d.x = AttErr.x - A3 * d.y;
+
+		//First order response with a rate limit
+		rate = d / 0.5;
+		for (i = 0;i < 3;i++)
+		{
+			if (rate.data[i] > 5.0*RAD) rate.data[i] = 5.0*RAD;
+			else if (rate.data[i] < -5.0*RAD) rate.data[i] = -5.0*RAD;
+			Gimbal.data[i] += rate.data[i] * simdt;
+			if (Gimbal.data[i] < 0.0) Gimbal.data[i] += PI2;
+			else if (Gimbal.data[i] >= PI2) Gimbal.data[i] -= PI2;
+		}
+	}
+};
+
+// ****************************************************************
+// LVDA of the point mass vehicle
+// ****************************************************************
+
+LVDA::LVDA()
+{
+	iu = NULL;
+}
+
+void LVDA::Init(IU *i)
+{
+	iu = i;
+}
+
+void LVDA::SaveState(FILEHANDLE scn)
+{
+}
+
+void LVDA::LoadState(FILEHANDLE scn)
+{
+}
+
+void LVDA::SwitchSelector(int stage, int channel)
+{
+	if (stage < 0 || stage > 3) return;
+
+	iu->SwitchSelector(stage, channel);
+}
+
+void LVDA::SetFCCAttitudeError(VECTOR3 atterr)
+{
+	iu->SetAttitudeError(atterr);
+}
+
+VECTOR3 LVDA::GetLVIMUAttitude()
+{
+	return iu->Gimbal;
+}
+
+VECTOR3 LVDA::GetTheodoliteAlignment(double azimuth)
+{
+	return iu->GetTheodoliteAlignment(azimuth);
+}
+
+void LVDA::ZeroLVIMUPIPACounters()
+{
+	iu->ZeroPIPA();
+}
+
+double LVDA::GetLVIMULastTime()
+{
+	return iu->MJD;
+}
+
+void LVDA::ZeroLVIMUCDUs()
+{
+	iu->Gimbal = _V(0, 0, 0);
+}
+
+void LVDA::ReleaseLVIMUCDUs()
+{
+}
+
+void LVDA::ReleaseLVIMU()
+{
+}
+
+void LVDA::DriveLVIMUGimbals(double x, double y, double z)
+{
+	iu->Gimbal = _V(x, y, z);
+}
+
+VECTOR3 LVDA::GetLVIMUPIPARegisters()
+{
+	return iu->GetPIPA();
+}
+
+bool LVDA::GetSIInboardEngineOut()
+{
+	return iu->stages[0].Attached && iu->stages[0].InboardOut();
+}
+
+bool LVDA::GetSIOutboardEngineOut()
+{
+	return iu->stages[0].Attached && iu->stages[0].OutboardOut();
+}
+
+bool LVDA::GetSIIInboardEngineOut()
+{
+	return false;
+}
+
+bool LVDA::GetSIIEngineOut()
+{
+	return iu->stages[1].Attached && iu->stages[1].E[0].State != ENGINE_OFF && (iu->stages[1].InboardOut() || iu->stages[1].OutboardOut());
+}
+
+bool LVDA::GetCMCSIVBIgnitionSequenceStart()
+{
+	return false;
+}
+
+bool LVDA::GetCMCSIVBCutoff()
+{
+	return false;
+}
+
+bool LVDA::GetCMCSIVBTakeover()
+{
+	return false;
+}
+
+bool LVDA::GetLVIMUFailure()
+{
+	return false;
+}
+
+bool LVDA::GetGuidanceReferenceFailure()
+{
+	if (iu->GetLVDC())
+		return iu->GetLVDC()->GetGuidanceReferenceFailure();
+
+	return false;
+}
+
+bool LVDA::SIVBInjectionDelay()
+{
+	return false;
+}
+
+bool LVDA::SCInitiationOfSIISIVBSeparation()
+{
+	return false;
+}
+
+bool LVDA::GetSIIPropellantDepletionEngineCutoff()
+{
+	return iu->stages[1].Attached && iu->stages[1].Depleted;
+}
+
+bool LVDA::SpacecraftSeparationIndication()
+{
+	return false;
+}
+
+bool LVDA::GetSIVBEngineOutA()
+{
+	return !iu->stages[2].ThrustOK(0);
+}
+
+bool LVDA::GetSIVBEngineOutB()
+{
+	return !iu->stages[2].ThrustOK(0);
+}
+
+bool LVDA::GetSIPropellantDepletionEngineCutoff()
+{
+	return iu->stages[0].Attached && iu->stages[0].Depleted;
+}
+
+bool LVDA::SIBLowLevelSensorsDry()
+{
+	return iu->stages[0].Attached && iu->stages[0].LowLevelArmed && iu->stages[0].Propellant < iu->stages[0].Data->LowLevel;
+}
+
+bool LVDA::GetLiftoff()
+{
+	return iu->Liftoff();
+}
+
+bool LVDA::GetGuidanceReferenceRelease()
+{
+	return iu->GuidanceReferenceRelease();
+}
+
+bool LVDA::GetSIVBO2H2BurnerMalfunction()
+{
+	return false;
+}
+
+bool LVDA::GetSICInboardEngineCutoff()
+{
+	return GetSIInboardEngineOut();
+}
+
+void LVDA::TLIBegun()
+{
+}
+
+void LVDA::TLIEnded()
+{
+}
+
+bool LVDA::GeneralizedSwitchSelector(int stage, int channel)
+{
+	if (iu->GetLVDC())
+		return iu->GetLVDC()->GeneralizedSwitchSelector(stage, channel);
+
+	return false;
+}
+
+bool LVDA::TimebaseUpdate(double dt)
+{
+	if (iu->GetLVDC())
+		return iu->GetLVDC()->TimebaseUpdate(dt);
+
+	return false;
+}
+
+bool LVDA::LMAbort()
+{
+	if (iu->GetLVDC())
+		return iu->GetLVDC()->LMAbort();
+
+	return false;
+}
+
+bool LVDA::RestartManeuverEnable()
+{
+	if (iu->GetLVDC())
+		return iu->GetLVDC()->RestartManeuverEnable();
+
+	return false;
+}
+
+bool LVDA::TDEEnable()
+{
+	if (iu->GetLVDC())
+		return iu->GetLVDC()->TDEEnable();
+
+	return false;
+}
+
+bool LVDA::RemoveInhibitManeuver4()
+{
+	if (iu->GetLVDC())
+		return iu->GetLVDC()->RemoveInhibitManeuver4();
+
+	return false;
+}
+
+bool LVDA::Timebase8Enable()
+{
+	if (iu->GetLVDC())
+		return iu->GetLVDC()->TimeBase8Enable();
+
+	return false;
+}
+
+bool LVDA::EvasiveManeuverEnable()
+{
+	if (iu->GetLVDC())
+		return iu->GetLVDC()->EvasiveManeuverEnable();
+
+	return false;
+}
+
+bool LVDA::ExecuteCommManeuver()
+{
+	if (iu->GetLVDC())
+		return iu->GetLVDC()->ExecuteCommManeuver();
+
+	return false;
+}
+
+bool LVDA::SIVBIULunarImpact(double tig, double dt, double pitch, double yaw)
+{
+	if (iu->GetLVDC())
+		return iu->GetLVDC()->SIVBIULunarImpact(tig, dt, pitch, yaw);
+
+	return false;
+}
+
+bool LVDA::LaunchTargetingUpdate(double V_T, double R_T, double theta_T, double inc, double dsc, double dsc_dot, double t_grr0)
+{
+	if (iu->GetLVDC())
+		return iu->GetLVDC()->LaunchTargetingUpdate(V_T, R_T, theta_T, inc, dsc, dsc_dot, t_grr0);
+
+	return false;
+}
+
+bool LVDA::NavigationUpdate(VECTOR3 DCSRVEC, VECTOR3 DCSVVEC, double DCSNUPTIM)
+{
+	if (iu->GetLVDC())
+		return iu->GetLVDC()->NavigationUpdate(DCSRVEC, DCSVVEC, DCSNUPTIM);
+
+	return false;
+}
+
+void LVDA::PrepareToLaunch()
+{
+	if (iu->GetLVDC()) iu->GetLVDC()->PrepareToLaunch();
+}
+
+int LVDA::GetStage()
+{
+	return iu->StageNo;
+}
+
+void LVDA::SetStage(int stage)
+{
+	iu->StageNo = stage;
+}
+
+int LVDA::GetVehicleNo()
+{
+	return 0;
+}
+
+void LVDA::GetRelativePos(VECTOR3 &v)
+{
+	v = tmul(iu->M, iu->R);
+}
+
+void LVDA::GetRelativeVel(VECTOR3 &v)
+{
+	v = tmul(iu->M, iu->V);
+}
+
+bool LVDA::GetSCControlPoweredFlight()
+{
+	return false;
+}
+
+void LVDA::SetOutputRegisterBit(int bit, bool state)
+{
+	DiscreteOutputRegister.set(bit, state);
+}
+
+bool LVDA::GetOutputRegisterBit(int bit)
+{
+	return DiscreteOutputRegister[bit];
+}
+
+// ****************************************************************
+// Runs the flight program on the point mass vehicle
+// ****************************************************************
+
+class LVDCAscent
+{
+public:
+	LVDCAscent(const char *dir, bool log) : root(dir), keeplog(log) {}
+
+	bool Run(bool saturnV)
+	{
+		bool ok;
+
+		if (saturnV)
+		{
+			LVDCSV l(lvda);
+			ok = Fly(&l, SaturnV, "Saturn V Default Flight Sequence Program.txt", 40418.5639, 5);
+		}
+		else
+		{
+			LVDC1B l(lvda);
+			ok = Fly(&l, Saturn1B, "Saturn IB Default Flight Sequence Program.txt", 40505.627, 4);
+		}
+		return ok;
+	}
+
+protected:
+	//Flies until the S-IVB cutoff in time base tb_cut
+	template<class L> bool Fly(L *l, const VehicleData &v, const char *fsp, double mjd_launch, int tb_cut)
+	{
+		VECTOR3 r, vel;
+		char path[512];
+		double cycle, total = 0.0, maxcycle = 0.0, t_cut = -1.0;
+		long cycles = 0;
+		int tb = -1;
+		bool ok = false, burn = false;
+
+		NavR = NavV = 0.0;
+
+		printf("%s\n", v.Name);
+
+		//Start 20 seconds before the launch time
+		lvda.Init(&iu);
+		iu.Init(v, l, mjd_launch - 20.0 / 86400.0);
+		if (keeplog)
+		{
+			l->Init();
+		}
+		else
+		{
+			//Init opens the log in the working directory
+			char cwd[512];
+			const char *tmp = getenv("TEMP");
+
+			if (tmp == NULL) tmp = getenv("TMPDIR");
+			if (tmp == NULL) tmp = "/tmp";
+			if (getcwd(cwd, sizeof(cwd)) == NULL || chdir(tmp) != 0)
+			{
+				fprintf(stderr, "Can't change to the temporary directory %s\n", tmp);
+				return false;
+			}
+			l->Init();
+			fclose(l->lvlog);
+			l->lvlog = fopen(NULL_DEVICE, "w");
+			if (chdir(cwd) != 0)
+			{
+				fprintf(stderr, "Can't change back to %s\n", cwd);
+				return false;
+			}
+		}
+		sprintf(path, "%s/Config/ProjectApollo/%s", root, fsp);
+		l->ReadFlightSequenceProgram(path);
+		iu.SetSite(l->PHI, l->KSCLNG, l->R_L);
+		l->PrepareToLaunch();
+
+		auto t0 = std::chrono::steady_clock::now();
+		while (iu.SimT < 1200.0)
+		{
+			iu.Step(LVDC_TIMESTEP);
+
+			auto tc = std::chrono::steady_clock::now();
+			l->TimeStep(LVDC_TIMESTEP);
+			cycle = std::chrono::duration<double>(std::chrono::steady_clock::now() - tc).count();
+			total += cycle;
+			if (cycle > maxcycle) maxcycle = cycle;
+			cycles++;
+
+			if (l->LVDC_Timebase != tb)
+			{
+				tb = l->LVDC_Timebase;
+				printf("  T%+8.2f  Time base %d\n", iu.T(), tb);
+				//Last navigation cycle of the powered flight
+				if (tb == tb_cut && iu.StateAt(l->LVIMUMJD, r, vel))
+				{
+					NavR = length(l->PosS - r);
+					NavV = length(l->DotS - vel);
+				}
+			}
+			if (iu.Released && iu.Altitude(iu.R) < -100.0)
+			{
+				printf("  T%+8.2f  Impact\n", iu.T());
+				break;
+			}
+			//S-IVB engine off after the first burn
+			if (iu.stages[2].ThrustOK(0)) burn = true;
+			if (t_cut < 0.0 && burn && iu.stages[2].E[0].State == ENGINE_OFF)
+			{
+				t_cut = iu.SimT;
+				iu.Event("S-IVB cutoff");
+				ok = Insertion(l);
+			}
+			if (t_cut >= 0.0 && iu.SimT > t_cut + 10.0) break;
+		}
+		double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+		if (t_cut < 0.0) printf("  No S-IVB cutoff\n");
+		printf("  Max q %.1f kPa at T%+.1f\n", iu.MaxQ / 1000.0, iu.MaxQTime);
+		printf("  %ld LVDC steps, %.2f us per step, %.1f us at most\n", cycles, total / cycles * 1e6, maxcycle*1e6);
+		printf("  %.1f s flown in %.3f s, %.0f times real time\n", iu.SimT, wall, iu.SimT / wall);
+		return ok;
+	}
+
+	template<class L> bool Insertion(L *l)
+	{
+		VECTOR3 h = crossp(iu.R, iu.V);
+		double r = length(iu.R), v = length(iu.V), gamma, inc, plane, a, e, dr, dv, dg;
+
+		gamma = asin(dotp(iu.R, iu.V) / (r*v));
+		inc = acos(dotp(unit(h), iu.Pole));
+		//Y axis of the LVDC orbital system is against the angular momentum
+		plane = acos(-dotp(unit(h), _V(l->MX_G.m21, l->MX_G.m22, l->MX_G.m23)));
+		a = 1.0 / (2.0 / r - v * v / ASC_MU);
+		e = length(crossp(iu.V, h) / ASC_MU - iu.R / r);
+
+		dr = r - l->R_T;
+		dv = v - l->V_T;
+		dg = (gamma - l->gamma_T)*DEG;
+		printf("  Radius      %10.1f km, target %10.1f km, %+8.3f km\n", r / 1000.0, l->R_T / 1000.0, dr / 1000.0);
+		printf("  Velocity    %10.2f m/s, target %10.2f m/s, %+8.3f m/s\n", v, l->V_T, dv);
+		printf("  Flight path %10.4f deg, target %10.4f deg, %+8.4f deg\n", gamma*DEG, l->gamma_T*DEG, dg);
+		printf("  Inclination %10.4f deg, target %10.4f deg, plane %.4f deg off\n", inc*DEG, l->Inclination*DEG, plane*DEG);
+		printf("  Orbit       %.1f x %.1f km\n", (a*(1.0 - e) - ASC_RE) / 1000.0, (a*(1.0 + e) - ASC_RE) / 1000.0);
+		printf("  Navigation  %.1f m, %.3f m/s off at the cutoff command\n", NavR, NavV);
+		return fabs(dr) < 2000.0 && fabs(dv) < 5.0 && fabs(dg) < 0.05 && plane*DEG < 0.05;
+	}
+
+	const char *root;
+	bool keeplog;
+	double NavR, NavV;
+	LVDA lvda;
+	IU iu;
+};
+
+int main(int argc, char *argv[])
+{
+	const char *dir = ".";
+	bool log = false, s1b = true, sv = true, ok = true;
+	int i;
+
+	for (i = 1;i < argc;i++)
+	{
+		if (!strcmp(argv[i], "-log")) log = true;
+		else if (!strcmp(argv[i], "1b")) sv = false;
+		else if (!strcmp(argv[i], "v")) s1b = false;
+		else dir = argv[i];
+	}
+
+	LVDCAscent ascent(dir, log);
+	if (s1b && !ascent.Run(false)) ok = false;
+	if (sv && !ascent.Run(true)) ok = false;
+	return !ok;
+}
@@ -0,0 +1,297 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  MCC ground station contact prediction check
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+//############################################################################//
+// Flies low Earth orbits with J2 through the MCC contact prediction and
+// counts how often the prediction is started again:
+//
+//   mcccontacts_check [<orbits>]
+//
+// The spacecraft is integrated at one second steps, which is how often
+// the MCC looks at it. Each second its state goes through
+// MCCContacts::Lookup like in MCC::TimeStep: a prediction the spacecraft
+// has left is dropped and started again, and one older than
+// MCC_CONTACTS_REFRESH is renewed. The check waits for each prediction,
+// so runs repeat. Printed per orbit are the drops, the renewals and the
+// predictions that a fixed MCC_CONTACTS_MAXDEVIATION would have dropped,
+// and the longest time a station's predicted contact differed from the
+// contact on the integrated trajectory. Passes of less than two minutes
+// only graze the horizon, where a few hundred meters move AOS and LOS by
+// seconds, and are shown apart. Every orbit is flown once more with a
+// 3 m/s burn and a 30 m/s burn, the latter a minute after a prediction.
+// The exit code is nonzero if a prediction was dropped without a burn,
+// the 30 m/s burn wasn't noticed within five minutes or a contact of a
+// longer pass was off by more than five seconds. Built on Linux for
+// example with
+//
+//   g++ -O2 -pthread -Isrc_headless -Isrc_sys -Isrc_rtccmfd -Isrc_launch
+//       -include strings.h src_headless/tools/MCCContactsCheck.cpp
+//       src_launch/MCCContacts.cpp src_rtccmfd/OrbMech.cpp
+//       src_headless/OrbiterAPI.cpp src_headless/VesselAPI.cpp
+//       src_headless/HeadlessSim.cpp -o mcccontacts_check
+//############################################################################//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "Orbitersdk.h"
+#include "OrbMech.h"
+#include "MCCContacts.h"
+
+//The orbital stations of the MCC with voice, from MCC::Init
+static const struct
+{
+	const char *Name;
+	double lat, lng;
+} Stations[] = {
+	{ "ANTIGUA", 17.137222, -61.775833 },
+	{ "ASCENSION", -7.94354, -14.37105 },
+	{ "BERMUDA", 32.36864, -64.68563 },
+	{ "GRAND CANARY", 27.74055, -15.60077 },
+	{ "HONEYSUCKLE", -35.40282, 148.98144 },
+	{ "CARNARVON", -24.90619, 113.72595 },
+	{ "CORPUS CHRISTI", 27.65273, -97.37588 },
+	{ "GOLDSTONE", 35.33820, -116.87421 },
+	{ "GRAND BAHAMA", 26.62022, -78.35825 },
+	{ "GUAM", 13.30929, 144.73694 },
+	{ "GUAYMAS", 27.95029, -110.90846 },
+	{ "HAWAII", 21.44719, -157.76307 },
+	{ "MADRID", 40.45443, -4.16990 },
+	{ "MERRIT", 28.40433, -80.60192 },
+};
+static const int NSTATIONS = sizeof(Stations) / sizeof(Stations[0]);
+
+//Earth as in Orbiter
+static const double R_E = 6.37101e6;
+static const double J2_E = 1.0826e-3;
+static const double w_E = PI2 / 86164.09;
+
+struct Orbit
+{
+	const char *Name;
+	double hp, ha, inc;
+};
+
+struct Result
+{
+	int Drops, Renewals, FixedDrops;
+	//Longest difference of contact (s) in passes of two minutes or more, and in shorter ones
+	double MaxOff, GrazeOff;
+	//Time from the last burn to the drop of the prediction, -1 if there was none
+	double Noticed;
+};
+
+//Gives the check the distance that MCCContacts::Lookup tests
+class ContactsCheck : public MCCContacts
+{
+public:
+	double Deviation(const MCCContactPrediction *p, const MCCContactState &s)
+	{
+		VECTOR3 R_CM, R_M;
+
+		Propagate(p->State, s.SimT, R_CM, R_M);
+		return length(s.R - R_CM);
+	}
+};
+
+//Earth local to global, the Earth turns east like the stations in MCCContacts
+static MATRIX3 EarthRotation(double t)
+{
+	double a = w_E * t;
+	return _M(cos(a), 0, -sin(a), 0, 1, 0, sin(a), 0, cos(a));
+}
+
+static VECTOR3 Gravity(VECTOR3 R)
+{
+	const double mu = OrbMech::mu_Earth;
+	double r = length(R);
+	double zr = R.y / r;
+
+	return -R * mu / (r*r*r) - (R*(1.0 - 5.0*zr*zr) + _V(0, 2.0*R.y, 0))*1.5*J2_E*mu*R_E*R_E / pow(r, 5.0);
+}
+
+static void Step(VECTOR3 &R, VECTOR3 &V, double h)
+{
+	VECTOR3 k1r, k1v, k2r, k2v, k3r, k3v, k4r, k4v;
+
+	k1r = V;
+	k1v = Gravity(R);
+	k2r = V + k1v * h / 2.0;
+	k2v = Gravity(R + k1r * h / 2.0);
+	k3r = V + k2v * h / 2.0;
+	k3v = Gravity(R + k2r * h / 2.0);
+	k4r = V + k3v * h;
+	k4v = Gravity(R + k3r * h);
+	R += (k1r + k2r * 2.0 + k3r * 2.0 + k4r)*h / 6.0;
+	V += (k1v + k2v * 2.0 + k3v * 2.0 + k4v)*h / 6.0;
+}
+
+static void ContactState(VECTOR3 R, VECTOR3 V, double t, MCCContactState &s)
+{
+	//The Moon is far enough from a low orbit that a straight line will do
+	s.SimT = t;
+	s.R = R;
+	s.V = V;
+	s.MoonRef = false;
+	s.R_EM = _V(cos(2.66e-6*t), 0, sin(2.66e-6*t))*3.844e8;
+	s.V_EM = _V(-sin(2.66e-6*t), 0, cos(2.66e-6*t))*1022.0;
+	s.Rot_E = EarthRotation(t);
+	s.w_E = w_E;
+	s.R_E = R_E;
+	s.R_M = 1.738e6;
+	s.mu_E = OrbMech::mu_Earth;
+	s.mu_M = OrbMech::mu_Moon;
+}
+
+//Flies n orbits like MCC::TimeStep. The burns (m/s, prograde) come after the given orbit fractions, at the first second
+//that is burnage after the prediction.
+static Result Fly(const Orbit &o, int n, int nburns, const double *burnorbit, const double *burndv, const double *burnage)
+{
+	ContactsCheck contacts;
+	MCCContactState cs;
+	const MCCContactPrediction *pred;
+	bool visible[MCC_CONTACTS_MAX], truth[MCC_CONTACTS_MAX];
+	double off[MCC_CONTACTS_MAX], passoff[MCC_CONTACTS_MAX], pass[MCC_CONTACTS_MAX];
+	VECTOR3 R, V, east, north;
+	double a, ra, rp, T, t, tburn;
+	bool fixeddrop;
+	Result res;
+	int b, i;
+
+	for (i = 0;i < NSTATIONS;i++)
+	{
+		contacts.SetStation(i, Stations[i].lat, Stations[i].lng, 2e7);
+		off[i] = passoff[i] = pass[i] = 0.0;
+	}
+
+	//Perigee over the equator at t = 0, prograde is towards -y cross R
+	rp = R_E + o.hp * 1000.0;
+	ra = R_E + o.ha * 1000.0;
+	a = (rp + ra) / 2.0;
+	R = _V(rp, 0, 0);
+	east = _V(0, 0, 1);
+	north = _V(0, 1, 0);
+	V = (east*cos(o.inc*RAD) + north * sin(o.inc*RAD))*sqrt(OrbMech::mu_Earth*(2.0 / rp - 1.0 / a));
+	T = PI2 * sqrt(a*a*a / OrbMech::mu_Earth);
+
+	res.Drops = res.Renewals = res.FixedDrops = 0;
+	res.MaxOff = res.GrazeOff = 0.0;
+	res.Noticed = -1.0;
+	tburn = -1.0;
+	fixeddrop = false;
+	b = 0;
+	for (t = 0.0;t < n * T;t += 1.0)
+	{
+		pred = contacts.GetPrediction();
+		if (b < nburns && t >= burnorbit[b] * T && t - pred->State.SimT == burnage[b])
+		{
+			V += unit(V)*burndv[b];
+			tburn = t;
+			b++;
+		}
+
+		ContactState(R, V, t, cs);
+		if (pred && !fixeddrop && contacts.Deviation(pred, cs) > MCC_CONTACTS_MAXDEVIATION)
+		{
+			res.FixedDrops++;
+			fixeddrop = true;
+		}
+		if (contacts.Lookup(pred, cs, visible))
+		{
+			if (cs.SimT > pred->State.SimT + MCC_CONTACTS_REFRESH)
+			{
+				contacts.Predict(cs);
+				contacts.Wait();
+				fixeddrop = false;
+				res.Renewals++;
+			}
+		}
+		else
+		{
+			if (pred)
+			{
+				res.Drops++;
+				if (tburn >= 0.0) res.Noticed = t - tburn;
+			}
+			contacts.Visibility(cs, cs.SimT, visible);
+			contacts.Predict(cs);
+			contacts.Wait();
+			fixeddrop = false;
+		}
+
+		//At the time of the state the contacts are exact
+		contacts.Visibility(cs, cs.SimT, truth);
+		for (i = 0;i < NSTATIONS;i++)
+		{
+			//A pass lasts while either the prediction or the trajectory has contact
+			if (visible[i] || truth[i])
+			{
+				pass[i] += 1.0;
+				off[i] = visible[i] != truth[i] ? off[i] + 1.0 : 0.0;
+				if (off[i] > passoff[i]) passoff[i] = off[i];
+			}
+			else if (pass[i] > 0.0)
+			{
+				if (pass[i] >= 120.0) res.MaxOff = max(res.MaxOff, passoff[i]);
+				else res.GrazeOff = max(res.GrazeOff, passoff[i]);
+				off[i] = passoff[i] = pass[i] = 0.0;
+			}
+		}
+
+		Step(R, V, 1.0);
+	}
+	return res;
+}
+
+int main(int argc, char *argv[])
+{
+	const Orbit orbits[] = {
+		{ "Parking orbit 185 km, 32.5 deg", 185.0, 185.0, 32.5 },
+		{ "Apollo 7 type 230 x 300 km, 31.6 deg", 230.0, 300.0, 31.6 },
+		{ "Polar 200 km, 88 deg", 200.0, 200.0, 88.0 },
+	};
+	const double burnorbit[] = { 1.3, 2.6 };
+	const double burndv[] = { 3.0, 30.0 };
+	const double burnage[] = { 300.0, 60.0 };
+	Result r;
+	int n = 6, k, errors = 0;
+
+	if (argc > 1) n = atoi(argv[1]);
+	if (n < 3) n = 3;
+
+	printf("%-38s %-8s %8s %8s %8s %8s %8s %8s\n", "", "", "drops", "renewed", "5 km", "off (s)", "grazing", "noticed");
+	printf("%-38s %-8s %8s %8s %8s %8s %8s %8s\n", "", "", "/orbit", "/orbit", "/orbit", "max", "off (s)", "(s)");
+	for (k = 0;k < (int)(sizeof(orbits) / sizeof(orbits[0]));k++)
+	{
+		r = Fly(orbits[k], n, 0, NULL, NULL, NULL);
+		printf("%-38s %-8s %8.2f %8.2f %8.2f %8.0f %8.0f %8s\n", orbits[k].Name, "coast", (double)r.Drops / n, (double)r.Renewals / n,
+			(double)r.FixedDrops / n, r.MaxOff, r.GrazeOff, "");
+		if (r.Drops > 0 || r.MaxOff > 5.0) errors++;
+
+		r = Fly(orbits[k], n, 2, burnorbit, burndv, burnage);
+		printf("%-38s %-8s %8.2f %8.2f %8.2f %8.0f %8.0f %8.0f\n", "", "2 burns", (double)r.Drops / n, (double)r.Renewals / n,
+			(double)r.FixedDrops / n, r.MaxOff, r.GrazeOff, r.Noticed);
+		if (r.Noticed < 0.0 || r.Noticed > 300.0 || r.MaxOff > 5.0) errors++;
+	}
+	return errors;
+}
@@ -0,0 +1,167 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  RTCC MFD page model benchmark
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+//############################################################################//
+// Draws a page like the RTCC MFD tables, 20 rows of a time and five values,
+// for a number of refreshes:
+//
+//   mfdpage_bench [<refreshes>] [<changed rows>]
+//
+// On each refresh the given number of rows get new values, the rest stay
+// the same as on a quiet display. The page is recorded once with every line
+// formatted, as before the page model, and once through a page kept between
+// refreshes. The plain text of both is compared after every refresh and the
+// last page is printed. Built on Linux for example with
+//
+//   g++ -O2 -Isrc_rtccmfd src_headless/tools/MFDPageBench.cpp
+//       src_rtccmfd/MFDPage.cpp -o mfdpage_bench
+//############################################################################//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <chrono>
+#include <random>
+#include "MFDPage.h"
+
+#define ROWS 20
+
+struct TableRow
+{
+	double GET;
+	double DV, Pitch, Yaw, HA, HP;
+	int Code;
+};
+
+class BenchDisplay
+{
+public:
+	BenchDisplay() : W(512), H(512) {}
+
+	void GET_Display(char *Buff, double time, bool DispGET)
+	{
+		double time2 = round(time);
+		sprintf(Buff, "%03.0f:%02.0f:%02.0f", floor(time2 / 3600.0), floor(fmod(time2, 3600.0) / 60.0), fmod(time2, 60.0));
+		if (DispGET) strcat(Buff, " GET");
+	}
+
+	//Every line formatted, like the MFD before the page model
+	void DrawFormatted(MFDPage &page, const TableRow *rows)
+	{
+		char Buffer[100];
+		int i;
+
+		page.Text(4 * W / 8, 1 * H / 32, "DIGITALS TABLE", 14);
+		for (i = 0;i < ROWS;i++)
+		{
+			GET_Display(Buffer, rows[i].GET, false);
+			page.Text(1 * W / 32, (4 + i) * H / 32, Buffer, strlen(Buffer));
+			sprintf(Buffer, "%+07.1f", rows[i].DV / 0.3048);
+			page.Text(8 * W / 32, (4 + i) * H / 32, Buffer, strlen(Buffer));
+			sprintf(Buffer, "%+06.2f", rows[i].Pitch);
+			page.Text(13 * W / 32, (4 + i) * H / 32, Buffer, strlen(Buffer));
+			sprintf(Buffer, "%+06.2f", rows[i].Yaw);
+			page.Text(17 * W / 32, (4 + i) * H / 32, Buffer, strlen(Buffer));
+			sprintf(Buffer, "%.1f/%.1f", rows[i].HA / 1852.0, rows[i].HP / 1852.0);
+			page.Text(21 * W / 32, (4 + i) * H / 32, Buffer, strlen(Buffer));
+			sprintf(Buffer, "%d", rows[i].Code);
+			page.Text(29 * W / 32, (4 + i) * H / 32, Buffer, strlen(Buffer));
+		}
+	}
+
+	//Through the page model
+	void DrawCached(MFDPage &page, const TableRow *rows)
+	{
+		int i;
+
+		page.Text(4 * W / 8, 1 * H / 32, "DIGITALS TABLE", 14);
+		for (i = 0;i < ROWS;i++)
+		{
+			page.Format(1 * W / 32, (4 + i) * H / 32, this, &BenchDisplay::GET_Display, rows[i].GET, false);
+			page.Printf(8 * W / 32, (4 + i) * H / 32, "%+07.1f", rows[i].DV / 0.3048);
+			page.Printf(13 * W / 32, (4 + i) * H / 32, "%+06.2f", rows[i].Pitch);
+			page.Printf(17 * W / 32, (4 + i) * H / 32, "%+06.2f", rows[i].Yaw);
+			page.Printf(21 * W / 32, (4 + i) * H / 32, "%.1f/%.1f", rows[i].HA / 1852.0, rows[i].HP / 1852.0);
+			page.Printf(29 * W / 32, (4 + i) * H / 32, "%d", rows[i].Code);
+		}
+	}
+
+	int W, H;
+};
+
+int main(int argc, char *argv[])
+{
+	std::mt19937 gen(1);
+	std::uniform_real_distribution<double> unit(0.0, 1.0);
+	TableRow rows[ROWS];
+	BenchDisplay d;
+	MFDPage formatted, cached;
+	double t1 = 0.0, t2 = 0.0;
+	long long lines = 0;
+	int refreshes = 10000, changed = 1, i, k, wrong = 0;
+
+	if (argc > 1) refreshes = atoi(argv[1]);
+	if (argc > 2) changed = atoi(argv[2]);
+
+	for (i = 0;i < ROWS;i++)
+	{
+		rows[i].GET = 3600.0*(10.0 + i);
+		rows[i].DV = 30.0*unit(gen);
+		rows[i].Pitch = 360.0*unit(gen) - 180.0;
+		rows[i].Yaw = 360.0*unit(gen) - 180.0;
+		rows[i].HA = 200000.0 + 1e5*unit(gen);
+		rows[i].HP = 100000.0 + 1e5*unit(gen);
+		rows[i].Code = i + 1;
+	}
+
+	for (k = 0;k < refreshes;k++)
+	{
+		for (i = 0;i < changed && i < ROWS;i++)
+		{
+			TableRow &r = rows[(k + i) % ROWS];
+			r.GET += 1.0;
+			r.DV += 0.01;
+			r.Pitch = 360.0*unit(gen) - 180.0;
+		}
+
+		auto t0 = std::chrono::steady_clock::now();
+		formatted.Begin(0);
+		d.DrawFormatted(formatted, rows);
+		auto t = std::chrono::steady_clock::now();
+		cached.Begin(0);
+		d.DrawCached(cached, rows);
+		auto tc = std::chrono::steady_clock::now();
+
+		t1 += std::chrono::duration<double>(t - t0).count();
+		t2 += std::chrono::duration<double>(tc - t).count();
+		lines += cached.Formatted();
+		if (formatted.RenderText(d.W, d.H, 64, 32) != cached.RenderText(d.W, d.H, 64, 32)) wrong++;
+	}
+
+	printf("%s", cached.RenderText(d.W, d.H, 64, 32).c_str());
+	printf("%d refreshes of %d lines, %d rows changed per refresh\n", refreshes, cached.Commands(), changed);
+	printf("  all lines formatted  %8.3f us per refresh\n", t1 / refreshes * 1e6);
+	printf("  page model           %8.3f us per refresh, %.1f lines formatted\n", t2 / refreshes * 1e6, (double)lines / refreshes);
+	printf("  %d refreshes with different text\n", wrong);
+	return wrong > 0;
+}
@@ -0,0 +1,369 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  Patch point kernel benchmark
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+//############################################################################//
+// Compares the patch point kernel of the TLMCC processor with the iteration
+// it replaced and times both:
+//
+//   patchpoint_bench [<trajectories>]
+//
+// A Sun/Moon ephemeris is generated like the RTCC does at startup. Random
+// translunar ellipses are patched into the Moon sphere of influence, and the
+// Moon relative conics patched back out, with the first guess of RBETA like
+// TLMCCProcessor::PATCH. The old iteration calls the ephemeris on every
+// step, like EPHEM did. The kernel reads the Moon from a spline sampled once.
+// Both are also started from poor first guesses. The spline is compared with
+// the ephemeris as well. Built on Linux for example with
+//
+//   g++ -O2 -Isrc_headless -Isrc_sys -Isrc_rtccmfd -include strings.h
+//       src_headless/tools/PatchPointBench.cpp src_rtccmfd/PatchPointKernel.cpp
+//       src_rtccmfd/SunMoonEphemeris.cpp src_rtccmfd/OrbMech.cpp
+//       src_headless/OrbiterAPI.cpp src_headless/VesselAPI.cpp
+//       src_headless/HeadlessSim.cpp -o patchpoint_bench
+//############################################################################//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <chrono>
+#include <random>
+#include <vector>
+#include "Orbitersdk.h"
+#include "OrbMech.h"
+#include "SunMoonEphemeris.h"
+#include "PatchPointKernel.h"
+
+static const double MJD0 = 40418.0;
+static const double R_E = OrbMech::R_Earth;
+static const double mu_E = OrbMech::mu_Earth;
+static const double mu_M = OrbMech::mu_Moon;
+
+static SunMoonEphemeris MDGSUN;
+static long long EphemCalls = 0;
+
+//Like RTCC::PLEFEM
+static bool EPHEM(double GMT, VECTOR3 &R_EM, VECTOR3 &V_EM)
+{
+	VECTOR3 R_ES;
+
+	EphemCalls++;
+	if (MDGSUN.Evaluate(MJD0 + GMT / 86400.0, R_EM, V_EM, R_ES)) return true;
+	R_EM = R_EM * OrbMech::R_Earth;
+	V_EM = V_EM * OrbMech::R_Earth / 3600.0;
+	return false;
+}
+
+//TLMCCProcessor::RBETA
+static bool RBETA(VECTOR3 R0, VECTOR3 V0, double r, int Q, double mu, double &beta)
+{
+	double D0, r0, v0, ainv, e, QD, D0sign;
+
+	QD = Q == -1 ? -1.0 : 1.0;
+	r0 = length(R0);
+	v0 = length(V0);
+	D0 = dotp(R0, V0);
+	D0sign = D0 >= 0 ? 1.0 : -1.0;
+	ainv = 2.0 / r0 - v0 * v0 / mu;
+	e = sqrt(pow(1.0 - r0 * ainv, 2) + D0 * D0*ainv / mu);
+	if (e < 0.000001) return true;
+
+	if (ainv < 0)
+	{
+		double cosh_H0 = 1.0 / e * (1.0 - r0 * ainv);
+		double cosh_H = 1.0 / e * (1.0 - r * ainv);
+		double H0 = cosh_H0 < 1.0 ? 0.0 : D0sign * log(cosh_H0 + sqrt(cosh_H0 * cosh_H0 - 1.0));
+		if (cosh_H * cosh_H - 1.0 < 0) return true;
+		double H = log(cosh_H + sqrt(cosh_H * cosh_H - 1.0));
+		beta = QD * fabs(H0 - QD * H)*sqrt(fabs(1.0 / ainv));
+	}
+	else
+	{
+		double cos_E0 = 1.0 / e * (1.0 - r0 * ainv);
+		double cos_E = 1.0 / e * (1.0 - r * ainv);
+		double E0 = D0sign * atan2(sqrt(fmax(0.0, 1.0 - cos_E0 * cos_E0)), cos_E0);
+		if (1.0 - cos_E * cos_E < 0) return true;
+		double E = atan2(sqrt(1.0 - cos_E * cos_E), cos_E);
+		beta = QD * fabs(E0 - QD * E)*sqrt(1.0 / ainv);
+	}
+	return false;
+}
+
+//TLMCCProcessor::XBETA
+static void XBETA(VECTOR3 R0, VECTOR3 V0, double GMT0, double beta, double mu, VECTOR3 &RF, VECTOR3 &VF, double &GMTF)
+{
+	double D0, r0, v0, ainv, a, F1, F2, F3, F4, t, r, f, g, fdot, gdot;
+
+	r0 = length(R0);
+	v0 = length(V0);
+	D0 = dotp(R0, V0);
+	ainv = 2.0 / r0 - v0 * v0 / mu;
+	a = -beta * beta*ainv;
+	F1 = OrbMech::stumpS(-a);
+	F2 = OrbMech::stumpC(-a);
+	F3 = a * F1 + 1.0;
+	F4 = a * F2 + 1.0;
+	t = (beta*beta*F1 + D0 * beta*F2 / sqrt(mu) + r0 * F3)*beta / sqrt(mu);
+	GMTF = GMT0 + t;
+	r = (D0*F3 / sqrt(mu) + beta * F2)*beta + r0 * F4;
+	f = 1.0 - beta * beta*F2 / r0;
+	g = t - pow(beta, 3)*F1 / sqrt(mu);
+	fdot = -sqrt(mu)*beta*F3 / (r0 * r);
+	gdot = 1.0 - beta * beta*F2 / r;
+	RF = R0 * f + V0 * g;
+	VF = R0 * fdot + V0 * gdot;
+}
+
+//The iteration of TLMCCProcessor::PATCH before the kernel. Returns the last distance ratio error.
+static double PATCH_old(VECTOR3 R, VECTOR3 V, double GMT, double beta, int KREF, double mu1, double mu2, double Ratio_desired, VECTOR3 &R2, VECTOR3 &V2, double &GMTF, bool &err)
+{
+	VECTOR3 R_EM, V_EM, R1, V1, R21, A2;
+	double r1, r2, r21, d1, d2, v12, v22, DRatioDBeta, DDRatioDDBeta, Ratio, DRatio = 0.0, dbeta;
+	int i = 0;
+
+	err = false;
+	do
+	{
+		XBETA(R, V, GMT, beta, mu1, R1, V1, GMTF);
+		if (EPHEM(GMTF, R_EM, V_EM))
+		{
+			err = true;
+			return DRatio;
+		}
+		if (KREF == 1)
+		{
+			R2 = R1 - R_EM;
+			V2 = V1 - V_EM;
+			R21 = R_EM;
+		}
+		else
+		{
+			R2 = R1 + R_EM;
+			V2 = V1 + V_EM;
+			R21 = -R_EM;
+		}
+		r1 = length(R1);
+		r2 = length(R2);
+		Ratio = r2 / r1;
+		DRatio = Ratio_desired - Ratio;
+		if (fabs(DRatio) < 10e-12)
+		{
+			break;
+		}
+		r21 = length(R21);
+		d1 = dotp(R1, V1);
+		d2 = dotp(R2, V2);
+		v12 = dotp(V1, V1);
+		v22 = dotp(V2, V2);
+		A2 = -R1 * mu1 / pow(r1, 3) + R21 * (mu1 + mu2) / pow(r21, 3);
+		DRatioDBeta = 1.0 / r2 / sqrt(mu1)*(d2 - r2 * r2*d1 / r1 / r1);
+		DDRatioDDBeta = r1 / mu1 * (v22 + dotp(R2, A2)) / r2 - d1 * d2 / (mu1*r1*r2) - d2 * d2*r1 / (mu1*pow(r2, 3)) - r2 * v12 / r1 / mu1 + r2 / r1 / r1 + 2.0*d1*d1*r2 / (mu1*pow(r1, 3));
+		if (DRatioDBeta*DRatioDBeta + 2.0*DRatio*DDRatioDDBeta < 0)
+		{
+			DDRatioDDBeta = 0.0;
+		}
+		dbeta = 2.0*DRatio / (DRatioDBeta + DRatioDBeta / fabs(DRatioDBeta)*sqrt(DRatioDBeta*DRatioDBeta + 2.0*DRatio*DDRatioDDBeta));
+		beta = beta + dbeta;
+		i++;
+	} while (i < 10);
+
+	return DRatio;
+}
+
+struct PatchCase
+{
+	VECTOR3 R, V;
+	double GMT, beta;
+	int KREF;
+};
+
+struct PatchResult
+{
+	VECTOR3 R, V;
+	double GMT, DRatio;
+	bool err;
+};
+
+static double Seconds(std::chrono::steady_clock::time_point t0)
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+}
+
+int main(int argc, char *argv[])
+{
+	std::mt19937 gen(1);
+	std::uniform_real_distribution<double> rnd(0.0, 1.0);
+	std::vector<PatchCase> cases;
+	MoonStateSpline spline;
+	VECTOR3 R_EM, V_EM, R_S, V_S;
+	double maxdr = 0.0, maxdv = 0.0;
+	int n = 2000, i, j, k, m;
+
+	if (argc > 1) n = atoi(argv[1]);
+
+	if (MDGSUN.Generate(MJD0, MJD0 + 20.0))
+	{
+		printf("Ephemeris can't be generated\n");
+		return 1;
+	}
+	spline.SetSource(EPHEM);
+
+	//
+	// Spline against the ephemeris
+	//
+
+	for (i = 0;i < 100000;i++)
+	{
+		double GMT = (1.0 + 14.0*rnd(gen))*86400.0;
+		EPHEM(GMT, R_EM, V_EM);
+		spline.Evaluate(GMT, R_S, V_S);
+		maxdr = fmax(maxdr, length(R_S - R_EM));
+		maxdv = fmax(maxdv, length(V_S - V_EM));
+	}
+	printf("Moon spline, %d nodes: largest error %.4f m, %.3e m/s\n", spline.GetNumNodes(), maxdr, maxdv);
+
+	//
+	// Translunar ellipses with the apogee near the Moon, from 10 to 35 Er out
+	//
+
+	while ((int)cases.size() < n)
+	{
+		PatchCase c;
+		VECTOR3 u_M, P, Q, N;
+		double T_a, rp, ra, a, e, p, r, theta, E, t_p, off;
+
+		T_a = (6.0 + 8.0*rnd(gen))*86400.0;
+		EPHEM(T_a, R_EM, V_EM);
+		u_M = unit(R_EM);
+		N = unit(crossp(R_EM, V_EM));
+		N = unit(N + _V(rnd(gen) - 0.5, rnd(gen) - 0.5, rnd(gen) - 0.5)*0.4);
+		N = unit(N - u_M * dotp(N, u_M));
+		off = (rnd(gen) - 0.5)*10.0*RAD;
+		P = -(u_M*cos(off) + crossp(N, u_M)*sin(off));
+		Q = crossp(N, P);
+
+		rp = R_E + 185000.0;
+		ra = length(R_EM)*(1.0 + 0.1*rnd(gen));
+		a = (rp + ra) / 2.0;
+		e = (ra - rp) / (ra + rp);
+		p = a * (1.0 - e * e);
+		r = (10.0 + 25.0*rnd(gen))*R_E;
+		theta = acos((p / r - 1.0) / e);
+		E = 2.0*atan(sqrt((1.0 - e) / (1.0 + e))*tan(theta / 2.0));
+		t_p = (E - e * sin(E)) / sqrt(mu_E / (a*a*a));
+
+		c.R = (P*cos(theta) + Q * sin(theta))*r;
+		c.V = (-P * sin(theta) + Q * (e + cos(theta)))*sqrt(mu_E / p);
+		c.GMT = T_a - PI * sqrt(a*a*a / mu_E) + t_p;
+		c.KREF = 1;
+		if (RBETA(c.R, c.V, 40.0*R_E, 1, mu_E, c.beta)) continue;
+		cases.push_back(c);
+	}
+
+	//
+	// Patch in, then the Moon conics out from half an hour behind the patch point
+	//
+
+	PatchResult res;
+	bool err;
+
+	for (i = 0;i < n;i++)
+	{
+		PatchCase c = cases[i];
+		res.DRatio = PATCH_old(c.R, c.V, c.GMT, c.beta, 1, mu_E, mu_M, 0.275, res.R, res.V, res.GMT, err);
+		if (err || fabs(res.DRatio) > 1e-9) continue;
+		XBETA(res.R, res.V, res.GMT, 1800.0*sqrt(mu_M) / length(res.R), mu_M, c.R, c.V, c.GMT);
+		c.KREF = 2;
+		if (RBETA(c.R, c.V, 10.0*R_E, 1, mu_M, c.beta)) continue;
+		cases.push_back(c);
+	}
+
+	printf("%d translunar and %d Moon relative conics\n\n", n, (int)cases.size() - n);
+	printf("The reference is the old iteration from the first guess.\n");
+	printf("                  same root  other root  not conv.  errors  us/patch  ephemeris calls\n");
+
+	std::vector<PatchResult> ref;
+
+	for (j = 0;j < 3;j++)
+	{
+		//First guess, then half of it and 130%
+		double scale = j == 0 ? 1.0 : (j == 1 ? 0.5 : 1.3);
+
+		printf("guess x %.1f\n", scale);
+		for (k = 0;k < 2;k++)
+		{
+			std::vector<PatchResult> out(cases.size());
+			int same = 0, other = 0, bad = 0, errors = 0;
+			long long calls = 0;
+			double t, tmin = 1e10, dr = 0.0;
+
+			//Best of five
+			for (m = 0;m < 5;m++)
+			{
+				//The spline starts out empty, like in each TLMCC run
+				spline.SetSource(EPHEM);
+				EphemCalls = 0;
+				auto t0 = std::chrono::steady_clock::now();
+				for (i = 0;i < (int)cases.size();i++)
+				{
+					const PatchCase &c = cases[i];
+					PatchResult &r = out[i];
+					double mu1 = c.KREF == 1 ? mu_E : mu_M, mu2 = c.KREF == 1 ? mu_M : mu_E, ratio = c.KREF == 1 ? 0.275 : 1.0 / 0.275;
+
+					if (k == 0)
+					{
+						r.DRatio = PATCH_old(c.R, c.V, c.GMT, c.beta*scale, c.KREF, mu1, mu2, ratio, r.R, r.V, r.GMT, r.err);
+					}
+					else
+					{
+						PatchPointKernel kernel(spline);
+						r.err = kernel.Solve(c.R, c.V, c.GMT, c.beta*scale, c.KREF, mu1, mu2, ratio, r.R, r.V, r.GMT);
+						r.DRatio = kernel.GetError();
+					}
+				}
+				t = Seconds(t0);
+				if (t < tmin) tmin = t;
+				calls = EphemCalls;
+			}
+			if (ref.empty()) ref = out;
+
+			for (i = 0;i < (int)cases.size();i++)
+			{
+				if (out[i].err) errors++;
+				else if (fabs(out[i].DRatio) > 1e-9) bad++;
+				else if (ref[i].err || length(out[i].R - ref[i].R) > 1000.0) other++;
+				else
+				{
+					same++;
+					dr = fmax(dr, length(out[i].R - ref[i].R));
+				}
+			}
+			printf("  %-14s %8d  %8d  %8d  %8d  %8.3f  %lld\n", k == 0 ? "old iteration" : "kernel", same, other, bad, errors, tmin / cases.size() * 1e6, calls);
+			if (k == 1 && j == 0)
+			{
+				printf("  %-14s largest difference to the reference %.3f m\n", "", dr);
+			}
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,246 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  Near Earth return to Earth tradeoff benchmark
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+//############################################################################//
+// Runs the abort time loop of the near Earth return to Earth tradeoff
+// (ConicRTEEarthNew) on the Apollo 11 state before MCC-2 and times it on one
+// thread and on all threads:
+//
+//   rte_earth_bench [<orbiter dir>] [<threads>] [<runs>]
+//
+// The RTCC and the CSM state are loaded like in TLMCCScanBench. The state
+// vector array is built like RTCC::PMMREAP does for MED F70: an ephemeris of
+// the CSM from the anchor vector to 24 hours later, with one ConicRTEEarthNew
+// abort time per ephemeris point. The tradeoff runs in ATP mode to the first
+// ATP line of the RTCC (Mid-Pacific). Every run times the best of <runs>
+// calls of MAIN (default 3) and both runs have to give the same tradeoff
+// points and discrete solution.
+// Built on Linux for example with
+//
+//   g++ -O2 -pthread -fpermissive -Isrc_headless -Isrc_headless/posix
+//       -Isrc_aux -Isrc_sys -Isrc_mfd -Isrc_lm -Isrc_moon -Isrc_csm
+//       -Isrc_launch -Isrc_landing -Isrc_saturn -Isrc_rtccmfd
+//       -include strings.h src_headless/tools/RTEEarthBench.cpp
+//       src_launch/rtcc.cpp src_rtccmfd/CSMLMGuidanceSim.cpp
+//       src_rtccmfd/CoastNumericalIntegrator.cpp
+//       src_rtccmfd/EnckeIntegrator.cpp src_rtccmfd/EntryCalculations.cpp
+//       src_rtccmfd/EntryDispersion.cpp src_rtccmfd/GeneralizedIterator.cpp
+//       src_rtccmfd/LDPP.cpp src_rtccmfd/LMGuidanceSim.cpp
+//       src_rtccmfd/LOITargeting.cpp src_rtccmfd/LWP.cpp
+//       src_rtccmfd/OrbMech.cpp src_rtccmfd/PatchPointKernel.cpp
+//       src_rtccmfd/RTCCModule.cpp src_rtccmfd/ReentryNumericalIntegrator.cpp
+//       src_rtccmfd/SunMoonEphemeris.cpp src_rtccmfd/TLIGuidanceSim.cpp
+//       src_rtccmfd/TLMCC.cpp src_rtccmfd/rtcc_intermediate_library_programs.cpp
+//       src_rtccmfd/rtcc_library_programs.cpp src_sys/ScenarioCodec.cpp
+//       src_headless/OrbiterAPI.cpp src_headless/VesselAPI.cpp
+//       src_headless/HeadlessSim.cpp -o rte_earth_bench
+//
+// and run from anywhere with the Orbiter directory as the first argument.
+//############################################################################//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "Orbitersdk.h"
+#include "HeadlessSim.h"
+#include "rtcc.h"
+#include "EntryCalculations.h"
+
+static const char *Scenario = "Scenarios/Project Apollo - NASSP/Apollo - Mission Scenarios/Apollo 11/Apollo 11 - 06 - Before MCC-2 T+26h30min.scn";
+
+//Simulation date, position and velocity of the first ship and the line after RTCC_BEGIN
+static bool ReadScenario(const char *path, double &MJD, VECTOR3 &R, VECTOR3 &V, int &rtccline)
+{
+	FILE *f = fopen(path, "rt");
+	char line[1024];
+	int n = 0, found = 0;
+
+	if (f == NULL) return false;
+	rtccline = -1;
+	while (fgets(line, sizeof(line), f))
+	{
+		char *l = line;
+		n++;
+		while (*l == ' ' || *l == '\t') l++;
+		if (!(found & 1) && sscanf(l, "Date MJD %lf", &MJD) == 1) found |= 1;
+		else if (!(found & 2) && sscanf(l, "RPOS %lf %lf %lf", &R.x, &R.y, &R.z) == 3) found |= 2;
+		else if (!(found & 4) && sscanf(l, "RVEL %lf %lf %lf", &V.x, &V.y, &V.z) == 3) found |= 4;
+		else if (strncmp(l, RTCC_START_STRING, strlen(RTCC_START_STRING)) == 0)
+		{
+			rtccline = n;
+			break;
+		}
+	}
+	fclose(f);
+	return found == 7 && rtccline > 0;
+}
+
+static bool SameSolution(const ConicRTEEarthNew &a, const ConicRTEEarthNew &b)
+{
+	unsigned i;
+
+	if (a.TOData.size() != b.TOData.size()) return false;
+	for (i = 0;i < a.TOData.size();i++)
+	{
+		if (a.TOData[i].lat != b.TOData[i].lat || a.TOData[i].T0 != b.TOData[i].T0 || a.TOData[i].T_Z != b.TOData[i].T_Z || a.TOData[i].DV != b.TOData[i].DV) return false;
+	}
+	return a.SolData.NOSOLN == b.SolData.NOSOLN;
+}
+
+//Best time of a number of calls of MAIN, on a fresh processor each
+static double Run(RTCC *rtcc, std::vector<EphemerisData> &svarray, const std::vector<ATPData> &line, unsigned threads, int runs, ConicRTEEarthNew &out)
+{
+	double best = 0.0, t;
+	int i;
+
+	for (i = 0;i < runs;i++)
+	{
+		ConicRTEEarthNew rteproc(rtcc, svarray);
+		rteproc.READ(4, rtcc->SystemParameters.GMTBASE, rtcc->PZREAP.TZMIN, rtcc->PZREAP.TZMAX);
+		rteproc.Init(rtcc->PZREAP.DVMAX, 1, rtcc->PZREAP.IRMAX, rtcc->PZREAP.VRMAX, rtcc->PZREAP.RRBIAS, rtcc->PZREAP.TGTLN);
+		rteproc.ATP(line);
+		rteproc.MaxThreads = threads;
+
+		auto t0 = std::chrono::steady_clock::now();
+		rteproc.MAIN();
+		t = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+		if (i == 0 || t < best) best = t;
+		if (i == runs - 1)
+		{
+			out.TOData = rteproc.TOData;
+			out.SolData = rteproc.SolData;
+		}
+	}
+	return best;
+}
+
+int main(int argc, char *argv[])
+{
+	const char *root = argc > 1 ? argv[1] : ".";
+	unsigned threads = argc > 2 ? atoi(argv[2]) : 0;
+	int runs = argc > 3 ? atoi(argv[3]) : 3;
+	EphemerisData sv0;
+	VECTOR3 R, V;
+	double MJD, t[2];
+	int rtccline, i, k;
+	char *line;
+
+	if (runs < 1) runs = 1;
+
+	//The RTCC opens its files relative to the Orbiter directory
+	if (chdir(root))
+	{
+		printf("Can't change to %s\n", root);
+		return 1;
+	}
+	HeadlessSim::Instance().SetRootDir(".");
+	if (!ReadScenario(Scenario, MJD, R, V, rtccline))
+	{
+		printf("Can't read %s\n", Scenario);
+		return 1;
+	}
+
+	RTCC *rtcc = new RTCC();
+	FILEHANDLE scn = oapiOpenFile(Scenario, FILE_IN, ROOT);
+	for (i = 0;i < rtccline;i++)
+	{
+		oapiReadScenario_nextline(scn, line);
+	}
+	rtcc->LoadState(scn);
+	oapiCloseFile(scn, FILE_IN);
+
+	//Like RTCC::StateVectorCalcEphem, the CSM is in the Earth sphere of influence
+	sv0.R = _V(R.x, R.z, R.y);
+	sv0.V = _V(V.x, V.z, V.y);
+	sv0.GMT = OrbMech::GETfromMJD(MJD, rtcc->SystemParameters.GMTBASE);
+	sv0.RBI = BODY_EARTH;
+
+	//Ephemeris like RTCC::PMMREAP
+	EphemerisDataTable EPHEM;
+	EMSMISSInputTable in;
+
+	in.AnchorVector = sv0;
+	in.CutoffIndicator = 3;
+	in.EarthRelStopParam = 400000.0*0.3048;
+	in.EphemerisBuildIndicator = true;
+	in.EphemerisLeftLimitGMT = sv0.GMT;
+	in.EphemerisRightLimitGMT = sv0.GMT + 24.0*3600.0;
+	in.EphemTableIndicator = &EPHEM;
+	in.ManCutoffIndicator = 2;
+	in.ManeuverIndicator = false;
+	in.MoonRelStopParam = 0.0;
+	in.StopParamRefFrame = 2;
+	in.VehicleCode = RTCC_MPT_CSM;
+	rtcc->EMSMISS(in);
+
+	//First ATP line
+	std::vector<ATPData> atp;
+	ATPData data;
+	for (i = 0;i < 5;i++)
+	{
+		if (rtcc->PZREAP.ATPCoordinates[0][i * 2] > 1e8) break;
+		data.lat = rtcc->PZREAP.ATPCoordinates[0][i * 2];
+		data.lng = rtcc->PZREAP.ATPCoordinates[0][i * 2 + 1];
+		atp.push_back(data);
+	}
+
+	printf("CSM at GET %.3f h, %d abort times to GET %.3f h, %d ATP points\n\n", rtcc->GETfromGMT(sv0.GMT) / 3600.0, (int)EPHEM.table.size(),
+		EPHEM.table.size() ? rtcc->GETfromGMT(EPHEM.table.back().GMT) / 3600.0 : 0.0, (int)atp.size());
+	if (EPHEM.table.empty())
+	{
+		printf("No ephemeris\n");
+		return 1;
+	}
+
+	std::vector<EphemerisData> svarray = EPHEM.table;
+	ConicRTEEarthNew res[2] = { ConicRTEEarthNew(rtcc, svarray), ConicRTEEarthNew(rtcc, svarray) };
+
+	for (k = 0;k < 2;k++)
+	{
+		t[k] = Run(rtcc, svarray, atp, k == 0 ? 1 : threads, runs, res[k]);
+		printf("%-12s %8.3f s  %d tradeoff points\n", k == 0 ? "one thread" : "all threads", t[k], (int)res[k].TOData.size());
+	}
+	if (!SameSolution(res[0], res[1]))
+	{
+		printf("The runs give different solutions\n");
+		return 1;
+	}
+	printf("speedup %.2f, same solutions on both runs\n\n", t[0] / t[1]);
+
+	printf("  GET abort  GET landing   DV (ft/s)  lat (deg)\n");
+	k = res[1].TOData.size() > 20 ? (int)res[1].TOData.size() / 20 : 1;
+	for (i = 0;i < (int)res[1].TOData.size();i += k)
+	{
+		const TradeoffData &d = res[1].TOData[i];
+		//Abort and landing times are GMT in hours
+		printf("%11.3f  %11.3f  %10.1f  %9.2f\n", rtcc->GETfromGMT(d.T0*3600.0) / 3600.0, rtcc->GETfromGMT(d.T_Z*3600.0) / 3600.0, d.DV, d.lat);
+	}
+
+	delete rtcc;
+	return 0;
+}
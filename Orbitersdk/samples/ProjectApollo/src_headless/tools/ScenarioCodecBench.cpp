@@ -0,0 +1,230 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  Scenario reader and writer benchmark
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+//############################################################################//
+// Compares ScenarioReader with a chain of papiReadScenario calls and times
+// both:
+//
+//   scenario_bench [<items>]
+//
+// A state of random doubles, vectors and matrices is written once with the
+// fixed 12 decimals of papiWriteScenario and once with the shortest round
+// trip format. Both are read back through the papi chain, where every line
+// is tried against every item in turn, and through ScenarioReader. Values
+// that don't read back to the same double are counted. Random doubles of
+// all magnitudes are also formatted and parsed to check that no bits are
+// lost. Built on Linux for example with
+//
+//   g++ -O2 -Isrc_headless -Isrc_sys -include strings.h
+//       src_headless/tools/ScenarioCodecBench.cpp src_sys/ScenarioCodec.cpp
+//       src_headless/OrbiterAPI.cpp src_headless/VesselAPI.cpp
+//       src_headless/HeadlessSim.cpp -o scenario_bench
+//############################################################################//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+#include "Orbitersdk.h"
+#include "papi.h"
+#include "ScenarioCodec.h"
+
+struct BenchItem
+{
+	char Name[32];
+	//0 = double, 1 = vector, 2 = matrix
+	int Type;
+	double Value[9];
+	double Read[9];
+};
+
+static int Size(int type)
+{
+	return type == 0 ? 1 : (type == 1 ? 3 : 9);
+}
+
+static void Write(std::vector<BenchItem> &items, bool shortest, std::vector<std::string> &lines)
+{
+	char buffer[SCENARIO_LINE_MAX], num[32];
+	unsigned i;
+	int k;
+
+	lines.clear();
+	for (i = 0;i < items.size();i++)
+	{
+		sprintf(buffer, "%s", items[i].Name);
+		for (k = 0;k < Size(items[i].Type);k++)
+		{
+			if (shortest) ScenarioFormatDouble(num, items[i].Value[k]);
+			else sprintf(num, "%.12lf", items[i].Value[k]);
+			strcat(buffer, " ");
+			strcat(buffer, num);
+		}
+		lines.push_back(buffer);
+	}
+}
+
+static int Lost(std::vector<BenchItem> &items)
+{
+	unsigned i;
+	int k, n = 0;
+
+	for (i = 0;i < items.size();i++)
+	{
+		for (k = 0;k < Size(items[i].Type);k++)
+		{
+			if (items[i].Read[k] != items[i].Value[k]) n++;
+		}
+	}
+	return n;
+}
+
+static double ReadPapi(std::vector<BenchItem> &items, std::vector<std::string> &lines)
+{
+	std::vector<char> line(SCENARIO_LINE_MAX);
+	VECTOR3 v;
+	MATRIX3 m;
+	unsigned i, j;
+
+	auto t0 = std::chrono::steady_clock::now();
+	for (j = 0;j < lines.size();j++)
+	{
+		strcpy(line.data(), lines[j].c_str());
+		for (i = 0;i < items.size();i++)
+		{
+			BenchItem &it = items[i];
+			if (it.Type == 0)
+			{
+				papiReadScenario_double(line.data(), it.Name, it.Read[0]);
+			}
+			else if (it.Type == 1)
+			{
+				if (papiReadScenario_vec(line.data(), it.Name, v))
+				{
+					it.Read[0] = v.x; it.Read[1] = v.y; it.Read[2] = v.z;
+				}
+			}
+			else if (papiReadScenario_mat(line.data(), it.Name, m))
+			{
+				memcpy(it.Read, m.data, sizeof(it.Read));
+			}
+		}
+	}
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+}
+
+static double ReadCodec(std::vector<BenchItem> &items, std::vector<std::string> &lines)
+{
+	std::vector<VECTOR3> v(items.size());
+	std::vector<MATRIX3> m(items.size());
+	unsigned i, j;
+
+	auto t0 = std::chrono::steady_clock::now();
+	ScenarioReader r;
+	for (i = 0;i < items.size();i++)
+	{
+		if (items[i].Type == 0) r.Double(items[i].Name, items[i].Read[0]);
+		else if (items[i].Type == 1) r.Vec(items[i].Name, v[i]);
+		else r.Mat(items[i].Name, m[i]);
+	}
+	for (j = 0;j < lines.size();j++)
+	{
+		r.Read(lines[j].c_str());
+	}
+	auto t1 = std::chrono::steady_clock::now();
+
+	for (i = 0;i < items.size();i++)
+	{
+		if (items[i].Type == 1)
+		{
+			items[i].Read[0] = v[i].x; items[i].Read[1] = v[i].y; items[i].Read[2] = v[i].z;
+		}
+		else if (items[i].Type == 2)
+		{
+			memcpy(items[i].Read, m[i].data, sizeof(items[i].Read));
+		}
+	}
+	return std::chrono::duration<double>(t1 - t0).count();
+}
+
+int main(int argc, char *argv[])
+{
+	std::mt19937_64 gen(1);
+	std::uniform_real_distribution<double> unit(-1.0, 1.0);
+	std::uniform_int_distribution<int> type(0, 2), mag(-12, 12);
+	std::vector<BenchItem> items;
+	std::vector<std::string> lines;
+	const char *end;
+	char buf[32];
+	double d, e, t, tw;
+	int n = 300, i, k, wrong = 0, len = 0;
+
+	if (argc > 1) n = atoi(argv[1]);
+	if (n < 1) n = 1;
+
+	//Values like those of the RTCC: times, radii, angles, unit vectors
+	items.resize(n);
+	for (i = 0;i < n;i++)
+	{
+		sprintf(items[i].Name, "RTCC_ITEM_%d", i);
+		items[i].Type = type(gen);
+		for (k = 0;k < 9;k++)
+		{
+			items[i].Value[k] = unit(gen) * pow(10.0, mag(gen) / 2);
+		}
+	}
+
+	printf("%d items, 12 decimals:\n", n);
+	Write(items, false, lines);
+	t = ReadPapi(items, lines);
+	printf("  papi chain     %8.3f ms, %d values changed\n", t*1000.0, Lost(items));
+	t = ReadCodec(items, lines);
+	printf("  ScenarioReader %8.3f ms, %d values changed\n", t*1000.0, Lost(items));
+
+	printf("%d items, shortest round trip:\n", n);
+	auto t0 = std::chrono::steady_clock::now();
+	Write(items, true, lines);
+	tw = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+	t = ReadPapi(items, lines);
+	printf("  papi chain     %8.3f ms, %d values changed\n", t*1000.0, Lost(items));
+	t = ReadCodec(items, lines);
+	printf("  ScenarioReader %8.3f ms, %d values changed\n", t*1000.0, Lost(items));
+	printf("  writing        %8.3f ms\n", tw*1000.0);
+
+	//Random bit patterns of all magnitudes
+	for (i = 0;i < 1000000;i++)
+	{
+		unsigned long long bits = gen();
+		memcpy(&d, &bits, sizeof(d));
+		if (isnan(d)) continue;
+
+		len += ScenarioFormatDouble(buf, d);
+		if (!ScenarioParseDouble(buf, &end, e) || e != d || *end != 0 || strtod(buf, NULL) != d) wrong++;
+	}
+	printf("1000000 random doubles: %d not read back, %.1f characters on average\n", wrong, len / 1e6);
+	return wrong > 0;
+}
@@ -0,0 +1,216 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  Mission sound file checker and timeline benchmark
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+//############################################################################//
+// Checks mission sound files, or times the sound timeline:
+//
+//   soundtimeline_check [-met] <file> ...
+//   soundtimeline_check [<sounds>]
+//
+// With files, every line that would be left out is listed and the sounds
+// are printed in the order they are played. -met reads sound.csv type
+// files, otherwise the csmsound.csv format is expected. The exit code is
+// the number of files with errors.
+//
+// Without files a timeline of random sounds over a ten day mission is
+// written and stepped through at 50 steps per second, with a jump in time
+// now and then. The sounds passed on each step are compared with a scan of
+// the whole list, which is what a list without cursor would need. Built on
+// Linux for example with
+//
+//   g++ -O2 -Isrc_sys src_headless/tools/SoundTimelineCheck.cpp
+//       src_sys/SoundTimeline.cpp -o soundtimeline_check
+//############################################################################//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <random>
+#include <vector>
+#include "SoundTimeline.h"
+
+static void FormatTime(char *buf, double t)
+{
+	double a = fabs(t);
+	sprintf(buf, "%s%03d:%02d:%02d", t < 0.0 ? "-" : "", (int)(a / 3600.0), (int)fmod(a / 60.0, 60.0), (int)fmod(a, 60.0));
+}
+
+static int CheckFile(const char *path, SoundTimeline::Format format)
+{
+	SoundTimeline tl;
+	char buf[32];
+	int i;
+
+	if (!tl.LoadFromFile(path, format))
+	{
+		printf("%s: can't be opened\n", path);
+		return 1;
+	}
+
+	printf("%s: %d sounds, %d lines left out\n", path, tl.Size(), (int)tl.Errors().size());
+	for (i = 0;i < (int)tl.Errors().size();i++)
+	{
+		printf("  %s\n", tl.Errors()[i].c_str());
+	}
+	for (i = 0;i < tl.Size();i++)
+	{
+		const SoundTimelineEvent &e = tl.Event(i);
+		FormatTime(buf, e.Time);
+		printf("  %s %c %d %-32s (line %d)\n", buf, e.LaunchRelative ? 'l' : 'r', e.Priority, e.Name.c_str(), e.Line);
+	}
+	return tl.Errors().empty() ? 0 : 1;
+}
+
+int main(int argc, char *argv[])
+{
+	SoundTimeline::Format format = SoundTimeline::FORMAT_PRIORITY;
+	int i, n = 5000, files = 0, bad = 0;
+
+	for (i = 1;i < argc;i++)
+	{
+		if (!strcmp(argv[i], "-met"))
+		{
+			format = SoundTimeline::FORMAT_MET;
+		}
+		else if (atoi(argv[i]) > 0 && strchr(argv[i], '.') == NULL)
+		{
+			n = atoi(argv[i]);
+		}
+		else
+		{
+			bad += CheckFile(argv[i], format);
+			files++;
+		}
+	}
+	if (files > 0) return bad;
+
+	//
+	// Random sounds in random order, with a few malformed lines
+	//
+
+	std::mt19937 gen(1);
+	std::uniform_real_distribution<double> unit(0.0, 1.0);
+	const char *path = "soundtimeline_check.csv";
+	const double dt = 0.02, tmax = 10.0 * 86400.0;
+	std::vector<double> times;
+	char buf[32];
+	FILE *fp;
+
+	fp = fopen(path, "w");
+	if (!fp)
+	{
+		printf("%s can't be written\n", path);
+		return 1;
+	}
+	fprintf(fp, "# Timeline check\n");
+	for (i = 0;i < n;i++)
+	{
+		FormatTime(buf, floor(unit(gen) * tmax) - 3600.0);
+		fprintf(fp, "%s;%c;%d;sound %d\n", buf, unit(gen) < 0.9 ? 'l' : 'r', (int)(unit(gen) * 10.0), i);
+		if (i % 1000 == 999)
+		{
+			fprintf(fp, "%s;l;x;bad priority\n", buf);
+			fprintf(fp, "001:75:00;l;5;bad minutes\n");
+		}
+	}
+	fclose(fp);
+
+	SoundTimeline tl;
+	auto t0 = std::chrono::steady_clock::now();
+	tl.LoadFromFile(path, SoundTimeline::FORMAT_PRIORITY);
+	double tload = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+	remove(path);
+
+	for (i = 0;i < tl.Size();i++)
+	{
+		times.push_back(tl.Event(i).Time);
+	}
+
+	//
+	// Step through the mission. Every 10000 steps the time jumps ahead or back.
+	//
+
+	double t = -3600.0, last = t, tcursor = 0.0, tscan = 0.0;
+	long long steps = 0, passed = 0, jumps = 0, wrong = 0;
+	int got, want;
+
+	tl.Seek(t);
+	while (t < tmax)
+	{
+		double tn = t + dt;
+		bool jump = false;
+
+		if (steps % 10000 == 9999)
+		{
+			tn = t + (unit(gen) - 0.3) * 20000.0;
+			jump = true;
+			jumps++;
+		}
+
+		auto ta = std::chrono::steady_clock::now();
+		if (jump) tl.Seek(tn);
+		got = 0;
+		while (tl.Next() && tl.Next()->Time <= tn)
+		{
+			got++;
+			tl.Advance();
+		}
+		auto tb = std::chrono::steady_clock::now();
+		want = 0;
+		if (!jump)
+		{
+			for (i = 0;i < (int)times.size();i++)
+			{
+				if (times[i] > last && times[i] <= tn) want++;
+			}
+		}
+		else
+		{
+			for (i = 0;i < (int)times.size();i++)
+			{
+				if (times[i] == tn) want++;
+			}
+		}
+		auto tc = std::chrono::steady_clock::now();
+
+		tcursor += std::chrono::duration<double>(tb - ta).count();
+		tscan += std::chrono::duration<double>(tc - tb).count();
+		if (got != want) wrong++;
+		passed += got;
+		last = t = tn;
+		steps++;
+	}
+
+	printf("%d sounds read in %.3f ms, %d lines left out:\n", tl.Size(), tload * 1000.0, (int)tl.Errors().size());
+	for (i = 0;i < (int)tl.Errors().size() && i < 4;i++)
+	{
+		printf("  %s\n", tl.Errors()[i].c_str());
+	}
+	printf("%lld steps, %lld jumps, %lld sounds passed\n", steps, jumps, passed);
+	printf("  cursor     %8.1f ns per step\n", tcursor / steps * 1e9);
+	printf("  list scan  %8.1f ns per step\n", tscan / steps * 1e9);
+	printf("  %lld steps with different sounds\n", wrong);
+	return wrong > 0 || tl.Errors().size() != 2 * (unsigned)(n / 1000);
+}
@@ -0,0 +1,221 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  Translunar midcourse option scan benchmark
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+//############################################################################//
+// Runs the midcourse option scan of the TLMCC processor on the Apollo 11
+// state before MCC-2 and times it on one thread and on all threads:
+//
+//   tlmcc_scan_bench [<orbiter dir>] [<threads>]
+//
+// The RTCC is loaded from the RTCC block of the mission scenario, which also
+// loads the launch day files from Config/ProjectApollo/RTCC. The CSM state
+// comes from the RPOS and RVEL of the CSM, converted like
+// RTCC::StateVectorCalcEphem does. MCC-2 is set up like the Mission G MCC
+// code, and modes 2 to 5 are scanned from the MCC-2 time to four hours later,
+// like the SCN button of the RTCC MFD midcourse tradeoff page. Both runs
+// have to give the same solutions. RTCC::TranslunarMidcourseCorrectionScan
+// is run last and the midcourse display columns it fills are printed.
+// Without Orbiter the Moon is the Keplerian orbit of HeadlessSim, which
+// misses the Moon of the scenario by thousands of kilometers. The solutions
+// are far from the flight ones and most options don't converge, so the
+// figures are only good for timing and for comparing runs.
+// Built on Linux for example with
+//
+//   g++ -O2 -pthread -fpermissive -Isrc_headless -Isrc_headless/posix
+//       -Isrc_aux -Isrc_sys -Isrc_mfd -Isrc_lm -Isrc_moon -Isrc_csm
+//       -Isrc_launch -Isrc_landing -Isrc_saturn -Isrc_rtccmfd
+//       -include strings.h src_headless/tools/TLMCCScanBench.cpp
+//       src_launch/rtcc.cpp src_rtccmfd/CSMLMGuidanceSim.cpp
+//       src_rtccmfd/CoastNumericalIntegrator.cpp
+//       src_rtccmfd/EnckeIntegrator.cpp src_rtccmfd/EntryCalculations.cpp
+//       src_rtccmfd/EntryDispersion.cpp src_rtccmfd/GeneralizedIterator.cpp
+//       src_rtccmfd/LDPP.cpp src_rtccmfd/LMGuidanceSim.cpp
+//       src_rtccmfd/LOITargeting.cpp src_rtccmfd/LWP.cpp
+//       src_rtccmfd/OrbMech.cpp src_rtccmfd/PatchPointKernel.cpp
+//       src_rtccmfd/RTCCModule.cpp src_rtccmfd/ReentryNumericalIntegrator.cpp
+//       src_rtccmfd/SunMoonEphemeris.cpp src_rtccmfd/TLIGuidanceSim.cpp
+//       src_rtccmfd/TLMCC.cpp src_rtccmfd/rtcc_intermediate_library_programs.cpp
+//       src_rtccmfd/rtcc_library_programs.cpp src_sys/ScenarioCodec.cpp
+//       src_headless/OrbiterAPI.cpp src_headless/VesselAPI.cpp
+//       src_headless/HeadlessSim.cpp -o tlmcc_scan_bench
+//
+// and run from anywhere with the Orbiter directory as the first argument.
+//############################################################################//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+#include <string>
+#include <vector>
+#include "Orbitersdk.h"
+#include "HeadlessSim.h"
+#include "rtcc.h"
+
+static const char *Scenario = "Scenarios/Project Apollo - NASSP/Apollo - Mission Scenarios/Apollo 11/Apollo 11 - 06 - Before MCC-2 T+26h30min.scn";
+
+//Simulation date, position and velocity of the first ship and the line after RTCC_BEGIN
+static bool ReadScenario(const char *path, double &MJD, VECTOR3 &R, VECTOR3 &V, int &rtccline)
+{
+	FILE *f = fopen(path, "rt");
+	char line[1024];
+	int n = 0, found = 0;
+
+	if (f == NULL) return false;
+	rtccline = -1;
+	while (fgets(line, sizeof(line), f))
+	{
+		char *l = line;
+		n++;
+		while (*l == ' ' || *l == '\t') l++;
+		if (!(found & 1) && sscanf(l, "Date MJD %lf", &MJD) == 1) found |= 1;
+		else if (!(found & 2) && sscanf(l, "RPOS %lf %lf %lf", &R.x, &R.y, &R.z) == 3) found |= 2;
+		else if (!(found & 4) && sscanf(l, "RVEL %lf %lf %lf", &V.x, &V.y, &V.z) == 3) found |= 4;
+		else if (strncmp(l, RTCC_START_STRING, strlen(RTCC_START_STRING)) == 0)
+		{
+			rtccline = n;
+			break;
+		}
+	}
+	fclose(f);
+	return found == 7 && rtccline > 0;
+}
+
+//Failed options can end with NaN
+static bool Same(double a, double b)
+{
+	return a == b || (a != a && b != b);
+}
+
+static bool SameSolution(const TLMCCScanPoint &a, const TLMCCScanPoint &b)
+{
+	return a.Error == b.Error && a.Rank == b.Rank && Same(a.DV_TOTAL, b.DV_TOTAL) && Same(a.AZ_act, b.AZ_act);
+}
+
+int main(int argc, char *argv[])
+{
+	const char *root = argc > 1 ? argv[1] : ".";
+	unsigned threads = argc > 2 ? atoi(argv[2]) : 0;
+	EphemerisData sv0;
+	VECTOR3 R, V;
+	double MJD, CSMmass, LMmass;
+	int rtccline, i, k;
+	char *line;
+
+	//The RTCC opens its files relative to the Orbiter directory
+	if (chdir(root))
+	{
+		printf("Can't change to %s\n", root);
+		return 1;
+	}
+	HeadlessSim::Instance().SetRootDir(".");
+	if (!ReadScenario(Scenario, MJD, R, V, rtccline))
+	{
+		printf("Can't read %s\n", Scenario);
+		return 1;
+	}
+
+	RTCC *rtcc = new RTCC();
+	FILEHANDLE scn = oapiOpenFile(Scenario, FILE_IN, ROOT);
+	for (i = 0;i < rtccline;i++)
+	{
+		oapiReadScenario_nextline(scn, line);
+	}
+	rtcc->LoadState(scn);
+	oapiCloseFile(scn, FILE_IN);
+
+	//Like RTCC::StateVectorCalcEphem, the CSM is in the Earth sphere of influence
+	sv0.R = _V(R.x, R.z, R.y);
+	sv0.V = _V(V.x, V.z, V.y);
+	sv0.GMT = OrbMech::GETfromMJD(MJD, rtcc->SystemParameters.GMTBASE);
+	sv0.RBI = BODY_EARTH;
+	CSMmass = rtcc->PZMPTCSM.CommonBlock.CSMMass;
+	LMmass = rtcc->PZMPTCSM.CommonBlock.LMAscentMass + rtcc->PZMPTCSM.CommonBlock.LMDescentMass;
+
+	//MCC-2 of the Mission G MCC
+	rtcc->PZMCCPLN.MidcourseGET = rtcc->calcParams.TLI - 5.0*60.0 - 20.0 + 24.0*3600.0;
+	rtcc->PZMCCPLN.Config = true;
+	rtcc->PZMCCPLN.Column = 1;
+	rtcc->PZMCCPLN.SFPBlockNum = 1;
+	rtcc->PZMCCPLN.Mode = 3;
+
+	std::vector<int> modes = { 2, 3, 4, 5 };
+	std::vector<double> GET_MCC;
+	for (i = 0;i <= 4;i++)
+	{
+		GET_MCC.push_back(rtcc->PZMCCPLN.MidcourseGET + (double)i*3600.0);
+	}
+
+	TLMCCScanSettings set;
+	TLMCCScanTable tab[2];
+	TLMCCProcessor tlmcc(rtcc);
+
+	rtcc->TranslunarMidcourseCorrectionInputs(sv0, CSMmass, LMmass, set.DataTable, set.MED, set.Constants);
+	set.MODES = modes;
+	for (i = 0;i < (int)GET_MCC.size();i++)
+	{
+		set.T_MCC.push_back(rtcc->GMTfromGET(GET_MCC[i]));
+	}
+
+	printf("CSM at GET %.3f h, CSM %.0f kg, LM %.0f kg, MCC-2 at GET %.3f h\n", rtcc->GETfromGMT(sv0.GMT) / 3600.0, CSMmass, LMmass, rtcc->PZMCCPLN.MidcourseGET / 3600.0);
+	printf("%d modes at %d midcourse times\n\n", (int)modes.size(), (int)GET_MCC.size());
+
+	for (k = 0;k < 2;k++)
+	{
+		set.MaxThreads = k == 0 ? 1 : threads;
+		tlmcc.SCAN(set, tab[k]);
+		printf("%-12s %8.3f s  %d solved, %d failed\n", k == 0 ? "one thread" : "all threads", tab[k].TTOTAL, tab[k].Solved, tab[k].Failed);
+	}
+	for (i = 0;i < (int)tab[0].Points.size();i++)
+	{
+		if (!SameSolution(tab[0].Points[i], tab[1].Points[i]))
+		{
+			printf("Option %d differs between the runs\n", i + 1);
+			return 1;
+		}
+	}
+	printf("speedup %.2f, same solutions on both runs\n\n", tab[0].TTOTAL / tab[1].TTOTAL);
+
+	printf("rank  mode   GET MCC   DV MCC   DV LOI  DV LOPC   DV TEI  DV total   AZ act  AZ miss (ft/s, deg)\n");
+	for (i = 0;i < (int)tab[1].Ranking.size();i++)
+	{
+		const TLMCCScanPoint &p = tab[1].Points[tab[1].Ranking[i]];
+		printf("%4d  %4d  %8.3f  %7.1f  %7.1f  %7.1f  %7.1f  %8.1f  %7.2f  %7.2f%s\n", p.Rank, p.Mode, rtcc->GETfromGMT(p.T_MCC) / 3600.0,
+			p.DV_MCC / 0.3048, p.DV_LOI / 0.3048, p.DV_LOPC / 0.3048, p.DV_TEI / 0.3048, p.DV_TOTAL / 0.3048, p.AZ_act*DEG, p.DAZ*DEG, p.Error ? "  failed" : "");
+	}
+
+	//The RTCC entry point of the MFD
+	TLMCCScanTable mfdtab;
+	rtcc->TranslunarMidcourseCorrectionScan(sv0, CSMmass, LMmass, modes, GET_MCC, mfdtab);
+	printf("\nMidcourse display\ncolumn  mode   GET MCC  DV MCC (ft/s)\n");
+	for (i = 0;i < 4;i++)
+	{
+		const TLMCCDisplayData &d = rtcc->PZMCCDIS.data[i];
+		if (d.Mode == 0) printf("%6d  none\n", i + 1);
+		else printf("%6d  %4d  %8.3f  %6.1f\n", i + 1, d.Mode, d.GET_MCC / 3600.0, length(d.DV_MCC) / 0.3048);
+	}
+
+	delete rtcc;
+	return 0;
+}
@@ -25,7 +25,7 @@
 #define ORBITER_MODULE
 // To force orbitersdk.h to use <fstream> in any compiler version
 #pragma include_alias( <fstream.h>,<fstream> )
-#include "orbitersdk.h"
+#include "Orbitersdk.h"
 //############################################################################//
 #include "stdio.h"
 #include "math.h"
@@ -86,6 +86,7 @@ void LCC::clbkSaveState(FILEHANDLE scn)
 	VESSEL4::clbkSaveState(scn);
 
 	oapiWriteScenario_string(scn, "PAD_NAME", PadName);
+	rca110a->SaveState(scn);
 }
 
 void LCC::clbkLoadStateEx(FILEHANDLE scn, void *status)
@@ -96,6 +97,9 @@ void LCC::clbkLoadStateEx(FILEHANDLE scn, void *status)
 		if (!_strnicmp(line, "PAD_NAME", 8)) {
 			sscanf_s(line + 8, "%s", PadName, sizeof(PadName));
 		}
+		else if (!_strnicmp(line, "ATOLL_", 6)) {
+			rca110a->LoadState(line);
+		}
 		else ParseScenarioLineEx(line, status);
 	}
 }
@@ -0,0 +1,236 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  MCC ground station contact prediction
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+// To force orbitersdk.h to use <fstream> in any compiler version
+#pragma include_alias( <fstream.h>, <fstream> )
+#include "Orbitersdk.h"
+#include <algorithm>
+#include "../src_rtccmfd/OrbMech.h"
+#include "MCCContacts.h"
+
+MCCContacts::MCCContacts() : current(-1), busy(false)
+{
+	int i;
+
+	for (i = 0;i < MCC_CONTACTS_MAX;i++)
+	{
+		stations[i].u = _V(0, 0, 0);
+		stations[i].Range = 0.0;
+	}
+	nstations = 0;
+}
+
+MCCContacts::~MCCContacts()
+{
+	if (worker.joinable()) worker.join();
+}
+
+void MCCContacts::SetStation(int i, double lat, double lng, double range)
+{
+	if (i < 0 || i >= MCC_CONTACTS_MAX) return;
+
+	stations[i].u = _V(cos(lng*RAD)*cos(lat*RAD), sin(lat*RAD), sin(lng*RAD)*cos(lat*RAD));
+	stations[i].Range = range;
+	if (i >= nstations) nstations = i + 1;
+}
+
+void MCCContacts::Propagate(const MCCContactState &s, double simt, VECTOR3 &R_CM, VECTOR3 &R_M)
+{
+	VECTOR3 V;
+	double dt = simt - s.SimT;
+
+	R_M = s.R_EM + s.V_EM*dt;
+	if (dt == 0.0)
+	{
+		R_CM = s.R;
+	}
+	else
+	{
+		OrbMech::rv_from_r0v0(s.R, s.V, dt, R_CM, V, s.MoonRef ? s.mu_M : s.mu_E);
+	}
+	if (s.MoonRef) R_CM += R_M;
+}
+
+bool MCCContacts::StationVisible(const MCCContactState &s, int i, double simt, const VECTOR3 &R_CM, const VECTOR3 &R_M)
+{
+	VECTOR3 u, R_GS;
+	double a;
+
+	if (stations[i].Range <= 0.0) return false;
+
+	//Earth rotation moves the station east
+	a = s.w_E*(simt - s.SimT);
+	u = stations[i].u;
+	u = _V(u.x*cos(a) - u.z*sin(a), u.y, u.x*sin(a) + u.z*cos(a));
+	R_GS = mul(s.Rot_E, u)*s.R_E;
+
+	if (!OrbMech::sight(R_CM, R_GS, s.R_E)) return false;
+	if (length(R_CM - R_GS) > stations[i].Range) return false;
+	//Moon in the way
+	if (dotp(unit(R_M - R_CM), unit(R_GS - R_CM)) > cos(asin(s.R_M / length(R_M - R_CM)))) return false;
+	return true;
+}
+
+bool MCCContacts::StationVisible(const MCCContactState &s, int i, double simt)
+{
+	VECTOR3 R_CM, R_M;
+
+	Propagate(s, simt, R_CM, R_M);
+	return StationVisible(s, i, simt, R_CM, R_M);
+}
+
+void MCCContacts::Visibility(const MCCContactState &s, double simt, bool *visible)
+{
+	VECTOR3 R_CM, R_M;
+	int i;
+
+	Propagate(s, simt, R_CM, R_M);
+	for (i = 0;i < nstations;i++)
+	{
+		visible[i] = StationVisible(s, i, simt, R_CM, R_M);
+	}
+}
+
+void MCCContacts::Compute(const MCCContactState &s, MCCContactPrediction &p)
+{
+	bool last[MCC_CONTACTS_MAX], now[MCC_CONTACTS_MAX];
+	MCCContactEvent ev;
+	double t, t0, t1, tm;
+	int i, k, n;
+
+	p.State = s;
+	p.Events.clear();
+	Visibility(s, s.SimT, p.Visible);
+	for (i = 0;i < nstations;i++)
+	{
+		last[i] = p.Visible[i];
+	}
+
+	n = (int)(MCC_CONTACTS_SPAN / MCC_CONTACTS_STEP);
+	for (k = 1;k <= n;k++)
+	{
+		t = s.SimT + k * MCC_CONTACTS_STEP;
+		Visibility(s, t, now);
+		for (i = 0;i < nstations;i++)
+		{
+			if (now[i] == last[i]) continue;
+
+			//Bisect to 0.1 seconds
+			t0 = t - MCC_CONTACTS_STEP;
+			t1 = t;
+			while (t1 - t0 > 0.1)
+			{
+				tm = (t0 + t1) / 2.0;
+				if (StationVisible(s, i, tm) == now[i]) t1 = tm;
+				else t0 = tm;
+			}
+			ev.SimT = t1;
+			ev.Station = i;
+			ev.AOS = now[i];
+			p.Events.push_back(ev);
+			last[i] = now[i];
+		}
+	}
+
+	std::stable_sort(p.Events.begin(), p.Events.end(), [](const MCCContactEvent &a, const MCCContactEvent &b) { return a.SimT < b.SimT; });
+}
+
+void MCCContacts::Predict(const MCCContactState &s)
+{
+	int w;
+
+	if (busy) return;
+	if (worker.joinable()) worker.join();
+
+	//Write into the buffer that isn't handed out
+	w = current == 0 ? 1 : 0;
+	busy = true;
+	worker = std::thread([this, s, w]()
+	{
+		Compute(s, predictions[w]);
+		current = w;
+		busy = false;
+	});
+}
+
+const MCCContactPrediction *MCCContacts::GetPrediction()
+{
+	int c = current;
+
+	if (c < 0) return NULL;
+	return &predictions[c];
+}
+
+bool MCCContacts::Lookup(const MCCContactPrediction *p, const MCCContactState &s, bool *visible)
+{
+	VECTOR3 R_CM, R_M, R;
+	double dt;
+	unsigned j;
+	int i;
+
+	if (p == NULL || s.SimT < p->State.SimT || s.SimT > p->State.SimT + MCC_CONTACTS_SPAN) return false;
+
+	//Still on the predicted trajectory? Around the Moon this is checked relative to the Moon, the prediction only moves it on a straight line.
+	Propagate(p->State, s.SimT, R_CM, R_M);
+	R = s.MoonRef ? s.R + s.R_EM : s.R;
+	if (p->State.MoonRef)
+	{
+		R -= s.R_EM;
+		R_CM -= R_M;
+	}
+	dt = s.SimT - p->State.SimT;
+	if (length(R - R_CM) > MCC_CONTACTS_MAXDEVIATION + 0.5*MCC_CONTACTS_DRIFT*dt*dt) return false;
+
+	for (i = 0;i < nstations;i++)
+	{
+		visible[i] = p->Visible[i];
+	}
+	for (j = 0;j < p->Events.size() && p->Events[j].SimT <= s.SimT;j++)
+	{
+		visible[p->Events[j].Station] = p->Events[j].AOS;
+	}
+	return true;
+}
+
+bool MCCContacts::NextAOS(const MCCContactPrediction *p, double simt, int &station, double &aos)
+{
+	unsigned j;
+
+	if (p == NULL) return false;
+
+	for (j = 0;j < p->Events.size();j++)
+	{
+		if (p->Events[j].SimT > simt && p->Events[j].AOS)
+		{
+			station = p->Events[j].Station;
+			aos = p->Events[j].SimT;
+			return true;
+		}
+	}
+	return false;
+}
+
+void MCCContacts::Wait()
+{
+	if (worker.joinable()) worker.join();
+}
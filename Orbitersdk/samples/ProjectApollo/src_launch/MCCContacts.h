@@ -0,0 +1,137 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  MCC ground station contact prediction (Header)
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#pragma once
+
+#include <thread>
+#include <atomic>
+#include <vector>
+
+// ****************************************************************
+// The AOS and LOS of the ground stations are predicted from the
+// current state of the spacecraft instead of being checked against
+// its position every second. The state is propagated on a conic,
+// around the Moon within the lunar sphere of influence, the Earth
+// is rotated and the Moon moved along its current velocity. The
+// prediction runs on a worker thread and gives the times at which
+// each station gains or loses the spacecraft. The MCC then only
+// compares these times with the simulation time.
+//
+// When the spacecraft leaves the predicted trajectory, e.g. during
+// a burn, the prediction is thrown away and the stations are checked
+// directly until a new one is done. All inputs are copied before the
+// worker starts and the finished prediction is handed over by an
+// atomic index, so the MCC timestep never waits for the worker.
+// ****************************************************************
+
+#define MCC_CONTACTS_MAX			64
+
+//Time covered by a prediction
+#define MCC_CONTACTS_SPAN			7200.0
+//Sample step, AOS and LOS are then found by bisection
+#define MCC_CONTACTS_STEP			10.0
+//A new prediction is started after this time
+#define MCC_CONTACTS_REFRESH		600.0
+//A prediction is dropped when the spacecraft is farther (m) from the predicted position than this, plus what
+//MCC_CONTACTS_DRIFT (m/s^2) moves it in the time since the prediction. The conic leaves out the J2 acceleration of the
+//Earth, up to 0.03 m/s^2 in a low orbit, which takes the spacecraft about 5 km away in the ten minutes to the next
+//prediction.
+#define MCC_CONTACTS_MAXDEVIATION	5000.0
+#define MCC_CONTACTS_DRIFT			0.03
+
+//Everything the prediction needs, taken at one simulation time. Vectors are in the global frame orientation.
+struct MCCContactState
+{
+	double SimT;
+	//Spacecraft relative to the Earth, or to the Moon with MoonRef
+	VECTOR3 R, V;
+	bool MoonRef;
+	//Moon relative to the Earth
+	VECTOR3 R_EM, V_EM;
+	//Earth local to global orientation
+	MATRIX3 Rot_E;
+	//Earth rotation rate (rad/s), radii and gravitational parameters
+	double w_E, R_E, R_M, mu_E, mu_M;
+};
+
+struct MCCContactEvent
+{
+	double SimT;
+	int Station;
+	bool AOS;
+};
+
+struct MCCContactPrediction
+{
+	MCCContactState State;
+	//Stations in contact at the time of the state
+	bool Visible[MCC_CONTACTS_MAX];
+	//Changes of contact in time order
+	std::vector<MCCContactEvent> Events;
+};
+
+class MCCContacts
+{
+public:
+	MCCContacts();
+	~MCCContacts();
+
+	//Station location in degrees. Stations not used for contacts get range 0.
+	void SetStation(int i, double lat, double lng, double range);
+
+	//Contact of all stations at time simt, with the state propagated from s
+	void Visibility(const MCCContactState &s, double simt, bool *visible);
+
+	//Starts a prediction from s on the worker thread, unless one is running
+	void Predict(const MCCContactState &s);
+	//Last finished prediction, NULL if there is none
+	const MCCContactPrediction *GetPrediction();
+	//Contact of all stations at time s.SimT from prediction p. Returns false if s is not close enough to the predicted trajectory.
+	bool Lookup(const MCCContactPrediction *p, const MCCContactState &s, bool *visible);
+	//First AOS after simt in prediction p, returns false if there is none
+	bool NextAOS(const MCCContactPrediction *p, double simt, int &station, double &aos);
+	//Waits for a running prediction, for checks that need repeatable results
+	void Wait();
+
+protected:
+	struct Station
+	{
+		//Unit vector in the Earth local frame
+		VECTOR3 u;
+		double Range;
+	};
+
+	void Propagate(const MCCContactState &s, double simt, VECTOR3 &R_CM, VECTOR3 &R_M);
+	bool StationVisible(const MCCContactState &s, int i, double simt, const VECTOR3 &R_CM, const VECTOR3 &R_M);
+	bool StationVisible(const MCCContactState &s, int i, double simt);
+	void Compute(const MCCContactState &s, MCCContactPrediction &p);
+
+	Station stations[MCC_CONTACTS_MAX];
+	int nstations;
+
+	MCCContactPrediction predictions[2];
+	//Index of the finished prediction, -1 before the first one
+	std::atomic<int> current;
+	std::atomic<bool> busy;
+	std::thread worker;
+};
@@ -26,7 +26,7 @@
 
 // To force orbitersdk.h to use <fstream> in any compiler version
 #pragma include_alias( <fstream.h>, <fstream> )
-#include "orbitersdk.h"
+#include "Orbitersdk.h"
 #include "nasspsound.h"
 #include "soundlib.h"
 #include "tracer.h"
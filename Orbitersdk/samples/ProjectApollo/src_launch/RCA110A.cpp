@@ -23,6 +23,7 @@
   **************************************************************************/
 
 #include <vector>
+#include <fstream>
 #include "Orbitersdk.h"
 #include "PadLCCInterface.h"
 #include "LCCPadInterface.h"
@@ -96,7 +97,7 @@ bool ATOLLSequence::ReadIn(const char *str)
 	return true;
 }
 
-int ATOLLSequence::GetOperator()
+int ATOLLSequence::GetOperator() const
 {
 	if (Operator == "DISO")
 	{
@@ -121,109 +122,188 @@ int ATOLLSequence::GetOperator()
 ATOLLProcessor::ATOLLProcessor(RCA110AL *r)
 {
 	rca110a = r;
-	opcode = 0;
+	pc = 0;
 	nextitemtime = 0.0;
-	skipgetline = false;
+	simtime = 0.0;
+	startdelay = 0.0;
+	starting = false;
 	delaystatus = false;
 }
 
 void ATOLLProcessor::Timestep(double simt)
 {
-	if (ifs.is_open() == false) return;
-
 	simtime = simt;
-	if (simtime < nextitemtime) return;
-	if (skipgetline == false)
+	if (pc >= program.size()) return;
+
+	if (starting)
 	{
-		if (!ifs.getline(line, 100))
-		{
-			ifs.close();
-		}
+		nextitemtime = simt + startdelay;
+		startdelay = 0.0;
+		starting = false;
 	}
-	seq.Clear();
-	if (seq.ReadIn(line))
+
+	//Execute every statement that is due in this frame. Delays advance the scheduled time, not the frame time,
+	//so the sequence timing doesn't depend on the frame rate.
+	while (pc < program.size() && nextitemtime <= simt)
 	{
-		opcode = seq.GetOperator();
-		switch (opcode)
+		const ATOLLInstruction &ins = program[pc];
+		bool done = true;
+
+		switch (ins.Opcode)
 		{
 		case ATOLL_DELY:
-			DELY();
+			done = DELY(ins);
 			break;
 		case ATOLL_DISO:
-			DISO();
+			done = DISO(ins);
 			break;
 		case ATOLL_SCAN:
-			SCAN();
+			done = SCAN(ins);
 			break;
 		case ATOLL_SSEL:
-			SSEL();
+			done = SSEL(ins);
 			break;
 		}
+		if (done) pc++;
 	}
 }
 
-void ATOLLProcessor::DELY()
+bool ATOLLProcessor::DELY(const ATOLLInstruction &ins)
 {
-	if (seq.Time <= 0) return;
-	nextitemtime = simtime + seq.Time / 1000.0;
+	nextitemtime += ins.Time;
+	return true;
 }
 
-void ATOLLProcessor::DISO()
+bool ATOLLProcessor::DISO(const ATOLLInstruction &ins)
 {
-	if (seq.Variable.size() == 0) return;
-	if (seq.Variable[0] == 'D')
-	{
-		//Discrete output
-		int chan;
-		if (sscanf_s(seq.Variable.c_str(), "D%d", &chan) == 1)
-		{
-			bool on;
-
-			if (seq.Condition == 1)
-				on = true;
-			else
-				on = false;
-			rca110a->SetConnectedOutput(chan, on);
-		}
-	}
+	//Discrete output
+	rca110a->SetConnectedOutput(ins.Operand[0], ins.Condition == 1);
+	return true;
 }
 
-void ATOLLProcessor::SCAN()
+bool ATOLLProcessor::SCAN(const ATOLLInstruction &ins)
 {
-	if (seq.Time > 0)
+	if (ins.Time > 0 && delaystatus == false)
 	{
-		if (skipgetline == false)
-		{
-			nextitemtime = simtime + seq.Time / 1000.0;
-			skipgetline = true;
-			delaystatus = true;
-		}
-		else
-		{
-			delaystatus = false;
-		}
+		nextitemtime += ins.Time;
+		delaystatus = true;
+		return false;
 	}
 
-	if (delaystatus) return;
-
 	//Do Scanning
 	delaystatus = false;
-	skipgetline = false;
+	return true;
 }
 
-void ATOLLProcessor::SSEL()
+bool ATOLLProcessor::SSEL(const ATOLLInstruction &ins)
 {
-	int stage, chan;
+	rca110a->IssueSwitchSelectorCmd(ins.Operand[0], ins.Operand[1]);
+	return true;
+}
 
-	if (sscanf_s(seq.Variable.c_str(), "%d,%d", &stage, &chan) == 2)
+bool ATOLLProcessor::Compile(const ATOLLSequence &seq, ATOLLInstruction &ins)
+{
+	ins.Opcode = seq.GetOperator();
+	ins.SubStep = seq.SubStep;
+	ins.Condition = seq.Condition;
+	ins.Time = seq.Time / 1000.0;
+	ins.Operand[0] = 0;
+	ins.Operand[1] = 0;
+
+	switch (ins.Opcode)
 	{
-		rca110a->IssueSwitchSelectorCmd(stage, chan);
+	case ATOLL_DELY:
+		return ins.Time > 0;
+	case ATOLL_DISO:
+		return sscanf_s(seq.Variable.c_str(), "D%d", &ins.Operand[0]) == 1 && ins.Operand[0] >= 0 && ins.Operand[0] < RCA110A_OUTPUT_LINES;
+	case ATOLL_SCAN:
+		return true;
+	case ATOLL_SSEL:
+		return sscanf_s(seq.Variable.c_str(), "%d,%d", &ins.Operand[0], &ins.Operand[1]) == 2;
 	}
+	return false;
 }
 
-void ATOLLProcessor::ReadFile(const char *str)
+bool ATOLLProcessor::ReadFile(const char *str)
 {
-	ifs.open(str);
+	std::ifstream ifs(str);
+	std::string line;
+	ATOLLSequence seq;
+	ATOLLInstruction ins;
+	int step = 0;
+
+	program.clear();
+	programfile.clear();
+	pc = 0;
+	startdelay = 0.0;
+	starting = true;
+	delaystatus = false;
+
+	if (!ifs.is_open()) return false;
+
+	//Statements that can't run, like the column titles, are dropped here
+	while (std::getline(ifs, line))
+	{
+		seq.Clear();
+		if (!seq.ReadIn(line.c_str())) continue;
+		if (!Compile(seq, ins)) continue;
+		if (seq.Step > 0) step = seq.Step;
+		ins.Step = step;
+		program.push_back(ins);
+	}
+	programfile = str;
+	return true;
+}
+
+int ATOLLProcessor::GetStep() const
+{
+	if (pc >= program.size()) return 0;
+	return program[pc].Step;
+}
+
+void ATOLLProcessor::SaveState(FILEHANDLE scn)
+{
+	char buffer[256];
+	double delay;
+
+	if (pc >= program.size()) return;
+
+	//Time to the next statement, the simulation time starts over when the scenario is loaded
+	if (starting)
+		delay = startdelay;
+	else
+		delay = nextitemtime - simtime;
+	if (delay < 0.0) delay = 0.0;
+
+	oapiWriteScenario_string(scn, "ATOLL_PROGRAM", (char *)programfile.c_str());
+	sprintf(buffer, "%d %lf %d", (int)pc, delay, delaystatus ? 1 : 0);
+	oapiWriteScenario_string(scn, "ATOLL_PC", buffer);
+}
+
+bool ATOLLProcessor::LoadState(const char *line)
+{
+	if (!_strnicmp(line, "ATOLL_PROGRAM", 13))
+	{
+		const char *str = line + 13;
+		while (*str == ' ' || *str == '\t') str++;
+		ReadFile(str);
+		return true;
+	}
+	else if (!_strnicmp(line, "ATOLL_PC", 8))
+	{
+		int p, d;
+		double delay;
+
+		if (sscanf_s(line + 8, "%d %lf %d", &p, &delay, &d) == 3 && p >= 0 && p < (int)program.size())
+		{
+			pc = p;
+			startdelay = delay;
+			starting = true;
+			delaystatus = (d != 0);
+		}
+		return true;
+	}
+	return false;
 }
 
 RCA110A::RCA110A()
@@ -328,6 +408,16 @@ void RCA110AL::ReadFile(const char *str)
 	atoll.ReadFile(str);
 }
 
+void RCA110AL::SaveState(FILEHANDLE scn)
+{
+	atoll.SaveState(scn);
+}
+
+bool RCA110AL::LoadState(const char *line)
+{
+	return atoll.LoadState(line);
+}
+
 void RCA110AL::IssueSwitchSelectorCmd(int stage, int chan)
 {
 	if (other)
@@ -25,7 +25,9 @@
 #pragma once
 
 #include <bitset>
-#include <fstream>
+#include <string>
+#include <vector>
+#include "Orbitersdk.h"
 
 #define RCA110A_INPUT_LINES 3024
 #define RCA110A_OUTPUT_LINES 2016
@@ -45,7 +47,7 @@ struct ATOLLSequence
 {
 	ATOLLSequence();
 	void Clear();
-	int GetOperator();
+	int GetOperator() const;
 	bool ReadIn(const char *str);
 
 	int Step;
@@ -60,6 +62,20 @@ struct ATOLLSequence
 	std::string Variable;
 };
 
+//ATOLL statement compiled at load time
+struct ATOLLInstruction
+{
+	int Opcode;
+	//Step label, continuation lines without a step number belong to the step above
+	int Step;
+	int SubStep;
+	int Condition;
+	//Delay in seconds
+	double Time;
+	//DISO: discrete output number, SSEL: stage and switch selector channel
+	int Operand[2];
+};
+
 class RCA110A;
 class RCA110AL;
 
@@ -68,22 +84,29 @@ class ATOLLProcessor
 public:
 	ATOLLProcessor(RCA110AL *r);
 	void Timestep(double simt);
-	void ReadFile(const char *str);
+	bool ReadFile(const char *str);
+	void SaveState(FILEHANDLE scn);
+	bool LoadState(const char *line);
+	bool IsRunning() const { return pc < program.size(); }
+	int GetStep() const;
 private:
-	//Operators
-	void DELY();
-	void DISO();
-	void SCAN();
-	void SSEL();
-
-	ATOLLSequence seq;
-	std::ifstream ifs;
-	char line[128];
-	int opcode;
+	bool Compile(const ATOLLSequence &seq, ATOLLInstruction &ins);
+
+	//Operators, return true when the statement is done
+	bool DELY(const ATOLLInstruction &ins);
+	bool DISO(const ATOLLInstruction &ins);
+	bool SCAN(const ATOLLInstruction &ins);
+	bool SSEL(const ATOLLInstruction &ins);
+
+	std::vector<ATOLLInstruction> program;
+	std::string programfile;
+	size_t pc;
 	RCA110AL *rca110a;
 	double nextitemtime;
 	double simtime;
-	bool skipgetline;
+	//Delay before the next statement when the program is started or restored
+	double startdelay;
+	bool starting;
 	bool delaystatus;
 };
 
@@ -121,6 +144,8 @@ public:
 	void Timestep(double simt, double simdt);
 	void IssueSwitchSelectorCmd(int stage, int chan);
 	void ReadFile(const char *str);
+	void SaveState(FILEHANDLE scn);
+	bool LoadState(const char *line);
 private:
 	PadLCCInterface *lcc;
 	ATOLLProcessor atoll;
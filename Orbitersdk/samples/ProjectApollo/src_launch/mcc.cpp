@@ -26,7 +26,7 @@
 #include "Orbitersdk.h"
 #include "soundlib.h"
 #include "apolloguidance.h"
-#include "csmcomputer.h"
+#include "CSMcomputer.h"
 #include "LEMcomputer.h"
 #include "papi.h"
 #include "saturn.h"
@@ -44,6 +44,7 @@
 #include "rtcc.h"
 #include "LVDC.h"
 #include "iu.h"
+#include "profiler.h"
 
 // This is a threadenwerfer. It werfs threaden.
 static DWORD WINAPI MCC_Trampoline(LPVOID ptr){	
@@ -530,6 +531,15 @@ void MCC::Init(){
 	GroundStations[42].CommCaps = GSGC_TELETYPE|GSGC_SCAMA_VOICE;
 	GroundStations[42].Active = true;
 
+	// Station geometry for the AOS/LOS prediction, only stations with voice count for AOS
+	for (int x = 0; x < MAX_GROUND_STATION; x++) {
+		double range = 0.0;
+		if (GroundStations[x].Active && ((GroundStations[x].USBCaps&GSSC_VOICE) || (GroundStations[x].CommCaps&GSGC_VHFAG_VOICE))) {
+			range = (GroundStations[x].StationPurpose&GSPT_LUNAR) ? 5e8 : 2e7;
+		}
+		Contacts.SetStation(x, GroundStations[x].Position[0], GroundStations[x].Position[1], range);
+	}
+
 	// MISSION STATE
 	MissionPhase = 0;
 	setState(MMST_PRELAUNCH);
@@ -566,6 +576,33 @@ void MCC::Init(){
 	logfileinit = false;
 }
 
+bool MCC::GetContactState(MCCContactState &s){
+	if (cm == NULL || Earth == NULL || Moon == NULL) return false;
+
+	s.SimT = oapiGetSimTime();
+	oapiGetRelativePos(Moon, Earth, &s.R_EM);
+	oapiGetRelativeVel(Moon, Earth, &s.V_EM);
+	cm->GetRelativePos(Earth, s.R);
+	cm->GetRelativeVel(Earth, s.V);
+	// Within lunar SOI the conic is around the Moon
+	s.MoonRef = length(s.R - s.R_EM) < 0.0661e9;
+	if (s.MoonRef) {
+		cm->GetRelativePos(Moon, s.R);
+		cm->GetRelativeVel(Moon, s.V);
+	}
+	oapiGetRotationMatrix(Earth, &s.Rot_E);
+	s.w_E = PI2 / oapiGetPlanetPeriod(Earth);
+	s.R_E = oapiGetSize(Earth);
+	s.R_M = oapiGetSize(Moon);
+	s.mu_E = GGRAV * oapiGetMass(Earth);
+	s.mu_M = GGRAV * oapiGetMass(Moon);
+	return true;
+}
+
+bool MCC::NextAOS(int &station, double &aos){
+	return Contacts.NextAOS(Contacts.GetPrediction(), oapiGetSimTime(), station, aos);
+}
+
 void MCC::setState(int newState){
 	MissionState = newState;
 	SubState = 0;
@@ -589,15 +626,13 @@ void MCC::TimeStep(double simdt){
 	if(GT_Enabled == true){
 		LastAOSUpdate += simdt;
 		if(LastAOSUpdate > 1){
-			double Moonrelang;
-			double LOSRange;
 			VECTOR3 CMGlobalPos = _V(0,0,0);
 			VECTOR3 MoonGlobalPos = _V(0, 0, 0);
-			VECTOR3 CM_Vector = _V(0, 0, 0);
-			VECTOR3 GSGlobalVector = _V(0, 0, 0);
-			VECTOR3 GSVector = _V(0, 0, 0);
-			double R_E, R_M;
-			bool MoonInTheWay;
+			MCCContactState cs;
+			const MCCContactPrediction *pred;
+			bool visible[MCC_CONTACTS_MAX];
+			bool predicted, lost;
+			double aos;
 
 			LastAOSUpdate = 0;
 			// Bail out if we failed to find either major body
@@ -606,9 +641,6 @@ void MCC::TimeStep(double simdt){
 			//Or the CSM
 			if (cm == NULL) { return; }
 
-			R_E = oapiGetSize(Earth);
-			R_M = oapiGetSize(Moon);
-				
 			// Update previous position data
 			CM_Prev_Position[0] = CM_Position[0];
 			CM_Prev_Position[1] = CM_Position[1];
@@ -622,8 +654,6 @@ void MCC::TimeStep(double simdt){
 
 			// Convert to Earth equatorial
 			oapiGlobalToEqu(Earth,CMGlobalPos,&CM_Position[1],&CM_Position[0],&CM_Position[2]);
-			// Convert to Earth equatorial
-			oapiGlobalToLocal(Earth, &CMGlobalPos, &CM_Vector);
 			// Convert to Moon equatorial
 			oapiGlobalToEqu(Moon, CMGlobalPos, &CM_MoonPosition[1], &CM_MoonPosition[0], &CM_MoonPosition[2]);
 			// Convert from radians
@@ -654,44 +684,45 @@ void MCC::TimeStep(double simdt){
 				}
 			}
 
+			// Ground station contacts, from the prediction as long as the CSM stays on the predicted trajectory
+			GetContactState(cs);
+			pred = Contacts.GetPrediction();
+			predicted = Contacts.Lookup(pred, cs, visible);
+			if (!predicted) {
+				Contacts.Visibility(cs, cs.SimT, visible);
+				Contacts.Predict(cs);
+			}
+			else if (cs.SimT > pred->State.SimT + MCC_CONTACTS_REFRESH) {
+				Contacts.Predict(cs);
+			}
+
 			y = 0;
+			lost = false;
 
 			while (x < MAX_GROUND_STATION) {
 				if (GroundStations[x].Active == true) {
-					GSVector = _V(cos(GroundStations[x].Position[1] * RAD)*cos(GroundStations[x].Position[0] * RAD), sin(GroundStations[x].Position[0] * RAD), sin(GroundStations[x].Position[1] * RAD)*cos(GroundStations[x].Position[0] * RAD))*R_E;
-					oapiLocalToGlobal(Earth, &GSVector, &GSGlobalVector);
-					MoonInTheWay = false;
-					if (GroundStations[x].StationPurpose&GSPT_LUNAR)
-					{
-						LOSRange = 5e8;
-					}
-					else
-					{
-						LOSRange = 2e7;
-					}
-					//Moon in the way
-					Moonrelang = dotp(unit(MoonGlobalPos - CMGlobalPos),  unit(GSGlobalVector - CMGlobalPos));
-					if (Moonrelang > cos(asin(R_M / length(MoonGlobalPos - CMGlobalPos))))
-					{
-						MoonInTheWay = true;
-					}
-					if (OrbMech::sight(CM_Vector, GSVector, R_E) && GroundStations[x].AOS == 0 && ((GroundStations[x].USBCaps&GSSC_VOICE) || (GroundStations[x].CommCaps&GSGC_VHFAG_VOICE))) {
-						if (length(CM_Vector - GSVector) < LOSRange && !MoonInTheWay)
-						{
-							GroundStations[x].AOS = 1;
-							sprintf(buf, "AOS %s", GroundStations[x].Name);
-							addMessage(buf);
-						}
+					if (visible[x] && GroundStations[x].AOS == 0) {
+						GroundStations[x].AOS = 1;
+						sprintf(buf, "AOS %s", GroundStations[x].Name);
+						addMessage(buf);
 					}
-					if ((!OrbMech::sight(CM_Vector, GSVector, R_E) || length(CM_Vector - GSVector) > LOSRange || MoonInTheWay) && GroundStations[x].AOS == 1) {
+					if (!visible[x] && GroundStations[x].AOS == 1) {
 						GroundStations[x].AOS = 0;
 						sprintf(buf, "LOS %s", GroundStations[x].Name);
 						addMessage(buf);
+						lost = true;
 					}
 					if (GroundStations[x].AOS) { y++; }
 				}
 				x++;
 			}
+
+			// Out of contact with all stations
+			if (lost && y == 0 && predicted && NextAOS(z, aos)) {
+				aos -= cs.SimT;
+				sprintf(buf, "Next AOS %s in %d:%02d", GroundStations[z].Name, (int)(aos / 60.0), (int)aos % 60);
+				addMessage(buf);
+			}
 		}
 	}
 
@@ -1134,6 +1165,7 @@ void MCC::pushUplinkData(unsigned char data) {
 // Uplink string to CM
 int MCC::CM_uplink(const unsigned char *data, int len) {
 	int remsize = 2048;
+	cm->GetSystemsStepper()->Wait();
 	remsize -= cm->pcm.mcc_size;
 	// if (cm->pcm.mcc_size > 0) { return -1; } // If busy, bail
 	if (len > remsize) { return -2; } // Too long!
@@ -1145,6 +1177,7 @@ int MCC::CM_uplink(const unsigned char *data, int len) {
 // Uplink string to LM
 int MCC::LM_uplink(const unsigned char *data, int len) {
 	int remsize = 2048;
+	lm->GetSystemsStepper()->Wait();
 	remsize -= lm->PCM.mcc_size;
 	// if (lm->pcm.mcc_size > 0) { return -1; } // If busy, bail
 	if (len > remsize) { return -2; } // Too long!
@@ -1173,6 +1206,7 @@ int MCC::LM_uplink_buffer() {
 
 // Subthread Entry Point
 int MCC::subThread(){
+	PROFILESCOPE("MCC::subThread");
 	int Result = 0;
 	subThreadStatus = 2; // Running
 	
@@ -25,6 +25,7 @@
 #define _PA_MCC_H
 
 #include "MCCPADForms.h"
+#include "MCCContacts.h"
 #include <fstream>
 
 // Save file strings
@@ -238,6 +239,8 @@ public:
 	
 	void Init();											// Initialization
 	void TimeStep(double simdt);					        // Timestep
+	bool GetContactState(MCCContactState &s);				// State for the AOS/LOS prediction
+	bool NextAOS(int &station, double &aos);				// Next predicted AOS, simulation time
 	virtual void keyDown(DWORD key);						// Notification of keypress	
 	void addMessage(char *msg);								// Add message into buffer
 	void redisplayMessages();								// Cause messages in ring buffer to be redisplayed
@@ -290,6 +293,7 @@ public:
 	// GROUND TRACKING NETWORK
 	struct GroundStation GroundStations[MAX_GROUND_STATION]; // Ground Station Array
 	double LastAOSUpdate;									// Last update to AOS data
+	MCCContacts Contacts;									// AOS/LOS prediction
 	double CM_Position[3];                                  // CM's position and altitude
 	double CM_Prev_Position[3];                             // CM's previous position and altitude
 	double CM_MoonPosition[3];                              // CM's position and altitude relative to the Moon
@@ -28,8 +28,9 @@ See http://nassp.sourceforge.net/license/ for more details.
 #include "ioChannels.h"
 #include "apolloguidance.h"
 #include "dsky.h"
-#include "csmcomputer.h"
+#include "CSMcomputer.h"
 #include "papi.h"
+#include "ScenarioCodec.h"
 #include "saturn.h"
 #include "LEMcomputer.h"
 #include "LEM.h"
@@ -41,24 +42,18 @@ See http://nassp.sourceforge.net/license/ for more details.
 #include "../src_rtccmfd/GeneralizedIterator.h"
 #include "../src_rtccmfd/EnckeIntegrator.h"
 #include "../src_rtccmfd/ReentryNumericalIntegrator.h"
+#include "../src_rtccmfd/EntryDispersion.h"
 #include "mcc.h"
 #include "rtcc.h"
 
 // SCENARIO FILE MACROLOGY
 #define SAVE_BOOL(KEY,VALUE) oapiWriteScenario_int(scn, KEY, VALUE)
 #define SAVE_INT(KEY,VALUE) oapiWriteScenario_int(scn, KEY, VALUE)
-#define SAVE_DOUBLE(KEY,VALUE) papiWriteScenario_double(scn, KEY, VALUE)
-#define SAVE_DOUBLE2(KEY,VALUE1, VALUE2) papiWriteScenario_double2(scn, KEY, VALUE1, VALUE2)
-#define SAVE_V3(KEY,VALUE) papiWriteScenario_vec(scn, KEY, VALUE)
-#define SAVE_M3(KEY,VALUE) papiWriteScenario_mx(scn, KEY, VALUE)
+#define SAVE_DOUBLE(KEY,VALUE) ScenarioWrite_double(scn, KEY, VALUE)
+#define SAVE_DOUBLE2(KEY,VALUE1, VALUE2) ScenarioWrite_double2(scn, KEY, VALUE1, VALUE2)
+#define SAVE_V3(KEY,VALUE) ScenarioWrite_vec(scn, KEY, VALUE)
+#define SAVE_M3(KEY,VALUE) ScenarioWrite_mx(scn, KEY, VALUE)
 #define SAVE_STRING(KEY,VALUE) oapiWriteScenario_string(scn, KEY, VALUE)
-#define LOAD_BOOL(KEY,VALUE) if(strnicmp(line, KEY, strlen(KEY)) == 0){ sscanf(line + strlen(KEY), "%i", &tmp); if (tmp == 1) { VALUE = true; } else { VALUE = false; } }
-#define LOAD_INT(KEY,VALUE) if(strnicmp(line,KEY,strlen(KEY))==0){ sscanf(line+strlen(KEY),"%i",&VALUE); }
-#define LOAD_DOUBLE(KEY,VALUE) if(strnicmp(line,KEY,strlen(KEY))==0){ sscanf(line+strlen(KEY),"%lf",&VALUE); }
-#define LOAD_DOUBLE2(KEY,VALUE1, VALUE2) if(strnicmp(line,KEY,strlen(KEY))==0){ sscanf(line+strlen(KEY),"%lf %lf",&VALUE1, &VALUE2); }
-#define LOAD_V3(KEY,VALUE) if(strnicmp(line,KEY,strlen(KEY))==0){ sscanf(line+strlen(KEY),"%lf %lf %lf",&VALUE.x,&VALUE.y,&VALUE.z); }
-#define LOAD_M3(KEY,VALUE) if(strnicmp(line,KEY,strlen(KEY))==0){ sscanf(line+strlen(KEY),"%lf %lf %lf %lf %lf %lf %lf %lf %lf",&VALUE.m11,&VALUE.m12,&VALUE.m13,&VALUE.m21,&VALUE.m22,&VALUE.m23,&VALUE.m31,&VALUE.m32,&VALUE.m33); }
-#define LOAD_STRING(KEY,VALUE,LEN) if(strnicmp(line,KEY,strlen(KEY))==0){ strncpy(VALUE, line + (strlen(KEY)+1), LEN); }
 
 void format_time_rtcc(char *buf, double time) {
 	buf[0] = 0; // Clobber
@@ -72,8 +67,7 @@ void format_time_rtcc(char *buf, double time) {
 
 void papiWriteScenario_SV(FILEHANDLE scn, char *item, SV sv)
 {
-
-	char buffer[256], name[16];
+	char name[16];
 
 	if (sv.gravref)
 	{
@@ -84,78 +78,69 @@ void papiWriteScenario_SV(FILEHANDLE scn, char *item, SV sv)
 		sprintf(name, "None");
 	}
 
-	sprintf(buffer, "  %s %s %.12lf %.12lf %.12lf %.12lf %.12lf %.12lf %.12lf %.12lf", item, name, sv.mass, sv.MJD, sv.R.x, sv.R.y, sv.R.z, sv.V.x, sv.V.y, sv.V.z);
-	oapiWriteLine(scn, buffer);
+	ScenarioWriter(item).String(name).Double(sv.mass).Double(sv.MJD).Vec(sv.R).Vec(sv.V).Write(scn);
 }
 
-bool papiReadScenario_SV(char *line, char *item, SV &sv)
+bool papiReadScenario_SV(const ScenarioLine &l, SV &sv)
 {
+	double d[8];
 
-	char buffer[256], name[16];
-	SV v;
-
-	if (sscanf(line, "%s", buffer) == 1) {
-		if (!strcmp(buffer, item)) {
-			if (sscanf(line, "%s %s %lf %lf %lf %lf %lf %lf %lf %lf", buffer, name, &v.mass, &v.MJD, &v.R.x, &v.R.y, &v.R.z, &v.V.x, &v.V.y, &v.V.z) == 10) {
-				v.gravref = oapiGetObjectByName(name);
-				sv = v;
-				return true;
-			}
-		}
+	if (l.Count() >= 10 && l.Doubles(2, d, 8))
+	{
+		sv.gravref = oapiGetObjectByName((char *)l.Token(1));
+		sv.mass = d[0];
+		sv.MJD = d[1];
+		sv.R = _V(d[2], d[3], d[4]);
+		sv.V = _V(d[5], d[6], d[7]);
+		return true;
 	}
 	return false;
 }
 
 void papiWriteScenario_SV(FILEHANDLE scn, char *item, EphemerisData sv) {
 
-	char buffer[256];
-
-	sprintf(buffer, "  %s %d %.12lf %.12lf %.12lf %.12lf %.12lf %.12lf %.12lf", item, sv.RBI, sv.GMT, sv.R.x, sv.R.y, sv.R.z, sv.V.x, sv.V.y, sv.V.z);
-	oapiWriteLine(scn, buffer);
+	ScenarioWriter(item).Int(sv.RBI).Double(sv.GMT).Vec(sv.R).Vec(sv.V).Write(scn);
 }
 
 void papiWriteScenario_SV(FILEHANDLE scn, char *item, int i, RTCC::StateVectorTableEntry vec) {
 
-	char buffer[256];
-
-	sprintf(buffer, "  %s %d %s %d %d %.12lf %.12lf %.12lf %.12lf %.12lf %.12lf %.12lf %d", item, i, vec.VectorCode.c_str(), vec.ID, vec.Vector.RBI, vec.Vector.GMT, vec.Vector.R.x, vec.Vector.R.y, vec.Vector.R.z, vec.Vector.V.x, vec.Vector.V.y, vec.Vector.V.z, vec.LandingSiteIndicator);
-	oapiWriteLine(scn, buffer);
+	ScenarioWriter(item).Int(i).String(vec.VectorCode.c_str()).Int(vec.ID).Int(vec.Vector.RBI).Double(vec.Vector.GMT).Vec(vec.Vector.R).Vec(vec.Vector.V).Int(vec.LandingSiteIndicator).Write(scn);
 }
 
-bool papiReadScenario_SV(char *line, char *item, EphemerisData &sv)
+bool papiReadScenario_SV(const ScenarioLine &l, EphemerisData &sv)
 {
-	char buffer[256];
+	EphemerisData v;
+	double d[7];
 
-	if (sscanf(line, "%s", buffer) == 1) {
-		if (!strcmp(buffer, item)) {
-			EphemerisData v;
-			if (sscanf(line, "%s %d %lf %lf %lf %lf %lf %lf %lf", buffer, &v.RBI, &v.GMT, &v.R.x, &v.R.y, &v.R.z, &v.V.x, &v.V.y, &v.V.z) == 9) {
-				sv = v;
-				return true;
-			}
-		}
+	if (l.Int(1, v.RBI) && l.Doubles(2, d, 7))
+	{
+		v.GMT = d[0];
+		v.R = _V(d[1], d[2], d[3]);
+		v.V = _V(d[4], d[5], d[6]);
+		sv = v;
+		return true;
 	}
 	return false;
 }
 
-bool papiReadScenario_SV(char *line, char *item, RTCC::StateVectorTableEntry *vec)
+bool papiReadScenario_SV(const ScenarioLine &l, RTCC::StateVectorTableEntry *vec, int len)
 {
-	char buffer[256];
+	EphemerisData v;
+	double d[7];
+	int i, ID, LSInd;
 
-	if (sscanf(line, "%s", buffer) == 1) {
-		if (!strcmp(buffer, item)) {
-			char buffer2[64];
-			int i, ID, LSInd;
-
-			EphemerisData v;
-			if (sscanf(line, "%s %d %s %d %d %lf %lf %lf %lf %lf %lf %lf %d", buffer, &i, buffer2, &ID, &v.RBI, &v.GMT, &v.R.x, &v.R.y, &v.R.z, &v.V.x, &v.V.y, &v.V.z, &LSInd) == 13) {
-				vec[i].ID = ID;
-				vec[i].VectorCode.assign(buffer2);
-				vec[i].Vector = v;
-				vec[i].LandingSiteIndicator = (LSInd != 0);
-				return true;
-			}
-		}
+	if (l.Int(1, i) && l.Int(3, ID) && l.Int(4, v.RBI) && l.Doubles(5, d, 7) && l.Int(12, LSInd))
+	{
+		if (i < 0 || i >= len) return false;
+
+		v.GMT = d[0];
+		v.R = _V(d[1], d[2], d[3]);
+		v.V = _V(d[4], d[5], d[6]);
+		vec[i].ID = ID;
+		vec[i].VectorCode.assign(l.Token(2));
+		vec[i].Vector = v;
+		vec[i].LandingSiteIndicator = (LSInd != 0);
+		return true;
 	}
 	return false;
 }
@@ -493,43 +478,45 @@ void MPTVehicleDataBlock::SaveState(FILEHANDLE scn)
 	oapiWriteScenario_int(scn, "ConfigCode", ConfigCode.to_ulong());
 	oapiWriteScenario_int(scn, "ConfigChangeInd", ConfigChangeInd);
 	oapiWriteScenario_int(scn, "TUP", TUP);
-	papiWriteScenario_double(scn, "CSMArea", CSMArea);
-	papiWriteScenario_double(scn, "SIVBArea", SIVBArea);
-	papiWriteScenario_double(scn, "LMAscentArea", LMAscentArea);
-	papiWriteScenario_double(scn, "LMDescentArea", LMDescentArea);
-	papiWriteScenario_double(scn, "CSMMass", CSMMass);
-	papiWriteScenario_double(scn, "SIVBMass", SIVBMass);
-	papiWriteScenario_double(scn, "LMAscentMass", LMAscentMass);
-	papiWriteScenario_double(scn, "LMDescentMass", LMDescentMass);
-	papiWriteScenario_double(scn, "CSMRCSFuelRemaining", CSMRCSFuelRemaining);
-	papiWriteScenario_double(scn, "SPSFuelRemaining", SPSFuelRemaining);
-	papiWriteScenario_double(scn, "SIVBFuelRemaining", SIVBFuelRemaining);
-	papiWriteScenario_double(scn, "LMRCSFuelRemaining", LMRCSFuelRemaining);
-	papiWriteScenario_double(scn, "LMAPSFuelRemaining", LMAPSFuelRemaining);
-	papiWriteScenario_double(scn, "LMDPSFuelRemaining", LMDPSFuelRemaining);
-}
-void MPTVehicleDataBlock::LoadState(char *line, int &inttemp)
-{
-	if (papiReadScenario_int(line, "ConfigCode", inttemp))
-	{
-		ConfigCode = inttemp;
-	}
-	papiReadScenario_int(line, "ConfigChangeInd", ConfigChangeInd);
-	papiReadScenario_int(line, "TUP", TUP);
-	papiReadScenario_double(line, "CSMArea", CSMArea);
-	papiReadScenario_double(line, "SIVBArea", SIVBArea);
-	papiReadScenario_double(line, "LMAscentArea", LMAscentArea);
-	papiReadScenario_double(line, "LMDescentArea", LMDescentArea);
-	papiReadScenario_double(line, "CSMMass", CSMMass);
-	papiReadScenario_double(line, "SIVBMass", SIVBMass);
-	papiReadScenario_double(line, "LMAscentMass", LMAscentMass);
-	papiReadScenario_double(line, "LMDescentMass", LMDescentMass);
-	papiReadScenario_double(line, "CSMRCSFuelRemaining", CSMRCSFuelRemaining);
-	papiReadScenario_double(line, "SPSFuelRemaining", SPSFuelRemaining);
-	papiReadScenario_double(line, "SIVBFuelRemaining", SIVBFuelRemaining);
-	papiReadScenario_double(line, "LMRCSFuelRemaining", LMRCSFuelRemaining);
-	papiReadScenario_double(line, "LMAPSFuelRemaining", LMAPSFuelRemaining);
-	papiReadScenario_double(line, "LMDPSFuelRemaining", LMDPSFuelRemaining);
+	ScenarioWrite_double(scn, "CSMArea", CSMArea);
+	ScenarioWrite_double(scn, "SIVBArea", SIVBArea);
+	ScenarioWrite_double(scn, "LMAscentArea", LMAscentArea);
+	ScenarioWrite_double(scn, "LMDescentArea", LMDescentArea);
+	ScenarioWrite_double(scn, "CSMMass", CSMMass);
+	ScenarioWrite_double(scn, "SIVBMass", SIVBMass);
+	ScenarioWrite_double(scn, "LMAscentMass", LMAscentMass);
+	ScenarioWrite_double(scn, "LMDescentMass", LMDescentMass);
+	ScenarioWrite_double(scn, "CSMRCSFuelRemaining", CSMRCSFuelRemaining);
+	ScenarioWrite_double(scn, "SPSFuelRemaining", SPSFuelRemaining);
+	ScenarioWrite_double(scn, "SIVBFuelRemaining", SIVBFuelRemaining);
+	ScenarioWrite_double(scn, "LMRCSFuelRemaining", LMRCSFuelRemaining);
+	ScenarioWrite_double(scn, "LMAPSFuelRemaining", LMAPSFuelRemaining);
+	ScenarioWrite_double(scn, "LMDPSFuelRemaining", LMDPSFuelRemaining);
+}
+void MPTVehicleDataBlock::LoadState(ScenarioReader &r)
+{
+	r.Call("ConfigCode", [this](const ScenarioLine &l)
+	{
+		int i;
+
+		if (l.Int(1, i)) ConfigCode = i;
+	});
+	r.Int("ConfigChangeInd", ConfigChangeInd);
+	r.Int("TUP", TUP);
+	r.Double("CSMArea", CSMArea);
+	r.Double("SIVBArea", SIVBArea);
+	r.Double("LMAscentArea", LMAscentArea);
+	r.Double("LMDescentArea", LMDescentArea);
+	r.Double("CSMMass", CSMMass);
+	r.Double("SIVBMass", SIVBMass);
+	r.Double("LMAscentMass", LMAscentMass);
+	r.Double("LMDescentMass", LMDescentMass);
+	r.Double("CSMRCSFuelRemaining", CSMRCSFuelRemaining);
+	r.Double("SPSFuelRemaining", SPSFuelRemaining);
+	r.Double("SIVBFuelRemaining", SIVBFuelRemaining);
+	r.Double("LMRCSFuelRemaining", LMRCSFuelRemaining);
+	r.Double("LMAPSFuelRemaining", LMAPSFuelRemaining);
+	r.Double("LMDPSFuelRemaining", LMDPSFuelRemaining);
 }
 
 MPTManeuver::MPTManeuver()
@@ -634,7 +621,7 @@ void MPTManeuver::SaveState(FILEHANDLE scn, char *start_str, char *end_str)
 	CommonBlock.SaveState(scn);
 	sprintf_s(Buff, StationIDFrozen.c_str());
 	oapiWriteScenario_string(scn, "StationIDFrozen", Buff);
-	papiWriteScenario_double(scn, "GMTFrozen", GMTFrozen);
+	ScenarioWrite_double(scn, "GMTFrozen", GMTFrozen);
 	oapiWriteScenario_int(scn, "AttitudeCode", AttitudeCode);
 	oapiWriteScenario_int(scn, "Thruster", Thruster);
 	oapiWriteScenario_int(scn, "UllageThrusterOpt", UllageThrusterOpt);
@@ -646,221 +633,218 @@ void MPTManeuver::SaveState(FILEHANDLE scn, char *start_str, char *end_str)
 	oapiWriteScenario_int(scn, "RefBodyInd", RefBodyInd);
 	oapiWriteScenario_int(scn, "CoordSysInd", CoordSysInd);
 	oapiWriteScenario_int(scn, "HeadsUpDownInd", HeadsUpDownInd);
-	papiWriteScenario_double(scn, "DockingAngle", DockingAngle);
-	papiWriteScenario_double(scn, "GMTMAN", GMTMAN);
-	papiWriteScenario_double(scn, "dt_ullage", dt_ullage);
-	papiWriteScenario_double(scn, "DT_10PCT", DT_10PCT);
-	papiWriteScenario_double(scn, "dt", dt);
-	papiWriteScenario_double(scn, "dv", dv);
-	papiWriteScenario_vec(scn, "A_T", A_T);
-	papiWriteScenario_vec(scn, "X_B", X_B);
-	papiWriteScenario_vec(scn, "Y_B", Y_B);
-	papiWriteScenario_vec(scn, "Z_B", Z_B);
+	ScenarioWrite_double(scn, "DockingAngle", DockingAngle);
+	ScenarioWrite_double(scn, "GMTMAN", GMTMAN);
+	ScenarioWrite_double(scn, "dt_ullage", dt_ullage);
+	ScenarioWrite_double(scn, "DT_10PCT", DT_10PCT);
+	ScenarioWrite_double(scn, "dt", dt);
+	ScenarioWrite_double(scn, "dv", dv);
+	ScenarioWrite_vec(scn, "A_T", A_T);
+	ScenarioWrite_vec(scn, "X_B", X_B);
+	ScenarioWrite_vec(scn, "Y_B", Y_B);
+	ScenarioWrite_vec(scn, "Z_B", Z_B);
 	papiWriteScenario_SV(scn, "FrozenManeuverVector", FrozenManeuverVector);
-	papiWriteScenario_double(scn, "DPSScaleFactor", DPSScaleFactor);
-	papiWriteScenario_vec(scn, "dV_inertial", dV_inertial);
-	papiWriteScenario_vec(scn, "dV_LVLH", dV_LVLH);
+	ScenarioWrite_double(scn, "DPSScaleFactor", DPSScaleFactor);
+	ScenarioWrite_vec(scn, "dV_inertial", dV_inertial);
+	ScenarioWrite_vec(scn, "dV_LVLH", dV_LVLH);
 	if (AttitudeCode == RTCC_ATTITUDE_SIVB_IGM)
 	{
-		papiWriteScenario_double(scn, "Word67d", Word67d);
+		ScenarioWrite_double(scn, "Word67d", Word67d);
 	}
 	else
 	{
 		papiWriteScenario_intarr(scn, "Word67i", Word67i, 2);
 	}
-	papiWriteScenario_double(scn, "Word68", Word68);
-	papiWriteScenario_double(scn, "Word69", Word69);
-	papiWriteScenario_double(scn, "Word70", Word70);
-	papiWriteScenario_double(scn, "Word71", Word71);
-	papiWriteScenario_double(scn, "Word72", Word72);
-	papiWriteScenario_double(scn, "Word73", Word73);
-	papiWriteScenario_double(scn, "Word74", Word74);
-	papiWriteScenario_double(scn, "Word75", Word75);
-	papiWriteScenario_double(scn, "Word76", Word76);
-	papiWriteScenario_double(scn, "Word77", Word77);
+	ScenarioWrite_double(scn, "Word68", Word68);
+	ScenarioWrite_double(scn, "Word69", Word69);
+	ScenarioWrite_double(scn, "Word70", Word70);
+	ScenarioWrite_double(scn, "Word71", Word71);
+	ScenarioWrite_double(scn, "Word72", Word72);
+	ScenarioWrite_double(scn, "Word73", Word73);
+	ScenarioWrite_double(scn, "Word74", Word74);
+	ScenarioWrite_double(scn, "Word75", Word75);
+	ScenarioWrite_double(scn, "Word76", Word76);
+	ScenarioWrite_double(scn, "Word77", Word77);
 	if (AttitudeCode == RTCC_ATTITUDE_SIVB_IGM)
 	{
 		papiWriteScenario_intarr(scn, "Word78i", Word78i, 2);
 	}
 	else
 	{
-		papiWriteScenario_double(scn, "Word78d", Word78d);
+		ScenarioWrite_double(scn, "Word78d", Word78d);
 	}
-	papiWriteScenario_double(scn, "Word79", Word79);
-	papiWriteScenario_double(scn, "Word80", Word80);
-	papiWriteScenario_double(scn, "Word81", Word81);
-	papiWriteScenario_double(scn, "Word82", Word82);
-	papiWriteScenario_double(scn, "Word83", Word83);
-	papiWriteScenario_double(scn, "Word84", Word84);
-	papiWriteScenario_double(scn, "GMTI", GMTI);
+	ScenarioWrite_double(scn, "Word79", Word79);
+	ScenarioWrite_double(scn, "Word80", Word80);
+	ScenarioWrite_double(scn, "Word81", Word81);
+	ScenarioWrite_double(scn, "Word82", Word82);
+	ScenarioWrite_double(scn, "Word83", Word83);
+	ScenarioWrite_double(scn, "Word84", Word84);
+	ScenarioWrite_double(scn, "GMTI", GMTI);
 	papiWriteScenario_intarr(scn, "TrajDet", TrajDet, 3);
-	papiWriteScenario_vec(scn, "R_BI", R_BI);
-	papiWriteScenario_vec(scn, "V_BI", V_BI);
-	papiWriteScenario_double(scn, "GMT_BI", GMT_BI);
-	papiWriteScenario_vec(scn, "R_BO", R_BO);
-	papiWriteScenario_vec(scn, "V_BO", V_BO);
-	papiWriteScenario_double(scn, "GMT_BO", GMT_BO);
-	papiWriteScenario_vec(scn, "R_1", R_1);
-	papiWriteScenario_vec(scn, "V_1", V_1);
-	papiWriteScenario_double(scn, "GMT_1", GMT_1);
-	papiWriteScenario_double(scn, "TotalMassAfter", TotalMassAfter);
-	papiWriteScenario_double(scn, "TotalAreaAfter", TotalAreaAfter);
-	papiWriteScenario_double(scn, "MainEngineFuelUsed", MainEngineFuelUsed);
-	papiWriteScenario_double(scn, "RCSFuelUsed", RCSFuelUsed);
-	papiWriteScenario_double(scn, "DVREM", DVREM);
-	papiWriteScenario_double(scn, "DVC", DVC);
-	papiWriteScenario_double(scn, "DVXBT", DVXBT);
-	papiWriteScenario_double(scn, "DV_M", DV_M);
-	papiWriteScenario_double(scn, "V_F", V_F);
-	papiWriteScenario_double(scn, "V_S", V_S);
-	papiWriteScenario_double(scn, "V_D", V_D);
-	papiWriteScenario_double(scn, "P_H", P_H);
-	papiWriteScenario_double(scn, "Y_H", Y_H);
-	papiWriteScenario_double(scn, "R_H", R_H);
-	papiWriteScenario_double(scn, "dt_BD", dt_BD);
-	papiWriteScenario_double(scn, "dt_TO", dt_TO);
-	papiWriteScenario_double(scn, "dv_TO", dv_TO);
-	papiWriteScenario_double(scn, "P_G", P_G);
-	papiWriteScenario_double(scn, "Y_G", Y_G);
-	papiWriteScenario_double(scn, "lat_BI", lat_BI);
-	papiWriteScenario_double(scn, "lng_BI", lng_BI);
-	papiWriteScenario_double(scn, "h_BI", h_BI);
-	papiWriteScenario_double(scn, "eta_BI", eta_BI);
-	papiWriteScenario_double(scn, "e_BO", e_BO);
-	papiWriteScenario_double(scn, "i_BO", i_BO);
-	papiWriteScenario_double(scn, "g_BO", g_BO);
-	papiWriteScenario_double(scn, "h_a", h_a);
-	papiWriteScenario_double(scn, "lat_a", lat_a);
-	papiWriteScenario_double(scn, "lng_a", lng_a);
-	papiWriteScenario_double(scn, "GMT_a", GMT_a);
-	papiWriteScenario_double(scn, "h_p", h_p);
-	papiWriteScenario_double(scn, "lat_p", lat_p);
-	papiWriteScenario_double(scn, "lng_p", lng_p);
-	papiWriteScenario_double(scn, "GMT_p", GMT_p);
-	papiWriteScenario_double(scn, "GMT_AN", GMT_AN);
-	papiWriteScenario_double(scn, "lng_AN", lng_AN);
-	papiWriteScenario_double(scn, "IMPT", IMPT);
+	ScenarioWrite_vec(scn, "R_BI", R_BI);
+	ScenarioWrite_vec(scn, "V_BI", V_BI);
+	ScenarioWrite_double(scn, "GMT_BI", GMT_BI);
+	ScenarioWrite_vec(scn, "R_BO", R_BO);
+	ScenarioWrite_vec(scn, "V_BO", V_BO);
+	ScenarioWrite_double(scn, "GMT_BO", GMT_BO);
+	ScenarioWrite_vec(scn, "R_1", R_1);
+	ScenarioWrite_vec(scn, "V_1", V_1);
+	ScenarioWrite_double(scn, "GMT_1", GMT_1);
+	ScenarioWrite_double(scn, "TotalMassAfter", TotalMassAfter);
+	ScenarioWrite_double(scn, "TotalAreaAfter", TotalAreaAfter);
+	ScenarioWrite_double(scn, "MainEngineFuelUsed", MainEngineFuelUsed);
+	ScenarioWrite_double(scn, "RCSFuelUsed", RCSFuelUsed);
+	ScenarioWrite_double(scn, "DVREM", DVREM);
+	ScenarioWrite_double(scn, "DVC", DVC);
+	ScenarioWrite_double(scn, "DVXBT", DVXBT);
+	ScenarioWrite_double(scn, "DV_M", DV_M);
+	ScenarioWrite_double(scn, "V_F", V_F);
+	ScenarioWrite_double(scn, "V_S", V_S);
+	ScenarioWrite_double(scn, "V_D", V_D);
+	ScenarioWrite_double(scn, "P_H", P_H);
+	ScenarioWrite_double(scn, "Y_H", Y_H);
+	ScenarioWrite_double(scn, "R_H", R_H);
+	ScenarioWrite_double(scn, "dt_BD", dt_BD);
+	ScenarioWrite_double(scn, "dt_TO", dt_TO);
+	ScenarioWrite_double(scn, "dv_TO", dv_TO);
+	ScenarioWrite_double(scn, "P_G", P_G);
+	ScenarioWrite_double(scn, "Y_G", Y_G);
+	ScenarioWrite_double(scn, "lat_BI", lat_BI);
+	ScenarioWrite_double(scn, "lng_BI", lng_BI);
+	ScenarioWrite_double(scn, "h_BI", h_BI);
+	ScenarioWrite_double(scn, "eta_BI", eta_BI);
+	ScenarioWrite_double(scn, "e_BO", e_BO);
+	ScenarioWrite_double(scn, "i_BO", i_BO);
+	ScenarioWrite_double(scn, "g_BO", g_BO);
+	ScenarioWrite_double(scn, "h_a", h_a);
+	ScenarioWrite_double(scn, "lat_a", lat_a);
+	ScenarioWrite_double(scn, "lng_a", lng_a);
+	ScenarioWrite_double(scn, "GMT_a", GMT_a);
+	ScenarioWrite_double(scn, "h_p", h_p);
+	ScenarioWrite_double(scn, "lat_p", lat_p);
+	ScenarioWrite_double(scn, "lng_p", lng_p);
+	ScenarioWrite_double(scn, "GMT_p", GMT_p);
+	ScenarioWrite_double(scn, "GMT_AN", GMT_AN);
+	ScenarioWrite_double(scn, "lng_AN", lng_AN);
+	ScenarioWrite_double(scn, "IMPT", IMPT);
 
 	oapiWriteLine(scn, end_str);
 }
 
 void MPTManeuver::LoadState(FILEHANDLE scn, char *end_str)
 {
-	char Buff[128];
+	ScenarioReader r;
 	char *line;
-	int inttemp;
+
+	r.String("code", code);
+	CommonBlock.LoadState(r);
+	r.String("StationIDFrozen", StationIDFrozen);
+	r.Double("GMTFrozen", GMTFrozen);
+	r.Int("AttitudeCode", AttitudeCode);
+	r.Int("Thruster", Thruster);
+	r.Bool("UllageThrusterOpt", UllageThrusterOpt);
+	r.Bool("AttitudesInput", AttitudesInput);
+	r.Call("ConfigCodeBefore", [this](const ScenarioLine &l)
+	{
+		int i;
+
+		if (l.Int(1, i)) ConfigCodeBefore = i;
+	});
+	r.Int("TVC", TVC);
+	r.Int("TrimAngleInd", TrimAngleInd);
+	r.Bool("FrozenManeuverInd", FrozenManeuverInd);
+	r.Int("RefBodyInd", RefBodyInd);
+	r.Int("CoordSysInd", CoordSysInd);
+	r.Bool("HeadsUpDownInd", HeadsUpDownInd);
+	r.Double("DockingAngle", DockingAngle);
+	r.Double("GMTMAN", GMTMAN);
+	r.Double("dt_ullage", dt_ullage);
+	r.Double("DT_10PCT", DT_10PCT);
+	r.Double("dt", dt);
+	r.Double("dv", dv);
+	r.Vec("A_T", A_T);
+	r.Vec("X_B", X_B);
+	r.Vec("Y_B", Y_B);
+	r.Vec("Z_B", Z_B);
+	r.Call("FrozenManeuverVector", [this](const ScenarioLine &l) { papiReadScenario_SV(l, FrozenManeuverVector); });
+	r.Double("DPSScaleFactor", DPSScaleFactor);
+	r.Vec("dV_inertial", dV_inertial);
+	r.Vec("dV_LVLH", dV_LVLH);
+	r.Double("Word67d", Word67d);
+	r.Ints("Word67i", Word67i, 2);
+	r.Double("Word68", Word68);
+	r.Double("Word69", Word69);
+	r.Double("Word70", Word70);
+	r.Double("Word71", Word71);
+	r.Double("Word72", Word72);
+	r.Double("Word73", Word73);
+	r.Double("Word74", Word74);
+	r.Double("Word75", Word75);
+	r.Double("Word76", Word76);
+	r.Double("Word77", Word77);
+	r.Double("Word78d", Word78d);
+	r.Ints("Word78i", Word78i, 2);
+	r.Double("Word79", Word79);
+	r.Double("Word80", Word80);
+	r.Double("Word81", Word81);
+	r.Double("Word82", Word82);
+	r.Double("Word83", Word83);
+	r.Double("Word84", Word84);
+	r.Double("GMTI", GMTI);
+	r.Ints("TrajDet", TrajDet, 3);
+	r.Vec("R_BI", R_BI);
+	r.Vec("V_BI", V_BI);
+	r.Double("GMT_BI", GMT_BI);
+	r.Vec("R_BO", R_BO);
+	r.Vec("V_BO", V_BO);
+	r.Double("GMT_BO", GMT_BO);
+	r.Vec("R_1", R_1);
+	r.Vec("V_1", V_1);
+	r.Double("GMT_1", GMT_1);
+	r.Double("TotalMassAfter", TotalMassAfter);
+	r.Double("TotalAreaAfter", TotalAreaAfter);
+	r.Double("MainEngineFuelUsed", MainEngineFuelUsed);
+	r.Double("RCSFuelUsed", RCSFuelUsed);
+	r.Double("DVREM", DVREM);
+	r.Double("DVC", DVC);
+	r.Double("DVXBT", DVXBT);
+	r.Double("DV_M", DV_M);
+	r.Double("V_F", V_F);
+	r.Double("V_S", V_S);
+	r.Double("V_D", V_D);
+	r.Double("P_H", P_H);
+	r.Double("Y_H", Y_H);
+	r.Double("R_H", R_H);
+	r.Double("dt_BD", dt_BD);
+	r.Double("dt_TO", dt_TO);
+	r.Double("dv_TO", dv_TO);
+	r.Double("P_G", P_G);
+	r.Double("Y_G", Y_G);
+	r.Double("lat_BI", lat_BI);
+	r.Double("lng_BI", lng_BI);
+	r.Double("h_BI", h_BI);
+	r.Double("eta_BI", eta_BI);
+	r.Double("e_BO", e_BO);
+	r.Double("i_BO", i_BO);
+	r.Double("g_BO", g_BO);
+	r.Double("h_a", h_a);
+	r.Double("lat_a", lat_a);
+	r.Double("lng_a", lng_a);
+	r.Double("GMT_a", GMT_a);
+	r.Double("h_p", h_p);
+	r.Double("lat_p", lat_p);
+	r.Double("lng_p", lng_p);
+	r.Double("GMT_p", GMT_p);
+	r.Double("GMT_AN", GMT_AN);
+	r.Double("lng_AN", lng_AN);
+	r.Double("IMPT", IMPT);
 
 	while (oapiReadScenario_nextline(scn, line)) {
 		if (!strnicmp(line, end_str, sizeof(end_str))) {
 			break;
 		}
 
-		if (papiReadScenario_string(line, "code", Buff))
-		{
-			code.assign(Buff);
-		}
-		CommonBlock.LoadState(line, inttemp);
-		if (papiReadScenario_string(line, "StationIDFrozen", Buff))
-		{
-			StationIDFrozen.assign(Buff);
-		}
-		papiReadScenario_double(line, "GMTFrozen", GMTFrozen);
-		papiReadScenario_int(line, "AttitudeCode", AttitudeCode);
-		papiReadScenario_int(line, "Thruster", Thruster);
-		papiReadScenario_bool(line, "UllageThrusterOpt", UllageThrusterOpt);
-		papiReadScenario_bool(line, "AttitudesInput", AttitudesInput);
-		if (papiReadScenario_int(line, "ConfigCodeBefore", inttemp))
-		{
-			ConfigCodeBefore = inttemp;
-		}
-		papiReadScenario_int(line, "TVC", TVC);
-		papiReadScenario_int(line, "TrimAngleInd", TrimAngleInd);
-		papiReadScenario_bool(line, "FrozenManeuverInd", FrozenManeuverInd);
-		papiReadScenario_int(line, "RefBodyInd", RefBodyInd);
-		papiReadScenario_int(line, "CoordSysInd", CoordSysInd);
-		papiReadScenario_bool(line, "HeadsUpDownInd", HeadsUpDownInd);
-		papiReadScenario_double(line, "DockingAngle", DockingAngle);
-		papiReadScenario_double(line, "GMTMAN", GMTMAN);
-		papiReadScenario_double(line, "dt_ullage", dt_ullage);
-		papiReadScenario_double(line, "DT_10PCT", DT_10PCT);
-		papiReadScenario_double(line, "dt", dt);
-		papiReadScenario_double(line, "dv", dv);
-		papiReadScenario_vec(line, "A_T", A_T);
-		papiReadScenario_vec(line, "X_B", X_B);
-		papiReadScenario_vec(line, "Y_B", Y_B);
-		papiReadScenario_vec(line, "Z_B", Z_B);
-		papiReadScenario_SV(line, "FrozenManeuverVector", FrozenManeuverVector);
-		papiReadScenario_double(line, "DPSScaleFactor", DPSScaleFactor);
-		papiReadScenario_vec(line, "dV_inertial", dV_inertial);
-		papiReadScenario_vec(line, "dV_LVLH", dV_LVLH);
-		papiReadScenario_double(line, "Word67d", Word67d);
-		papiReadScenario_intarr(line, "Word67i", Word67i, 2);
-		papiReadScenario_double(line, "Word68", Word68);
-		papiReadScenario_double(line, "Word69", Word69);
-		papiReadScenario_double(line, "Word70", Word70);
-		papiReadScenario_double(line, "Word71", Word71);
-		papiReadScenario_double(line, "Word72", Word72);
-		papiReadScenario_double(line, "Word73", Word73);
-		papiReadScenario_double(line, "Word74", Word74);
-		papiReadScenario_double(line, "Word75", Word75);
-		papiReadScenario_double(line, "Word76", Word76);
-		papiReadScenario_double(line, "Word77", Word77);
-		papiReadScenario_double(line, "Word78d", Word78d);
-		papiReadScenario_intarr(line, "Word78i", Word78i, 2);
-		papiReadScenario_double(line, "Word79", Word79);
-		papiReadScenario_double(line, "Word80", Word80);
-		papiReadScenario_double(line, "Word81", Word81);
-		papiReadScenario_double(line, "Word82", Word82);
-		papiReadScenario_double(line, "Word83", Word83);
-		papiReadScenario_double(line, "Word84", Word84);
-		papiReadScenario_double(line, "GMTI", GMTI);
-		papiReadScenario_intarr(line, "TrajDet", TrajDet, 3);
-		papiReadScenario_vec(line, "R_BI", R_BI);
-		papiReadScenario_vec(line, "V_BI", V_BI);
-		papiReadScenario_double(line, "GMT_BI", GMT_BI);
-		papiReadScenario_vec(line, "R_BO", R_BO);
-		papiReadScenario_vec(line, "V_BO", V_BO);
-		papiReadScenario_double(line, "GMT_BO", GMT_BO);
-		papiReadScenario_vec(line, "R_1", R_1);
-		papiReadScenario_vec(line, "V_1", V_1);
-		papiReadScenario_double(line, "GMT_1", GMT_1);
-		papiReadScenario_double(line, "TotalMassAfter", TotalMassAfter);
-		papiReadScenario_double(line, "TotalAreaAfter", TotalAreaAfter);
-		papiReadScenario_double(line, "MainEngineFuelUsed", MainEngineFuelUsed);
-		papiReadScenario_double(line, "RCSFuelUsed", RCSFuelUsed);
-		papiReadScenario_double(line, "DVREM", DVREM);
-		papiReadScenario_double(line, "DVC", DVC);
-		papiReadScenario_double(line, "DVXBT", DVXBT);
-		papiReadScenario_double(line, "DV_M", DV_M);
-		papiReadScenario_double(line, "V_F", V_F);
-		papiReadScenario_double(line, "V_S", V_S);
-		papiReadScenario_double(line, "V_D", V_D);
-		papiReadScenario_double(line, "P_H", P_H);
-		papiReadScenario_double(line, "Y_H", Y_H);
-		papiReadScenario_double(line, "R_H", R_H);
-		papiReadScenario_double(line, "dt_BD", dt_BD);
-		papiReadScenario_double(line, "dt_TO", dt_TO);
-		papiReadScenario_double(line, "dv_TO", dv_TO);
-		papiReadScenario_double(line, "P_G", P_G);
-		papiReadScenario_double(line, "Y_G", Y_G);
-		papiReadScenario_double(line, "lat_BI", lat_BI);
-		papiReadScenario_double(line, "lng_BI", lng_BI);
-		papiReadScenario_double(line, "h_BI", h_BI);
-		papiReadScenario_double(line, "eta_BI", eta_BI);
-		papiReadScenario_double(line, "e_BO", e_BO);
-		papiReadScenario_double(line, "i_BO", i_BO);
-		papiReadScenario_double(line, "g_BO", g_BO);
-		papiReadScenario_double(line, "h_a", h_a);
-		papiReadScenario_double(line, "lat_a", lat_a);
-		papiReadScenario_double(line, "lng_a", lng_a);
-		papiReadScenario_double(line, "GMT_a", GMT_a);
-		papiReadScenario_double(line, "h_p", h_p);
-		papiReadScenario_double(line, "lat_p", lat_p);
-		papiReadScenario_double(line, "lng_p", lng_p);
-		papiReadScenario_double(line, "GMT_p", GMT_p);
-		papiReadScenario_double(line, "GMT_AN", GMT_AN);
-		papiReadScenario_double(line, "lng_AN", lng_AN);
-		papiReadScenario_double(line, "IMPT", IMPT);
+		r.Read(line);
 	}
 }
 
@@ -1053,22 +1037,21 @@ void MissionPlanTable::SaveState(FILEHANDLE scn, char *start_str, char *end_str)
 	oapiWriteScenario_int(scn, "ManeuverNum", ManeuverNum);
 	sprintf_s(Buff, StationID.c_str());
 	oapiWriteScenario_string(scn, "StationID", Buff);
-	papiWriteScenario_double(scn, "GMTAV", GMTAV);
-	papiWriteScenario_double(scn, "KFactor", KFactor);
-	papiWriteScenario_double(scn, "LMStagingGMT", LMStagingGMT);
-	sprintf(Buff, "  %s %.12g", "UpcomingManeuverGMT", UpcomingManeuverGMT);
-	oapiWriteLine(scn, Buff);
-	papiWriteScenario_double(scn, "SIVBVentingBeginGET", SIVBVentingBeginGET);
+	ScenarioWrite_double(scn, "GMTAV", GMTAV);
+	ScenarioWrite_double(scn, "KFactor", KFactor);
+	ScenarioWrite_double(scn, "LMStagingGMT", LMStagingGMT);
+	ScenarioWrite_double(scn, "UpcomingManeuverGMT", UpcomingManeuverGMT);
+	ScenarioWrite_double(scn, "SIVBVentingBeginGET", SIVBVentingBeginGET);
 	CommonBlock.SaveState(scn);
-	papiWriteScenario_double(scn, "TotalInitMass", TotalInitMass);
-	papiWriteScenario_double(scn, "ConfigurationArea", ConfigurationArea);
-	papiWriteScenario_double(scn, "DeltaDockingAngle", DeltaDockingAngle);
+	ScenarioWrite_double(scn, "TotalInitMass", TotalInitMass);
+	ScenarioWrite_double(scn, "ConfigurationArea", ConfigurationArea);
+	ScenarioWrite_double(scn, "DeltaDockingAngle", DeltaDockingAngle);
 	if (ManeuverNum > 0)
 	{
-		papiWriteScenario_doublearr(scn, "TimeToBeginManeuver", TimeToBeginManeuver, ManeuverNum);
-		papiWriteScenario_doublearr(scn, "TimeToEndManeuver", TimeToEndManeuver, ManeuverNum);
-		papiWriteScenario_doublearr(scn, "AreaAfterManeuver", AreaAfterManeuver, ManeuverNum);
-		papiWriteScenario_doublearr(scn, "WeightAfterManeuver", WeightAfterManeuver, ManeuverNum);
+		ScenarioWrite_doublearr(scn, "TimeToBeginManeuver", TimeToBeginManeuver, ManeuverNum);
+		ScenarioWrite_doublearr(scn, "TimeToEndManeuver", TimeToEndManeuver, ManeuverNum);
+		ScenarioWrite_doublearr(scn, "AreaAfterManeuver", AreaAfterManeuver, ManeuverNum);
+		ScenarioWrite_doublearr(scn, "WeightAfterManeuver", WeightAfterManeuver, ManeuverNum);
 	}
 	oapiWriteScenario_int(scn, "LastFrozenManeuver", LastFrozenManeuver);
 	oapiWriteScenario_int(scn, "LastExecutedManeuver", LastExecutedManeuver);
@@ -1083,61 +1066,68 @@ void MissionPlanTable::SaveState(FILEHANDLE scn, char *start_str, char *end_str)
 
 void MissionPlanTable::LoadState(FILEHANDLE scn, char *end_str)
 {
-	char Buff[128], manbuff[16], manbuff2[16];
+	ScenarioReader r;
+	char manbuff[16], manbuff2[16];
 	char *line;
 	int inttemp;
-	unsigned int mannum;
+	unsigned int mannum = 0;
 
-	while (oapiReadScenario_nextline(scn, line)) {
-		if (!strnicmp(line, end_str, sizeof(end_str))) {
-			break;
-		}
+	sprintf_s(manbuff, "MAN%d_BEGIN", mannum + 1);
+	sprintf_s(manbuff2, "MAN%d_END", mannum + 1);
 
-		if (!strnicmp(line, "ManeuverNum", 11)) {
-			sscanf(line + 11, "%d", &ManeuverNum);
-			//ManeuverNum should only be 0 to 15
-			if (ManeuverNum <= 15)
-			{
-				mantable.resize(ManeuverNum);
-				mannum = 0;
-				sprintf_s(manbuff, "MAN%d_BEGIN", mannum + 1);
-				sprintf_s(manbuff2, "MAN%d_END", mannum + 1);
-			}
-			else
-			{
-				//For safety
-				ManeuverNum = 0;
-			}
-		}
-		else if (papiReadScenario_string(line, "StationID", Buff))
-		{
-			StationID.assign(Buff);
-		}
+	r.Call("ManeuverNum", [&](const ScenarioLine &l)
+	{
+		if (!l.Int(1, inttemp)) return;
 
-		papiReadScenario_double(line, "GMTAV", GMTAV);
-		papiReadScenario_double(line, "KFactor", KFactor);
-		papiReadScenario_double(line, "LMStagingGMT", LMStagingGMT);
-		papiReadScenario_double(line, "UpcomingManeuverGMT", UpcomingManeuverGMT);
-		papiReadScenario_double(line, "SIVBVentingBeginGET", SIVBVentingBeginGET);
-		CommonBlock.LoadState(line, inttemp);
-		papiReadScenario_double(line, "TotalInitMass", TotalInitMass);
-		papiReadScenario_double(line, "ConfigurationArea", ConfigurationArea);
-		papiReadScenario_double(line, "DeltaDockingAngle", DeltaDockingAngle);
-		if (ManeuverNum > 0)
+		//ManeuverNum should only be 0 to 15
+		if (inttemp >= 0 && inttemp <= 15)
 		{
-			papiReadScenario_doublearr(line, "TimeToBeginManeuver", TimeToBeginManeuver, ManeuverNum);
-			papiReadScenario_doublearr(line, "TimeToEndManeuver", TimeToEndManeuver, ManeuverNum);
-			papiReadScenario_doublearr(line, "AreaAfterManeuver", AreaAfterManeuver, ManeuverNum);
-			papiReadScenario_doublearr(line, "WeightAfterManeuver", WeightAfterManeuver, ManeuverNum);
+			ManeuverNum = inttemp;
+			mantable.resize(ManeuverNum);
+			mannum = 0;
+			sprintf_s(manbuff, "MAN%d_BEGIN", mannum + 1);
+			sprintf_s(manbuff2, "MAN%d_END", mannum + 1);
 		}
-		if (papiReadScenario_int(line, "LastFrozenManeuver", inttemp))
+		else
 		{
-			LastFrozenManeuver = inttemp;
+			//For safety
+			ManeuverNum = 0;
 		}
-		else if (papiReadScenario_int(line, "LastExecutedManeuver", inttemp))
-		{
-			LastExecutedManeuver = inttemp;
+	});
+	r.String("StationID", StationID);
+	r.Double("GMTAV", GMTAV);
+	r.Double("KFactor", KFactor);
+	r.Double("LMStagingGMT", LMStagingGMT);
+	r.Double("UpcomingManeuverGMT", UpcomingManeuverGMT);
+	r.Double("SIVBVentingBeginGET", SIVBVentingBeginGET);
+	CommonBlock.LoadState(r);
+	r.Double("TotalInitMass", TotalInitMass);
+	r.Double("ConfigurationArea", ConfigurationArea);
+	r.Double("DeltaDockingAngle", DeltaDockingAngle);
+	r.Doubles("TimeToBeginManeuver", TimeToBeginManeuver, 15);
+	r.Doubles("TimeToEndManeuver", TimeToEndManeuver, 15);
+	r.Doubles("AreaAfterManeuver", AreaAfterManeuver, 15);
+	r.Doubles("WeightAfterManeuver", WeightAfterManeuver, 15);
+	r.Call("LastFrozenManeuver", [this](const ScenarioLine &l)
+	{
+		int i;
+
+		if (l.Int(1, i)) LastFrozenManeuver = i;
+	});
+	r.Call("LastExecutedManeuver", [this](const ScenarioLine &l)
+	{
+		int i;
+
+		if (l.Int(1, i)) LastExecutedManeuver = i;
+	});
+
+	while (oapiReadScenario_nextline(scn, line)) {
+		if (!strnicmp(line, end_str, sizeof(end_str))) {
+			break;
 		}
+
+		if (r.Read(line)) continue;
+
 		if (ManeuverNum > 0)
 		{
 			if (!strnicmp(line, manbuff, sizeof(manbuff)))
@@ -1369,7 +1359,7 @@ void RTCC::QMSEARCH(int year, int month, int day)
 {
 	//This function loads the skeleton flight plan for the launch day
 	char Buff[128];
-	sprintf_s(Buff, ".\\Config\\ProjectApollo\\RTCC\\%d-%02d-%02d SFP.txt", year, month, day);
+	sprintf_s(Buff, "Config/ProjectApollo/RTCC/%d-%02d-%02d SFP.txt", year, month, day);
 
 	ifstream startable(Buff);
 	if (startable.is_open())
@@ -1490,7 +1480,7 @@ void RTCC::QMMBLD(int year, int month, int day)
 	//This function loads the TLI targeting parameters for the launch day
 	//Loaded file has to have the punch card format from MSC memo 69-FM-171. One punch card = one line
 	char Buff[128];
-	sprintf_s(Buff, ".\\Config\\ProjectApollo\\RTCC\\%d-%02d-%02d TLI.txt", year, month, day);
+	sprintf_s(Buff, "Config/ProjectApollo/RTCC/%d-%02d-%02d TLI.txt", year, month, day);
 
 	ifstream startable(Buff);
 
@@ -1627,7 +1617,7 @@ void RTCC::LoadMissionInitParameters(int year, int month, int day)
 {
 	//This function loads launch day specific parameters that might be updated and might be saved/loaded
 	char Buff[128];
-	sprintf_s(Buff, ".\\Config\\ProjectApollo\\RTCC\\%d-%02d-%02d Init.txt", year, month, day);
+	sprintf_s(Buff, "Config/ProjectApollo/RTCC/%d-%02d-%02d Init.txt", year, month, day);
 
 	ifstream startable(Buff);
 	if (startable.is_open())
@@ -1731,7 +1721,7 @@ void RTCC::LoadMissionConstantsFile(char *file)
 {
 	//This function loads mission specific constants that will not be changed or saved/loaded
 	char Buff[128];
-	sprintf_s(Buff, ".\\Config\\ProjectApollo\\RTCC\\%s.txt", file);
+	sprintf_s(Buff, "Config/ProjectApollo/RTCC/%s.txt", file);
 
 	ifstream startable(Buff);
 	if (startable.is_open())
@@ -5178,13 +5168,8 @@ int RTCC::LunarDescentPlanningProcessor(SV sv)
 	return 0;
 }
 
-void RTCC::TranslunarMidcourseCorrectionProcessor(EphemerisData sv0, double CSMmass, double LMmass)
+void RTCC::TranslunarMidcourseCorrectionInputs(EphemerisData sv0, double CSMmass, double LMmass, TLMCCDataTable &datatab, TLMCCMEDQuantities &medquant, TLMCCMissionConstants &mccconst)
 {
-	TLMCCDataTable datatab;
-	TLMCCMEDQuantities medquant;
-	TLMCCMissionConstants mccconst;
-	TLMCCOutputData out;
-
 	datatab = PZSFPTAB.blocks[PZMCCPLN.SFPBlockNum - 1];
 
 	medquant.Mode = PZMCCPLN.Mode;
@@ -5234,24 +5219,67 @@ void RTCC::TranslunarMidcourseCorrectionProcessor(EphemerisData sv0, double CSMm
 	mccconst.T_t1_max_dps = PZMCCPLN.TT1_DPS_MAX;
 	mccconst.INCL_PR_MAX = PZMCCPLN.INCL_PR_MAX;
 	mccconst.Reentry_range = PZMCCPLN.Reentry_range;
+}
+
+void RTCC::TranslunarMidcourseCorrectionProcessor(EphemerisData sv0, double CSMmass, double LMmass)
+{
+	TLMCCDataTable datatab;
+	TLMCCMEDQuantities medquant;
+	TLMCCMissionConstants mccconst;
+	TLMCCOutputData out;
+
+	TranslunarMidcourseCorrectionInputs(sv0, CSMmass, LMmass, datatab, medquant, mccconst);
 
 	TLMCCProcessor tlmcc(this);
 	tlmcc.Init(datatab, medquant, mccconst);
 	tlmcc.Main(out);
 
+	TranslunarMidcourseCorrectionColumn(PZMCCPLN.Column, out);
+}
+
+void RTCC::TranslunarMidcourseCorrectionColumn(int column, const TLMCCOutputData &out)
+{
 	//Update display data
-	PZMCCDIS.data[PZMCCPLN.Column - 1] = out.display;
+	PZMCCDIS.data[column - 1] = out.display;
 
 	//Update MPT transfer table
-	PZMCCXFR.sv_man_bef[PZMCCPLN.Column - 1].R = out.R_MCC;
-	PZMCCXFR.sv_man_bef[PZMCCPLN.Column - 1].V = out.V_MCC;
-	PZMCCXFR.sv_man_bef[PZMCCPLN.Column - 1].GMT = out.GMT_MCC;
-	PZMCCXFR.sv_man_bef[PZMCCPLN.Column - 1].RBI = out.RBI;
-	PZMCCXFR.V_man_after[PZMCCPLN.Column - 1] = out.V_MCC_apo;
+	PZMCCXFR.sv_man_bef[column - 1].R = out.R_MCC;
+	PZMCCXFR.sv_man_bef[column - 1].V = out.V_MCC;
+	PZMCCXFR.sv_man_bef[column - 1].GMT = out.GMT_MCC;
+	PZMCCXFR.sv_man_bef[column - 1].RBI = out.RBI;
+	PZMCCXFR.V_man_after[column - 1] = out.V_MCC_apo;
 
 	//Update skeleton flight plan table
-	PZMCCSFP.blocks[PZMCCPLN.Column - 1] = out.outtab;
-	PZMCCSFP.blocks[PZMCCPLN.Column - 1].GMTTimeFlag = RTCCPresentTimeGMT();
+	PZMCCSFP.blocks[column - 1] = out.outtab;
+	PZMCCSFP.blocks[column - 1].GMTTimeFlag = RTCCPresentTimeGMT();
+}
+
+void RTCC::TranslunarMidcourseCorrectionScan(EphemerisData sv0, double CSMmass, double LMmass, const std::vector<int> &modes, const std::vector<double> &GET_MCC, TLMCCScanTable &tab)
+{
+	TLMCCScanSettings set;
+
+	TranslunarMidcourseCorrectionInputs(sv0, CSMmass, LMmass, set.DataTable, set.MED, set.Constants);
+	set.MODES = modes;
+	for (unsigned i = 0;i < GET_MCC.size();i++)
+	{
+		set.T_MCC.push_back(GMTfromGET(GET_MCC[i]));
+	}
+
+	TLMCCProcessor tlmcc(this);
+	tlmcc.SCAN(set, tab);
+
+	//The ranking starts with the converged options
+	for (int i = 0;i < 4;i++)
+	{
+		if (i < tab.Solved)
+		{
+			TranslunarMidcourseCorrectionColumn(i + 1, tab.Points[tab.Ranking[i]].out);
+		}
+		else
+		{
+			PZMCCDIS.data[i].Mode = 0;
+		}
+	}
 }
 
 bool RTCC::GeneralManeuverProcessor(GMPOpt *opt, VECTOR3 &dV_i, double &P30TIG)
@@ -7044,24 +7072,27 @@ void RTCC::SaveState(FILEHANDLE scn) {
 
 // Load State
 void RTCC::LoadState(FILEHANDLE scn) {
+	ScenarioReader r;
 	char *line;
-	int tmp = 0; // Used in boolean type loader
-	int inttemp, inttemp2;
-	REFSMMATData refs;
 
-	while (oapiReadScenario_nextline(scn, line)) {
-		if (!strnicmp(line, RTCC_END_STRING, sizeof(RTCC_END_STRING))) {
-			break;
-		}
-		if (papiReadScenario_string(line, "RTCC_MISSIONFILE", MissionFileName))
+	r.Call("RTCC_MISSIONFILE", [this](const ScenarioLine &l)
+	{
+		std::string file;
+
+		if (l.Rest(1, file))
 		{
+			strncpy(MissionFileName, file.c_str(), sizeof(MissionFileName) - 1);
+			MissionFileName[sizeof(MissionFileName) - 1] = 0;
 			LoadMissionConstantsFile(MissionFileName);
 		}
-		LOAD_INT("RTCC_GZGENCSN_Year", GZGENCSN.Year);
-		LOAD_INT("RTCC_GZGENCSN_RefDayOfYear", GZGENCSN.RefDayOfYear);
-		LOAD_INT("RTCC_GZGENCSN_DaysInYear", GZGENCSN.DaysInYear);
-		LOAD_INT("RTCC_GZGENCSN_MonthofLiftoff", GZGENCSN.MonthofLiftoff);
-		if (papiReadScenario_int(line, "RTCC_GZGENCSN_DayofLiftoff", GZGENCSN.DayofLiftoff))
+	});
+	r.Int("RTCC_GZGENCSN_Year", GZGENCSN.Year);
+	r.Int("RTCC_GZGENCSN_RefDayOfYear", GZGENCSN.RefDayOfYear);
+	r.Int("RTCC_GZGENCSN_DaysInYear", GZGENCSN.DaysInYear);
+	r.Int("RTCC_GZGENCSN_MonthofLiftoff", GZGENCSN.MonthofLiftoff);
+	r.Call("RTCC_GZGENCSN_DayofLiftoff", [this](const ScenarioLine &l)
+	{
+		if (l.Int(1, GZGENCSN.DayofLiftoff))
 		{
 			//Same as in ARCore, if the year is 0 we assume that the RTCC hasn't been initialized
 			if (GZGENCSN.Year != 0)
@@ -7069,140 +7100,157 @@ void RTCC::LoadState(FILEHANDLE scn) {
 				LoadLaunchDaySpecificParameters(GZGENCSN.Year, GZGENCSN.MonthofLiftoff, GZGENCSN.DayofLiftoff);
 			}
 		}
-		LOAD_INT("RTCC_GZGENCSN_DaysinMonthofLiftoff", GZGENCSN.DaysinMonthofLiftoff);
-		LOAD_INT("RTCC_SFP_MODE", PZSFPTAB.blocks[1].mode);
-		LOAD_INT("RTCC_REFSMMATType", REFSMMATType);
-		LOAD_DOUBLE("RTCC_GMTBASE",SystemParameters.GMTBASE);
-		LOAD_DOUBLE("RTCC_MCGMTL", SystemParameters.MCGMTL);
-		LOAD_DOUBLE("RTCC_MCGZSA", SystemParameters.MCGZSA);
-		LOAD_DOUBLE("RTCC_MCGZSL", SystemParameters.MCGZSL);
-		LOAD_DOUBLE("RTCC_MCGZSS", SystemParameters.MCGZSS);
-		LOAD_DOUBLE("RTCC_MCLABN", SystemParameters.MCLABN);
-		LOAD_DOUBLE("RTCC_MCLSBN", SystemParameters.MCLSBN);
-		LOAD_DOUBLE("RTCC_MCLCBN", SystemParameters.MCLCBN);
-		LOAD_DOUBLE("RTCC_MCGRAG", SystemParameters.MCGRAG);
-		LOAD_DOUBLE("RTCC_MCGRIC", SystemParameters.MCGRIC);
-		LOAD_DOUBLE("RTCC_MCGRIL", SystemParameters.MCGRIL);
-		LOAD_DOUBLE("RTCC_MCGREF", SystemParameters.MCGREF);
-		LOAD_DOUBLE("RTCC_MCLAMD", SystemParameters.MCLAMD);
-		LOAD_DOUBLE("RTCC_MDVSTP_T4IG", SystemParameters.MDVSTP.T4IG);
-		LOAD_DOUBLE("RTCC_MDVSTP_T4C", SystemParameters.MDVSTP.T4C);
-
-		LOAD_DOUBLE("RTCC_GZGENCSN_DKIELEVATIONANGLE", GZGENCSN.DKIElevationAngle);
-		LOAD_DOUBLE("RTCC_GZGENCSN_DKITERMINALPHASEANGLE", GZGENCSN.DKITerminalPhaseAngle);
-		LOAD_DOUBLE("RTCC_GZGENCSN_TIDELTAH", GZGENCSN.TIDeltaH);
-		LOAD_DOUBLE("RTCC_GZGENCSN_TIPHASEANGLE", GZGENCSN.TIPhaseAngle);
-		LOAD_DOUBLE("RTCC_GZGENCSN_TIELEVATIONANGLE", GZGENCSN.TIElevationAngle);
-		LOAD_DOUBLE("RTCC_GZGENCSN_TITRAVELANGLE", GZGENCSN.TITravelAngle);
-		LOAD_DOUBLE("RTCC_GZGENCSN_TINSRNOMINALTIME", GZGENCSN.TINSRNominalTime);
-		LOAD_DOUBLE("RTCC_GZGENCSN_TINSRNOMINALDELTAH", GZGENCSN.TINSRNominalDeltaH);
-		LOAD_DOUBLE("RTCC_GZGENCSN_TINSRNOMINALPHASEANGLE", GZGENCSN.TINSRNominalPhaseAngle);
-		LOAD_DOUBLE("RTCC_GZGENCSN_DKIDELTAH", GZGENCSN.DKIDeltaH);
-		LOAD_DOUBLE("RTCC_GZGENCSN_SPQDELTAH", GZGENCSN.SPQDeltaH);
-		LOAD_DOUBLE("RTCC_GZGENCSN_SPQELEVATIONANGLE", GZGENCSN.SPQElevationAngle);
-		LOAD_DOUBLE("RTCC_GZGENCSN_LDPPAzimuth", GZGENCSN.LDPPAzimuth);
-		LOAD_DOUBLE("RTCC_GZGENCSN_LDPPHeightofPDI", GZGENCSN.LDPPHeightofPDI);
-		LOAD_INT("RTCC_GZGENCSN_LDPPDwellOrbits", GZGENCSN.LDPPDwellOrbits);
-		LOAD_BOOL("RTCC_GZGENCSN_LDPPPoweredDescentSimFlag", GZGENCSN.LDPPPoweredDescentSimFlag);
-		LOAD_DOUBLE("RTCC_GZGENCSN_LDPPDescentFlightArc", GZGENCSN.LDPPDescentFlightArc);
-
-		LOAD_INT("EZETVMED_SpaceDigVehID", EZETVMED.SpaceDigVehID);
-		LOAD_INT("EZETVMED_SpaceDigCentralBody", EZETVMED.SpaceDigCentralBody);
-
-		LOAD_DOUBLE("PZLTRT_DT_Ins_TPI", PZLTRT.DT_Ins_TPI);
-		LOAD_DOUBLE("PZLTRT_PoweredFlightArc", PZLTRT.PoweredFlightArc);
-		LOAD_DOUBLE("PZLTRT_PoweredFlightTime", PZLTRT.PoweredFlightTime);
-
-		LOAD_DOUBLE("RTCC_TLCCGET", PZMCCPLN.MidcourseGET);
-		LOAD_DOUBLE("RTCC_TLCCVectorGET", PZMCCPLN.VectorGET);
-		LOAD_DOUBLE("RTCC_TLCC_TLMIN", PZMCCPLN.TLMIN);
-		LOAD_DOUBLE("RTCC_TLCC_TLMAX", PZMCCPLN.TLMAX);
-		LOAD_DOUBLE("RTCC_TLCC_AZ_min", PZMCCPLN.AZ_min);
-		LOAD_DOUBLE("RTCC_TLCC_AZ_max", PZMCCPLN.AZ_max);
-		LOAD_DOUBLE("RTCC_TLCC_ETA1", PZMCCPLN.ETA1);
-		LOAD_DOUBLE("RTCC_TLCC_REVS1", PZMCCPLN.REVS1);
-		LOAD_DOUBLE("LOI_eta_1", PZLOIPLN.eta_1);
-		LOAD_DOUBLE("LOI_REVS1", PZLOIPLN.REVS1);
-
-		LOAD_DOUBLE2("RTCC_SFP_DPSI_LOI", PZSFPTAB.blocks[0].dpsi_loi, PZSFPTAB.blocks[1].dpsi_loi);
-		LOAD_DOUBLE2("RTCC_SFP_DPSI_TEI", PZSFPTAB.blocks[0].dpsi_tei, PZSFPTAB.blocks[1].dpsi_tei);
-		LOAD_DOUBLE2("RTCC_SFP_DT_LLS", PZSFPTAB.blocks[0].dt_lls, PZSFPTAB.blocks[1].dt_lls);
-		LOAD_DOUBLE2("RTCC_SFP_DT_UPD_NOM", PZSFPTAB.blocks[0].dt_upd_nom, PZSFPTAB.blocks[1].dt_upd_nom);
-		LOAD_DOUBLE2("RTCC_SFP_DV_TEI", PZSFPTAB.blocks[0].dv_tei, PZSFPTAB.blocks[1].dv_tei);
-		LOAD_DOUBLE2("RTCC_SFP_GAMMA_LOI", PZSFPTAB.blocks[0].gamma_loi, PZSFPTAB.blocks[1].gamma_loi);
-		LOAD_DOUBLE2("RTCC_SFP_GET_TLI", PZSFPTAB.blocks[0].GET_TLI, PZSFPTAB.blocks[1].GET_TLI);
-		LOAD_DOUBLE2("RTCC_SFP_GMT_TIME_FLAG", PZSFPTAB.blocks[0].GMTTimeFlag, PZSFPTAB.blocks[1].GMTTimeFlag);
-		LOAD_DOUBLE2("RTCC_SFP_GMT_ND", PZSFPTAB.blocks[0].GMT_nd, PZSFPTAB.blocks[1].GMT_nd);
-		LOAD_DOUBLE2("RTCC_SFP_GMT_PC1", PZSFPTAB.blocks[0].GMT_pc1, PZSFPTAB.blocks[1].GMT_pc1);
-		LOAD_DOUBLE2("RTCC_SFP_GMT_PC2", PZSFPTAB.blocks[0].GMT_pc2, PZSFPTAB.blocks[1].GMT_pc2);
-		LOAD_DOUBLE2("RTCC_SFP_H_ND", PZSFPTAB.blocks[0].h_nd, PZSFPTAB.blocks[1].h_nd);
-		LOAD_DOUBLE2("RTCC_SFP_H_PC1", PZSFPTAB.blocks[0].h_pc1, PZSFPTAB.blocks[1].h_pc1);
-		LOAD_DOUBLE2("RTCC_SFP_H_PC2", PZSFPTAB.blocks[0].h_pc2, PZSFPTAB.blocks[1].h_pc2);
-		LOAD_DOUBLE2("RTCC_SFP_INCL_FR", PZSFPTAB.blocks[0].incl_fr, PZSFPTAB.blocks[1].incl_fr);
-		LOAD_DOUBLE2("RTCC_SFP_LAT_LLS", PZSFPTAB.blocks[0].lat_lls, PZSFPTAB.blocks[1].lat_lls);
-		LOAD_DOUBLE2("RTCC_SFP_LAT_ND", PZSFPTAB.blocks[0].lat_nd, PZSFPTAB.blocks[1].lat_nd);
-		LOAD_DOUBLE2("RTCC_SFP_LAT_PC1", PZSFPTAB.blocks[0].lat_pc1, PZSFPTAB.blocks[1].lat_pc1);
-		LOAD_DOUBLE2("RTCC_SFP_LAT_PC2", PZSFPTAB.blocks[0].lat_pc2, PZSFPTAB.blocks[1].lat_pc2);
-		LOAD_DOUBLE2("RTCC_SFP_LNG_LLS", PZSFPTAB.blocks[0].lng_lls, PZSFPTAB.blocks[1].lng_lls);
-		LOAD_DOUBLE2("RTCC_SFP_LNG_ND", PZSFPTAB.blocks[0].lng_nd, PZSFPTAB.blocks[1].lng_nd);
-		LOAD_DOUBLE2("RTCC_SFP_LNG_PC1", PZSFPTAB.blocks[0].lng_pc1, PZSFPTAB.blocks[1].lng_pc1);
-		LOAD_DOUBLE2("RTCC_SFP_LNG_PC2", PZSFPTAB.blocks[0].lng_pc2, PZSFPTAB.blocks[1].lng_pc2);
-		LOAD_DOUBLE2("RTCC_SFP_PSI_LLS", PZSFPTAB.blocks[0].psi_lls, PZSFPTAB.blocks[1].psi_lls);
-		LOAD_DOUBLE2("RTCC_SFP_RAD_LLS", PZSFPTAB.blocks[0].rad_lls, PZSFPTAB.blocks[1].rad_lls);
-		LOAD_DOUBLE2("RTCC_SFP_T_LO", PZSFPTAB.blocks[0].T_lo, PZSFPTAB.blocks[1].T_lo);
-		LOAD_DOUBLE2("RTCC_SFP_T_TE", PZSFPTAB.blocks[0].T_te, PZSFPTAB.blocks[1].T_te);
-
-		LOAD_DOUBLE("RTCC_P30TIG", TimeofIgnition);
-		LOAD_DOUBLE("RTCC_SplLat", SplashLatitude);
-		LOAD_DOUBLE("RTCC_SplLng", SplashLongitude);
-		LOAD_DOUBLE("RTCC_TEI", calcParams.TEI);
-		LOAD_DOUBLE("RTCC_EI", calcParams.EI);
-		LOAD_DOUBLE("RTCC_TLI", calcParams.TLI);
-		LOAD_DOUBLE("RTCC_LOI", calcParams.LOI);
-		LOAD_DOUBLE("RTCC_SEP", calcParams.SEP);
-		LOAD_DOUBLE("RTCC_DOI", calcParams.DOI);
-		LOAD_DOUBLE("RTCC_PDI", calcParams.PDI);
-		LOAD_DOUBLE("RTCC_TLAND", CZTDTGTU.GETTD);
-		LOAD_DOUBLE("RTCC_LSAzi", calcParams.LSAzi);
-		LOAD_DOUBLE("RTCC_LSLat", BZLAND.lat[RTCC_LMPOS_BEST]);
-		LOAD_DOUBLE("RTCC_LSLng", BZLAND.lng[RTCC_LMPOS_BEST]);
-		LOAD_DOUBLE("RTCC_LSRadius", BZLAND.rad[RTCC_LMPOS_BEST]);
-		LOAD_DOUBLE("RTCC_LunarLiftoff", calcParams.LunarLiftoff);
-		LOAD_DOUBLE("RTCC_Insertion", calcParams.Insertion);
-		LOAD_DOUBLE("RTCC_Phasing", calcParams.Phasing);
-		LOAD_DOUBLE("RTCC_CSI", calcParams.CSI);
-		LOAD_DOUBLE("RTCC_CDH", calcParams.CDH);
-		LOAD_DOUBLE("RTCC_TPI", calcParams.TPI);
-		LOAD_DOUBLE("RTCC_TIGSTORE1", calcParams.TIGSTORE1);
-
-		LOAD_V3("RTCC_DVLVLH", DeltaV_LVLH);
-		LOAD_V3("RTCC_DVSTORE1", calcParams.DVSTORE1);
-		LOAD_M3("RTCC_StoredREFSMMAT", calcParams.StoredREFSMMAT);
-		LOAD_M3("PZMATCSM_EPH", PZMATCSM.EPH);
-		LOAD_M3("PZMATCSM_G", PZMATCSM.G);
-		LOAD_M3("PZMATCSM_GG", PZMATCSM.GG);
-		LOAD_M3("PZMATLEM_EPH", PZMATLEM.EPH);
-		LOAD_M3("PZMATLEM_G", PZMATLEM.G);
-		LOAD_M3("PZMATLEM_GG", PZMATLEM.GG);
-		LOAD_M3("GZLTRA_IU1_REFSMMAT", GZLTRA.IU1_REFSMMAT);
-		if (papiReadScenario_REFS(line, "REFSMMAT", inttemp, inttemp2, refs))
-		{
-			if (inttemp == 1)
-			{
-				EZJGMTX1.data[inttemp2] = refs;
+	});
+	r.Int("RTCC_GZGENCSN_DaysinMonthofLiftoff", GZGENCSN.DaysinMonthofLiftoff);
+	r.Int("RTCC_SFP_MODE", PZSFPTAB.blocks[1].mode);
+	r.Int("RTCC_REFSMMATType", REFSMMATType);
+	r.Double("RTCC_GMTBASE",SystemParameters.GMTBASE);
+	r.Double("RTCC_MCGMTL", SystemParameters.MCGMTL);
+	r.Double("RTCC_MCGZSA", SystemParameters.MCGZSA);
+	r.Double("RTCC_MCGZSL", SystemParameters.MCGZSL);
+	r.Double("RTCC_MCGZSS", SystemParameters.MCGZSS);
+	r.Double("RTCC_MCLABN", SystemParameters.MCLABN);
+	r.Double("RTCC_MCLSBN", SystemParameters.MCLSBN);
+	r.Double("RTCC_MCLCBN", SystemParameters.MCLCBN);
+	r.Double("RTCC_MCGRAG", SystemParameters.MCGRAG);
+	r.Double("RTCC_MCGRIC", SystemParameters.MCGRIC);
+	r.Double("RTCC_MCGRIL", SystemParameters.MCGRIL);
+	r.Double("RTCC_MCGREF", SystemParameters.MCGREF);
+	r.Double("RTCC_MCLAMD", SystemParameters.MCLAMD);
+	r.Double("RTCC_MDVSTP_T4IG", SystemParameters.MDVSTP.T4IG);
+	r.Double("RTCC_MDVSTP_T4C", SystemParameters.MDVSTP.T4C);
+
+	r.Double("RTCC_GZGENCSN_DKIELEVATIONANGLE", GZGENCSN.DKIElevationAngle);
+	r.Double("RTCC_GZGENCSN_DKITERMINALPHASEANGLE", GZGENCSN.DKITerminalPhaseAngle);
+	r.Double("RTCC_GZGENCSN_TIDELTAH", GZGENCSN.TIDeltaH);
+	r.Double("RTCC_GZGENCSN_TIPHASEANGLE", GZGENCSN.TIPhaseAngle);
+	r.Double("RTCC_GZGENCSN_TIELEVATIONANGLE", GZGENCSN.TIElevationAngle);
+	r.Double("RTCC_GZGENCSN_TITRAVELANGLE", GZGENCSN.TITravelAngle);
+	r.Double("RTCC_GZGENCSN_TINSRNOMINALTIME", GZGENCSN.TINSRNominalTime);
+	r.Double("RTCC_GZGENCSN_TINSRNOMINALDELTAH", GZGENCSN.TINSRNominalDeltaH);
+	r.Double("RTCC_GZGENCSN_TINSRNOMINALPHASEANGLE", GZGENCSN.TINSRNominalPhaseAngle);
+	r.Double("RTCC_GZGENCSN_DKIDELTAH", GZGENCSN.DKIDeltaH);
+	r.Double("RTCC_GZGENCSN_SPQDELTAH", GZGENCSN.SPQDeltaH);
+	r.Double("RTCC_GZGENCSN_SPQELEVATIONANGLE", GZGENCSN.SPQElevationAngle);
+	r.Double("RTCC_GZGENCSN_LDPPAzimuth", GZGENCSN.LDPPAzimuth);
+	r.Double("RTCC_GZGENCSN_LDPPHeightofPDI", GZGENCSN.LDPPHeightofPDI);
+	r.Int("RTCC_GZGENCSN_LDPPDwellOrbits", GZGENCSN.LDPPDwellOrbits);
+	r.Bool("RTCC_GZGENCSN_LDPPPoweredDescentSimFlag", GZGENCSN.LDPPPoweredDescentSimFlag);
+	r.Double("RTCC_GZGENCSN_LDPPDescentFlightArc", GZGENCSN.LDPPDescentFlightArc);
+
+	r.Int("EZETVMED_SpaceDigVehID", EZETVMED.SpaceDigVehID);
+	r.Int("EZETVMED_SpaceDigCentralBody", EZETVMED.SpaceDigCentralBody);
+
+	r.Double("PZLTRT_DT_Ins_TPI", PZLTRT.DT_Ins_TPI);
+	r.Double("PZLTRT_PoweredFlightArc", PZLTRT.PoweredFlightArc);
+	r.Double("PZLTRT_PoweredFlightTime", PZLTRT.PoweredFlightTime);
+
+	r.Double("RTCC_TLCCGET", PZMCCPLN.MidcourseGET);
+	r.Double("RTCC_TLCCVectorGET", PZMCCPLN.VectorGET);
+	r.Double("RTCC_TLCC_TLMIN", PZMCCPLN.TLMIN);
+	r.Double("RTCC_TLCC_TLMAX", PZMCCPLN.TLMAX);
+	r.Double("RTCC_TLCC_AZ_min", PZMCCPLN.AZ_min);
+	r.Double("RTCC_TLCC_AZ_max", PZMCCPLN.AZ_max);
+	r.Double("RTCC_TLCC_ETA1", PZMCCPLN.ETA1);
+	r.Double("RTCC_TLCC_REVS1", PZMCCPLN.REVS1);
+	r.Double("LOI_eta_1", PZLOIPLN.eta_1);
+	r.Double("LOI_REVS1", PZLOIPLN.REVS1);
+
+	r.Double2("RTCC_SFP_DPSI_LOI", PZSFPTAB.blocks[0].dpsi_loi, PZSFPTAB.blocks[1].dpsi_loi);
+	r.Double2("RTCC_SFP_DPSI_TEI", PZSFPTAB.blocks[0].dpsi_tei, PZSFPTAB.blocks[1].dpsi_tei);
+	r.Double2("RTCC_SFP_DT_LLS", PZSFPTAB.blocks[0].dt_lls, PZSFPTAB.blocks[1].dt_lls);
+	r.Double2("RTCC_SFP_DT_UPD_NOM", PZSFPTAB.blocks[0].dt_upd_nom, PZSFPTAB.blocks[1].dt_upd_nom);
+	r.Double2("RTCC_SFP_DV_TEI", PZSFPTAB.blocks[0].dv_tei, PZSFPTAB.blocks[1].dv_tei);
+	r.Double2("RTCC_SFP_GAMMA_LOI", PZSFPTAB.blocks[0].gamma_loi, PZSFPTAB.blocks[1].gamma_loi);
+	r.Double2("RTCC_SFP_GET_TLI", PZSFPTAB.blocks[0].GET_TLI, PZSFPTAB.blocks[1].GET_TLI);
+	r.Double2("RTCC_SFP_GMT_TIME_FLAG", PZSFPTAB.blocks[0].GMTTimeFlag, PZSFPTAB.blocks[1].GMTTimeFlag);
+	r.Double2("RTCC_SFP_GMT_ND", PZSFPTAB.blocks[0].GMT_nd, PZSFPTAB.blocks[1].GMT_nd);
+	r.Double2("RTCC_SFP_GMT_PC1", PZSFPTAB.blocks[0].GMT_pc1, PZSFPTAB.blocks[1].GMT_pc1);
+	r.Double2("RTCC_SFP_GMT_PC2", PZSFPTAB.blocks[0].GMT_pc2, PZSFPTAB.blocks[1].GMT_pc2);
+	r.Double2("RTCC_SFP_H_ND", PZSFPTAB.blocks[0].h_nd, PZSFPTAB.blocks[1].h_nd);
+	r.Double2("RTCC_SFP_H_PC1", PZSFPTAB.blocks[0].h_pc1, PZSFPTAB.blocks[1].h_pc1);
+	r.Double2("RTCC_SFP_H_PC2", PZSFPTAB.blocks[0].h_pc2, PZSFPTAB.blocks[1].h_pc2);
+	r.Double2("RTCC_SFP_INCL_FR", PZSFPTAB.blocks[0].incl_fr, PZSFPTAB.blocks[1].incl_fr);
+	r.Double2("RTCC_SFP_LAT_LLS", PZSFPTAB.blocks[0].lat_lls, PZSFPTAB.blocks[1].lat_lls);
+	r.Double2("RTCC_SFP_LAT_ND", PZSFPTAB.blocks[0].lat_nd, PZSFPTAB.blocks[1].lat_nd);
+	r.Double2("RTCC_SFP_LAT_PC1", PZSFPTAB.blocks[0].lat_pc1, PZSFPTAB.blocks[1].lat_pc1);
+	r.Double2("RTCC_SFP_LAT_PC2", PZSFPTAB.blocks[0].lat_pc2, PZSFPTAB.blocks[1].lat_pc2);
+	r.Double2("RTCC_SFP_LNG_LLS", PZSFPTAB.blocks[0].lng_lls, PZSFPTAB.blocks[1].lng_lls);
+	r.Double2("RTCC_SFP_LNG_ND", PZSFPTAB.blocks[0].lng_nd, PZSFPTAB.blocks[1].lng_nd);
+	r.Double2("RTCC_SFP_LNG_PC1", PZSFPTAB.blocks[0].lng_pc1, PZSFPTAB.blocks[1].lng_pc1);
+	r.Double2("RTCC_SFP_LNG_PC2", PZSFPTAB.blocks[0].lng_pc2, PZSFPTAB.blocks[1].lng_pc2);
+	r.Double2("RTCC_SFP_PSI_LLS", PZSFPTAB.blocks[0].psi_lls, PZSFPTAB.blocks[1].psi_lls);
+	r.Double2("RTCC_SFP_RAD_LLS", PZSFPTAB.blocks[0].rad_lls, PZSFPTAB.blocks[1].rad_lls);
+	r.Double2("RTCC_SFP_T_LO", PZSFPTAB.blocks[0].T_lo, PZSFPTAB.blocks[1].T_lo);
+	r.Double2("RTCC_SFP_T_TE", PZSFPTAB.blocks[0].T_te, PZSFPTAB.blocks[1].T_te);
+
+	r.Double("RTCC_P30TIG", TimeofIgnition);
+	r.Double("RTCC_SplLat", SplashLatitude);
+	r.Double("RTCC_SplLng", SplashLongitude);
+	r.Double("RTCC_TEI", calcParams.TEI);
+	r.Double("RTCC_EI", calcParams.EI);
+	r.Double("RTCC_TLI", calcParams.TLI);
+	r.Double("RTCC_LOI", calcParams.LOI);
+	r.Double("RTCC_SEP", calcParams.SEP);
+	r.Double("RTCC_DOI", calcParams.DOI);
+	r.Double("RTCC_PDI", calcParams.PDI);
+	r.Double("RTCC_TLAND", CZTDTGTU.GETTD);
+	r.Double("RTCC_LSAzi", calcParams.LSAzi);
+	r.Double("RTCC_LSLat", BZLAND.lat[RTCC_LMPOS_BEST]);
+	r.Double("RTCC_LSLng", BZLAND.lng[RTCC_LMPOS_BEST]);
+	r.Double("RTCC_LSRadius", BZLAND.rad[RTCC_LMPOS_BEST]);
+	r.Double("RTCC_LunarLiftoff", calcParams.LunarLiftoff);
+	r.Double("RTCC_Insertion", calcParams.Insertion);
+	r.Double("RTCC_Phasing", calcParams.Phasing);
+	r.Double("RTCC_CSI", calcParams.CSI);
+	r.Double("RTCC_CDH", calcParams.CDH);
+	r.Double("RTCC_TPI", calcParams.TPI);
+	r.Double("RTCC_TIGSTORE1", calcParams.TIGSTORE1);
+
+	r.Vec("RTCC_DVLVLH", DeltaV_LVLH);
+	r.Vec("RTCC_DVSTORE1", calcParams.DVSTORE1);
+	r.Mat("RTCC_StoredREFSMMAT", calcParams.StoredREFSMMAT);
+	r.Mat("PZMATCSM_EPH", PZMATCSM.EPH);
+	r.Mat("PZMATCSM_G", PZMATCSM.G);
+	r.Mat("PZMATCSM_GG", PZMATCSM.GG);
+	r.Mat("PZMATLEM_EPH", PZMATLEM.EPH);
+	r.Mat("PZMATLEM_G", PZMATLEM.G);
+	r.Mat("PZMATLEM_GG", PZMATLEM.GG);
+	r.Mat("GZLTRA_IU1_REFSMMAT", GZLTRA.IU1_REFSMMAT);
+	r.Call("REFSMMAT", [this](const ScenarioLine &l)
+	{
+		REFSMMATData refs;
+		double d[10];
+		int tab, i;
+
+		if (l.Int(1, tab) && l.Int(2, i) && l.Int(3, refs.ID) && l.Doubles(4, d, 10) && i >= 0 && i < 12)
+		{
+			refs.GMT = d[0];
+			refs.REFSMMAT = _M(d[1], d[2], d[3], d[4], d[5], d[6], d[7], d[8], d[9]);
+			if (tab == 1)
+			{
+				EZJGMTX1.data[i] = refs;
 			}
 			else
 			{
-				EZJGMTX3.data[inttemp2] = refs;
+				EZJGMTX3.data[i] = refs;
 			}
 		}
-		papiReadScenario_SV(line, "RTCC_SVSTORE1", calcParams.SVSTORE1);
-		LOAD_INT("EZEPH1_TUP", EZEPH1.EPHEM.Header.TUP);
-		papiReadScenario_SV(line, "RTCC_MPTCM_ANCHOR", EZANCHR1.AnchorVectors);
-		LOAD_INT("EZEPH2_TUP", EZEPH2.EPHEM.Header.TUP);
-		papiReadScenario_SV(line, "RTCC_MPTLM_ANCHOR", EZANCHR3.AnchorVectors);
-		papiReadScenario_SV(line, "RTCC_BZUSEVEC", BZUSEVEC.data);
-		papiReadScenario_SV(line, "RTCC_BZEVLVEC", BZEVLVEC.data);
+	});
+	r.Call("RTCC_SVSTORE1", [this](const ScenarioLine &l) { papiReadScenario_SV(l, calcParams.SVSTORE1); });
+	r.Int("EZEPH1_TUP", EZEPH1.EPHEM.Header.TUP);
+	r.Call("RTCC_MPTCM_ANCHOR", [this](const ScenarioLine &l) { papiReadScenario_SV(l, EZANCHR1.AnchorVectors, 10); });
+	r.Int("EZEPH2_TUP", EZEPH2.EPHEM.Header.TUP);
+	r.Call("RTCC_MPTLM_ANCHOR", [this](const ScenarioLine &l) { papiReadScenario_SV(l, EZANCHR3.AnchorVectors, 10); });
+	r.Call("RTCC_BZUSEVEC", [this](const ScenarioLine &l) { papiReadScenario_SV(l, BZUSEVEC.data, 12); });
+	r.Call("RTCC_BZEVLVEC", [this](const ScenarioLine &l) { papiReadScenario_SV(l, BZEVLVEC.data, 8); });
+
+	while (oapiReadScenario_nextline(scn, line)) {
+		if (!strnicmp(line, RTCC_END_STRING, sizeof(RTCC_END_STRING))) {
+			break;
+		}
+
+		if (r.Read(line)) continue;
 
 		if (!strnicmp(line, "MPTCSM_BEGIN", sizeof("MPTCSM_BEGIN"))) {
 			PZMPTCSM.LoadState(scn, "MPTCSM_END");
@@ -7655,6 +7703,10 @@ int RTCC::PMMSPT(PMMSPTInput &in)
 	EMSMISSInputTable emsin;
 	double T_TH, alpha_TSS, alpha_TS, beta, T_RP, f, R_N, KP0, KY0, T3_apo, T_ST, tau3R, T2, Vex2, Mdot2, DV_BR, tau2N;
 	int J, OrigTLIInd, CurTLIInd;
+	double dt_ig, lambda, dt4, t_D, theta_E, RR, COSB, SINB, COSATS, t, p, r, vv, C1, C2, p_dot, cos_psi, sin_psi, i, X1, X2, theta_N, P_N, T_M, alpha_D_apo, P_RP, Y_RP, T3, tau3, A_Z, Azo, Azs, i_P, theta_N_P;
+	int LD, KX;
+	VECTOR3 TargetVector, T_P, R, V, P, S, P_dot, S_dot, Sbar_1, Cbar_1, Omega_X, Omega_Y, Omega_Z;
+	MATRIX3 RMAT, M, N, A, EPH, BB, GG, B, G;
 
 	if (in.QUEID == 39)
 	{
@@ -7698,7 +7750,7 @@ int RTCC::PMMSPT(PMMSPTInput &in)
 	{
 		return 79;
 	}
-	double dt_ig = in.CurMan->GMT_1 - in.CurMan->GMTMAN;
+	dt_ig = in.CurMan->GMT_1 - in.CurMan->GMTMAN;
 	if (SystemParameters.MCTJD1 > dt_ig)
 	{
 		return 79;
@@ -7733,7 +7785,7 @@ RTCC_PMMSPT_3_1:
 	CurTLIInd = OrigTLIInd;
 	J = in.InjOpp;
 RTCC_PMMSPT_4_1:
-	int LD = GZGENCSN.RefDayOfYear;
+	LD = GZGENCSN.RefDayOfYear;
 	if (LD != PZSTARGP.Day)
 	{
 		return 85;
@@ -7830,10 +7882,10 @@ RTCC_PMMSPT_7_2:
 		return 72;
 	}
 RTCC_PMMSPT_8_2:
-	double lambda = SystemParameters.MCLGRA + GetGMTLO()*3600.0*OrbMech::w_Earth;
-	MATRIX3 RMAT = mul(MatrixRH_LH(OrbMech::GetRotationMatrix(BODY_EARTH,SystemParameters.GMTBASE)), _M(cos(lambda), -sin(lambda), 0, sin(lambda), cos(lambda), 0, 0, 0, 1));
-	MATRIX3 M = mul(_M(1, 0, 0, 0, 0, -1, 0, 1, 0), OrbMech::tmat(RMAT));
-	double dt4 = (SystemParameters.MDVSTP.T4C - SystemParameters.MDVSTP.T4IG) - SystemParameters.MDVSTP.DT4N;
+	lambda = SystemParameters.MCLGRA + GetGMTLO()*3600.0*OrbMech::w_Earth;
+	RMAT = mul(MatrixRH_LH(OrbMech::GetRotationMatrix(BODY_EARTH,SystemParameters.GMTBASE)), _M(cos(lambda), -sin(lambda), 0, sin(lambda), cos(lambda), 0, 0, 0, 1));
+	M = mul(_M(1, 0, 0, 0, 0, -1, 0, 1, 0), OrbMech::tmat(RMAT));
+	dt4 = (SystemParameters.MDVSTP.T4C - SystemParameters.MDVSTP.T4IG) - SystemParameters.MDVSTP.DT4N;
 	double dt4_apo;
 	if (abs(dt4) > SystemParameters.MDVSTP.DTLIM)
 	{
@@ -7843,42 +7895,42 @@ RTCC_PMMSPT_8_2:
 	{
 		dt4_apo = dt4;
 	}
-	double t_D = GetGMTLO()*3600.0 - PZSTARGP.T_LO;
+	t_D = GetGMTLO()*3600.0 - PZSTARGP.T_LO;
 	double cos_sigma, C3, e_N, RA, DEC;
 	PCMSP2(J, t_D, cos_sigma, C3, e_N, RA, DEC);
-	VECTOR3 TargetVector = _V(cos(RA)*cos(DEC), sin(RA)*cos(DEC), sin(DEC));
-	double theta_E = PZSTARGP.theta_EO + PZSTARGP.omega_E * t_D;
-	MATRIX3 N = mul(RMAT, _M(cos(theta_E), sin(theta_E), 0, -sin(theta_E), cos(theta_E), 0, 0, 0, 1));
-	VECTOR3 T_P = mul(N, TargetVector);
-	VECTOR3 R = ephtab.table[0].R;
-	VECTOR3 V = ephtab.table[0].V;
-	double RR = dotp(R, R);
-	double COSB = cos(beta);
-	double SINB = sin(beta);
+	TargetVector = _V(cos(RA)*cos(DEC), sin(RA)*cos(DEC), sin(DEC));
+	theta_E = PZSTARGP.theta_EO + PZSTARGP.omega_E * t_D;
+	N = mul(RMAT, _M(cos(theta_E), sin(theta_E), 0, -sin(theta_E), cos(theta_E), 0, 0, 0, 1));
+	T_P = mul(N, TargetVector);
+	R = ephtab.table[0].R;
+	V = ephtab.table[0].V;
+	RR = dotp(R, R);
+	COSB = cos(beta);
+	SINB = sin(beta);
 	if (OrigTLIInd < 0)
 	{
 		goto RTCC_PMMSPT_13_2;
 	}
 	alpha_TS = alpha_TSS + PZSTARGP.K_a1*dt4_apo + PZSTARGP.K_a2*dt4_apo*dt4_apo;
-	double COSATS = cos(alpha_TS);
-	double t = T_TH;
-	VECTOR3 P = V * RR - R * dotp(R, V);
-	double p = length(P);
-	double r = length(R);
-	double vv = dotp(V, V);
-	double C1 = COSB / r;
-	double C2 = SINB / p;
-	VECTOR3 S = R * C1 + P * C2;
-	VECTOR3 P_dot = V * dotp(R, V) - R * vv;
-	double p_dot = length(P_dot);
+	COSATS = cos(alpha_TS);
+	t = T_TH;
+	P = V * RR - R * dotp(R, V);
+	p = length(P);
+	r = length(R);
+	vv = dotp(V, V);
+	C1 = COSB / r;
+	C2 = SINB / p;
+	S = R * C1 + P * C2;
+	P_dot = V * dotp(R, V) - R * vv;
+	p_dot = length(P_dot);
 	C2 = SINB / p;
-	VECTOR3 S_dot = V * C1 + P_dot * C2;
+	S_dot = V * C1 + P_dot * C2;
 	if (dotp(S_dot, T_P) < 0 && dotp(S, T_P) <= COSATS)
 	{
 		T_RP = t;
 		goto RTCC_PMMSPT_14_1;
 	}
-	int KX = 1;
+	KX = 1;
 	VECTOR3 Hbar, H_apo, W;
 	double h, w, du_apo, c, theta, du;
 	int err;
@@ -7921,17 +7973,17 @@ RTCC_PMMSPT_13_2:
 	C2 = SINB / p;
 	S = R * C1 + P * C2;
 RTCC_PMMSPT_14_1:
-	double cos_psi = dotp(S, T_P);
-	double sin_psi = sqrt(1.0 - cos_psi * cos_psi);
-	VECTOR3 Sbar_1 = (S*cos_psi-T_P) / sin_psi;
-	VECTOR3 Cbar_1 = crossp(Sbar_1, S);
-	VECTOR3 Omega_X = _V(M.m11, M.m12, M.m13);
-	VECTOR3 Omega_Y = _V(M.m21, M.m22, M.m23);
-	VECTOR3 Omega_Z = _V(M.m31, M.m32, M.m33);
-	double i = acos(dotp(Omega_Y, Cbar_1));
-	double X1 = dotp(Omega_Z, crossp(Cbar_1, Omega_Y));
-	double X2 = dotp(Omega_X, crossp(Cbar_1, Omega_Y));
-	double theta_N = atan2(X1, X2);
+	cos_psi = dotp(S, T_P);
+	sin_psi = sqrt(1.0 - cos_psi * cos_psi);
+	Sbar_1 = (S*cos_psi-T_P) / sin_psi;
+	Cbar_1 = crossp(Sbar_1, S);
+	Omega_X = _V(M.m11, M.m12, M.m13);
+	Omega_Y = _V(M.m21, M.m22, M.m23);
+	Omega_Z = _V(M.m31, M.m32, M.m33);
+	i = acos(dotp(Omega_Y, Cbar_1));
+	X1 = dotp(Omega_Z, crossp(Cbar_1, Omega_Y));
+	X2 = dotp(Omega_X, crossp(Cbar_1, Omega_Y));
+	theta_N = atan2(X1, X2);
 	if (theta_N < 0)
 	{
 		theta_N += PI2;
@@ -7940,9 +7992,9 @@ RTCC_PMMSPT_14_1:
 	{
 		goto RTCC_PMMSPT_21_1;
 	}
-	double P_N = (OrbMech::mu_Earth / C3)*(e_N*e_N - 1.0);
-	double T_M = P_N / (1.0 - e_N * cos_sigma);
-	double alpha_D_apo = acos(cos_psi) + atan2(dotp(Sbar_1, crossp(Cbar_1, Omega_Y)), dotp(S, crossp(Cbar_1, Omega_Y)));
+	P_N = (OrbMech::mu_Earth / C3)*(e_N*e_N - 1.0);
+	T_M = P_N / (1.0 - e_N * cos_sigma);
+	alpha_D_apo = acos(cos_psi) + atan2(dotp(Sbar_1, crossp(Cbar_1, Omega_Y)), dotp(S, crossp(Cbar_1, Omega_Y)));
 	in.CurMan->dV_inertial.x = i;
 	in.CurMan->dV_inertial.y = theta_N;
 	in.CurMan->dV_inertial.z = e_N;
@@ -7954,10 +8006,10 @@ RTCC_PMMSPT_14_1:
 	goto RTCC_PMMSPT_15_2;
 //RTCC_PMMSPT_15_1:
 RTCC_PMMSPT_15_2:
-	double P_RP = KP0 + SystemParameters.MDVSTP.KP1 * dt4_apo + SystemParameters.MDVSTP.KP2 * dt4_apo*dt4_apo;
-	double Y_RP = KP0 + SystemParameters.MDVSTP.KY1 * dt4_apo + SystemParameters.MDVSTP.KY2 * dt4_apo*dt4_apo;
-	double T3 = T3_apo - PZSTARGP.K_T3 * dt4_apo;
-	double tau3 = tau3R - dt4_apo;
+	P_RP = KP0 + SystemParameters.MDVSTP.KP1 * dt4_apo + SystemParameters.MDVSTP.KP2 * dt4_apo*dt4_apo;
+	Y_RP = KP0 + SystemParameters.MDVSTP.KY1 * dt4_apo + SystemParameters.MDVSTP.KY2 * dt4_apo*dt4_apo;
+	T3 = T3_apo - PZSTARGP.K_T3 * dt4_apo;
+	tau3 = tau3R - dt4_apo;
 	in.CurMan->Word73 = P_RP;
 	in.CurMan->Word74 = Y_RP;
 	in.CurMan->Word76 = T3;
@@ -7970,7 +8022,7 @@ RTCC_PMMSPT_15_2:
 	in.CurMan->Word82 = DV_BR;
 	in.CurMan->Word83 = tau2N;
 
-	double A_Z = 0.0;
+	A_Z = 0.0;
 	if (t_D < SystemParameters.MDVSTP.t_DS1)
 	{
 		if (t_D < SystemParameters.MDVSTP.t_DS0)
@@ -8000,19 +8052,19 @@ RTCC_PMMSPT_15_2:
 			A_Z += SystemParameters.MDVSTP.hx[2][N] * pow((t_D - SystemParameters.MDVSTP.t_D3) / SystemParameters.MDVSTP.t_SD3, N);
 		}
 	}
-	double Azo = 72.0*RAD;
-	double Azs = 36.0*RAD;
-	double i_P = SystemParameters.MDVSTP.fx[0] + SystemParameters.MDVSTP.fx[1] * (A_Z - Azo) / Azs + SystemParameters.MDVSTP.fx[2] * pow((A_Z - Azo) / Azs, 2) + SystemParameters.MDVSTP.fx[3] * pow((A_Z - Azo) / Azs, 3)
+	Azo = 72.0*RAD;
+	Azs = 36.0*RAD;
+	i_P = SystemParameters.MDVSTP.fx[0] + SystemParameters.MDVSTP.fx[1] * (A_Z - Azo) / Azs + SystemParameters.MDVSTP.fx[2] * pow((A_Z - Azo) / Azs, 2) + SystemParameters.MDVSTP.fx[3] * pow((A_Z - Azo) / Azs, 3)
 		+ SystemParameters.MDVSTP.fx[4] * pow((A_Z - Azo) / Azs, 4) + SystemParameters.MDVSTP.fx[5] * pow((A_Z - Azo) / Azs, 5) + SystemParameters.MDVSTP.fx[6] * pow((A_Z - Azo) / Azs, 6);
-	double theta_N_P = SystemParameters.MDVSTP.gx[0] + SystemParameters.MDVSTP.gx[1] * (A_Z - Azo) / Azs + SystemParameters.MDVSTP.gx[2] * pow((A_Z - Azo) / Azs, 2) + SystemParameters.MDVSTP.gx[3] * pow((A_Z - Azo) / Azs, 3)
+	theta_N_P = SystemParameters.MDVSTP.gx[0] + SystemParameters.MDVSTP.gx[1] * (A_Z - Azo) / Azs + SystemParameters.MDVSTP.gx[2] * pow((A_Z - Azo) / Azs, 2) + SystemParameters.MDVSTP.gx[3] * pow((A_Z - Azo) / Azs, 3)
 		+ SystemParameters.MDVSTP.gx[4] * pow((A_Z - Azo) / Azs, 4) + SystemParameters.MDVSTP.gx[5] * pow((A_Z - Azo) / Azs, 5) + SystemParameters.MDVSTP.gx[6] * pow((A_Z - Azo) / Azs, 6);
 
-	MATRIX3 A = _M(cos(SystemParameters.MDVSTP.PHIL), sin(SystemParameters.MDVSTP.PHIL)*sin(A_Z), -sin(SystemParameters.MDVSTP.PHIL)*cos(A_Z), -sin(SystemParameters.MDVSTP.PHIL), cos(SystemParameters.MDVSTP.PHIL)*sin(A_Z), -cos(SystemParameters.MDVSTP.PHIL)*cos(A_Z), 0, cos(A_Z), sin(A_Z));
-	MATRIX3 EPH = mul(OrbMech::tmat(A), M);
-	MATRIX3 BB = _M(cos(theta_N_P), 0, sin(theta_N_P), sin(theta_N_P)*sin(i_P), cos(i_P), -cos(theta_N_P)*sin(i_P), -sin(theta_N_P)*cos(i_P), sin(i_P), cos(theta_N_P)*cos(i_P));
-	MATRIX3 GG = mul(BB, A);
-	MATRIX3 B = _M(cos(theta_N), 0, sin(theta_N), sin(theta_N)*sin(i), cos(i), -cos(theta_N)*sin(i), -sin(theta_N)*cos(i), sin(i), cos(theta_N)*cos(i));
-	MATRIX3 G = mul(B, A);
+	A = _M(cos(SystemParameters.MDVSTP.PHIL), sin(SystemParameters.MDVSTP.PHIL)*sin(A_Z), -sin(SystemParameters.MDVSTP.PHIL)*cos(A_Z), -sin(SystemParameters.MDVSTP.PHIL), cos(SystemParameters.MDVSTP.PHIL)*sin(A_Z), -cos(SystemParameters.MDVSTP.PHIL)*cos(A_Z), 0, cos(A_Z), sin(A_Z));
+	EPH = mul(OrbMech::tmat(A), M);
+	BB = _M(cos(theta_N_P), 0, sin(theta_N_P), sin(theta_N_P)*sin(i_P), cos(i_P), -cos(theta_N_P)*sin(i_P), -sin(theta_N_P)*cos(i_P), sin(i_P), cos(theta_N_P)*cos(i_P));
+	GG = mul(BB, A);
+	B = _M(cos(theta_N), 0, sin(theta_N), sin(theta_N)*sin(i), cos(i), -cos(theta_N)*sin(i), -sin(theta_N)*cos(i), sin(i), cos(theta_N)*cos(i));
+	G = mul(B, A);
 
 	in.CurMan->GMTI = T_RP + SystemParameters.MDVSTP.DTIG;
 	in.CurMan->Word84 = SystemParameters.MDVSTP.DTIG - SystemParameters.MCTJD1;
@@ -12140,6 +12192,87 @@ void RTCC::LunarAscentProcessor(VECTOR3 R_LS, double m0, SV sv_CSM, double GETba
 	sv_Ins = sv_ins;
 }
 
+void RTCC::PoweredDescentTable(SV sv, double GETbase, const std::vector<VECTOR3> &R_LS, const std::vector<double> &TLAND, const LMPoweredFlightOptions &opt, std::vector<LMPoweredFlightResult> &res)
+{
+	std::vector<LMDescentCase> cases;
+	std::vector<LMPoweredFlightResult> flown;
+	std::vector<int> index;
+	LMDescentCase c;
+	MATRIX3 Rot;
+	SV sv_IG, sv_D;
+	VECTOR3 WI;
+	double t_go, CR, t_UL;
+	unsigned i, j;
+
+	t_UL = 7.9;
+	res.assign(R_LS.size()*TLAND.size(), LMPoweredFlightResult());
+
+	//Ignition and guidance inputs like PoweredDescentProcessor. These need the coasting integrator, only the flights run in parallel
+	for (i = 0;i < R_LS.size();i++)
+	{
+		for (j = 0;j < TLAND.size();j++)
+		{
+			if (!PDIIgnitionAlgorithm(sv, GETbase, R_LS[i], TLAND[j], sv_IG, t_go, CR, c.U_FDP, c.REFSMMAT))
+			{
+				continue;
+			}
+			c.t_go = -t_go;
+			c.t_IG = OrbMech::GETfromMJD(sv_IG.MJD, GETbase);
+			c.t0 = c.t_IG - t_UL;
+			sv_D = coast(sv_IG, -t_UL);
+			c.R = sv_D.R;
+			c.V = sv_D.V;
+			c.m = sv_IG.mass;
+
+			Rot = OrbMech::GetRotationMatrix(BODY_MOON, sv_IG.MJD);
+			WI = rhmul(Rot, _V(0, 0, 1));
+			c.W = mul(c.REFSMMAT, WI)*OrbMech::w_Moon;
+			c.R_LSP = mul(c.REFSMMAT, rhmul(Rot, R_LS[i]));
+			c.U_FDP = tmul(c.REFSMMAT, unit(c.U_FDP));
+			c.U_Pole = WI;
+			cases.push_back(c);
+			index.push_back(i*TLAND.size() + j);
+		}
+	}
+
+	LMPoweredFlightSim sim(opt);
+	sim.DescentTable(cases, &RTCCDescentTargets, flown);
+	for (i = 0;i < flown.size();i++)
+	{
+		res[index[i]] = flown[i];
+	}
+}
+
+void RTCC::LunarAscentTable(VECTOR3 R_LS, double m0, SV sv_CSM, double GETbase, const std::vector<double> &t_liftoff, double v_LH, double v_LV, const LMPoweredFlightOptions &opt, std::vector<LMPoweredFlightResult> &res)
+{
+	std::vector<LMAscentCase> cases;
+	LMAscentCase c;
+	SV sv_CSM_TIG;
+	MATRIX3 Rot;
+	unsigned i;
+
+	//Liftoff states like LunarAscentProcessor
+	for (i = 0;i < t_liftoff.size();i++)
+	{
+		sv_CSM_TIG = coast(sv_CSM, t_liftoff[i] - OrbMech::GETfromMJD(sv_CSM.MJD, GETbase));
+		Rot = OrbMech::GetRotationMatrix(BODY_MOON, sv_CSM_TIG.MJD);
+		c.R_C = sv_CSM_TIG.R;
+		c.V_C = sv_CSM_TIG.V;
+		c.U_Pole = rhmul(Rot, _V(0, 0, 1));
+		c.R = rhmul(Rot, R_LS);
+		c.V = crossp(c.U_Pole, c.R)*OrbMech::w_Moon;
+		c.m = m0;
+		c.t0 = 0.0;
+		c.r_LS = length(R_LS);
+		c.v_LH = v_LH;
+		c.v_LV = v_LV;
+		cases.push_back(c);
+	}
+
+	LMPoweredFlightSim sim(opt);
+	sim.AscentTable(cases, res);
+}
+
 bool RTCC::PDIIgnitionAlgorithm(SV sv, double GETbase, VECTOR3 R_LS, double TLAND, SV &sv_IG, double &t_go, double &CR, VECTOR3 &U_IG, MATRIX3 &REFSMMAT)
 {
 	SV sv_I;
@@ -12671,28 +12804,7 @@ double RTCC::GetSemiMajorAxis(SV sv)
 
 void RTCC::papiWriteScenario_REFS(FILEHANDLE scn, char *item, int tab, int i, REFSMMATData in)
 {
-	char buffer[256];
-
-	sprintf(buffer, "  %s %d %d %d %lf %.12lf %.12lf %.12lf %.12lf %.12lf %.12lf %.12lf %.12lf %.12lf", item, tab, i, in.ID, in.GMT, in.REFSMMAT.m11, in.REFSMMAT.m12, in.REFSMMAT.m13, in.REFSMMAT.m21, in.REFSMMAT.m22,
-		in.REFSMMAT.m23, in.REFSMMAT.m31, in.REFSMMAT.m32, in.REFSMMAT.m33);
-	oapiWriteLine(scn, buffer);
-}
-
-bool RTCC::papiReadScenario_REFS(char *line, char *item, int &tab, int &i, REFSMMATData &out)
-{
-	char buffer[256];
-
-	if (sscanf(line, "%s", buffer) == 1) {
-		if (!strcmp(buffer, item)) {
-			REFSMMATData v;
-			if (sscanf(line, "%s %d %d %d %lf %lf %lf %lf %lf %lf %lf %lf %lf %lf", buffer, &tab, &i, &v.ID, &v.GMT, &v.REFSMMAT.m11, &v.REFSMMAT.m12, &v.REFSMMAT.m13, &v.REFSMMAT.m21, &v.REFSMMAT.m22,
-				&v.REFSMMAT.m23, &v.REFSMMAT.m31, &v.REFSMMAT.m32, &v.REFSMMAT.m33) == 14) {
-				out = v;
-				return true;
-			}
-		}
-	}
-	return false;
+	ScenarioWriter(item).Int(tab).Int(i).Int(in.ID).Double(in.GMT).Mat(in.REFSMMAT).Write(scn);
 }
 
 void RTCC::PMXSPT(std::string source, int n)
@@ -14572,7 +14684,7 @@ int RTCC::PMMMCD(PMMMCDInput in, MPTManeuver &man)
 {
 	EphemerisData sv_GMTI, sv_GMTI_other;
 	VECTOR3 X_P, Y_P, Z_P, ExtDV, DV_A;
-	double GMT_begin, P_G, Y_G, AL, BE, a1, a2, a3, b1, b2, b3, c1, c2, c3, SINP, SINY, SINR, COSP, COSY, COSR, d1, d2, d3, d4, Thrust;
+	double GMT_begin, P_G, Y_G, AL, BE, a1, a2, a3, b1, b2, b3, c1, c2, c3, SINP, SINY, SINR, COSP, COSY, COSR, d1, d2, d3, d4, Thrust, dv;
 	int TAIND, J;
 	bool EXDVIND, Ind, TargetParamsInput;
 
@@ -14795,7 +14907,7 @@ RTCC_PMMMCD_11_4:
 		}
 		goto RTCC_PMMMCD_B;
 	}
-	double dv = length(DV_A);
+	dv = length(DV_A);
 	if (dv > 1e-10)
 	{
 		man.A_T = unit(DV_A);
@@ -15017,7 +15129,7 @@ int RTCC::PMMMPT(PMMMPTInput in, MPTManeuver &man)
 	CELEMENTS ELA;
 	EphemerisData sv_gmti, sv_gmti_other;
 	VECTOR3 DV_LVLH;
-	double WDI[6], TH[6], DELT[6], TIDPS, MASS, DELVB, T, GMTBB, GMTI, WAITA, DT, mu;
+	double WDI[6], TH[6], DELT[6], TIDPS, MASS, DELVB, T, GMTBB, GMTI, WAITA, DT, mu, TG;
 	int err = 0;
 
 	int NPHASE = 1;
@@ -15208,7 +15320,7 @@ RTCC_PMMMPT_6_A:
 	}
 	MASS = in.VehicleWeight;
 	DELVB = dv - SystemParameters.MCTAK4 / MASS;
-	double TG = (DELVB / SystemParameters.MCTLT2)*MASS;
+	TG = (DELVB / SystemParameters.MCTLT2)*MASS;
 	if (TG <= SystemParameters.MCTDD6)
 	{
 		NPHASE = 4;
@@ -17505,7 +17617,8 @@ int RTCC::PMMWTC(int med)
 	//M50: Vehicle Weight
 	if (med == 50)
 	{
-		double WeightGMT, W, WTV[4];
+		double WeightGMT, W, WTV[4], t_aw;
+		int I;
 
 		TabInd = med_m50.Table;
 		table = GetMPTPointer(TabInd);
@@ -17609,7 +17722,7 @@ int RTCC::PMMWTC(int med)
 		RTCC_PMMWTC_17A:
 			goto RTCC_PMMWTC_17B;
 		}
-		double t_aw = table->SIVBVentingBeginGET;
+		t_aw = table->SIVBVentingBeginGET;
 		if (t_aw >= med_m50.WeightGET)
 		{
 			goto RTCC_PMMWTC_19;
@@ -17625,7 +17738,7 @@ int RTCC::PMMWTC(int med)
 		{
 			goto RTCC_PMMWTC_19;
 		}
-		int I = MPTGetPrimaryThruster(table->mantable[IBLK - 2].Thruster);
+		I = MPTGetPrimaryThruster(table->mantable[IBLK - 2].Thruster);
 		FuelR[0] = CommonBlock.CSMRCSFuelRemaining;
 		FuelR[1] = CommonBlock.SPSFuelRemaining;
 		FuelR[2] = CommonBlock.SIVBFuelRemaining;
@@ -17832,6 +17945,7 @@ void RTCC::PMSVCT(int QUEID, int L, EphemerisData *sv0, bool landed, std::string
 	MissionPlanTable *mpt;
 	EphemerisData sv1;
 	unsigned I, K;
+	bool tli;
 
 	if (L == RTCC_MPT_CSM)
 	{
@@ -17906,7 +18020,7 @@ RTCC_PMSVCT_5:
 	//Page 7
 	//DTREAD MPT Header
 RTCC_PMSVCT_8:
-	bool tli = false;
+	tli = false;
 	for (unsigned i = 0;i < mpt->mantable.size();i++)
 	{
 		if (mpt->mantable[i].AttitudeCode == RTCC_ATTITUDE_SIVB_IGM)
@@ -29819,6 +29933,7 @@ void RTCC::PMMDAB(EphemerisData2 XIN, ASTInput ARIN, ASTSettings IRIN, ASTData &
 	bool err;
 	void *constPtr;
 	PCMATCArray outarray;
+	VECTOR3 h;
 	outarray.R0 = XIN.R;
 	outarray.V0 = XIN.V;
 	outarray.T0 = XIN.GMT;
@@ -29919,7 +30034,7 @@ void RTCC::PMMDAB(EphemerisData2 XIN, ASTInput ARIN, ASTSettings IRIN, ASTData &
 	double r_r, v_r, lat_r, lng_r, gamma_r, azi_r;
 	PICSSC(true, outarray.R_r, outarray.V_r, r_r, v_r, lat_r, lng_r, gamma_r, azi_r);
 
-	VECTOR3 h = crossp(outarray.R_r, outarray.V_r);
+	h = crossp(outarray.R_r, outarray.V_r);
 	AST.incl_EI = acos(h.z / length(h));
 
 	AST.AbortGMT = XIN.GMT;
@@ -29985,8 +30100,10 @@ bool RTCC::PCMATC(std::vector<double> &var, void *varPtr, std::vector<double>& a
 	//7: Sigma
 
 	OELEMENTS coe;
-	double gamma_p, T_min, h_p = 0.0, m_cut, dt_ar, t_a;
+	double gamma_p, T_min, h_p = 0.0, m_cut, dt_ar, t_a, a, E, h_r, T_ar;
 	int stop_ind;
+	VECTOR3 R_r_equ, V_r_equ;
+	MATRIX3 Rot;
 	//Pre abort
 	EphemerisData sv0;
 	//Actual abort time
@@ -30053,7 +30170,7 @@ PCMATC_1A:
 		goto PCMATC_3A;
 	}
 	coe = OrbMech::coe_from_sv(sv2.R, sv2.V, OrbMech::mu_Earth);
-	double a = OrbMech::GetSemiMajorAxis(sv2.R, sv2.V, OrbMech::mu_Earth);
+	a = OrbMech::GetSemiMajorAxis(sv2.R, sv2.V, OrbMech::mu_Earth);
 	double gamma_min;
 	if (coe.e > 1.0)
 	{
@@ -30072,7 +30189,7 @@ PCMATC_1A:
 	{
 		goto PCMATC_4C;
 	}
-	double E = OrbMech::TrueToEccentricAnomaly(coe.TA, coe.e);
+	E = OrbMech::TrueToEccentricAnomaly(coe.TA, coe.e);
 	if (E >= 3.0*PI05)
 	{
 		if (gamma_p > vars->gamma_stop)
@@ -30140,13 +30257,13 @@ PCMATC_3A:
 		vars->h_a = 0.0;
 	}
 	vars->h_p = r_p - OrbMech::R_Earth;
-	MATRIX3 Rot = OrbMech::GetRotationMatrix(BODY_EARTH, OrbMech::MJDfromGET(sv_r.GMT, vars->GMTBASE));
-	VECTOR3 R_r_equ = rhtmul(Rot, sv_r.R);
-	VECTOR3 V_r_equ = rhtmul(Rot, sv_r.V);
-	double h_r = length(sv_r.R) - OrbMech::R_Earth;
+	Rot = OrbMech::GetRotationMatrix(BODY_EARTH, OrbMech::MJDfromGET(sv_r.GMT, vars->GMTBASE));
+	R_r_equ = rhtmul(Rot, sv_r.R);
+	V_r_equ = rhtmul(Rot, sv_r.V);
+	h_r = length(sv_r.R) - OrbMech::R_Earth;
 	double r_r, v_r, lat_r, lng_r, gamma_r, azi_r;
 	PICSSC(true, R_r_equ, V_r_equ, r_r, v_r, lat_r, lng_r, gamma_r, azi_r);
-	double T_ar = sv_r.GMT - t_a;
+	T_ar = sv_r.GMT - t_a;
 
 	arr[0] = h_r / OrbMech::R_Earth;
 	arr[1] = lat_r;
@@ -31119,6 +31236,7 @@ void RTCC::PMMDMT(int L, unsigned man, RTCCNIAuxOutputTable *aux)
 	MPTManeuver *mptman;
 	EphemerisData sv_FF;
 	VECTOR3 V_G;
+	double h;
 	
 	if (mpt->mantable.size() < man)
 	{
@@ -31508,7 +31626,7 @@ void RTCC::PMMDMT(int L, unsigned man, RTCCNIAuxOutputTable *aux)
 		mptman->lat_BI = asin(sv_true.R.z / sv_true.R.x);
 	}
 	mptman->lng_BI = atan2(sv_true.R.y, sv_true.R.x);
-	double h = length(crossp(sv_true.R, sv_true.V));
+	h = length(crossp(sv_true.R, sv_true.V));
 	mptman->eta_BI = atan2(h*dotp(sv_true.R, sv_true.V), h*h - mu * length(sv_true.R));
 	if (mptman->eta_BI < 0)
 	{
@@ -32634,7 +32752,7 @@ void RTCC::EMSGSUPP(int QUEID, int refs, int refs2, unsigned man, bool headsup)
 	{
 		if (EZJGSTAR.size() == 0)
 		{
-			ifstream startable(".\\Config\\ProjectApollo\\RTCC\\Star Table.txt");
+			ifstream startable("Config/ProjectApollo/RTCC/Star Table.txt");
 			std::string line;
 			VECTOR3 temp;
 
@@ -33495,31 +33613,10 @@ void RTCC::QMEPHEM(int EPOCH, int YEAR, int MONTH, int DAY, double HOURS)
 
 bool RTCC::QMGEPH(double gmtbase, double HOURS)
 {
-	double MJD, MoonPos[12], EarthPos[12];
-	OBJHANDLE hMoon, hEarth;
-	CELBODY *cMoon, *cEarth;
-
-	hMoon = oapiGetObjectByName("Moon");
-	hEarth = oapiGetObjectByName("Earth");
-
-	cMoon = oapiGetCelbodyInterface(hMoon);
-	cEarth = oapiGetCelbodyInterface(hEarth);
-
-	//Store beginning time of ephemeris
-	MDGSUN.MJD = gmtbase - 5.0;
-
-	for (int i = 0;i < 71;i++)
+	//Fit the ephemeris from 10 days before to 100 days after launch day
+	if (MDGSUN.Generate(gmtbase - 10.0, gmtbase + 100.0))
 	{
-		MJD = MDGSUN.MJD + 0.5*(double)(i);
-
-		//Moon Ephemeris
-		cMoon->clbkEphemeris(MJD, EPHEM_TRUEPOS, MoonPos);
-		MDGSUN.R_EM[i] = _V(MoonPos[0], MoonPos[2], MoonPos[1]) / OrbMech::R_Earth;
-		MDGSUN.V_EM[i] = _V(MoonPos[3], MoonPos[5], MoonPos[4]) / OrbMech::R_Earth*3600.0;
-
-		//Sun Ephemers
-		cEarth->clbkEphemeris(MJD, EPHEM_TRUEPOS | EPHEM_TRUEVEL, EarthPos);
-		MDGSUN.R_ES[i] = -OrbMech::Polar2Cartesian(EarthPos[2] * AU, EarthPos[1], EarthPos[0]) / OrbMech::R_Earth;
+		return true;
 	}
 
 	//MCCBES stored as the time of midnight on launch day since beginning of the year
@@ -33559,6 +33656,12 @@ void RTCC::RMMYNI(const RMMYNIInputTable &in, RMMYNIOutputTable &out)
 	integ.Main(in, out);
 }
 
+void RTCC::RMMYNIDispersion(const EntryDispersionInputTable &in, EntryDispersionOutputTable &out)
+{
+	EntryDispersion disp(this);
+	disp.Main(in, out);
+}
+
 void RTCC::RMMGIT(EphemerisData2 sv_EI, double lng_T)
 {
 	//sv_EI in ECT
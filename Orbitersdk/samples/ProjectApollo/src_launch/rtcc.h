@@ -27,6 +27,7 @@ See http://nassp.sourceforge.net/license/ for more details.
 #include <vector>
 #include <deque>
 #include <bitset>
+#include <fstream>
 #include "../src_sys/yaAGC/agc_engine.h"
 #include "../src_lm/yaAGS/aea_engine.h"
 #include "../src_rtccmfd/OrbMech.h"
@@ -38,10 +39,13 @@ See http://nassp.sourceforge.net/license/ for more details.
 #include "../src_rtccmfd/LMGuidanceSim.h"
 #include "../src_rtccmfd/CoastNumericalIntegrator.h"
 #include "../src_rtccmfd/EnckeIntegrator.h"
+#include "../src_rtccmfd/SunMoonEphemeris.h"
 #include "../src_rtccmfd/RTCCSystemParameters.h"
 #include "MCCPADForms.h"
 
 class Saturn;
+class MCC;
+class ScenarioReader;
 
 #define RTCC_START_STRING	"RTCC_BEGIN"
 #define RTCC_END_STRING	    "RTCC_END"
@@ -1371,7 +1375,8 @@ struct DetailedManeuverTable
 struct MPTVehicleDataBlock
 {
 	void SaveState(FILEHANDLE scn);
-	void LoadState(char *line, int &inttemp);
+	//Binds the items of the block to r
+	void LoadState(ScenarioReader &r);
 
 	//Word 12 (Bytes 1, 2)
 	std::bitset<4> ConfigCode;
@@ -2584,7 +2589,13 @@ public:
 	MATRIX3 REFSMMATCalc(REFSMMATOpt *opt);
 	void EntryTargeting(EntryOpt *opt, EntryResults *res);//VECTOR3 &dV_LVLH, double &P30TIG, double &latitude, double &longitude, double &GET05G, double &RTGO, double &VIO, double &ReA, int &precision);
 	void BlockDataProcessor(EarthEntryOpt *opt, EntryResults *res);
+	void TranslunarMidcourseCorrectionInputs(EphemerisData sv0, double CSMmass, double LMmass, TLMCCDataTable &datatab, TLMCCMEDQuantities &medquant, TLMCCMissionConstants &mccconst);
 	void TranslunarMidcourseCorrectionProcessor(EphemerisData sv0, double CSMmass, double LMmass);
+	//Stores a solution in a column of the midcourse display, the MPT transfer and the skeleton flight plan tables
+	void TranslunarMidcourseCorrectionColumn(int column, const TLMCCOutputData &out);
+	//Solves the given modes at all given midcourse GETs with the MCC planning table inputs and ranks the options.
+	//The best converged options are stored in the columns of the midcourse display, the other columns are deleted.
+	void TranslunarMidcourseCorrectionScan(EphemerisData sv0, double CSMmass, double LMmass, const std::vector<int> &modes, const std::vector<double> &GET_MCC, TLMCCScanTable &tab);
 	int LunarDescentPlanningProcessor(SV sv);
 	bool GeneralManeuverProcessor(GMPOpt *opt, VECTOR3 &dV_i, double &P30TIG);
 	bool GeneralManeuverProcessor(GMPOpt *opt, VECTOR3 &dV_i, double &P30TIG, GPMPRESULTS &res);
@@ -2629,6 +2640,10 @@ public:
 	bool LunarLiftoffTimePredictionDT(const LLTPOpt &opt, LunarLaunchTargetingTable &res);
 	void LunarAscentProcessor(VECTOR3 R_LS, double m0, SV sv_CSM, double GETbase, double t_liftoff, double v_LH, double v_LV, double &theta, double &dt_asc, double &dv, SV &sv_IG, SV &sv_Ins);
 	bool PoweredDescentProcessor(VECTOR3 R_LS, double TLAND, SV sv, double GETbase, RTCCNIAuxOutputTable &aux, EphemerisDataTable2 *E, SV &sv_PDI, SV &sv_land, double &dv);
+	//Flies the descent to every landing site and landing time with the variable step LM simulation. Results are in the order i*TLAND.size() + j
+	void PoweredDescentTable(SV sv, double GETbase, const std::vector<VECTOR3> &R_LS, const std::vector<double> &TLAND, const LMPoweredFlightOptions &opt, std::vector<LMPoweredFlightResult> &res);
+	//Flies the ascent at every liftoff time with the variable step LM simulation. The cutoff time is relative to liftoff
+	void LunarAscentTable(VECTOR3 R_LS, double m0, SV sv_CSM, double GETbase, const std::vector<double> &t_liftoff, double v_LH, double v_LV, const LMPoweredFlightOptions &opt, std::vector<LMPoweredFlightResult> &res);
 	void EntryUpdateCalc(SV sv0, double GETbase, double entryrange, bool highspeed, EntryResults *res);
 	void PMMDKI(SPQOpt &opt, SPQResults &res);
 	//Velocity maneuver performer
@@ -3025,6 +3040,8 @@ public:
 	};
 	void PLAWDT(const PLAWDTInput &in, PLAWDTOutput &out);
 	bool PLEFEM(int IND, double HOUR, int YEAR, VECTOR3 &R_EM, VECTOR3 &V_EM, VECTOR3 &R_ES);
+	//Batch version, returns true if any of the times are outside of the ephemeris
+	bool PLEFEM(int IND, const std::vector<double> &HOUR, int YEAR, std::vector<VECTOR3> &R_EM, std::vector<VECTOR3> &V_EM, std::vector<VECTOR3> &R_ES);
 	bool PLEFEM(int IND, double HOUR, int YEAR, MATRIX3 &M_LIB);
 
 	// REENTRY COMPUTATIONS (R)
@@ -3037,6 +3054,8 @@ public:
 	double RLMTLC(EphemerisDataTable &ephemeris, ManeuverTimesTable &MANTIMES, double long_des, double GMT_min, double &GMT_cross, LunarStayTimesTable *LUNRSTAY = NULL);
 	//Reentry numerical integrator
 	void RMMYNI(const RMMYNIInputTable &in, RMMYNIOutputTable &out);
+	//Reentry dispersion analysis with the reentry numerical integrator
+	void RMMYNIDispersion(const EntryDispersionInputTable &in, EntryDispersionOutputTable &out);
 	//Reentry Constant G Iterator
 	void RMMGIT(EphemerisData2 sv_EI, double lng_T);
 	//Retrofire Planning Control Module
@@ -4551,18 +4570,8 @@ public:
 		std::vector<std::string> tab;
 	} MHGVNM;
 
-	struct SunMoonEphemerisTable
-	{
-		int EPOCH;
-		//MJD of first entry
-		double MJD;
-		//Table of vectors pointing from Earth to Sun, in Er
-		VECTOR3 R_ES[71];
-		//Table of vectors pointing from Earth to Moon, in Er
-		VECTOR3 R_EM[71];
-		//Table of velocity vectors of the Moon relative to the Earth, in Er/hr
-		VECTOR3 V_EM[71];
-	} MDGSUN;
+	//Sun/Moon ephemeris, Chebyshev segments of the Earth-Moon and Earth-Sun vectors (Er, Er/hr)
+	SunMoonEphemeris MDGSUN;
 
 	//System parameters for PDI
 	LGCDescentConstants RTCCDescentTargets;
@@ -4634,7 +4643,6 @@ private:
 	void FindRadarMidPass(SV sv, double GETbase, double lat, double lng, double &GET_Mid);
 	double GetSemiMajorAxis(SV sv);
 	void papiWriteScenario_REFS(FILEHANDLE scn, char *item, int tab, int i, REFSMMATData in);
-	bool papiReadScenario_REFS(char *line, char *item, int &tab, int &i, REFSMMATData &out);
 	void DMissionRendezvousPlan(SV sv_A0, double GETbase, double &t_TPI0);
 	void FMissionRendezvousPlan(VESSEL *chaser, VESSEL *target, SV sv_A0, double GETbase, double t_TIG, double t_TPI, double &t_Ins, double &CSI);
 
@@ -43,6 +43,7 @@
 #include "tracer.h"
 #include "papi.h"
 #include "Mission.h"
+#include "LunarTerrain.h"
 
 #include "connector.h"
 
@@ -365,6 +366,7 @@ LEM::LEM(OBJHANDLE hObj, int fmodel) : Payload (hObj, fmodel),
 	aea(Panelsdk, deda),
 	deda(this,soundlib, aea),
 	CWEA(soundlib, Bclick),
+	tlmbus(NASSP_TLMBUS_LM),
 	DPS(th_hover),
 	DPSPropellant(ph_Dsc, Panelsdk),
 	APSPropellant(ph_Asc, Panelsdk),
@@ -432,6 +434,12 @@ LEM::LEM(OBJHANDLE hObj, int fmodel) : Payload (hObj, fmodel),
 
 LEM::~LEM()
 {
+	systemsStepper.Wait();
+
+#ifdef NASSP_PROFILE
+	systemsGraph.WriteStats(GetName());
+#endif
+
 	ReleaseSurfaces();
 	ReleaseSurfacesVC();
 
@@ -485,6 +493,8 @@ void LEM::Init()
 	RefreshPanelIdInTimestep = false;
 	InFOV = true;
 	SaveFOV = 0;
+	isMultiThread = false;
+	isSystemsThread = false;
 	VcInfoActive = false;
 	VcInfoEnabled = false;
 
@@ -707,6 +717,7 @@ void LEM::LoadDefaultSounds()
 }
 
 int LEM::clbkConsumeBufferedKey(DWORD key, bool down, char *keystate) {
+	systemsStepper.Wait();
 
 	// rewrote to get key events rather than monitor key state - LazyD
 
@@ -1087,6 +1098,11 @@ int LEM::clbkConsumeBufferedKey(DWORD key, bool down, char *keystate) {
 
 void LEM::clbkPreStep (double simt, double simdt, double mjd) {
 
+	PROFILEFRAME(simt);
+
+	// Frame barrier for the systems worker
+	systemsStepper.Wait();
+
 	if (CheckPanelIdInTimestep) {
 		oapiSetPanel(PanelId);
 		CheckPanelIdInTimestep = false;
@@ -1196,6 +1212,9 @@ void LEM::clbkPreStep (double simt, double simdt, double mjd) {
 
 void LEM::clbkPostStep(double simt, double simdt, double mjd)
 {
+	// A docked CSM on the same worker may have started its step already
+	systemsStepper.Wait();
+
 	// Simulate the dust kicked up near
 	// the lunar surface
 	double vsAlt = GetAltitude(ALTMODE_GROUND);
@@ -1290,6 +1309,24 @@ void LEM::clbkPostStep(double simt, double simdt, double mjd)
 	MainPanel.timestep(MissionTime);
 	checkControl.timestep(MissionTime, DummyEvents);
 
+	// Publish to the telemetry bus
+	if (tlmbus.BeginFrame(this, MissionTime))
+	{
+		tlmbus.SetDSKY(0, dsky);
+		tlmbus.SetDEDA(deda.GetAdr(), deda.GetData());
+		tlmbus.SetCWSLights(0, CWEA.GetLightRow(0) | (CWEA.GetLightRow(1) << 8) | (CWEA.GetLightRow(2) << 16) | (CWEA.GetLightRow(3) << 24));
+		tlmbus.SetCWSLights(1, CWEA.GetLightRow(4));
+		tlmbus.EndFrame();
+	}
+
+	// With the systems thread option the internal systems step over the frame Orbiter has just integrated
+	// runs on the systems worker until the next clbkPreStep
+	if (isSystemsThread && !FirstTimestep)
+	{
+		Panelsdk.UpdateEnvironment();
+		systemsStepper.Start(simdt);
+	}
+
     // x15 landing sound management
 #ifdef DIRECTSOUNDENABLED
 
@@ -1800,6 +1837,9 @@ void LEM::clbkPostCreation()
 	}
 
 	CreateAirfoils();
+
+	//Optional elevation data for the landing radar, if there is none it comes from Orbiter
+	LunarTerrain::Get().LoadDEM("Config\\ProjectApollo\\LunarTerrain.dem");
 }
 
 void LEM::clbkVisualCreated(VISHANDLE vis, int refcount)
@@ -1879,6 +1919,11 @@ bool LEM::ProcessConfigFileLine(FILEHANDLE scn, char *line)
 		sscanf (line+11, "%d", &value);
 		isMultiThread=(value>0)?true:false;
 	}
+	else if (!strnicmp (line, "SYSTEMSTHREAD", 13)) {
+		int value;
+		sscanf (line+13, "%d", &value);
+		isSystemsThread=(value>0)?true:false;
+	}
 	else if (!strnicmp (line, "JOYSTICK_RHC", 12)) {
 		sscanf (line + 12, "%i", &rhc_id);
 		if(rhc_id > 1){ rhc_id = 1; } // Be paranoid
@@ -1972,6 +2017,8 @@ void LEM::SetStateEx(const void *status)
 void LEM::clbkSaveState (FILEHANDLE scn)
 
 {
+	systemsStepper.Wait();
+
 	SaveDefaultState (scn);	
 	oapiWriteScenario_int (scn, "CONFIGURATION", status);
 	if (CDREVA_IP){
@@ -33,11 +33,14 @@
 #include "dinput.h"
 #include "vesim.h"
 #include "dsky.h"
-#include "imu.h"
+#include "IMU.h"
 #include "cdu.h"
 #include "lmscs.h"
 #include "lm_ags.h"
 #include "lm_telecom.h"
+#include "TelemetryBus.h"
+#include "SystemsStepper.h"
+#include "SystemUpdateGraph.h"
 #include "pyro.h"
 #include "lm_eds.h"
 #include "lm_aps.h"
@@ -103,6 +106,8 @@ typedef struct {
 	int lmpStatus;
 } LEMECSStatus;
 
+class MCC;
+
 // Systems things
 
 // Landing Radar
@@ -528,6 +533,7 @@ public:
 	// Panel SDK
 	void SetPipeMaxFlow(char *pipe, double flow);
 	h_Pipe* GetLMTunnelPipe();
+	SystemsStepper *GetSystemsStepper() { return &systemsStepper; };
 	h_Valve* GetCSMO2HoseOutlet();
 	void ConnectTunnelToCabinVent();
 	double GetRCSQuadTempF(int index);
@@ -717,6 +723,7 @@ protected:
 
 	void SystemsTimestep(double simt, double simdt);
 	void SystemsInit();
+	void SystemsGraphInit();
 	void SystemsInternalTimestep(double simdt);
 	void JoystickTimestep(double simdt);
 	bool ProcessConfigFileLine (FILEHANDLE scn, char *line);
@@ -1879,6 +1886,13 @@ protected:
 	LM_SBAND SBand;
 	LM_DSEA DSEA;
 	LM_PCM PCM;
+	TelemetryBus tlmbus;
+
+	// Internal systems timestep worker for the systems thread option
+	SystemsStepper systemsStepper;
+
+	// Update order and rates of the internal systems
+	SystemUpdateGraph systemsGraph;
 
 	//Lighting
 	LEM_TLE tle;
@@ -1946,6 +1960,7 @@ protected:
 	SCERA2 scera2;
 
 	bool isMultiThread;
+	bool isSystemsThread;
 
 	mission::Mission* pMission;
 
@@ -33,7 +33,7 @@
 #include "toggleswitch.h"
 #include "apolloguidance.h"
 #include "dsky.h"
-#include "lemcomputer.h"
+#include "LEMcomputer.h"
 #include "papi.h"
 #include "saturn.h"
 #include "LEM.h"
@@ -253,13 +253,13 @@ void LEMcomputer::ProcessChannel13(ChannelValue val){
 void LEMcomputer::ProcessChannel5(ChannelValue val){
 	// This is now handled inside the ATCA
 	LEM *lem = (LEM *) OurVessel;	
-	lem->atca.ProcessLGC(5,val.to_ulong());
+	lem->atca.ProcessLGC(5,val.to_ulong(),GetCycleTime());
 }
 
 void LEMcomputer::ProcessChannel6(ChannelValue val){
 	// This is now handled inside the ATCA
 	LEM *lem = (LEM *) OurVessel;	
-	lem->atca.ProcessLGC(6,val.to_ulong());
+	lem->atca.ProcessLGC(6,val.to_ulong(),GetCycleTime());
 }
 
 void LEMcomputer::ProcessChannel142(ChannelValue val) {
@@ -24,7 +24,7 @@ See http://nassp.sourceforge.net/license/ for more details.
 
 // To force orbitersdk.h to use <fstream> in any compiler version
 #pragma include_alias( <fstream.h>, <fstream> )
-#include "orbitersdk.h"
+#include "Orbitersdk.h"
 #include "stdio.h"
 #include "Sat5LMDSC.h"
 
@@ -82,6 +82,13 @@ bool LEMECSConnector::ReceiveMessage(Connector *from, ConnectorMessage &m) {
 		return true;
 	}
 
+	else if (m.messageType == 3)
+	{
+		m.val1.pValue = OurVessel->GetSystemsStepper();
+
+		return true;
+	}
+
 	return false;
 }
 
@@ -1476,6 +1476,7 @@ void LEM::InitPanel (int panel)
 }
 
 bool LEM::clbkLoadPanel (int id) {
+	systemsStepper.Wait();
 
 	//
 	// Release all surfaces
@@ -3072,6 +3073,8 @@ void LEM::AbortFire()
 bool LEM::clbkPanelMouseEvent (int id, int event, int mx, int my)
 
 {
+	systemsStepper.Wait();
+
 	static int ctrl = 0;
 
 	//
@@ -3210,6 +3213,8 @@ bool LEM::clbkPanelMouseEvent (int id, int event, int mx, int my)
 bool LEM::clbkPanelRedrawEvent (int id, int event, SURFHANDLE surf) 
 
 {
+	systemsStepper.Wait();
+
 	//
 	// Special handling ORDEAL
 	//
@@ -46,6 +46,8 @@
 
 #include "papi.h"
 #include "Mission.h"
+#include "profiler.h"
+#include "LunarTerrain.h"
 
 void LEM::ResetThrusters()
 
@@ -157,6 +159,8 @@ void LEM::SystemsInit()
 {
 	Panelsdk.RegisterVessel(this);
 	Panelsdk.InitFromFile("ProjectApollo/LEMSystems");
+	systemsStepper.SetStep([this](double dt) { SystemsInternalTimestep(dt); });
+	SystemsGraphInit();
 
 	// DS20060407 Start wiring things together
 
@@ -842,6 +846,19 @@ void LEM::SystemsInit()
 	
 	// Initialize other systems
 	atca.Init(this, (h_HeatLoad *)Panelsdk.GetPointerByString("HYDRAULIC:ATCAHEAT"));
+
+	// Systems values on the telemetry bus
+	tlmbus.AddValue("CabinPress", (double *)Panelsdk.GetPointerByString("HYDRAULIC:CABIN:PRESS"));
+	tlmbus.AddValue("SuitCircuitPress", (double *)Panelsdk.GetPointerByString("HYDRAULIC:SUITCIRCUIT:PRESS"));
+	tlmbus.AddValue("DesO2ManifoldPress", (double *)Panelsdk.GetPointerByString("HYDRAULIC:DESO2MANIFOLD:PRESS"));
+	tlmbus.AddValue("AscO2Tank1Press", (double *)Panelsdk.GetPointerByString("HYDRAULIC:ASCO2TANK1:PRESS"));
+	tlmbus.AddValue("AscO2Tank2Press", (double *)Panelsdk.GetPointerByString("HYDRAULIC:ASCO2TANK2:PRESS"));
+	tlmbus.AddValue("DscBatteryATemp", (double *)Panelsdk.GetPointerByString("ELECTRIC:DSC_BATTERY_A:TEMP"));
+	tlmbus.AddValue("DscBatteryBTemp", (double *)Panelsdk.GetPointerByString("ELECTRIC:DSC_BATTERY_B:TEMP"));
+	tlmbus.AddValue("DscBatteryCTemp", (double *)Panelsdk.GetPointerByString("ELECTRIC:DSC_BATTERY_C:TEMP"));
+	tlmbus.AddValue("DscBatteryDTemp", (double *)Panelsdk.GetPointerByString("ELECTRIC:DSC_BATTERY_D:TEMP"));
+	tlmbus.AddValue("AscBatteryATemp", (double *)Panelsdk.GetPointerByString("ELECTRIC:ASC_BATTERY_A:TEMP"));
+	tlmbus.AddValue("AscBatteryBTemp", (double *)Panelsdk.GetPointerByString("ELECTRIC:ASC_BATTERY_B:TEMP"));
 }
 
 void LEM::JoystickTimestep(double simdt)
@@ -1369,92 +1386,99 @@ void LEM::JoystickTimestep(double simdt)
 	}
 }
 
+void LEM::SystemsGraphInit()
+{
+	systemsGraph.Add("Panelsdk", [this](double dt) { Panelsdk.StepSystems(dt); });
+	systemsGraph.Add("agc", [this](double dt) { agc.SystemTimestep(dt); });
+	systemsGraph.Add("dsky", [this](double dt) { dsky.SystemTimestep(dt); });
+	systemsGraph.Add("asa", [this](double dt) { asa.SystemTimestep(dt); });
+	systemsGraph.Add("aea", [this](double dt) { aea.SystemTimestep(dt); });
+	systemsGraph.Add("deda", [this](double dt) { deda.SystemTimestep(dt); });
+	systemsGraph.Add("imu", [this](double dt) { imu.SystemTimestep(dt); });
+	systemsGraph.Add("atca", [this](double dt) { atca.SystemTimestep(dt); });
+	systemsGraph.Add("rga", [this](double dt) { rga.SystemTimestep(dt); });
+	systemsGraph.Add("ordeal", [this](double dt) { ordeal.SystemTimestep(dt); });
+	systemsGraph.Add("fdaiLeft", [this](double dt) { fdaiLeft.SystemTimestep(dt); });
+	systemsGraph.Add("fdaiRight", [this](double dt) { fdaiRight.SystemTimestep(dt); });
+	systemsGraph.Add("LR", [this](double dt) { LR.SystemTimestep(dt); });
+	systemsGraph.Add("RR", [this](double dt) { RR.SystemTimestep(dt); });
+	systemsGraph.Add("RadarTape", [this](double dt) { RadarTape.SystemTimestep(dt); });
+	systemsGraph.Add("crossPointerLeft", [this](double dt) { crossPointerLeft.SystemTimestep(dt); });
+	systemsGraph.Add("crossPointerRight", [this](double dt) { crossPointerRight.SystemTimestep(dt); });
+	systemsGraph.Add("SBandSteerable", [this](double dt) { SBandSteerable.SystemTimestep(dt); });
+	systemsGraph.Add("VHF", [this](double dt) { VHF.SystemTimestep(dt); });
+	systemsGraph.Add("PCM", [this](double dt) { PCM.SystemTimestep(dt); });
+	systemsGraph.Add("SBand", [this](double dt) { SBand.SystemTimestep(dt); });
+	systemsGraph.Add("DSEA", [this](double dt) { DSEA.SystemTimestep(dt); });
+	systemsGraph.Add("CabinPressureSwitch", [this](double dt) { CabinPressureSwitch.SystemTimestep(dt); });
+	systemsGraph.Add("SuitPressureSwitch", [this](double dt) { SuitPressureSwitch.SystemTimestep(dt); });
+	systemsGraph.Add("CabinRepressValve", [this](double dt) { CabinRepressValve.SystemTimestep(dt); });
+	systemsGraph.Add("SuitCircuitPressureRegulatorA", [this](double dt) { SuitCircuitPressureRegulatorA.SystemTimestep(dt); });
+	systemsGraph.Add("SuitCircuitPressureRegulatorB", [this](double dt) { SuitCircuitPressureRegulatorB.SystemTimestep(dt); });
+	systemsGraph.Add("CDRIsolValve", [this](double dt) { CDRIsolValve.SystemTimestep(dt); });
+	systemsGraph.Add("LMPIsolValve", [this](double dt) { LMPIsolValve.SystemTimestep(dt); });
+	systemsGraph.Add("OVHDCabinReliefDumpValve", [this](double dt) { OVHDCabinReliefDumpValve.SystemTimestep(dt); });
+	systemsGraph.Add("FWDCabinReliefDumpValve", [this](double dt) { FWDCabinReliefDumpValve.SystemTimestep(dt); });
+	systemsGraph.Add("SuitCircuitReliefValve", [this](double dt) { SuitCircuitReliefValve.SystemTimestep(dt); });
+	systemsGraph.Add("SuitGasDiverter", [this](double dt) { SuitGasDiverter.SystemTimestep(dt); });
+	systemsGraph.Add("CabinGasReturnValve", [this](double dt) { CabinGasReturnValve.SystemTimestep(dt); });
+	systemsGraph.Add("CO2CanisterSelect", [this](double dt) { CO2CanisterSelect.SystemTimestep(dt); }, SYSTEM_RATE_VALVE);
+	systemsGraph.Add("PrimCO2CanisterVent", [this](double dt) { PrimCO2CanisterVent.SystemTimestep(dt); }, SYSTEM_RATE_VALVE);
+	systemsGraph.Add("SecCO2CanisterVent", [this](double dt) { SecCO2CanisterVent.SystemTimestep(dt); }, SYSTEM_RATE_VALVE);
+	systemsGraph.Add("WaterSeparationSelector", [this](double dt) { WaterSeparationSelector.SystemTimestep(dt); }, SYSTEM_RATE_VALVE);
+	systemsGraph.Add("WaterTankSelect", [this](double dt) { WaterTankSelect.SystemTimestep(dt); }, SYSTEM_RATE_VALVE);
+	systemsGraph.Add("CabinFan", [this](double dt) { CabinFan.SystemTimestep(dt); });
+	systemsGraph.Add("PrimGlycolPumpController", [this](double dt) { PrimGlycolPumpController.SystemTimestep(dt); });
+	systemsGraph.Add("SuitFanDPSensor", [this](double dt) { SuitFanDPSensor.SystemTimestep(dt); });
+	systemsGraph.Add("DPSPropellant", [this](double dt) { DPSPropellant.SystemTimestep(dt); });
+	systemsGraph.Add("DPS", [this](double dt) { DPS.SystemTimestep(dt); });
+	systemsGraph.Add("deca", [this](double dt) { deca.SystemTimestep(dt); });
+	systemsGraph.Add("gasta", [this](double dt) { gasta.SystemTimestep(dt); });
+	systemsGraph.Add("scera1", [this](double dt) { scera1.SystemTimestep(dt); });
+	systemsGraph.Add("scera2", [this](double dt) { scera2.SystemTimestep(dt); });
+	systemsGraph.Add("MissionTimerDisplay", [this](double dt) { MissionTimerDisplay.SystemTimestep(dt); });
+	systemsGraph.Add("EventTimerDisplay", [this](double dt) { EventTimerDisplay.SystemTimestep(dt); });
+	systemsGraph.Add("CWEA", [this](double dt) { CWEA.SystemTimestep(dt); });
+	systemsGraph.Add("ECA_1", [this](double dt) { ECA_1.SystemTimestep(dt); });
+	systemsGraph.Add("ECA_2", [this](double dt) { ECA_2.SystemTimestep(dt); });
+	systemsGraph.Add("ECA_3", [this](double dt) { ECA_3.SystemTimestep(dt); });
+	systemsGraph.Add("ECA_4", [this](double dt) { ECA_4.SystemTimestep(dt); });
+	systemsGraph.Add("tle", [this](double dt) { tle.SystemTimestep(dt); });
+	systemsGraph.Add("DockLights", [this](double dt) { DockLights.SystemTimestep(dt); }, SYSTEM_RATE_FRAME);
+	systemsGraph.Add("lca", [this](double dt) { lca.SystemTimestep(dt); });
+	systemsGraph.Add("UtilLights", [this](double dt) { UtilLights.SystemTimestep(dt); });
+	systemsGraph.Add("COASLights", [this](double dt) { COASLights.SystemTimestep(dt); });
+	systemsGraph.Add("FloodLights", [this](double dt) { FloodLights.SystemTimestep(dt); });
+	systemsGraph.Add("INV_1", [this](double dt) { INV_1.SystemTimestep(dt); });
+	systemsGraph.Add("INV_2", [this](double dt) { INV_2.SystemTimestep(dt); });
+
+	systemsGraph.AllAfter("Panelsdk");
+	//The descent stage ECAs are gone after staging
+	systemsGraph.SetActive("ECA_1", [this]() { return stage < 2; });
+	systemsGraph.SetActive("ECA_2", [this]() { return stage < 2; });
+	//Systems that do nothing while they are unpowered or idle
+	systemsGraph.SetActive("deda", [this]() { return deda.IsPowered(); });
+	systemsGraph.SetActive("fdaiLeft", [this]() { return fdaiLeft.IsPowered(); });
+	systemsGraph.SetActive("fdaiRight", [this]() { return fdaiRight.IsPowered(); });
+	systemsGraph.SetActive("LR", [this]() { return LR.IsPowered(); });
+	systemsGraph.SetActive("RadarTape", [this]() { return RadarTape.IsPowered(); });
+	systemsGraph.SetActive("crossPointerLeft", [this]() { return crossPointerLeft.IsPowered(); });
+	systemsGraph.SetActive("crossPointerRight", [this]() { return crossPointerRight.IsPowered(); });
+	systemsGraph.SetActive("gasta", [this]() { return gasta.IsPowered(); });
+	systemsGraph.SetActive("tle", [this]() { return tle.IsPowered(); });
+}
+
 void LEM::SystemsInternalTimestep(double simdt)
 {
-	double mintFactor = __max(simdt / 20.0, 0.02);
-	double tFactor = __min(mintFactor, simdt);
-	while (simdt > 0) {
-
-		// Each Timestep is passed to the SPSDK
-		// to perform internal computations on the 
-		// systems.
-
-		Panelsdk.SimpleTimestep(tFactor);
-
-		agc.SystemTimestep(tFactor);								// Draw power & generate heat
-		dsky.SystemTimestep(tFactor);								// This can draw power now.
-		asa.SystemTimestep(tFactor);
-		aea.SystemTimestep(tFactor);
-		deda.SystemTimestep(tFactor);
-		imu.SystemTimestep(tFactor);								// Draw power
-		atca.SystemTimestep(tFactor);
-		rga.SystemTimestep(tFactor);
-		ordeal.SystemTimestep(tFactor);
-		fdaiLeft.SystemTimestep(tFactor);							// Draw Power
-		fdaiRight.SystemTimestep(tFactor);
-		LR.SystemTimestep(tFactor);
-		RR.SystemTimestep(tFactor);
-		RadarTape.SystemTimestep(tFactor);
-		crossPointerLeft.SystemTimestep(tFactor);
-		crossPointerRight.SystemTimestep(tFactor);
-		SBandSteerable.SystemTimestep(tFactor);
-		VHF.SystemTimestep(tFactor);
-		PCM.SystemTimestep(tFactor);
-		SBand.SystemTimestep(tFactor);
-		DSEA.SystemTimestep(tFactor);
-		CabinPressureSwitch.SystemTimestep(tFactor);
-		SuitPressureSwitch.SystemTimestep(tFactor);
-		CabinRepressValve.SystemTimestep(tFactor);
-		SuitCircuitPressureRegulatorA.SystemTimestep(tFactor);
-		SuitCircuitPressureRegulatorB.SystemTimestep(tFactor);
-		CDRIsolValve.SystemTimestep(tFactor);
-		LMPIsolValve.SystemTimestep(tFactor);
-		OVHDCabinReliefDumpValve.SystemTimestep(tFactor);
-		FWDCabinReliefDumpValve.SystemTimestep(tFactor);
-		SuitCircuitReliefValve.SystemTimestep(tFactor);
-		SuitGasDiverter.SystemTimestep(tFactor);
-		CabinGasReturnValve.SystemTimestep(tFactor);
-		CO2CanisterSelect.SystemTimestep(tFactor);
-		PrimCO2CanisterVent.SystemTimestep(tFactor);
-		SecCO2CanisterVent.SystemTimestep(tFactor);
-		WaterSeparationSelector.SystemTimestep(tFactor);
-		WaterTankSelect.SystemTimestep(tFactor);
-		CabinFan.SystemTimestep(tFactor);
-		PrimGlycolPumpController.SystemTimestep(tFactor);
-		SuitFanDPSensor.SystemTimestep(tFactor);
-		DPSPropellant.SystemTimestep(tFactor);
-		DPS.SystemTimestep(tFactor);
-		deca.SystemTimestep(tFactor);
-		gasta.SystemTimestep(tFactor);
-		scera1.SystemTimestep(tFactor);
-		scera2.SystemTimestep(tFactor);
-		MissionTimerDisplay.SystemTimestep(tFactor);
-		EventTimerDisplay.SystemTimestep(tFactor);
-		CWEA.SystemTimestep(tFactor);
-		if (stage < 2)
-		{
-			ECA_1.SystemTimestep(tFactor);
-			ECA_2.SystemTimestep(tFactor);
-		}
-		ECA_3.SystemTimestep(tFactor);
-		ECA_4.SystemTimestep(tFactor);
-		tle.SystemTimestep(tFactor);
-		DockLights.SystemTimestep(tFactor);
-		lca.SystemTimestep(tFactor);
-		UtilLights.SystemTimestep(tFactor);
-		COASLights.SystemTimestep(tFactor);
-		FloodLights.SystemTimestep(tFactor);
-		INV_1.SystemTimestep(tFactor);
-		INV_2.SystemTimestep(tFactor);
-
-		simdt -= tFactor;
-		tFactor = __min(mintFactor, simdt);
-	}
+	PROFILESCOPE("LEM::SystemsInternalTimestep");
+
+	systemsGraph.Timestep(simdt, __max(simdt / 20.0, 0.02));
 }
 
 void LEM::SystemsTimestep(double simt, double simdt)
 
 {
+	PROFILESCOPE("LEM::SystemsTimestep");
 
 	// Clear debug line when timer runs out
 	if(DebugLineClearTimer > 0){
@@ -1465,15 +1489,25 @@ void LEM::SystemsTimestep(double simt, double simdt)
 		}
 	}
 
-	SystemsInternalTimestep(simdt);
+	// With the systems thread option this is done by the systems worker after clbkPostStep
+	if (!isSystemsThread)
+	{
+		systemsStepper.Wait();
+		Panelsdk.UpdateEnvironment();
+		SystemsInternalTimestep(simdt);
+	}
+
+	//Sounds of the internal systems, the Orbiter API is only used on the main thread
+	CabinFan.Timestep(simdt);
 
 	// After that come all other systems simesteps
+	// The IMU queues its CDU and PIPA counts for this frame, it must run before the AGC picks them up
+	imu.Timestep(simdt);								// Do work
 	agc.Timestep(MissionTime, simdt);						// Do work
 	dsky.Timestep(MissionTime);								// Do work
 	asa.Timestep(simdt);									// Do work
 	aea.Timestep(MissionTime, simdt);
 	deda.Timestep(simdt);
-	imu.Timestep(simdt);								// Do work
 	tcdu.Timestep(simdt);
 	scdu.Timestep(simdt);
 	// Manage IMU standby heater and temperature
@@ -2217,6 +2251,8 @@ double LEM::GetRCSQuadTempF(int index)
 void LEM::GetECSStatus(LEMECSStatus &ecs)
 
 {
+	systemsStepper.Wait();
+
 	// Crew
 
 	if (CDREVA_IP)
@@ -2257,6 +2293,8 @@ void LEM::GetECSStatus(LEMECSStatus &ecs)
 
 void LEM::SetCrewNumber(int number)
 {
+	systemsStepper.Wait();
+
 	int crewsuited = CDRSuited->number + LMPSuited->number;
 
 	if (number + crewsuited + (CDREVA_IP ? 1 : 0) <= 3)
@@ -2267,6 +2305,8 @@ void LEM::SetCrewNumber(int number)
 
 void LEM::SetCDRInSuit()
 {
+	systemsStepper.Wait();
+
 	if (!CDREVA_IP)
 	{
 
@@ -2296,6 +2336,8 @@ void LEM::SetCDRInSuit()
 
 void LEM::SetLMPInSuit()
 {
+	systemsStepper.Wait();
+
 	if (LMPinPLSS == 2) {
 		LMPSuited->number = 1;
 		LMPinPLSS = 0;
@@ -2655,6 +2697,21 @@ void LEM_LR::Timestep(double simdt){
 		//Assumption: Moon is flat
 		range = alt / cos_ang / 0.3048;
 
+		if (gravref == LunarTerrain::Get().GetPlanet() && range > 0 && range < 50000.0)
+		{
+			//Within the range limit, use the mean slant range to the terrain within the range beam, in the rotating Moon frame.
+			//The terrain under the beam is filled in over a few frames, until then the flat estimate is kept.
+			MATRIX3 M_moon;
+			double terrainrange;
+
+			oapiGetRotationMatrix(gravref, &M_moon);
+			terrainrange = LunarTerrain::Get().BeamRange(tmul(M_moon, pos), tmul(M_moon, unit(lrvec_glob)), 3.0*RAD, 6, LUNARTERRAIN_FRAME_FILL);
+			if (terrainrange != LUNARTERRAIN_NODATA)
+			{
+				range = terrainrange / 0.3048;
+			}
+		}
+
 		//Doesn't point at the moon
 		if (range < 0)
 		{
@@ -619,6 +619,8 @@ void LEM::SetView() {
 
 bool LEM::clbkLoadVC (int id)
 {
+	systemsStepper.Wait();
+
 	// Set VC view to last saved position
 	if (FirstTimestep || !InVC) {
 		id = viewpos;
@@ -1312,6 +1314,8 @@ void LEM::RegisterActiveAreas()
 
 bool LEM::clbkVCMouseEvent(int id, int event, VECTOR3 &p)
 {
+	systemsStepper.Wait();
+
 	switch (id) {
 		case AID_VC_LEM_MA_LEFT:
 		case AID_VC_LEM_MA_RIGHT:
@@ -1340,6 +1344,8 @@ bool LEM::clbkVCMouseEvent(int id, int event, VECTOR3 &p)
 
 bool LEM::clbkVCRedrawEvent(int id, int event, SURFHANDLE surf)
 {
+	systemsStepper.Wait();
+
 	switch (id) {
 
 	case AID_VC_LM_CWS_LEFT:
@@ -477,7 +477,7 @@ void LEM_AEA::Timestep(double simt, double simdt) {
 	powered = DeterminePowerState();
 	if (!IsPowered()) return;
 
-	int Delta, CycleCount = 0;
+	int Delta, Limit, CycleCount = 0;
 
 	int AsaPulses[6];
 
@@ -489,7 +489,12 @@ void LEM_AEA::Timestep(double simt, double simdt) {
 
 	while (CycleCount < cycles)
 	{
-		Delta = aea_engine(&vags);
+		//Run up to the next ASA pulse or the end of the timestep. A waiting downlink word is loaded after the next instruction.
+		Limit = (int)(cycles - CycleCount);
+		if (1024 - ASACycleCounter < Limit) Limit = 1024 - ASACycleCounter;
+		if (((vags.InputPorts[IO_2020] & 0200000) != 0) && (ags_queue.size() > 0)) Limit = 1;
+
+		Delta = aea_engine_run(&vags, Limit);
 		CycleCount += Delta;
 		ASACycleCounter += Delta;
 
@@ -230,6 +230,9 @@ public:
 
 	void SetOprErr(bool val)		{ OprErrLight = val; };
 	void ClearOprErr()		{ OprErrLight = false; };
+
+	char *GetAdr() { return Adr; };
+	char *GetData() { return Data; };
 	//
 	// Timestep to run programs.
 	//
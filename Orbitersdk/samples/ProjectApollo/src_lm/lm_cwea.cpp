@@ -920,6 +920,17 @@ void LEM_CWEA::SetLightStates(int state)
 	}
 }
 
+int LEM_CWEA::GetLightRow(int row)
+{
+	int bits = 0;
+
+	for (int j = 0;j < 8;j++)
+	{
+		if (LightStatus[row][j] == 1) bits |= 1 << j;
+	}
+	return bits;
+}
+
 double LEM_CWEA::GetCWBank1Lights()	
 {
 	int counter = 0;
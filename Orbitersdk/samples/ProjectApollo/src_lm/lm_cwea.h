@@ -48,6 +48,8 @@ public:
 	double GetCWBank4Lights();
 	double GetNumberLightsOn();
 	double GetNonDimmableLoad();
+	//Lit lights of one row, bit n for column n
+	int GetLightRow(int row);
 	double GetDimmableLoad();
 
 	//For SCEA
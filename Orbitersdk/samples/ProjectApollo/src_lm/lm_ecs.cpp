@@ -1107,6 +1107,7 @@ LEMCabinFan::LEMCabinFan(FadeInOutSound &cabinfanS) : cabinfansound(cabinfanS)
 	pressRegulatorBSwitch = NULL;
 	cabinFan = NULL;
 	cabinFanHeat = 0;
+	fanOn = false;
 }
 
 void LEMCabinFan::Init(CircuitBrakerSwitch *cf1cb, CircuitBrakerSwitch *cfccb, RotationalSwitch *pras, RotationalSwitch *prbs, Pump *cf, h_HeatLoad *cfh)
@@ -1136,12 +1137,12 @@ void LEMCabinFan::SystemTimestep(double simdt)
 	if (cabinFan1CB->IsPowered() && !cabinFanSwitch)
 	{
 		cabinFan->SetPumpOn();
-		CabinFanSound();
+		fanOn = true;
 	}
 	else
 	{
 		cabinFan->SetPumpOff();
-		StopCabinFanSound();
+		fanOn = false;
 	}
 
 	if (cabinFan->pumping) {
@@ -1149,6 +1150,18 @@ void LEMCabinFan::SystemTimestep(double simdt)
 	}
 }
 
+void LEMCabinFan::Timestep(double simdt)
+{
+	if (fanOn)
+	{
+		CabinFanSound();
+	}
+	else
+	{
+		StopCabinFanSound();
+	}
+}
+
 void LEMCabinFan::CabinFanSound()
 {
 	cabinfansound.play(200);
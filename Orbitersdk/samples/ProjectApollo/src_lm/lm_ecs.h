@@ -292,11 +292,15 @@ public:
 	LEMCabinFan(FadeInOutSound &cabinfanS);
 	void Init(CircuitBrakerSwitch *cf1cb, CircuitBrakerSwitch *cfccb, RotationalSwitch *pras, RotationalSwitch *prbs, Pump *cf, h_HeatLoad *cfh);
 	void SystemTimestep(double simdt);
+	void Timestep(double simdt);
 protected:
 
 	void CabinFanSound();
 	void StopCabinFanSound();
 
+	//Fan running at the last SystemTimestep, the sound follows it in Timestep
+	bool fanOn;
+
 	CircuitBrakerSwitch *cabinFan1CB;
 	CircuitBrakerSwitch *cabinFanContCB;
 	RotationalSwitch *pressRegulatorASwitch;
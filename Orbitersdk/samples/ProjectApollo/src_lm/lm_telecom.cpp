@@ -473,6 +473,7 @@ void LM_PCM::SystemTimestep(double simdt)
 
 void LM_PCM::Timestep(double simt)
 {
+	PROFILESCOPE("LM_PCM::Timestep");
 	// This stuff has to happen every timestep, regardless of system status.
 	if(wsk_error != 0){
 		sprintf(oapiDebugString(),"%s",wsk_emsg);
@@ -503,6 +504,7 @@ void LM_PCM::Timestep(double simt)
 					generate_stream_lbr();
 					tx_offset++;
 				}
+				lem->tlmbus.AddPCM(tx_data, tx_size);
 				perform_io(simt);
 			}
 		}
@@ -518,6 +520,7 @@ void LM_PCM::Timestep(double simt)
 					generate_stream_hbr();
 					tx_offset++;
 				}			
+				lem->tlmbus.AddPCM(tx_data, tx_size);
 				perform_io(simt);
 			}
 		}
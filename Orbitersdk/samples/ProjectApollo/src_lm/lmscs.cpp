@@ -46,7 +46,7 @@
 LEM_RGA::LEM_RGA()
 {
 	powered = false;
-	dc_source = false;
+	dc_source = NULL;
 	rates = _V(0, 0, 0);
 }
 
@@ -177,6 +177,8 @@ void ATCA::Init(LEM *vessel, h_HeatLoad *hl){
 	lem = vessel;
 	ATCAHeat = hl;
 	int x = 0; while (x < 16) { pgns_jet_request[x] = false; ags_jet_request[x] = false; jet_driver[x] = false; jet_request[x] = 0; jet_last_request[x] = 0; jet_start[x] = 0; jet_stop[x] = 0; x++; }
+	x = 0; while (x < 16) { pgns_jet_on_time[x] = -1.0; pgns_jet_off_time[x] = -1.0; pgns_jet_pulse[x] = false; x++; }
+	pgns_window_start = 0.0;
 }
 
 double ATCA::GetPrimPowerVoltage() {
@@ -905,7 +907,7 @@ void ATCA::Timestep(double simt, double simdt) {
 	// *** JET DRIVER ***
 	for (x = 0;x < 16;x++)
 	{
-		if ((hasPrimPower && pgns_jet_request[x]) || (hasAbortPower && ags_jet_request[x]))
+		if ((hasPrimPower && (pgns_jet_request[x] || pgns_jet_pulse[x])) || (hasAbortPower && ags_jet_request[x]))
 		{
 			jet_driver[x] = true;
 		}
@@ -1012,20 +1014,41 @@ void ATCA::Timestep(double simt, double simdt) {
 	//char Buffer[128];
 
 	// *** THRUSTER MAINTENANCE ***
+	// Jets only fired by the LGC start and stop at the LGC clock time of the channel 5/6 commands,
+	// replayed over this timestep. The LGC often fires jets for less than a timestep.
+	double lgctime = lem->agc.GetCycleTime();
+	bool lgctimed = hasPrimPower && lgctime > pgns_window_start;
 	x = 0;
 	while (x < 16) {
 		double power = 0;
+		bool timed = lgctimed && !(hasAbortPower && ags_jet_request[x]);
 		// Process jet request list to generate start and stop times.
 		if (jet_request[x] == 1 && jet_last_request[x] == 0) {
 			// New fire request
 			jet_start[x] = simt;
 			jet_stop[x] = 0;
+			if (timed && pgns_jet_on_time[x] >= pgns_window_start) {
+				jet_start[x] = PGNSJetTime(pgns_jet_on_time[x], simt, simdt);
+			}
+			if (timed && pgns_jet_pulse[x]) {
+				// Fired and stopped since the last timestep
+				jet_stop[x] = PGNSJetTime(pgns_jet_off_time[x], simt, simdt);
+				//Minimum impulse
+				if (jet_stop[x] < jet_start[x] + 0.013)
+				{
+					jet_stop[x] = jet_start[x] + 0.013;
+				}
+				jet_request[x] = 0;
+			}
 			//sprintf_s(Buffer, "Start %lf %d", jet_start[x], x);
 			//oapiWriteLog(Buffer);
 		}
 		else if (jet_request[x] == 0 && jet_last_request[x] == 1) {
 			// New stop request
 			jet_stop[x] = simt;
+			if (timed && pgns_jet_off_time[x] >= pgns_window_start) {
+				jet_stop[x] = PGNSJetTime(pgns_jet_off_time[x], simt, simdt);
+			}
 			//Minimum impulse
 			if (jet_stop[x] < jet_start[x] + 0.013)
 			{
@@ -1036,7 +1059,7 @@ void ATCA::Timestep(double simt, double simdt) {
 		}
 		jet_last_request[x] = jet_request[x]; // Keep track of changes
 
-		if (jet_start[x] == 0 && jet_stop[x] == 0) { lem->SetRCSJet(x, false); x++; continue; } // Done
+		if (jet_start[x] == 0 && jet_stop[x] == 0) { lem->SetRCSJet(x, false); pgns_jet_pulse[x] = false; x++; continue; } // Done
 		// sprintf(oapiDebugString(),"Jet %d fire %f stop %f",x,jet_start[x],jet_stop[x]); 
 
 		//Calculate power level. If the function returns true reset everything to zero
@@ -1052,8 +1075,41 @@ void ATCA::Timestep(double simt, double simdt) {
 		}*/
 
 		lem->SetRCSJetLevelPrimary(x, power);
+		pgns_jet_pulse[x] = false;
 		x++;
 	}
+	pgns_window_start = lgctime;
+}
+
+double ATCA::PGNSJetTime(double cycletime, double simt, double simdt)
+{
+	//Maps a LGC clock time since the last timestep into this timestep
+	double dt = cycletime - pgns_window_start;
+	if (dt < 0.0) dt = 0.0;
+	if (dt > simdt) dt = simdt;
+	return simt + dt;
+}
+
+void ATCA::SetPGNSJet(int x, bool on, double cycletime)
+{
+	if (cycletime < pgns_window_start)
+	{
+		//LGC restart, the clock starts again at zero
+		pgns_window_start = 0.0;
+	}
+	if (on && !pgns_jet_request[x])
+	{
+		pgns_jet_on_time[x] = cycletime;
+	}
+	else if (!on && pgns_jet_request[x])
+	{
+		pgns_jet_off_time[x] = cycletime;
+		if (pgns_jet_on_time[x] >= pgns_window_start)
+		{
+			pgns_jet_pulse[x] = true;
+		}
+	}
+	pgns_jet_request[x] = on;
 }
 
 bool ATCA::CalculateThrustLevel(double simt, double t_start, double t_stop, double simdt, double &power)
@@ -1170,33 +1226,33 @@ void ATCA::SystemTimestep(double simdt)
 }
 
 // Process thruster commands from LGC
-void ATCA::ProcessLGC(int ch, int val){		
+void ATCA::ProcessLGC(int ch, int val, double cycletime){
 	if(!hasPrimPower){ val = 0; } // If not in primary mode, force jets off (so jets will switch off at programmed times)
 	// When in primary, thruster commands are passed from LGC to jets.
 	switch(ch){
 		case 05:
 			LMChannelValue5 ch5;
 			ch5.Value = val;			
-			if(ch5.Bits.B4U != 0){ pgns_jet_request[12] = 1; }else{ pgns_jet_request[12] = 0; }
-			if(ch5.Bits.A4D != 0){ pgns_jet_request[15] = 1; }else{ pgns_jet_request[15] = 0; }
-			if(ch5.Bits.A3U != 0){ pgns_jet_request[8]  = 1; }else{ pgns_jet_request[8]  = 0; }
-			if(ch5.Bits.B3D != 0){ pgns_jet_request[11] = 1; }else{ pgns_jet_request[11] = 0; }
-			if(ch5.Bits.B2U != 0){ pgns_jet_request[4]  = 1; }else{ pgns_jet_request[4]  = 0; }
-			if(ch5.Bits.A2D != 0){ pgns_jet_request[7]  = 1; }else{ pgns_jet_request[7]  = 0; }
-			if(ch5.Bits.A1U != 0){ pgns_jet_request[0]  = 1; }else{ pgns_jet_request[0]  = 0; }
-			if(ch5.Bits.B1D != 0){ pgns_jet_request[3]  = 1; }else{ pgns_jet_request[3]  = 0; }
+			SetPGNSJet(12, ch5.Bits.B4U != 0, cycletime);
+			SetPGNSJet(15, ch5.Bits.A4D != 0, cycletime);
+			SetPGNSJet(8,  ch5.Bits.A3U != 0, cycletime);
+			SetPGNSJet(11, ch5.Bits.B3D != 0, cycletime);
+			SetPGNSJet(4,  ch5.Bits.B2U != 0, cycletime);
+			SetPGNSJet(7,  ch5.Bits.A2D != 0, cycletime);
+			SetPGNSJet(0,  ch5.Bits.A1U != 0, cycletime);
+			SetPGNSJet(3,  ch5.Bits.B1D != 0, cycletime);
 			break;
 		case 06:
 			LMChannelValue6 ch6;
 			ch6.Value = val;
-			if(ch6.Bits.B3A != 0){ pgns_jet_request[10] = 1; }else{ pgns_jet_request[10] = 0; }
-			if(ch6.Bits.B4F != 0){ pgns_jet_request[13] = 1; }else{ pgns_jet_request[13] = 0; }
-			if(ch6.Bits.A1F != 0){ pgns_jet_request[1]  = 1; }else{ pgns_jet_request[1]  = 0; }
-			if(ch6.Bits.A2A != 0){ pgns_jet_request[6]  = 1; }else{ pgns_jet_request[6]  = 0; }
-			if(ch6.Bits.B2L != 0){ pgns_jet_request[5]  = 1; }else{ pgns_jet_request[5]  = 0; }
-			if(ch6.Bits.A3R != 0){ pgns_jet_request[9]  = 1; }else{ pgns_jet_request[9]  = 0; }
-			if(ch6.Bits.A4R != 0){ pgns_jet_request[14] = 1; }else{ pgns_jet_request[14] = 0; }
-			if(ch6.Bits.B1L != 0){ pgns_jet_request[2]  = 1; }else{ pgns_jet_request[2]  = 0; }
+			SetPGNSJet(10, ch6.Bits.B3A != 0, cycletime);
+			SetPGNSJet(13, ch6.Bits.B4F != 0, cycletime);
+			SetPGNSJet(1,  ch6.Bits.A1F != 0, cycletime);
+			SetPGNSJet(6,  ch6.Bits.A2A != 0, cycletime);
+			SetPGNSJet(5,  ch6.Bits.B2L != 0, cycletime);
+			SetPGNSJet(9,  ch6.Bits.A3R != 0, cycletime);
+			SetPGNSJet(14, ch6.Bits.A4R != 0, cycletime);
+			SetPGNSJet(2,  ch6.Bits.B1L != 0, cycletime);
 			break;
 		default:
 			sprintf(oapiDebugString(),"ATCA::ProcessLGC: Bad channel %o",ch);
@@ -67,7 +67,7 @@ public:
 	double GetMinus6VDCSupplyVoltage();
 	void Timestep(double simt, double simdt);			// Timestep
 	void SystemTimestep(double simdt);
-	void ProcessLGC(int ch, int val);   // To process LGC commands
+	void ProcessLGC(int ch, int val, double cycletime);   // To process LGC commands, timed with the LGC clock
 
 	void SaveState(FILEHANDLE scn);
 	void LoadState(FILEHANDLE scn);
@@ -94,8 +94,14 @@ public:
 	int jet_request[16];				// Jet request list
 	int jet_last_request[16];			// Jet request list at last timestep
 	double jet_start[16],jet_stop[16];  // RCS jet start/stop times
+	double pgns_jet_on_time[16], pgns_jet_off_time[16];	// LGC clock time of the last jet commands
+	bool pgns_jet_pulse[16];			// Jet commanded on and off by the LGC since the last timestep
+	double pgns_window_start;			// LGC clock time at the last timestep
 protected:
 
+	void SetPGNSJet(int x, bool on, double cycletime);
+	double PGNSJetTime(double cycletime, double simt, double simdt);
+
 	double PRMOnTime(double X);
 	double PRMOffTime(double X);
 	bool PRMTimestep(int n, double simdt, double t_on, double t_off);
@@ -55,6 +55,9 @@
 		2017-10-11 MAS	Changed a "1" to "1LL" in LLS mask calculations.
 				This fixes overflow being incorrectly set for
 				certain cases of LLS.
+		2026-10-19	Added aea_engine_run, which executes
+				instructions until the next event of the
+				caller.  Count moved into ags_t.
   
   The scans of the original AGS/AEA technical documentation can be found
   at the website listed above.  Also at that site you can find the source code
@@ -109,7 +112,7 @@ static const int InstructionTiming[32] = {
 // own weird and wacky version.
 //
 
-#if _MSC_VER > 1200
+#if !defined(_MSC_VER) || _MSC_VER > 1200
 static const int64_t CONST64_1 = ~0377777777777LL;
 static const int64_t CONST64_2 = 0177777777777LL;
 static const int64_t CONST64_3 = 1LL;
@@ -496,20 +499,12 @@ ShowAddressContentsAGS (ags_t *State)
 }
 
 //-----------------------------------------------------------------------------
-// Execute one instruction of the simulation.  Use aea_engine_init prior to 
-// the first call of aea_engine, to initialize State, and then call aea_engine 
-// thereafter in such a way as to keep the simulation more-or-less sync'd
-// with whatever you think of as real time.  State->CycleCounter keeps track
-// of the time elapsed, in units of 1/1.024 microseconds (i.e., 
-// 0.9765625 microseconds).
-//
-// Returns the number of "microseconds" used.
+// Execute one instruction.  The input channels are only fetched if 
+// ReadInputs is set.  Returns the number of "microseconds" used.
 
-int
-aea_engine (ags_t * State)
+static int
+ExecuteInstruction (ags_t * State, int ReadInputs)
 {
-  extern void UpdateAeaPeripheralConnect (void *, Client_t *);
-  static int Count = 0;
   int MicrosecondsThisInstruction, NewProgramCounter;
   int OpCode, IndexBit, AddressField, OriginalAddress;
   int i, j, k, ValueFromY, NewValueForY;
@@ -529,12 +524,13 @@ aea_engine (ags_t * State)
     {
       MicrosecondsThisInstruction = 10;
       State->CycleCounter += MicrosecondsThisInstruction;
-      Count += MicrosecondsThisInstruction;
+      State->Count += MicrosecondsThisInstruction;
       return (MicrosecondsThisInstruction);
     }
 
   // Get data from input channels into the input-channel buffer..
-  ChannelInputAGS (State);
+  if (ReadInputs)
+    ChannelInputAGS (State);
 
   //----------------------------------------------------------------------  
   // Okay, here's the stuff that actually has to do with decoding instructions.
@@ -1078,6 +1074,48 @@ aea_engine (ags_t * State)
             OriginalAddress, State->ProgramCounter);
   State->ProgramCounter = (NewProgramCounter & 07777);
   State->CycleCounter += MicrosecondsThisInstruction;
-  Count += MicrosecondsThisInstruction;
+  State->Count += MicrosecondsThisInstruction;
   return (MicrosecondsThisInstruction);
 }
+
+//-----------------------------------------------------------------------------
+// Execute one instruction of the simulation.  Use aea_engine_init prior to 
+// the first call of aea_engine, to initialize State, and then call aea_engine 
+// thereafter in such a way as to keep the simulation more-or-less sync'd
+// with whatever you think of as real time.  State->CycleCounter keeps track
+// of the time elapsed, in units of 1/1.024 microseconds (i.e., 
+// 0.9765625 microseconds).
+//
+// Returns the number of "microseconds" used.
+
+int
+aea_engine (ags_t * State)
+{
+  return (ExecuteInstruction (State, 1));
+}
+
+//-----------------------------------------------------------------------------
+// Execute instructions until at least MaxCycles "microseconds" are used, 
+// e.g. up to the next ASA pulse or the end of the time slice of the caller.
+// The input channels are fetched once, as the caller only changes them 
+// between calls.  The run also ends right after an instruction that changed 
+// the discretes in IO_2020 (the downlink telemetry stop discrete is set and 
+// reset by INP and OUT), so that the caller can react to it at the same 
+// instruction as with aea_engine.  At least one instruction is executed.
+//
+// Returns the number of "microseconds" used.
+
+int
+aea_engine_run (ags_t * State, int MaxCycles)
+{
+  int Used = 0, Discretes;
+
+  ChannelInputAGS (State);
+  do
+    {
+      Discretes = State->InputPorts[IO_2020];
+      Used += ExecuteInstruction (State, 0);
+    }
+  while (Used < MaxCycles && State->InputPorts[IO_2020] == Discretes);
+  return (Used);
+}
@@ -94,6 +94,8 @@ typedef struct
   // CPU-startup.  A 64-bit integer is used.
   uint64_t /* unsigned long long */ CycleCounter;
   uint64_t /* unsigned long long */ Next20msSignal;
+  // Clock cycles executed, counted per instance.
+  int Count;
   // All memory -- registers, RAM, and ROM -- is 18-bit.
   int32_t Memory[MEM_SIZE];
   // There are also "input/output channels".  Output channels are acted upon
@@ -124,6 +126,7 @@ extern clock_t RealTimeAGS, RealTimeOffsetAGS, LastRealTimeAGS, NextKeycheckAGS;
 // Function prototypes.
 
 int aea_engine (ags_t * State);
+int aea_engine_run (ags_t * State, int MaxCycles);
 int aea_engine_init (ags_t * State, const char *RomImage, const char *CoreDump);
 void MakeCoreDumpAGS (ags_t * State, const char *CoreDump);
 void ChannelOutputAGS (ags_t * State, int Type, int Data);
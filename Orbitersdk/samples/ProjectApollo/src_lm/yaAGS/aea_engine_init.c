@@ -105,6 +105,7 @@ aea_engine_init (ags_t * State, const char *RomImage, const char *CoreDump)
   // Set up the CPU state variables that aren't part of normal memory.
   RetVal = 0;
   State->CycleCounter = 0;
+  State->Count = 0;
   State->Next20msSignal = AEA_PER_SECOND / 50;
   i = State->Memory[06000];
   printf ("Address 06000 contains the value %06o, opcode ", i);
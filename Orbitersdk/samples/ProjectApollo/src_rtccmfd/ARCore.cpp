@@ -2,7 +2,7 @@
 
 #include "soundlib.h"
 #include "apolloguidance.h"
-#include "csmcomputer.h"
+#include "CSMcomputer.h"
 #include "IMU.h"
 #include "saturn.h"
 #include "saturnv.h"
@@ -14,6 +14,7 @@
 #include "mcc.h"
 #include "TLMCC.h"
 #include "rtcc.h"
+#include "profiler.h"
 
 static WSADATA wsaData;
 static SOCKET m_socket;
@@ -993,6 +994,11 @@ void ARCore::TLCCCalc()
 	startSubthread(14);
 }
 
+void ARCore::TLCCScan()
+{
+	startSubthread(50);
+}
+
 void ARCore::PDI_PAD()
 {
 	startSubthread(16);
@@ -2378,6 +2384,7 @@ void ARCore::TerrainModelCalc()
 
 
 	FILE *file = fopen("TerrainModel.txt", "w");
+	if (file == NULL) return;
 
 	fprintf(file, "%f;%f\n", -dist, 0.0);
 
@@ -2397,7 +2404,7 @@ void ARCore::TerrainModelCalc()
 		fprintf(file, "%f;%f\n", -dist, alt - TMAlt);
 	}
 
-	if (file) fclose(file);
+	fclose(file);
 }
 
 void ARCore::NodeConvCalc()
@@ -2464,6 +2471,7 @@ int ARCore::startSubthread(int fcn) {
 
 int ARCore::subThread()
 {
+	PROFILESCOPE("ARCore::subThread");
 	int Result = 0;
 
 	int mptveh, docked;
@@ -3321,6 +3329,7 @@ int ARCore::subThread()
 	}
 	break;
 	case 14: //MCC Targeting
+	case 50: //MCC Option Scan
 	{
 		EphemerisData sv0;
 		double CSMmass, LMmass;
@@ -3366,7 +3375,23 @@ int ARCore::subThread()
 			}
 		}
 
-		GC->rtcc->TranslunarMidcourseCorrectionProcessor(sv0, CSMmass, LMmass);
+		if (subThreadMode == 50)
+		{
+			//Landing site modes, at the planned midcourse and up to four hours later
+			std::vector<int> modes = { 2, 3, 4, 5 };
+			std::vector<double> GET_MCC;
+			TLMCCScanTable tab;
+
+			for (int i = 0;i <= 4;i++)
+			{
+				GET_MCC.push_back(GC->rtcc->PZMCCPLN.MidcourseGET + (double)i*3600.0);
+			}
+			GC->rtcc->TranslunarMidcourseCorrectionScan(sv0, CSMmass, LMmass, modes, GET_MCC, tab);
+		}
+		else
+		{
+			GC->rtcc->TranslunarMidcourseCorrectionProcessor(sv0, CSMmass, LMmass);
+		}
 
 		Result = 0;
 	}
@@ -4521,12 +4546,6 @@ int ARCore::subThread()
 		Result = 0;
 	}
 	break;
-	case 50: //Spare
-	{
-		Result = 0;
-	}
-	break;
-
 	case 51: //Moonrise/Moonset Display
 	{
 		Result = 0;
@@ -9,7 +9,7 @@
 #include "soundlib.h"
 #include "apolloguidance.h"
 #include "dsky.h"
-#include "csmcomputer.h"
+#include "CSMcomputer.h"
 #include "saturn.h"
 #include "mcc.h"
 #include "rtcc.h"
@@ -65,6 +65,7 @@ public:
 	void EntryCalc();
 	void DeorbitCalc();
 	void TLCCCalc();
+	void TLCCScan();
 	void EntryUpdateCalc();
 	void StateVectorCalc(int type);
 	void AGSStateVectorCalc();
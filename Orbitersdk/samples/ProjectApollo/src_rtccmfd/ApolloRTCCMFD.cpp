@@ -7339,6 +7339,12 @@ void ApolloRTCCMFD::menuTLCCCalc()
 	G->TLCCCalc();
 }
 
+void ApolloRTCCMFD::menuTLCCScan()
+{
+	G->TLCCSolGood = true;
+	G->TLCCScan();
+}
+
 void ApolloRTCCMFD::menuLunarLiftoffCalc()
 {
 	if (GC->MissionPlanningActive ||(G->target != NULL && (G->vesseltype == 2 || G->vesseltype == 3)))
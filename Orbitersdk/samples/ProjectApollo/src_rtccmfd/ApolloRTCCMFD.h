@@ -18,11 +18,12 @@
 #include "ARCore.h"
 #include "soundlib.h"
 #include "apolloguidance.h"
-#include "csmcomputer.h"
-#include "lemcomputer.h"
+#include "CSMcomputer.h"
+#include "LEMcomputer.h"
 #include "saturn.h"
 #include "saturnv.h"
 #include "LEM.h"
+#include "MFDPage.h"
 
 class ApolloRTCCMFD: public MFD2 {
 public:
@@ -31,6 +32,7 @@ public:
 	char *ButtonLabel (int bt);
 	int ButtonMenu (const MFDBUTTONMENU **menu) const;
 	bool Update (oapi::Sketchpad *skp);
+	void DrawPage();
 	bool ConsumeButton(int bt, int event);
 	bool ConsumeKeyBuffered(DWORD key);
 	void WriteStatus(FILEHANDLE scn) const;
@@ -400,6 +402,7 @@ public:
 	void menuTerrainModelCalc();
 	void set_TLand(double time);
 	void menuTLCCCalc();
+	void menuTLCCScan();
 	void menuNavCheckPADCalc();
 	void menuSetNavCheckGET();
 	void set_NavCheckGET(double time);
@@ -807,6 +810,8 @@ protected:
 	oapi::Font *font4;
 	oapi::Pen *pen;
 	oapi::Pen *pen2;
+	//Screen as drawn on the last refresh
+	MFDPage page;
 	Saturn *saturn;
 	LEM *lem;
 	int screen;
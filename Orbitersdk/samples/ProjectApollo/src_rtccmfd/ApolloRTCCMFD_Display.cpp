@@ -7,7 +7,18 @@ char Buffer[100];
 bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 {
 	Title(skp, "Apollo RTCC MFD");
-	skp->SetFont(font);
+
+	//Lines are only formatted again when their values changed since the last refresh
+	page.Begin(screen);
+	DrawPage();
+	page.Render(skp);
+	return true;
+}
+
+// Records the current screen to the page
+void ApolloRTCCMFD::DrawPage()
+{
+	page.SetFont(font);
 
 	// Draws the MFD title
 
@@ -15,63 +26,63 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 	// Use the device context (hDC) for Windows GDI paint functions.
 
 	//sprintf(Buffer, "%d", G->screen);
-	//skp->Text(7.5 * W / 8,(int)(0.5 * H / 14), Buffer, strlen(Buffer));
+	//page.Text(7.5 * W / 8,(int)(0.5 * H / 14), Buffer, strlen(Buffer));
 
 	if (screen == 0)
 	{
 		if (G->vesseltype < 2)
 		{
-			skp->Text(7 * W / 8, (int)(0.5 * H / 14), "CSM", 3);
+			page.Text(7 * W / 8, (int)(0.5 * H / 14), "CSM", 3);
 		}
 		else if (G->vesseltype < 4)
 		{
-			skp->Text(7 * W / 8, (int)(0.5 * H / 14), "LM", 2);
+			page.Text(7 * W / 8, (int)(0.5 * H / 14), "LM", 2);
 		}
 		else
 		{
-			skp->Text(7 * W / 8, (int)(0.5 * H / 14), "MCC", 3);
+			page.Text(7 * W / 8, (int)(0.5 * H / 14), "MCC", 3);
 		}
 
-		skp->Text(1 * W / 8, 2 * H / 14, "Maneuver Targeting", 18);
-		skp->Text(1 * W / 8, 4 * H / 14, "Pre-Advisory Data", 17);
-		skp->Text(1 * W / 8, 6 * H / 14, "Utility", 7);
-		skp->Text(1 * W / 8, 8 * H / 14, "MCC Displays", 12);
-		skp->Text(1 * W / 8, 10 * H / 14, "Mission Plan Table", 18);
-		skp->Text(1 * W / 8, 12 * H / 14, "Configuration", 13);
+		page.Text(1 * W / 8, 2 * H / 14, "Maneuver Targeting", 18);
+		page.Text(1 * W / 8, 4 * H / 14, "Pre-Advisory Data", 17);
+		page.Text(1 * W / 8, 6 * H / 14, "Utility", 7);
+		page.Text(1 * W / 8, 8 * H / 14, "MCC Displays", 12);
+		page.Text(1 * W / 8, 10 * H / 14, "Mission Plan Table", 18);
+		page.Text(1 * W / 8, 12 * H / 14, "Configuration", 13);
 
-		skp->Text(5 * W / 8, 2 * H / 14, "Uplinks", 7);
+		page.Text(5 * W / 8, 2 * H / 14, "Uplinks", 7);
 	}
 	else if (screen == 1)
 	{
-		skp->Text(6 * W / 8, (int)(0.5 * H / 14), "Two Impulse", 11);
+		page.Text(6 * W / 8, (int)(0.5 * H / 14), "Two Impulse", 11);
 
 		if (GC->rtcc->med_k30.IVFlag == 0)
 		{
-			skp->Text(1 * W / 8, 2 * H / 14, "Both Fixed", 10);
+			page.Text(1 * W / 8, 2 * H / 14, "Both Fixed", 10);
 		}
 		else if (GC->rtcc->med_k30.IVFlag == 1)
 		{
-			skp->Text(1 * W / 8, 2 * H / 14, "First Fixed", 11);
+			page.Text(1 * W / 8, 2 * H / 14, "First Fixed", 11);
 		}
 		else
 		{
-			skp->Text(1 * W / 8, 2 * H / 14, "Second Fixed", 12);
+			page.Text(1 * W / 8, 2 * H / 14, "Second Fixed", 12);
 		}
 
 		if (GC->MissionPlanningActive)
 		{
 			if (GC->rtcc->med_k30.Vehicle == 1)
 			{
-				skp->Text(1 * W / 8, 4 * H / 14, "Chaser: CSM", 11);
-				skp->Text(1 * W / 8, 5 * H / 14, "Target: LEM", 11);
+				page.Text(1 * W / 8, 4 * H / 14, "Chaser: CSM", 11);
+				page.Text(1 * W / 8, 5 * H / 14, "Target: LEM", 11);
 			}
 			else
 			{
-				skp->Text(1 * W / 8, 4 * H / 14, "Chaser: LEM", 11);
-				skp->Text(1 * W / 8, 5 * H / 14, "Target: CSM", 11);
+				page.Text(1 * W / 8, 4 * H / 14, "Chaser: LEM", 11);
+				page.Text(1 * W / 8, 5 * H / 14, "Target: CSM", 11);
 			}
 
-			skp->Text(1 * W / 8, 6 * H / 14, "CHA:", 4);
+			page.Text(1 * W / 8, 6 * H / 14, "CHA:", 4);
 			if (GC->rtcc->med_k30.ChaserVectorTime > 0)
 			{
 				GET_Display(Buffer, GC->rtcc->med_k30.ChaserVectorTime);
@@ -80,9 +91,9 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			{
 				sprintf_s(Buffer, "Present time");
 			}
-			skp->Text(2 * W / 8, 6 * H / 14, Buffer, strlen(Buffer));
+			page.Text(2 * W / 8, 6 * H / 14, Buffer, strlen(Buffer));
 
-			skp->Text(1 * W / 8, 8 * H / 14, "TGT:", 4);
+			page.Text(1 * W / 8, 8 * H / 14, "TGT:", 4);
 			if (GC->rtcc->med_k30.TargetVectorTime > 0)
 			{
 				GET_Display(Buffer, GC->rtcc->med_k30.TargetVectorTime);
@@ -91,7 +102,7 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			{
 				sprintf_s(Buffer, "Present time");
 			}
-			skp->Text(2 * W / 8, 8 * H / 14, Buffer, strlen(Buffer));
+			page.Text(2 * W / 8, 8 * H / 14, Buffer, strlen(Buffer));
 		}
 		else
 		{
@@ -103,7 +114,7 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			{
 				sprintf_s(Buffer, "No Target!");
 			}
-			skp->Text(1 * W / 8, 4 * H / 14, Buffer, strlen(Buffer));
+			page.Text(1 * W / 8, 4 * H / 14, Buffer, strlen(Buffer));
 		}
 
 		if (GC->rtcc->med_k30.StartTime >= 0)
@@ -114,7 +125,7 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 		{
 			sprintf(Buffer, "E = %.2f", GC->rtcc->GZGENCSN.TIElevationAngle*DEG);
 		}
-		skp->Text(1 * W / 8, 10 * H / 14, Buffer, strlen(Buffer));
+		page.Text(1 * W / 8, 10 * H / 14, Buffer, strlen(Buffer));
 
 		if (GC->rtcc->med_k30.EndTime >= 0)
 		{
@@ -124,140 +135,116 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 		{
 			sprintf(Buffer, "WT = %.2f", GC->rtcc->GZGENCSN.TITravelAngle*DEG);
 		}
-		skp->Text(1 * W / 8, 12 * H / 14, Buffer, strlen(Buffer));
-
-		skp->Text(9 * W / 16, 8 * H / 21, "PHASE", 5);
-		skp->Text(9 * W / 16, 9 * H / 21, "DEL H", 5);
-		skp->Text(9 * W / 16, 10 * H / 21, "ELEV", 4);
-		skp->Text(9 * W / 16, 11 * H / 21, "WT", 2);
-		sprintf(Buffer, "%.3f", GC->rtcc->GZGENCSN.TIPhaseAngle*DEG);
-		skp->Text(6 * W / 8, 8 * H / 21, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%.3f NM", GC->rtcc->GZGENCSN.TIDeltaH / 1852.0);
-		skp->Text(6 * W / 8, 9 * H / 21, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%.3f", GC->rtcc->GZGENCSN.TIElevationAngle*DEG);
-		skp->Text(6 * W / 8, 10 * H / 21, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%.3f", GC->rtcc->GZGENCSN.TITravelAngle*DEG);
-		skp->Text(6 * W / 8, 11 * H / 21, Buffer, strlen(Buffer));
+		page.Text(1 * W / 8, 12 * H / 14, Buffer, strlen(Buffer));
+
+		page.Text(9 * W / 16, 8 * H / 21, "PHASE", 5);
+		page.Text(9 * W / 16, 9 * H / 21, "DEL H", 5);
+		page.Text(9 * W / 16, 10 * H / 21, "ELEV", 4);
+		page.Text(9 * W / 16, 11 * H / 21, "WT", 2);
+		page.Printf(6 * W / 8, 8 * H / 21, "%.3f", GC->rtcc->GZGENCSN.TIPhaseAngle*DEG);
+		page.Printf(6 * W / 8, 9 * H / 21, "%.3f NM", GC->rtcc->GZGENCSN.TIDeltaH / 1852.0);
+		page.Printf(6 * W / 8, 10 * H / 21, "%.3f", GC->rtcc->GZGENCSN.TIElevationAngle*DEG);
+		page.Printf(6 * W / 8, 11 * H / 21, "%.3f", GC->rtcc->GZGENCSN.TITravelAngle*DEG);
 
 		if (GC->rtcc->med_k30.IVFlag != 0)
 		{
-			sprintf(Buffer, "%.0lf s", GC->rtcc->med_k30.TimeStep);
-			skp->Text(6 * W / 8, 2 * H / 14, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%.0lf s", GC->rtcc->med_k30.TimeRange);
-			skp->Text(6 * W / 8, 4 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(6 * W / 8, 2 * H / 14, "%.0lf s", GC->rtcc->med_k30.TimeStep);
+			page.Printf(6 * W / 8, 4 * H / 14, "%.0lf s", GC->rtcc->med_k30.TimeRange);
 		}
 	}
 	else if (screen == 2)
 	{
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
-		skp->Text(4 * W / 8, 2 * H / 32, "TWO IMPULSE MULTIPLE SOLUTION (MSK 0063)", 40);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
+		page.Text(4 * W / 8, 2 * H / 32, "TWO IMPULSE MULTIPLE SOLUTION (MSK 0063)", 40);
 
 		sprintf_s(Buffer, GC->rtcc->TwoImpMultDispBuffer.ErrorMessage.c_str());
-		skp->Text(32 * W / 64, 30 * H / 32, Buffer, strlen(Buffer));
-
-		skp->SetFont(font2);
-		skp->SetTextAlign(oapi::Sketchpad::RIGHT);
-		skp->Text(6 * W / 32, 4 * H / 32, "LM STA ID", 9);
-		skp->Text(6 * W / 32, 5 * H / 32, "LM GETTHS", 9);
-		skp->Text(6 * W / 32, 6 * H / 32, "MAN VEH", 7);
-		skp->Text(6 * W / 32, 7 * H / 32, "WT", 2);
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
-		sprintf_s(Buffer, "GET%s", GC->rtcc->TwoImpMultDispBuffer.GETFRZ.c_str());
-		skp->Text(1 * W / 32, 8 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "GMT%s", GC->rtcc->TwoImpMultDispBuffer.GMTFRZ.c_str());
-		skp->Text(1 * W / 32, 9 * H / 32, Buffer, strlen(Buffer));
-		skp->SetTextAlign(oapi::Sketchpad::RIGHT);
+		page.Text(32 * W / 64, 30 * H / 32, Buffer, strlen(Buffer));
+
+		page.SetFont(font2);
+		page.SetTextAlign(oapi::Sketchpad::RIGHT);
+		page.Text(6 * W / 32, 4 * H / 32, "LM STA ID", 9);
+		page.Text(6 * W / 32, 5 * H / 32, "LM GETTHS", 9);
+		page.Text(6 * W / 32, 6 * H / 32, "MAN VEH", 7);
+		page.Text(6 * W / 32, 7 * H / 32, "WT", 2);
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
+		page.Printf(1 * W / 32, 8 * H / 32, "GET%s", GC->rtcc->TwoImpMultDispBuffer.GETFRZ.c_str());
+		page.Printf(1 * W / 32, 9 * H / 32, "GMT%s", GC->rtcc->TwoImpMultDispBuffer.GMTFRZ.c_str());
+		page.SetTextAlign(oapi::Sketchpad::RIGHT);
 		sprintf_s(Buffer, GC->rtcc->TwoImpMultDispBuffer.MAN_VEH.c_str());
-		skp->Text(10 * W / 32, 6 * H / 32, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%.3lf", GC->rtcc->TwoImpMultDispBuffer.WT);
-		skp->Text(10 * W / 32, 7 * H / 32, Buffer, strlen(Buffer));
-		GET_Display3(Buffer, GC->rtcc->TwoImpMultDispBuffer.GET1);
-		skp->Text(10 * W / 32, 8 * H / 32, Buffer, strlen(Buffer));
-		GET_Display3(Buffer, GC->rtcc->TwoImpMultDispBuffer.GMT1);
-		skp->Text(10 * W / 32, 9 * H / 32, Buffer, strlen(Buffer));
-
-		skp->Text(24 * W / 32, 4 * H / 32, "CSM STA ID", 10);
-		skp->Text(24 * W / 32, 5 * H / 32, "CSM GETTHS", 10);
-		skp->Text(24 * W / 32, 6 * H / 32, "PHASE", 10);
-		skp->Text(24 * W / 32, 7 * H / 32, "DEL H", 5);
-		skp->Text(24 * W / 32, 8 * H / 32, "OPTION", 6);
-
-		sprintf(Buffer, "%.4lf", GC->rtcc->TwoImpMultDispBuffer.PHASE);
-		skp->Text(31 * W / 32, 6 * H / 32, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%.2lf", GC->rtcc->TwoImpMultDispBuffer.DH);
-		skp->Text(31 * W / 32, 7 * H / 32, Buffer, strlen(Buffer));
+		page.Text(10 * W / 32, 6 * H / 32, Buffer, strlen(Buffer));
+		page.Printf(10 * W / 32, 7 * H / 32, "%.3lf", GC->rtcc->TwoImpMultDispBuffer.WT);
+		page.Format(10 * W / 32, 8 * H / 32, this, &ApolloRTCCMFD::GET_Display3, GC->rtcc->TwoImpMultDispBuffer.GET1);
+		page.Format(10 * W / 32, 9 * H / 32, this, &ApolloRTCCMFD::GET_Display3, GC->rtcc->TwoImpMultDispBuffer.GMT1);
+
+		page.Text(24 * W / 32, 4 * H / 32, "CSM STA ID", 10);
+		page.Text(24 * W / 32, 5 * H / 32, "CSM GETTHS", 10);
+		page.Text(24 * W / 32, 6 * H / 32, "PHASE", 10);
+		page.Text(24 * W / 32, 7 * H / 32, "DEL H", 5);
+		page.Text(24 * W / 32, 8 * H / 32, "OPTION", 6);
+
+		page.Printf(31 * W / 32, 6 * H / 32, "%.4lf", GC->rtcc->TwoImpMultDispBuffer.PHASE);
+		page.Printf(31 * W / 32, 7 * H / 32, "%.2lf", GC->rtcc->TwoImpMultDispBuffer.DH);
 		sprintf_s(Buffer, GC->rtcc->TwoImpMultDispBuffer.OPTION.c_str());
-		skp->Text(31 * W / 32, 8 * H / 32, Buffer, strlen(Buffer));
-
-		skp->Text(5 * W / 32, 11 * H / 32, "DEL V1", 6);
-		skp->Text(8 * W / 32, 11 * H / 32, "YAW", 3);
-		skp->Text(23 * W / 64, 11 * H / 32, "PITCH", 5);
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
-		sprintf_s(Buffer, "GET%s", GC->rtcc->TwoImpMultDispBuffer.GETVAR.c_str());
-		skp->Text(27 * W / 64, 11 * H / 32, Buffer, strlen(Buffer));
-		skp->SetTextAlign(oapi::Sketchpad::RIGHT);
-		skp->Text(43 * W / 64, 11 * H / 32, "DEL V2", 6);
+		page.Text(31 * W / 32, 8 * H / 32, Buffer, strlen(Buffer));
+
+		page.Text(5 * W / 32, 11 * H / 32, "DEL V1", 6);
+		page.Text(8 * W / 32, 11 * H / 32, "YAW", 3);
+		page.Text(23 * W / 64, 11 * H / 32, "PITCH", 5);
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
+		page.Printf(27 * W / 64, 11 * H / 32, "GET%s", GC->rtcc->TwoImpMultDispBuffer.GETVAR.c_str());
+		page.SetTextAlign(oapi::Sketchpad::RIGHT);
+		page.Text(43 * W / 64, 11 * H / 32, "DEL V2", 6);
 		if (GC->rtcc->TwoImpMultDispBuffer.showTPI)
 		{
-			skp->Text(52 * W / 64, 11 * H / 32, "TTPI", 4);
+			page.Text(52 * W / 64, 11 * H / 32, "TTPI", 4);
 		}
 		else
 		{
-			skp->Text(49 * W / 64, 11 * H / 32, "YAW", 3);
-			skp->Text(28 * W / 32, 11 * H / 32, "PITCH", 5);
+			page.Text(49 * W / 64, 11 * H / 32, "YAW", 3);
+			page.Text(28 * W / 32, 11 * H / 32, "PITCH", 5);
 		}
 		
-		skp->Text(60 * W / 64, 11 * H / 32, "L", 1);
-		skp->Text(63 * W / 64, 11 * H / 32, "C", 1);
+		page.Text(60 * W / 64, 11 * H / 32, "L", 1);
+		page.Text(63 * W / 64, 11 * H / 32, "C", 1);
 		
 		for (int i = 0;i < GC->rtcc->TwoImpMultDispBuffer.Solutions;i++)
 		{
-			sprintf(Buffer, "%.2lf", GC->rtcc->TwoImpMultDispBuffer.data[i].DELV1);
-			skp->Text(5 * W / 32, (12 + i) * H / 32, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%.2lf", GC->rtcc->TwoImpMultDispBuffer.data[i].YAW1);
-			skp->Text(8 * W / 32, (12 + i) * H / 32, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%.2lf", GC->rtcc->TwoImpMultDispBuffer.data[i].PITCH1);
-			skp->Text(23 * W / 64, (12 + i) * H / 32, Buffer, strlen(Buffer));
-			GET_Display3(Buffer, GC->rtcc->TwoImpMultDispBuffer.data[i].Time2);
-			skp->Text(35 * W / 64, (12 + i) * H / 32, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%.2lf", GC->rtcc->TwoImpMultDispBuffer.data[i].DELV2);
-			skp->Text(43 * W / 64, (12 + i) * H / 32, Buffer, strlen(Buffer));
+			page.Printf(5 * W / 32, (12 + i) * H / 32, "%.2lf", GC->rtcc->TwoImpMultDispBuffer.data[i].DELV1);
+			page.Printf(8 * W / 32, (12 + i) * H / 32, "%.2lf", GC->rtcc->TwoImpMultDispBuffer.data[i].YAW1);
+			page.Printf(23 * W / 64, (12 + i) * H / 32, "%.2lf", GC->rtcc->TwoImpMultDispBuffer.data[i].PITCH1);
+			page.Format(35 * W / 64, (12 + i) * H / 32, this, &ApolloRTCCMFD::GET_Display3, GC->rtcc->TwoImpMultDispBuffer.data[i].Time2);
+			page.Printf(43 * W / 64, (12 + i) * H / 32, "%.2lf", GC->rtcc->TwoImpMultDispBuffer.data[i].DELV2);
 			if (GC->rtcc->TwoImpMultDispBuffer.showTPI)
 			{
-				GET_Display(Buffer, GC->rtcc->TwoImpMultDispBuffer.data[i].T_TPI, false);
-				skp->Text(55 * W / 64, (12 + i) * H / 32, Buffer, strlen(Buffer));
+				page.Format(55 * W / 64, (12 + i) * H / 32, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->TwoImpMultDispBuffer.data[i].T_TPI, false);
 			}
 			else
 			{
-				sprintf(Buffer, "%.2lf", GC->rtcc->TwoImpMultDispBuffer.data[i].YAW2);
-				skp->Text(50 * W / 64, (12 + i) * H / 32, Buffer, strlen(Buffer));
-				sprintf(Buffer, "%.2lf", GC->rtcc->TwoImpMultDispBuffer.data[i].PITCH2);
-				skp->Text(57 * W / 64, (12 + i) * H / 32, Buffer, strlen(Buffer));
+				page.Printf(50 * W / 64, (12 + i) * H / 32, "%.2lf", GC->rtcc->TwoImpMultDispBuffer.data[i].YAW2);
+				page.Printf(57 * W / 64, (12 + i) * H / 32, "%.2lf", GC->rtcc->TwoImpMultDispBuffer.data[i].PITCH2);
 			}
 			
-			sprintf(Buffer, "%c", GC->rtcc->TwoImpMultDispBuffer.data[i].L);
-			skp->Text(60 * W / 64, (12 + i) * H / 32, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%d", GC->rtcc->TwoImpMultDispBuffer.data[i].C);
-			skp->Text(63 * W / 64, (12 + i) * H / 32, Buffer, strlen(Buffer));
+			page.Printf(60 * W / 64, (12 + i) * H / 32, "%c", GC->rtcc->TwoImpMultDispBuffer.data[i].L);
+			page.Printf(63 * W / 64, (12 + i) * H / 32, "%d", GC->rtcc->TwoImpMultDispBuffer.data[i].C);
 		}
 	}
 	else if (screen == 3)
 	{
-		skp->Text(6 * W / 8, (int)(0.5 * H / 14), "Coelliptic", 10);
+		page.Text(6 * W / 8, (int)(0.5 * H / 14), "Coelliptic", 10);
 
-		skp->Text(1 * W / 16, 2 * H / 14, "SPQ Initialization", 18);
+		page.Text(1 * W / 16, 2 * H / 14, "SPQ Initialization", 18);
 
 		if (GC->MissionPlanningActive)
 		{
 			if (GC->rtcc->med_k01.ChaserVehicle == 1)
 			{
-				skp->Text(1 * W / 16, 4 * H / 14, "Chaser: CSM", 11);
-				skp->Text(1 * W / 16, 5 * H / 14, "Target: LEM", 11);
+				page.Text(1 * W / 16, 4 * H / 14, "Chaser: CSM", 11);
+				page.Text(1 * W / 16, 5 * H / 14, "Target: LEM", 11);
 			}
 			else
 			{
-				skp->Text(1 * W / 16, 4 * H / 14, "Chaser: LEM", 11);
-				skp->Text(1 * W / 16, 5 * H / 14, "Target: CSM", 11);
+				page.Text(1 * W / 16, 4 * H / 14, "Chaser: LEM", 11);
+				page.Text(1 * W / 16, 5 * H / 14, "Target: CSM", 11);
 			}
 
 			if (GC->rtcc->med_k01.ChaserThresholdGET < 0)
@@ -268,7 +255,7 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			{
 				GET_Display(Buffer, GC->rtcc->med_k01.ChaserThresholdGET);
 			}
-			skp->Text(1 * W / 16, 6 * H / 14, Buffer, strlen(Buffer));
+			page.Text(1 * W / 16, 6 * H / 14, Buffer, strlen(Buffer));
 			if (GC->rtcc->med_k01.TargetThresholdGET < 0)
 			{
 				sprintf_s(Buffer, "Present Time");
@@ -277,12 +264,11 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			{
 				GET_Display(Buffer, GC->rtcc->med_k01.TargetThresholdGET);
 			}
-			skp->Text(1 * W / 16, 8 * H / 14, Buffer, strlen(Buffer));
+			page.Text(1 * W / 16, 8 * H / 14, Buffer, strlen(Buffer));
 		}
 		else
 		{
-			sprintf_s(Buffer, "Chaser: %s", G->vessel->GetName());
-			skp->Text(1 * W / 16, 4 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(1 * W / 16, 4 * H / 14, "Chaser: %s", G->vessel->GetName());
 			if (G->target)
 			{
 				sprintf_s(Buffer, "Target: %s", G->target->GetName());
@@ -291,116 +277,105 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			{
 				sprintf_s(Buffer, "Target: Not set!");
 			}
-			skp->Text(1 * W / 16, 5 * H / 14, Buffer, strlen(Buffer));
+			page.Text(1 * W / 16, 5 * H / 14, Buffer, strlen(Buffer));
 		}
 
 		if (G->SPQMode != 1)
 		{
 			if (G->SPQMode == 2)
 			{
-				skp->Text(1 * W / 16, 10 * H / 14, "Optimum CSI", 11);
+				page.Text(1 * W / 16, 10 * H / 14, "Optimum CSI", 11);
 			}
 			else
 			{
-				skp->Text(1 * W / 16, 10 * H / 14, "CSI", 3);
+				page.Text(1 * W / 16, 10 * H / 14, "CSI", 3);
 
 				if (G->CDHtimemode == 0)
 				{
-					skp->Text(1 * W / 16, 12 * H / 14, "Fixed TPI time", 14);
+					page.Text(1 * W / 16, 12 * H / 14, "Fixed TPI time", 14);
 				}
 				else if (G->CDHtimemode == 1)
 				{
-					skp->Text(1 * W / 16, 12 * H / 14, "Fixed DH", 8);
+					page.Text(1 * W / 16, 12 * H / 14, "Fixed DH", 8);
 				}
 			}
 
-			GET_Display(Buffer, G->CSItime);
-			skp->Text(10 * W / 16, 2 * H / 14, Buffer, strlen(Buffer));
+			page.Format(10 * W / 16, 2 * H / 14, this, &ApolloRTCCMFD::GET_Display, G->CSItime, true);
 		}
 		else
 		{
-			skp->Text(1 * W / 16, 10 * H / 14, "CDH", 3);
+			page.Text(1 * W / 16, 10 * H / 14, "CDH", 3);
 
 			if (G->CDHtimemode == 0)
 			{
-				skp->Text(1 * W / 16, 12 * H / 14, "Fixed", 5);
+				page.Text(1 * W / 16, 12 * H / 14, "Fixed", 5);
 			}
 			else if (G->CDHtimemode == 1)
 			{
-				skp->Text(1 * W / 16, 12 * H / 14, "Find GETI", 9);
+				page.Text(1 * W / 16, 12 * H / 14, "Find GETI", 9);
 			}
 
-			GET_Display(Buffer, G->CDHtime);
-			skp->Text(10 * W / 16, 2 * H / 14, Buffer, strlen(Buffer));
+			page.Format(10 * W / 16, 2 * H / 14, this, &ApolloRTCCMFD::GET_Display, G->CDHtime, true);
 		}
 
-		GET_Display(Buffer, G->SPQTIG);
-		skp->Text(5 * W / 8, 15 * H / 21, Buffer, strlen(Buffer));
+		page.Format(5 * W / 8, 15 * H / 21, this, &ApolloRTCCMFD::GET_Display, G->SPQTIG, true);
 
-		skp->Text(5 * W / 8, 16 * H / 21, "DX", 2);
-		skp->Text(5 * W / 8, 17 * H / 21, "DY", 2);
-		skp->Text(5 * W / 8, 18 * H / 21, "DZ", 2);
+		page.Text(5 * W / 8, 16 * H / 21, "DX", 2);
+		page.Text(5 * W / 8, 17 * H / 21, "DY", 2);
+		page.Text(5 * W / 8, 18 * H / 21, "DZ", 2);
 
-		AGC_Display(Buffer, G->SPQDeltaV.x / 0.3048);
-		skp->Text(6 * W / 8, 16 * H / 21, Buffer, strlen(Buffer));
-		AGC_Display(Buffer, G->SPQDeltaV.y / 0.3048);
-		skp->Text(6 * W / 8, 17 * H / 21, Buffer, strlen(Buffer));
-		AGC_Display(Buffer, G->SPQDeltaV.z / 0.3048);
-		skp->Text(6 * W / 8, 18 * H / 21, Buffer, strlen(Buffer));
+		page.Format(6 * W / 8, 16 * H / 21, this, &ApolloRTCCMFD::AGC_Display, G->SPQDeltaV.x / 0.3048);
+		page.Format(6 * W / 8, 17 * H / 21, this, &ApolloRTCCMFD::AGC_Display, G->SPQDeltaV.y / 0.3048);
+		page.Format(6 * W / 8, 18 * H / 21, this, &ApolloRTCCMFD::AGC_Display, G->SPQDeltaV.z / 0.3048);
 	}
 	else if (screen == 4)
 	{
-		skp->Text(4 * W / 8, (int)(0.5 * H / 14), "General Purpose Maneuver", 24);
+		page.Text(4 * W / 8, (int)(0.5 * H / 14), "General Purpose Maneuver", 24);
 
-		skp->Text(1 * W / 22, (marker + 3) * H / 22, "*", 1);
+		page.Text(1 * W / 22, (marker + 3) * H / 22, "*", 1);
 
-		skp->Text(2 * W / 22, 2 * H / 22, "Code:", 5);
-		GMPManeuverCodeName(Buffer, G->GMPManeuverCode);
-		skp->Text(5 * W / 22, 2 * H / 22, Buffer, strlen(Buffer));
+		page.Text(2 * W / 22, 2 * H / 22, "Code:", 5);
+		page.Format(5 * W / 22, 2 * H / 22, this, &ApolloRTCCMFD::GMPManeuverCodeName, G->GMPManeuverCode);
 
 		if (GC->MissionPlanningActive)
 		{
-			skp->Text(2 * W / 22, 3 * H / 22, "VEH", 3);
+			page.Text(2 * W / 22, 3 * H / 22, "VEH", 3);
 			if (GC->rtcc->med_k20.Vehicle == RTCC_MPT_CSM)
 			{
-				skp->Text(5 * W / 22, 3 * H / 22, "CSM", 3);
+				page.Text(5 * W / 22, 3 * H / 22, "CSM", 3);
 			}
 			else
 			{
-				skp->Text(5 * W / 22, 3 * H / 22, "LM", 2);
+				page.Text(5 * W / 22, 3 * H / 22, "LM", 2);
 			}
 		}
 
-		skp->Text(2 * W / 22, 4 * H / 22, "TYP", 3);
-		GMPManeuverTypeName(Buffer, G->GMPManeuverType);
-		skp->Text(4 * W / 22, 4 * H / 22, Buffer, strlen(Buffer));
+		page.Text(2 * W / 22, 4 * H / 22, "TYP", 3);
+		page.Format(4 * W / 22, 4 * H / 22, this, &ApolloRTCCMFD::GMPManeuverTypeName, G->GMPManeuverType);
 
-		skp->Text(2 * W / 22, 5 * H / 22, "PNT", 3);
-		GMPManeuverPointName(Buffer, G->GMPManeuverPoint);
-		skp->Text(4 * W / 22, 5 * H / 22, Buffer, strlen(Buffer));
+		page.Text(2 * W / 22, 5 * H / 22, "PNT", 3);
+		page.Format(4 * W / 22, 5 * H / 22, this, &ApolloRTCCMFD::GMPManeuverPointName, G->GMPManeuverPoint);
 
-		skp->Text(2 * W / 22, 6 * H / 22, "GET", 3);
-		GET_Display(Buffer, G->SPSGET, false);
-		skp->Text(4 * W / 22, 6 * H / 22, Buffer, strlen(Buffer));
+		page.Text(2 * W / 22, 6 * H / 22, "GET", 3);
+		page.Format(4 * W / 22, 6 * H / 22, this, &ApolloRTCCMFD::GET_Display, G->SPSGET, false);
 
-		skp->Text(2 * W / 22, 7 * H / 22, "REF", 3);
+		page.Text(2 * W / 22, 7 * H / 22, "REF", 3);
 
 		if (G->OrbAdjAltRef == 0)
 		{
-			skp->Text(4 * W / 22, 7 * H / 22, "Mean rad", 8);
+			page.Text(4 * W / 22, 7 * H / 22, "Mean rad", 8);
 		}
 		else
 		{
-			skp->Text(4 * W / 22, 7 * H / 22, "Pad/LS", 6);
+			page.Text(4 * W / 22, 7 * H / 22, "Pad/LS", 6);
 		}
 
 		//Desired Maneuver Height
 		if (G->GMPManeuverCode == RTCC_GMP_CRH || G->GMPManeuverCode == RTCC_GMP_HBH || G->GMPManeuverCode == RTCC_GMP_FCH || G->GMPManeuverCode == RTCC_GMP_CPH ||
 			G->GMPManeuverCode == RTCC_GMP_CNH || G->GMPManeuverCode == RTCC_GMP_PCH || G->GMPManeuverCode == RTCC_GMP_NSH || G->GMPManeuverCode == RTCC_GMP_HOH)
 		{
-			skp->Text(2 * W / 22, 8 * H / 22, "ALT", 3);
-			sprintf(Buffer, "%.2f NM", G->GMPManeuverHeight / 1852.0);
-			skp->Text(4 * W / 22, 8 * H / 22, Buffer, strlen(Buffer));
+			page.Text(2 * W / 22, 8 * H / 22, "ALT", 3);
+			page.Printf(4 * W / 22, 8 * H / 22, "%.2f NM", G->GMPManeuverHeight / 1852.0);
 		}
 		//Desired Maneuver Longitude
 		else if (G->GMPManeuverCode == RTCC_GMP_PCL || G->GMPManeuverCode == RTCC_GMP_CRL || G->GMPManeuverCode == RTCC_GMP_HOL || G->GMPManeuverCode == RTCC_GMP_NSL ||
@@ -408,9 +383,8 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			G->GMPManeuverCode == RTCC_GMP_CPL || G->GMPManeuverCode == RTCC_GMP_HBL || G->GMPManeuverCode == RTCC_GMP_CNL || G->GMPManeuverCode == RTCC_GMP_HNL ||
 			G->GMPManeuverCode == RTCC_GMP_SAA || G->GMPManeuverCode == RTCC_GMP_HAS)
 		{
-			skp->Text(2 * W / 22, 8 * H / 22, "LNG", 3);
-			sprintf(Buffer, "%.2f", G->GMPManeuverLongitude*DEG);
-			skp->Text(4 * W / 22, 8 * H / 22, Buffer, strlen(Buffer));
+			page.Text(2 * W / 22, 8 * H / 22, "LNG", 3);
+			page.Printf(4 * W / 22, 8 * H / 22, "%.2f", G->GMPManeuverLongitude*DEG);
 		}
 
 		//Height Change
@@ -418,32 +392,28 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			G->GMPManeuverCode == RTCC_GMP_HNL || G->GMPManeuverCode == RTCC_GMP_HNT || G->GMPManeuverCode == RTCC_GMP_HNA || G->GMPManeuverCode == RTCC_GMP_HNP ||
 			G->GMPManeuverCode == RTCC_GMP_PHL || G->GMPManeuverCode == RTCC_GMP_PHT || G->GMPManeuverCode == RTCC_GMP_PHA || G->GMPManeuverCode == RTCC_GMP_PHP)
 		{
-			skp->Text(2 * W / 22, 9 * H / 22, "DH", 2);
-			sprintf(Buffer, "%.2f NM", G->GMPHeightChange / 1852.0);
-			skp->Text(4 * W / 22, 9 * H / 22, Buffer, strlen(Buffer));
+			page.Text(2 * W / 22, 9 * H / 22, "DH", 2);
+			page.Printf(4 * W / 22, 9 * H / 22, "%.2f NM", G->GMPHeightChange / 1852.0);
 		}
 		//Apoapsis Height
 		else if (G->GMPManeuverCode == RTCC_GMP_HBT || G->GMPManeuverCode == RTCC_GMP_HBH || G->GMPManeuverCode == RTCC_GMP_HBO || G->GMPManeuverCode == RTCC_GMP_HBL ||
 			G->GMPManeuverCode == RTCC_GMP_NHT || G->GMPManeuverCode == RTCC_GMP_NHL || G->GMPManeuverCode == RTCC_GMP_HAS)
 		{
-			skp->Text(2 * W / 22, 9 * H / 22, "ApA", 3);
-			sprintf(Buffer, "%.2f NM", G->GMPApogeeHeight / 1852.0);
-			skp->Text(4 * W / 22, 9 * H / 22, Buffer, strlen(Buffer));
+			page.Text(2 * W / 22, 9 * H / 22, "ApA", 3);
+			page.Printf(4 * W / 22, 9 * H / 22, "%.2f NM", G->GMPApogeeHeight / 1852.0);
 		}
 		//Delta V
 		else if (G->GMPManeuverCode == RTCC_GMP_FCT || G->GMPManeuverCode == RTCC_GMP_FCA || G->GMPManeuverCode == RTCC_GMP_FCP || G->GMPManeuverCode == RTCC_GMP_FCE ||
 			G->GMPManeuverCode == RTCC_GMP_FCL || G->GMPManeuverCode == RTCC_GMP_FCH)
 		{
-			skp->Text(2 * W / 22, 9 * H / 22, "DV", 2);
-			sprintf(Buffer, "%.2f ft/s", G->GMPDeltaVInput / 0.3048);
-			skp->Text(4 * W / 22, 9 * H / 22, Buffer, strlen(Buffer));
+			page.Text(2 * W / 22, 9 * H / 22, "DV", 2);
+			page.Printf(4 * W / 22, 9 * H / 22, "%.2f ft/s", G->GMPDeltaVInput / 0.3048);
 		}
 		//Apse line rotation
 		else if (G->GMPManeuverCode == RTCC_GMP_SAT || G->GMPManeuverCode == RTCC_GMP_SAO || G->GMPManeuverCode == RTCC_GMP_SAL)
 		{
-			skp->Text(2 * W / 22, 9 * H / 22, "ROT", 4);
-			sprintf(Buffer, "%.2f", G->GMPApseLineRotAngle*DEG);
-			skp->Text(4 * W / 22, 9 * H / 22, Buffer, strlen(Buffer));
+			page.Text(2 * W / 22, 9 * H / 22, "ROT", 4);
+			page.Printf(4 * W / 22, 9 * H / 22, "%.2f", G->GMPApseLineRotAngle*DEG);
 		}
 
 		//Wedge Angle
@@ -452,253 +422,206 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			G->GMPManeuverCode == RTCC_GMP_CPH || G->GMPManeuverCode == RTCC_GMP_CPT || G->GMPManeuverCode == RTCC_GMP_CPA || G->GMPManeuverCode == RTCC_GMP_CPP ||
 			G->GMPManeuverCode == RTCC_GMP_PCH)
 		{
-			skp->Text(2 * W / 22, 10 * H / 22, "DW", 2);
-			sprintf(Buffer, "%.2f", G->GMPWedgeAngle*DEG);
-			skp->Text(4 * W / 22, 10 * H / 22, Buffer, strlen(Buffer));
+			page.Text(2 * W / 22, 10 * H / 22, "DW", 2);
+			page.Printf(4 * W / 22, 10 * H / 22, "%.2f", G->GMPWedgeAngle*DEG);
 		}
 		//Node Shift
 		else if (G->GMPManeuverCode == RTCC_GMP_NST || G->GMPManeuverCode == RTCC_GMP_NSO || G->GMPManeuverCode == RTCC_GMP_NSH || G->GMPManeuverCode == RTCC_GMP_NSL ||
 			G->GMPManeuverCode == RTCC_GMP_CNL || G->GMPManeuverCode == RTCC_GMP_CNH || G->GMPManeuverCode == RTCC_GMP_CNT ||
 			G->GMPManeuverCode == RTCC_GMP_CNA || G->GMPManeuverCode == RTCC_GMP_CNP)
 		{
-			skp->Text(2 * W / 22, 10 * H / 22, "DLN", 3);
-			sprintf(Buffer, "%.2f", G->GMPNodeShiftAngle*DEG);
-			skp->Text(4 * W / 22, 10 * H / 22, Buffer, strlen(Buffer));
+			page.Text(2 * W / 22, 10 * H / 22, "DLN", 3);
+			page.Printf(4 * W / 22, 10 * H / 22, "%.2f", G->GMPNodeShiftAngle*DEG);
 		}
 		//Periapsis Height
 		else if (G->GMPManeuverCode == RTCC_GMP_HBT || G->GMPManeuverCode == RTCC_GMP_HBH || G->GMPManeuverCode == RTCC_GMP_HBO || G->GMPManeuverCode == RTCC_GMP_HBL ||
 			G->GMPManeuverCode == RTCC_GMP_NHT || G->GMPManeuverCode == RTCC_GMP_NHL || G->GMPManeuverCode == RTCC_GMP_HAS)
 		{
-			skp->Text(2 * W / 22, 10 * H / 22, "PeA", 3);
-			sprintf(Buffer, "%.2f NM", G->GMPPerigeeHeight / 1852.0);
-			skp->Text(4 * W / 22, 10 * H / 22, Buffer, strlen(Buffer));
+			page.Text(2 * W / 22, 10 * H / 22, "PeA", 3);
+			page.Printf(4 * W / 22, 10 * H / 22, "%.2f NM", G->GMPPerigeeHeight / 1852.0);
 		}
 		//Pitch
 		else if (G->GMPManeuverCode == RTCC_GMP_FCT || G->GMPManeuverCode == RTCC_GMP_FCA || G->GMPManeuverCode == RTCC_GMP_FCP || G->GMPManeuverCode == RTCC_GMP_FCE ||
 			G->GMPManeuverCode == RTCC_GMP_FCL || G->GMPManeuverCode == RTCC_GMP_FCH)
 		{
-			skp->Text(2 * W / 22, 10 * H / 22, "P", 1);
-			sprintf(Buffer, "%.2f", G->GMPPitch*DEG);
-			skp->Text(4 * W / 22, 10 * H / 22, Buffer, strlen(Buffer));
+			page.Text(2 * W / 22, 10 * H / 22, "P", 1);
+			page.Printf(4 * W / 22, 10 * H / 22, "%.2f", G->GMPPitch*DEG);
 		}
 
 		//Yaw
 		if (G->GMPManeuverCode == RTCC_GMP_FCT || G->GMPManeuverCode == RTCC_GMP_FCA || G->GMPManeuverCode == RTCC_GMP_FCP || G->GMPManeuverCode == RTCC_GMP_FCE ||
 			G->GMPManeuverCode == RTCC_GMP_FCL || G->GMPManeuverCode == RTCC_GMP_FCH)
 		{
-			skp->Text(2 * W / 22, 11 * H / 22, "Y", 1);
-			sprintf(Buffer, "%.2f", G->GMPYaw*DEG);
-			skp->Text(4 * W / 22, 11 * H / 22, Buffer, strlen(Buffer));
+			page.Text(2 * W / 22, 11 * H / 22, "Y", 1);
+			page.Printf(4 * W / 22, 11 * H / 22, "%.2f", G->GMPYaw*DEG);
 		}
 		//Node Shift
 		else if (G->GMPManeuverCode == RTCC_GMP_NHT || G->GMPManeuverCode == RTCC_GMP_NHL)
 		{
-			skp->Text(2 * W / 22, 11 * H / 22, "DLN", 3);
-			sprintf(Buffer, "%.2f", G->GMPNodeShiftAngle*DEG);
-			skp->Text(4 * W / 22, 11 * H / 22, Buffer, strlen(Buffer));
+			page.Text(2 * W / 22, 11 * H / 22, "DLN", 3);
+			page.Printf(4 * W / 22, 11 * H / 22, "%.2f", G->GMPNodeShiftAngle*DEG);
 		}
 		//Rev counter
 		else if (G->GMPManeuverCode == RTCC_GMP_HAS)
 		{
-			skp->Text(2 * W / 22, 11 * H / 22, "N", 1);
-			sprintf(Buffer, "%d", G->GMPRevs);
-			skp->Text(4 * W / 22, 11 * H / 22, Buffer, strlen(Buffer));
+			page.Text(2 * W / 22, 11 * H / 22, "N", 1);
+			page.Printf(4 * W / 22, 11 * H / 22, "%d", G->GMPRevs);
 		}
 
-		/*skp->Text(12 * W / 22, 6 * H / 22, "Number:", 7);
+		/*page.Text(12 * W / 22, 6 * H / 22, "Number:", 7);
 		sprintf(Buffer, "%d", G->GMPManeuverCode);
-		skp->Text(16 * W / 22, 6 * H / 22, Buffer, strlen(Buffer));*/
-
-		skp->SetTextAlign(oapi::Sketchpad::RIGHT);
-
-		skp->Text(4 * W / 22, 13 * H / 22, "GET A", 5);
-		skp->Text(4 * W / 22, 14 * H / 22, "HA", 2);
-		skp->Text(4 * W / 22, 15 * H / 22, "LONG A", 6);
-		skp->Text(4 * W / 22, 16 * H / 22, "LAT A", 5);
-		skp->Text(4 * W / 22, 17 * H / 22, "GET P", 5);
-		skp->Text(4 * W / 22, 18 * H / 22, "HP", 2);
-		skp->Text(4 * W / 22, 19 * H / 22, "LONG P", 6);
-		skp->Text(4 * W / 22, 20 * H / 22, "LAT P", 5);
-
-		GET_Display(Buffer, G->GMPResults.GET_A, false);
-		skp->Text(10 * W / 22, 13 * H / 22, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%.2f", G->GMPResults.HA / 1852.0);
-		skp->Text(10 * W / 22, 14 * H / 22, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%.2f", G->GMPResults.long_A*DEG);
-		skp->Text(10 * W / 22, 15 * H / 22, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%.2f", G->GMPResults.lat_A*DEG);
-		skp->Text(10 * W / 22, 16 * H / 22, Buffer, strlen(Buffer));
-		GET_Display(Buffer, G->GMPResults.GET_P, false);
-		skp->Text(10 * W / 22, 17 * H / 22, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%.2f", G->GMPResults.HP / 1852.0);
-		skp->Text(10 * W / 22, 18 * H / 22, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%.2f", G->GMPResults.long_P*DEG);
-		skp->Text(10 * W / 22, 19 * H / 22, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%.2f", G->GMPResults.lat_P*DEG);
-		skp->Text(10 * W / 22, 20 * H / 22, Buffer, strlen(Buffer));
-
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
-
-		skp->Text(12 * W / 22, 6 * H / 22, "Orbital Parameters:", 19);
-		skp->Text(12 * W / 22, 7 * H / 22, "A", 1);
-		skp->Text(12 * W / 22, 8 * H / 22, "E", 1);
-		skp->Text(12 * W / 22, 9 * H / 22, "I", 1);
-		skp->Text(12 * W / 22, 10 * H / 22, "NODE AN", 7);
-		skp->Text(12 * W / 22, 11 * H / 22, "DEL G", 5);
-		skp->Text(12 * W / 22, 12 * H / 22, "H MAN", 5);
-		skp->Text(12 * W / 22, 13 * H / 22, "LONG MAN", 8);
-		skp->Text(12 * W / 22, 14 * H / 22, "LAT MAN", 7);
-
-		skp->SetTextAlign(oapi::Sketchpad::RIGHT);
-
-		sprintf(Buffer, "%.1f", G->GMPResults.A / 1852.0);
-		skp->Text(20 * W / 22, 7 * H / 22, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%.6f", G->GMPResults.E);
-		skp->Text(20 * W / 22, 8 * H / 22, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%.3f", G->GMPResults.I*DEG);
-		skp->Text(20 * W / 22, 9 * H / 22, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%.1f", G->GMPResults.Node_Ang*DEG);
-		skp->Text(20 * W / 22, 10 * H / 22, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%.2f", G->GMPResults.Del_G*DEG);
-		skp->Text(20 * W / 22, 11 * H / 22, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%.1f", G->GMPResults.H_Man / 1852.0);
-		skp->Text(20 * W / 22, 12 * H / 22, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%.2f", G->GMPResults.long_Man*DEG);
-		skp->Text(20 * W / 22, 13 * H / 22, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%.2f", G->GMPResults.lat_Man*DEG);
-		skp->Text(20 * W / 22, 14 * H / 22, Buffer, strlen(Buffer));
-
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
-
-		GET_Display(Buffer, G->GPM_TIG);
-		skp->Text(5 * W / 8, 16 * H / 22, Buffer, strlen(Buffer));
-
-		skp->Text(5 * W / 8, 17 * H / 22, "DVX", 3);
-		skp->Text(5 * W / 8, 18 * H / 22, "DVY", 3);
-		skp->Text(5 * W / 8, 19 * H / 22, "DVZ", 3);
-		skp->Text(5 * W / 8, 20 * H / 22, "DVT", 3);
-		AGC_Display(Buffer, G->OrbAdjDVX.x / 0.3048);
-		skp->Text(6 * W / 8, 17 * H / 22, Buffer, strlen(Buffer));
-		AGC_Display(Buffer, G->OrbAdjDVX.y / 0.3048);
-		skp->Text(6 * W / 8, 18 * H / 22, Buffer, strlen(Buffer));
-		AGC_Display(Buffer, G->OrbAdjDVX.z / 0.3048);
-		skp->Text(6 * W / 8, 19 * H / 22, Buffer, strlen(Buffer));
-		AGC_Display(Buffer, length(G->OrbAdjDVX) / 0.3048);
-		skp->Text(6 * W / 8, 20 * H / 22, Buffer, strlen(Buffer));
+		page.Text(16 * W / 22, 6 * H / 22, Buffer, strlen(Buffer));*/
+
+		page.SetTextAlign(oapi::Sketchpad::RIGHT);
+
+		page.Text(4 * W / 22, 13 * H / 22, "GET A", 5);
+		page.Text(4 * W / 22, 14 * H / 22, "HA", 2);
+		page.Text(4 * W / 22, 15 * H / 22, "LONG A", 6);
+		page.Text(4 * W / 22, 16 * H / 22, "LAT A", 5);
+		page.Text(4 * W / 22, 17 * H / 22, "GET P", 5);
+		page.Text(4 * W / 22, 18 * H / 22, "HP", 2);
+		page.Text(4 * W / 22, 19 * H / 22, "LONG P", 6);
+		page.Text(4 * W / 22, 20 * H / 22, "LAT P", 5);
+
+		page.Format(10 * W / 22, 13 * H / 22, this, &ApolloRTCCMFD::GET_Display, G->GMPResults.GET_A, false);
+		page.Printf(10 * W / 22, 14 * H / 22, "%.2f", G->GMPResults.HA / 1852.0);
+		page.Printf(10 * W / 22, 15 * H / 22, "%.2f", G->GMPResults.long_A*DEG);
+		page.Printf(10 * W / 22, 16 * H / 22, "%.2f", G->GMPResults.lat_A*DEG);
+		page.Format(10 * W / 22, 17 * H / 22, this, &ApolloRTCCMFD::GET_Display, G->GMPResults.GET_P, false);
+		page.Printf(10 * W / 22, 18 * H / 22, "%.2f", G->GMPResults.HP / 1852.0);
+		page.Printf(10 * W / 22, 19 * H / 22, "%.2f", G->GMPResults.long_P*DEG);
+		page.Printf(10 * W / 22, 20 * H / 22, "%.2f", G->GMPResults.lat_P*DEG);
+
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
+
+		page.Text(12 * W / 22, 6 * H / 22, "Orbital Parameters:", 19);
+		page.Text(12 * W / 22, 7 * H / 22, "A", 1);
+		page.Text(12 * W / 22, 8 * H / 22, "E", 1);
+		page.Text(12 * W / 22, 9 * H / 22, "I", 1);
+		page.Text(12 * W / 22, 10 * H / 22, "NODE AN", 7);
+		page.Text(12 * W / 22, 11 * H / 22, "DEL G", 5);
+		page.Text(12 * W / 22, 12 * H / 22, "H MAN", 5);
+		page.Text(12 * W / 22, 13 * H / 22, "LONG MAN", 8);
+		page.Text(12 * W / 22, 14 * H / 22, "LAT MAN", 7);
+
+		page.SetTextAlign(oapi::Sketchpad::RIGHT);
+
+		page.Printf(20 * W / 22, 7 * H / 22, "%.1f", G->GMPResults.A / 1852.0);
+		page.Printf(20 * W / 22, 8 * H / 22, "%.6f", G->GMPResults.E);
+		page.Printf(20 * W / 22, 9 * H / 22, "%.3f", G->GMPResults.I*DEG);
+		page.Printf(20 * W / 22, 10 * H / 22, "%.1f", G->GMPResults.Node_Ang*DEG);
+		page.Printf(20 * W / 22, 11 * H / 22, "%.2f", G->GMPResults.Del_G*DEG);
+		page.Printf(20 * W / 22, 12 * H / 22, "%.1f", G->GMPResults.H_Man / 1852.0);
+		page.Printf(20 * W / 22, 13 * H / 22, "%.2f", G->GMPResults.long_Man*DEG);
+		page.Printf(20 * W / 22, 14 * H / 22, "%.2f", G->GMPResults.lat_Man*DEG);
+
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
+
+		page.Format(5 * W / 8, 16 * H / 22, this, &ApolloRTCCMFD::GET_Display, G->GPM_TIG, true);
+
+		page.Text(5 * W / 8, 17 * H / 22, "DVX", 3);
+		page.Text(5 * W / 8, 18 * H / 22, "DVY", 3);
+		page.Text(5 * W / 8, 19 * H / 22, "DVZ", 3);
+		page.Text(5 * W / 8, 20 * H / 22, "DVT", 3);
+		page.Format(6 * W / 8, 17 * H / 22, this, &ApolloRTCCMFD::AGC_Display, G->OrbAdjDVX.x / 0.3048);
+		page.Format(6 * W / 8, 18 * H / 22, this, &ApolloRTCCMFD::AGC_Display, G->OrbAdjDVX.y / 0.3048);
+		page.Format(6 * W / 8, 19 * H / 22, this, &ApolloRTCCMFD::AGC_Display, G->OrbAdjDVX.z / 0.3048);
+		page.Format(6 * W / 8, 20 * H / 22, this, &ApolloRTCCMFD::AGC_Display, length(G->OrbAdjDVX) / 0.3048);
 	}
 	else if (screen == 5)
 	{
-		skp->Text(6 * W / 8, (int)(0.5 * H / 14), "REFSMMAT", 8);
+		page.Text(6 * W / 8, (int)(0.5 * H / 14), "REFSMMAT", 8);
 
 		if (G->REFSMMATopt == 0) //P30 Maneuver
 		{
 			if (G->REFSMMATHeadsUp)
 			{
-				skp->Text(5 * W / 8, 2 * H / 14, "P30 (Heads up)", 14);
+				page.Text(5 * W / 8, 2 * H / 14, "P30 (Heads up)", 14);
 			}
 			else
 			{
-				skp->Text(5 * W / 8, 2 * H / 14, "P30 (Heads down)", 16);
+				page.Text(5 * W / 8, 2 * H / 14, "P30 (Heads down)", 16);
 			}
 
-			GET_Display(Buffer, G->P30TIG);
-			skp->Text((int)(0.5 * W / 8), 2 * H / 14, Buffer, strlen(Buffer));
+			page.Format((int)(0.5 * W / 8), 2 * H / 14, this, &ApolloRTCCMFD::GET_Display, G->P30TIG, true);
 
-			skp->Text(6 * W / 8, 4 * H / 14, "DV Vector", 9);
-			AGC_Display(Buffer, G->dV_LVLH.x / 0.3048);
-			skp->Text(6 * W / 8, 5 * H / 14, Buffer, strlen(Buffer));
-			AGC_Display(Buffer, G->dV_LVLH.y / 0.3048);
-			skp->Text(6 * W / 8, 6 * H / 14, Buffer, strlen(Buffer));
-			AGC_Display(Buffer, G->dV_LVLH.z / 0.3048);
-			skp->Text(6 * W / 8, 7 * H / 14, Buffer, strlen(Buffer));
+			page.Text(6 * W / 8, 4 * H / 14, "DV Vector", 9);
+			page.Format(6 * W / 8, 5 * H / 14, this, &ApolloRTCCMFD::AGC_Display, G->dV_LVLH.x / 0.3048);
+			page.Format(6 * W / 8, 6 * H / 14, this, &ApolloRTCCMFD::AGC_Display, G->dV_LVLH.y / 0.3048);
+			page.Format(6 * W / 8, 7 * H / 14, this, &ApolloRTCCMFD::AGC_Display, G->dV_LVLH.z / 0.3048);
 		}
 		else if (G->REFSMMATopt == 1)//Retrofire
 		{
-			skp->Text(5 * W / 8, 2 * H / 14, "P30 Retro", 9);
+			page.Text(5 * W / 8, 2 * H / 14, "P30 Retro", 9);
 
-			GET_Display(Buffer, G->P30TIG);
-			skp->Text((int)(0.5 * W / 8), 2 * H / 14, Buffer, strlen(Buffer));
+			page.Format((int)(0.5 * W / 8), 2 * H / 14, this, &ApolloRTCCMFD::GET_Display, G->P30TIG, true);
 
-			skp->Text(6 * W / 8, 4 * H / 14, "DV Vector", 9);
-			AGC_Display(Buffer, G->dV_LVLH.x / 0.3048);
-			skp->Text(6 * W / 8, 5 * H / 14, Buffer, strlen(Buffer));
-			AGC_Display(Buffer, G->dV_LVLH.y / 0.3048);
-			skp->Text(6 * W / 8, 6 * H / 14, Buffer, strlen(Buffer));
-			AGC_Display(Buffer, G->dV_LVLH.z / 0.3048);
-			skp->Text(6 * W / 8, 7 * H / 14, Buffer, strlen(Buffer));
+			page.Text(6 * W / 8, 4 * H / 14, "DV Vector", 9);
+			page.Format(6 * W / 8, 5 * H / 14, this, &ApolloRTCCMFD::AGC_Display, G->dV_LVLH.x / 0.3048);
+			page.Format(6 * W / 8, 6 * H / 14, this, &ApolloRTCCMFD::AGC_Display, G->dV_LVLH.y / 0.3048);
+			page.Format(6 * W / 8, 7 * H / 14, this, &ApolloRTCCMFD::AGC_Display, G->dV_LVLH.z / 0.3048);
 
 		}
 		else if (G->REFSMMATopt == 2)
 		{
-			skp->Text(5 * W / 8, 2 * H / 14, "LVLH", 4);
+			page.Text(5 * W / 8, 2 * H / 14, "LVLH", 4);
 
-			GET_Display(Buffer, G->REFSMMATTime);
-			skp->Text((int)(0.5 * W / 8), 2 * H / 14, Buffer, strlen(Buffer));
+			page.Format((int)(0.5 * W / 8), 2 * H / 14, this, &ApolloRTCCMFD::GET_Display, G->REFSMMATTime, true);
 		}
 		else if (G->REFSMMATopt == 3)
 		{
-			skp->Text(5 * W / 8, 2 * H / 14, "Lunar Entry", 11);
+			page.Text(5 * W / 8, 2 * H / 14, "Lunar Entry", 11);
 		}
 		else if (G->REFSMMATopt == 4)
 		{
-			skp->Text(5 * W / 8, 2 * H / 14, "Launch", 6);
+			page.Text(5 * W / 8, 2 * H / 14, "Launch", 6);
 
 			if (GC->mission == 0)
 			{
-				skp->Text((int)(0.5 * W / 8), 2 * H / 14, "Manual", 6);
+				page.Text((int)(0.5 * W / 8), 2 * H / 14, "Manual", 6);
 			}
 			else if (GC->mission >= 7)
 			{
-				sprintf(Buffer, "Apollo %i", GC->mission);
-				skp->Text((int)(0.5 * W / 8), 2 * H / 14, Buffer, strlen(Buffer));
+				page.Printf((int)(0.5 * W / 8), 2 * H / 14, "Apollo %i", GC->mission);
 			}
 		}
 		else if (G->REFSMMATopt == 5 || G->REFSMMATopt == 8)
 		{
-			GET_Display(Buffer, GC->rtcc->CZTDTGTU.GETTD);
-			skp->Text((int)(0.5 * W / 8), 2 * H / 14, Buffer, strlen(Buffer));
+			page.Format((int)(0.5 * W / 8), 2 * H / 14, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->CZTDTGTU.GETTD, true);
 
-			sprintf(Buffer, "%f", GC->rtcc->BZLAND.lat[RTCC_LMPOS_BEST] * DEG);
-			skp->Text((int)(5.5 * W / 8), 8 * H / 14, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%f", GC->rtcc->BZLAND.lng[RTCC_LMPOS_BEST] * DEG);
-			skp->Text((int)(5.5 * W / 8), 10 * H / 14, Buffer, strlen(Buffer));
+			page.Printf((int)(5.5 * W / 8), 8 * H / 14, "%f", GC->rtcc->BZLAND.lat[RTCC_LMPOS_BEST] * DEG);
+			page.Printf((int)(5.5 * W / 8), 10 * H / 14, "%f", GC->rtcc->BZLAND.lng[RTCC_LMPOS_BEST] * DEG);
 
 			if (G->REFSMMATopt == 8)
 			{
-				skp->Text(5 * W / 8, 2 * H / 14, "LS during TLC", 13);
+				page.Text(5 * W / 8, 2 * H / 14, "LS during TLC", 13);
 
-				skp->Text((int)(5.5 * W / 8), 11 * H / 14, "Azimuth:", 8);
-				sprintf(Buffer, "%f", GC->rtcc->med_k18.psi_DS);
-				skp->Text((int)(5.5 * W / 8), 12 * H / 14, Buffer, strlen(Buffer));
+				page.Text((int)(5.5 * W / 8), 11 * H / 14, "Azimuth:", 8);
+				page.Printf((int)(5.5 * W / 8), 12 * H / 14, "%f", GC->rtcc->med_k18.psi_DS);
 			}
 			else
 			{
-				skp->Text(5 * W / 8, 2 * H / 14, "Landing Site", 12);
+				page.Text(5 * W / 8, 2 * H / 14, "Landing Site", 12);
 			}
 
 		}
 		else if (G->REFSMMATopt == 6)
 		{
-			skp->Text(5 * W / 8, 2 * H / 14, "PTC", 3);
+			page.Text(5 * W / 8, 2 * H / 14, "PTC", 3);
 
-			GET_Display(Buffer, G->REFSMMATTime);
-			skp->Text((int)(0.5 * W / 8), 2 * H / 14, Buffer, strlen(Buffer));
+			page.Format((int)(0.5 * W / 8), 2 * H / 14, this, &ApolloRTCCMFD::GET_Display, G->REFSMMATTime, true);
 		}
 		else if (G->REFSMMATopt == 7)
 		{
-			skp->Text(5 * W / 8, 2 * H / 14, "REFS from Attitude", 18);
+			page.Text(5 * W / 8, 2 * H / 14, "REFS from Attitude", 18);
 
-			skp->Text((int)(0.5 * W / 8), 9 * H / 21, "Current REFSMMAT:", 17);
-			REFSMMATName(Buffer, G->REFSMMATcur);
-			skp->Text((int)(0.5 * W / 8), 10 * H / 21, Buffer, strlen(Buffer));
+			page.Text((int)(0.5 * W / 8), 9 * H / 21, "Current REFSMMAT:", 17);
+			page.Format((int)(0.5 * W / 8), 10 * H / 21, this, &ApolloRTCCMFD::REFSMMATName, G->REFSMMATcur);
 
-			skp->Text((int)(0.5 * W / 8), 12 * H / 21, "Attitude:", 9);
-			sprintf(Buffer, "%+07.2f R", G->VECangles.x*DEG);
-			skp->Text((int)(0.5 * W / 8), 13 * H / 21, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%+07.2f P", G->VECangles.y*DEG);
-			skp->Text((int)(0.5 * W / 8), 14 * H / 21, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%+07.2f Y", G->VECangles.z*DEG);
-			skp->Text((int)(0.5 * W / 8), 15 * H / 21, Buffer, strlen(Buffer));
+			page.Text((int)(0.5 * W / 8), 12 * H / 21, "Attitude:", 9);
+			page.Printf((int)(0.5 * W / 8), 13 * H / 21, "%+07.2f R", G->VECangles.x*DEG);
+			page.Printf((int)(0.5 * W / 8), 14 * H / 21, "%+07.2f P", G->VECangles.y*DEG);
+			page.Printf((int)(0.5 * W / 8), 15 * H / 21, "%+07.2f Y", G->VECangles.z*DEG);
 		}
 
 		for (int i = 0; i < 9; i++)
@@ -712,394 +635,335 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 				sprintf(Buffer, "%f", GC->rtcc->EZJGMTX3.data[0].REFSMMAT.data[i]);
 			}
 			
-			skp->Text(7 * W / 16, (4 + i) * H / 14, Buffer, strlen(Buffer));
+			page.Text(7 * W / 16, (4 + i) * H / 14, Buffer, strlen(Buffer));
 		}
 	}
 	else if (screen == 6)
 	{
-		skp->Text(6 * W / 8, (int)(0.5 * H / 14), "Entry Options", 13);
+		page.Text(6 * W / 8, (int)(0.5 * H / 14), "Entry Options", 13);
 
-		skp->Text(1 * W / 8, 2 * H / 14, "Deorbit Maneuver", 16);
-		skp->Text(1 * W / 8, 4 * H / 14, "Abort Scan Table", 16);
-		skp->Text(1 * W / 8, 6 * H / 14, "Return to Earth Digitals", 24);
-		skp->Text(1 * W / 8, 8 * H / 14, "Splashdown Update", 17);
-		skp->Text(1 * W / 8, 10 * H / 14, "RTE Constraints", 15);
-		skp->Text(1 * W / 8, 12 * H / 14, "Tradeoff", 15);
+		page.Text(1 * W / 8, 2 * H / 14, "Deorbit Maneuver", 16);
+		page.Text(1 * W / 8, 4 * H / 14, "Abort Scan Table", 16);
+		page.Text(1 * W / 8, 6 * H / 14, "Return to Earth Digitals", 24);
+		page.Text(1 * W / 8, 8 * H / 14, "Splashdown Update", 17);
+		page.Text(1 * W / 8, 10 * H / 14, "RTE Constraints", 15);
+		page.Text(1 * W / 8, 12 * H / 14, "Tradeoff", 15);
 
-		skp->Text(5 * W / 8, 2 * H / 14, "RTED Manual Input", 17);
-		skp->Text(5 * W / 8, 4 * H / 14, "RTED Entry Profile", 18);
+		page.Text(5 * W / 8, 2 * H / 14, "RTED Manual Input", 17);
+		page.Text(5 * W / 8, 4 * H / 14, "RTED Entry Profile", 18);
 	}
 	else if (screen == 7)
 	{
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
 
-		skp->Text(4 * W / 8, 1 * H / 14, "AGS NAVIGATION UPDATES (277)", 28);
+		page.Text(4 * W / 8, 1 * H / 14, "AGS NAVIGATION UPDATES (277)", 28);
 
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
 
 		if (G->SVSlot)
 		{
-			skp->Text((int)(0.5 * W / 8), 8 * H / 14, "CSM", 3);
+			page.Text((int)(0.5 * W / 8), 8 * H / 14, "CSM", 3);
 		}
 		else
 		{
-			skp->Text((int)(0.5 * W / 8), 8 * H / 14, "LM", 2);
+			page.Text((int)(0.5 * W / 8), 8 * H / 14, "LM", 2);
 		}
 
 		if (G->svtarget != NULL)
 		{
 			sprintf(Buffer, G->svtarget->GetName());
-			skp->Text((int)(0.5 * W / 8), 6 * H / 14, Buffer, strlen(Buffer));
+			page.Text((int)(0.5 * W / 8), 6 * H / 14, Buffer, strlen(Buffer));
 		}
 		else
 		{
-			skp->Text((int)(0.5 * W / 8), 6 * H / 14, "No Target!", 10);
+			page.Text((int)(0.5 * W / 8), 6 * H / 14, "No Target!", 10);
 		}
 
-		skp->Text((int)(0.5 * W / 8), 3 * H / 14, "REFSMMAT:", 9);
-		REFSMMATName(Buffer, G->REFSMMATcur);
-		skp->Text((int)(0.5 * W / 8), 4 * H / 14, Buffer, strlen(Buffer));
+		page.Text((int)(0.5 * W / 8), 3 * H / 14, "REFSMMAT:", 9);
+		page.Format((int)(0.5 * W / 8), 4 * H / 14, this, &ApolloRTCCMFD::REFSMMATName, G->REFSMMATcur);
 
 		int hh, mm;
 		double secs;
 
 		SStoHHMMSS(GC->rtcc->GETfromGMT(GC->rtcc->GetAGSClockZero()), hh, mm, secs); //Should be relative to LGC clock zero instead of liftoff time
-		sprintf(Buffer, "%d:%02d:%05.2f GET", hh, mm, secs);
-		skp->Text((int)(0.5 * W / 8), 10 * H / 14, Buffer, strlen(Buffer));
+		page.Printf((int)(0.5 * W / 8), 10 * H / 14, "%d:%02d:%05.2f GET", hh, mm, secs);
 
 		if (G->subThreadStatus > 0)
 		{
-			skp->Text(1 * W / 16, 12 * H / 14, "Calculating...", 14);
-		}
-		else
-		{
-			skp->Text(1 * W / 16, 12 * H / 14, "Calculate K-Factor", 18);
-		}
-
-		sprintf(Buffer, "%+06.0f", G->agssvpad.DEDA240);
-		skp->Text(4 * W / 8, 4 * H / 21, Buffer, strlen(Buffer));
-		skp->Text(6 * W / 8, 4 * H / 21, "240", 3);
-		sprintf(Buffer, "%+06.0f", G->agssvpad.DEDA241);
-		skp->Text(4 * W / 8, 5 * H / 21, Buffer, strlen(Buffer));
-		skp->Text(6 * W / 8, 5 * H / 21, "241", 3);
-		sprintf(Buffer, "%+06.0f", G->agssvpad.DEDA242);
-		skp->Text(4 * W / 8, 6 * H / 21, Buffer, strlen(Buffer));
-		skp->Text(6 * W / 8, 6 * H / 21, "242", 3);
-
-		sprintf(Buffer, "%+06.0f", G->agssvpad.DEDA260);
-		skp->Text(4 * W / 8, 7 * H / 21, Buffer, strlen(Buffer));
-		skp->Text(6 * W / 8, 7 * H / 21, "260", 3);
-		sprintf(Buffer, "%+06.0f", G->agssvpad.DEDA261);
-		skp->Text(4 * W / 8, 8 * H / 21, Buffer, strlen(Buffer));
-		skp->Text(6 * W / 8, 8 * H / 21, "261", 3);
-		sprintf(Buffer, "%+06.0f", G->agssvpad.DEDA262);
-		skp->Text(4 * W / 8, 9 * H / 21, Buffer, strlen(Buffer));
-		skp->Text(6 * W / 8, 9 * H / 21, "262", 3);
-
-		sprintf(Buffer, "%+07.1f", G->agssvpad.DEDA254);
-		skp->Text(4 * W / 8, 10 * H / 21, Buffer, strlen(Buffer));
-		skp->Text(6 * W / 8, 10 * H / 21, "254", 3);
-
-		sprintf(Buffer, "%+06.0f", G->agssvpad.DEDA244);
-		skp->Text(4 * W / 8, 11 * H / 21, Buffer, strlen(Buffer));
-		skp->Text(6 * W / 8, 11 * H / 21, "244", 3);
-		sprintf(Buffer, "%+06.0f", G->agssvpad.DEDA245);
-		skp->Text(4 * W / 8, 12 * H / 21, Buffer, strlen(Buffer));
-		skp->Text(6 * W / 8, 12 * H / 21, "245", 3);
-		sprintf(Buffer, "%+06.0f", G->agssvpad.DEDA246);
-		skp->Text(4 * W / 8, 13 * H / 21, Buffer, strlen(Buffer));
-		skp->Text(6 * W / 8, 13 * H / 21, "246", 3);
-
-		sprintf(Buffer, "%+06.0f", G->agssvpad.DEDA264);
-		skp->Text(4 * W / 8, 14 * H / 21, Buffer, strlen(Buffer));
-		skp->Text(6 * W / 8, 14 * H / 21, "264", 3);
-		sprintf(Buffer, "%+06.0f", G->agssvpad.DEDA265);
-		skp->Text(4 * W / 8, 15 * H / 21, Buffer, strlen(Buffer));
-		skp->Text(6 * W / 8, 15 * H / 21, "265", 3);
-		sprintf(Buffer, "%+06.0f", G->agssvpad.DEDA266);
-		skp->Text(4 * W / 8, 16 * H / 21, Buffer, strlen(Buffer));
-		skp->Text(6 * W / 8, 16 * H / 21, "266", 3);
-
-		sprintf(Buffer, "%+07.1f", G->agssvpad.DEDA272);
-		skp->Text(4 * W / 8, 17 * H / 21, Buffer, strlen(Buffer));
-		skp->Text(6 * W / 8, 17 * H / 21, "272", 3);
+			page.Text(1 * W / 16, 12 * H / 14, "Calculating...", 14);
+		}
+		else
+		{
+			page.Text(1 * W / 16, 12 * H / 14, "Calculate K-Factor", 18);
+		}
+
+		page.Printf(4 * W / 8, 4 * H / 21, "%+06.0f", G->agssvpad.DEDA240);
+		page.Text(6 * W / 8, 4 * H / 21, "240", 3);
+		page.Printf(4 * W / 8, 5 * H / 21, "%+06.0f", G->agssvpad.DEDA241);
+		page.Text(6 * W / 8, 5 * H / 21, "241", 3);
+		page.Printf(4 * W / 8, 6 * H / 21, "%+06.0f", G->agssvpad.DEDA242);
+		page.Text(6 * W / 8, 6 * H / 21, "242", 3);
+
+		page.Printf(4 * W / 8, 7 * H / 21, "%+06.0f", G->agssvpad.DEDA260);
+		page.Text(6 * W / 8, 7 * H / 21, "260", 3);
+		page.Printf(4 * W / 8, 8 * H / 21, "%+06.0f", G->agssvpad.DEDA261);
+		page.Text(6 * W / 8, 8 * H / 21, "261", 3);
+		page.Printf(4 * W / 8, 9 * H / 21, "%+06.0f", G->agssvpad.DEDA262);
+		page.Text(6 * W / 8, 9 * H / 21, "262", 3);
+
+		page.Printf(4 * W / 8, 10 * H / 21, "%+07.1f", G->agssvpad.DEDA254);
+		page.Text(6 * W / 8, 10 * H / 21, "254", 3);
+
+		page.Printf(4 * W / 8, 11 * H / 21, "%+06.0f", G->agssvpad.DEDA244);
+		page.Text(6 * W / 8, 11 * H / 21, "244", 3);
+		page.Printf(4 * W / 8, 12 * H / 21, "%+06.0f", G->agssvpad.DEDA245);
+		page.Text(6 * W / 8, 12 * H / 21, "245", 3);
+		page.Printf(4 * W / 8, 13 * H / 21, "%+06.0f", G->agssvpad.DEDA246);
+		page.Text(6 * W / 8, 13 * H / 21, "246", 3);
+
+		page.Printf(4 * W / 8, 14 * H / 21, "%+06.0f", G->agssvpad.DEDA264);
+		page.Text(6 * W / 8, 14 * H / 21, "264", 3);
+		page.Printf(4 * W / 8, 15 * H / 21, "%+06.0f", G->agssvpad.DEDA265);
+		page.Text(6 * W / 8, 15 * H / 21, "265", 3);
+		page.Printf(4 * W / 8, 16 * H / 21, "%+06.0f", G->agssvpad.DEDA266);
+		page.Text(6 * W / 8, 16 * H / 21, "266", 3);
+
+		page.Printf(4 * W / 8, 17 * H / 21, "%+07.1f", G->agssvpad.DEDA272);
+		page.Text(6 * W / 8, 17 * H / 21, "272", 3);
 	}
 	else if (screen == 8)
 	{
-		skp->Text(6 * W / 8, (int)(0.5 * H / 14), "Config", 6);
+		page.Text(6 * W / 8, (int)(0.5 * H / 14), "Config", 6);
 
 		if (GC->mission == 0)
 		{
-			skp->Text(1 * W / 8, 2 * H / 14, "Manual", 8);
+			page.Text(1 * W / 8, 2 * H / 14, "Manual", 8);
 		}
 		else if (GC->mission >= 7)
 		{
-			sprintf(Buffer, "Apollo %i", GC->mission);
-			skp->Text(1 * W / 8, 2 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(1 * W / 8, 2 * H / 14, "Apollo %i", GC->mission);
 		}
 
-		sprintf(Buffer, "%02d:%02d:%04d", GC->rtcc->GZGENCSN.DayofLiftoff, GC->rtcc->GZGENCSN.MonthofLiftoff, GC->rtcc->GZGENCSN.Year);
-		skp->Text(4 * W / 8, 2 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(4 * W / 8, 2 * H / 14, "%02d:%02d:%04d", GC->rtcc->GZGENCSN.DayofLiftoff, GC->rtcc->GZGENCSN.MonthofLiftoff, GC->rtcc->GZGENCSN.Year);
 
-		GET_Display2(Buffer, GC->rtcc->GetGMTLO()*3600.0);
-		skp->Text(4 * W / 8, 4 * H / 14, Buffer, strlen(Buffer));
+		page.Format(4 * W / 8, 4 * H / 14, this, &ApolloRTCCMFD::GET_Display2, GC->rtcc->GetGMTLO()*3600.0);
 
-		sprintf(Buffer, "AGC Epoch: %f", GC->rtcc->SystemParameters.AGCEpoch);
-		skp->Text(4 * W / 8, 6 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(4 * W / 8, 6 * H / 14, "AGC Epoch: %f", GC->rtcc->SystemParameters.AGCEpoch);
 
-		skp->Text(4 * W / 8, 8 * H / 14, "Update Liftoff Time", 19);
+		page.Text(4 * W / 8, 8 * H / 14, "Update Liftoff Time", 19);
 
 		if (G->vesseltype == 0)
 		{
-			skp->Text(1 * W / 8, 4 * H / 14, "CSM", 3);
+			page.Text(1 * W / 8, 4 * H / 14, "CSM", 3);
 		}
 		else if (G->vesseltype == 1)
 		{
-			skp->Text(1 * W / 8, 4 * H / 14, "CSM/LM docked", 13);
+			page.Text(1 * W / 8, 4 * H / 14, "CSM/LM docked", 13);
 		}
 		else if (G->vesseltype == 2)
 		{
-			skp->Text(1 * W / 8, 4 * H / 14, "LM", 3);
+			page.Text(1 * W / 8, 4 * H / 14, "LM", 3);
 		}
 		else if (G->vesseltype == 3)
 		{
-			skp->Text(1 * W / 8, 4 * H / 14, "LM/CSM docked", 13);
+			page.Text(1 * W / 8, 4 * H / 14, "LM/CSM docked", 13);
 		}
 		else
 		{
-			skp->Text(1 * W / 8, 4 * H / 14, "MCC", 3);
+			page.Text(1 * W / 8, 4 * H / 14, "MCC", 3);
 		}
 
 		if (G->vesseltype == 2 || G->vesseltype == 3)
 		{
 			if (G->lemdescentstage)
 			{
-				skp->Text(1 * W / 8, 6 * H / 14, "Descent Stage", 13);
+				page.Text(1 * W / 8, 6 * H / 14, "Descent Stage", 13);
 			}
 			else
 			{
-				skp->Text(1 * W / 8, 6 * H / 14, "Ascent Stage", 12);
+				page.Text(1 * W / 8, 6 * H / 14, "Ascent Stage", 12);
 			}
 		}
 
-		skp->Text(1 * W / 8, 10 * H / 14, "Sxt/Star Check:", 15);
-		sprintf(Buffer, "%.0f min", -G->sxtstardtime / 60.0);
-		skp->Text(4 * W / 8, 10 * H / 14, Buffer, strlen(Buffer));
+		page.Text(1 * W / 8, 10 * H / 14, "Sxt/Star Check:", 15);
+		page.Printf(4 * W / 8, 10 * H / 14, "%.0f min", -G->sxtstardtime / 60.0);
 
-		skp->Text(1 * W / 8, 12 * H / 14, "Uplink in LOS:", 14);
+		page.Text(1 * W / 8, 12 * H / 14, "Uplink in LOS:", 14);
 
 		if (G->inhibUplLOS)
 		{
-			skp->Text(4 * W / 8, 12 * H / 14, "Inhibit", 7);
+			page.Text(4 * W / 8, 12 * H / 14, "Inhibit", 7);
 		}
 		else
 		{
-			skp->Text(4 * W / 8, 12 * H / 14, "Enabled", 7);
+			page.Text(4 * W / 8, 12 * H / 14, "Enabled", 7);
 		}
 
-		//skp->Text(1 * W / 8, 12 * H / 14, "DV Format:", 9);
-		//skp->Text(5 * W / 8, 12 * H / 14, "AGC DSKY", 8);
+		//page.Text(1 * W / 8, 12 * H / 14, "DV Format:", 9);
+		//page.Text(5 * W / 8, 12 * H / 14, "AGC DSKY", 8);
 	}
 	else if (screen == 9)
 	{
 		if (G->g_Data.isRequesting)
 		{
-			skp->Text(6 * W / 8, 8 * H / 14, "Requesting...", 13);
+			page.Text(6 * W / 8, 8 * H / 14, "Requesting...", 13);
 		}
 
 		if (G->manpadopt == 0)
 		{
 			if (G->HeadsUp)
 			{
-				skp->Text((int)(0.5 * W / 8), 6 * H / 14, "Heads Up", 8);
+				page.Text((int)(0.5 * W / 8), 6 * H / 14, "Heads Up", 8);
 			}
 			else
 			{
-				skp->Text((int)(0.5 * W / 8), 6 * H / 14, "Heads Down", 10);
+				page.Text((int)(0.5 * W / 8), 6 * H / 14, "Heads Down", 10);
 			}
 
-			skp->Text((int)(0.5 * W / 8), 8 * H / 14, "REFSMMAT:", 9);
+			page.Text((int)(0.5 * W / 8), 8 * H / 14, "REFSMMAT:", 9);
 
-			REFSMMATName(Buffer, G->REFSMMATcur);
-			skp->Text((int)(0.5 * W / 8), 9 * H / 14, Buffer, strlen(Buffer));
+			page.Format((int)(0.5 * W / 8), 9 * H / 14, this, &ApolloRTCCMFD::REFSMMATName, G->REFSMMATcur);
 
 			if (G->vesseltype < 2)
 			{
-				skp->Text(5 * W / 8, (int)(0.5 * H / 14), "P30 Maneuver", 12);
+				page.Text(5 * W / 8, (int)(0.5 * H / 14), "P30 Maneuver", 12);
 
 				if (G->vesseltype == 0)
 				{
-					skp->Text((int)(0.5 * W / 8), 2 * H / 14, "CSM", 3);
+					page.Text((int)(0.5 * W / 8), 2 * H / 14, "CSM", 3);
 				}
 				else
 				{
-					skp->Text((int)(0.5 * W / 8), 2 * H / 14, "CSM/LM", 6);
+					page.Text((int)(0.5 * W / 8), 2 * H / 14, "CSM/LM", 6);
 				}
 
-				ThrusterName(Buffer, G->manpadenginetype);
-				skp->Text(1 * W / 16, 4 * H / 14, Buffer, strlen(Buffer));
+				page.Format(1 * W / 16, 4 * H / 14, this, &ApolloRTCCMFD::ThrusterName, G->manpadenginetype);
 
 				if (G->vesseltype == 1)
 				{
-					sprintf(Buffer, "LM Weight: %5.0f", G->manpad.LMWeight);
-					skp->Text((int)(0.5 * W / 8), 10 * H / 14, Buffer, strlen(Buffer));
+					page.Printf((int)(0.5 * W / 8), 10 * H / 14, "LM Weight: %5.0f", G->manpad.LMWeight);
 				}
 
-				skp->Text((int)(0.5 * W / 8), 18 * H / 23, "Set Stars:", 10);
-				skp->Text((int)(0.5 * W / 8), 19 * H / 23, G->manpad.SetStars, strlen(G->manpad.SetStars));
+				page.Text((int)(0.5 * W / 8), 18 * H / 23, "Set Stars:", 10);
+				page.Text((int)(0.5 * W / 8), 19 * H / 23, G->manpad.SetStars, strlen(G->manpad.SetStars));
 
 				/*if (length(G->manpad.GDCangles) == 0.0)
 				{
-					skp->Text((int)(0.5 * W / 8), 19 * H / 23, "N/A", 3);
+					page.Text((int)(0.5 * W / 8), 19 * H / 23, "N/A", 3);
 				}
 				else
 				{
 					if (G->GDCset == 0)
 					{
-						skp->Text((int)(0.5 * W / 8), 19 * H / 23, "Vega, Deneb", 11);
+						page.Text((int)(0.5 * W / 8), 19 * H / 23, "Vega, Deneb", 11);
 					}
 					else if (G->GDCset == 1)
 					{
-						skp->Text((int)(0.5 * W / 8), 19 * H / 23, "Navi, Polaris", 13);
+						page.Text((int)(0.5 * W / 8), 19 * H / 23, "Navi, Polaris", 13);
 					}
 					else
 					{
-						skp->Text((int)(0.5 * W / 8), 19 * H / 23, "Acrux, Atria", 12);
+						page.Text((int)(0.5 * W / 8), 19 * H / 23, "Acrux, Atria", 12);
 					}
 				}*/
 
-				sprintf(Buffer, "R %03.0f", OrbMech::round(G->manpad.GDCangles.x));
-				skp->Text((int)(0.5 * W / 8), 20 * H / 23, Buffer, strlen(Buffer));
-				sprintf(Buffer, "P %03.0f", OrbMech::round(G->manpad.GDCangles.y));
-				skp->Text((int)(0.5 * W / 8), 21 * H / 23, Buffer, strlen(Buffer));
-				sprintf(Buffer, "Y %03.0f", OrbMech::round(G->manpad.GDCangles.z));
-				skp->Text((int)(0.5 * W / 8), 22 * H / 23, Buffer, strlen(Buffer));
+				page.Printf((int)(0.5 * W / 8), 20 * H / 23, "R %03.0f", OrbMech::round(G->manpad.GDCangles.x));
+				page.Printf((int)(0.5 * W / 8), 21 * H / 23, "P %03.0f", OrbMech::round(G->manpad.GDCangles.y));
+				page.Printf((int)(0.5 * W / 8), 22 * H / 23, "Y %03.0f", OrbMech::round(G->manpad.GDCangles.z));
 
 				int hh, mm;
 				double secs;
 
 				SStoHHMMSS(G->P30TIG, hh, mm, secs);
 
-				skp->Text(7 * W / 8, 3 * H / 26, "N47", 3);
-				skp->Text(7 * W / 8, 4 * H / 26, "N48", 3);
-				skp->Text(7 * W / 8, 6 * H / 26, "N33", 3);
-				skp->Text(7 * W / 8, 9 * H / 26, "N81", 3);
-				skp->Text(7 * W / 8, 15 * H / 26, "N44", 3);
+				page.Text(7 * W / 8, 3 * H / 26, "N47", 3);
+				page.Text(7 * W / 8, 4 * H / 26, "N48", 3);
+				page.Text(7 * W / 8, 6 * H / 26, "N33", 3);
+				page.Text(7 * W / 8, 9 * H / 26, "N81", 3);
+				page.Text(7 * W / 8, 15 * H / 26, "N44", 3);
 
-				sprintf(Buffer, "%+06.0f WGT", G->manpad.Weight);
-				skp->Text((int)(3.5 * W / 8), 3 * H / 26, Buffer, strlen(Buffer));
+				page.Printf((int)(3.5 * W / 8), 3 * H / 26, "%+06.0f WGT", G->manpad.Weight);
 
 				if (G->manpadenginetype == RTCC_ENGINETYPE_CSMSPS)
 				{
-					sprintf(Buffer, "%+07.2f PTRIM", G->manpad.pTrim);
-					skp->Text((int)(3.5 * W / 8), 4 * H / 26, Buffer, strlen(Buffer));
-					sprintf(Buffer, "%+07.2f YTRIM", G->manpad.yTrim);
-					skp->Text((int)(3.5 * W / 8), 5 * H / 26, Buffer, strlen(Buffer));
+					page.Printf((int)(3.5 * W / 8), 4 * H / 26, "%+07.2f PTRIM", G->manpad.pTrim);
+					page.Printf((int)(3.5 * W / 8), 5 * H / 26, "%+07.2f YTRIM", G->manpad.yTrim);
 				}
 				else
 				{
-					skp->Text((int)(3.5 * W / 8), 4 * H / 26, "N/A      PTRIM", 14);
-					skp->Text((int)(3.5 * W / 8), 5 * H / 26, "N/A      YTRIM", 14);
+					page.Text((int)(3.5 * W / 8), 4 * H / 26, "N/A      PTRIM", 14);
+					page.Text((int)(3.5 * W / 8), 5 * H / 26, "N/A      YTRIM", 14);
 				}
 
-				sprintf(Buffer, "%+06d HRS GETI", hh);
-				skp->Text((int)(3.5 * W / 8), 6 * H / 26, Buffer, strlen(Buffer));
-				sprintf(Buffer, "%+06d MIN", mm);
-				skp->Text((int)(3.5 * W / 8), 7 * H / 26, Buffer, strlen(Buffer));
-				sprintf(Buffer, "%+06.0f SEC", secs * 100.0);
-				skp->Text((int)(3.5 * W / 8), 8 * H / 26, Buffer, strlen(Buffer));
-
-				sprintf(Buffer, "%+07.1f DVX", G->dV_LVLH.x / 0.3048);
-				skp->Text((int)(3.5 * W / 8), 9 * H / 26, Buffer, strlen(Buffer));
-				sprintf(Buffer, "%+07.1f DVY", G->dV_LVLH.y / 0.3048);
-				skp->Text((int)(3.5 * W / 8), 10 * H / 26, Buffer, strlen(Buffer));
-				sprintf(Buffer, "%+07.1f DVZ", G->dV_LVLH.z / 0.3048);
-				skp->Text((int)(3.5 * W / 8), 11 * H / 26, Buffer, strlen(Buffer));
-
-				sprintf(Buffer, "XXX%03.0f R", G->manpad.Att.x);
-				skp->Text((int)(3.5 * W / 8), 12 * H / 26, Buffer, strlen(Buffer));
-				sprintf(Buffer, "XXX%03.0f P", G->manpad.Att.y);
-				skp->Text((int)(3.5 * W / 8), 13 * H / 26, Buffer, strlen(Buffer));
-				sprintf(Buffer, "XXX%03.0f Y", G->manpad.Att.z);
-				skp->Text((int)(3.5 * W / 8), 14 * H / 26, Buffer, strlen(Buffer));
-
-				sprintf(Buffer, "%+07.1f HA", min(9999.9, G->manpad.HA));
-				skp->Text((int)(3.5 * W / 8), 15 * H / 26, Buffer, strlen(Buffer));
-				sprintf(Buffer, "%+07.1f HP", G->manpad.HP);
-				skp->Text((int)(3.5 * W / 8), 16 * H / 26, Buffer, strlen(Buffer));
-
-				sprintf(Buffer, "%+07.1f VT", length(G->dV_LVLH) / 0.3048);
-				skp->Text((int)(3.5 * W / 8), 17 * H / 26, Buffer, strlen(Buffer));
+				page.Printf((int)(3.5 * W / 8), 6 * H / 26, "%+06d HRS GETI", hh);
+				page.Printf((int)(3.5 * W / 8), 7 * H / 26, "%+06d MIN", mm);
+				page.Printf((int)(3.5 * W / 8), 8 * H / 26, "%+06.0f SEC", secs * 100.0);
+
+				page.Printf((int)(3.5 * W / 8), 9 * H / 26, "%+07.1f DVX", G->dV_LVLH.x / 0.3048);
+				page.Printf((int)(3.5 * W / 8), 10 * H / 26, "%+07.1f DVY", G->dV_LVLH.y / 0.3048);
+				page.Printf((int)(3.5 * W / 8), 11 * H / 26, "%+07.1f DVZ", G->dV_LVLH.z / 0.3048);
+
+				page.Printf((int)(3.5 * W / 8), 12 * H / 26, "XXX%03.0f R", G->manpad.Att.x);
+				page.Printf((int)(3.5 * W / 8), 13 * H / 26, "XXX%03.0f P", G->manpad.Att.y);
+				page.Printf((int)(3.5 * W / 8), 14 * H / 26, "XXX%03.0f Y", G->manpad.Att.z);
+
+				page.Printf((int)(3.5 * W / 8), 15 * H / 26, "%+07.1f HA", min(9999.9, G->manpad.HA));
+				page.Printf((int)(3.5 * W / 8), 16 * H / 26, "%+07.1f HP", G->manpad.HP);
+
+				page.Printf((int)(3.5 * W / 8), 17 * H / 26, "%+07.1f VT", length(G->dV_LVLH) / 0.3048);
 
 				SStoHHMMSS(G->manpad.burntime, hh, mm, secs);
 
-				sprintf(Buffer, "XXX%d:%02.0f BT (MIN:SEC)", mm, secs);
-				skp->Text((int)(3.5 * W / 8), 18 * H / 26, Buffer, strlen(Buffer));
-				sprintf(Buffer, "%+07.1f VC", G->manpad.Vc);
-				skp->Text((int)(3.5 * W / 8), 19 * H / 26, Buffer, strlen(Buffer));
+				page.Printf((int)(3.5 * W / 8), 18 * H / 26, "XXX%d:%02.0f BT (MIN:SEC)", mm, secs);
+				page.Printf((int)(3.5 * W / 8), 19 * H / 26, "%+07.1f VC", G->manpad.Vc);
 
-				//skp->Text(4 * W / 8, 13 * H / 20, "SXT star check", 14);
+				//page.Text(4 * W / 8, 13 * H / 20, "SXT star check", 14);
 
 				if (G->manpad.Star == 0)
 				{
-					sprintf(Buffer, "N/A     SXTS");
-					skp->Text((int)(3.5 * W / 8), 20 * H / 26, Buffer, strlen(Buffer));
-					sprintf(Buffer, "N/A     SFT");
-					skp->Text((int)(3.5 * W / 8), 21 * H / 26, Buffer, strlen(Buffer));
-					sprintf(Buffer, "N/A     TRN");
-					skp->Text((int)(3.5 * W / 8), 22 * H / 26, Buffer, strlen(Buffer));
+					page.Printf((int)(3.5 * W / 8), 20 * H / 26, "N/A     SXTS");
+					page.Printf((int)(3.5 * W / 8), 21 * H / 26, "N/A     SFT");
+					page.Printf((int)(3.5 * W / 8), 22 * H / 26, "N/A     TRN");
 				}
 				else
 				{
-					sprintf(Buffer, "XXXX%02d SXTS", G->manpad.Star);
-					skp->Text((int)(3.5 * W / 8), 20 * H / 26, Buffer, strlen(Buffer));
-					sprintf(Buffer, "%+07.2f SFT", G->manpad.Shaft);
-					skp->Text((int)(3.5 * W / 8), 21 * H / 26, Buffer, strlen(Buffer));
-					sprintf(Buffer, "%+07.3f TRN", G->manpad.Trun);
-					skp->Text((int)(3.5 * W / 8), 22 * H / 26, Buffer, strlen(Buffer));
+					page.Printf((int)(3.5 * W / 8), 20 * H / 26, "XXXX%02d SXTS", G->manpad.Star);
+					page.Printf((int)(3.5 * W / 8), 21 * H / 26, "%+07.2f SFT", G->manpad.Shaft);
+					page.Printf((int)(3.5 * W / 8), 22 * H / 26, "%+07.3f TRN", G->manpad.Trun);
 				}
 				if (G->manpad.BSSStar == 0)
 				{
-					sprintf(Buffer, "N/A     BSS");
-					skp->Text((int)(3.5 * W / 8), 23 * H / 26, Buffer, strlen(Buffer));
-					sprintf(Buffer, "N/A     SPA");
-					skp->Text((int)(3.5 * W / 8), 24 * H / 26, Buffer, strlen(Buffer));
-					sprintf(Buffer, "N/A     SXP");
-					skp->Text((int)(3.5 * W / 8), 25 * H / 26, Buffer, strlen(Buffer));
+					page.Printf((int)(3.5 * W / 8), 23 * H / 26, "N/A     BSS");
+					page.Printf((int)(3.5 * W / 8), 24 * H / 26, "N/A     SPA");
+					page.Printf((int)(3.5 * W / 8), 25 * H / 26, "N/A     SXP");
 				}
 				else
 				{
-					sprintf(Buffer, "XXXX%02d BSS", G->manpad.BSSStar);
-					skp->Text((int)(3.5 * W / 8), 23 * H / 26, Buffer, strlen(Buffer));
-					sprintf(Buffer, "%+07.2f SPA", G->manpad.SPA);
-					skp->Text((int)(3.5 * W / 8), 24 * H / 26, Buffer, strlen(Buffer));
-					sprintf(Buffer, "%+07.3f SXP", G->manpad.SXP);
-					skp->Text((int)(3.5 * W / 8), 25 * H / 26, Buffer, strlen(Buffer));
+					page.Printf((int)(3.5 * W / 8), 23 * H / 26, "XXXX%02d BSS", G->manpad.BSSStar);
+					page.Printf((int)(3.5 * W / 8), 24 * H / 26, "%+07.2f SPA", G->manpad.SPA);
+					page.Printf((int)(3.5 * W / 8), 25 * H / 26, "%+07.3f SXP", G->manpad.SXP);
 				}
 			}
 			else
 			{
-				skp->Text(5 * W / 8, (int)(0.5 * H / 14), "P30 LM Maneuver", 15);
+				page.Text(5 * W / 8, (int)(0.5 * H / 14), "P30 LM Maneuver", 15);
 
-				ThrusterName(Buffer, G->manpadenginetype);
-				skp->Text(1 * W / 16, 4 * H / 14, Buffer, strlen(Buffer));
+				page.Format(1 * W / 16, 4 * H / 14, this, &ApolloRTCCMFD::ThrusterName, G->manpadenginetype);
 
 				if (G->vesseltype == 2)
 				{
-					skp->Text((int)(0.5 * W / 8), 2 * H / 14, "LM", 3);
+					page.Text((int)(0.5 * W / 8), 2 * H / 14, "LM", 3);
 				}
 				else
 				{
-					skp->Text((int)(0.5 * W / 8), 2 * H / 14, "LM/CSM", 6);
+					page.Text((int)(0.5 * W / 8), 2 * H / 14, "LM/CSM", 6);
 				}
 
-				sprintf(Buffer, "LM Weight: %5.0f", G->lmmanpad.LMWeight);
-				skp->Text((int)(0.5 * W / 8), 10 * H / 14, Buffer, strlen(Buffer));
+				page.Printf((int)(0.5 * W / 8), 10 * H / 14, "LM Weight: %5.0f", G->lmmanpad.LMWeight);
 
 				if (G->vesseltype == 3)
 				{
-					sprintf(Buffer, "CSM Weight: %5.0f", G->lmmanpad.CSMWeight);
-					skp->Text((int)(0.5 * W / 8), 11 * H / 14, Buffer, strlen(Buffer));
+					page.Printf((int)(0.5 * W / 8), 11 * H / 14, "CSM Weight: %5.0f", G->lmmanpad.CSMWeight);
 				}
 
 				int hh, mm;
@@ -1107,91 +971,64 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 
 				SStoHHMMSS(G->P30TIG, hh, mm, secs);
 
-				sprintf(Buffer, "%+06d HRS GETI", hh);
-				skp->Text((int)(3.5 * W / 8), 5 * H / 26, Buffer, strlen(Buffer));
-				sprintf(Buffer, "%+06d MIN", mm);
-				skp->Text((int)(3.5 * W / 8), 6 * H / 26, Buffer, strlen(Buffer));
-				sprintf(Buffer, "%+06.0f SEC", secs * 100.0);
-				skp->Text((int)(3.5 * W / 8), 7 * H / 26, Buffer, strlen(Buffer));
+				page.Printf((int)(3.5 * W / 8), 5 * H / 26, "%+06d HRS GETI", hh);
+				page.Printf((int)(3.5 * W / 8), 6 * H / 26, "%+06d MIN", mm);
+				page.Printf((int)(3.5 * W / 8), 7 * H / 26, "%+06.0f SEC", secs * 100.0);
 
-				sprintf(Buffer, "%+07.1f DVX", G->dV_LVLH.x / 0.3048);
-				skp->Text((int)(3.5 * W / 8), 8 * H / 26, Buffer, strlen(Buffer));
-				sprintf(Buffer, "%+07.1f DVY", G->dV_LVLH.y / 0.3048);
-				skp->Text((int)(3.5 * W / 8), 9 * H / 26, Buffer, strlen(Buffer));
-				sprintf(Buffer, "%+07.1f DVZ", G->dV_LVLH.z / 0.3048);
-				skp->Text((int)(3.5 * W / 8), 10 * H / 26, Buffer, strlen(Buffer));
+				page.Printf((int)(3.5 * W / 8), 8 * H / 26, "%+07.1f DVX", G->dV_LVLH.x / 0.3048);
+				page.Printf((int)(3.5 * W / 8), 9 * H / 26, "%+07.1f DVY", G->dV_LVLH.y / 0.3048);
+				page.Printf((int)(3.5 * W / 8), 10 * H / 26, "%+07.1f DVZ", G->dV_LVLH.z / 0.3048);
 
-				sprintf(Buffer, "%+07.1f HA", min(9999.9, G->lmmanpad.HA));
-				skp->Text((int)(3.5 * W / 8), 11 * H / 26, Buffer, strlen(Buffer));
-				sprintf(Buffer, "%+07.1f HP", G->lmmanpad.HP);
-				skp->Text((int)(3.5 * W / 8), 12 * H / 26, Buffer, strlen(Buffer));
+				page.Printf((int)(3.5 * W / 8), 11 * H / 26, "%+07.1f HA", min(9999.9, G->lmmanpad.HA));
+				page.Printf((int)(3.5 * W / 8), 12 * H / 26, "%+07.1f HP", G->lmmanpad.HP);
 
-				sprintf(Buffer, "%+07.1f DVR", length(G->dV_LVLH) / 0.3048);
-				skp->Text((int)(3.5 * W / 8), 13 * H / 26, Buffer, strlen(Buffer));
+				page.Printf((int)(3.5 * W / 8), 13 * H / 26, "%+07.1f DVR", length(G->dV_LVLH) / 0.3048);
 
 				SStoHHMMSS(G->lmmanpad.burntime, hh, mm, secs);
 
-				sprintf(Buffer, "XXX%d:%02.0f BT", mm, secs);
-				skp->Text((int)(3.5 * W / 8), 14 * H / 26, Buffer, strlen(Buffer));
+				page.Printf((int)(3.5 * W / 8), 14 * H / 26, "XXX%d:%02.0f BT", mm, secs);
 
-				sprintf(Buffer, "XXX%03.0f R", G->lmmanpad.Att.x);
-				skp->Text((int)(3.5 * W / 8), 15 * H / 26, Buffer, strlen(Buffer));
-				sprintf(Buffer, "XXX%03.0f P", G->lmmanpad.Att.y);
-				skp->Text((int)(3.5 * W / 8), 16 * H / 26, Buffer, strlen(Buffer));
+				page.Printf((int)(3.5 * W / 8), 15 * H / 26, "XXX%03.0f R", G->lmmanpad.Att.x);
+				page.Printf((int)(3.5 * W / 8), 16 * H / 26, "XXX%03.0f P", G->lmmanpad.Att.y);
 
-				sprintf(Buffer, "%+07.1f DVX AGS N86", G->lmmanpad.dV_AGS.x);
-				skp->Text((int)(3.5 * W / 8), 17 * H / 26, Buffer, strlen(Buffer));
-				sprintf(Buffer, "%+07.1f DVY AGS", G->lmmanpad.dV_AGS.y);
-				skp->Text((int)(3.5 * W / 8), 18 * H / 26, Buffer, strlen(Buffer));
-				sprintf(Buffer, "%+07.1f DVZ AGS", G->lmmanpad.dV_AGS.z);
-				skp->Text((int)(3.5 * W / 8), 19 * H / 26, Buffer, strlen(Buffer));
+				page.Printf((int)(3.5 * W / 8), 17 * H / 26, "%+07.1f DVX AGS N86", G->lmmanpad.dV_AGS.x);
+				page.Printf((int)(3.5 * W / 8), 18 * H / 26, "%+07.1f DVY AGS", G->lmmanpad.dV_AGS.y);
+				page.Printf((int)(3.5 * W / 8), 19 * H / 26, "%+07.1f DVZ AGS", G->lmmanpad.dV_AGS.z);
 
 				if (G->lmmanpad.BSSStar == 0)
 				{
-					sprintf(Buffer, "N/A     BSS");
-					skp->Text((int)(3.5 * W / 8), 20 * H / 26, Buffer, strlen(Buffer));
-					sprintf(Buffer, "N/A     SPA");
-					skp->Text((int)(3.5 * W / 8), 21 * H / 26, Buffer, strlen(Buffer));
-					sprintf(Buffer, "N/A     SXP");
-					skp->Text((int)(3.5 * W / 8), 22 * H / 26, Buffer, strlen(Buffer));
+					page.Printf((int)(3.5 * W / 8), 20 * H / 26, "N/A     BSS");
+					page.Printf((int)(3.5 * W / 8), 21 * H / 26, "N/A     SPA");
+					page.Printf((int)(3.5 * W / 8), 22 * H / 26, "N/A     SXP");
 				}
 				else
 				{
-					sprintf(Buffer, "XXXX%02d BSS", G->lmmanpad.BSSStar);
-					skp->Text((int)(3.5 * W / 8), 20 * H / 26, Buffer, strlen(Buffer));
-					sprintf(Buffer, "%+07.2f SPA", G->lmmanpad.SPA);
-					skp->Text((int)(3.5 * W / 8), 21 * H / 26, Buffer, strlen(Buffer));
-					sprintf(Buffer, "%+07.3f SXP", G->lmmanpad.SXP);
-					skp->Text((int)(3.5 * W / 8), 22 * H / 26, Buffer, strlen(Buffer));
+					page.Printf((int)(3.5 * W / 8), 20 * H / 26, "XXXX%02d BSS", G->lmmanpad.BSSStar);
+					page.Printf((int)(3.5 * W / 8), 21 * H / 26, "%+07.2f SPA", G->lmmanpad.SPA);
+					page.Printf((int)(3.5 * W / 8), 22 * H / 26, "%+07.3f SXP", G->lmmanpad.SXP);
 				}
 
-				skp->Text((int)(0.5 * W / 8), 24 * H / 26, G->lmmanpad.remarks, strlen(G->lmmanpad.remarks));
+				page.Text((int)(0.5 * W / 8), 24 * H / 26, G->lmmanpad.remarks, strlen(G->lmmanpad.remarks));
 			}
 		}
 		else if (G->manpadopt == 1)
 		{
-			skp->Text(4 * W / 8, (int)(0.5 * H / 14), "Terminal Phase Initiate", 23);
+			page.Text(4 * W / 8, (int)(0.5 * H / 14), "Terminal Phase Initiate", 23);
 
 			int hh, mm; // ss;
 			double secs;
 
 			SStoHHMMSS(G->P30TIG, hh, mm, secs);
 
-			skp->Text(7 * W / 8, 3 * H / 20, "N37", 3);
+			page.Text(7 * W / 8, 3 * H / 20, "N37", 3);
 
-			sprintf(Buffer, "%+06d HRS GETI", hh);
-			skp->Text(3 * W / 8, 3 * H / 20, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%+06d MIN", mm);
-			skp->Text(3 * W / 8, 4 * H / 20, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%+06.0f SEC", secs * 100.0);
-			skp->Text(3 * W / 8, 5 * H / 20, Buffer, strlen(Buffer));
+			page.Printf(3 * W / 8, 3 * H / 20, "%+06d HRS GETI", hh);
+			page.Printf(3 * W / 8, 4 * H / 20, "%+06d MIN", mm);
+			page.Printf(3 * W / 8, 5 * H / 20, "%+06.0f SEC", secs * 100.0);
 
-			sprintf(Buffer, "%+07.1f DVX", G->dV_LVLH.x / 0.3048);
-			skp->Text(3 * W / 8, 6 * H / 20, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%+07.1f DVY", G->dV_LVLH.y / 0.3048);
-			skp->Text(3 * W / 8, 7 * H / 20, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%+07.1f DVZ", G->dV_LVLH.z / 0.3048);
-			skp->Text(3 * W / 8, 8 * H / 20, Buffer, strlen(Buffer));
+			page.Printf(3 * W / 8, 6 * H / 20, "%+07.1f DVX", G->dV_LVLH.x / 0.3048);
+			page.Printf(3 * W / 8, 7 * H / 20, "%+07.1f DVY", G->dV_LVLH.y / 0.3048);
+			page.Printf(3 * W / 8, 8 * H / 20, "%+07.1f DVZ", G->dV_LVLH.z / 0.3048);
 
 			if (G->TPIPAD_dV_LOS.x > 0)
 			{
@@ -1201,7 +1038,7 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			{
 				sprintf(Buffer, "A%04.1f/%02.0f DVX LOS/BT", abs(G->TPIPAD_dV_LOS.x), G->TPIPAD_BT.x);
 			}
-			skp->Text(3 * W / 8, 9 * H / 20, Buffer, strlen(Buffer));
+			page.Text(3 * W / 8, 9 * H / 20, Buffer, strlen(Buffer));
 			if (G->TPIPAD_dV_LOS.y > 0)
 			{
 				sprintf(Buffer, "R%04.1f/%02.0f DVY LOS/BT", abs(G->TPIPAD_dV_LOS.y), G->TPIPAD_BT.y);
@@ -1210,7 +1047,7 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			{
 				sprintf(Buffer, "L%04.1f/%02.0f DVY LOS/BT", abs(G->TPIPAD_dV_LOS.y), G->TPIPAD_BT.y);
 			}
-			skp->Text(3 * W / 8, 10 * H / 20, Buffer, strlen(Buffer));
+			page.Text(3 * W / 8, 10 * H / 20, Buffer, strlen(Buffer));
 			if (G->TPIPAD_dV_LOS.z > 0)
 			{
 				sprintf(Buffer, "D%04.1f/%02.0f DVZ LOS/BT", abs(G->TPIPAD_dV_LOS.z), G->TPIPAD_BT.z);
@@ -1219,95 +1056,74 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			{
 				sprintf(Buffer, "U%04.1f/%02.0f DVZ LOS/BT", abs(G->TPIPAD_dV_LOS.z), G->TPIPAD_BT.z);
 			}
-			skp->Text(3 * W / 8, 11 * H / 20, Buffer, strlen(Buffer));
+			page.Text(3 * W / 8, 11 * H / 20, Buffer, strlen(Buffer));
 
-			sprintf(Buffer, "X%04.1f/%02.1f dH TPI/ddH", G->TPIPAD_dH, G->TPIPAD_ddH);
-			skp->Text(3 * W / 8, 12 * H / 20, Buffer, strlen(Buffer));
-			sprintf(Buffer, "X%06.2f R", G->TPIPAD_R);
-			skp->Text(3 * W / 8, 13 * H / 20, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%+07.1f RDOT at TPI", G->TPIPAD_Rdot);
-			skp->Text(3 * W / 8, 14 * H / 20, Buffer, strlen(Buffer));
-			sprintf(Buffer, "X%06.2f EL minus 5 min", G->TPIPAD_ELmin5);
-			skp->Text(3 * W / 8, 15 * H / 20, Buffer, strlen(Buffer));
-			sprintf(Buffer, "X%06.2f AZ", G->TPIPAD_AZ);
-			skp->Text(3 * W / 8, 16 * H / 20, Buffer, strlen(Buffer));
+			page.Printf(3 * W / 8, 12 * H / 20, "X%04.1f/%02.1f dH TPI/ddH", G->TPIPAD_dH, G->TPIPAD_ddH);
+			page.Printf(3 * W / 8, 13 * H / 20, "X%06.2f R", G->TPIPAD_R);
+			page.Printf(3 * W / 8, 14 * H / 20, "%+07.1f RDOT at TPI", G->TPIPAD_Rdot);
+			page.Printf(3 * W / 8, 15 * H / 20, "X%06.2f EL minus 5 min", G->TPIPAD_ELmin5);
+			page.Printf(3 * W / 8, 16 * H / 20, "X%06.2f AZ", G->TPIPAD_AZ);
 
 		}
 		else
 		{
 			if (G->vesseltype < 2)
 			{
-				skp->Text(4 * W / 8, (int)(0.5 * H / 14), "TLI PAD", 7);
+				page.Text(4 * W / 8, (int)(0.5 * H / 14), "TLI PAD", 7);
 
 				GET_Display(Buffer, G->tlipad.TB6P);
 				sprintf(Buffer, "%s TB6p", Buffer);
-				skp->Text(3 * W / 8, 3 * H / 20, Buffer, strlen(Buffer));
+				page.Text(3 * W / 8, 3 * H / 20, Buffer, strlen(Buffer));
 
-				sprintf(Buffer, "XXX%03.0f R", G->tlipad.IgnATT.x);
-				skp->Text(3 * W / 8, 4 * H / 20, Buffer, strlen(Buffer));
-				sprintf(Buffer, "XXX%03.0f P", G->tlipad.IgnATT.y);
-				skp->Text(3 * W / 8, 5 * H / 20, Buffer, strlen(Buffer));
-				sprintf(Buffer, "XXX%03.0f Y", G->tlipad.IgnATT.z);
-				skp->Text(3 * W / 8, 6 * H / 20, Buffer, strlen(Buffer));
+				page.Printf(3 * W / 8, 4 * H / 20, "XXX%03.0f R", G->tlipad.IgnATT.x);
+				page.Printf(3 * W / 8, 5 * H / 20, "XXX%03.0f P", G->tlipad.IgnATT.y);
+				page.Printf(3 * W / 8, 6 * H / 20, "XXX%03.0f Y", G->tlipad.IgnATT.z);
 
 				double secs;
 				int mm, hh;
 				SStoHHMMSS(G->tlipad.BurnTime, hh, mm, secs);
 
-				sprintf(Buffer, "XXX%d:%02.0f BT", mm, secs);
-				skp->Text(3 * W / 8, 7 * H / 20, Buffer, strlen(Buffer));
+				page.Printf(3 * W / 8, 7 * H / 20, "XXX%d:%02.0f BT", mm, secs);
 
-				sprintf(Buffer, "%07.1f DVC", G->tlipad.dVC);
-				skp->Text(3 * W / 8, 8 * H / 20, Buffer, strlen(Buffer));
-				sprintf(Buffer, "%+06.0f VI", G->tlipad.VI);
-				skp->Text(3 * W / 8, 9 * H / 20, Buffer, strlen(Buffer));
+				page.Printf(3 * W / 8, 8 * H / 20, "%07.1f DVC", G->tlipad.dVC);
+				page.Printf(3 * W / 8, 9 * H / 20, "%+06.0f VI", G->tlipad.VI);
 
-				sprintf(Buffer, "XXX%03.0f R", G->tlipad.SepATT.x);
-				skp->Text(3 * W / 8, 10 * H / 20, Buffer, strlen(Buffer));
-				sprintf(Buffer, "XXX%03.0f P SEP", G->tlipad.SepATT.y);
-				skp->Text(3 * W / 8, 11 * H / 20, Buffer, strlen(Buffer));
-				sprintf(Buffer, "XXX%03.0f Y", G->tlipad.SepATT.z);
-				skp->Text(3 * W / 8, 12 * H / 20, Buffer, strlen(Buffer));
+				page.Printf(3 * W / 8, 10 * H / 20, "XXX%03.0f R", G->tlipad.SepATT.x);
+				page.Printf(3 * W / 8, 11 * H / 20, "XXX%03.0f P SEP", G->tlipad.SepATT.y);
+				page.Printf(3 * W / 8, 12 * H / 20, "XXX%03.0f Y", G->tlipad.SepATT.z);
 
-				sprintf(Buffer, "XXX%03.0f R", G->tlipad.ExtATT.x);
-				skp->Text(3 * W / 8, 13 * H / 20, Buffer, strlen(Buffer));
-				sprintf(Buffer, "XXX%03.0f P EXTRACTION", G->tlipad.ExtATT.y);
-				skp->Text(3 * W / 8, 14 * H / 20, Buffer, strlen(Buffer));
-				sprintf(Buffer, "XXX%03.0f Y", G->tlipad.ExtATT.z);
-				skp->Text(3 * W / 8, 15 * H / 20, Buffer, strlen(Buffer));
+				page.Printf(3 * W / 8, 13 * H / 20, "XXX%03.0f R", G->tlipad.ExtATT.x);
+				page.Printf(3 * W / 8, 14 * H / 20, "XXX%03.0f P EXTRACTION", G->tlipad.ExtATT.y);
+				page.Printf(3 * W / 8, 15 * H / 20, "XXX%03.0f Y", G->tlipad.ExtATT.z);
 			}
 			else
 			{
-				skp->Text(5 * W / 8, (int)(0.5 * H / 14), "PDI PAD", 7);
+				page.Text(5 * W / 8, (int)(0.5 * H / 14), "PDI PAD", 7);
 
 				if (G->HeadsUp)
 				{
-					skp->Text((int)(0.5 * W / 8), 6 * H / 14, "Heads Up", 8);
+					page.Text((int)(0.5 * W / 8), 6 * H / 14, "Heads Up", 8);
 				}
 				else
 				{
-					skp->Text((int)(0.5 * W / 8), 6 * H / 14, "Heads Down", 10);
+					page.Text((int)(0.5 * W / 8), 6 * H / 14, "Heads Down", 10);
 				}
 
-				skp->Text(4 * W / 8, 15 * H / 20, "T_L:", 4);
-				GET_Display(Buffer, GC->rtcc->CZTDTGTU.GETTD);
-				skp->Text(5 * W / 8, 15 * H / 20, Buffer, strlen(Buffer));
+				page.Text(4 * W / 8, 15 * H / 20, "T_L:", 4);
+				page.Format(5 * W / 8, 15 * H / 20, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->CZTDTGTU.GETTD, true);
 
-				skp->Text(4 * W / 8, 16 * H / 20, "Lat:", 4);
-				sprintf(Buffer, "%.3f", GC->rtcc->BZLAND.lat[RTCC_LMPOS_BEST] * DEG);
-				skp->Text(5 * W / 8, 16 * H / 20, Buffer, strlen(Buffer));
+				page.Text(4 * W / 8, 16 * H / 20, "Lat:", 4);
+				page.Printf(5 * W / 8, 16 * H / 20, "%.3f", GC->rtcc->BZLAND.lat[RTCC_LMPOS_BEST] * DEG);
 
-				skp->Text(4 * W / 8, 17 * H / 20, "Lng:", 4);
-				sprintf(Buffer, "%.3f", GC->rtcc->BZLAND.lng[RTCC_LMPOS_BEST] * DEG);
-				skp->Text(5 * W / 8, 17 * H / 20, Buffer, strlen(Buffer));
+				page.Text(4 * W / 8, 17 * H / 20, "Lng:", 4);
+				page.Printf(5 * W / 8, 17 * H / 20, "%.3f", GC->rtcc->BZLAND.lng[RTCC_LMPOS_BEST] * DEG);
 
-				skp->Text(4 * W / 8, 18 * H / 20, "Rad:", 4);
-				sprintf(Buffer, "%.2f NM", GC->rtcc->BZLAND.rad[RTCC_LMPOS_BEST] / 1852.0);
-				skp->Text(5 * W / 8, 18 * H / 20, Buffer, strlen(Buffer));
+				page.Text(4 * W / 8, 18 * H / 20, "Rad:", 4);
+				page.Printf(5 * W / 8, 18 * H / 20, "%.2f NM", GC->rtcc->BZLAND.rad[RTCC_LMPOS_BEST] / 1852.0);
 
 				if (!G->PADSolGood)
 				{
-					skp->Text(5 * W / 8, 2 * H / 14, "Calculation failed!", 19);
+					page.Text(5 * W / 8, 2 * H / 14, "Calculation failed!", 19);
 				}
 
 				int hh, mm; // ss;
@@ -1315,47 +1131,38 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 
 				SStoHHMMSS(G->pdipad.GETI, hh, mm, secs);
 
-				skp->Text(3 * W / 8, 5 * H / 20, "HRS", 3);
-				skp->Text((int)(4.5 * W / 8), 5 * H / 20, "TIG", 3);
-				sprintf(Buffer, "%+06d", hh);
-				skp->Text(6 * W / 8, 5 * H / 20, Buffer, strlen(Buffer));
+				page.Text(3 * W / 8, 5 * H / 20, "HRS", 3);
+				page.Text((int)(4.5 * W / 8), 5 * H / 20, "TIG", 3);
+				page.Printf(6 * W / 8, 5 * H / 20, "%+06d", hh);
 
-				skp->Text(3 * W / 8, 6 * H / 20, "MIN", 3);
-				skp->Text((int)(4.5 * W / 8), 6 * H / 20, "PDI", 3);
-				sprintf(Buffer, "%+06d", mm);
-				skp->Text(6 * W / 8, 6 * H / 20, Buffer, strlen(Buffer));
+				page.Text(3 * W / 8, 6 * H / 20, "MIN", 3);
+				page.Text((int)(4.5 * W / 8), 6 * H / 20, "PDI", 3);
+				page.Printf(6 * W / 8, 6 * H / 20, "%+06d", mm);
 
-				skp->Text(3 * W / 8, 7 * H / 20, "SEC", 3);
-				sprintf(Buffer, "%+06.0f", secs * 100.0);
-				skp->Text(6 * W / 8, 7 * H / 20, Buffer, strlen(Buffer));
+				page.Text(3 * W / 8, 7 * H / 20, "SEC", 3);
+				page.Printf(6 * W / 8, 7 * H / 20, "%+06.0f", secs * 100.0);
 
 				SStoHHMMSS(G->pdipad.t_go, hh, mm, secs);
-				skp->Text(3 * W / 8, 8 * H / 20, "TGO", 3);
-				skp->Text((int)(4.5 * W / 8), 8 * H / 20, "N61", 3);
-				sprintf(Buffer, "XX%02d:%02.0f", mm, secs);
-				skp->Text(6 * W / 8, 8 * H / 20, Buffer, strlen(Buffer));
+				page.Text(3 * W / 8, 8 * H / 20, "TGO", 3);
+				page.Text((int)(4.5 * W / 8), 8 * H / 20, "N61", 3);
+				page.Printf(6 * W / 8, 8 * H / 20, "XX%02d:%02.0f", mm, secs);
 
-				skp->Text(3 * W / 8, 9 * H / 20, "CROSSRANGE", 10);
-				sprintf(Buffer, "%07.1f", G->pdipad.CR);
-				skp->Text(6 * W / 8, 9 * H / 20, Buffer, strlen(Buffer));
+				page.Text(3 * W / 8, 9 * H / 20, "CROSSRANGE", 10);
+				page.Printf(6 * W / 8, 9 * H / 20, "%07.1f", G->pdipad.CR);
 
-				skp->Text(3 * W / 8, 10 * H / 20, "R", 1);
-				skp->Text((int)(4.5 * W / 8), 10 * H / 20, "FDAI", 4);
-				sprintf(Buffer, "XXX%03.0f", G->pdipad.Att.x);
-				skp->Text(6 * W / 8, 10 * H / 20, Buffer, strlen(Buffer));
+				page.Text(3 * W / 8, 10 * H / 20, "R", 1);
+				page.Text((int)(4.5 * W / 8), 10 * H / 20, "FDAI", 4);
+				page.Printf(6 * W / 8, 10 * H / 20, "XXX%03.0f", G->pdipad.Att.x);
 
-				skp->Text(3 * W / 8, 11 * H / 20, "P", 1);
-				skp->Text((int)(4.5 * W / 8), 11 * H / 20, "AT TIG", 6);
-				sprintf(Buffer, "XXX%03.0f", G->pdipad.Att.y);
-				skp->Text(6 * W / 8, 11 * H / 20, Buffer, strlen(Buffer));
+				page.Text(3 * W / 8, 11 * H / 20, "P", 1);
+				page.Text((int)(4.5 * W / 8), 11 * H / 20, "AT TIG", 6);
+				page.Printf(6 * W / 8, 11 * H / 20, "XXX%03.0f", G->pdipad.Att.y);
 
-				skp->Text(3 * W / 8, 12 * H / 20, "Y", 1);
-				sprintf(Buffer, "XXX%03.0f", G->pdipad.Att.z);
-				skp->Text(6 * W / 8, 12 * H / 20, Buffer, strlen(Buffer));
+				page.Text(3 * W / 8, 12 * H / 20, "Y", 1);
+				page.Printf(6 * W / 8, 12 * H / 20, "XXX%03.0f", G->pdipad.Att.z);
 
-				skp->Text(3 * W / 8, 13 * H / 20, "DEDA 231 IF RQD", 15);
-				sprintf(Buffer, "%+06.0f", G->pdipad.DEDA231);
-				skp->Text(6 * W / 8, 13 * H / 20, Buffer, strlen(Buffer));
+				page.Text(3 * W / 8, 13 * H / 20, "DEDA 231 IF RQD", 15);
+				page.Printf(6 * W / 8, 13 * H / 20, "%+06.0f", G->pdipad.DEDA231);
 			}
 		}
 	}
@@ -1364,232 +1171,176 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 
 		if (G->entrypadopt == 0)
 		{
-			skp->Text(5 * W / 8, (int)(0.5 * H / 14), "Earth Entry PAD", 15);
-			skp->Text(4 * W / 8, 2 * H / 20, "PREBURN", 7);
+			page.Text(5 * W / 8, (int)(0.5 * H / 14), "Earth Entry PAD", 15);
+			page.Text(4 * W / 8, 2 * H / 20, "PREBURN", 7);
 
-			sprintf(Buffer, "XX%+05.1f dV TO", G->earthentrypad.dVTO[0]);
-			skp->Text(3 * W / 8, 3 * H / 20, Buffer, strlen(Buffer));
+			page.Printf(3 * W / 8, 3 * H / 20, "XX%+05.1f dV TO", G->earthentrypad.dVTO[0]);
 
-			sprintf(Buffer, "XXX%03.0f R 0.05G", G->earthentrypad.Att400K[0].x);
-			skp->Text(3 * W / 8, 4 * H / 20, Buffer, strlen(Buffer));
-			sprintf(Buffer, "XXX%03.0f P 0.05G", G->earthentrypad.Att400K[0].y);
-			skp->Text(3 * W / 8, 5 * H / 20, Buffer, strlen(Buffer));
-			sprintf(Buffer, "XXX%03.0f Y 0.05G", G->earthentrypad.Att400K[0].z);
-			skp->Text(3 * W / 8, 6 * H / 20, Buffer, strlen(Buffer));
+			page.Printf(3 * W / 8, 4 * H / 20, "XXX%03.0f R 0.05G", G->earthentrypad.Att400K[0].x);
+			page.Printf(3 * W / 8, 5 * H / 20, "XXX%03.0f P 0.05G", G->earthentrypad.Att400K[0].y);
+			page.Printf(3 * W / 8, 6 * H / 20, "XXX%03.0f Y 0.05G", G->earthentrypad.Att400K[0].z);
 
-			sprintf(Buffer, "%+07.1f RTGO .05G", G->earthentrypad.RTGO[0]);
-			skp->Text(3 * W / 8, 7 * H / 20, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%+06.0f VIO  .05G", G->earthentrypad.VIO[0]);
-			skp->Text(3 * W / 8, 8 * H / 20, Buffer, strlen(Buffer));
+			page.Printf(3 * W / 8, 7 * H / 20, "%+07.1f RTGO .05G", G->earthentrypad.RTGO[0]);
+			page.Printf(3 * W / 8, 8 * H / 20, "%+06.0f VIO  .05G", G->earthentrypad.VIO[0]);
 
 			double secs;
 			int mm, hh;
 
 			SStoHHMMSS(G->earthentrypad.Ret05[0], hh, mm, secs);
 
-			sprintf(Buffer, "XX%02d:%02.0f RET  .05G", mm, secs);
-			skp->Text(3 * W / 8, 9 * H / 20, Buffer, strlen(Buffer));
+			page.Printf(3 * W / 8, 9 * H / 20, "XX%02d:%02.0f RET  .05G", mm, secs);
 
-			sprintf(Buffer, "%+07.2f LAT", G->earthentrypad.Lat[0]);
-			skp->Text(3 * W / 8, 10 * H / 20, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%+07.2f LONG", G->earthentrypad.Lng[0]);
-			skp->Text(3 * W / 8, 11 * H / 20, Buffer, strlen(Buffer));
+			page.Printf(3 * W / 8, 10 * H / 20, "%+07.2f LAT", G->earthentrypad.Lat[0]);
+			page.Printf(3 * W / 8, 11 * H / 20, "%+07.2f LONG", G->earthentrypad.Lng[0]);
 
-			skp->Text(4 * W / 8, 12 * H / 20, "POSTBURN", 8);
+			page.Text(4 * W / 8, 12 * H / 20, "POSTBURN", 8);
 
-			sprintf(Buffer, "XXX%03.0f R 0.05G", G->earthentrypad.PB_R400K[0]);
-			skp->Text(3 * W / 8, 13 * H / 20, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%+07.1f RTGO .05G", G->earthentrypad.PB_RTGO[0]);
-			skp->Text(3 * W / 8, 14 * H / 20, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%+06.0f VIO  .05G", G->earthentrypad.PB_VIO[0]);
-			skp->Text(3 * W / 8, 15 * H / 20, Buffer, strlen(Buffer));
+			page.Printf(3 * W / 8, 13 * H / 20, "XXX%03.0f R 0.05G", G->earthentrypad.PB_R400K[0]);
+			page.Printf(3 * W / 8, 14 * H / 20, "%+07.1f RTGO .05G", G->earthentrypad.PB_RTGO[0]);
+			page.Printf(3 * W / 8, 15 * H / 20, "%+06.0f VIO  .05G", G->earthentrypad.PB_VIO[0]);
 
 			SStoHHMMSS(G->earthentrypad.PB_Ret05[0], hh, mm, secs);
 
-			sprintf(Buffer, "XX%02d:%02.0f RET  .05G", mm, secs);
-			skp->Text(3 * W / 8, 16 * H / 20, Buffer, strlen(Buffer));
+			page.Printf(3 * W / 8, 16 * H / 20, "XX%02d:%02.0f RET  .05G", mm, secs);
 		}
 		else
 		{
-			skp->Text(5 * W / 8, (int)(0.5 * H / 14), "Lunar Entry PAD", 15);
+			page.Text(5 * W / 8, (int)(0.5 * H / 14), "Lunar Entry PAD", 15);
 
 			if (G->entryrange != 0)
 			{
-				skp->Text((int)(0.5 * W / 8), 6 * H / 14, "Desired Range:", 14);
-				sprintf(Buffer, "%.1f NM", G->entryrange);
-				skp->Text((int)(0.5 * W / 8), 7 * H / 14, Buffer, strlen(Buffer));
+				page.Text((int)(0.5 * W / 8), 6 * H / 14, "Desired Range:", 14);
+				page.Printf((int)(0.5 * W / 8), 7 * H / 14, "%.1f NM", G->entryrange);
 			}
 
-			sprintf(Buffer, "XXX%03.0f R 0.05G", G->lunarentrypad.Att05[0].x);
-			skp->Text(3 * W / 8, 2 * H / 21, Buffer, strlen(Buffer));
-			sprintf(Buffer, "XXX%03.0f P 0.05G", G->lunarentrypad.Att05[0].y);
-			skp->Text(3 * W / 8, 3 * H / 21, Buffer, strlen(Buffer));
-			sprintf(Buffer, "XXX%03.0f Y 0.05G", G->lunarentrypad.Att05[0].z);
-			skp->Text(3 * W / 8, 4 * H / 21, Buffer, strlen(Buffer));
+			page.Printf(3 * W / 8, 2 * H / 21, "XXX%03.0f R 0.05G", G->lunarentrypad.Att05[0].x);
+			page.Printf(3 * W / 8, 3 * H / 21, "XXX%03.0f P 0.05G", G->lunarentrypad.Att05[0].y);
+			page.Printf(3 * W / 8, 4 * H / 21, "XXX%03.0f Y 0.05G", G->lunarentrypad.Att05[0].z);
 
-			GET_Display(Buffer, G->lunarentrypad.GETHorCheck[0]);
-			skp->Text(3 * W / 8, 5 * H / 21, Buffer, strlen(Buffer));
-			sprintf(Buffer, "XXX%03.0f P HOR CK", G->lunarentrypad.PitchHorCheck[0]);
-			skp->Text(3 * W / 8, 6 * H / 21, Buffer, strlen(Buffer));
+			page.Format(3 * W / 8, 5 * H / 21, this, &ApolloRTCCMFD::GET_Display, G->lunarentrypad.GETHorCheck[0], true);
+			page.Printf(3 * W / 8, 6 * H / 21, "XXX%03.0f P HOR CK", G->lunarentrypad.PitchHorCheck[0]);
 
-			sprintf(Buffer, "%+07.2f LAT", G->lunarentrypad.Lat[0]);
-			skp->Text(3 * W / 8, 7 * H / 21, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%+07.2f LONG", G->lunarentrypad.Lng[0]);
-			skp->Text(3 * W / 8, 8 * H / 21, Buffer, strlen(Buffer));
+			page.Printf(3 * W / 8, 7 * H / 21, "%+07.2f LAT", G->lunarentrypad.Lat[0]);
+			page.Printf(3 * W / 8, 8 * H / 21, "%+07.2f LONG", G->lunarentrypad.Lng[0]);
 
-			sprintf(Buffer, "XXX%04.1f MAX G", G->lunarentrypad.MaxG[0]);
-			skp->Text(3 * W / 8, 9 * H / 21, Buffer, strlen(Buffer));
+			page.Printf(3 * W / 8, 9 * H / 21, "XXX%04.1f MAX G", G->lunarentrypad.MaxG[0]);
 
-			sprintf(Buffer, "%+06.0f V400k", G->lunarentrypad.V400K[0]);
-			skp->Text(3 * W / 8, 10 * H / 21, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%+07.2f y400k", G->lunarentrypad.Gamma400K[0]);
-			skp->Text(3 * W / 8, 11 * H / 21, Buffer, strlen(Buffer));
+			page.Printf(3 * W / 8, 10 * H / 21, "%+06.0f V400k", G->lunarentrypad.V400K[0]);
+			page.Printf(3 * W / 8, 11 * H / 21, "%+07.2f y400k", G->lunarentrypad.Gamma400K[0]);
 
-			sprintf(Buffer, "%+07.1f RTGO .05G", G->lunarentrypad.RTGO[0]);
-			skp->Text(3 * W / 8, 12 * H / 21, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%+06.0f VIO  .05G", G->lunarentrypad.VIO[0]);
-			skp->Text(3 * W / 8, 13 * H / 21, Buffer, strlen(Buffer));
+			page.Printf(3 * W / 8, 12 * H / 21, "%+07.1f RTGO .05G", G->lunarentrypad.RTGO[0]);
+			page.Printf(3 * W / 8, 13 * H / 21, "%+06.0f VIO  .05G", G->lunarentrypad.VIO[0]);
 
 			GET_Display(Buffer, G->lunarentrypad.RRT[0]);
 			sprintf(Buffer, "%s RRT", Buffer);
-			skp->Text(3 * W / 8, 14 * H / 21, Buffer, strlen(Buffer));
+			page.Text(3 * W / 8, 14 * H / 21, Buffer, strlen(Buffer));
 
 			double secs;
 			int mm, hh;
 
 			SStoHHMMSS(G->lunarentrypad.RET05[0], hh, mm, secs);
 
-			sprintf(Buffer, "XX%02d:%02.0f RET  .05G", mm, secs);
-			skp->Text(3 * W / 8, 15 * H / 21, Buffer, strlen(Buffer));
+			page.Printf(3 * W / 8, 15 * H / 21, "XX%02d:%02.0f RET  .05G", mm, secs);
 
-			sprintf(Buffer, "XXX%04.2f DO", G->lunarentrypad.DO[0]);
-			skp->Text(3 * W / 8, 16 * H / 21, Buffer, strlen(Buffer));
+			page.Printf(3 * W / 8, 16 * H / 21, "XXX%04.2f DO", G->lunarentrypad.DO[0]);
 
 			if (G->lunarentrypad.SXTS[0] == 0)
 			{
-				sprintf(Buffer, "N/A     SXTS");
-				skp->Text(3 * W / 8, 17 * H / 21, Buffer, strlen(Buffer));
-				sprintf(Buffer, "N/A     SFT");
-				skp->Text(3 * W / 8, 18 * H / 21, Buffer, strlen(Buffer));
-				sprintf(Buffer, "N/A     TRN");
-				skp->Text(3 * W / 8, 19 * H / 21, Buffer, strlen(Buffer));
+				page.Printf(3 * W / 8, 17 * H / 21, "N/A     SXTS");
+				page.Printf(3 * W / 8, 18 * H / 21, "N/A     SFT");
+				page.Printf(3 * W / 8, 19 * H / 21, "N/A     TRN");
 			}
 			else
 			{
-				sprintf(Buffer, "XXXX%02d SXTS", G->lunarentrypad.SXTS[0]);
-				skp->Text(3 * W / 8, 17 * H / 21, Buffer, strlen(Buffer));
-				sprintf(Buffer, "%+07.2f SFT", G->lunarentrypad.SFT[0]);
-				skp->Text(3 * W / 8, 18 * H / 21, Buffer, strlen(Buffer));
-				sprintf(Buffer, "%+07.3f TRN", G->lunarentrypad.TRN[0]);
-				skp->Text(3 * W / 8, 19 * H / 21, Buffer, strlen(Buffer));
+				page.Printf(3 * W / 8, 17 * H / 21, "XXXX%02d SXTS", G->lunarentrypad.SXTS[0]);
+				page.Printf(3 * W / 8, 18 * H / 21, "%+07.2f SFT", G->lunarentrypad.SFT[0]);
+				page.Printf(3 * W / 8, 19 * H / 21, "%+07.3f TRN", G->lunarentrypad.TRN[0]);
 			}
 
-			sprintf(Buffer, "XXXX%s LIFT VECTOR", G->lunarentrypad.LiftVector[0]);
-			skp->Text(3 * W / 8, 20 * H / 21, Buffer, strlen(Buffer));
+			page.Printf(3 * W / 8, 20 * H / 21, "XXXX%s LIFT VECTOR", G->lunarentrypad.LiftVector[0]);
 		}
 	}
 	else if (screen == 11)
 	{
 		char Buffer2[100];
 
-		skp->Text(6 * W / 8, (int)(0.5 * H / 14), "Map Update", 10);
+		page.Text(6 * W / 8, (int)(0.5 * H / 14), "Map Update", 10);
 
-		GET_Display(Buffer, G->mapUpdateGET);
-		skp->Text(1 * W / 8, 2 * H / 14, Buffer, strlen(Buffer));
+		page.Format(1 * W / 8, 2 * H / 14, this, &ApolloRTCCMFD::GET_Display, G->mapUpdateGET, true);
 
 		if (G->mappage == 0)
 		{
-			skp->Text(6 * W / 8, 4 * H / 14, "Earth", 5);
+			page.Text(6 * W / 8, 4 * H / 14, "Earth", 5);
 
 			sprintf(Buffer, gsnames[G->mapgs]);
-			skp->Text(1 * W / 8, 4 * H / 14, Buffer, strlen(Buffer));
+			page.Text(1 * W / 8, 4 * H / 14, Buffer, strlen(Buffer));
 
 			GET_Display(Buffer2, G->GSAOSGET);
-			sprintf(Buffer, "AOS %s", Buffer2);
-			skp->Text(1 * W / 8, 6 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(1 * W / 8, 6 * H / 14, "AOS %s", Buffer2);
 
 			GET_Display(Buffer2, G->GSLOSGET);
-			sprintf(Buffer, "LOS %s", Buffer2);
-			skp->Text(1 * W / 8, 7 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(1 * W / 8, 7 * H / 14, "LOS %s", Buffer2);
 		}
 		else if (G->mappage == 1)
 		{
-			skp->Text(6 * W / 8, 4 * H / 14, "Moon", 4);
+			page.Text(6 * W / 8, 4 * H / 14, "Moon", 4);
 
 			GET_Display(Buffer2, G->mapupdate.LOSGET);
-			sprintf(Buffer, "LOS %s", Buffer2);
-			skp->Text(1 * W / 8, 4 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(1 * W / 8, 4 * H / 14, "LOS %s", Buffer2);
 
 			GET_Display(Buffer2, G->mapupdate.SRGET);
-			sprintf(Buffer, "SR  %s", Buffer2);
-			skp->Text(1 * W / 8, 5 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(1 * W / 8, 5 * H / 14, "SR  %s", Buffer2);
 
 			GET_Display(Buffer2, G->mapupdate.PMGET);
-			sprintf(Buffer, "PM  %s", Buffer2);
-			skp->Text(1 * W / 8, 6 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(1 * W / 8, 6 * H / 14, "PM  %s", Buffer2);
 
 			GET_Display(Buffer2, G->mapupdate.AOSGET);
-			sprintf(Buffer, "AOS %s", Buffer2);
-			skp->Text(1 * W / 8, 7 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(1 * W / 8, 7 * H / 14, "AOS %s", Buffer2);
 
 			GET_Display(Buffer2, G->mapupdate.SSGET);
-			sprintf(Buffer, "SS  %s", Buffer2);
-			skp->Text(1 * W / 8, 8 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(1 * W / 8, 8 * H / 14, "SS  %s", Buffer2);
 		}
 	}
 	else if (screen == 12)
 	{
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
-		skp->Text(5 * W / 8, (int)(0.5 * H / 14), "LOI Computation (MED K18)", 25);
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
+		page.Text(5 * W / 8, (int)(0.5 * H / 14), "LOI Computation (MED K18)", 25);
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
 
-		skp->Text(1 * W / 8, 2 * H / 14, "LOI Initialization", 18);
+		page.Text(1 * W / 8, 2 * H / 14, "LOI Initialization", 18);
 
 		if (GC->MissionPlanningActive)
 		{
-			GET_Display(Buffer, GC->rtcc->med_k18.VectorTime);
-			skp->Text(1 * W / 8, 4 * H / 14, Buffer, strlen(Buffer));
+			page.Format(1 * W / 8, 4 * H / 14, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->med_k18.VectorTime, true);
 		}
 
-		sprintf(Buffer, "%.1lf NM", GC->rtcc->med_k18.HALOI1);
-		skp->Text(1 * W / 8, 6 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(1 * W / 8, 6 * H / 14, "%.1lf NM", GC->rtcc->med_k18.HALOI1);
 
-		sprintf(Buffer, "%.1lf NM", GC->rtcc->med_k18.HPLOI1);
-		skp->Text(1 * W / 8, 8 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(1 * W / 8, 8 * H / 14, "%.1lf NM", GC->rtcc->med_k18.HPLOI1);
 
-		sprintf(Buffer, "%.0lf ft/s", GC->rtcc->med_k18.DVMAXp);
-		skp->Text(1 * W / 8, 10 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(1 * W / 8, 10 * H / 14, "%.0lf ft/s", GC->rtcc->med_k18.DVMAXp);
 
-		sprintf(Buffer, "%.0lf ft/s", GC->rtcc->med_k18.DVMAXm);
-		skp->Text(1 * W / 8, 12 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(1 * W / 8, 12 * H / 14, "%.0lf ft/s", GC->rtcc->med_k18.DVMAXm);
 
-		sprintf(Buffer, "%.1f", GC->rtcc->med_k18.psi_MN);
-		skp->Text(5 * W / 8, 4 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(5 * W / 8, 4 * H / 14, "%.1f", GC->rtcc->med_k18.psi_MN);
 
-		sprintf(Buffer, "%.1f", GC->rtcc->med_k18.psi_DS);
-		skp->Text(5 * W / 8, 6 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(5 * W / 8, 6 * H / 14, "%.1f", GC->rtcc->med_k18.psi_DS);
 
-		sprintf(Buffer, "%.1f", GC->rtcc->med_k18.psi_MX);
-		skp->Text(5 * W / 8, 8 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(5 * W / 8, 8 * H / 14, "%.1f", GC->rtcc->med_k18.psi_MX);
 	}
 	else if (screen == 13)
 	{
 		char Buffer2[100];
-		skp->Text(5 * W / 8, (int)(0.5 * H / 14), "Landmark Tracking", 17);
+		page.Text(5 * W / 8, (int)(0.5 * H / 14), "Landmark Tracking", 17);
 
-		GET_Display(Buffer, G->LmkTime);
-		skp->Text(1 * W / 8, 2 * H / 14, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%.3f", G->LmkLat*DEG);
-		skp->Text(1 * W / 8, 4 * H / 14, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%.3f", G->LmkLng*DEG);
-		skp->Text(1 * W / 8, 6 * H / 14, Buffer, strlen(Buffer));
+		page.Format(1 * W / 8, 2 * H / 14, this, &ApolloRTCCMFD::GET_Display, G->LmkTime, true);
+		page.Printf(1 * W / 8, 4 * H / 14, "%.3f", G->LmkLat*DEG);
+		page.Printf(1 * W / 8, 6 * H / 14, "%.3f", G->LmkLng*DEG);
 
 		GET_Display(Buffer2, G->landmarkpad.T1[0]);
-		sprintf(Buffer, "T1: %s (HOR)", Buffer2);
-		skp->Text(4 * W / 8, 6 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(4 * W / 8, 6 * H / 14, "T1: %s (HOR)", Buffer2);
 		GET_Display(Buffer2, G->landmarkpad.T2[0]);
-		sprintf(Buffer, "T2: %s (35)", Buffer2);
-		skp->Text(4 * W / 8, 7 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(4 * W / 8, 7 * H / 14, "T2: %s (35)", Buffer2);
 
 		if (G->landmarkpad.CRDist[0] > 0)
 		{
@@ -1600,52 +1351,50 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			sprintf(Buffer, "%.1f NM South", abs(G->landmarkpad.CRDist[0]));
 		}
 
-		skp->Text(4 * W / 8, 8 * H / 14, Buffer, strlen(Buffer));
-		skp->Text(4 * W / 8, 9 * H / 14, "N89", 3);
-		sprintf(Buffer, "Lat %+07.3f", G->landmarkpad.Lat[0]);
-		skp->Text(4 * W / 8, 10 * H / 14, Buffer, strlen(Buffer));
-		sprintf(Buffer, "Long/2 %+07.3f", G->landmarkpad.Lng05[0]);
-		skp->Text(4 * W / 8, 11 * H / 14, Buffer, strlen(Buffer));
+		page.Text(4 * W / 8, 8 * H / 14, Buffer, strlen(Buffer));
+		page.Text(4 * W / 8, 9 * H / 14, "N89", 3);
+		page.Printf(4 * W / 8, 10 * H / 14, "Lat %+07.3f", G->landmarkpad.Lat[0]);
+		page.Printf(4 * W / 8, 11 * H / 14, "Long/2 %+07.3f", G->landmarkpad.Lng05[0]);
 		sprintf(Buffer, "Alt %+07.2f NM", G->landmarkpad.Alt[0]);
-		skp->Text(4 * W / 8, 12 * H / 14, Buffer, strlen(Buffer));
+		page.Text(4 * W / 8, 12 * H / 14, Buffer, strlen(Buffer));
 	}
 	else if (screen == 14)
 	{
 		if (G->vesseltype < 2)
 		{
-			skp->Text(7 * W / 8, (int)(0.5 * H / 14), "CSM", 3);
+			page.Text(7 * W / 8, (int)(0.5 * H / 14), "CSM", 3);
 		}
 		else if (G->vesseltype < 4)
 		{
-			skp->Text(7 * W / 8, (int)(0.5 * H / 14), "LM", 2);
+			page.Text(7 * W / 8, (int)(0.5 * H / 14), "LM", 2);
 		}
 		else
 		{
-			skp->Text(7 * W / 8, (int)(0.5 * H / 14), "MCC", 3);
+			page.Text(7 * W / 8, (int)(0.5 * H / 14), "MCC", 3);
 		}
 
-		skp->Text(1 * W / 16, 2 * H / 14, "Rendezvous", 10);
-		skp->Text(1 * W / 16, 4 * H / 14, "General Purpose Maneuver", 24);
-		skp->Text(1 * W / 16, 6 * H / 14, "TLI Planning", 12);
-		skp->Text(1 * W / 16, 8 * H / 14, "Midcourse", 9);
-		skp->Text(1 * W / 16, 10 * H / 14, "Lunar Insertion", 15);
-		skp->Text(1 * W / 16, 12 * H / 14, "Entry", 5);
+		page.Text(1 * W / 16, 2 * H / 14, "Rendezvous", 10);
+		page.Text(1 * W / 16, 4 * H / 14, "General Purpose Maneuver", 24);
+		page.Text(1 * W / 16, 6 * H / 14, "TLI Planning", 12);
+		page.Text(1 * W / 16, 8 * H / 14, "Midcourse", 9);
+		page.Text(1 * W / 16, 10 * H / 14, "Lunar Insertion", 15);
+		page.Text(1 * W / 16, 12 * H / 14, "Entry", 5);
 
-		skp->Text(5 * W / 8, 2 * H / 14, "Descent Planning", 16);
-		skp->Text(5 * W / 8, 4 * H / 14, "LLWP", 4);
-		skp->Text(5 * W / 8, 6 * H / 14, "LLTP", 4);
-		skp->Text(5 * W / 8, 8 * H / 14, "Lunar Ascent", 12);
-		skp->Text(5 * W / 8, 12 * H / 14, "Previous Page", 13);
+		page.Text(5 * W / 8, 2 * H / 14, "Descent Planning", 16);
+		page.Text(5 * W / 8, 4 * H / 14, "LLWP", 4);
+		page.Text(5 * W / 8, 6 * H / 14, "LLTP", 4);
+		page.Text(5 * W / 8, 8 * H / 14, "Lunar Ascent", 12);
+		page.Text(5 * W / 8, 12 * H / 14, "Previous Page", 13);
 	}
 	else if (screen == 15)
 	{
 		if (G->VECoption == 0)
 		{
-			skp->Text(1 * W / 8, 2 * H / 14, "Point SC at body", 16);
+			page.Text(1 * W / 8, 2 * H / 14, "Point SC at body", 16);
 		}
 		else
 		{
-			skp->Text(1 * W / 8, 2 * H / 14, "Open hatch thermal control", 26);
+			page.Text(1 * W / 8, 2 * H / 14, "Open hatch thermal control", 26);
 		}
 
 		if (G->VECoption == 0)
@@ -1653,461 +1402,405 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			if (G->VECbody != NULL)
 			{
 				oapiGetObjectName(G->VECbody, Buffer, 20);
-				skp->Text(1 * W / 8, 4 * H / 14, Buffer, strlen(Buffer));
+				page.Text(1 * W / 8, 4 * H / 14, Buffer, strlen(Buffer));
 			}
 
 			if (G->VECdirection == 0)
 			{
-				skp->Text(1 * W / 8, 6 * H / 14, "+X", 2);
+				page.Text(1 * W / 8, 6 * H / 14, "+X", 2);
 			}
 			else if (G->VECdirection == 1)
 			{
-				skp->Text(1 * W / 8, 6 * H / 14, "-X", 2);
+				page.Text(1 * W / 8, 6 * H / 14, "-X", 2);
 			}
 			else if (G->VECdirection == 2)
 			{
-				skp->Text(1 * W / 8, 6 * H / 14, "+Y", 2);
+				page.Text(1 * W / 8, 6 * H / 14, "+Y", 2);
 			}
 			else if (G->VECdirection == 3)
 			{
-				skp->Text(1 * W / 8, 6 * H / 14, "-Y", 2);
+				page.Text(1 * W / 8, 6 * H / 14, "-Y", 2);
 			}
 			else if (G->VECdirection == 4)
 			{
-				skp->Text(1 * W / 8, 6 * H / 14, "+Z", 2);
+				page.Text(1 * W / 8, 6 * H / 14, "+Z", 2);
 			}
 			else if (G->VECdirection == 5)
 			{
-				skp->Text(1 * W / 8, 6 * H / 14, "-Z", 2);
+				page.Text(1 * W / 8, 6 * H / 14, "-Z", 2);
 			}
 		}
 
-		sprintf(Buffer, "%+07.2f R", G->VECangles.x*DEG);
-		skp->Text(6 * W / 8, 10 * H / 14, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%+07.2f P", G->VECangles.y*DEG);
-		skp->Text(6 * W / 8, 11 * H / 14, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%+07.2f Y", G->VECangles.z*DEG);
-		skp->Text(6 * W / 8, 12 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(6 * W / 8, 10 * H / 14, "%+07.2f R", G->VECangles.x*DEG);
+		page.Printf(6 * W / 8, 11 * H / 14, "%+07.2f P", G->VECangles.y*DEG);
+		page.Printf(6 * W / 8, 12 * H / 14, "%+07.2f Y", G->VECangles.z*DEG);
 	}
 	else if (screen == 16)
 	{
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
-		skp->Text(4 * W / 8, 1 * H / 14, "Computation for Lunar Descent Planning (K16)", 44);
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
+		page.Text(4 * W / 8, 1 * H / 14, "Computation for Lunar Descent Planning (K16)", 44);
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
 
-		skp->Text(1 * W / 16, 2 * H / 14, "Init", 4);
+		page.Text(1 * W / 16, 2 * H / 14, "Init", 4);
 
 		if (GC->MissionPlanningActive)
 		{
 			if (GC->rtcc->med_k16.Vehicle == RTCC_MPT_LM)
 			{
-				skp->Text(1 * W / 16, 4 * H / 14, "LEM", 3);
+				page.Text(1 * W / 16, 4 * H / 14, "LEM", 3);
 			}
 			else
 			{
-				skp->Text(1 * W / 16, 4 * H / 14, "CSM", 3);
+				page.Text(1 * W / 16, 4 * H / 14, "CSM", 3);
 			}
 
-			GET_Display(Buffer, GC->rtcc->med_k16.VectorTime, false);
-			skp->Text(1 * W / 16, 6 * H / 14, Buffer, strlen(Buffer));
+			page.Format(1 * W / 16, 6 * H / 14, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->med_k16.VectorTime, false);
 		}
 
 		if (GC->rtcc->med_k16.Mode == 1)
 		{
-			skp->Text(1 * W / 16, 8 * H / 14, "CSM Phase Change", 16);
+			page.Text(1 * W / 16, 8 * H / 14, "CSM Phase Change", 16);
 
 			if (GC->rtcc->med_k16.Sequence == 1)
 			{
-				skp->Text(1 * W / 16, 10 * H / 14, "1: PC, DOI", 10);
+				page.Text(1 * W / 16, 10 * H / 14, "1: PC, DOI", 10);
 			}
 			else if (GC->rtcc->med_k16.Sequence == 2)
 			{
-				skp->Text(1 * W / 16, 10 * H / 14, "2: PCC, DOI", 11);
+				page.Text(1 * W / 16, 10 * H / 14, "2: PCC, DOI", 11);
 			}
 			else if (GC->rtcc->med_k16.Sequence == 3)
 			{
-				skp->Text(1 * W / 16, 10 * H / 14, "3: ASP, CIA, DOI", 16);
+				page.Text(1 * W / 16, 10 * H / 14, "3: ASP, CIA, DOI", 16);
 			}
 			else if (GC->rtcc->med_k16.Sequence == 4)
 			{
-				skp->Text(1 * W / 16, 10 * H / 14, "4: PCCH, DOI", 12);
+				page.Text(1 * W / 16, 10 * H / 14, "4: PCCH, DOI", 12);
 			}
 			else if (GC->rtcc->med_k16.Sequence == 5)
 			{
-				skp->Text(1 * W / 16, 10 * H / 14, "5: PCCT, DOI", 12);
+				page.Text(1 * W / 16, 10 * H / 14, "5: PCCT, DOI", 12);
 			}
 		}
 		else if (GC->rtcc->med_k16.Mode == 2)
 		{
-			skp->Text(1 * W / 16, 8 * H / 14, "Single CSM Maneuver", 19);
+			page.Text(1 * W / 16, 8 * H / 14, "Single CSM Maneuver", 19);
 
 			if (GC->rtcc->med_k16.Sequence == 2)
 			{
-				skp->Text(1 * W / 16, 10 * H / 14, "2: ASH, DOI", 11);
+				page.Text(1 * W / 16, 10 * H / 14, "2: ASH, DOI", 11);
 			}
 			else if (GC->rtcc->med_k16.Sequence == 3)
 			{
-				skp->Text(1 * W / 16, 10 * H / 14, "3: CIR, DOI", 11);
+				page.Text(1 * W / 16, 10 * H / 14, "3: CIR, DOI", 11);
 			}
 			else
 			{
-				sprintf(Buffer, "%d: Not Used", GC->rtcc->med_k16.Sequence);
-				skp->Text(1 * W / 16, 10 * H / 14, Buffer, strlen(Buffer));
+				page.Printf(1 * W / 16, 10 * H / 14, "%d: Not Used", GC->rtcc->med_k16.Sequence);
 			}
 		}
 		else if (GC->rtcc->med_k16.Mode == 3)
 		{
-			skp->Text(1 * W / 16, 8 * H / 14, "Double CSM Maneuver", 19);
+			page.Text(1 * W / 16, 8 * H / 14, "Double CSM Maneuver", 19);
 
 			if (GC->rtcc->med_k16.Sequence == 1)
 			{
-				skp->Text(1 * W / 16, 10 * H / 14, "1: ASH at time, CIA, DOI", 24);
+				page.Text(1 * W / 16, 10 * H / 14, "1: ASH at time, CIA, DOI", 24);
 			}
 			else if (GC->rtcc->med_k16.Sequence == 3)
 			{
-				skp->Text(1 * W / 16, 10 * H / 14, "3: ASH at apsis, CIA, DOI", 25);
+				page.Text(1 * W / 16, 10 * H / 14, "3: ASH at apsis, CIA, DOI", 25);
 			}
 			else
 			{
-				sprintf(Buffer, "%d: Not Used", GC->rtcc->med_k16.Sequence);
-				skp->Text(1 * W / 16, 10 * H / 14, Buffer, strlen(Buffer));
+				page.Printf(1 * W / 16, 10 * H / 14, "%d: Not Used", GC->rtcc->med_k16.Sequence);
 			}
 		}
 		else if (GC->rtcc->med_k16.Mode == 4)
 		{
-			skp->Text(1 * W / 16, 8 * H / 14, "LM Maneuver Sequence", 20);
-			skp->Text(1 * W / 16, 10 * H / 14, "DOI", 3);
+			page.Text(1 * W / 16, 8 * H / 14, "LM Maneuver Sequence", 20);
+			page.Text(1 * W / 16, 10 * H / 14, "DOI", 3);
 		}
 		else if (GC->rtcc->med_k16.Mode == 5)
 		{
-			skp->Text(1 * W / 16, 8 * H / 14, "Double Hohmann, PC", 28);
+			page.Text(1 * W / 16, 8 * H / 14, "Double Hohmann, PC", 28);
 
 			if (GC->rtcc->med_k16.Sequence == 1)
 			{
-				skp->Text(1 * W / 16, 10 * H / 14, "1: PC, HO1, HO2, DOI", 20);
+				page.Text(1 * W / 16, 10 * H / 14, "1: PC, HO1, HO2, DOI", 20);
 			}
 			else if (GC->rtcc->med_k16.Sequence == 2)
 			{
-				skp->Text(1 * W / 16, 10 * H / 14, "2: HO1, PC, HO2, DOI", 20);
+				page.Text(1 * W / 16, 10 * H / 14, "2: HO1, PC, HO2, DOI", 20);
 			}
 			else if (GC->rtcc->med_k16.Sequence == 3)
 			{
-				skp->Text(1 * W / 16, 10 * H / 14, "3: HO1, HO2, PC, DOI", 20);
+				page.Text(1 * W / 16, 10 * H / 14, "3: HO1, HO2, PC, DOI", 20);
 			}
 			else
 			{
-				sprintf(Buffer, "%d: Not Used", GC->rtcc->med_k16.Sequence);
-				skp->Text(1 * W / 16, 10 * H / 14, Buffer, strlen(Buffer));
+				page.Printf(1 * W / 16, 10 * H / 14, "%d: Not Used", GC->rtcc->med_k16.Sequence);
 			}
 		}
 		else if (GC->rtcc->med_k16.Mode == 6)
 		{
-			skp->Text(1 * W / 16, 8 * H / 14, "LM Powered Descent (N/A)", 24);
+			page.Text(1 * W / 16, 8 * H / 14, "LM Powered Descent (N/A)", 24);
 		}
 		else if (GC->rtcc->med_k16.Mode == 7)
 		{
-			skp->Text(1 * W / 16, 8 * H / 14, "CSM Prelaunch Plane Change", 26);
-			skp->Text(1 * W / 16, 10 * H / 14, "PPC", 3);
+			page.Text(1 * W / 16, 8 * H / 14, "CSM Prelaunch Plane Change", 26);
+			page.Text(1 * W / 16, 10 * H / 14, "PPC", 3);
 		}
 
-		sprintf(Buffer, "%.3f NM", GC->rtcc->med_k16.DesiredHeight / 1852.0);
-		skp->Text(1 * W / 16, 12 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(1 * W / 16, 12 * H / 14, "%.3f NM", GC->rtcc->med_k16.DesiredHeight / 1852.0);
 
-		GET_Display(Buffer, GC->rtcc->med_k16.GETTH1, false);
-		skp->Text(5 * W / 8, 2 * H / 14, Buffer, strlen(Buffer));
-		GET_Display(Buffer, GC->rtcc->med_k16.GETTH2, false);
-		skp->Text(5 * W / 8, 4 * H / 14, Buffer, strlen(Buffer));
-		GET_Display(Buffer, GC->rtcc->med_k16.GETTH3, false);
-		skp->Text(5 * W / 8, 6 * H / 14, Buffer, strlen(Buffer));
-		GET_Display(Buffer, GC->rtcc->med_k16.GETTH4, false);
-		skp->Text(5 * W / 8, 8 * H / 14, Buffer, strlen(Buffer));
+		page.Format(5 * W / 8, 2 * H / 14, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->med_k16.GETTH1, false);
+		page.Format(5 * W / 8, 4 * H / 14, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->med_k16.GETTH2, false);
+		page.Format(5 * W / 8, 6 * H / 14, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->med_k16.GETTH3, false);
+		page.Format(5 * W / 8, 8 * H / 14, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->med_k16.GETTH4, false);
 	}
 	else if (screen == 17)
 	{
-		skp->Text(5 * W / 8, (int)(0.5 * H / 14), "Skylab Rendezvous", 17);
+		page.Text(5 * W / 8, (int)(0.5 * H / 14), "Skylab Rendezvous", 17);
 
 		if (G->target != NULL)
 		{
 			sprintf(Buffer, G->target->GetName());
-			skp->Text(5 * W / 8, 2 * H / 14, Buffer, strlen(Buffer));
+			page.Text(5 * W / 8, 2 * H / 14, Buffer, strlen(Buffer));
 		}
 
 		if (G->Skylabmaneuver != 0)
 		{
-			skp->Text(4 * W / 8, 16 * H / 21, "TIG", 3);
-			GET_Display(Buffer, G->P30TIG);
-			skp->Text(5 * W / 8, 16 * H / 21, Buffer, strlen(Buffer));
+			page.Text(4 * W / 8, 16 * H / 21, "TIG", 3);
+			page.Format(5 * W / 8, 16 * H / 21, this, &ApolloRTCCMFD::GET_Display, G->P30TIG, true);
 
-			sprintf(Buffer, "%+07.1f", G->dV_LVLH.x / 0.3048);
-			skp->Text(5 * W / 8, 17 * H / 21, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%+07.1f", G->dV_LVLH.y / 0.3048);
-			skp->Text(5 * W / 8, 18 * H / 21, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%+07.1f", G->dV_LVLH.z / 0.3048);
-			skp->Text(5 * W / 8, 19 * H / 21, Buffer, strlen(Buffer));
+			page.Printf(5 * W / 8, 17 * H / 21, "%+07.1f", G->dV_LVLH.x / 0.3048);
+			page.Printf(5 * W / 8, 18 * H / 21, "%+07.1f", G->dV_LVLH.y / 0.3048);
+			page.Printf(5 * W / 8, 19 * H / 21, "%+07.1f", G->dV_LVLH.z / 0.3048);
 		}
 
 		if (G->Skylabmaneuver < 7)
 		{
-			skp->Text(4 * W / 8, 5 * H / 21, "TPI", 3);
-			GET_Display(Buffer, G->t_TPI);
-			skp->Text(5 * W / 8, 5 * H / 21, Buffer, strlen(Buffer));
+			page.Text(4 * W / 8, 5 * H / 21, "TPI", 3);
+			page.Format(5 * W / 8, 5 * H / 21, this, &ApolloRTCCMFD::GET_Display, G->t_TPI, true);
 		}
 
 		if (!G->SkylabSolGood)
 		{
-			skp->Text(3 * W / 8, 7 * H / 14, "Calculation failed!", 19);
+			page.Text(3 * W / 8, 7 * H / 14, "Calculation failed!", 19);
 		}
 
 		if (G->Skylabmaneuver == 0)
 		{
-			skp->Text(1 * W / 8, 2 * H / 14, "TPI Search", 10);
+			page.Text(1 * W / 8, 2 * H / 14, "TPI Search", 10);
 
-			GET_Display(Buffer, G->SkylabTPIGuess);
-			skp->Text(1 * W / 8, 4 * H / 14, Buffer, strlen(Buffer));
+			page.Format(1 * W / 8, 4 * H / 14, this, &ApolloRTCCMFD::GET_Display, G->SkylabTPIGuess, true);
 		}
 		if (G->Skylabmaneuver == 1 || G->Skylabmaneuver == 2)
 		{
-			sprintf(Buffer, "%.1f NM", G->SkylabDH2 / 1852.0);
-			skp->Text(1 * W / 8, 10 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(1 * W / 8, 10 * H / 14, "%.1f NM", G->SkylabDH2 / 1852.0);
 
-			sprintf(Buffer, "%.2f", G->Skylab_E_L*DEG);
-			skp->Text(1 * W / 8, 12 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(1 * W / 8, 12 * H / 14, "%.2f", G->Skylab_E_L*DEG);
 
-			skp->Text(4 * W / 8, 10 * H / 21, "NCC", 3);
-			GET_Display(Buffer, G->Skylab_t_NCC);
-			skp->Text(5 * W / 8, 10 * H / 21, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%+07.1f ft/s", G->Skylab_dv_NCC / 0.3048);
-			skp->Text(5 * W / 8, 11 * H / 21, Buffer, strlen(Buffer));
+			page.Text(4 * W / 8, 10 * H / 21, "NCC", 3);
+			page.Format(5 * W / 8, 10 * H / 21, this, &ApolloRTCCMFD::GET_Display, G->Skylab_t_NCC, true);
+			page.Printf(5 * W / 8, 11 * H / 21, "%+07.1f ft/s", G->Skylab_dv_NCC / 0.3048);
 
-			skp->Text(4 * W / 8, 12 * H / 21, "NSR", 3);
-			GET_Display(Buffer, G->Skylab_t_NSR);
-			skp->Text(5 * W / 8, 12 * H / 21, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%+07.1f ft/s", length(G->Skylab_dV_NSR) / 0.3048);
-			skp->Text(5 * W / 8, 13 * H / 21, Buffer, strlen(Buffer));
+			page.Text(4 * W / 8, 12 * H / 21, "NSR", 3);
+			page.Format(5 * W / 8, 12 * H / 21, this, &ApolloRTCCMFD::GET_Display, G->Skylab_t_NSR, true);
+			page.Printf(5 * W / 8, 13 * H / 21, "%+07.1f ft/s", length(G->Skylab_dV_NSR) / 0.3048);
 		}
 		if (G->Skylabmaneuver == 1)
 		{
 			if (G->Skylab_NPCOption)
 			{
-				skp->Text(1 * W / 8, 2 * H / 14, "NC1 with Plane Change", 21);
+				page.Text(1 * W / 8, 2 * H / 14, "NC1 with Plane Change", 21);
 			}
 			else
 			{
-				skp->Text(1 * W / 8, 2 * H / 14, "NC1", 3);
+				page.Text(1 * W / 8, 2 * H / 14, "NC1", 3);
 			}
 
-			GET_Display(Buffer, G->Skylab_t_NC1);
-			skp->Text(1 * W / 8, 4 * H / 14, Buffer, strlen(Buffer));
+			page.Format(1 * W / 8, 4 * H / 14, this, &ApolloRTCCMFD::GET_Display, G->Skylab_t_NC1, true);
 
-			sprintf(Buffer, "%.1f", G->Skylab_n_C);
-			skp->Text(1 * W / 8, 6 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(1 * W / 8, 6 * H / 14, "%.1f", G->Skylab_n_C);
 
-			sprintf(Buffer, "%.1f NM", G->SkylabDH1 / 1852.0);
-			skp->Text(1 * W / 8, 8 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(1 * W / 8, 8 * H / 14, "%.1f NM", G->SkylabDH1 / 1852.0);
 
-			skp->Text(4 * W / 8, 7 * H / 21, "NC2", 3);
-			GET_Display(Buffer, G->Skylab_t_NC2);
-			skp->Text(5 * W / 8, 7 * H / 21, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%+07.1f ft/s", G->Skylab_dv_NC2 / 0.3048);
-			skp->Text(5 * W / 8, 8 * H / 21, Buffer, strlen(Buffer));
-			sprintf(Buffer, "DH: %.1f NM", G->Skylab_dH_NC2 / 1852.0);
-			skp->Text(5 * W / 8, 9 * H / 21, Buffer, strlen(Buffer));
+			page.Text(4 * W / 8, 7 * H / 21, "NC2", 3);
+			page.Format(5 * W / 8, 7 * H / 21, this, &ApolloRTCCMFD::GET_Display, G->Skylab_t_NC2, true);
+			page.Printf(5 * W / 8, 8 * H / 21, "%+07.1f ft/s", G->Skylab_dv_NC2 / 0.3048);
+			page.Printf(5 * W / 8, 9 * H / 21, "DH: %.1f NM", G->Skylab_dH_NC2 / 1852.0);
 
-			skp->Text(4 * W / 8, 14 * H / 21, "DVT", 3);
-			sprintf(Buffer, "%+07.1f ft/s", (length(G->dV_LVLH) + G->Skylab_dv_NC2 + G->Skylab_dv_NCC + length(G->Skylab_dV_NSR)) / 0.3048);
-			skp->Text(5 * W / 8, 14 * H / 21, Buffer, strlen(Buffer));
+			page.Text(4 * W / 8, 14 * H / 21, "DVT", 3);
+			page.Printf(5 * W / 8, 14 * H / 21, "%+07.1f ft/s", (length(G->dV_LVLH) + G->Skylab_dv_NC2 + G->Skylab_dv_NCC + length(G->Skylab_dV_NSR)) / 0.3048);
 		}
 		if (G->Skylabmaneuver == 2)
 		{
 			if (G->Skylab_NPCOption)
 			{
-				skp->Text(1 * W / 8, 2 * H / 14, "NC2 with Plane Change", 21);
+				page.Text(1 * W / 8, 2 * H / 14, "NC2 with Plane Change", 21);
 			}
 			else
 			{
-				skp->Text(1 * W / 8, 2 * H / 14, "NC2", 3);
+				page.Text(1 * W / 8, 2 * H / 14, "NC2", 3);
 			}
 
-			GET_Display(Buffer, G->Skylab_t_NC2);
-			skp->Text(1 * W / 8, 4 * H / 14, Buffer, strlen(Buffer));
+			page.Format(1 * W / 8, 4 * H / 14, this, &ApolloRTCCMFD::GET_Display, G->Skylab_t_NC2, true);
 
-			skp->Text(4 * W / 8, 14 * H / 21, "DVT", 3);
-			sprintf(Buffer, "%+07.1f ft/s", (length(G->dV_LVLH) + G->Skylab_dv_NCC + length(G->Skylab_dV_NSR)) / 0.3048);
-			skp->Text(5 * W / 8, 14 * H / 21, Buffer, strlen(Buffer));
+			page.Text(4 * W / 8, 14 * H / 21, "DVT", 3);
+			page.Printf(5 * W / 8, 14 * H / 21, "%+07.1f ft/s", (length(G->dV_LVLH) + G->Skylab_dv_NCC + length(G->Skylab_dV_NSR)) / 0.3048);
 		}
 		if (G->Skylabmaneuver == 3)
 		{
-			skp->Text(1 * W / 8, 2 * H / 14, "NCC", 3);
+			page.Text(1 * W / 8, 2 * H / 14, "NCC", 3);
 
-			GET_Display(Buffer, G->Skylab_t_NCC);
-			skp->Text(1 * W / 8, 4 * H / 14, Buffer, strlen(Buffer));
+			page.Format(1 * W / 8, 4 * H / 14, this, &ApolloRTCCMFD::GET_Display, G->Skylab_t_NCC, true);
 
-			sprintf(Buffer, "%.1f NM", G->SkylabDH2 / 1852.0);
-			skp->Text(1 * W / 8, 10 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(1 * W / 8, 10 * H / 14, "%.1f NM", G->SkylabDH2 / 1852.0);
 
-			sprintf(Buffer, "%.2f", G->Skylab_E_L*DEG);
-			skp->Text(1 * W / 8, 12 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(1 * W / 8, 12 * H / 14, "%.2f", G->Skylab_E_L*DEG);
 
-			skp->Text(4 * W / 8, 10 * H / 21, "NSR", 3);
-			GET_Display(Buffer, G->Skylab_t_NSR);
-			skp->Text(5 * W / 8, 10 * H / 21, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%+07.1f", G->Skylab_dV_NSR.x / 0.3048);
-			skp->Text(5 * W / 8, 11 * H / 21, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%+07.1f", G->Skylab_dV_NSR.y / 0.3048);
-			skp->Text(5 * W / 8, 12 * H / 21, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%+07.1f", G->Skylab_dV_NSR.z / 0.3048);
-			skp->Text(5 * W / 8, 13 * H / 21, Buffer, strlen(Buffer));
+			page.Text(4 * W / 8, 10 * H / 21, "NSR", 3);
+			page.Format(5 * W / 8, 10 * H / 21, this, &ApolloRTCCMFD::GET_Display, G->Skylab_t_NSR, true);
+			page.Printf(5 * W / 8, 11 * H / 21, "%+07.1f", G->Skylab_dV_NSR.x / 0.3048);
+			page.Printf(5 * W / 8, 12 * H / 21, "%+07.1f", G->Skylab_dV_NSR.y / 0.3048);
+			page.Printf(5 * W / 8, 13 * H / 21, "%+07.1f", G->Skylab_dV_NSR.z / 0.3048);
 		}
 		if (G->Skylabmaneuver == 4)
 		{
-			skp->Text(1 * W / 8, 2 * H / 14, "NSR", 3);
+			page.Text(1 * W / 8, 2 * H / 14, "NSR", 3);
 
-			GET_Display(Buffer, G->Skylab_t_NSR);
-			skp->Text(1 * W / 8, 4 * H / 14, Buffer, strlen(Buffer));
+			page.Format(1 * W / 8, 4 * H / 14, this, &ApolloRTCCMFD::GET_Display, G->Skylab_t_NSR, true);
 
-			sprintf(Buffer, "%.2f", G->Skylab_E_L*DEG);
-			skp->Text(1 * W / 8, 12 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(1 * W / 8, 12 * H / 14, "%.2f", G->Skylab_E_L*DEG);
 		}
 		if (G->Skylabmaneuver == 5)
 		{
-			skp->Text(1 * W / 8, 2 * H / 14, "TPI", 3);
+			page.Text(1 * W / 8, 2 * H / 14, "TPI", 3);
 
-			skp->Text(1 * W / 8, 4 * H / 14, "Calculate TPI TIG", 17);
+			page.Text(1 * W / 8, 4 * H / 14, "Calculate TPI TIG", 17);
 
-			sprintf(Buffer, "%.2f", G->Skylab_E_L*DEG);
-			skp->Text(1 * W / 8, 12 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(1 * W / 8, 12 * H / 14, "%.2f", G->Skylab_E_L*DEG);
 		}
 		if (G->Skylabmaneuver == 6)
 		{
-			skp->Text(1 * W / 8, 2 * H / 14, "TPM", 3);
+			page.Text(1 * W / 8, 2 * H / 14, "TPM", 3);
 
-			sprintf(Buffer, "DT = %.1f mins", G->Skylab_dt_TPM / 60.0);
-			skp->Text(1 * W / 8, 4 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(1 * W / 8, 4 * H / 14, "DT = %.1f mins", G->Skylab_dt_TPM / 60.0);
 		}
 		if (G->Skylabmaneuver == 7)
 		{
 			if (G->Skylab_PCManeuver == 0)
 			{
-				skp->Text(1 * W / 8, 2 * H / 14, "NPC after NC1", 13);
+				page.Text(1 * W / 8, 2 * H / 14, "NPC after NC1", 13);
 			}
 			else
 			{
-				skp->Text(1 * W / 8, 2 * H / 14, "NPC after NC2", 13);
+				page.Text(1 * W / 8, 2 * H / 14, "NPC after NC2", 13);
 			}
 		}
 	}
 	else if (screen == 18)
 	{
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
-		skp->Text(4 * W / 8, 1 * H / 14, "Initialization for Lunar Descent Planning (K17)", 47);
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
+		page.Text(4 * W / 8, 1 * H / 14, "Initialization for Lunar Descent Planning (K17)", 47);
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
 
 		if (GC->rtcc->GZGENCSN.LDPPAzimuth != 0.0)
 		{
-			sprintf(Buffer, "%.3f", GC->rtcc->GZGENCSN.LDPPAzimuth*DEG);
-			skp->Text(1 * W / 8, 2 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(1 * W / 8, 2 * H / 14, "%.3f", GC->rtcc->GZGENCSN.LDPPAzimuth*DEG);
 		}
 		else
 		{
-			skp->Text(1 * W / 8, 2 * H / 14, "Optimum Azimuth", 15);
+			page.Text(1 * W / 8, 2 * H / 14, "Optimum Azimuth", 15);
 		}
 
-		sprintf(Buffer, "%.0f ft", GC->rtcc->GZGENCSN.LDPPHeightofPDI / 0.3048);
-		skp->Text(1 * W / 8, 4 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(1 * W / 8, 4 * H / 14, "%.0f ft", GC->rtcc->GZGENCSN.LDPPHeightofPDI / 0.3048);
 
 		if (GC->rtcc->GZGENCSN.LDPPPoweredDescentSimFlag)
 		{
-			skp->Text(1 * W / 8, 6 * H / 14, "Simulate powered descent (N/A)", 30);
+			page.Text(1 * W / 8, 6 * H / 14, "Simulate powered descent (N/A)", 30);
 		}
 		else
 		{
-			skp->Text(1 * W / 8, 6 * H / 14, "Do not simulate powered descent", 31);
+			page.Text(1 * W / 8, 6 * H / 14, "Do not simulate powered descent", 31);
 		}
 
-		GET_Display(Buffer, GC->rtcc->GZGENCSN.LDPPTimeofPDI);
-		skp->Text(1 * W / 8, 8 * H / 14, Buffer, strlen(Buffer));
+		page.Format(1 * W / 8, 8 * H / 14, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->GZGENCSN.LDPPTimeofPDI, true);
 
-		sprintf(Buffer, "%d", GC->rtcc->GZGENCSN.LDPPDwellOrbits);
-		skp->Text(1 * W / 8, 10 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(1 * W / 8, 10 * H / 14, "%d", GC->rtcc->GZGENCSN.LDPPDwellOrbits);
 
-		sprintf(Buffer, "%.2f min", GC->rtcc->GZGENCSN.LDPPDescentFlightTime / 60.0);
-		skp->Text(5 * W / 8, 2 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(5 * W / 8, 2 * H / 14, "%.2f min", GC->rtcc->GZGENCSN.LDPPDescentFlightTime / 60.0);
 
-		sprintf(Buffer, "%.2f", GC->rtcc->GZGENCSN.LDPPDescentFlightArc*DEG);
-		skp->Text(5 * W / 8, 4 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(5 * W / 8, 4 * H / 14, "%.2f", GC->rtcc->GZGENCSN.LDPPDescentFlightArc*DEG);
 	}
 	else if (screen == 19)
 	{
-		skp->Text(5 * W / 8, (int)(0.5 * H / 14), "Terrain Model", 13);
+		page.Text(5 * W / 8, (int)(0.5 * H / 14), "Terrain Model", 13);
 
-		sprintf(Buffer, "%.3f", G->TMLat*DEG);
-		skp->Text(1 * W / 8, 2 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(1 * W / 8, 2 * H / 14, "%.3f", G->TMLat*DEG);
 
-		sprintf(Buffer, "%.3f", G->TMLng*DEG);
-		skp->Text(1 * W / 8, 4 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(1 * W / 8, 4 * H / 14, "%.3f", G->TMLng*DEG);
 
-		sprintf(Buffer, "%.3f", G->TMAzi*DEG);
-		skp->Text(1 * W / 8, 6 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(1 * W / 8, 6 * H / 14, "%.3f", G->TMAzi*DEG);
 
-		sprintf(Buffer, "%.1f ft", G->TMDistance / 0.3048);
-		skp->Text(1 * W / 8, 8 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(1 * W / 8, 8 * H / 14, "%.1f ft", G->TMDistance / 0.3048);
 
-		sprintf(Buffer, "%.1f ft", G->TMStepSize / 0.3048);
-		skp->Text(1 * W / 8, 10 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(1 * W / 8, 10 * H / 14, "%.1f ft", G->TMStepSize / 0.3048);
 
-		skp->Text(5 * W / 8, 9 * H / 14, "LS Height:", 10);
-		sprintf(Buffer, "%.2f NM", G->TMAlt / 1852.0);
-		skp->Text(5 * W / 8, 10 * H / 14, Buffer, strlen(Buffer));
+		page.Text(5 * W / 8, 9 * H / 14, "LS Height:", 10);
+		page.Printf(5 * W / 8, 10 * H / 14, "%.2f NM", G->TMAlt / 1852.0);
 	}
 	else if (screen == 20)
 	{
 		if (G->vesseltype < 2)
 		{
-			skp->Text(7 * W / 8, (int)(0.5 * H / 14), "CSM", 3);
+			page.Text(7 * W / 8, (int)(0.5 * H / 14), "CSM", 3);
 		}
 		else if (G->vesseltype < 4)
 		{
-			skp->Text(7 * W / 8, (int)(0.5 * H / 14), "LM", 2);
+			page.Text(7 * W / 8, (int)(0.5 * H / 14), "LM", 2);
 		}
 		else
 		{
-			skp->Text(7 * W / 8, (int)(0.5 * H / 14), "MCC", 3);
+			page.Text(7 * W / 8, (int)(0.5 * H / 14), "MCC", 3);
 		}
 
-		skp->Text(1 * W / 8, 2 * H / 14, "Maneuver PAD", 12);
-		skp->Text(1 * W / 8, 4 * H / 14, "Entry PAD", 9);
-		skp->Text(1 * W / 8, 6 * H / 14, "Landmark Tracking", 17);
-		skp->Text(1 * W / 8, 8 * H / 14, "Map Update", 10);
-		skp->Text(1 * W / 8, 10 * H / 14, "Nav Check PAD", 13);
-		skp->Text(1 * W / 8, 12 * H / 14, "P37 PAD", 7);
+		page.Text(1 * W / 8, 2 * H / 14, "Maneuver PAD", 12);
+		page.Text(1 * W / 8, 4 * H / 14, "Entry PAD", 9);
+		page.Text(1 * W / 8, 6 * H / 14, "Landmark Tracking", 17);
+		page.Text(1 * W / 8, 8 * H / 14, "Map Update", 10);
+		page.Text(1 * W / 8, 10 * H / 14, "Nav Check PAD", 13);
+		page.Text(1 * W / 8, 12 * H / 14, "P37 PAD", 7);
 
-		skp->Text(5 * W / 8, 2 * H / 14, "DAP PAD", 7);
-		skp->Text(5 * W / 8, 4 * H / 14, "LM Ascent PAD", 13);
-		skp->Text(5 * W / 8, 6 * H / 14, "AGS SV PAD", 10);
-		skp->Text(5 * W / 8, 12 * H / 14, "Previous Page", 13);
+		page.Text(5 * W / 8, 2 * H / 14, "DAP PAD", 7);
+		page.Text(5 * W / 8, 4 * H / 14, "LM Ascent PAD", 13);
+		page.Text(5 * W / 8, 6 * H / 14, "AGS SV PAD", 10);
+		page.Text(5 * W / 8, 12 * H / 14, "Previous Page", 13);
 	}
 	else if (screen == 21)
 	{
 		if (G->vesseltype < 2)
 		{
-			skp->Text(7 * W / 8, (int)(0.5 * H / 14), "CSM", 3);
+			page.Text(7 * W / 8, (int)(0.5 * H / 14), "CSM", 3);
 		}
 		else
 		{
-			skp->Text(7 * W / 8, (int)(0.5 * H / 14), "LM", 2);
+			page.Text(7 * W / 8, (int)(0.5 * H / 14), "LM", 2);
 		}
 
-		skp->Text(1 * W / 8, 2 * H / 14, "Landing Site", 12);
-		skp->Text(1 * W / 8, 4 * H / 14, "REFSMMAT", 8);
-		skp->Text(1 * W / 8, 6 * H / 14, "VECPOINT", 8);
-		skp->Text(1 * W / 8, 8 * H / 14, "Erasable Memory Programs", 24);
-		skp->Text(1 * W / 8, 10 * H / 14, "Nodal Target Conversion", 23);
-		skp->Text(1 * W / 8, 12 * H / 14, "Descent Abort", 13);
+		page.Text(1 * W / 8, 2 * H / 14, "Landing Site", 12);
+		page.Text(1 * W / 8, 4 * H / 14, "REFSMMAT", 8);
+		page.Text(1 * W / 8, 6 * H / 14, "VECPOINT", 8);
+		page.Text(1 * W / 8, 8 * H / 14, "Erasable Memory Programs", 24);
+		page.Text(1 * W / 8, 10 * H / 14, "Nodal Target Conversion", 23);
+		page.Text(1 * W / 8, 12 * H / 14, "Descent Abort", 13);
 
-		skp->Text(5 * W / 8, 2 * H / 14, "LVDC", 4);
-		skp->Text(5 * W / 8, 4 * H / 14, "Terrain Model", 13);
-		skp->Text(5 * W / 8, 6 * H / 14, "AGC Ephemeris", 13);
-		skp->Text(5 * W / 8, 12 * H / 14, "Previous Page", 13);
+		page.Text(5 * W / 8, 2 * H / 14, "LVDC", 4);
+		page.Text(5 * W / 8, 4 * H / 14, "Terrain Model", 13);
+		page.Text(5 * W / 8, 6 * H / 14, "AGC Ephemeris", 13);
+		page.Text(5 * W / 8, 12 * H / 14, "Previous Page", 13);
 	}
 	else if (screen == 22)
 	{
@@ -2142,27 +1835,24 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			break;
 		}
 
-		skp->Text(1 * W / 8, 2 * H / 14, Buffer, strlen(Buffer));
+		page.Text(1 * W / 8, 2 * H / 14, Buffer, strlen(Buffer));
 
 		if (GC->MissionPlanningActive)
 		{
-			GET_Display(Buffer, GC->rtcc->PZMCCPLN.VectorGET);
-			skp->Text(1 * W / 8, 4 * H / 14, Buffer, strlen(Buffer));
+			page.Format(1 * W / 8, 4 * H / 14, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->PZMCCPLN.VectorGET, true);
 		}
 
-		GET_Display(Buffer, GC->rtcc->PZMCCPLN.MidcourseGET);
-		skp->Text(1 * W / 8, 6 * H / 14, Buffer, strlen(Buffer));
+		page.Format(1 * W / 8, 6 * H / 14, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->PZMCCPLN.MidcourseGET, true);
 
-		sprintf(Buffer, "%d", GC->rtcc->PZMCCPLN.Column);
-		skp->Text(1 * W / 8, 8 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(1 * W / 8, 8 * H / 14, "%d", GC->rtcc->PZMCCPLN.Column);
 
 		if (GC->rtcc->PZMCCPLN.Config)
 		{
-			skp->Text(1 * W / 8, 10 * H / 14, "Docked", 6);
+			page.Text(1 * W / 8, 10 * H / 14, "Docked", 6);
 		}
 		else
 		{
-			skp->Text(1 * W / 8, 10 * H / 14, "Undocked", 8);
+			page.Text(1 * W / 8, 10 * H / 14, "Undocked", 8);
 		}
 
 		if (GC->rtcc->PZMCCPLN.SFPBlockNum == 1)
@@ -2173,12 +1863,11 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 		{
 			sprintf(Buffer, "2 (Nominal Targets)");
 		}
-		skp->Text(1 * W / 8, 12 * H / 14, Buffer, strlen(Buffer));
+		page.Text(1 * W / 8, 12 * H / 14, Buffer, strlen(Buffer));
 
 		if (GC->rtcc->PZMCCPLN.Mode == 7)
 		{
-			sprintf(Buffer, "%.2f NM", GC->rtcc->PZMCCPLN.h_PC / 1852.0);
-			skp->Text(5 * W / 8, 4 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(5 * W / 8, 4 * H / 14, "%.2f NM", GC->rtcc->PZMCCPLN.h_PC / 1852.0);
 		}
 		else if (GC->rtcc->PZMCCPLN.Mode >= 8)
 		{
@@ -2190,13 +1879,12 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			{
 				sprintf(Buffer, "%.2f NM", GC->rtcc->PZMCCPLN.h_PC / 1852.0);
 			}
-			skp->Text(5 * W / 8, 4 * H / 14, Buffer, strlen(Buffer));
+			page.Text(5 * W / 8, 4 * H / 14, Buffer, strlen(Buffer));
 		}
 
 		if (GC->rtcc->PZMCCPLN.Mode >= 8)
 		{
-			sprintf(Buffer, "%.2f", GC->rtcc->PZMCCPLN.incl_fr*DEG);
-			skp->Text(5 * W / 8, 6 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(5 * W / 8, 6 * H / 14, "%.2f", GC->rtcc->PZMCCPLN.incl_fr*DEG);
 		}
 
 		if (GC->rtcc->PZMCCPLN.Mode == 5)
@@ -2209,65 +1897,61 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			{
 				sprintf(Buffer, "%.2f NM", GC->rtcc->PZMCCPLN.h_PC_mode5 / 1852.0);
 			}
-			skp->Text(5 * W / 8, 8 * H / 14, Buffer, strlen(Buffer));
+			page.Text(5 * W / 8, 8 * H / 14, Buffer, strlen(Buffer));
 		}
 
-		skp->Text(5 * W / 8, 10 * H / 14, "Constraints", 11);
+		page.Text(5 * W / 8, 10 * H / 14, "Constraints", 11);
 	}
 	else if (screen == 23)
 	{
-		skp->Text(4 * W / 8, 1 * H / 28, "Lunar Launch Window", 19);
+		page.Text(4 * W / 8, 1 * H / 28, "Lunar Launch Window", 19);
 
-		skp->Text(1 * W / 16, 2 * H / 14, "Initialization", 14);
+		page.Text(1 * W / 16, 2 * H / 14, "Initialization", 14);
 
 		if (GC->rtcc->med_k15.Chaser == 1)
 		{
-			skp->Text(1 * W / 16, 4 * H / 14, "Chaser: CSM", 11);
+			page.Text(1 * W / 16, 4 * H / 14, "Chaser: CSM", 11);
 		}
 		else
 		{
-			skp->Text(1 * W / 16, 4 * H / 14, "Chaser: LM", 10);
+			page.Text(1 * W / 16, 4 * H / 14, "Chaser: LM", 10);
 		}
 
 		if (GC->MissionPlanningActive)
 		{
-			GET_Display2(Buffer, GC->rtcc->med_k15.CSMVectorTime);
-			skp->Text(1 * W / 16, 6 * H / 14, Buffer, strlen(Buffer));
+			page.Format(1 * W / 16, 6 * H / 14, this, &ApolloRTCCMFD::GET_Display2, GC->rtcc->med_k15.CSMVectorTime);
 		}
 
 		if (GC->rtcc->med_k15.TPIDefinition == 1)
 		{
-			skp->Text(1 * W / 16, 8 * H / 14, "TLO:", 4);
+			page.Text(1 * W / 16, 8 * H / 14, "TLO:", 4);
 		}
 		else
 		{
-			skp->Text(1 * W / 16, 8 * H / 14, "TPI:", 4);
+			page.Text(1 * W / 16, 8 * H / 14, "TPI:", 4);
 		}
-		GET_Display2(Buffer, GC->rtcc->med_k15.ThresholdTime);
-		skp->Text(3 * W / 16, 8 * H / 14, Buffer, strlen(Buffer));
+		page.Format(3 * W / 16, 8 * H / 14, this, &ApolloRTCCMFD::GET_Display2, GC->rtcc->med_k15.ThresholdTime);
 
 		if (GC->rtcc->med_k15.CSI_Flag == 0.0)
 		{
-			skp->Text(1 * W / 16, 10 * H / 14, "CSI at 90 degrees from insertion", 32);
+			page.Text(1 * W / 16, 10 * H / 14, "CSI at 90 degrees from insertion", 32);
 		}
 		else if (GC->rtcc->med_k15.CSI_Flag < 0)
 		{
-			skp->Text(1 * W / 16, 10 * H / 14, "CSI at LM apolune", 17);
+			page.Text(1 * W / 16, 10 * H / 14, "CSI at LM apolune", 17);
 		}
 		else
 		{
-			sprintf(Buffer, "%.1lf min", GC->rtcc->med_k15.CSI_Flag / 60.0);
-			skp->Text(1 * W / 16, 10 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(1 * W / 16, 10 * H / 14, "%.1lf min", GC->rtcc->med_k15.CSI_Flag / 60.0);
 		}
 
 		if (GC->rtcc->med_k15.CDH_Flag == 0)
 		{
-			skp->Text(1 * W / 16, 12 * H / 14, "CDH at apsis after CSI", 22);
+			page.Text(1 * W / 16, 12 * H / 14, "CDH at apsis after CSI", 22);
 		}
 		else
 		{
-			sprintf(Buffer, "CDH %d half revs after CSI", GC->rtcc->med_k15.CDH_Flag);
-			skp->Text(1 * W / 16, 12 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(1 * W / 16, 12 * H / 14, "CDH %d half revs after CSI", GC->rtcc->med_k15.CDH_Flag);
 		}
 
 		if (GC->MissionPlanningActive == false)
@@ -2280,107 +1964,93 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			{
 				sprintf_s(Buffer, "No Target!");
 			}
-			skp->Text(10 * W / 16, 2 * H / 14, Buffer, strlen(Buffer));
+			page.Text(10 * W / 16, 2 * H / 14, Buffer, strlen(Buffer));
 		}
 
 		if (GC->rtcc->med_k15.TPIDefinition == 1)
 		{
-			sprintf(Buffer, "TPI longitude: %.4lf", GC->rtcc->med_k15.TPIValue*DEG);
-			skp->Text(8 * W / 16, 4 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(8 * W / 16, 4 * H / 14, "TPI longitude: %.4lf", GC->rtcc->med_k15.TPIValue*DEG);
 		}
 		else
 		{
-			skp->Text(8 * W / 16, 4 * H / 14, "TPI at threshold time", 22);
+			page.Text(8 * W / 16, 4 * H / 14, "TPI at threshold time", 22);
 		}
 
 		if (GC->rtcc->med_k15.DeltaHTFlag > 0)
 		{
-			sprintf(Buffer, "Launch window with %d heights", GC->rtcc->med_k15.DeltaHTFlag);
-			skp->Text(8 * W / 16, 6 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(8 * W / 16, 6 * H / 14, "Launch window with %d heights", GC->rtcc->med_k15.DeltaHTFlag);
 		}
 		else
 		{
-			skp->Text(8 * W / 16, 6 * H / 14, "Calc using input heights", 24);
+			page.Text(8 * W / 16, 6 * H / 14, "Calc using input heights", 24);
 
-			sprintf(Buffer, "%.2lf %.2lf %.2lf NM", GC->rtcc->med_k15.DH1 / 1852.0, GC->rtcc->med_k15.DH2 / 1852.0, GC->rtcc->med_k15.DH3 / 1852.0);
-			skp->Text(8 * W / 16, 8 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(8 * W / 16, 8 * H / 14, "%.2lf %.2lf %.2lf NM", GC->rtcc->med_k15.DH1 / 1852.0, GC->rtcc->med_k15.DH2 / 1852.0, GC->rtcc->med_k15.DH3 / 1852.0);
 		}
 
 		/*if (G->LunarLiftoffTimeOption == 0)
 		{
 			if (G->LunarLiftoffInsVelInput)
 			{
-				skp->Text((int)(0.5 * W / 8), 4 * H / 14, "Input Ins. Velocity", 19);
+				page.Text((int)(0.5 * W / 8), 4 * H / 14, "Input Ins. Velocity", 19);
 			}
 			else
 			{
-				skp->Text((int)(0.5 * W / 8), 4 * H / 14, "Calc. Ins. Velocity", 19);
+				page.Text((int)(0.5 * W / 8), 4 * H / 14, "Calc. Ins. Velocity", 19);
 			}
 		}
 
-		skp->Text((int)(0.5 * W / 8), 8 * H / 21, "Rendezvous Schedule:", 20);
+		page.Text((int)(0.5 * W / 8), 8 * H / 21, "Rendezvous Schedule:", 20);
 
-		skp->Text((int)(0.5 * W / 8), 9 * H / 21, "Launch:", 7);
-		GET_Display(Buffer, G->LunarLiftoffRes.t_L);
-		skp->Text(2 * W / 8, 9 * H / 21, Buffer, strlen(Buffer));
+		page.Text((int)(0.5 * W / 8), 9 * H / 21, "Launch:", 7);
+		page.Format(2 * W / 8, 9 * H / 21, this, &ApolloRTCCMFD::GET_Display, G->LunarLiftoffRes.t_L, true);
 
-		skp->Text((int)(0.5 * W / 8), 10 * H / 21, "Insertion:", 10);
-		GET_Display(Buffer, G->LunarLiftoffRes.t_Ins);
-		skp->Text(2 * W / 8, 10 * H / 21, Buffer, strlen(Buffer));
+		page.Text((int)(0.5 * W / 8), 10 * H / 21, "Insertion:", 10);
+		page.Format(2 * W / 8, 10 * H / 21, this, &ApolloRTCCMFD::GET_Display, G->LunarLiftoffRes.t_Ins, true);
 
 		if (G->LunarLiftoffTimeOption == 0)
 		{
-			skp->Text((int)(0.5 * W / 8), 11 * H / 21, "T CSI:", 6);
-			GET_Display(Buffer, G->LunarLiftoffRes.t_CSI);
-			skp->Text(2 * W / 8, 11 * H / 21, Buffer, strlen(Buffer));
+			page.Text((int)(0.5 * W / 8), 11 * H / 21, "T CSI:", 6);
+			page.Format(2 * W / 8, 11 * H / 21, this, &ApolloRTCCMFD::GET_Display, G->LunarLiftoffRes.t_CSI, true);
 
-			skp->Text((int)(0.5 * W / 8), 12 * H / 21, "DV CSI:", 7);
-			sprintf(Buffer, "%.1f ft/s", G->LunarLiftoffRes.DV_CSI / 0.3048);
-			skp->Text(2 * W / 8, 12 * H / 21, Buffer, strlen(Buffer));
+			page.Text((int)(0.5 * W / 8), 12 * H / 21, "DV CSI:", 7);
+			page.Printf(2 * W / 8, 12 * H / 21, "%.1f ft/s", G->LunarLiftoffRes.DV_CSI / 0.3048);
 
-			skp->Text((int)(0.5 * W / 8), 13 * H / 21, "T CDH:", 6);
-			GET_Display(Buffer, G->LunarLiftoffRes.t_CDH);
-			skp->Text(2 * W / 8, 13 * H / 21, Buffer, strlen(Buffer));
+			page.Text((int)(0.5 * W / 8), 13 * H / 21, "T CDH:", 6);
+			page.Format(2 * W / 8, 13 * H / 21, this, &ApolloRTCCMFD::GET_Display, G->LunarLiftoffRes.t_CDH, true);
 
-			skp->Text((int)(0.5 * W / 8), 14 * H / 21, "DV CDH:", 7);
-			sprintf(Buffer, "%.1f ft/s", G->LunarLiftoffRes.DV_CDH / 0.3048);
-			skp->Text(2 * W / 8, 14 * H / 21, Buffer, strlen(Buffer));
+			page.Text((int)(0.5 * W / 8), 14 * H / 21, "DV CDH:", 7);
+			page.Printf(2 * W / 8, 14 * H / 21, "%.1f ft/s", G->LunarLiftoffRes.DV_CDH / 0.3048);
 		}
 
 		if (G->LunarLiftoffTimeOption == 0 || G->LunarLiftoffTimeOption == 1)
 		{
-			skp->Text((int)(0.5 * W / 8), 15 * H / 21, "T TPI:", 6);
-			GET_Display(Buffer, G->LunarLiftoffRes.t_TPI);
-			skp->Text(2 * W / 8, 15 * H / 21, Buffer, strlen(Buffer));
+			page.Text((int)(0.5 * W / 8), 15 * H / 21, "T TPI:", 6);
+			page.Format(2 * W / 8, 15 * H / 21, this, &ApolloRTCCMFD::GET_Display, G->LunarLiftoffRes.t_TPI, true);
 
-			skp->Text((int)(0.5 * W / 8), 16 * H / 21, "DV TPI:", 7);
-			sprintf(Buffer, "%.1f ft/s", G->LunarLiftoffRes.DV_TPI / 0.3048);
-			skp->Text(2 * W / 8, 16 * H / 21, Buffer, strlen(Buffer));
+			page.Text((int)(0.5 * W / 8), 16 * H / 21, "DV TPI:", 7);
+			page.Printf(2 * W / 8, 16 * H / 21, "%.1f ft/s", G->LunarLiftoffRes.DV_TPI / 0.3048);
 		}
 
-		skp->Text((int)(0.5 * W / 8), 17 * H / 21, "T TPF:", 6);
-		GET_Display(Buffer, G->LunarLiftoffRes.t_TPF);
-		skp->Text(2 * W / 8, 17 * H / 21, Buffer, strlen(Buffer));
+		page.Text((int)(0.5 * W / 8), 17 * H / 21, "T TPF:", 6);
+		page.Format(2 * W / 8, 17 * H / 21, this, &ApolloRTCCMFD::GET_Display, G->LunarLiftoffRes.t_TPF, true);
 
-		skp->Text((int)(0.5 * W / 8), 18 * H / 21, "DV TPF:", 7);
-		sprintf(Buffer, "%.1f ft/s", G->LunarLiftoffRes.DV_TPF / 0.3048);
-		skp->Text(2 * W / 8, 18 * H / 21, Buffer, strlen(Buffer));
+		page.Text((int)(0.5 * W / 8), 18 * H / 21, "DV TPF:", 7);
+		page.Printf(2 * W / 8, 18 * H / 21, "%.1f ft/s", G->LunarLiftoffRes.DV_TPF / 0.3048);
 
-		skp->Text((int)(0.5 * W / 8), 19 * H / 21, "DVT:", 4);
-		sprintf(Buffer, "%.1f ft/s", G->LunarLiftoffRes.DV_T / 0.3048);
-		skp->Text(2 * W / 8, 19 * H / 21, Buffer, strlen(Buffer));
+		page.Text((int)(0.5 * W / 8), 19 * H / 21, "DVT:", 4);
+		page.Printf(2 * W / 8, 19 * H / 21, "%.1f ft/s", G->LunarLiftoffRes.DV_T / 0.3048);
 
 		if (G->LunarLiftoffTimeOption == 0)
 		{
-			skp->Text(4 * W / 8, 2 * H / 14, "Concentric Profile", 18);
+			page.Text(4 * W / 8, 2 * H / 14, "Concentric Profile", 18);
 		}
 		else if (G->LunarLiftoffTimeOption == 1)
 		{
-			skp->Text(4 * W / 8, 2 * H / 14, "Direct Profile", 14);
+			page.Text(4 * W / 8, 2 * H / 14, "Direct Profile", 14);
 		}
 		else
 		{
-			skp->Text(4 * W / 8, 2 * H / 14, "Time Critical Profile", 21);
+			page.Text(4 * W / 8, 2 * H / 14, "Time Critical Profile", 21);
 		}
 
 		if (GC->MissionPlanningActive)
@@ -2392,186 +2062,169 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			if (G->target != NULL)
 			{
 				sprintf(Buffer, G->target->GetName());
-				skp->Text(5 * W / 8, 4 * H / 14, Buffer, strlen(Buffer));
+				page.Text(5 * W / 8, 4 * H / 14, Buffer, strlen(Buffer));
 			}
 		}
 		if (G->LunarLiftoffTimeOption == 1)
 		{
-			skp->Text(5 * W / 8, 6 * H / 14, "DT Insertion-TPI:", 17);
-			sprintf(Buffer, "%.1f min", GC->DT_Ins_TPI / 60.0);
-			skp->Text(5 * W / 8, 7 * H / 14, Buffer, strlen(Buffer));
+			page.Text(5 * W / 8, 6 * H / 14, "DT Insertion-TPI:", 17);
+			page.Printf(5 * W / 8, 7 * H / 14, "%.1f min", GC->DT_Ins_TPI / 60.0);
 		}
 
-		skp->Text(5 * W / 8, 9 * H / 14, "Horizontal Velocity:", 20);
-		sprintf(Buffer, "%+.1f ft/s", G->LunarLiftoffRes.v_LH / 0.3048);
-		skp->Text(5 * W / 8, 10 * H / 14, Buffer, strlen(Buffer));
+		page.Text(5 * W / 8, 9 * H / 14, "Horizontal Velocity:", 20);
+		page.Printf(5 * W / 8, 10 * H / 14, "%+.1f ft/s", G->LunarLiftoffRes.v_LH / 0.3048);
 
-		skp->Text(5 * W / 8, 11 * H / 14, "Vertical Velocity:", 18);
+		page.Text(5 * W / 8, 11 * H / 14, "Vertical Velocity:", 18);
 		sprintf(Buffer, "%+.1f ft/s", G->LunarLiftoffRes.v_LV / 0.3048);
-		skp->Text(5 * W / 8, 12 * H / 14, Buffer, strlen(Buffer));*/
+		page.Text(5 * W / 8, 12 * H / 14, Buffer, strlen(Buffer));*/
 	}
 	else if (screen == 24)
 	{
-		skp->Text(4 * W / 8, (int)(0.5 * H / 14), "Erasable Memory Programs", 24);
+		page.Text(4 * W / 8, (int)(0.5 * H / 14), "Erasable Memory Programs", 24);
 
-		skp->Text(1 * W / 8, 2 * H / 14, "Program 99", 10);
+		page.Text(1 * W / 8, 2 * H / 14, "Program 99", 10);
 
-		sprintf(Buffer, "Uplink No. %d", G->EMPUplinkNumber);
-		skp->Text(5 * W / 8, 2 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(5 * W / 8, 2 * H / 14, "Uplink No. %d", G->EMPUplinkNumber);
 
 	}
 	else if (screen == 25)
 	{
-		skp->Text(5 * W / 8, (int)(0.5 * H / 14), "Nav Check PAD", 13);
+		page.Text(5 * W / 8, (int)(0.5 * H / 14), "Nav Check PAD", 13);
 
-		GET_Display(Buffer, G->navcheckpad.NavChk[0]);
-		skp->Text(1 * W / 8, 2 * H / 14, Buffer, strlen(Buffer));
+		page.Format(1 * W / 8, 2 * H / 14, this, &ApolloRTCCMFD::GET_Display, G->navcheckpad.NavChk[0], true);
 
-		sprintf(Buffer, "%+07.2f LAT", G->navcheckpad.lat[0]);
-		skp->Text(4 * W / 8, 6 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(4 * W / 8, 6 * H / 14, "%+07.2f LAT", G->navcheckpad.lat[0]);
 
-		sprintf(Buffer, "%+07.2f LNG", G->navcheckpad.lng[0]);
-		skp->Text(4 * W / 8, 7 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(4 * W / 8, 7 * H / 14, "%+07.2f LNG", G->navcheckpad.lng[0]);
 
-		sprintf(Buffer, "%+07.1f ALT", G->navcheckpad.alt[0]);
-		skp->Text(4 * W / 8, 8 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(4 * W / 8, 8 * H / 14, "%+07.1f ALT", G->navcheckpad.alt[0]);
 	}
 	else if (screen == 26)
 	{
-		skp->Text(6 * W / 8, (int)(0.5 * H / 14), "Deorbit", 7);
+		page.Text(6 * W / 8, (int)(0.5 * H / 14), "Deorbit", 7);
 
-		skp->Text(1 * W / 16, 2 * H / 14, "Constraints", 11);
-		skp->Text(1 * W / 16, 4 * H / 14, "Target Selection", 16);
+		page.Text(1 * W / 16, 2 * H / 14, "Constraints", 11);
+		page.Text(1 * W / 16, 4 * H / 14, "Target Selection", 16);
 
 		if (GC->rtcc->RZJCTTC.Type == 1)
 		{
-			skp->Text(1 * W / 16, 6 * H / 14, "Primary Area", 12);
+			page.Text(1 * W / 16, 6 * H / 14, "Primary Area", 12);
 
-			sprintf(Buffer, "%f ", GC->rtcc->RZJCTTC.lat_T*DEG);
-			skp->Text(1 * W / 16, 10 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(1 * W / 16, 10 * H / 14, "%f ", GC->rtcc->RZJCTTC.lat_T*DEG);
 		}
 		else
 		{
-			skp->Text(1 * W / 16, 6 * H / 14, "Contingency Area", 16);
+			page.Text(1 * W / 16, 6 * H / 14, "Contingency Area", 16);
 		}
 
-		GET_Display(Buffer, GC->rtcc->RZJCTTC.GETI);
-		skp->Text(1 * W / 16, 8 * H / 14, Buffer, strlen(Buffer));
+		page.Format(1 * W / 16, 8 * H / 14, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->RZJCTTC.GETI, true);
 
-		sprintf(Buffer, "%f ", GC->rtcc->RZJCTTC.lng_T*DEG);
-		skp->Text(1 * W / 16, 12 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(1 * W / 16, 12 * H / 14, "%f ", GC->rtcc->RZJCTTC.lng_T*DEG);
 
-		skp->SetTextAlign(oapi::Sketchpad::RIGHT);
+		page.SetTextAlign(oapi::Sketchpad::RIGHT);
 
-		skp->Text(15 * W / 16, 2 * H / 14, "Retrofire Digitals", 18);
-		skp->Text(15 * W / 16, 4 * H / 14, "Retrofire External DV", 21);
+		page.Text(15 * W / 16, 2 * H / 14, "Retrofire Digitals", 18);
+		page.Text(15 * W / 16, 4 * H / 14, "Retrofire External DV", 21);
 
-		sprintf(Buffer, "%.2lf NM", GC->rtcc->RZJCTTC.MD);
-		skp->Text(15 * W / 16, 10 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(15 * W / 16, 10 * H / 14, "%.2lf NM", GC->rtcc->RZJCTTC.MD);
 	}
 	else if (screen == 27)
 	{
-		skp->Text(3 * W / 8, 1 * H / 14, "Return to Earth Digitals Inputs", 31);
+		page.Text(3 * W / 8, 1 * H / 14, "Return to Earth Digitals Inputs", 31);
 
 		if (GC->rtcc->med_f80.Column == 1)
 		{
-			skp->Text(1 * W / 16, 2 * H / 14, "Primary", 7);
+			page.Text(1 * W / 16, 2 * H / 14, "Primary", 7);
 		}
 		else
 		{
-			skp->Text(1 * W / 16, 2 * H / 14, "Manual", 6);
+			page.Text(1 * W / 16, 2 * H / 14, "Manual", 6);
 		}
 
-		sprintf(Buffer, "%d", GC->rtcc->med_f80.ASTCode);
-		skp->Text(1 * W / 16, 4 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(1 * W / 16, 4 * H / 14, "%d", GC->rtcc->med_f80.ASTCode);
 
-		sprintf(Buffer, "%s", GC->rtcc->med_f80.REFSMMAT.c_str());
-		skp->Text(1 * W / 16, 6 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(1 * W / 16, 6 * H / 14, "%s", GC->rtcc->med_f80.REFSMMAT.c_str());
 
-		sprintf(Buffer, "%s", GC->rtcc->med_f80.ManeuverCode.c_str());
-		skp->Text(1 * W / 16, 8 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(1 * W / 16, 8 * H / 14, "%s", GC->rtcc->med_f80.ManeuverCode.c_str());
 
-		sprintf(Buffer, "%d quads %.1lf seconds", GC->rtcc->med_f80.NumQuads, GC->rtcc->med_f80.UllageDT);
-		skp->Text(1 * W / 16, 10 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(1 * W / 16, 10 * H / 14, "%d quads %.1lf seconds", GC->rtcc->med_f80.NumQuads, GC->rtcc->med_f80.UllageDT);
 
 		if (GC->rtcc->med_f80.TrimAngleInd == -1)
 		{
-			skp->Text(1 * W / 16, 12 * H / 14, "Compute trim gimbals", 20);
+			page.Text(1 * W / 16, 12 * H / 14, "Compute trim gimbals", 20);
 		}
 		else
 		{
-			skp->Text(1 * W / 16, 12 * H / 14, "Use system parameter", 20);
+			page.Text(1 * W / 16, 12 * H / 14, "Use system parameter", 20);
 		}
 
-		sprintf(Buffer, "%.2lf", GC->rtcc->med_f80.DockingAngle*DEG);
-		skp->Text(10 * W / 16, 4 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(10 * W / 16, 4 * H / 14, "%.2lf", GC->rtcc->med_f80.DockingAngle*DEG);
 
 		if (GC->rtcc->med_f80.HeadsUp)
 		{
-			skp->Text(10 * W / 16, 6 * H / 14, "Heads Up", 8);
+			page.Text(10 * W / 16, 6 * H / 14, "Heads Up", 8);
 		}
 		else
 		{
-			skp->Text(10 * W / 16, 6 * H / 14, "Heads Down", 10);
+			page.Text(10 * W / 16, 6 * H / 14, "Heads Down", 10);
 		}
 
 		if (GC->rtcc->med_f80.Iterate)
 		{
-			skp->Text(10 * W / 16, 8 * H / 14, "Iterate", 7);
+			page.Text(10 * W / 16, 8 * H / 14, "Iterate", 7);
 		}
 		else
 		{
-			skp->Text(10 * W / 16, 8 * H / 14, "Don't iterate", 13);
+			page.Text(10 * W / 16, 8 * H / 14, "Don't iterate", 13);
 		}
 	}
 	else if (screen == 28)
 	{
-		skp->Text(2 * W / 8, 2 * H / 32, "RETURN TO EARTH DIGITALS (MSK 363)", 34);
-
-		skp->SetFont(font2);
-		skp->SetPen(pen2);
-		skp->SetTextAlign(oapi::Sketchpad::LEFT, oapi::Sketchpad::BASELINE);
-
-		skp->Text(1 * W / 32, 5 * H / 32, "GETR", 4);
-		skp->Text(12 * W / 32, 5 * H / 32, "CM WT", 5);
-		skp->Text(20 * W / 32, 5 * H / 32, "K FAC", 5);
-		skp->Text(26 * W / 32, 5 * H / 32, "STAID", 5);
-
-		skp->Text(9 * W / 32, 6 * H / 32, "PRIMARY", 7);
-		skp->Text(21 * W / 32, 6 * H / 32, "MANUAL", 6);
-		skp->Text(15 * W / 32, 6 * H / 32, "CODE", 4);
-		skp->Text(27 * W / 32, 6 * H / 32, "CODE", 4);
-
-		skp->Line(8 * W / 32, 6 * H / 32, 8 * W / 32, H);
-		skp->Line(20 * W / 32, 6 * H / 32, 20 * W / 32, H);
-
-		skp->Text(1 * W / 32, 7 * H / 32, "STA ID  AM", 10);
-		skp->Text(2 * W / 32, 8 * H / 32, "GETV", 4);
-		skp->Text(2 * W / 32, 9 * H / 32, "AREA THR", 8);
-		skp->Text(2 * W / 32, 10 * H / 32, "MATRIX WT", 9);
-		skp->Text(2 * W / 32, 11 * H / 32, "TAA EP", 6);
-		skp->Text(1 * W / 32, 12 * H / 32, "RLH PLH YLH", 11);
-		skp->Text(1 * W / 32, 13 * H / 32, "RO PI YM", 8);
-		skp->Text(2 * W / 32, 14 * H / 32, "VC BT", 5);
-		skp->Text(2 * W / 32, 15 * H / 32, "VT U DT", 7);
-		skp->Text(2 * W / 32, 16 * H / 32, "PETI", 4);
-		skp->Text(2 * W / 32, 17 * H / 32, "GETI", 4);
-		skp->Text(2 * W / 32, 18 * H / 32, "GMTI", 4);
-		skp->Text(1 * W / 32, 19 * H / 32, "BU PETIR LV", 11);
-		skp->Text(2 * W / 32, 21 * H / 32, "GIR/GCON", 8);
-		skp->Text(2 * W / 32, 22 * H / 32, "GMAX", 4);
-		skp->Text(2 * W / 32, 23 * H / 32, "PETEI", 5);
-		skp->Text(1 * W / 32, 24 * H / 32, "VEI GEI", 7);
-		skp->Text(1 * W / 32, 25 * H / 32, "LAT LNG EI", 10);
-		skp->Text(1 * W / 32, 26 * H / 32, "LAT LNG ML2", 11);
-		skp->Text(1 * W / 32, 27 * H / 32, "LAT LNG T", 9);
-		skp->Text(1 * W / 32, 28 * H / 32, "LAT LNG ZL2", 11);
-		skp->Text(1 * W / 32, 29 * H / 32, "LAT LNG IPB", 11);
-		skp->Text(1 * W / 32, 30 * H / 32, "GETL", 4);
-		skp->Text(5 * W / 32, 30 * H / 32, "MD", 2);
-
-		GET_Display(Buffer, GC->rtcc->SystemParameters.MCGREF*3600.0, false);
-		skp->Text(4 * W / 32, 5 * H / 32, Buffer, strlen(Buffer));
+		page.Text(2 * W / 8, 2 * H / 32, "RETURN TO EARTH DIGITALS (MSK 363)", 34);
+
+		page.SetFont(font2);
+		page.SetPen(pen2);
+		page.SetTextAlign(oapi::Sketchpad::LEFT, oapi::Sketchpad::BASELINE);
+
+		page.Text(1 * W / 32, 5 * H / 32, "GETR", 4);
+		page.Text(12 * W / 32, 5 * H / 32, "CM WT", 5);
+		page.Text(20 * W / 32, 5 * H / 32, "K FAC", 5);
+		page.Text(26 * W / 32, 5 * H / 32, "STAID", 5);
+
+		page.Text(9 * W / 32, 6 * H / 32, "PRIMARY", 7);
+		page.Text(21 * W / 32, 6 * H / 32, "MANUAL", 6);
+		page.Text(15 * W / 32, 6 * H / 32, "CODE", 4);
+		page.Text(27 * W / 32, 6 * H / 32, "CODE", 4);
+
+		page.Line(8 * W / 32, 6 * H / 32, 8 * W / 32, H);
+		page.Line(20 * W / 32, 6 * H / 32, 20 * W / 32, H);
+
+		page.Text(1 * W / 32, 7 * H / 32, "STA ID  AM", 10);
+		page.Text(2 * W / 32, 8 * H / 32, "GETV", 4);
+		page.Text(2 * W / 32, 9 * H / 32, "AREA THR", 8);
+		page.Text(2 * W / 32, 10 * H / 32, "MATRIX WT", 9);
+		page.Text(2 * W / 32, 11 * H / 32, "TAA EP", 6);
+		page.Text(1 * W / 32, 12 * H / 32, "RLH PLH YLH", 11);
+		page.Text(1 * W / 32, 13 * H / 32, "RO PI YM", 8);
+		page.Text(2 * W / 32, 14 * H / 32, "VC BT", 5);
+		page.Text(2 * W / 32, 15 * H / 32, "VT U DT", 7);
+		page.Text(2 * W / 32, 16 * H / 32, "PETI", 4);
+		page.Text(2 * W / 32, 17 * H / 32, "GETI", 4);
+		page.Text(2 * W / 32, 18 * H / 32, "GMTI", 4);
+		page.Text(1 * W / 32, 19 * H / 32, "BU PETIR LV", 11);
+		page.Text(2 * W / 32, 21 * H / 32, "GIR/GCON", 8);
+		page.Text(2 * W / 32, 22 * H / 32, "GMAX", 4);
+		page.Text(2 * W / 32, 23 * H / 32, "PETEI", 5);
+		page.Text(1 * W / 32, 24 * H / 32, "VEI GEI", 7);
+		page.Text(1 * W / 32, 25 * H / 32, "LAT LNG EI", 10);
+		page.Text(1 * W / 32, 26 * H / 32, "LAT LNG ML2", 11);
+		page.Text(1 * W / 32, 27 * H / 32, "LAT LNG T", 9);
+		page.Text(1 * W / 32, 28 * H / 32, "LAT LNG ZL2", 11);
+		page.Text(1 * W / 32, 29 * H / 32, "LAT LNG IPB", 11);
+		page.Text(1 * W / 32, 30 * H / 32, "GETL", 4);
+		page.Text(5 * W / 32, 30 * H / 32, "MD", 2);
+
+		page.Format(4 * W / 32, 5 * H / 32, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->SystemParameters.MCGREF*3600.0, false);
 
 		RTEDigitalSolutionTable *tab;
 		int hh, mm;
@@ -2582,117 +2235,74 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 
 			if (tab->Error)
 			{
-				sprintf_s(Buffer, "Error: %d", tab->Error);
-				skp->Text((11 + 12 * i) * W / 32, 31 * H / 32, Buffer, strlen(Buffer));
+				page.Printf((11 + 12 * i) * W / 32, 31 * H / 32, "Error: %d", tab->Error);
 			}
 
 			if (tab->RTEDCode == "") continue;
 
-			sprintf_s(Buffer, "%s", tab->RTEDCode.c_str());
-			skp->Text((18 + 12 * i) * W / 32, 6 * H / 32, Buffer, strlen(Buffer));
-
-			sprintf_s(Buffer, "%s", tab->StationID.c_str());
-			skp->Text((11 + 12 * i) * W / 32, 7 * H / 32, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%s", tab->ASTSolutionCode.c_str());
-			skp->Text((16 + 12 * i) * W / 32, 7 * H / 32, Buffer, strlen(Buffer));
-
-			GET_Display(Buffer, tab->VectorGET, false);
-			skp->Text((12 + 12 * i) * W / 32, 8 * H / 32, Buffer, strlen(Buffer));
-
-			sprintf_s(Buffer, "%s", tab->LandingSiteID.c_str());
-			skp->Text((12 + 12 * i) * W / 32, 9 * H / 32, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%s", tab->ManeuverCode.c_str());
-			skp->Text((15 + 12 * i) * W / 32, 9 * H / 32, Buffer, strlen(Buffer));
-
-			sprintf_s(Buffer, "%s", tab->SpecifiedREFSMMAT.c_str());
-			skp->Text((11 + 12 * i) * W / 32, 10 * H / 32, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.0lf", tab->VehicleWeight *LBS*1000.0);
-			skp->Text((15 + 12 * i) * W / 32, 10 * H / 32, Buffer, strlen(Buffer));
-
-			sprintf_s(Buffer, "%.0lf", tab->TrueAnomaly*DEG);
-			skp->Text((13 + 12 * i) * W / 32, 11 * H / 32, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%s", tab->PrimaryReentryMode.c_str());
-			skp->Text((15 + 12 * i) * W / 32, 11 * H / 32, Buffer, strlen(Buffer));
-
-			skp->SetTextAlign(oapi::Sketchpad::RIGHT, oapi::Sketchpad::BASELINE);
-
-			sprintf_s(Buffer, "%.1lf", tab->LVLHAtt.x*DEG);
-			skp->Text((12 + 12 * i) * W / 32, 12 * H / 32, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.1lf", tab->LVLHAtt.y*DEG);
-			skp->Text((15 + 12 * i) * W / 32, 12 * H / 32, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.1lf", tab->LVLHAtt.z*DEG);
-			skp->Text((18 + 12 * i) * W / 32, 12 * H / 32, Buffer, strlen(Buffer));
-
-			FormatIMUAngle1(Buffer, tab->IMUAtt.x);
-			skp->Text((12 + 12 * i) * W / 32, 13 * H / 32, Buffer, strlen(Buffer));
-			FormatIMUAngle1(Buffer, tab->IMUAtt.y);
-			skp->Text((15 + 12 * i) * W / 32, 13 * H / 32, Buffer, strlen(Buffer));
-			FormatIMUAngle1(Buffer, tab->IMUAtt.z);
-			skp->Text((18 + 12 * i) * W / 32, 13 * H / 32, Buffer, strlen(Buffer));
-
-			sprintf_s(Buffer, "%.1lf", tab->DVC / 0.3048);
-			skp->Text((13 + 12 * i) * W / 32, 14 * H / 32, Buffer, strlen(Buffer));
+			page.Printf((18 + 12 * i) * W / 32, 6 * H / 32, "%s", tab->RTEDCode.c_str());
+
+			page.Printf((11 + 12 * i) * W / 32, 7 * H / 32, "%s", tab->StationID.c_str());
+			page.Printf((16 + 12 * i) * W / 32, 7 * H / 32, "%s", tab->ASTSolutionCode.c_str());
+
+			page.Format((12 + 12 * i) * W / 32, 8 * H / 32, this, &ApolloRTCCMFD::GET_Display, tab->VectorGET, false);
+
+			page.Printf((12 + 12 * i) * W / 32, 9 * H / 32, "%s", tab->LandingSiteID.c_str());
+			page.Printf((15 + 12 * i) * W / 32, 9 * H / 32, "%s", tab->ManeuverCode.c_str());
+
+			page.Printf((11 + 12 * i) * W / 32, 10 * H / 32, "%s", tab->SpecifiedREFSMMAT.c_str());
+			page.Printf((15 + 12 * i) * W / 32, 10 * H / 32, "%.0lf", tab->VehicleWeight *LBS*1000.0);
+
+			page.Printf((13 + 12 * i) * W / 32, 11 * H / 32, "%.0lf", tab->TrueAnomaly*DEG);
+			page.Printf((15 + 12 * i) * W / 32, 11 * H / 32, "%s", tab->PrimaryReentryMode.c_str());
+
+			page.SetTextAlign(oapi::Sketchpad::RIGHT, oapi::Sketchpad::BASELINE);
+
+			page.Printf((12 + 12 * i) * W / 32, 12 * H / 32, "%.1lf", tab->LVLHAtt.x*DEG);
+			page.Printf((15 + 12 * i) * W / 32, 12 * H / 32, "%.1lf", tab->LVLHAtt.y*DEG);
+			page.Printf((18 + 12 * i) * W / 32, 12 * H / 32, "%.1lf", tab->LVLHAtt.z*DEG);
+
+			page.Format((12 + 12 * i) * W / 32, 13 * H / 32, this, &ApolloRTCCMFD::FormatIMUAngle1, tab->IMUAtt.x);
+			page.Format((15 + 12 * i) * W / 32, 13 * H / 32, this, &ApolloRTCCMFD::FormatIMUAngle1, tab->IMUAtt.y);
+			page.Format((18 + 12 * i) * W / 32, 13 * H / 32, this, &ApolloRTCCMFD::FormatIMUAngle1, tab->IMUAtt.z);
+
+			page.Printf((13 + 12 * i) * W / 32, 14 * H / 32, "%.1lf", tab->DVC / 0.3048);
 			SStoHHMMSS(tab->dt, hh, mm, secs);
-			sprintf_s(Buffer, "%02d:%02.1lf", mm, secs);
-			skp->Text((18 + 12 * i) * W / 32, 14 * H / 32, Buffer, strlen(Buffer));
+			page.Printf((18 + 12 * i) * W / 32, 14 * H / 32, "%02d:%02.1lf", mm, secs);
 
-			sprintf_s(Buffer, "%.1lf", tab->dv / 0.3048);
-			skp->Text((13 + 12 * i) * W / 32, 15 * H / 32, Buffer, strlen(Buffer));
+			page.Printf((13 + 12 * i) * W / 32, 15 * H / 32, "%.1lf", tab->dv / 0.3048);
 			SStoHHMMSS(tab->dt_ullage, hh, mm, secs);
-			sprintf_s(Buffer, "%+d %02d:%02.1lf", tab->NumQuads, mm, secs);
-			skp->Text((18 + 12 * i) * W / 32, 15 * H / 32, Buffer, strlen(Buffer));
-
-			skp->SetTextAlign(oapi::Sketchpad::LEFT, oapi::Sketchpad::BASELINE);
-
-			GET_Display(Buffer, tab->PETI, false);
-			skp->Text((12 + 12 * i) * W / 32, 16 * H / 32, Buffer, strlen(Buffer));
-			GET_Display2(Buffer, tab->GETI);
-			skp->Text((12 + 12 * i) * W / 32, 17 * H / 32, Buffer, strlen(Buffer));
-			GET_Display2(Buffer, tab->GMTI);
-			skp->Text((12 + 12 * i) * W / 32, 18 * H / 32, Buffer, strlen(Buffer));
-
-			sprintf_s(Buffer, "%s", tab->BackupReentryMode.c_str());
-			skp->Text((9 + 12 * i) * W / 32, 19 * H / 32, Buffer, strlen(Buffer));
-			GET_Display(Buffer, tab->RollPET, false);
-			skp->Text((12 + 12 * i) * W / 32, 19 * H / 32, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.1lf", tab->LiftVectorOrientation*DEG);
-			skp->Text((17 + 12 * i) * W / 32, 19 * H / 32, Buffer, strlen(Buffer));
-
-			sprintf_s(Buffer, "%.2lf", tab->GLevelRoll);
-			skp->Text((13 + 12 * i) * W / 32, 21 * H / 32, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.2lf", tab->MaxGLevelPrimary);
-			skp->Text((13 + 12 * i) * W / 32, 22 * H / 32, Buffer, strlen(Buffer));
-			GET_Display(Buffer, tab->ReentryPET, false);
-			skp->Text((12 + 12 * i) * W / 32, 23 * H / 32, Buffer, strlen(Buffer));
-
-			sprintf_s(Buffer, "%.0lf", tab->v_EI / 0.3048);
-			skp->Text((12 + 12 * i) * W / 32, 24 * H / 32, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.2lf", tab->gamma_EI*DEG);
-			skp->Text((16 + 12 * i) * W / 32, 24 * H / 32, Buffer, strlen(Buffer));
-
-			FormatLatitude(Buffer, tab->lat_EI*DEG);
-			skp->Text((10 + 12 * i) * W / 32, 25 * H / 32, Buffer, strlen(Buffer));
-			FormatLongitude(Buffer, tab->lng_EI*DEG);
-			skp->Text((15 + 12 * i) * W / 32, 25 * H / 32, Buffer, strlen(Buffer));
-			FormatLatitude(Buffer, tab->lat_imp_2nd_max*DEG);
-			skp->Text((10 + 12 * i) * W / 32, 26 * H / 32, Buffer, strlen(Buffer));
-			FormatLongitude(Buffer, tab->lng_imp_2nd_max*DEG);
-			skp->Text((15 + 12 * i) * W / 32, 26 * H / 32, Buffer, strlen(Buffer));
-			FormatLatitude(Buffer, tab->lat_imp_tgt*DEG);
-			skp->Text((10 + 12 * i) * W / 32, 27 * H / 32, Buffer, strlen(Buffer));
-			FormatLongitude(Buffer, tab->lng_imp_tgt*DEG);
-			skp->Text((15 + 12 * i) * W / 32, 27 * H / 32, Buffer, strlen(Buffer));
-			FormatLatitude(Buffer, tab->lat_imp_2nd_min*DEG);
-			skp->Text((10 + 12 * i) * W / 32, 28 * H / 32, Buffer, strlen(Buffer));
-			FormatLongitude(Buffer, tab->lng_imp_2nd_min*DEG);
-			skp->Text((15 + 12 * i) * W / 32, 28 * H / 32, Buffer, strlen(Buffer));
-			FormatLatitude(Buffer, tab->lat_imp_bu*DEG);
-			skp->Text((10 + 12 * i) * W / 32, 29 * H / 32, Buffer, strlen(Buffer));
-			FormatLongitude(Buffer, tab->lng_imp_bu*DEG);
-			skp->Text((15 + 12 * i) * W / 32, 29 * H / 32, Buffer, strlen(Buffer));
-
-			GET_Display(Buffer, tab->ImpactGET_prim, false);
-			skp->Text((9 + 12 * i) * W / 32, 30 * H / 32, Buffer, strlen(Buffer));
+			page.Printf((18 + 12 * i) * W / 32, 15 * H / 32, "%+d %02d:%02.1lf", tab->NumQuads, mm, secs);
+
+			page.SetTextAlign(oapi::Sketchpad::LEFT, oapi::Sketchpad::BASELINE);
+
+			page.Format((12 + 12 * i) * W / 32, 16 * H / 32, this, &ApolloRTCCMFD::GET_Display, tab->PETI, false);
+			page.Format((12 + 12 * i) * W / 32, 17 * H / 32, this, &ApolloRTCCMFD::GET_Display2, tab->GETI);
+			page.Format((12 + 12 * i) * W / 32, 18 * H / 32, this, &ApolloRTCCMFD::GET_Display2, tab->GMTI);
+
+			page.Printf((9 + 12 * i) * W / 32, 19 * H / 32, "%s", tab->BackupReentryMode.c_str());
+			page.Format((12 + 12 * i) * W / 32, 19 * H / 32, this, &ApolloRTCCMFD::GET_Display, tab->RollPET, false);
+			page.Printf((17 + 12 * i) * W / 32, 19 * H / 32, "%.1lf", tab->LiftVectorOrientation*DEG);
+
+			page.Printf((13 + 12 * i) * W / 32, 21 * H / 32, "%.2lf", tab->GLevelRoll);
+			page.Printf((13 + 12 * i) * W / 32, 22 * H / 32, "%.2lf", tab->MaxGLevelPrimary);
+			page.Format((12 + 12 * i) * W / 32, 23 * H / 32, this, &ApolloRTCCMFD::GET_Display, tab->ReentryPET, false);
+
+			page.Printf((12 + 12 * i) * W / 32, 24 * H / 32, "%.0lf", tab->v_EI / 0.3048);
+			page.Printf((16 + 12 * i) * W / 32, 24 * H / 32, "%.2lf", tab->gamma_EI*DEG);
+
+			page.Format((10 + 12 * i) * W / 32, 25 * H / 32, this, &ApolloRTCCMFD::FormatLatitude, tab->lat_EI*DEG);
+			page.Format((15 + 12 * i) * W / 32, 25 * H / 32, this, &ApolloRTCCMFD::FormatLongitude, tab->lng_EI*DEG);
+			page.Format((10 + 12 * i) * W / 32, 26 * H / 32, this, &ApolloRTCCMFD::FormatLatitude, tab->lat_imp_2nd_max*DEG);
+			page.Format((15 + 12 * i) * W / 32, 26 * H / 32, this, &ApolloRTCCMFD::FormatLongitude, tab->lng_imp_2nd_max*DEG);
+			page.Format((10 + 12 * i) * W / 32, 27 * H / 32, this, &ApolloRTCCMFD::FormatLatitude, tab->lat_imp_tgt*DEG);
+			page.Format((15 + 12 * i) * W / 32, 27 * H / 32, this, &ApolloRTCCMFD::FormatLongitude, tab->lng_imp_tgt*DEG);
+			page.Format((10 + 12 * i) * W / 32, 28 * H / 32, this, &ApolloRTCCMFD::FormatLatitude, tab->lat_imp_2nd_min*DEG);
+			page.Format((15 + 12 * i) * W / 32, 28 * H / 32, this, &ApolloRTCCMFD::FormatLongitude, tab->lng_imp_2nd_min*DEG);
+			page.Format((10 + 12 * i) * W / 32, 29 * H / 32, this, &ApolloRTCCMFD::FormatLatitude, tab->lat_imp_bu*DEG);
+			page.Format((15 + 12 * i) * W / 32, 29 * H / 32, this, &ApolloRTCCMFD::FormatLongitude, tab->lng_imp_bu*DEG);
+
+			page.Format((9 + 12 * i) * W / 32, 30 * H / 32, this, &ApolloRTCCMFD::GET_Display, tab->ImpactGET_prim, false);
 			if (tab->md_lat > 0)
 			{
 				sprintf_s(Buffer, "%.0lfN", tab->md_lat / 1852.0);
@@ -2701,7 +2311,7 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			{
 				sprintf_s(Buffer, "%.0lfS", abs(tab->md_lat / 1852.0));
 			}
-			skp->Text((15 + 12 * i) * W / 32, 30 * H / 32, Buffer, strlen(Buffer));
+			page.Text((15 + 12 * i) * W / 32, 30 * H / 32, Buffer, strlen(Buffer));
 			if (tab->md_lng > 0)
 			{
 				sprintf_s(Buffer, "%.0lfE", tab->md_lng / 1852.0);
@@ -2710,75 +2320,67 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			{
 				sprintf_s(Buffer, "%.0lfW", abs(tab->md_lng / 1852.0));
 			}
-			skp->Text((17 + 12 * i) * W / 32, 30 * H / 32, Buffer, strlen(Buffer));
+			page.Text((17 + 12 * i) * W / 32, 30 * H / 32, Buffer, strlen(Buffer));
 		}
 	}
 	else if (screen == 29)
 	{
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
-		skp->Text(4 * W / 8, 1 * H / 14, "RETURN TO EARTH TARGET (MSK 366)", 32);
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
-
-		skp->SetFont(font2);
-
-		skp->Text(2 * W / 32, 4 * H / 28, "CONSTRAINTS", 11);
-		skp->Text(2 * W / 32, 6 * H / 28, "DVMAX", 5);
-		skp->Text(2 * W / 32, 8 * H / 28, "TZMIN", 5);
-		skp->Text(2 * W / 32, 10 * H / 28, "TZMAX", 5);
-		skp->Text(2 * W / 32, 12 * H / 28, "GMAX", 4);
-		skp->Text(2 * W / 32, 14 * H / 28, "HMINMC", 6);
-		skp->Text(2 * W / 32, 16 * H / 28, "IRMAX", 5);
-		skp->Text(2 * W / 32, 18 * H / 28, "RRBIAS", 6);
-		skp->Text(2 * W / 32, 20 * H / 28, "VRMAX", 5);
-		skp->Text(2 * W / 32, 22 * H / 28, "MOTION", 6);
-		skp->Text(2 * W / 32, 24 * H / 28, "TGTLN", 5);
-		skp->Text(2 * W / 32, 26 * H / 28, "VECID", 5);
-
-		skp->Text(20 * W / 32, 4 * H / 28, "ATP", 5);
-		skp->Text(20 * W / 32, 18 * H / 28, "PTP", 5);
-
-		skp->SetTextAlign(oapi::Sketchpad::RIGHT);
-
-		sprintf(Buffer, "%.0f", GC->rtcc->PZREAP.DVMAX);
-		skp->Text(10 * W / 32, 6 * H / 28, Buffer, strlen(Buffer));
-		GET_Display(Buffer, GC->rtcc->PZREAP.TZMIN*3600.0, false);
-		skp->Text(10 * W / 32, 8 * H / 28, Buffer, strlen(Buffer));
-		GET_Display(Buffer, GC->rtcc->PZREAP.TZMAX*3600.0, false);
-		skp->Text(10 * W / 32, 10 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%.1f", GC->rtcc->PZREAP.GMAX);
-		skp->Text(10 * W / 32, 12 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%.1f", GC->rtcc->PZREAP.HMINMC);
-		skp->Text(10 * W / 32, 14 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%.2f", GC->rtcc->PZREAP.IRMAX);
-		skp->Text(10 * W / 32, 16 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%.0f", GC->rtcc->PZREAP.RRBIAS);
-		skp->Text(10 * W / 32, 18 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%.0f", GC->rtcc->PZREAP.VRMAX);
-		skp->Text(10 * W / 32, 20 * H / 28, Buffer, strlen(Buffer));
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
+		page.Text(4 * W / 8, 1 * H / 14, "RETURN TO EARTH TARGET (MSK 366)", 32);
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
+
+		page.SetFont(font2);
+
+		page.Text(2 * W / 32, 4 * H / 28, "CONSTRAINTS", 11);
+		page.Text(2 * W / 32, 6 * H / 28, "DVMAX", 5);
+		page.Text(2 * W / 32, 8 * H / 28, "TZMIN", 5);
+		page.Text(2 * W / 32, 10 * H / 28, "TZMAX", 5);
+		page.Text(2 * W / 32, 12 * H / 28, "GMAX", 4);
+		page.Text(2 * W / 32, 14 * H / 28, "HMINMC", 6);
+		page.Text(2 * W / 32, 16 * H / 28, "IRMAX", 5);
+		page.Text(2 * W / 32, 18 * H / 28, "RRBIAS", 6);
+		page.Text(2 * W / 32, 20 * H / 28, "VRMAX", 5);
+		page.Text(2 * W / 32, 22 * H / 28, "MOTION", 6);
+		page.Text(2 * W / 32, 24 * H / 28, "TGTLN", 5);
+		page.Text(2 * W / 32, 26 * H / 28, "VECID", 5);
+
+		page.Text(20 * W / 32, 4 * H / 28, "ATP", 5);
+		page.Text(20 * W / 32, 18 * H / 28, "PTP", 5);
+
+		page.SetTextAlign(oapi::Sketchpad::RIGHT);
+
+		page.Printf(10 * W / 32, 6 * H / 28, "%.0f", GC->rtcc->PZREAP.DVMAX);
+		page.Format(10 * W / 32, 8 * H / 28, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->PZREAP.TZMIN*3600.0, false);
+		page.Format(10 * W / 32, 10 * H / 28, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->PZREAP.TZMAX*3600.0, false);
+		page.Printf(10 * W / 32, 12 * H / 28, "%.1f", GC->rtcc->PZREAP.GMAX);
+		page.Printf(10 * W / 32, 14 * H / 28, "%.1f", GC->rtcc->PZREAP.HMINMC);
+		page.Printf(10 * W / 32, 16 * H / 28, "%.2f", GC->rtcc->PZREAP.IRMAX);
+		page.Printf(10 * W / 32, 18 * H / 28, "%.0f", GC->rtcc->PZREAP.RRBIAS);
+		page.Printf(10 * W / 32, 20 * H / 28, "%.0f", GC->rtcc->PZREAP.VRMAX);
 
 		if (GC->rtcc->PZREAP.MOTION == 0)
 		{
-			skp->Text(10 * W / 32, 22 * H / 28, "EITHER", 6);
+			page.Text(10 * W / 32, 22 * H / 28, "EITHER", 6);
 		}
 		else if (GC->rtcc->PZREAP.MOTION == 1)
 		{
-			skp->Text(10 * W / 32, 22 * H / 28, "DIRECT", 6);
+			page.Text(10 * W / 32, 22 * H / 28, "DIRECT", 6);
 		}
 		else
 		{
-			skp->Text(10 * W / 32, 22 * H / 28, "CIRCUM", 6);
+			page.Text(10 * W / 32, 22 * H / 28, "CIRCUM", 6);
 		}
 
 		if (GC->rtcc->PZREAP.TGTLN == 0)
 		{
-			skp->Text(10 * W / 32, 24 * H / 28, "SHALLOW", 7);
+			page.Text(10 * W / 32, 24 * H / 28, "SHALLOW", 7);
 		}
 		else
 		{
-			skp->Text(10 * W / 32, 24 * H / 28, "STEEP", 5);
+			page.Text(10 * W / 32, 24 * H / 28, "STEEP", 5);
 		}
 
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
 
 		for (unsigned i = 0;i < 5;i++)
 		{
@@ -2789,7 +2391,7 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			}
 
 			sprintf(Buffer, GC->rtcc->PZREAP.ATPSite[i].c_str());
-			skp->Text((11 + i * 4) * W / 32, 6 * H / 28, Buffer, strlen(Buffer));
+			page.Text((11 + i * 4) * W / 32, 6 * H / 28, Buffer, strlen(Buffer));
 			for (unsigned j = 0;j < 5;j++)
 			{
 				//If current element isn't valid, skip the rest
@@ -2798,26 +2400,20 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 					break;
 				}
 
-				sprintf(Buffer, "%.2f", GC->rtcc->PZREAP.ATPCoordinates[i][2 * j] * DEG);
-				skp->Text((11 + i * 4) * W / 32, (7 + j * 2) * H / 28, Buffer, strlen(Buffer));
-				sprintf(Buffer, "%.2f", GC->rtcc->PZREAP.ATPCoordinates[i][2 * j + 1] * DEG);
-				skp->Text((11 + i * 4) * W / 32, (8 + j * 2) * H / 28, Buffer, strlen(Buffer));
+				page.Printf((11 + i * 4) * W / 32, (7 + j * 2) * H / 28, "%.2f", GC->rtcc->PZREAP.ATPCoordinates[i][2 * j] * DEG);
+				page.Printf((11 + i * 4) * W / 32, (8 + j * 2) * H / 28, "%.2f", GC->rtcc->PZREAP.ATPCoordinates[i][2 * j + 1] * DEG);
 			}
 		}
 	}
 	else if (screen == 30)
 	{
-		skp->Text(6 * W / 8, (int)(0.5 * H / 14), "Entry Update", 12);
+		page.Text(6 * W / 8, (int)(0.5 * H / 14), "Entry Update", 12);
 
-		sprintf(Buffer, "Lat:  %f ", G->EntryLatcor*DEG);
-		skp->Text(5 * W / 8, 5 * H / 14, Buffer, strlen(Buffer));
-		sprintf(Buffer, "Long: %f ", G->EntryLngcor*DEG);
-		skp->Text(5 * W / 8, 6 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(5 * W / 8, 5 * H / 14, "Lat:  %f ", G->EntryLatcor*DEG);
+		page.Printf(5 * W / 8, 6 * H / 14, "Long: %f ", G->EntryLngcor*DEG);
 
-		sprintf(Buffer, "Desired Range: %.1f NM", G->entryrange);
-		skp->Text(4 * W / 8, 8 * H / 14, Buffer, strlen(Buffer));
-		sprintf(Buffer, "Actual Range:  %.1f NM", G->EntryRTGO);
-		skp->Text(4 * W / 8, 9 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(4 * W / 8, 8 * H / 14, "Desired Range: %.1f NM", G->entryrange);
+		page.Printf(4 * W / 8, 9 * H / 14, "Actual Range:  %.1f NM", G->EntryRTGO);
 	}
 	else if (screen == 31)
 	{
@@ -2825,50 +2421,50 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 	}
 	else if (screen == 32)
 	{
-		skp->Text(1 * W / 8, 2 * H / 14, "Two Impulse Processor", 21);
-		skp->Text(1 * W / 8, 4 * H / 14, "Coelliptic Sequence Processor", 29);
-		skp->Text(1 * W / 8, 6 * H / 14, "Docking Initiation Processor", 28);
-		skp->Text(1 * W / 8, 8 * H / 14, "Skylab Rendezvous", 17);
-		skp->Text(1 * W / 8, 10 * H / 14, "TPI Times", 9);
+		page.Text(1 * W / 8, 2 * H / 14, "Two Impulse Processor", 21);
+		page.Text(1 * W / 8, 4 * H / 14, "Coelliptic Sequence Processor", 29);
+		page.Text(1 * W / 8, 6 * H / 14, "Docking Initiation Processor", 28);
+		page.Text(1 * W / 8, 8 * H / 14, "Skylab Rendezvous", 17);
+		page.Text(1 * W / 8, 10 * H / 14, "TPI Times", 9);
 	}
 	else if (screen == 33)
 	{
-		skp->Text(5 * W / 8, (int)(0.5 * H / 14), "Docking Initiate", 16);
+		page.Text(5 * W / 8, (int)(0.5 * H / 14), "Docking Initiate", 16);
 
-		skp->Text(1 * W / 16, 2 * H / 14, "Init", 4);
+		page.Text(1 * W / 16, 2 * H / 14, "Init", 4);
 
 		if (G->DKI_Profile == 0)
 		{
-			skp->Text(1 * W / 16, 4 * H / 14, "CSI/CDH Sequence", 16);
+			page.Text(1 * W / 16, 4 * H / 14, "CSI/CDH Sequence", 16);
 		}
 		else if (G->DKI_Profile == 1)
 		{
-			skp->Text(1 * W / 16, 4 * H / 14, "HAM-CSI/CDH Sequence", 20);
+			page.Text(1 * W / 16, 4 * H / 14, "HAM-CSI/CDH Sequence", 20);
 		}
 		else if (G->DKI_Profile == 2)
 		{
-			skp->Text(1 * W / 16, 4 * H / 14, "Rescue-2 Sequence", 17);
+			page.Text(1 * W / 16, 4 * H / 14, "Rescue-2 Sequence", 17);
 		}
 		else if (G->DKI_Profile == 3)
 		{
-			skp->Text(1 * W / 16, 4 * H / 14, "TPI Time Only", 13);
+			page.Text(1 * W / 16, 4 * H / 14, "TPI Time Only", 13);
 		}
 		else
 		{
-			skp->Text(1 * W / 16, 4 * H / 14, "High Dwell Sequence", 19);
+			page.Text(1 * W / 16, 4 * H / 14, "High Dwell Sequence", 19);
 		}
 
 		if (GC->MissionPlanningActive)
 		{
 			if (GC->rtcc->med_k00.ChaserVehicle == 1)
 			{
-				skp->Text(1 * W / 16, 6 * H / 14, "Chaser: CSM", 11);
-				skp->Text(1 * W / 16, 7 * H / 14, "Target: LEM", 11);
+				page.Text(1 * W / 16, 6 * H / 14, "Chaser: CSM", 11);
+				page.Text(1 * W / 16, 7 * H / 14, "Target: LEM", 11);
 			}
 			else
 			{
-				skp->Text(1 * W / 16, 6 * H / 14, "Chaser: LEM", 11);
-				skp->Text(1 * W / 16, 7 * H / 14, "Target: CSM", 11);
+				page.Text(1 * W / 16, 6 * H / 14, "Chaser: LEM", 11);
+				page.Text(1 * W / 16, 7 * H / 14, "Target: CSM", 11);
 			}
 
 			if (GC->rtcc->med_k10.MLDTime < 0)
@@ -2879,12 +2475,11 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			{
 				GET_Display(Buffer, GC->rtcc->med_k10.MLDTime);
 			}
-			skp->Text(1 * W / 16, 8 * H / 14, Buffer, strlen(Buffer));
+			page.Text(1 * W / 16, 8 * H / 14, Buffer, strlen(Buffer));
 		}
 		else
 		{
-			sprintf_s(Buffer, "Chaser: %s", G->vessel->GetName());
-			skp->Text(1 * W / 16, 6 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(1 * W / 16, 6 * H / 14, "Chaser: %s", G->vessel->GetName());
 			if (G->target)
 			{
 				sprintf_s(Buffer, "Target: %s", G->target->GetName());
@@ -2893,374 +2488,298 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			{
 				sprintf_s(Buffer, "Target: Not set!");
 			}
-			skp->Text(1 * W / 16, 7 * H / 14, Buffer, strlen(Buffer));
+			page.Text(1 * W / 16, 7 * H / 14, Buffer, strlen(Buffer));
 		}
 
 		if (G->DKI_Profile != 3)
 		{
-			GET_Display(Buffer, G->DKI_TIG);
-			skp->Text(1 * W / 16, 10 * H / 14, Buffer, strlen(Buffer));
+			page.Format(1 * W / 16, 10 * H / 14, this, &ApolloRTCCMFD::GET_Display, G->DKI_TIG, true);
 		}
-		GET_Display(Buffer, G->t_TPIguess);
-		skp->Text(1 * W / 16, 12 * H / 14, Buffer, strlen(Buffer));
+		page.Format(1 * W / 16, 12 * H / 14, this, &ApolloRTCCMFD::GET_Display, G->t_TPIguess, true);
 
 		if (G->DKI_Profile != 3)
 		{
-			skp->Text(5 * W / 8, 5 * H / 21, "Phasing:", 8);
-			GET_Display(Buffer, G->DKI_TIG);
-			skp->Text(5 * W / 8, 6 * H / 21, Buffer, strlen(Buffer));
+			page.Text(5 * W / 8, 5 * H / 21, "Phasing:", 8);
+			page.Format(5 * W / 8, 6 * H / 21, this, &ApolloRTCCMFD::GET_Display, G->DKI_TIG, true);
 
-			sprintf(Buffer, "%+07.1f", G->DKI_DV.x / 0.3048);
-			skp->Text(5 * W / 8, 7 * H / 21, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%+07.1f", G->DKI_DV.y / 0.3048);
-			skp->Text(5 * W / 8, 8 * H / 21, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%+07.1f", G->DKI_DV.z / 0.3048);
-			skp->Text(5 * W / 8, 9 * H / 21, Buffer, strlen(Buffer));
+			page.Printf(5 * W / 8, 7 * H / 21, "%+07.1f", G->DKI_DV.x / 0.3048);
+			page.Printf(5 * W / 8, 8 * H / 21, "%+07.1f", G->DKI_DV.y / 0.3048);
+			page.Printf(5 * W / 8, 9 * H / 21, "%+07.1f", G->DKI_DV.z / 0.3048);
 
 			if (G->DKI_Profile == 1 || G->DKI_Profile == 4)
 			{
-				skp->Text(4 * W / 8, 13 * H / 21, "Boost:", 6);
-				GET_Display(Buffer, G->dkiresult.t_Boost);
-				skp->Text(5 * W / 8, 13 * H / 21, Buffer, strlen(Buffer));
-				sprintf(Buffer, "%+07.1f ft/s", G->dkiresult.dv_Boost / 0.3048);
-				skp->Text(5 * W / 8, 14 * H / 21, Buffer, strlen(Buffer));
+				page.Text(4 * W / 8, 13 * H / 21, "Boost:", 6);
+				page.Format(5 * W / 8, 13 * H / 21, this, &ApolloRTCCMFD::GET_Display, G->dkiresult.t_Boost, true);
+				page.Printf(5 * W / 8, 14 * H / 21, "%+07.1f ft/s", G->dkiresult.dv_Boost / 0.3048);
 
 				if (G->DKI_Profile == 1)
 				{
-					skp->Text(4 * W / 8, 15 * H / 21, "HAM:", 4);
-					GET_Display(Buffer, G->dkiresult.t_HAM);
-					skp->Text(5 * W / 8, 15 * H / 21, Buffer, strlen(Buffer));
+					page.Text(4 * W / 8, 15 * H / 21, "HAM:", 4);
+					page.Format(5 * W / 8, 15 * H / 21, this, &ApolloRTCCMFD::GET_Display, G->dkiresult.t_HAM, true);
 				}
 			}
 
-			skp->Text(4 * W / 8, 16 * H / 21, "CSI:", 4);
-			GET_Display(Buffer, G->dkiresult.t_CSI);
-			skp->Text(5 * W / 8, 16 * H / 21, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%+07.1f ft/s", G->dkiresult.dv_CSI / 0.3048);
-			skp->Text(5 * W / 8, 17 * H / 21, Buffer, strlen(Buffer));
+			page.Text(4 * W / 8, 16 * H / 21, "CSI:", 4);
+			page.Format(5 * W / 8, 16 * H / 21, this, &ApolloRTCCMFD::GET_Display, G->dkiresult.t_CSI, true);
+			page.Printf(5 * W / 8, 17 * H / 21, "%+07.1f ft/s", G->dkiresult.dv_CSI / 0.3048);
 
-			skp->Text(4 * W / 8, 18 * H / 21, "CDH:", 4);
-			GET_Display(Buffer, G->dkiresult.t_CDH);
-			skp->Text(5 * W / 8, 18 * H / 21, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%+07.1f ft/s", length(G->dkiresult.DV_CDH) / 0.3048);
-			skp->Text(5 * W / 8, 19 * H / 21, Buffer, strlen(Buffer));
+			page.Text(4 * W / 8, 18 * H / 21, "CDH:", 4);
+			page.Format(5 * W / 8, 18 * H / 21, this, &ApolloRTCCMFD::GET_Display, G->dkiresult.t_CDH, true);
+			page.Printf(5 * W / 8, 19 * H / 21, "%+07.1f ft/s", length(G->dkiresult.DV_CDH) / 0.3048);
 		}
 
-		skp->Text(4 * W / 8, 20 * H / 21, "TPI:", 4);
-		GET_Display(Buffer, G->dkiresult.t_TPI);
-		skp->Text(5 * W / 8, 20 * H / 21, Buffer, strlen(Buffer));
+		page.Text(4 * W / 8, 20 * H / 21, "TPI:", 4);
+		page.Format(5 * W / 8, 20 * H / 21, this, &ApolloRTCCMFD::GET_Display, G->dkiresult.t_TPI, true);
 
 	}
 	else if (screen == 34)
 	{
-		skp->Text(5 * W / 8, (int)(0.5 * H / 14), "DKI Options", 11);
+		page.Text(5 * W / 8, (int)(0.5 * H / 14), "DKI Options", 11);
 
 		if (G->DKI_Maneuver_Line)
 		{
-			skp->Text(1 * W / 8, 2 * H / 14, "Maneuver Line", 13);
+			page.Text(1 * W / 8, 2 * H / 14, "Maneuver Line", 13);
 		}
 		else
 		{
-			skp->Text(1 * W / 8, 2 * H / 14, "Specified DTs", 13);
+			page.Text(1 * W / 8, 2 * H / 14, "Specified DTs", 13);
 		}
 
 		if (G->DKI_Radial_DV)
 		{
-			skp->Text(1 * W / 8, 4 * H / 14, "-50 ft/s radial component", 25);
+			page.Text(1 * W / 8, 4 * H / 14, "-50 ft/s radial component", 25);
 		}
 		else
 		{
-			skp->Text(1 * W / 8, 4 * H / 14, "Horizontal maneuver", 19);
+			page.Text(1 * W / 8, 4 * H / 14, "Horizontal maneuver", 19);
 		}
 
 		if (G->DKI_TPI_Mode == 0)
 		{
-			skp->Text(1 * W / 8, 6 * H / 14, "TPI on time", 11);
+			page.Text(1 * W / 8, 6 * H / 14, "TPI on time", 11);
 		}
 		else if (G->DKI_TPI_Mode == 1)
 		{
-			skp->Text(1 * W / 8, 6 * H / 14, "TPI at orbital midnight", 23);
+			page.Text(1 * W / 8, 6 * H / 14, "TPI at orbital midnight", 23);
 		}
 		else
 		{
-			skp->Text(1 * W / 8, 6 * H / 14, "TPI at X min before sunrise:", 28);
+			page.Text(1 * W / 8, 6 * H / 14, "TPI at X min before sunrise:", 28);
 		}
 
 		if (G->DKI_TPI_Mode == 2)
 		{
-			sprintf(Buffer, "%.1f min", G->DKI_dt_TPI_sunrise / 60.0);
-			skp->Text(1 * W / 8, 8 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(1 * W / 8, 8 * H / 14, "%.1f min", G->DKI_dt_TPI_sunrise / 60.0);
 		}
 
-		sprintf(Buffer, "%d", G->DKI_N_HC);
-		skp->Text(1 * W / 8, 10 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(1 * W / 8, 10 * H / 14, "%d", G->DKI_N_HC);
 
-		sprintf(Buffer, "%d", G->DKI_N_PB);
-		skp->Text(1 * W / 8, 12 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(1 * W / 8, 12 * H / 14, "%d", G->DKI_N_PB);
 
 		if (G->DKI_Maneuver_Line == false)
 		{
-			sprintf(Buffer, "%.1f min", G->DKI_dt_PBH / 60.0);
-			skp->Text(6 * W / 8, 2 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(6 * W / 8, 2 * H / 14, "%.1f min", G->DKI_dt_PBH / 60.0);
 
-			sprintf(Buffer, "%.1f min", G->DKI_dt_BHAM / 60.0);
-			skp->Text(6 * W / 8, 4 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(6 * W / 8, 4 * H / 14, "%.1f min", G->DKI_dt_BHAM / 60.0);
 
-			sprintf(Buffer, "%.1f min", G->DKI_dt_HAMH / 60.0);
-			skp->Text(6 * W / 8, 6 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(6 * W / 8, 6 * H / 14, "%.1f min", G->DKI_dt_HAMH / 60.0);
 		}
 	}
 	else if (screen == 35)
 	{
-		skp->Text(5 * W / 8, (int)(0.5 * H / 14), "DAP PAD", 7);
+		page.Text(5 * W / 8, (int)(0.5 * H / 14), "DAP PAD", 7);
 
-		sprintf(Buffer, "%+06.0f WT N47", G->DAP_PAD.ThisVehicleWeight);
-		skp->Text((int)(3.5 * W / 8), 5 * H / 21, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%+06.0f", G->DAP_PAD.OtherVehicleWeight);
-		skp->Text((int)(3.5 * W / 8), 6 * H / 21, Buffer, strlen(Buffer));
+		page.Printf((int)(3.5 * W / 8), 5 * H / 21, "%+06.0f WT N47", G->DAP_PAD.ThisVehicleWeight);
+		page.Printf((int)(3.5 * W / 8), 6 * H / 21, "%+06.0f", G->DAP_PAD.OtherVehicleWeight);
 
-		sprintf(Buffer, "%+07.2f GMBL N48", G->DAP_PAD.PitchTrim);
-		skp->Text((int)(3.5 * W / 8), 7 * H / 21, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%+07.2f", G->DAP_PAD.YawTrim);
-		skp->Text((int)(3.5 * W / 8), 8 * H / 21, Buffer, strlen(Buffer));
+		page.Printf((int)(3.5 * W / 8), 7 * H / 21, "%+07.2f GMBL N48", G->DAP_PAD.PitchTrim);
+		page.Printf((int)(3.5 * W / 8), 8 * H / 21, "%+07.2f", G->DAP_PAD.YawTrim);
 	}
 	else if (screen == 36)
 	{
-		skp->Text(6 * W / 8, (int)(0.5 * H / 14), "LVDC", 4);
+		page.Text(6 * W / 8, (int)(0.5 * H / 14), "LVDC", 4);
 
-		sprintf(Buffer, "Launch Azimuth: %.4f", G->LVDCLaunchAzimuth*DEG);
-		skp->Text(1 * W / 8, 2 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(1 * W / 8, 2 * H / 14, "Launch Azimuth: %.4f", G->LVDCLaunchAzimuth*DEG);
 	}
 	else if (screen == 37)
 	{
 		if (G->AGCEphemOption == 0)
 		{
-			skp->Text(4 * W / 8, (int)(0.5 * H / 14), "AGC Ephemeris Generator", 23);
+			page.Text(4 * W / 8, (int)(0.5 * H / 14), "AGC Ephemeris Generator", 23);
 
-			skp->Text(1 * W / 8, 2 * H / 14, "Epoch of BRCS:", 14);
-			skp->Text(1 * W / 8, 4 * H / 14, "TEphemZero:", 11);
+			page.Text(1 * W / 8, 2 * H / 14, "Epoch of BRCS:", 14);
+			page.Text(1 * W / 8, 4 * H / 14, "TEphemZero:", 11);
 
-			sprintf(Buffer, "%f", G->AGCEphemBRCSEpoch);
-			skp->Text(4 * W / 8, 2 * H / 14, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%f", G->AGCEphemTEphemZero);
-			skp->Text(4 * W / 8, 4 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(4 * W / 8, 2 * H / 14, "%f", G->AGCEphemBRCSEpoch);
+			page.Printf(4 * W / 8, 4 * H / 14, "%f", G->AGCEphemTEphemZero);
 		}
 		else
 		{
-			skp->Text(4 * W / 8, (int)(0.5 * H / 14), "AGC Correction Vectors", 23);
+			page.Text(4 * W / 8, (int)(0.5 * H / 14), "AGC Correction Vectors", 23);
 
-			skp->Text(1 * W / 8, 6 * H / 14, "TEPHEM:", 7);
-			sprintf(Buffer, "%f", G->AGCEphemTEPHEM);
-			skp->Text(4 * W / 8, 6 * H / 14, Buffer, strlen(Buffer));
+			page.Text(1 * W / 8, 6 * H / 14, "TEPHEM:", 7);
+			page.Printf(4 * W / 8, 6 * H / 14, "%f", G->AGCEphemTEPHEM);
 
-			skp->Text(1 * W / 8, 10 * H / 14, "TLAND:", 6);
-			GET_Display(Buffer, G->AGCEphemTLAND);
-			skp->Text(4 * W / 8, 10 * H / 14, Buffer, strlen(Buffer));
+			page.Text(1 * W / 8, 10 * H / 14, "TLAND:", 6);
+			page.Format(4 * W / 8, 10 * H / 14, this, &ApolloRTCCMFD::GET_Display, G->AGCEphemTLAND, true);
 
-			skp->Text(1 * W / 8, 12 * H / 14, "Mission:", 8);
-			sprintf(Buffer, "%d", G->AGCEphemMission);
-			skp->Text(4 * W / 8, 12 * H / 14, Buffer, strlen(Buffer));
+			page.Text(1 * W / 8, 12 * H / 14, "Mission:", 8);
+			page.Printf(4 * W / 8, 12 * H / 14, "%d", G->AGCEphemMission);
 
 			if (G->AGCEphemIsCMC)
 			{
-				skp->Text(7 * W / 8, 6 * H / 14, "CMC", 3);
+				page.Text(7 * W / 8, 6 * H / 14, "CMC", 3);
 			}
 			else
 			{
-				skp->Text(7 * W / 8, 6 * H / 14, "LGC", 3);
+				page.Text(7 * W / 8, 6 * H / 14, "LGC", 3);
 			}
 		}
 
 
-		skp->Text(1 * W / 8, 8 * H / 14, "TIMEM0:", 7);
-		sprintf(Buffer, "%f", G->AGCEphemTIMEM0);
-		skp->Text(4 * W / 8, 8 * H / 14, Buffer, strlen(Buffer));
+		page.Text(1 * W / 8, 8 * H / 14, "TIMEM0:", 7);
+		page.Printf(4 * W / 8, 8 * H / 14, "%f", G->AGCEphemTIMEM0);
 	}
 	else if (screen == 38)
 	{
-		skp->Text(4 * W / 8, (int)(0.5 * H / 14), "Lunar Ascent Processor", 22);
+		page.Text(4 * W / 8, (int)(0.5 * H / 14), "Lunar Ascent Processor", 22);
 
-		GET_Display2(Buffer, G->t_LunarLiftoff);
-		skp->Text(1 * W / 8, 2 * H / 14, Buffer, strlen(Buffer));
+		page.Format(1 * W / 8, 2 * H / 14, this, &ApolloRTCCMFD::GET_Display2, G->t_LunarLiftoff);
 
-		sprintf(Buffer, "%+07.1f ft/s", GC->rtcc->PZLTRT.InsertionHorizontalVelocity / 0.3048);
-		skp->Text(1 * W / 8, 4 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(1 * W / 8, 4 * H / 14, "%+07.1f ft/s", GC->rtcc->PZLTRT.InsertionHorizontalVelocity / 0.3048);
 
-		sprintf(Buffer, "%+07.1f ft/s", GC->rtcc->PZLTRT.InsertionRadialVelocity / 0.3048);
-		skp->Text(1 * W / 8, 6 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(1 * W / 8, 6 * H / 14, "%+07.1f ft/s", GC->rtcc->PZLTRT.InsertionRadialVelocity / 0.3048);
 
-		skp->Text(1 * W / 8, 9 * H / 14, "Powered Flight Arc:", 19);
-		sprintf(Buffer, "%.3f", GC->rtcc->PZLTRT.PoweredFlightArc*DEG);
-		skp->Text(1 * W / 8, 10 * H / 14, Buffer, strlen(Buffer));
-		skp->Text(1 * W / 8, 11 * H / 14, "Powered Flight Time:", 20);
-		sprintf(Buffer, "%.1f s", GC->rtcc->PZLTRT.PoweredFlightTime);
-		skp->Text(1 * W / 8, 12 * H / 14, Buffer, strlen(Buffer));
+		page.Text(1 * W / 8, 9 * H / 14, "Powered Flight Arc:", 19);
+		page.Printf(1 * W / 8, 10 * H / 14, "%.3f", GC->rtcc->PZLTRT.PoweredFlightArc*DEG);
+		page.Text(1 * W / 8, 11 * H / 14, "Powered Flight Time:", 20);
+		page.Printf(1 * W / 8, 12 * H / 14, "%.1f s", GC->rtcc->PZLTRT.PoweredFlightTime);
 
 		if (!GC->MissionPlanningActive)
 		{
 			if (G->target != NULL)
 			{
 				sprintf(Buffer, G->target->GetName());
-				skp->Text(5 * W / 8, 2 * H / 14, Buffer, strlen(Buffer));
+				page.Text(5 * W / 8, 2 * H / 14, Buffer, strlen(Buffer));
 			}
 			else
 			{
-				skp->Text(5 * W / 8, 2 * H / 14, "No Target!", 10);
+				page.Text(5 * W / 8, 2 * H / 14, "No Target!", 10);
 			}
 		}
 
-		sprintf(Buffer, "%f", GC->rtcc->JZLAI.sv_Insertion.R.x);
-		skp->Text(5 * W / 8, 4 * H / 14, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%f", GC->rtcc->JZLAI.sv_Insertion.R.y);
-		skp->Text(5 * W / 8, 5 * H / 14, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%f", GC->rtcc->JZLAI.sv_Insertion.R.z);
-		skp->Text(5 * W / 8, 6 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(5 * W / 8, 4 * H / 14, "%f", GC->rtcc->JZLAI.sv_Insertion.R.x);
+		page.Printf(5 * W / 8, 5 * H / 14, "%f", GC->rtcc->JZLAI.sv_Insertion.R.y);
+		page.Printf(5 * W / 8, 6 * H / 14, "%f", GC->rtcc->JZLAI.sv_Insertion.R.z);
 
-		sprintf(Buffer, "%f", GC->rtcc->JZLAI.sv_Insertion.V.x);
-		skp->Text(5 * W / 8, 8 * H / 14, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%f", GC->rtcc->JZLAI.sv_Insertion.V.y);
-		skp->Text(5 * W / 8, 9 * H / 14, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%f", GC->rtcc->JZLAI.sv_Insertion.V.z);
-		skp->Text(5 * W / 8, 10 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(5 * W / 8, 8 * H / 14, "%f", GC->rtcc->JZLAI.sv_Insertion.V.x);
+		page.Printf(5 * W / 8, 9 * H / 14, "%f", GC->rtcc->JZLAI.sv_Insertion.V.y);
+		page.Printf(5 * W / 8, 10 * H / 14, "%f", GC->rtcc->JZLAI.sv_Insertion.V.z);
 
-		sprintf(Buffer, "%f", GC->rtcc->JZLAI.sv_Insertion.GMT);
-		skp->Text(5 * W / 8, 12 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(5 * W / 8, 12 * H / 14, "%f", GC->rtcc->JZLAI.sv_Insertion.GMT);
 	}
 	else if (screen == 39)
 	{
-		skp->Text(4 * W / 8, (int)(0.5 * H / 14), "LM Ascent PAD", 13);
+		page.Text(4 * W / 8, (int)(0.5 * H / 14), "LM Ascent PAD", 13);
 
 		if (G->target != NULL)
 		{
 			sprintf(Buffer, G->target->GetName());
-			skp->Text((int)(5.5 * W / 8), 4 * H / 14, Buffer, strlen(Buffer));
+			page.Text((int)(5.5 * W / 8), 4 * H / 14, Buffer, strlen(Buffer));
 		}
 
 		int hh, mm;
 		double secs;
 
 		SStoHHMMSS(G->t_LunarLiftoff, hh, mm, secs);
-		sprintf(Buffer, "%+06d HRS", hh);
-		skp->Text(2 * W / 8, 6 * H / 21, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%+06d MIN TIG", mm);
-		skp->Text(2 * W / 8, 7 * H / 21, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%+06.0f SEC", secs * 100.0);
-		skp->Text(2 * W / 8, 8 * H / 21, Buffer, strlen(Buffer));
-
-		sprintf(Buffer, "%+07.1f V (HOR)", GC->rtcc->PZLTRT.InsertionHorizontalVelocity / 0.3048);
-		skp->Text(2 * W / 8, 9 * H / 21, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%+07.1f V (VERT) N76", GC->rtcc->PZLTRT.InsertionRadialVelocity / 0.3048);
-		skp->Text(2 * W / 8, 10 * H / 21, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%+07.1f CROSSRANGE", G->lmascentpad.CR);
-		skp->Text(2 * W / 8, 11 * H / 21, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%+06d DEDA 047", G->lmascentpad.DEDA047);
-		skp->Text(2 * W / 8, 12 * H / 21, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%+06d DEDA 053", G->lmascentpad.DEDA053);
-		skp->Text(2 * W / 8, 13 * H / 21, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%+06.0f DEDA 225/226", G->lmascentpad.DEDA225_226);
-		skp->Text(2 * W / 8, 14 * H / 21, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%+06.0f DEDA 231", G->lmascentpad.DEDA231);
-		skp->Text(2 * W / 8, 15 * H / 21, Buffer, strlen(Buffer));
+		page.Printf(2 * W / 8, 6 * H / 21, "%+06d HRS", hh);
+		page.Printf(2 * W / 8, 7 * H / 21, "%+06d MIN TIG", mm);
+		page.Printf(2 * W / 8, 8 * H / 21, "%+06.0f SEC", secs * 100.0);
+
+		page.Printf(2 * W / 8, 9 * H / 21, "%+07.1f V (HOR)", GC->rtcc->PZLTRT.InsertionHorizontalVelocity / 0.3048);
+		page.Printf(2 * W / 8, 10 * H / 21, "%+07.1f V (VERT) N76", GC->rtcc->PZLTRT.InsertionRadialVelocity / 0.3048);
+		page.Printf(2 * W / 8, 11 * H / 21, "%+07.1f CROSSRANGE", G->lmascentpad.CR);
+		page.Printf(2 * W / 8, 12 * H / 21, "%+06d DEDA 047", G->lmascentpad.DEDA047);
+		page.Printf(2 * W / 8, 13 * H / 21, "%+06d DEDA 053", G->lmascentpad.DEDA053);
+		page.Printf(2 * W / 8, 14 * H / 21, "%+06.0f DEDA 225/226", G->lmascentpad.DEDA225_226);
+		page.Printf(2 * W / 8, 15 * H / 21, "%+06.0f DEDA 231", G->lmascentpad.DEDA231);
 
 	}
 	else if (screen == 40)
 	{
-		skp->Text(4 * W / 8, (int)(0.5 * H / 14), "Descent Abort", 13);
+		page.Text(4 * W / 8, (int)(0.5 * H / 14), "Descent Abort", 13);
 
 		if (G->subThreadStatus > 0)
 		{
-			skp->Text(5 * W / 8, 3 * H / 14, "Calculating...", 14);
+			page.Text(5 * W / 8, 3 * H / 14, "Calculating...", 14);
 		}
 		else if (!G->PADSolGood)
 		{
-			skp->Text(5 * W / 8, 3 * H / 14, "Calculation failed!", 19);
+			page.Text(5 * W / 8, 3 * H / 14, "Calculation failed!", 19);
 		}
 
 		if (G->PDAPEngine == 0)
 		{
-			skp->Text(1 * W / 8, 2 * H / 14, "DPS/APS", 7);
+			page.Text(1 * W / 8, 2 * H / 14, "DPS/APS", 7);
 		}
 		else
 		{
-			skp->Text(1 * W / 8, 2 * H / 14, "APS", 7);
+			page.Text(1 * W / 8, 2 * H / 14, "APS", 7);
 		}
 
-		skp->Text(4 * W / 8, 3 * H / 21, "TPI:", 4);
-		GET_Display(Buffer, G->t_TPI);
-		skp->Text(5 * W / 8, 3 * H / 21, Buffer, strlen(Buffer));
+		page.Text(4 * W / 8, 3 * H / 21, "TPI:", 4);
+		page.Format(5 * W / 8, 3 * H / 21, this, &ApolloRTCCMFD::GET_Display, G->t_TPI, true);
 
-		skp->Text(1 * W / 8, 5 * H / 21, "PGNS Coefficients:", 18);
+		page.Text(1 * W / 8, 5 * H / 21, "PGNS Coefficients:", 18);
 		if (GC->mission <= 11)
 		{
-			sprintf(Buffer, "%e", G->PDAPABTCOF[0] / 0.3048);
-			skp->Text(1 * W / 8, 6 * H / 21, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%e", G->PDAPABTCOF[1] / 0.3048);
-			skp->Text(1 * W / 8, 7 * H / 21, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%e", G->PDAPABTCOF[2] / 0.3048);
-			skp->Text(1 * W / 8, 8 * H / 21, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%f", G->PDAPABTCOF[3] / 0.3048);
-			skp->Text(1 * W / 8, 9 * H / 21, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%e", G->PDAPABTCOF[4] / 0.3048);
-			skp->Text(1 * W / 8, 10 * H / 21, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%e", G->PDAPABTCOF[5] / 0.3048);
-			skp->Text(1 * W / 8, 11 * H / 21, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%e", G->PDAPABTCOF[6] / 0.3048);
-			skp->Text(1 * W / 8, 12 * H / 21, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%f", G->PDAPABTCOF[7] / 0.3048);
-			skp->Text(1 * W / 8, 13 * H / 21, Buffer, strlen(Buffer));
-		}
-		else
-		{
-			skp->Text(1 * W / 8, 6 * H / 21, "J1", 2);
-			sprintf(Buffer, "%.4f NM", G->PDAP_J1 / 1852.0);
-			skp->Text(2 * W / 8, 6 * H / 21, Buffer, strlen(Buffer));
-			skp->Text(1 * W / 8, 7 * H / 21, "K1", 2);
-			sprintf(Buffer, "%.4f NM/DEG", G->PDAP_K1 / 1852.0 / DEG);
-			skp->Text(2 * W / 8, 7 * H / 21, Buffer, strlen(Buffer));
-			skp->Text(1 * W / 8, 8 * H / 21, "J2", 2);
-			sprintf(Buffer, "%.4f NM", G->PDAP_J2 / 1852.0);
-			skp->Text(2 * W / 8, 8 * H / 21, Buffer, strlen(Buffer));
-			skp->Text(1 * W / 8, 9 * H / 21, "K2", 2);
-			sprintf(Buffer, "%.4f NM/DEG", G->PDAP_K2 / 1852.0 / DEG);
-			skp->Text(2 * W / 8, 9 * H / 21, Buffer, strlen(Buffer));
-			skp->Text(1 * W / 8, 10 * H / 21, "THET", 4);
-			sprintf(Buffer, "%.4f", G->PDAP_Theta_LIM*DEG);
-			skp->Text(2 * W / 8, 10 * H / 21, Buffer, strlen(Buffer));
-			skp->Text(1 * W / 8, 11 * H / 21, "RMIN", 4);
-			sprintf(Buffer, "%.4f NM", G->PDAP_R_amin / 1852.0);
-			skp->Text(2 * W / 8, 11 * H / 21, Buffer, strlen(Buffer));
-		}
-
-		skp->Text(1 * W / 8, 15 * H / 21, "AGS Coefficients:", 18);
-		skp->Text(1 * W / 8, 16 * H / 21, "224", 3);
-		sprintf(Buffer, "%+06.0f", G->DEDA224 / 0.3048 / 100.0);
-		skp->Text(2 * W / 8, 16 * H / 21, Buffer, strlen(Buffer));
-		skp->Text(1 * W / 8, 17 * H / 21, "225", 3);
-		sprintf(Buffer, "%+06.0f", G->DEDA225 / 0.3048 / 100.0);
-		skp->Text(2 * W / 8, 17 * H / 21, Buffer, strlen(Buffer));
-		skp->Text(1 * W / 8, 18 * H / 21, "226", 3);
-		sprintf(Buffer, "%+06.0f", G->DEDA226 / 0.3048 / 100.0);
-		skp->Text(2 * W / 8, 18 * H / 21, Buffer, strlen(Buffer));
-		skp->Text(1 * W / 8, 19 * H / 21, "227", 3);
-		sprintf(Buffer, "%+06d", G->DEDA227);
-		skp->Text(2 * W / 8, 19 * H / 21, Buffer, strlen(Buffer));
+			page.Printf(1 * W / 8, 6 * H / 21, "%e", G->PDAPABTCOF[0] / 0.3048);
+			page.Printf(1 * W / 8, 7 * H / 21, "%e", G->PDAPABTCOF[1] / 0.3048);
+			page.Printf(1 * W / 8, 8 * H / 21, "%e", G->PDAPABTCOF[2] / 0.3048);
+			page.Printf(1 * W / 8, 9 * H / 21, "%f", G->PDAPABTCOF[3] / 0.3048);
+			page.Printf(1 * W / 8, 10 * H / 21, "%e", G->PDAPABTCOF[4] / 0.3048);
+			page.Printf(1 * W / 8, 11 * H / 21, "%e", G->PDAPABTCOF[5] / 0.3048);
+			page.Printf(1 * W / 8, 12 * H / 21, "%e", G->PDAPABTCOF[6] / 0.3048);
+			page.Printf(1 * W / 8, 13 * H / 21, "%f", G->PDAPABTCOF[7] / 0.3048);
+		}
+		else
+		{
+			page.Text(1 * W / 8, 6 * H / 21, "J1", 2);
+			page.Printf(2 * W / 8, 6 * H / 21, "%.4f NM", G->PDAP_J1 / 1852.0);
+			page.Text(1 * W / 8, 7 * H / 21, "K1", 2);
+			page.Printf(2 * W / 8, 7 * H / 21, "%.4f NM/DEG", G->PDAP_K1 / 1852.0 / DEG);
+			page.Text(1 * W / 8, 8 * H / 21, "J2", 2);
+			page.Printf(2 * W / 8, 8 * H / 21, "%.4f NM", G->PDAP_J2 / 1852.0);
+			page.Text(1 * W / 8, 9 * H / 21, "K2", 2);
+			page.Printf(2 * W / 8, 9 * H / 21, "%.4f NM/DEG", G->PDAP_K2 / 1852.0 / DEG);
+			page.Text(1 * W / 8, 10 * H / 21, "THET", 4);
+			page.Printf(2 * W / 8, 10 * H / 21, "%.4f", G->PDAP_Theta_LIM*DEG);
+			page.Text(1 * W / 8, 11 * H / 21, "RMIN", 4);
+			page.Printf(2 * W / 8, 11 * H / 21, "%.4f NM", G->PDAP_R_amin / 1852.0);
+		}
+
+		page.Text(1 * W / 8, 15 * H / 21, "AGS Coefficients:", 18);
+		page.Text(1 * W / 8, 16 * H / 21, "224", 3);
+		page.Printf(2 * W / 8, 16 * H / 21, "%+06.0f", G->DEDA224 / 0.3048 / 100.0);
+		page.Text(1 * W / 8, 17 * H / 21, "225", 3);
+		page.Printf(2 * W / 8, 17 * H / 21, "%+06.0f", G->DEDA225 / 0.3048 / 100.0);
+		page.Text(1 * W / 8, 18 * H / 21, "226", 3);
+		page.Printf(2 * W / 8, 18 * H / 21, "%+06.0f", G->DEDA226 / 0.3048 / 100.0);
+		page.Text(1 * W / 8, 19 * H / 21, "227", 3);
+		page.Printf(2 * W / 8, 19 * H / 21, "%+06d", G->DEDA227);
 
 		if (G->target != NULL)
 		{
 			sprintf(Buffer, G->target->GetName());
-			skp->Text((int)(5.5 * W / 8), 4 * H / 14, Buffer, strlen(Buffer));
-		}
-
-		skp->Text(5 * W / 8, 15 * H / 21, "Landing Site:", 13);
-		sprintf(Buffer, "%.3f", GC->rtcc->BZLAND.lat[RTCC_LMPOS_BEST] * DEG);
-		skp->Text(5 * W / 8, 16 * H / 21, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%.3f", GC->rtcc->BZLAND.lng[RTCC_LMPOS_BEST] * DEG);
-		skp->Text(5 * W / 8, 17 * H / 21, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%.2f NM", GC->rtcc->BZLAND.rad[RTCC_LMPOS_BEST] / 1852.0);
-		skp->Text(5 * W / 8, 18 * H / 21, Buffer, strlen(Buffer));
-		skp->Text(5 * W / 8, 19 * H / 21, "TLAND:", 6);
-		GET_Display(Buffer, GC->rtcc->CZTDTGTU.GETTD);
-		skp->Text(5 * W / 8, 20 * H / 21, Buffer, strlen(Buffer));
+			page.Text((int)(5.5 * W / 8), 4 * H / 14, Buffer, strlen(Buffer));
+		}
+
+		page.Text(5 * W / 8, 15 * H / 21, "Landing Site:", 13);
+		page.Printf(5 * W / 8, 16 * H / 21, "%.3f", GC->rtcc->BZLAND.lat[RTCC_LMPOS_BEST] * DEG);
+		page.Printf(5 * W / 8, 17 * H / 21, "%.3f", GC->rtcc->BZLAND.lng[RTCC_LMPOS_BEST] * DEG);
+		page.Printf(5 * W / 8, 18 * H / 21, "%.2f NM", GC->rtcc->BZLAND.rad[RTCC_LMPOS_BEST] / 1852.0);
+		page.Text(5 * W / 8, 19 * H / 21, "TLAND:", 6);
+		page.Format(5 * W / 8, 20 * H / 21, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->CZTDTGTU.GETTD, true);
 	}
 	else if (screen == 41 || screen == 71)
 	{
@@ -3268,97 +2787,86 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 
 		if (screen == 41)
 		{
-			skp->Text(4 * W / 8, 1 * H / 28, "FDO ORBIT DIGITALS NO 1 (MSK 0046)", 18);
+			page.Text(4 * W / 8, 1 * H / 28, "FDO ORBIT DIGITALS NO 1 (MSK 0046)", 18);
 			tab = &GC->rtcc->EZSAVCSM;
 			G->CycleFIDOOrbitDigitals1();
 		}
 		else
 		{
-			skp->Text(4 * W / 8, 1 * H / 28, "FDO ORBIT DIGITALS NO 2 (MSK 0045)", 18);
+			page.Text(4 * W / 8, 1 * H / 28, "FDO ORBIT DIGITALS NO 2 (MSK 0045)", 18);
 			tab = &GC->rtcc->EZSAVLEM;
 			G->CycleFIDOOrbitDigitals2();
 		}
 
-		skp->SetFont(font2);
-		skp->SetTextAlign(oapi::Sketchpad::RIGHT);
-
-		skp->Text(5 * W / 32, 3 * H / 28, "GET", 3);
-		skp->Text(5 * W / 32, 4 * H / 28, "VEHICLE", 7);
-		skp->Text(5 * W / 32, 5 * H / 28, "REV", 3);
-		skp->Text(5 * W / 32, 6 * H / 28, "REF", 3);
-		skp->Text(5 * W / 32, 7 * H / 28, "GMT ID", 6);
-		skp->Text(5 * W / 32, 8 * H / 28, "GET ID", 6);
-		skp->Text(5 * W / 32, 10 * H / 28, "H", 1);
-		skp->Text(5 * W / 32, 11 * H / 28, "V", 1);
-		skp->Text(5 * W / 32, 12 * H / 28, "GAM", 3);
-		skp->Text(5 * W / 32, 14 * H / 28, "A", 1);
-		skp->Text(5 * W / 32, 15 * H / 28, "E", 1);
-		skp->Text(5 * W / 32, 16 * H / 28, "I", 1);
-		skp->Text(5 * W / 32, 18 * H / 28, "HA", 2);
-		skp->Text(5 * W / 32, 19 * H / 28, "PA", 2);
-		skp->Text(5 * W / 32, 20 * H / 28, "LA", 2);
-		skp->Text(5 * W / 32, 21 * H / 28, "GETA", 4);
-		skp->Text(5 * W / 32, 23 * H / 28, "HP", 2);
-		skp->Text(5 * W / 32, 24 * H / 28, "PP", 2);
-		skp->Text(5 * W / 32, 25 * H / 28, "LP", 2);
-		skp->Text(5 * W / 32, 26 * H / 28, "GETP", 4);
-
-		skp->Text(15 * W / 32, 3 * H / 28, "LPP", 3);
-		skp->Text(15 * W / 32, 4 * H / 28, "PPP", 3);
-		skp->Text(15 * W / 32, 5 * H / 28, "GETCC", 5);
-		skp->Text(15 * W / 32, 6 * H / 28, "TAPP", 4);
-		skp->Text(15 * W / 32, 7 * H / 28, "LNPP", 4);
-
-		skp->Text(25 * W / 32, 3 * H / 28, "REVL", 4);
-		skp->Text(25 * W / 32, 4 * H / 28, "GETL", 4);
-		skp->Text(25 * W / 32, 5 * H / 28, "L", 1);
-		skp->Text(25 * W / 32, 6 * H / 28, "TO", 2);
-		skp->Text(25 * W / 32, 7 * H / 28, "K", 1);
-		skp->Text(25 * W / 32, 8 * H / 28, "ORBWT", 5);
-
-		skp->Text(25 * W / 32, 10 * H / 28, "REQUESTED", 9);
-		skp->Text(23 * W / 32, 11 * H / 28, "REF", 3);
-		skp->Text(23 * W / 32, 12 * H / 28, "GETBV", 5);
-		skp->Text(23 * W / 32, 13 * H / 28, "HA", 2);
-		skp->Text(23 * W / 32, 14 * H / 28, "PA", 2);
-		skp->Text(23 * W / 32, 15 * H / 28, "LA", 2);
-		skp->Text(23 * W / 32, 16 * H / 28, "GETA", 4);
-		skp->Text(23 * W / 32, 18 * H / 28, "HP", 2);
-		skp->Text(23 * W / 32, 19 * H / 28, "PP", 2);
-		skp->Text(23 * W / 32, 20 * H / 28, "LP", 2);
-		skp->Text(23 * W / 32, 21 * H / 28, "GETP", 4);
-
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
-
-		GET_Display(Buffer, tab->GET, false);
-		skp->Text(3 * W / 16, 3 * H / 28, Buffer, strlen(Buffer));
+		page.SetFont(font2);
+		page.SetTextAlign(oapi::Sketchpad::RIGHT);
+
+		page.Text(5 * W / 32, 3 * H / 28, "GET", 3);
+		page.Text(5 * W / 32, 4 * H / 28, "VEHICLE", 7);
+		page.Text(5 * W / 32, 5 * H / 28, "REV", 3);
+		page.Text(5 * W / 32, 6 * H / 28, "REF", 3);
+		page.Text(5 * W / 32, 7 * H / 28, "GMT ID", 6);
+		page.Text(5 * W / 32, 8 * H / 28, "GET ID", 6);
+		page.Text(5 * W / 32, 10 * H / 28, "H", 1);
+		page.Text(5 * W / 32, 11 * H / 28, "V", 1);
+		page.Text(5 * W / 32, 12 * H / 28, "GAM", 3);
+		page.Text(5 * W / 32, 14 * H / 28, "A", 1);
+		page.Text(5 * W / 32, 15 * H / 28, "E", 1);
+		page.Text(5 * W / 32, 16 * H / 28, "I", 1);
+		page.Text(5 * W / 32, 18 * H / 28, "HA", 2);
+		page.Text(5 * W / 32, 19 * H / 28, "PA", 2);
+		page.Text(5 * W / 32, 20 * H / 28, "LA", 2);
+		page.Text(5 * W / 32, 21 * H / 28, "GETA", 4);
+		page.Text(5 * W / 32, 23 * H / 28, "HP", 2);
+		page.Text(5 * W / 32, 24 * H / 28, "PP", 2);
+		page.Text(5 * W / 32, 25 * H / 28, "LP", 2);
+		page.Text(5 * W / 32, 26 * H / 28, "GETP", 4);
+
+		page.Text(15 * W / 32, 3 * H / 28, "LPP", 3);
+		page.Text(15 * W / 32, 4 * H / 28, "PPP", 3);
+		page.Text(15 * W / 32, 5 * H / 28, "GETCC", 5);
+		page.Text(15 * W / 32, 6 * H / 28, "TAPP", 4);
+		page.Text(15 * W / 32, 7 * H / 28, "LNPP", 4);
+
+		page.Text(25 * W / 32, 3 * H / 28, "REVL", 4);
+		page.Text(25 * W / 32, 4 * H / 28, "GETL", 4);
+		page.Text(25 * W / 32, 5 * H / 28, "L", 1);
+		page.Text(25 * W / 32, 6 * H / 28, "TO", 2);
+		page.Text(25 * W / 32, 7 * H / 28, "K", 1);
+		page.Text(25 * W / 32, 8 * H / 28, "ORBWT", 5);
+
+		page.Text(25 * W / 32, 10 * H / 28, "REQUESTED", 9);
+		page.Text(23 * W / 32, 11 * H / 28, "REF", 3);
+		page.Text(23 * W / 32, 12 * H / 28, "GETBV", 5);
+		page.Text(23 * W / 32, 13 * H / 28, "HA", 2);
+		page.Text(23 * W / 32, 14 * H / 28, "PA", 2);
+		page.Text(23 * W / 32, 15 * H / 28, "LA", 2);
+		page.Text(23 * W / 32, 16 * H / 28, "GETA", 4);
+		page.Text(23 * W / 32, 18 * H / 28, "HP", 2);
+		page.Text(23 * W / 32, 19 * H / 28, "PP", 2);
+		page.Text(23 * W / 32, 20 * H / 28, "LP", 2);
+		page.Text(23 * W / 32, 21 * H / 28, "GETP", 4);
+
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
+
+		page.Format(3 * W / 16, 3 * H / 28, this, &ApolloRTCCMFD::GET_Display, tab->GET, false);
 		sprintf(Buffer, tab->VEHID);
-		skp->Text(3 * W / 16, 4 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%03d", tab->REV);
-		skp->Text(3 * W / 16, 5 * H / 28, Buffer, strlen(Buffer));
+		page.Text(3 * W / 16, 4 * H / 28, Buffer, strlen(Buffer));
+		page.Printf(3 * W / 16, 5 * H / 28, "%03d", tab->REV);
 		sprintf(Buffer, tab->REF);
-		skp->Text(3 * W / 16, 6 * H / 28, Buffer, strlen(Buffer));
-		GET_Display(Buffer, tab->GMTID, false);
-		skp->Text(3 * W / 16, 7 * H / 28, Buffer, strlen(Buffer));
-		GET_Display(Buffer, tab->GETID, false);
-		skp->Text(3 * W / 16, 8 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%08.1f", tab->H);
-		skp->Text(3 * W / 16, 10 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%05.0f", tab->V);
-		skp->Text(3 * W / 16, 11 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%+06.2f", tab->GAM);
-		skp->Text(3 * W / 16, 12 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%08.1f", tab->A);
-		skp->Text(3 * W / 16, 14 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%06.4f", tab->E);
-		skp->Text(3 * W / 16, 15 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%05.2f", tab->I);
-		skp->Text(3 * W / 16, 16 * H / 28, Buffer, strlen(Buffer));
+		page.Text(3 * W / 16, 6 * H / 28, Buffer, strlen(Buffer));
+		page.Format(3 * W / 16, 7 * H / 28, this, &ApolloRTCCMFD::GET_Display, tab->GMTID, false);
+		page.Format(3 * W / 16, 8 * H / 28, this, &ApolloRTCCMFD::GET_Display, tab->GETID, false);
+		page.Printf(3 * W / 16, 10 * H / 28, "%08.1f", tab->H);
+		page.Printf(3 * W / 16, 11 * H / 28, "%05.0f", tab->V);
+		page.Printf(3 * W / 16, 12 * H / 28, "%+06.2f", tab->GAM);
+		page.Printf(3 * W / 16, 14 * H / 28, "%08.1f", tab->A);
+		page.Printf(3 * W / 16, 15 * H / 28, "%06.4f", tab->E);
+		page.Printf(3 * W / 16, 16 * H / 28, "%05.2f", tab->I);
 
 		if (tab->E < 1.0)
 		{
-			sprintf(Buffer, "%08.1f", tab->HA);
-			skp->Text(3 * W / 16, 18 * H / 28, Buffer, strlen(Buffer));
+			page.Printf(3 * W / 16, 18 * H / 28, "%08.1f", tab->HA);
 			if (tab->E > 0.0001)
 			{
 				if (tab->PA > 0)
@@ -3369,7 +2877,7 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 				{
 					sprintf(Buffer, "%06.2f S", abs(tab->PA));
 				}
-				skp->Text(3 * W / 16, 19 * H / 28, Buffer, strlen(Buffer));
+				page.Text(3 * W / 16, 19 * H / 28, Buffer, strlen(Buffer));
 				if (tab->LA > 0)
 				{
 					sprintf(Buffer, "%06.2f E", tab->LA);
@@ -3378,14 +2886,12 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 				{
 					sprintf(Buffer, "%06.2f W", abs(tab->LA));
 				}
-				skp->Text(3 * W / 16, 20 * H / 28, Buffer, strlen(Buffer));
-				GET_Display(Buffer, tab->GETA, false);
-				skp->Text(3 * W / 16, 21 * H / 28, Buffer, strlen(Buffer));
+				page.Text(3 * W / 16, 20 * H / 28, Buffer, strlen(Buffer));
+				page.Format(3 * W / 16, 21 * H / 28, this, &ApolloRTCCMFD::GET_Display, tab->GETA, false);
 			}
 		}
 
-		sprintf(Buffer, "%08.1f", tab->HP);
-		skp->Text(3 * W / 16, 23 * H / 28, Buffer, strlen(Buffer));
+		page.Printf(3 * W / 16, 23 * H / 28, "%08.1f", tab->HP);
 		if (tab->E > 0.0001)
 		{
 			if (tab->PP > 0)
@@ -3396,7 +2902,7 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			{
 				sprintf(Buffer, "%06.2f S", abs(tab->PP));
 			}
-			skp->Text(3 * W / 16, 24 * H / 28, Buffer, strlen(Buffer));
+			page.Text(3 * W / 16, 24 * H / 28, Buffer, strlen(Buffer));
 			if (tab->LP > 0)
 			{
 				sprintf(Buffer, "%06.2f E", tab->LP);
@@ -3405,9 +2911,8 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			{
 				sprintf(Buffer, "%06.2f W", abs(tab->LP));
 			}
-			skp->Text(3 * W / 16, 25 * H / 28, Buffer, strlen(Buffer));
-			GET_Display(Buffer, tab->GETP, false);
-			skp->Text(3 * W / 16, 26 * H / 28, Buffer, strlen(Buffer));
+			page.Text(3 * W / 16, 25 * H / 28, Buffer, strlen(Buffer));
+			page.Format(3 * W / 16, 26 * H / 28, this, &ApolloRTCCMFD::GET_Display, tab->GETP, false);
 		}
 
 		if (tab->LPP > 0)
@@ -3418,7 +2923,7 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 		{
 			sprintf(Buffer, "%06.2f W", abs(tab->LPP));
 		}
-		skp->Text(8 * W / 16, 3 * H / 28, Buffer, strlen(Buffer));
+		page.Text(8 * W / 16, 3 * H / 28, Buffer, strlen(Buffer));
 		if (tab->PPP > 0)
 		{
 			sprintf(Buffer, "%06.2f N", tab->PPP);
@@ -3427,13 +2932,11 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 		{
 			sprintf(Buffer, "%06.2f S", abs(tab->PPP));
 		}
-		skp->Text(8 * W / 16, 4 * H / 28, Buffer, strlen(Buffer));
-		GET_Display(Buffer, tab->GETCC, false);
-		skp->Text(8 * W / 16, 5 * H / 28, Buffer, strlen(Buffer));
+		page.Text(8 * W / 16, 4 * H / 28, Buffer, strlen(Buffer));
+		page.Format(8 * W / 16, 5 * H / 28, this, &ApolloRTCCMFD::GET_Display, tab->GETCC, false);
 		if (tab->E > 0.0001)
 		{
-			sprintf(Buffer, "%05.1f", tab->TAPP);
-			skp->Text(8 * W / 16, 6 * H / 28, Buffer, strlen(Buffer));
+			page.Printf(8 * W / 16, 6 * H / 28, "%05.1f", tab->TAPP);
 		}
 		if (tab->LNPP > 0)
 		{
@@ -3443,12 +2946,10 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 		{
 			sprintf(Buffer, "%06.2f W", abs(tab->LNPP));
 		}
-		skp->Text(8 * W / 16, 7 * H / 28, Buffer, strlen(Buffer));
+		page.Text(8 * W / 16, 7 * H / 28, Buffer, strlen(Buffer));
 
-		sprintf(Buffer, "%04d", tab->REVL);
-		skp->Text(13 * W / 16, 3 * H / 28, Buffer, strlen(Buffer));
-		GET_Display(Buffer, tab->GETL, false);
-		skp->Text(13 * W / 16, 4 * H / 28, Buffer, strlen(Buffer));
+		page.Printf(13 * W / 16, 3 * H / 28, "%04d", tab->REVL);
+		page.Format(13 * W / 16, 4 * H / 28, this, &ApolloRTCCMFD::GET_Display, tab->GETL, false);
 		if (tab->L > 0)
 		{
 			sprintf(Buffer, "%06.2f E", tab->L);
@@ -3457,20 +2958,15 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 		{
 			sprintf(Buffer, "%06.2f W", abs(tab->L));
 		}
-		skp->Text(13 * W / 16, 5 * H / 28, Buffer, strlen(Buffer));
-		GET_Display(Buffer, tab->TO, false);
-		skp->Text(13 * W / 16, 6 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%05.1f", tab->K);
-		skp->Text(13 * W / 16, 7 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%07.1f", tab->ORBWT);
-		skp->Text(13 * W / 16, 8 * H / 28, Buffer, strlen(Buffer));
+		page.Text(13 * W / 16, 5 * H / 28, Buffer, strlen(Buffer));
+		page.Format(13 * W / 16, 6 * H / 28, this, &ApolloRTCCMFD::GET_Display, tab->TO, false);
+		page.Printf(13 * W / 16, 7 * H / 28, "%05.1f", tab->K);
+		page.Printf(13 * W / 16, 8 * H / 28, "%07.1f", tab->ORBWT);
 
 		sprintf(Buffer, tab->REFR);
-		skp->Text(12 * W / 16, 11 * H / 28, Buffer, strlen(Buffer));
-		GET_Display(Buffer, tab->GETBV, false);
-		skp->Text(12 * W / 16, 12 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%08.1f", tab->HAR);
-		skp->Text(12 * W / 16, 13 * H / 28, Buffer, strlen(Buffer));
+		page.Text(12 * W / 16, 11 * H / 28, Buffer, strlen(Buffer));
+		page.Format(12 * W / 16, 12 * H / 28, this, &ApolloRTCCMFD::GET_Display, tab->GETBV, false);
+		page.Printf(12 * W / 16, 13 * H / 28, "%08.1f", tab->HAR);
 		if (tab->PAR > 0)
 		{
 			sprintf(Buffer, "%06.2f N", tab->PAR);
@@ -3479,7 +2975,7 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 		{
 			sprintf(Buffer, "%06.2f S", abs(tab->PAR));
 		}
-		skp->Text(12 * W / 16, 14 * H / 28, Buffer, strlen(Buffer));
+		page.Text(12 * W / 16, 14 * H / 28, Buffer, strlen(Buffer));
 		if (tab->LAR > 0)
 		{
 			sprintf(Buffer, "%06.2f E", tab->LAR);
@@ -3488,12 +2984,10 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 		{
 			sprintf(Buffer, "%06.2f W", abs(tab->LAR));
 		}
-		skp->Text(12 * W / 16, 15 * H / 28, Buffer, strlen(Buffer));
-		GET_Display(Buffer, tab->GETAR, false);
-		skp->Text(12 * W / 16, 16 * H / 28, Buffer, strlen(Buffer));
+		page.Text(12 * W / 16, 15 * H / 28, Buffer, strlen(Buffer));
+		page.Format(12 * W / 16, 16 * H / 28, this, &ApolloRTCCMFD::GET_Display, tab->GETAR, false);
 
-		sprintf(Buffer, "%08.1f", tab->HPR);
-		skp->Text(12 * W / 16, 18 * H / 28, Buffer, strlen(Buffer));
+		page.Printf(12 * W / 16, 18 * H / 28, "%08.1f", tab->HPR);
 		if (tab->PPR > 0)
 		{
 			sprintf(Buffer, "%06.2f N", tab->PPR);
@@ -3502,7 +2996,7 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 		{
 			sprintf(Buffer, "%06.2f S", abs(tab->PPR));
 		}
-		skp->Text(12 * W / 16, 19 * H / 28, Buffer, strlen(Buffer));
+		page.Text(12 * W / 16, 19 * H / 28, Buffer, strlen(Buffer));
 		if (tab->LPR > 0)
 		{
 			sprintf(Buffer, "%06.2f E", tab->LPR);
@@ -3511,154 +3005,146 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 		{
 			sprintf(Buffer, "%06.2f W", abs(tab->LPR));
 		}
-		skp->Text(12 * W / 16, 20 * H / 28, Buffer, strlen(Buffer));
-		GET_Display(Buffer, tab->GETPR, false);
-		skp->Text(12 * W / 16, 21 * H / 28, Buffer, strlen(Buffer));
+		page.Text(12 * W / 16, 20 * H / 28, Buffer, strlen(Buffer));
+		page.Format(12 * W / 16, 21 * H / 28, this, &ApolloRTCCMFD::GET_Display, tab->GETPR, false);
 	}
 	else if (screen == 42)
 	{
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
-		skp->Text(5 * W / 8, 1 * H / 64, "TV GUIDE (MSK 0001)", 19);
-
-		skp->SetFont(font2);
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
-
-		skp->Text(1 * W / 16, 4 * H / 28, "0040 FDO Launch Analog No 1", 27);
-		skp->Text(1 * W / 16, 5 * H / 28, "0041 FDO Launch Analog No 2", 27);
-		skp->Text(1 * W / 16, 6 * H / 28, "0045 FDO Orbit Digitals LM", 26);
-		skp->Text(1 * W / 16, 7 * H / 28, "0046 FDO Orbit Digitals CSM", 27);
-		skp->Text(1 * W / 16, 8 * H / 28, "0047 Mission Plan Table", 23);
-		skp->Text(1 * W / 16, 9 * H / 28, "0048 General Purpose Maneuver", 29);
-		skp->Text(1 * W / 16, 10 * H / 28, "0054 Detailed Maneuver Table 1", 30);
-		skp->Text(1 * W / 16, 11 * H / 28, "0055 CSM PSAT 1", 15);
-		skp->Text(1 * W / 16, 12 * H / 28, "0056 LM PSAT 1", 14);
-		skp->Text(1 * W / 16, 13 * H / 28, "0058 Rendezvous Eval Display", 28);
-		skp->Text(1 * W / 16, 14 * H / 28, "0060 Relative Motion Digitals", 29);
-		skp->Text(1 * W / 16, 15 * H / 28, "0069 Detailed Maneuver Table 2", 30);
-		skp->Text(1 * W / 16, 16 * H / 28, "0082 Space Digitals", 19);
-		skp->Text(1 * W / 16, 17 * H / 28, "0087 CSM PSAT 2", 15);
-		skp->Text(1 * W / 16, 18 * H / 28, "0088 LM PSAT 2", 14);
-		skp->Text(1 * W / 16, 19 * H / 28, "0229 GOST", 9);
-
-		skp->Text(8 * W / 16, 4 * H / 28, "1501 Moonrise/Moonset Times", 27);
-		skp->Text(8 * W / 16, 5 * H / 28, "1502 Sunrise/Sunset Times", 25);
-		skp->Text(8 * W / 16, 6 * H / 28, "1503 Next Station Contacts", 26);
-		skp->Text(8 * W / 16, 7 * H / 28, "1506 Experimental Site Acquisition", 26);
-		skp->Text(8 * W / 16, 8 * H / 28, "1590 Vector Compare Display", 27);
-		skp->Text(8 * W / 16, 9 * H / 28, "1591 Vector Panel Summary", 25);
-		skp->Text(8 * W / 16, 10 * H / 28, "1597 Skeleton Flight Plan Table", 31);
-		skp->Text(8 * W / 16, 11 * H / 28, "1619 Checkout Monitor", 21);
-		skp->Text(8 * W / 16, 12 * H / 28, "1629 On Line Monitor", 20);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
+		page.Text(5 * W / 8, 1 * H / 64, "TV GUIDE (MSK 0001)", 19);
+
+		page.SetFont(font2);
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
+
+		page.Text(1 * W / 16, 4 * H / 28, "0040 FDO Launch Analog No 1", 27);
+		page.Text(1 * W / 16, 5 * H / 28, "0041 FDO Launch Analog No 2", 27);
+		page.Text(1 * W / 16, 6 * H / 28, "0045 FDO Orbit Digitals LM", 26);
+		page.Text(1 * W / 16, 7 * H / 28, "0046 FDO Orbit Digitals CSM", 27);
+		page.Text(1 * W / 16, 8 * H / 28, "0047 Mission Plan Table", 23);
+		page.Text(1 * W / 16, 9 * H / 28, "0048 General Purpose Maneuver", 29);
+		page.Text(1 * W / 16, 10 * H / 28, "0054 Detailed Maneuver Table 1", 30);
+		page.Text(1 * W / 16, 11 * H / 28, "0055 CSM PSAT 1", 15);
+		page.Text(1 * W / 16, 12 * H / 28, "0056 LM PSAT 1", 14);
+		page.Text(1 * W / 16, 13 * H / 28, "0058 Rendezvous Eval Display", 28);
+		page.Text(1 * W / 16, 14 * H / 28, "0060 Relative Motion Digitals", 29);
+		page.Text(1 * W / 16, 15 * H / 28, "0069 Detailed Maneuver Table 2", 30);
+		page.Text(1 * W / 16, 16 * H / 28, "0082 Space Digitals", 19);
+		page.Text(1 * W / 16, 17 * H / 28, "0087 CSM PSAT 2", 15);
+		page.Text(1 * W / 16, 18 * H / 28, "0088 LM PSAT 2", 14);
+		page.Text(1 * W / 16, 19 * H / 28, "0229 GOST", 9);
+
+		page.Text(8 * W / 16, 4 * H / 28, "1501 Moonrise/Moonset Times", 27);
+		page.Text(8 * W / 16, 5 * H / 28, "1502 Sunrise/Sunset Times", 25);
+		page.Text(8 * W / 16, 6 * H / 28, "1503 Next Station Contacts", 26);
+		page.Text(8 * W / 16, 7 * H / 28, "1506 Experimental Site Acquisition", 26);
+		page.Text(8 * W / 16, 8 * H / 28, "1590 Vector Compare Display", 27);
+		page.Text(8 * W / 16, 9 * H / 28, "1591 Vector Panel Summary", 25);
+		page.Text(8 * W / 16, 10 * H / 28, "1597 Skeleton Flight Plan Table", 31);
+		page.Text(8 * W / 16, 11 * H / 28, "1619 Checkout Monitor", 21);
+		page.Text(8 * W / 16, 12 * H / 28, "1629 On Line Monitor", 20);
 	}
 	else if (screen == 43)
 	{
 		G->CycleSpaceDigitals();
 
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
 
 		if (GC->rtcc->EZETVMED.SpaceDigVehID == 3)
 		{
-			skp->Text(4 * W / 8, 1 * H / 64, "LEM SPACE DIGITALS", 18);
-		}
-		else
-		{
-			skp->Text(4 * W / 8, 1 * H / 64, "CSM SPACE DIGITALS", 18);
-		}
-
-		skp->SetFont(font2);
-
-		skp->Text(1 * W / 32, 2 * H / 28, "STA ID", 6);
-		skp->Text(1 * W / 32, 3 * H / 28, "GMTV", 4);
-		skp->Text(1 * W / 32, 5 * H / 28, "GET", 3);
-		skp->Text(1 * W / 32, 6 * H / 28, "REF", 3);
-		skp->Text(1 * W / 32, 8 * H / 28, "GET VECTOR 1", 12);
-		skp->Text(1 * W / 32, 10 * H / 28, "REF", 3);
-		skp->Text(11 * W / 64, 10 * H / 28, "WT", 2);
-		skp->Text(1 * W / 32, 11 * H / 28, "AREA", 4);
-		skp->Text(1 * W / 32, 12 * H / 28, "GETA", 4);
-		skp->Text(1 * W / 32, 13 * H / 28, "HA", 2);
-		skp->Text(1 * W / 32, 14 * H / 28, "HP", 2);
-		skp->Text(1 * W / 32, 15 * H / 28, "H", 1);
-		skp->Text(1 * W / 32, 16 * H / 28, "V", 1);
-		skp->Text(1 * W / 32, 17 * H / 28, "GAM", 3);
-		skp->Text(1 * W / 32, 18 * H / 28, "PSI", 3);
-		skp->Text(1 * W / 32, 19 * H / 28, "PHI", 3);
-		skp->Text(1 * W / 32, 20 * H / 28, "LAM", 3);
-		skp->Text(1 * W / 32, 21 * H / 28, "HS", 2);
-		skp->Text(1 * W / 32, 22 * H / 28, "HO", 2);
-		skp->Text(1 * W / 32, 23 * H / 28, "PHIO", 4);
-		skp->Text(1 * W / 32, 24 * H / 28, "IEMP", 4);
-		skp->Text(1 * W / 32, 25 * H / 28, "W", 1);
-		skp->Text(1 * W / 32, 26 * H / 28, "OMG", 3);
-		skp->Text(1 * W / 32, 27 * H / 28, "PRA", 3);
-		skp->Text(8 * W / 32, 24 * H / 28, "A", 1);
-		skp->Text(8 * W / 32, 25 * H / 28, "L", 1);
-		skp->Text(8 * W / 32, 26 * H / 28, "E", 1);
-		skp->Text(8 * W / 32, 27 * H / 28, "I", 1);
-
-		skp->Text(11 * W / 32, 2 * H / 28, "WEIGHT", 6);
-		skp->Text(11 * W / 32, 3 * H / 28, "GETV", 4);
-		skp->Text(11 * W / 32, 8 * H / 28, "GET VECTOR 2", 12);
-		skp->Text(11 * W / 32, 10 * H / 28, "GETSI", 5);
-		skp->Text(11 * W / 32, 11 * H / 28, "GETCA", 5);
-		skp->Text(11 * W / 32, 12 * H / 28, "VCA", 3);
-		skp->Text(11 * W / 32, 13 * H / 28, "HCA", 3);
-		skp->Text(11 * W / 32, 14 * H / 28, "PCA", 3);
-		skp->Text(11 * W / 32, 15 * H / 28, "LCA", 3);
-		skp->Text(11 * W / 32, 16 * H / 28, "PSICA", 5);
-		skp->Text(11 * W / 32, 17 * H / 28, "GETMN", 5);
-		skp->Text(11 * W / 32, 18 * H / 28, "HMN", 3);
-		skp->Text(11 * W / 32, 19 * H / 28, "PMN", 3);
-		skp->Text(11 * W / 32, 20 * H / 28, "LMN", 3);
-		skp->Text(11 * W / 32, 21 * H / 28, "DMN", 3);
-
-		skp->Text(21 * W / 32, 3 * H / 28, "GET AXIS", 8);
-		skp->Text(21 * W / 32, 8 * H / 28, "GET VECTOR 3", 12);
-		skp->Text(21 * W / 32, 10 * H / 28, "GETSE", 5);
-		skp->Text(21 * W / 32, 11 * H / 28, "GETEI", 5);
-		skp->Text(21 * W / 32, 12 * H / 28, "VEI", 3);
-		skp->Text(21 * W / 32, 13 * H / 28, "GEI", 3);
-		skp->Text(21 * W / 32, 14 * H / 28, "PEI", 3);
-		skp->Text(21 * W / 32, 15 * H / 28, "LEI", 3);
-		skp->Text(21 * W / 32, 16 * H / 28, "PSIEI", 5);
-		skp->Text(21 * W / 32, 17 * H / 28, "GETVP", 5);
-		skp->Text(21 * W / 32, 18 * H / 28, "VVP", 3);
-		skp->Text(21 * W / 32, 19 * H / 28, "HVP", 3);
-		skp->Text(21 * W / 32, 20 * H / 28, "PVP", 3);
-		skp->Text(21 * W / 32, 21 * H / 28, "LVP", 3);
-		skp->Text(21 * W / 32, 22 * H / 28, "PSI VP", 6);
-		skp->Text(21 * W / 32, 26 * H / 28, "IE", 2);
-		skp->Text(21 * W / 32, 27 * H / 28, "LN", 2);
-
-		skp->Text(9 * W / 32, 5 * H / 28, "V", 1);
-		skp->Text(13 * W / 32, 5 * H / 28, "PHI", 3);
-		skp->Text(20 * W / 32, 5 * H / 28, "H", 1);
-		skp->Text(25 * W / 32, 5 * H / 28, "ADA", 3);
-
-		skp->Text(8 * W / 32, 6 * H / 28, "GAM", 3);
-		skp->Text(15 * W / 32, 6 * H / 28, "LAM", 3);
-		skp->Text(23 * W / 32, 6 * H / 28, "PSI", 3);
-
-		sprintf_s(Buffer, "%s", GC->rtcc->EZSPACE.errormessage.c_str());
-		skp->Text(14 * W / 32, 27 * H / 28, Buffer, strlen(Buffer));
-
-		GET_Display(Buffer, GC->rtcc->EZSPACE.GMTV, false);
-		skp->Text(4 * W / 32, 3 * H / 28, Buffer, strlen(Buffer));
-		GET_Display(Buffer, GC->rtcc->EZSPACE.GET, false);
-		skp->Text(4 * W / 32, 5 * H / 28, Buffer, strlen(Buffer));
+			page.Text(4 * W / 8, 1 * H / 64, "LEM SPACE DIGITALS", 18);
+		}
+		else
+		{
+			page.Text(4 * W / 8, 1 * H / 64, "CSM SPACE DIGITALS", 18);
+		}
+
+		page.SetFont(font2);
+
+		page.Text(1 * W / 32, 2 * H / 28, "STA ID", 6);
+		page.Text(1 * W / 32, 3 * H / 28, "GMTV", 4);
+		page.Text(1 * W / 32, 5 * H / 28, "GET", 3);
+		page.Text(1 * W / 32, 6 * H / 28, "REF", 3);
+		page.Text(1 * W / 32, 8 * H / 28, "GET VECTOR 1", 12);
+		page.Text(1 * W / 32, 10 * H / 28, "REF", 3);
+		page.Text(11 * W / 64, 10 * H / 28, "WT", 2);
+		page.Text(1 * W / 32, 11 * H / 28, "AREA", 4);
+		page.Text(1 * W / 32, 12 * H / 28, "GETA", 4);
+		page.Text(1 * W / 32, 13 * H / 28, "HA", 2);
+		page.Text(1 * W / 32, 14 * H / 28, "HP", 2);
+		page.Text(1 * W / 32, 15 * H / 28, "H", 1);
+		page.Text(1 * W / 32, 16 * H / 28, "V", 1);
+		page.Text(1 * W / 32, 17 * H / 28, "GAM", 3);
+		page.Text(1 * W / 32, 18 * H / 28, "PSI", 3);
+		page.Text(1 * W / 32, 19 * H / 28, "PHI", 3);
+		page.Text(1 * W / 32, 20 * H / 28, "LAM", 3);
+		page.Text(1 * W / 32, 21 * H / 28, "HS", 2);
+		page.Text(1 * W / 32, 22 * H / 28, "HO", 2);
+		page.Text(1 * W / 32, 23 * H / 28, "PHIO", 4);
+		page.Text(1 * W / 32, 24 * H / 28, "IEMP", 4);
+		page.Text(1 * W / 32, 25 * H / 28, "W", 1);
+		page.Text(1 * W / 32, 26 * H / 28, "OMG", 3);
+		page.Text(1 * W / 32, 27 * H / 28, "PRA", 3);
+		page.Text(8 * W / 32, 24 * H / 28, "A", 1);
+		page.Text(8 * W / 32, 25 * H / 28, "L", 1);
+		page.Text(8 * W / 32, 26 * H / 28, "E", 1);
+		page.Text(8 * W / 32, 27 * H / 28, "I", 1);
+
+		page.Text(11 * W / 32, 2 * H / 28, "WEIGHT", 6);
+		page.Text(11 * W / 32, 3 * H / 28, "GETV", 4);
+		page.Text(11 * W / 32, 8 * H / 28, "GET VECTOR 2", 12);
+		page.Text(11 * W / 32, 10 * H / 28, "GETSI", 5);
+		page.Text(11 * W / 32, 11 * H / 28, "GETCA", 5);
+		page.Text(11 * W / 32, 12 * H / 28, "VCA", 3);
+		page.Text(11 * W / 32, 13 * H / 28, "HCA", 3);
+		page.Text(11 * W / 32, 14 * H / 28, "PCA", 3);
+		page.Text(11 * W / 32, 15 * H / 28, "LCA", 3);
+		page.Text(11 * W / 32, 16 * H / 28, "PSICA", 5);
+		page.Text(11 * W / 32, 17 * H / 28, "GETMN", 5);
+		page.Text(11 * W / 32, 18 * H / 28, "HMN", 3);
+		page.Text(11 * W / 32, 19 * H / 28, "PMN", 3);
+		page.Text(11 * W / 32, 20 * H / 28, "LMN", 3);
+		page.Text(11 * W / 32, 21 * H / 28, "DMN", 3);
+
+		page.Text(21 * W / 32, 3 * H / 28, "GET AXIS", 8);
+		page.Text(21 * W / 32, 8 * H / 28, "GET VECTOR 3", 12);
+		page.Text(21 * W / 32, 10 * H / 28, "GETSE", 5);
+		page.Text(21 * W / 32, 11 * H / 28, "GETEI", 5);
+		page.Text(21 * W / 32, 12 * H / 28, "VEI", 3);
+		page.Text(21 * W / 32, 13 * H / 28, "GEI", 3);
+		page.Text(21 * W / 32, 14 * H / 28, "PEI", 3);
+		page.Text(21 * W / 32, 15 * H / 28, "LEI", 3);
+		page.Text(21 * W / 32, 16 * H / 28, "PSIEI", 5);
+		page.Text(21 * W / 32, 17 * H / 28, "GETVP", 5);
+		page.Text(21 * W / 32, 18 * H / 28, "VVP", 3);
+		page.Text(21 * W / 32, 19 * H / 28, "HVP", 3);
+		page.Text(21 * W / 32, 20 * H / 28, "PVP", 3);
+		page.Text(21 * W / 32, 21 * H / 28, "LVP", 3);
+		page.Text(21 * W / 32, 22 * H / 28, "PSI VP", 6);
+		page.Text(21 * W / 32, 26 * H / 28, "IE", 2);
+		page.Text(21 * W / 32, 27 * H / 28, "LN", 2);
+
+		page.Text(9 * W / 32, 5 * H / 28, "V", 1);
+		page.Text(13 * W / 32, 5 * H / 28, "PHI", 3);
+		page.Text(20 * W / 32, 5 * H / 28, "H", 1);
+		page.Text(25 * W / 32, 5 * H / 28, "ADA", 3);
+
+		page.Text(8 * W / 32, 6 * H / 28, "GAM", 3);
+		page.Text(15 * W / 32, 6 * H / 28, "LAM", 3);
+		page.Text(23 * W / 32, 6 * H / 28, "PSI", 3);
+
+		page.Printf(14 * W / 32, 27 * H / 28, "%s", GC->rtcc->EZSPACE.errormessage.c_str());
+
+		page.Format(4 * W / 32, 3 * H / 28, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->EZSPACE.GMTV, false);
+		page.Format(4 * W / 32, 5 * H / 28, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->EZSPACE.GET, false);
 		sprintf(Buffer, GC->rtcc->EZSPACE.REF);
-		skp->Text(4 * W / 32, 6 * H / 28, Buffer, strlen(Buffer));
+		page.Text(4 * W / 32, 6 * H / 28, Buffer, strlen(Buffer));
 
-		sprintf(Buffer, "%07.1f", GC->rtcc->EZSPACE.WEIGHT);
-		skp->Text(16 * W / 32, 2 * H / 28, Buffer, strlen(Buffer));
-		GET_Display(Buffer, GC->rtcc->EZSPACE.GETV, false);
-		skp->Text(14 * W / 32, 3 * H / 28, Buffer, strlen(Buffer));
+		page.Printf(16 * W / 32, 2 * H / 28, "%07.1f", GC->rtcc->EZSPACE.WEIGHT);
+		page.Format(14 * W / 32, 3 * H / 28, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->EZSPACE.GETV, false);
 
-		GET_Display(Buffer, GC->rtcc->EZSPACE.GETR, false);
-		skp->Text(26 * W / 32, 2 * H / 28, Buffer, strlen(Buffer));
+		page.Format(26 * W / 32, 2 * H / 28, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->EZSPACE.GETR, false);
 
-		sprintf(Buffer, "%05.0f", GC->rtcc->EZSPACE.V);
-		skp->Text(10 * W / 32, 5 * H / 28, Buffer, strlen(Buffer));
+		page.Printf(10 * W / 32, 5 * H / 28, "%05.0f", GC->rtcc->EZSPACE.V);
 		if (GC->rtcc->EZSPACE.PHI > 0)
 		{
 			sprintf(Buffer, "%06.2f N", GC->rtcc->EZSPACE.PHI);
@@ -3667,14 +3153,11 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 		{
 			sprintf(Buffer, "%06.2f S", abs(GC->rtcc->EZSPACE.PHI));
 		}
-		skp->Text(15 * W / 32, 5 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%06.0f", GC->rtcc->EZSPACE.H);
-		skp->Text(21 * W / 32, 5 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%05.2f", GC->rtcc->EZSPACE.ADA);
-		skp->Text(28 * W / 32, 5 * H / 28, Buffer, strlen(Buffer));
+		page.Text(15 * W / 32, 5 * H / 28, Buffer, strlen(Buffer));
+		page.Printf(21 * W / 32, 5 * H / 28, "%06.0f", GC->rtcc->EZSPACE.H);
+		page.Printf(28 * W / 32, 5 * H / 28, "%05.2f", GC->rtcc->EZSPACE.ADA);
 
-		sprintf(Buffer, "%+06.1f", GC->rtcc->EZSPACE.GAM);
-		skp->Text(11 * W / 32, 6 * H / 28, Buffer, strlen(Buffer));
+		page.Printf(11 * W / 32, 6 * H / 28, "%+06.1f", GC->rtcc->EZSPACE.GAM);
 		if (GC->rtcc->EZSPACE.LAM > 0)
 		{
 			sprintf(Buffer, "%06.2f E", GC->rtcc->EZSPACE.LAM);
@@ -3683,37 +3166,26 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 		{
 			sprintf(Buffer, "%06.2f W", abs(GC->rtcc->EZSPACE.LAM));
 		}
-		skp->Text(18 * W / 32, 6 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%+06.1f", GC->rtcc->EZSPACE.PSI);
-		skp->Text(25 * W / 32, 6 * H / 28, Buffer, strlen(Buffer));
+		page.Text(18 * W / 32, 6 * H / 28, Buffer, strlen(Buffer));
+		page.Printf(25 * W / 32, 6 * H / 28, "%+06.1f", GC->rtcc->EZSPACE.PSI);
 
-		GET_Display(Buffer, GC->rtcc->EZSPACE.GETVector1, false);
-		skp->Text(1 * W / 32, 9 * H / 28, Buffer, strlen(Buffer));
-		GET_Display(Buffer, GC->rtcc->EZSPACE.GETVector2, false);
-		skp->Text(11 * W / 32, 9 * H / 28, Buffer, strlen(Buffer));
-		GET_Display(Buffer, GC->rtcc->EZSPACE.GETVector3, false);
-		skp->Text(21 * W / 32, 9 * H / 28, Buffer, strlen(Buffer));
+		page.Format(1 * W / 32, 9 * H / 28, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->EZSPACE.GETVector1, false);
+		page.Format(11 * W / 32, 9 * H / 28, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->EZSPACE.GETVector2, false);
+		page.Format(21 * W / 32, 9 * H / 28, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->EZSPACE.GETVector3, false);
 
-		skp->SetTextAlign(oapi::Sketchpad::RIGHT);
+		page.SetTextAlign(oapi::Sketchpad::RIGHT);
 
-		skp->Text(25 * W / 32, 2 * H / 28, "GETR", 4);
+		page.Text(25 * W / 32, 2 * H / 28, "GETR", 4);
 
 		sprintf(Buffer, GC->rtcc->EZSPACE.REF1);
-		skp->Text(10 * W / 64, 10 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%05.0f", GC->rtcc->EZSPACE.WT);
-		skp->Text(10 * W / 32, 10 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%08.1f", GC->rtcc->EZSPACE.HA);
-		skp->Text(10 * W / 32, 13 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%08.1f", GC->rtcc->EZSPACE.HP);
-		skp->Text(10 * W / 32, 14 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%08.1f", GC->rtcc->EZSPACE.H1);
-		skp->Text(10 * W / 32, 15 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%05.0f", GC->rtcc->EZSPACE.V1);
-		skp->Text(10 * W / 32, 16 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%+06.1f", GC->rtcc->EZSPACE.GAM1);
-		skp->Text(10 * W / 32, 17 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%+06.1f", GC->rtcc->EZSPACE.PSI1);
-		skp->Text(10 * W / 32, 18 * H / 28, Buffer, strlen(Buffer));
+		page.Text(10 * W / 64, 10 * H / 28, Buffer, strlen(Buffer));
+		page.Printf(10 * W / 32, 10 * H / 28, "%05.0f", GC->rtcc->EZSPACE.WT);
+		page.Printf(10 * W / 32, 13 * H / 28, "%08.1f", GC->rtcc->EZSPACE.HA);
+		page.Printf(10 * W / 32, 14 * H / 28, "%08.1f", GC->rtcc->EZSPACE.HP);
+		page.Printf(10 * W / 32, 15 * H / 28, "%08.1f", GC->rtcc->EZSPACE.H1);
+		page.Printf(10 * W / 32, 16 * H / 28, "%05.0f", GC->rtcc->EZSPACE.V1);
+		page.Printf(10 * W / 32, 17 * H / 28, "%+06.1f", GC->rtcc->EZSPACE.GAM1);
+		page.Printf(10 * W / 32, 18 * H / 28, "%+06.1f", GC->rtcc->EZSPACE.PSI1);
 		if (GC->rtcc->EZSPACE.PHI1 > 0)
 		{
 			sprintf(Buffer, "%06.2f N", GC->rtcc->EZSPACE.PHI1);
@@ -3722,7 +3194,7 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 		{
 			sprintf(Buffer, "%06.2f S", abs(GC->rtcc->EZSPACE.PHI1));
 		}
-		skp->Text(10 * W / 32, 19 * H / 28, Buffer, strlen(Buffer));
+		page.Text(10 * W / 32, 19 * H / 28, Buffer, strlen(Buffer));
 		if (GC->rtcc->EZSPACE.LAM1 > 0)
 		{
 			sprintf(Buffer, "%06.2f E", GC->rtcc->EZSPACE.LAM1);
@@ -3731,11 +3203,9 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 		{
 			sprintf(Buffer, "%06.2f W", abs(GC->rtcc->EZSPACE.LAM1));
 		}
-		skp->Text(10 * W / 32, 20 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%08.1f", GC->rtcc->EZSPACE.HS);
-		skp->Text(10 * W / 32, 21 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%08.1f", GC->rtcc->EZSPACE.HO);
-		skp->Text(10 * W / 32, 22 * H / 28, Buffer, strlen(Buffer));
+		page.Text(10 * W / 32, 20 * H / 28, Buffer, strlen(Buffer));
+		page.Printf(10 * W / 32, 21 * H / 28, "%08.1f", GC->rtcc->EZSPACE.HS);
+		page.Printf(10 * W / 32, 22 * H / 28, "%08.1f", GC->rtcc->EZSPACE.HO);
 		if (GC->rtcc->EZSPACE.PHIO > 0)
 		{
 			sprintf(Buffer, "%06.2f N", GC->rtcc->EZSPACE.PHIO);
@@ -3744,36 +3214,24 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 		{
 			sprintf(Buffer, "%06.2f S", abs(GC->rtcc->EZSPACE.PHIO));
 		}
-		skp->Text(10 * W / 32, 23 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%05.2f", GC->rtcc->EZSPACE.IEMP);
-		skp->Text(7 * W / 32, 24 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%05.2f", GC->rtcc->EZSPACE.W1);
-		skp->Text(7 * W / 32, 25 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%05.2f", GC->rtcc->EZSPACE.OMG);
-		skp->Text(7 * W / 32, 26 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%05.2f", GC->rtcc->EZSPACE.PRA);
-		skp->Text(7 * W / 32, 27 * H / 28, Buffer, strlen(Buffer));
+		page.Text(10 * W / 32, 23 * H / 28, Buffer, strlen(Buffer));
+		page.Printf(7 * W / 32, 24 * H / 28, "%05.2f", GC->rtcc->EZSPACE.IEMP);
+		page.Printf(7 * W / 32, 25 * H / 28, "%05.2f", GC->rtcc->EZSPACE.W1);
+		page.Printf(7 * W / 32, 26 * H / 28, "%05.2f", GC->rtcc->EZSPACE.OMG);
+		page.Printf(7 * W / 32, 27 * H / 28, "%05.2f", GC->rtcc->EZSPACE.PRA);
 
 		if (GC->rtcc->EZSPACE.A1 > 0)
 		{
-			sprintf(Buffer, "%06.0f", GC->rtcc->EZSPACE.A1);
-			skp->Text(13 * W / 32, 24 * H / 28, Buffer, strlen(Buffer));
-		}
-		sprintf(Buffer, "%05.2f", GC->rtcc->EZSPACE.L1);
-		skp->Text(13 * W / 32, 25 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%.5f", GC->rtcc->EZSPACE.E1);
-		skp->Text(13 * W / 32, 26 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%05.2f", GC->rtcc->EZSPACE.I1);
-		skp->Text(13 * W / 32, 27 * H / 28, Buffer, strlen(Buffer));
-
-		GET_Display(Buffer, GC->rtcc->EZSPACE.GETSI, false);
-		skp->Text(20 * W / 32, 10 * H / 28, Buffer, strlen(Buffer));
-		GET_Display(Buffer, GC->rtcc->EZSPACE.GETCA, false);
-		skp->Text(20 * W / 32, 11 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%05.0f", GC->rtcc->EZSPACE.VCA);
-		skp->Text(20 * W / 32, 12 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%08.1f", GC->rtcc->EZSPACE.HCA);
-		skp->Text(20 * W / 32, 13 * H / 28, Buffer, strlen(Buffer));
+			page.Printf(13 * W / 32, 24 * H / 28, "%06.0f", GC->rtcc->EZSPACE.A1);
+		}
+		page.Printf(13 * W / 32, 25 * H / 28, "%05.2f", GC->rtcc->EZSPACE.L1);
+		page.Printf(13 * W / 32, 26 * H / 28, "%.5f", GC->rtcc->EZSPACE.E1);
+		page.Printf(13 * W / 32, 27 * H / 28, "%05.2f", GC->rtcc->EZSPACE.I1);
+
+		page.Format(20 * W / 32, 10 * H / 28, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->EZSPACE.GETSI, false);
+		page.Format(20 * W / 32, 11 * H / 28, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->EZSPACE.GETCA, false);
+		page.Printf(20 * W / 32, 12 * H / 28, "%05.0f", GC->rtcc->EZSPACE.VCA);
+		page.Printf(20 * W / 32, 13 * H / 28, "%08.1f", GC->rtcc->EZSPACE.HCA);
 		if (GC->rtcc->EZSPACE.PCA > 0)
 		{
 			sprintf(Buffer, "%06.2f N", GC->rtcc->EZSPACE.PCA);
@@ -3782,7 +3240,7 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 		{
 			sprintf(Buffer, "%06.2f S", abs(GC->rtcc->EZSPACE.PCA));
 		}
-		skp->Text(20 * W / 32, 14 * H / 28, Buffer, strlen(Buffer));
+		page.Text(20 * W / 32, 14 * H / 28, Buffer, strlen(Buffer));
 		if (GC->rtcc->EZSPACE.LCA > 0)
 		{
 			sprintf(Buffer, "%06.2f E", GC->rtcc->EZSPACE.LCA);
@@ -3791,13 +3249,10 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 		{
 			sprintf(Buffer, "%06.2f W", abs(GC->rtcc->EZSPACE.LCA));
 		}
-		skp->Text(20 * W / 32, 15 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%+06.1f", GC->rtcc->EZSPACE.PSICA);
-		skp->Text(20 * W / 32, 16 * H / 28, Buffer, strlen(Buffer));
-		GET_Display(Buffer, GC->rtcc->EZSPACE.GETMN, false);
-		skp->Text(20 * W / 32, 17 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%08.1f", GC->rtcc->EZSPACE.HMN);
-		skp->Text(20 * W / 32, 18 * H / 28, Buffer, strlen(Buffer));
+		page.Text(20 * W / 32, 15 * H / 28, Buffer, strlen(Buffer));
+		page.Printf(20 * W / 32, 16 * H / 28, "%+06.1f", GC->rtcc->EZSPACE.PSICA);
+		page.Format(20 * W / 32, 17 * H / 28, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->EZSPACE.GETMN, false);
+		page.Printf(20 * W / 32, 18 * H / 28, "%08.1f", GC->rtcc->EZSPACE.HMN);
 		if (GC->rtcc->EZSPACE.PMN > 0)
 		{
 			sprintf(Buffer, "%06.2f N", GC->rtcc->EZSPACE.PMN);
@@ -3806,7 +3261,7 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 		{
 			sprintf(Buffer, "%06.2f S", abs(GC->rtcc->EZSPACE.PMN));
 		}
-		skp->Text(20 * W / 32, 19 * H / 28, Buffer, strlen(Buffer));
+		page.Text(20 * W / 32, 19 * H / 28, Buffer, strlen(Buffer));
 		if (GC->rtcc->EZSPACE.LMN > 0)
 		{
 			sprintf(Buffer, "%06.2f E", GC->rtcc->EZSPACE.LMN);
@@ -3815,19 +3270,14 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 		{
 			sprintf(Buffer, "%06.2f W", abs(GC->rtcc->EZSPACE.LMN));
 		}
-		skp->Text(20 * W / 32, 20 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%05.2f", GC->rtcc->EZSPACE.DMN);
-		skp->Text(20 * W / 32, 21 * H / 28, Buffer, strlen(Buffer));
+		page.Text(20 * W / 32, 20 * H / 28, Buffer, strlen(Buffer));
+		page.Printf(20 * W / 32, 21 * H / 28, "%05.2f", GC->rtcc->EZSPACE.DMN);
 
 
-		GET_Display(Buffer, GC->rtcc->EZSPACE.GETSE, false);
-		skp->Text(30 * W / 32, 10 * H / 28, Buffer, strlen(Buffer));
-		GET_Display(Buffer, GC->rtcc->EZSPACE.GETEI, false);
-		skp->Text(30 * W / 32, 11 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%08.2f", GC->rtcc->EZSPACE.VEI);
-		skp->Text(30 * W / 32, 12 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%+07.2f", GC->rtcc->EZSPACE.GEI);
-		skp->Text(30 * W / 32, 13 * H / 28, Buffer, strlen(Buffer));
+		page.Format(30 * W / 32, 10 * H / 28, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->EZSPACE.GETSE, false);
+		page.Format(30 * W / 32, 11 * H / 28, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->EZSPACE.GETEI, false);
+		page.Printf(30 * W / 32, 12 * H / 28, "%08.2f", GC->rtcc->EZSPACE.VEI);
+		page.Printf(30 * W / 32, 13 * H / 28, "%+07.2f", GC->rtcc->EZSPACE.GEI);
 		if (GC->rtcc->EZSPACE.PEI > 0)
 		{
 			sprintf(Buffer, "%06.2f N", GC->rtcc->EZSPACE.PEI);
@@ -3836,7 +3286,7 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 		{
 			sprintf(Buffer, "%06.2f S", abs(GC->rtcc->EZSPACE.PEI));
 		}
-		skp->Text(30 * W / 32, 14 * H / 28, Buffer, strlen(Buffer));
+		page.Text(30 * W / 32, 14 * H / 28, Buffer, strlen(Buffer));
 		if (GC->rtcc->EZSPACE.LEI > 0)
 		{
 			sprintf(Buffer, "%06.2f E", GC->rtcc->EZSPACE.LEI);
@@ -3845,15 +3295,11 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 		{
 			sprintf(Buffer, "%06.2f W", abs(GC->rtcc->EZSPACE.LEI));
 		}
-		skp->Text(30 * W / 32, 15 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%+07.2f", GC->rtcc->EZSPACE.PSIEI);
-		skp->Text(30 * W / 32, 16 * H / 28, Buffer, strlen(Buffer));
-		GET_Display(Buffer, GC->rtcc->EZSPACE.GETVP, false);
-		skp->Text(30 * W / 32, 17 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%08.2f", GC->rtcc->EZSPACE.VVP);
-		skp->Text(30 * W / 32, 18 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%08.1f", GC->rtcc->EZSPACE.HVP);
-		skp->Text(30 * W / 32, 19 * H / 28, Buffer, strlen(Buffer));
+		page.Text(30 * W / 32, 15 * H / 28, Buffer, strlen(Buffer));
+		page.Printf(30 * W / 32, 16 * H / 28, "%+07.2f", GC->rtcc->EZSPACE.PSIEI);
+		page.Format(30 * W / 32, 17 * H / 28, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->EZSPACE.GETVP, false);
+		page.Printf(30 * W / 32, 18 * H / 28, "%08.2f", GC->rtcc->EZSPACE.VVP);
+		page.Printf(30 * W / 32, 19 * H / 28, "%08.1f", GC->rtcc->EZSPACE.HVP);
 		if (GC->rtcc->EZSPACE.PVP > 0)
 		{
 			sprintf(Buffer, "%06.2f N", GC->rtcc->EZSPACE.PVP);
@@ -3862,7 +3308,7 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 		{
 			sprintf(Buffer, "%06.2f S", abs(GC->rtcc->EZSPACE.PVP));
 		}
-		skp->Text(30 * W / 32, 20 * H / 28, Buffer, strlen(Buffer));
+		page.Text(30 * W / 32, 20 * H / 28, Buffer, strlen(Buffer));
 		if (GC->rtcc->EZSPACE.LVP > 0)
 		{
 			sprintf(Buffer, "%06.2f E", GC->rtcc->EZSPACE.LVP);
@@ -3871,81 +3317,74 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 		{
 			sprintf(Buffer, "%06.2f W", abs(GC->rtcc->EZSPACE.LVP));
 		}
-		skp->Text(30 * W / 32, 21 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%+07.2f", GC->rtcc->EZSPACE.PSIVP);
-		skp->Text(30 * W / 32, 22 * H / 28, Buffer, strlen(Buffer));
+		page.Text(30 * W / 32, 21 * H / 28, Buffer, strlen(Buffer));
+		page.Printf(30 * W / 32, 22 * H / 28, "%+07.2f", GC->rtcc->EZSPACE.PSIVP);
 
-		sprintf(Buffer, "%05.2f", GC->rtcc->EZSPACE.IE);
-		skp->Text(30 * W / 32, 26 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%06.2f", GC->rtcc->EZSPACE.LN);
-		skp->Text(30 * W / 32, 27 * H / 28, Buffer, strlen(Buffer));
+		page.Printf(30 * W / 32, 26 * H / 28, "%05.2f", GC->rtcc->EZSPACE.IE);
+		page.Printf(30 * W / 32, 27 * H / 28, "%06.2f", GC->rtcc->EZSPACE.LN);
 	}
 	else if (screen == 44)
 	{
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
-		skp->Text(4 * W / 8, 1 * H / 14, "MISSION PLAN TABLE (MSK 0047)", 29);
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
+		page.Text(4 * W / 8, 1 * H / 14, "MISSION PLAN TABLE (MSK 0047)", 29);
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
 		if (GC->MissionPlanningActive)
 		{
-			skp->Text(1 * W / 32, 2 * H / 14, "Active", 6);
+			page.Text(1 * W / 32, 2 * H / 14, "Active", 6);
 		}
 		else
 		{
-			skp->Text(1 * W / 32, 2 * H / 14, "Inactive", 8);
+			page.Text(1 * W / 32, 2 * H / 14, "Inactive", 8);
 		}
 
-		skp->SetFont(font2);
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
-		skp->Text(3 * W / 32, 8 * H / 28, "GETBI", 5);
-		skp->Text(8 * W / 32, 8 * H / 28, "DT", 2);
-		skp->Text(12 * W / 32, 8 * H / 28, "DELTAV", 6);
-		skp->Text(16 * W / 32, 8 * H / 28, "DVREM", 5);
-		skp->Text(20 * W / 32, 8 * H / 28, "HA", 2);
-		skp->Text(47 * W / 64, 8 * H / 28, "HP", 2);
-		skp->Text(29 * W / 32, 8 * H / 28, "CODE", 4);
+		page.SetFont(font2);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
+		page.Text(3 * W / 32, 8 * H / 28, "GETBI", 5);
+		page.Text(8 * W / 32, 8 * H / 28, "DT", 2);
+		page.Text(12 * W / 32, 8 * H / 28, "DELTAV", 6);
+		page.Text(16 * W / 32, 8 * H / 28, "DVREM", 5);
+		page.Text(20 * W / 32, 8 * H / 28, "HA", 2);
+		page.Text(47 * W / 64, 8 * H / 28, "HP", 2);
+		page.Text(29 * W / 32, 8 * H / 28, "CODE", 4);
 
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
 
-		skp->Text(6 * W / 32, 5 * H / 28, "CSM STA ID", 10);
+		page.Text(6 * W / 32, 5 * H / 28, "CSM STA ID", 10);
 		sprintf_s(Buffer, GC->rtcc->MPTDISPLAY.CSMSTAID.c_str());
-		skp->Text(12 * W / 32, 5 * H / 28, Buffer, strlen(Buffer));
-		skp->Text(6 * W / 32, 6 * H / 28, "GETAV", 5);
+		page.Text(12 * W / 32, 5 * H / 28, Buffer, strlen(Buffer));
+		page.Text(6 * W / 32, 6 * H / 28, "GETAV", 5);
 		sprintf_s(Buffer, GC->rtcc->MPTDISPLAY.CSMGETAV.c_str());
-		skp->Text(10 * W / 32, 6 * H / 28, Buffer, strlen(Buffer));
-		skp->Text(18 * W / 32, 5 * H / 28, "LEM STA ID", 10);
+		page.Text(10 * W / 32, 6 * H / 28, Buffer, strlen(Buffer));
+		page.Text(18 * W / 32, 5 * H / 28, "LEM STA ID", 10);
 		sprintf_s(Buffer, GC->rtcc->MPTDISPLAY.LEMSTAID.c_str());
-		skp->Text(24 * W / 32, 5 * H / 28, Buffer, strlen(Buffer));
-		skp->Text(18 * W / 32, 6 * H / 28, "GETAV", 5);
+		page.Text(24 * W / 32, 5 * H / 28, Buffer, strlen(Buffer));
+		page.Text(18 * W / 32, 6 * H / 28, "GETAV", 5);
 		sprintf_s(Buffer, GC->rtcc->MPTDISPLAY.LEMGETAV.c_str());
-		skp->Text(22 * W / 32, 6 * H / 28, Buffer, strlen(Buffer));
+		page.Text(22 * W / 32, 6 * H / 28, Buffer, strlen(Buffer));
 
-		skp->SetTextAlign(oapi::Sketchpad::RIGHT);
+		page.SetTextAlign(oapi::Sketchpad::RIGHT);
 
 		for (unsigned i = 0;i < GC->rtcc->MPTDISPLAY.man.size();i++)
 		{
 			sprintf(Buffer, GC->rtcc->MPTDISPLAY.man[i].GETBI.c_str());
-			skp->Text(5 * W / 32, (i * 2 + 9) * H / 28, Buffer, strlen(Buffer));
+			page.Text(5 * W / 32, (i * 2 + 9) * H / 28, Buffer, strlen(Buffer));
 
-			sprintf(Buffer, "%07.1f", GC->rtcc->MPTDISPLAY.man[i].DELTAV);
-			skp->Text(14 * W / 32, (i * 2 + 9) * H / 28, Buffer, strlen(Buffer));
+			page.Printf(14 * W / 32, (i * 2 + 9) * H / 28, "%07.1f", GC->rtcc->MPTDISPLAY.man[i].DELTAV);
 
-			sprintf(Buffer, "%.1f", GC->rtcc->MPTDISPLAY.man[i].DVREM);
-			skp->Text(18 * W / 32, (i * 2 + 9) * H / 28, Buffer, strlen(Buffer));
+			page.Printf(18 * W / 32, (i * 2 + 9) * H / 28, "%.1f", GC->rtcc->MPTDISPLAY.man[i].DVREM);
 
-			sprintf(Buffer, "%06.1f", GC->rtcc->MPTDISPLAY.man[i].HA);
-			skp->Text(43 * W / 64, (i * 2 + 9) * H / 28, Buffer, strlen(Buffer));
+			page.Printf(43 * W / 64, (i * 2 + 9) * H / 28, "%06.1f", GC->rtcc->MPTDISPLAY.man[i].HA);
 
-			sprintf(Buffer, "%06.1f", GC->rtcc->MPTDISPLAY.man[i].HP);
-			skp->Text(50 * W / 64, (i * 2 + 9) * H / 28, Buffer, strlen(Buffer));
+			page.Printf(50 * W / 64, (i * 2 + 9) * H / 28, "%06.1f", GC->rtcc->MPTDISPLAY.man[i].HP);
 
 			sprintf(Buffer, GC->rtcc->MPTDISPLAY.man[i].code.c_str());
-			skp->Text(63 * W / 64, (i * 2 + 9) * H / 28, Buffer, strlen(Buffer));
+			page.Text(63 * W / 64, (i * 2 + 9) * H / 28, Buffer, strlen(Buffer));
 		}
 
 		for (unsigned i = 1;i < GC->rtcc->MPTDISPLAY.man.size();i++)
 		{
 			sprintf(Buffer, GC->rtcc->MPTDISPLAY.man[i].DT.c_str());
-			skp->Text(10 * W / 32, (i * 2 + 8) * H / 28, Buffer, strlen(Buffer));
+			page.Text(10 * W / 32, (i * 2 + 8) * H / 28, Buffer, strlen(Buffer));
 		}
 
 	}
@@ -3955,46 +3394,45 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 
 		if (GC->rtcc->SystemParameters.MGRTAG == 0)
 		{
-			skp->Text(1 * W / 16, 2 * H / 14, "Lunar", 5);
+			page.Text(1 * W / 16, 2 * H / 14, "Lunar", 5);
 		}
 		else
 		{
-			skp->Text(1 * W / 16, 2 * H / 14, "All", 3);
+			page.Text(1 * W / 16, 2 * H / 14, "All", 3);
 		}
 
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
 
-		skp->Text(4 * W / 8, 3 * H / 28, "NEXT STATION CONTACTS (MSK 1503)", 21);
+		page.Text(4 * W / 8, 3 * H / 28, "NEXT STATION CONTACTS (MSK 1503)", 21);
 
-		skp->Text(8 * W / 32, 5 * H / 28, "CSM", 3);
-		skp->Text(24 * W / 32, 5 * H / 28, "LEM", 3);
+		page.Text(8 * W / 32, 5 * H / 28, "CSM", 3);
+		page.Text(24 * W / 32, 5 * H / 28, "LEM", 3);
 
-		skp->SetFont(font2);
+		page.SetFont(font2);
 
-		skp->Text(12 * W / 32, 5 * H / 28, "GET", 3);
+		page.Text(12 * W / 32, 5 * H / 28, "GET", 3);
 
-		skp->Text(2 * W / 32, 17 * H / 56, "STA", 3);
-		skp->Text(6 * W / 32, 8 * H / 28, "GETHCA", 6);
-		skp->Text(6 * W / 32, 9 * H / 28, "DT KLOS", 7);
-		skp->Text(6 * W / 32, 10 * H / 28, "HH MM SS", 8);
-		skp->Text(10 * W / 32, 17 * H / 56, "EMAX", 4);
-		skp->Text(10 * W / 32, 10 * H / 28, "DEG", 4);
-		skp->Text(28 * W / 64, 8 * H / 28, "DTPASS", 6);
-		skp->Text(28 * W / 64, 9 * H / 28, "DT KH", 5);
-		skp->Text(28 * W / 64, 10 * H / 28, "HH MM SS", 8);
+		page.Text(2 * W / 32, 17 * H / 56, "STA", 3);
+		page.Text(6 * W / 32, 8 * H / 28, "GETHCA", 6);
+		page.Text(6 * W / 32, 9 * H / 28, "DT KLOS", 7);
+		page.Text(6 * W / 32, 10 * H / 28, "HH MM SS", 8);
+		page.Text(10 * W / 32, 17 * H / 56, "EMAX", 4);
+		page.Text(10 * W / 32, 10 * H / 28, "DEG", 4);
+		page.Text(28 * W / 64, 8 * H / 28, "DTPASS", 6);
+		page.Text(28 * W / 64, 9 * H / 28, "DT KH", 5);
+		page.Text(28 * W / 64, 10 * H / 28, "HH MM SS", 8);
 
-		skp->Text(35 * W / 64, 17 * H / 56, "STA", 3);
-		skp->Text(43 * W / 64, 8 * H / 28, "GETHCA", 6);
-		skp->Text(43 * W / 64, 9 * H / 28, "DT KLOS", 7);
-		skp->Text(43 * W / 64, 10 * H / 28, "HH MM SS", 8);
-		skp->Text(51 * W / 64, 17 * H / 56, "EMAX", 4);
-		skp->Text(51 * W / 64, 10 * H / 28, "DEG", 3);
-		skp->Text(59 * W / 64, 8 * H / 28, "DTPASS", 6);
-		skp->Text(59 * W / 64, 9 * H / 28, "DT KH", 5);
-		skp->Text(59 * W / 64, 10 * H / 28, "HH MM SS", 8);
+		page.Text(35 * W / 64, 17 * H / 56, "STA", 3);
+		page.Text(43 * W / 64, 8 * H / 28, "GETHCA", 6);
+		page.Text(43 * W / 64, 9 * H / 28, "DT KLOS", 7);
+		page.Text(43 * W / 64, 10 * H / 28, "HH MM SS", 8);
+		page.Text(51 * W / 64, 17 * H / 56, "EMAX", 4);
+		page.Text(51 * W / 64, 10 * H / 28, "DEG", 3);
+		page.Text(59 * W / 64, 8 * H / 28, "DTPASS", 6);
+		page.Text(59 * W / 64, 9 * H / 28, "DT KH", 5);
+		page.Text(59 * W / 64, 10 * H / 28, "HH MM SS", 8);
 
-		GET_Display(Buffer, GC->rtcc->NextStationContactsBuffer.GET, false);
-		skp->Text(16 * W / 32, 5 * H / 28, Buffer, strlen(Buffer));
+		page.Format(16 * W / 32, 5 * H / 28, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->NextStationContactsBuffer.GET, false);
 
 		unsigned i, j;
 		for (j = 0;j < 2;j++)
@@ -4002,24 +3440,21 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			for (i = 0;i < 6;i++)
 			{
 				sprintf_s(Buffer, GC->rtcc->NextStationContactsBuffer.STA[j][i].c_str());
-				skp->Text((4 + j * 31) * W / 64, (2*i + 11) * H / 28, Buffer, strlen(Buffer));
+				page.Text((4 + j * 31) * W / 64, (2*i + 11) * H / 28, Buffer, strlen(Buffer));
 
 				if (GC->rtcc->NextStationContactsBuffer.BestAvailableAOS[j][i])
 				{
-					skp->Text((7 + j * 31) * W / 64, (2*i + 11) * H / 28, "*", 1);
+					page.Text((7 + j * 31) * W / 64, (2*i + 11) * H / 28, "*", 1);
 				}
-				GET_Display(Buffer, GC->rtcc->NextStationContactsBuffer.GETHCA[j][i], false);
-				skp->Text((12 + j * 31) * W / 64, (2*i + 11) * H / 28, Buffer, strlen(Buffer));
+				page.Format((12 + j * 31) * W / 64, (2*i + 11) * H / 28, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->NextStationContactsBuffer.GETHCA[j][i], false);
 
 				if (GC->rtcc->NextStationContactsBuffer.BestAvailableEMAX[j][i])
 				{
-					skp->Text((17 + j * 31) * W / 64, (2*i + 11) * H / 28, "*", 1);
+					page.Text((17 + j * 31) * W / 64, (2*i + 11) * H / 28, "*", 1);
 				}
-				sprintf_s(Buffer, "%.1f", GC->rtcc->NextStationContactsBuffer.EMAX[j][i]);
-				skp->Text((20 + j * 31) * W / 64, (2*i + 11) * H / 28, Buffer, strlen(Buffer));
+				page.Printf((20 + j * 31) * W / 64, (2*i + 11) * H / 28, "%.1f", GC->rtcc->NextStationContactsBuffer.EMAX[j][i]);
 
-				GET_Display4(Buffer, GC->rtcc->NextStationContactsBuffer.DTPASS[j][i]);
-				skp->Text((27 + j * 31) * W / 64, (2*i + 11) * H / 28, Buffer, strlen(Buffer));
+				page.Format((27 + j * 31) * W / 64, (2*i + 11) * H / 28, this, &ApolloRTCCMFD::GET_Display4, GC->rtcc->NextStationContactsBuffer.DTPASS[j][i]);
 			}
 		}
 	}
@@ -4027,135 +3462,129 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 	{
 		PredictedSiteAcquisitionTable *tab;
 
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
 
 		if (screen == 46)
 		{
-			skp->Text(4 * W / 8, 1 * H / 28, "PREDICTED SITE ACQUISITION TABLE NO 1", 37);
+			page.Text(4 * W / 8, 1 * H / 28, "PREDICTED SITE ACQUISITION TABLE NO 1", 37);
 			tab = &GC->rtcc->EZACQ1;
 		}
 		else if (screen == 72)
 		{
-			skp->Text(4 * W / 8, 1 * H / 28, "PREDICTED SITE ACQUISITION TABLE NO 1", 37);
+			page.Text(4 * W / 8, 1 * H / 28, "PREDICTED SITE ACQUISITION TABLE NO 1", 37);
 			tab = &GC->rtcc->EZACQ3;
 		}
 		else if (screen == 73)
 		{
-			skp->Text(4 * W / 8, 1 * H / 28, "PREDICTED SITE ACQUISITION TABLE NO 2", 37);
+			page.Text(4 * W / 8, 1 * H / 28, "PREDICTED SITE ACQUISITION TABLE NO 2", 37);
 			tab = &GC->rtcc->EZDPSAD1;
 		}
 		else
 		{
-			skp->Text(4 * W / 8, 1 * H / 28, "PREDICTED SITE ACQUISITION TABLE NO 2", 37);
+			page.Text(4 * W / 8, 1 * H / 28, "PREDICTED SITE ACQUISITION TABLE NO 2", 37);
 			tab = &GC->rtcc->EZDPSAD3;
 		}
 
-		skp->SetFont(font2);
+		page.SetFont(font2);
 
-		skp->Text(22 * W / 32, 3 * H / 28, "STA ID", 6);
-		skp->Text(4 * W / 32, 11 * H / 56, "REV", 3);
-		skp->Text(10 * W / 32, 11 * H / 56, "STA", 3);
-		skp->Text(15 * W / 32, 5 * H / 28, "AOS", 3);
-		skp->Text(15 * W / 32, 6 * H / 28, "GET", 3);
-		skp->Text(21 * W / 32, 5 * H / 28, "LOS", 3);
-		skp->Text(21 * W / 32, 6 * H / 28, "GET", 3);
-		skp->Text(26 * W / 32, 5 * H / 28, "MAX ELEV", 8);
-		skp->Text(26 * W / 32, 6 * H / 28, "DEG", 3);
+		page.Text(22 * W / 32, 3 * H / 28, "STA ID", 6);
+		page.Text(4 * W / 32, 11 * H / 56, "REV", 3);
+		page.Text(10 * W / 32, 11 * H / 56, "STA", 3);
+		page.Text(15 * W / 32, 5 * H / 28, "AOS", 3);
+		page.Text(15 * W / 32, 6 * H / 28, "GET", 3);
+		page.Text(21 * W / 32, 5 * H / 28, "LOS", 3);
+		page.Text(21 * W / 32, 6 * H / 28, "GET", 3);
+		page.Text(26 * W / 32, 5 * H / 28, "MAX ELEV", 8);
+		page.Text(26 * W / 32, 6 * H / 28, "DEG", 3);
 
-		sprintf_s(Buffer, "PAGE %02d OF %02d", tab->curpage, tab->pages);
-		skp->Text(6 * W / 32, 3 * H / 28, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "VEHICLE %s", tab->VEHICLE.c_str());
-		skp->Text(14 * W / 32, 3 * H / 28, Buffer, strlen(Buffer));
+		page.Printf(6 * W / 32, 3 * H / 28, "PAGE %02d OF %02d", tab->curpage, tab->pages);
+		page.Printf(14 * W / 32, 3 * H / 28, "VEHICLE %s", tab->VEHICLE.c_str());
 
 		for (unsigned i = 0;i < tab->numcontacts[tab->curpage - 1];i++)
 		{
-			sprintf_s(Buffer, "%03d", tab->REV[tab->curpage-1][i]);
-			skp->Text(4 * W / 32, (i + 7) * H / 28, Buffer, strlen(Buffer));
+			page.Printf(4 * W / 32, (i + 7) * H / 28, "%03d", tab->REV[tab->curpage-1][i]);
 
 			sprintf_s(Buffer, tab->STA[tab->curpage - 1][i].c_str());
-			skp->Text(10 * W / 32, (i + 7) * H / 28, Buffer, strlen(Buffer));
+			page.Text(10 * W / 32, (i + 7) * H / 28, Buffer, strlen(Buffer));
 
 			if (tab->BestAvailableAOS[tab->curpage - 1][i])
 			{
-				skp->Text(25 * W / 64, (i + 7) * H / 28, "*", 1);
+				page.Text(25 * W / 64, (i + 7) * H / 28, "*", 1);
 			}
 
-			GET_Display(Buffer, tab->GETHCA[tab->curpage - 1][i], false);
-			skp->Text(15 * W / 32, (i + 7) * H / 28, Buffer, strlen(Buffer));
+			page.Format(15 * W / 32, (i + 7) * H / 28, this, &ApolloRTCCMFD::GET_Display, tab->GETHCA[tab->curpage - 1][i], false);
 
 			if (tab->BestAvailableLOS[tab->curpage - 1][i])
 			{
-				skp->Text(37 * W / 64, (i + 7) * H / 28, "*", 1);
+				page.Text(37 * W / 64, (i + 7) * H / 28, "*", 1);
 			}
 
-			GET_Display(Buffer, tab->GETHCD[tab->curpage - 1][i], false);
-			skp->Text(21 * W / 32, (i + 7) * H / 28, Buffer, strlen(Buffer));
+			page.Format(21 * W / 32, (i + 7) * H / 28, this, &ApolloRTCCMFD::GET_Display, tab->GETHCD[tab->curpage - 1][i], false);
 
 			if (tab->BestAvailableEMAX[tab->curpage - 1][i])
 			{
-				skp->Text(24 * W / 32, (i + 7) * H / 28, "*", 1);
+				page.Text(24 * W / 32, (i + 7) * H / 28, "*", 1);
 			}
-			sprintf_s(Buffer, "%04.1f", tab->ELMAX[tab->curpage - 1][i]);
-			skp->Text(26 * W / 32, (i + 7) * H / 28, Buffer, strlen(Buffer));
+			page.Printf(26 * W / 32, (i + 7) * H / 28, "%04.1f", tab->ELMAX[tab->curpage - 1][i]);
 		}
 	}
 	else if (screen == 47)
 	{
-		skp->SetFont(font2);
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
-
-		skp->Text(1 * W / 16, 4 * H / 28, "00: CMC CSM Navigation Update", 29);
-		skp->Text(1 * W / 16, 5 * H / 28, "06: CMC Landing Site Vector", 27);
-		skp->Text(1 * W / 16, 6 * H / 28, "07: CMC Time Increment", 22);
-		skp->Text(1 * W / 16, 7 * H / 28, "08: CMC Liftoff Time Update", 27);
-		skp->Text(1 * W / 16, 8 * H / 28, "09: CMC LM Navigation Update", 28);
-		skp->Text(1 * W / 16, 9 * H / 28, "10: CMC External DV", 19);
-		skp->Text(1 * W / 16, 10 * H / 28, "12: CMC REFSMMAT Update", 23);
-		skp->Text(1 * W / 16, 11 * H / 28, "13: CMC Retrofire External DV", 29);
-		skp->Text(1 * W / 16, 12 * H / 28, "14: CMC Entry Update", 20);
-
-		skp->Text(1 * W / 16, 14 * H / 28, "20: LGC LM Navigation Update", 28);
-		skp->Text(1 * W / 16, 15 * H / 28, "21: LGC CSM Navigation Update", 29);
-		skp->Text(1 * W / 16, 16 * H / 28, "22: LGC External DV", 19);
-		skp->Text(1 * W / 16, 17 * H / 28, "23: LGC REFSMMAT Update", 23);
-		skp->Text(1 * W / 16, 18 * H / 28, "24: LGC Time Increment", 22);
-		skp->Text(1 * W / 16, 19 * H / 28, "25: LGC Liftoff Time Update", 27);
-		skp->Text(1 * W / 16, 20 * H / 28, "26: LGC Landing Site Vector", 27);
-		skp->Text(1 * W / 16, 21 * H / 28, "28: LGC Descent Update", 22);
-
-		skp->Text(9 * W / 16, 4 * H / 28, "49: LVDC Navigation Update", 26);
+		page.SetFont(font2);
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
+
+		page.Text(1 * W / 16, 4 * H / 28, "00: CMC CSM Navigation Update", 29);
+		page.Text(1 * W / 16, 5 * H / 28, "06: CMC Landing Site Vector", 27);
+		page.Text(1 * W / 16, 6 * H / 28, "07: CMC Time Increment", 22);
+		page.Text(1 * W / 16, 7 * H / 28, "08: CMC Liftoff Time Update", 27);
+		page.Text(1 * W / 16, 8 * H / 28, "09: CMC LM Navigation Update", 28);
+		page.Text(1 * W / 16, 9 * H / 28, "10: CMC External DV", 19);
+		page.Text(1 * W / 16, 10 * H / 28, "12: CMC REFSMMAT Update", 23);
+		page.Text(1 * W / 16, 11 * H / 28, "13: CMC Retrofire External DV", 29);
+		page.Text(1 * W / 16, 12 * H / 28, "14: CMC Entry Update", 20);
+
+		page.Text(1 * W / 16, 14 * H / 28, "20: LGC LM Navigation Update", 28);
+		page.Text(1 * W / 16, 15 * H / 28, "21: LGC CSM Navigation Update", 29);
+		page.Text(1 * W / 16, 16 * H / 28, "22: LGC External DV", 19);
+		page.Text(1 * W / 16, 17 * H / 28, "23: LGC REFSMMAT Update", 23);
+		page.Text(1 * W / 16, 18 * H / 28, "24: LGC Time Increment", 22);
+		page.Text(1 * W / 16, 19 * H / 28, "25: LGC Liftoff Time Update", 27);
+		page.Text(1 * W / 16, 20 * H / 28, "26: LGC Landing Site Vector", 27);
+		page.Text(1 * W / 16, 21 * H / 28, "28: LGC Descent Update", 22);
+
+		page.Text(9 * W / 16, 4 * H / 28, "49: LVDC Navigation Update", 26);
 	}
 	else if (screen == 48 || screen == 99 || screen == 100 || screen == 101)
 	{
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
 
 		RTCC::NavUpdateMakeupBuffer * tab;
 		if (screen == 48)
 		{
-			skp->Text(4 * W / 8, 1 * H / 14, "CSM NAV UPDATE TO CMC (276)", 27);
+			page.Text(4 * W / 8, 1 * H / 14, "CSM NAV UPDATE TO CMC (276)", 27);
 			tab = &GC->rtcc->CZNAVGEN.CMCCSMUpdate;
 		}
 		else if (screen == 99)
 		{
-			skp->Text(4 * W / 8, 1 * H / 14, "LM NAV UPDATE TO CMC (270)", 26);
+			page.Text(4 * W / 8, 1 * H / 14, "LM NAV UPDATE TO CMC (270)", 26);
 			tab = &GC->rtcc->CZNAVGEN.CMCLEMUpdate;
 		}
 		else if (screen == 100)
 		{
-			skp->Text(4 * W / 8, 1 * H / 14, "LGC CSM NAV UPDATE (278)", 24);
+			page.Text(4 * W / 8, 1 * H / 14, "LGC CSM NAV UPDATE (278)", 24);
 			tab = &GC->rtcc->CZNAVGEN.LGCCSMUpdate;
 		}
 		else
 		{
-			skp->Text(4 * W / 8, 1 * H / 14, "LGC LM NAV UPDATE (279)", 23);
+			page.Text(4 * W / 8, 1 * H / 14, "LGC LM NAV UPDATE (279)", 23);
 			tab = &GC->rtcc->CZNAVGEN.LGCLEMUpdate;
 		}
 
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
 
-		skp->Text(1 * W / 8, 4 * H / 28, "GET", 3);
-		skp->Text(1 * W / 8, 5 * H / 28, "LOAD NO", 7);
-		skp->Text(1 * W / 8, 6 * H / 28, "REF", 3);
+		page.Text(1 * W / 8, 4 * H / 28, "GET", 3);
+		page.Text(1 * W / 8, 5 * H / 28, "LOAD NO", 7);
+		page.Text(1 * W / 8, 6 * H / 28, "REF", 3);
 
 		if (G->SVDesiredGET < 0)
 		{
@@ -4165,16 +3594,15 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 		{
 			GET_Display(Buffer, G->SVDesiredGET);
 		}
-		skp->Text(2 * W / 8, 4 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%04d", tab->SequenceNumber);
-		skp->Text(3 * W / 8, 5 * H / 28, Buffer, strlen(Buffer));
+		page.Text(2 * W / 8, 4 * H / 28, Buffer, strlen(Buffer));
+		page.Printf(3 * W / 8, 5 * H / 28, "%04d", tab->SequenceNumber);
 		if (tab->sv.RBI == BODY_EARTH)
 		{
-			skp->Text(2 * W / 8, 6 * H / 28, "Earth", 5);
+			page.Text(2 * W / 8, 6 * H / 28, "Earth", 5);
 		}
 		else if (tab->sv.RBI == BODY_MOON)
 		{
-			skp->Text(2 * W / 8, 6 * H / 28, "Moon", 4);
+			page.Text(2 * W / 8, 6 * H / 28, "Moon", 4);
 		}
 
 		if (GC->MissionPlanningActive == false)
@@ -4187,180 +3615,159 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			{
 				sprintf(Buffer, "No Vehicle");
 			}
-			skp->Text(5 * W / 8, 2 * H / 14, Buffer, strlen(Buffer));
+			page.Text(5 * W / 8, 2 * H / 14, Buffer, strlen(Buffer));
 		}
 
-		skp->Text(5 * W / 32, 9 * H / 28, "OID", 3);
-		skp->Text(10 * W / 32, 9 * H / 28, "FCT", 3);
-		skp->Text(15 * W / 32, 9 * H / 28, "DSKY V71", 8);
-		skp->Text(22 * W / 32, 9 * H / 28, "VECTOR", 6);
+		page.Text(5 * W / 32, 9 * H / 28, "OID", 3);
+		page.Text(10 * W / 32, 9 * H / 28, "FCT", 3);
+		page.Text(15 * W / 32, 9 * H / 28, "DSKY V71", 8);
+		page.Text(22 * W / 32, 9 * H / 28, "VECTOR", 6);
 
 		for (int i = 1;i <= 021;i++)
 		{
-			sprintf(Buffer, "%o", i);
-			skp->Text(5 * W / 32, (i + 9) * H / 28, Buffer, strlen(Buffer));
-		}
-
-		skp->Text(10 * W / 32, 10 * H / 28, "INDEX", 5);
-		skp->Text(10 * W / 32, 11 * H / 28, "ADD", 3);
-		skp->Text(10 * W / 32, 12 * H / 28, "VID", 3);
-		skp->Text(10 * W / 32, 13 * H / 28, "X", 1);
-		skp->Text(10 * W / 32, 14 * H / 28, "X", 1);
-		skp->Text(10 * W / 32, 15 * H / 28, "Y", 1);
-		skp->Text(10 * W / 32, 16 * H / 28, "Y", 1);
-		skp->Text(10 * W / 32, 17 * H / 28, "Z", 1);
-		skp->Text(10 * W / 32, 18 * H / 28, "Z", 1);
-		skp->Text(10 * W / 32, 19 * H / 28, "X-DOT", 5);
-		skp->Text(10 * W / 32, 20 * H / 28, "X-DOT", 5);
-		skp->Text(10 * W / 32, 21 * H / 28, "Y-DOT", 5);
-		skp->Text(10 * W / 32, 22 * H / 28, "Y-DOT", 5);
-		skp->Text(10 * W / 32, 23 * H / 28, "Z-DOT", 5);
-		skp->Text(10 * W / 32, 24 * H / 28, "Z-DOT", 5);
-		skp->Text(10 * W / 32, 25 * H / 28, "T", 1);
-		skp->Text(10 * W / 32, 26 * H / 28, "T", 1);
+			page.Printf(5 * W / 32, (i + 9) * H / 28, "%o", i);
+		}
+
+		page.Text(10 * W / 32, 10 * H / 28, "INDEX", 5);
+		page.Text(10 * W / 32, 11 * H / 28, "ADD", 3);
+		page.Text(10 * W / 32, 12 * H / 28, "VID", 3);
+		page.Text(10 * W / 32, 13 * H / 28, "X", 1);
+		page.Text(10 * W / 32, 14 * H / 28, "X", 1);
+		page.Text(10 * W / 32, 15 * H / 28, "Y", 1);
+		page.Text(10 * W / 32, 16 * H / 28, "Y", 1);
+		page.Text(10 * W / 32, 17 * H / 28, "Z", 1);
+		page.Text(10 * W / 32, 18 * H / 28, "Z", 1);
+		page.Text(10 * W / 32, 19 * H / 28, "X-DOT", 5);
+		page.Text(10 * W / 32, 20 * H / 28, "X-DOT", 5);
+		page.Text(10 * W / 32, 21 * H / 28, "Y-DOT", 5);
+		page.Text(10 * W / 32, 22 * H / 28, "Y-DOT", 5);
+		page.Text(10 * W / 32, 23 * H / 28, "Z-DOT", 5);
+		page.Text(10 * W / 32, 24 * H / 28, "Z-DOT", 5);
+		page.Text(10 * W / 32, 25 * H / 28, "T", 1);
+		page.Text(10 * W / 32, 26 * H / 28, "T", 1);
 
 		for (int i = 0;i < 021;i++)
 		{
-			sprintf(Buffer, "%05d", tab->Octals[i]);
-			skp->Text(15 * W / 32, (i + 10) * H / 28, Buffer, strlen(Buffer));
-		}
-
-		sprintf(Buffer, "%.1f", tab->sv.R.x);
-		skp->Text(22 * W / 32, 13 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%.1f", tab->sv.R.y);
-		skp->Text(22 * W / 32, 15 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%.1f", tab->sv.R.z);
-		skp->Text(22 * W / 32, 17 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%.1f", tab->sv.V.x);
-		skp->Text(22 * W / 32, 19 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%.1f", tab->sv.V.y);
-		skp->Text(22 * W / 32, 21 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%.1f", tab->sv.V.z);
-		skp->Text(22 * W / 32, 23 * H / 28, Buffer, strlen(Buffer));
-		GET_Display(Buffer, tab->sv.GMT, false);
-		skp->Text(22 * W / 32, 25 * H / 28, Buffer, strlen(Buffer));
+			page.Printf(15 * W / 32, (i + 10) * H / 28, "%05d", tab->Octals[i]);
+		}
+
+		page.Printf(22 * W / 32, 13 * H / 28, "%.1f", tab->sv.R.x);
+		page.Printf(22 * W / 32, 15 * H / 28, "%.1f", tab->sv.R.y);
+		page.Printf(22 * W / 32, 17 * H / 28, "%.1f", tab->sv.R.z);
+		page.Printf(22 * W / 32, 19 * H / 28, "%.1f", tab->sv.V.x);
+		page.Printf(22 * W / 32, 21 * H / 28, "%.1f", tab->sv.V.y);
+		page.Printf(22 * W / 32, 23 * H / 28, "%.1f", tab->sv.V.z);
+		page.Format(22 * W / 32, 25 * H / 28, this, &ApolloRTCCMFD::GET_Display, tab->sv.GMT, false);
 	}
 	else if (screen == 49)
 	{
-		skp->Text(5 * W / 8, (int)(0.5 * H / 14), "Landing Site Update", 19);
+		page.Text(5 * W / 8, (int)(0.5 * H / 14), "Landing Site Update", 19);
 
 		if (G->svtarget != NULL)
 		{
 			sprintf(Buffer, G->svtarget->GetName());
-			skp->Text(1 * W / 16, 2 * H / 14, Buffer, strlen(Buffer));
+			page.Text(1 * W / 16, 2 * H / 14, Buffer, strlen(Buffer));
 		}
 		else
 		{
-			skp->Text(1 * W / 16, 2 * H / 14, "No Target!", 10);
+			page.Text(1 * W / 16, 2 * H / 14, "No Target!", 10);
 		}
 
-		sprintf(Buffer, "%.3f", GC->rtcc->BZLAND.lat[RTCC_LMPOS_BEST] * DEG);
-		skp->Text(1 * W / 16, 4 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(1 * W / 16, 4 * H / 14, "%.3f", GC->rtcc->BZLAND.lat[RTCC_LMPOS_BEST] * DEG);
 
-		sprintf(Buffer, "%.3f", GC->rtcc->BZLAND.lng[RTCC_LMPOS_BEST] * DEG);
-		skp->Text(1 * W / 16, 6 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(1 * W / 16, 6 * H / 14, "%.3f", GC->rtcc->BZLAND.lng[RTCC_LMPOS_BEST] * DEG);
 
-		sprintf(Buffer, "%.2f NM", GC->rtcc->BZLAND.rad[RTCC_LMPOS_BEST] / 1852.0);
-		skp->Text(1 * W / 16, 8 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(1 * W / 16, 8 * H / 14, "%.2f NM", GC->rtcc->BZLAND.rad[RTCC_LMPOS_BEST] / 1852.0);
 	}
 	else if (screen == 50 || screen == 98)
 	{
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
 
 		RTCC::LandingSiteMakupBuffer *tab;
 
 		if (screen == 50)
 		{
-			skp->Text(4 * W / 8, 2 * H / 14, "LANDING SITE UPDT TO CMC (293)", 30);
+			page.Text(4 * W / 8, 2 * H / 14, "LANDING SITE UPDT TO CMC (293)", 30);
 			tab = &GC->rtcc->CZLSVECT.CSMLSUpdate;
 		}
 		else
 		{
-			skp->Text(4 * W / 8, 2 * H / 14, "LANDING SITE UPDT TO LGC (294)", 30);
+			page.Text(4 * W / 8, 2 * H / 14, "LANDING SITE UPDT TO LGC (294)", 30);
 			tab = &GC->rtcc->CZLSVECT.LMLSUpdate;
 		}
 
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
 
-		skp->Text(1 * W / 8, 4 * H / 14, "LAT", 3);
-		skp->Text(1 * W / 8, 5 * H / 14, "LNG", 3);
-		sprintf(Buffer, "%.3f", tab->lat * DEG);
-		skp->Text(2 * W / 8, 4 * H / 14, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%.3f", tab->lng * DEG);
-		skp->Text(2 * W / 8, 5 * H / 14, Buffer, strlen(Buffer));
+		page.Text(1 * W / 8, 4 * H / 14, "LAT", 3);
+		page.Text(1 * W / 8, 5 * H / 14, "LNG", 3);
+		page.Printf(2 * W / 8, 4 * H / 14, "%.3f", tab->lat * DEG);
+		page.Printf(2 * W / 8, 5 * H / 14, "%.3f", tab->lng * DEG);
 
-		skp->Text(4 * W / 8, 4 * H / 14, "RAD", 3);
-		sprintf(Buffer, "%.2f NM", tab->rad / 1852.0);
-		skp->Text(5 * W / 8, 4 * H / 14, Buffer, strlen(Buffer));
+		page.Text(4 * W / 8, 4 * H / 14, "RAD", 3);
+		page.Printf(5 * W / 8, 4 * H / 14, "%.2f NM", tab->rad / 1852.0);
 
-		skp->Text(5 * W / 32, 13 * H / 28, "OID", 3);
-		skp->Text(10 * W / 32, 13 * H / 28, "FCT", 3);
-		skp->Text(15 * W / 32, 13 * H / 28, "DSKY V71", 8);
-		skp->Text(22 * W / 32, 13 * H / 28, "VECTOR", 6);
+		page.Text(5 * W / 32, 13 * H / 28, "OID", 3);
+		page.Text(10 * W / 32, 13 * H / 28, "FCT", 3);
+		page.Text(15 * W / 32, 13 * H / 28, "DSKY V71", 8);
+		page.Text(22 * W / 32, 13 * H / 28, "VECTOR", 6);
 
 		for (int i = 1;i <= 010;i++)
 		{
-			sprintf(Buffer, "%o", i);
-			skp->Text(5 * W / 32, (i + 14) * H / 28, Buffer, strlen(Buffer));
+			page.Printf(5 * W / 32, (i + 14) * H / 28, "%o", i);
 		}
 
-		skp->Text(10 * W / 32, 15 * H / 28, "INDEX", 5);
-		skp->Text(10 * W / 32, 16 * H / 28, "ADD", 3);
-		skp->Text(10 * W / 32, 17 * H / 28, "X", 1);
-		skp->Text(10 * W / 32, 18 * H / 28, "X", 1);
-		skp->Text(10 * W / 32, 19 * H / 28, "Y", 1);
-		skp->Text(10 * W / 32, 20 * H / 28, "Y", 1);
-		skp->Text(10 * W / 32, 21 * H / 28, "Z", 1);
-		skp->Text(10 * W / 32, 22 * H / 28, "Z", 1);
+		page.Text(10 * W / 32, 15 * H / 28, "INDEX", 5);
+		page.Text(10 * W / 32, 16 * H / 28, "ADD", 3);
+		page.Text(10 * W / 32, 17 * H / 28, "X", 1);
+		page.Text(10 * W / 32, 18 * H / 28, "X", 1);
+		page.Text(10 * W / 32, 19 * H / 28, "Y", 1);
+		page.Text(10 * W / 32, 20 * H / 28, "Y", 1);
+		page.Text(10 * W / 32, 21 * H / 28, "Z", 1);
+		page.Text(10 * W / 32, 22 * H / 28, "Z", 1);
 
 		for (int i = 0;i < 010;i++)
 		{
-			sprintf(Buffer, "%05d", tab->Octals[i]);
-			skp->Text(15 * W / 32, (i + 15) * H / 28, Buffer, strlen(Buffer));
+			page.Printf(15 * W / 32, (i + 15) * H / 28, "%05d", tab->Octals[i]);
 		}
 
-		sprintf(Buffer, "%.1f", tab->R_LS.x);
-		skp->Text(22 * W / 32, 17 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%.1f", tab->R_LS.y);
-		skp->Text(22 * W / 32, 19 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%.1f", tab->R_LS.z);
-		skp->Text(22 * W / 32, 21 * H / 28, Buffer, strlen(Buffer));
+		page.Printf(22 * W / 32, 17 * H / 28, "%.1f", tab->R_LS.x);
+		page.Printf(22 * W / 32, 19 * H / 28, "%.1f", tab->R_LS.y);
+		page.Printf(22 * W / 32, 21 * H / 28, "%.1f", tab->R_LS.z);
 	}
 	else if (screen == 51 || screen == 102)
 	{
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
 
 		if (screen == 51)
 		{
-			skp->Text(4 * W / 8, 2 * H / 14, "CMC EXTERNAL DV UPDATE (264)", 28);
+			page.Text(4 * W / 8, 2 * H / 14, "CMC EXTERNAL DV UPDATE (264)", 28);
 		}
 		else
 		{
-			skp->Text(4 * W / 8, 2 * H / 14, "LGC EXTERNAL DV UPDATE (280)", 28);
+			page.Text(4 * W / 8, 2 * H / 14, "LGC EXTERNAL DV UPDATE (280)", 28);
 		}
 
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
 
-		skp->Text(5 * W / 32, 8 * H / 28, "OID", 3);
-		skp->Text(10 * W / 32, 8 * H / 28, "FCT", 3);
-		skp->Text(15 * W / 32, 8 * H / 28, "DSKY V71", 8);
+		page.Text(5 * W / 32, 8 * H / 28, "OID", 3);
+		page.Text(10 * W / 32, 8 * H / 28, "FCT", 3);
+		page.Text(15 * W / 32, 8 * H / 28, "DSKY V71", 8);
 
 		for (int i = 1;i <= 012;i++)
 		{
-			sprintf(Buffer, "%o", i);
-			skp->Text(5 * W / 32, (i + 9) * H / 28, Buffer, strlen(Buffer));
+			page.Printf(5 * W / 32, (i + 9) * H / 28, "%o", i);
 		}
 
-		skp->Text(10 * W / 32, 10 * H / 28, "INDEX", 5);
-		skp->Text(10 * W / 32, 11 * H / 28, "ADD", 3);
-		skp->Text(10 * W / 32, 12 * H / 28, "VGX", 3);
-		skp->Text(10 * W / 32, 13 * H / 28, "VGX", 3);
-		skp->Text(10 * W / 32, 14 * H / 28, "VGY", 3);
-		skp->Text(10 * W / 32, 15 * H / 28, "VGY", 3);
-		skp->Text(10 * W / 32, 16 * H / 28, "VGZ", 3);
-		skp->Text(10 * W / 32, 17 * H / 28, "VGZ", 3);
-		skp->Text(10 * W / 32, 18 * H / 28, "TIGN", 4);
-		skp->Text(10 * W / 32, 19 * H / 28, "TIGN", 4);
+		page.Text(10 * W / 32, 10 * H / 28, "INDEX", 5);
+		page.Text(10 * W / 32, 11 * H / 28, "ADD", 3);
+		page.Text(10 * W / 32, 12 * H / 28, "VGX", 3);
+		page.Text(10 * W / 32, 13 * H / 28, "VGX", 3);
+		page.Text(10 * W / 32, 14 * H / 28, "VGY", 3);
+		page.Text(10 * W / 32, 15 * H / 28, "VGY", 3);
+		page.Text(10 * W / 32, 16 * H / 28, "VGZ", 3);
+		page.Text(10 * W / 32, 17 * H / 28, "VGZ", 3);
+		page.Text(10 * W / 32, 18 * H / 28, "TIGN", 4);
+		page.Text(10 * W / 32, 19 * H / 28, "TIGN", 4);
 
 		RTCC::ExternalDVMakeupBuffer *tab;
 		if (screen == 51)
@@ -4374,97 +3781,80 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 
 		for (int i = 0;i < 012;i++)
 		{
-			sprintf(Buffer, "%05d", tab->Octals[i]);
-			skp->Text(15 * W / 32, (i + 10) * H / 28, Buffer, strlen(Buffer));
+			page.Printf(15 * W / 32, (i + 10) * H / 28, "%05d", tab->Octals[i]);
 		}
 
-		skp->SetTextAlign(oapi::Sketchpad::RIGHT);
+		page.SetTextAlign(oapi::Sketchpad::RIGHT);
 
-		skp->Text(27 * W / 32, 8 * H / 28, "DECIMAL", 7);
+		page.Text(27 * W / 32, 8 * H / 28, "DECIMAL", 7);
 		if (GC->MissionPlanningActive)
 		{
-			sprintf(Buffer, "%+07.1f", tab->DV.x);
-			skp->Text(27 * W / 32, 12 * H / 28, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%+07.1f", tab->DV.y);
-			skp->Text(27 * W / 32, 14 * H / 28, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%+07.1f", tab->DV.z);
-			skp->Text(27 * W / 32, 16 * H / 28, Buffer, strlen(Buffer));
-			GET_Display2(Buffer, tab->GET);
-			skp->Text(27 * W / 32, 18 * H / 28, Buffer, strlen(Buffer));
+			page.Printf(27 * W / 32, 12 * H / 28, "%+07.1f", tab->DV.x);
+			page.Printf(27 * W / 32, 14 * H / 28, "%+07.1f", tab->DV.y);
+			page.Printf(27 * W / 32, 16 * H / 28, "%+07.1f", tab->DV.z);
+			page.Format(27 * W / 32, 18 * H / 28, this, &ApolloRTCCMFD::GET_Display2, tab->GET);
 		}
 		else
 		{
-			sprintf(Buffer, "%+07.1f", G->dV_LVLH.x / 0.3048);
-			skp->Text(27 * W / 32, 12 * H / 28, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%+07.1f", G->dV_LVLH.y / 0.3048);
-			skp->Text(27 * W / 32, 14 * H / 28, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%+07.1f", G->dV_LVLH.z / 0.3048);
-			skp->Text(27 * W / 32, 16 * H / 28, Buffer, strlen(Buffer));
-			GET_Display2(Buffer, G->P30TIG);
-			skp->Text(27 * W / 32, 18 * H / 28, Buffer, strlen(Buffer));
+			page.Printf(27 * W / 32, 12 * H / 28, "%+07.1f", G->dV_LVLH.x / 0.3048);
+			page.Printf(27 * W / 32, 14 * H / 28, "%+07.1f", G->dV_LVLH.y / 0.3048);
+			page.Printf(27 * W / 32, 16 * H / 28, "%+07.1f", G->dV_LVLH.z / 0.3048);
+			page.Format(27 * W / 32, 18 * H / 28, this, &ApolloRTCCMFD::GET_Display2, G->P30TIG);
 		}
 
 	}
 	else if (screen == 52)
 	{
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
 
-		skp->Text(4 * W / 8, 2 * H / 14, "CMC RETROFIRE EXTERNAL DV UPDATE (360)", 38);
+		page.Text(4 * W / 8, 2 * H / 14, "CMC RETROFIRE EXTERNAL DV UPDATE (360)", 38);
 
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
 
-		skp->Text(5 * W / 32, 8 * H / 28, "OID", 3);
-		skp->Text(10 * W / 32, 8 * H / 28, "FCT", 3);
-		skp->Text(15 * W / 32, 8 * H / 28, "DSKY V71", 8);
+		page.Text(5 * W / 32, 8 * H / 28, "OID", 3);
+		page.Text(10 * W / 32, 8 * H / 28, "FCT", 3);
+		page.Text(15 * W / 32, 8 * H / 28, "DSKY V71", 8);
 
 		for (int i = 1;i <= 016;i++)
 		{
-			sprintf(Buffer, "%o", i);
-			skp->Text(5 * W / 32, (i + 9) * H / 28, Buffer, strlen(Buffer));
-		}
-
-		skp->Text(10 * W / 32, 10 * H / 28, "INDEX", 5);
-		skp->Text(10 * W / 32, 11 * H / 28, "ADD", 3);
-		skp->Text(10 * W / 32, 12 * H / 28, "LAT", 3);
-		skp->Text(10 * W / 32, 13 * H / 28, "LAT", 3);
-		skp->Text(10 * W / 32, 14 * H / 28, "LONG", 4);
-		skp->Text(10 * W / 32, 15 * H / 28, "LONG", 4);
-		skp->Text(10 * W / 32, 16 * H / 28, "VGX", 3);
-		skp->Text(10 * W / 32, 17 * H / 28, "VGX", 3);
-		skp->Text(10 * W / 32, 18 * H / 28, "VGY", 3);
-		skp->Text(10 * W / 32, 19 * H / 28, "VGY", 3);
-		skp->Text(10 * W / 32, 20 * H / 28, "VGZ", 3);
-		skp->Text(10 * W / 32, 21 * H / 28, "VGZ", 3);
-		skp->Text(10 * W / 32, 22 * H / 28, "TIGN", 4);
-		skp->Text(10 * W / 32, 23 * H / 28, "TIGN", 4);
+			page.Printf(5 * W / 32, (i + 9) * H / 28, "%o", i);
+		}
+
+		page.Text(10 * W / 32, 10 * H / 28, "INDEX", 5);
+		page.Text(10 * W / 32, 11 * H / 28, "ADD", 3);
+		page.Text(10 * W / 32, 12 * H / 28, "LAT", 3);
+		page.Text(10 * W / 32, 13 * H / 28, "LAT", 3);
+		page.Text(10 * W / 32, 14 * H / 28, "LONG", 4);
+		page.Text(10 * W / 32, 15 * H / 28, "LONG", 4);
+		page.Text(10 * W / 32, 16 * H / 28, "VGX", 3);
+		page.Text(10 * W / 32, 17 * H / 28, "VGX", 3);
+		page.Text(10 * W / 32, 18 * H / 28, "VGY", 3);
+		page.Text(10 * W / 32, 19 * H / 28, "VGY", 3);
+		page.Text(10 * W / 32, 20 * H / 28, "VGZ", 3);
+		page.Text(10 * W / 32, 21 * H / 28, "VGZ", 3);
+		page.Text(10 * W / 32, 22 * H / 28, "TIGN", 4);
+		page.Text(10 * W / 32, 23 * H / 28, "TIGN", 4);
 
 		for (int i = 0;i < 016;i++)
 		{
-			sprintf(Buffer, "%05d", GC->rtcc->CZREXTDV.Octals[i]);
-			skp->Text(15 * W / 32, (i + 10) * H / 28, Buffer, strlen(Buffer));
+			page.Printf(15 * W / 32, (i + 10) * H / 28, "%05d", GC->rtcc->CZREXTDV.Octals[i]);
 		}
 
-		skp->SetTextAlign(oapi::Sketchpad::RIGHT);
+		page.SetTextAlign(oapi::Sketchpad::RIGHT);
 
-		skp->Text(27 * W / 32, 8 * H / 28, "DECIMAL", 7);
-		sprintf(Buffer, "%+.2f", GC->rtcc->CZREXTDV.Lat);
-		skp->Text(27 * W / 32, 12 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%+.2f", GC->rtcc->CZREXTDV.Lng);
-		skp->Text(27 * W / 32, 14 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%+07.1f", GC->rtcc->CZREXTDV.DV.x);
-		skp->Text(27 * W / 32, 16 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%+07.1f", GC->rtcc->CZREXTDV.DV.y);
-		skp->Text(27 * W / 32, 18 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%+07.1f", GC->rtcc->CZREXTDV.DV.z);
-		skp->Text(27 * W / 32, 20 * H / 28, Buffer, strlen(Buffer));
-		GET_Display2(Buffer, GC->rtcc->CZREXTDV.GET_TIG);
-		skp->Text(27 * W / 32, 22 * H / 28, Buffer, strlen(Buffer));
+		page.Text(27 * W / 32, 8 * H / 28, "DECIMAL", 7);
+		page.Printf(27 * W / 32, 12 * H / 28, "%+.2f", GC->rtcc->CZREXTDV.Lat);
+		page.Printf(27 * W / 32, 14 * H / 28, "%+.2f", GC->rtcc->CZREXTDV.Lng);
+		page.Printf(27 * W / 32, 16 * H / 28, "%+07.1f", GC->rtcc->CZREXTDV.DV.x);
+		page.Printf(27 * W / 32, 18 * H / 28, "%+07.1f", GC->rtcc->CZREXTDV.DV.y);
+		page.Printf(27 * W / 32, 20 * H / 28, "%+07.1f", GC->rtcc->CZREXTDV.DV.z);
+		page.Format(27 * W / 32, 22 * H / 28, this, &ApolloRTCCMFD::GET_Display2, GC->rtcc->CZREXTDV.GET_TIG);
 
 	}
 	else if (screen == 53 || screen == 94)
 	{
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
-		skp->SetFont(font2);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
+		page.SetFont(font2);
 
 		RTCC::REFSMMATUpdateMakeupTableBlock *block;
 
@@ -4479,126 +3869,116 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 
 		if (screen == 53)
 		{
-			skp->Text(15 * W / 16, 1 * H / 14, "266", 3);
+			page.Text(15 * W / 16, 1 * H / 14, "266", 3);
 			if (block->MatrixType == 2)
 			{
-				skp->Text(4 * W / 8, 1 * H / 14, "CMC DESIRED REFSMMAT UPDATE", 27);
+				page.Text(4 * W / 8, 1 * H / 14, "CMC DESIRED REFSMMAT UPDATE", 27);
 			}
 			else
 			{
-				skp->Text(4 * W / 8, 1 * H / 14, "CMC REFSMMAT UPDATE", 19);
+				page.Text(4 * W / 8, 1 * H / 14, "CMC REFSMMAT UPDATE", 19);
 			}
 
 		}
 		else
 		{
-			skp->Text(15 * W / 16, 1 * H / 14, "265", 3);
+			page.Text(15 * W / 16, 1 * H / 14, "265", 3);
 			if (block->MatrixType == 2)
 			{
-				skp->Text(4 * W / 8, 1 * H / 14, "LGC DESIRED REFSMMAT UPDATE", 27);
+				page.Text(4 * W / 8, 1 * H / 14, "LGC DESIRED REFSMMAT UPDATE", 27);
 			}
 			else
 			{
-				skp->Text(4 * W / 8, 1 * H / 14, "LGC REFSMMAT UPDATE", 19);
+				page.Text(4 * W / 8, 1 * H / 14, "LGC REFSMMAT UPDATE", 19);
 			}
 		}
 
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
 
-		skp->Text(5 * W / 32, 6 * H / 32, "ID:", 3);
-		sprintf(Buffer, "%s", block->MatrixID.c_str());
-		skp->Text(7 * W / 32, 6 * H / 32, Buffer, strlen(Buffer));
+		page.Text(5 * W / 32, 6 * H / 32, "ID:", 3);
+		page.Printf(7 * W / 32, 6 * H / 32, "%s", block->MatrixID.c_str());
 
-		skp->Text(12 * W / 32, 6 * H / 32, "LOAD:", 5);
-		sprintf(Buffer, "%d", block->UpdateNo);
-		skp->Text(16 * W / 32, 6 * H / 32, Buffer, strlen(Buffer));
+		page.Text(12 * W / 32, 6 * H / 32, "LOAD:", 5);
+		page.Printf(16 * W / 32, 6 * H / 32, "%d", block->UpdateNo);
 
-		skp->Text(5 * W / 32, 8 * H / 32, "OID", 3);
-		skp->Text(10 * W / 32, 8 * H / 32, "FCT", 3);
-		skp->Text(15 * W / 32, 8 * H / 32, "DSKY V71", 8);
+		page.Text(5 * W / 32, 8 * H / 32, "OID", 3);
+		page.Text(10 * W / 32, 8 * H / 32, "FCT", 3);
+		page.Text(15 * W / 32, 8 * H / 32, "DSKY V71", 8);
 
 		for (int i = 1;i <= 024;i++)
 		{
-			sprintf(Buffer, "%o", i);
-			skp->Text(5 * W / 32, (i + 9) * H / 32, Buffer, strlen(Buffer));
-		}
-
-		skp->Text(10 * W / 32, 10 * H / 32, "INDEX", 5);
-		skp->Text(10 * W / 32, 11 * H / 32, "ADD", 3);
-		skp->Text(10 * W / 32, 12 * H / 32, "XIXE", 4);
-		skp->Text(10 * W / 32, 13 * H / 32, "XIXE", 4);
-		skp->Text(10 * W / 32, 14 * H / 32, "XIYE", 4);
-		skp->Text(10 * W / 32, 15 * H / 32, "XIYE", 4);
-		skp->Text(10 * W / 32, 16 * H / 32, "XIZE", 4);
-		skp->Text(10 * W / 32, 17 * H / 32, "XIZE", 4);
-		skp->Text(10 * W / 32, 18 * H / 32, "YIXE", 4);
-		skp->Text(10 * W / 32, 19 * H / 32, "YIXE", 4);
-		skp->Text(10 * W / 32, 20 * H / 32, "YIYE", 4);
-		skp->Text(10 * W / 32, 21 * H / 32, "YIYE", 4);
-		skp->Text(10 * W / 32, 22 * H / 32, "YIZE", 4);
-		skp->Text(10 * W / 32, 23 * H / 32, "YIZE", 4);
-		skp->Text(10 * W / 32, 24 * H / 32, "ZIXE", 4);
-		skp->Text(10 * W / 32, 25 * H / 32, "ZIXE", 4);
-		skp->Text(10 * W / 32, 26 * H / 32, "ZIYE", 4);
-		skp->Text(10 * W / 32, 27 * H / 32, "ZIYE", 4);
-		skp->Text(10 * W / 32, 28 * H / 32, "ZIZE", 4);
-		skp->Text(10 * W / 32, 29 * H / 32, "ZIZE", 4);
+			page.Printf(5 * W / 32, (i + 9) * H / 32, "%o", i);
+		}
+
+		page.Text(10 * W / 32, 10 * H / 32, "INDEX", 5);
+		page.Text(10 * W / 32, 11 * H / 32, "ADD", 3);
+		page.Text(10 * W / 32, 12 * H / 32, "XIXE", 4);
+		page.Text(10 * W / 32, 13 * H / 32, "XIXE", 4);
+		page.Text(10 * W / 32, 14 * H / 32, "XIYE", 4);
+		page.Text(10 * W / 32, 15 * H / 32, "XIYE", 4);
+		page.Text(10 * W / 32, 16 * H / 32, "XIZE", 4);
+		page.Text(10 * W / 32, 17 * H / 32, "XIZE", 4);
+		page.Text(10 * W / 32, 18 * H / 32, "YIXE", 4);
+		page.Text(10 * W / 32, 19 * H / 32, "YIXE", 4);
+		page.Text(10 * W / 32, 20 * H / 32, "YIYE", 4);
+		page.Text(10 * W / 32, 21 * H / 32, "YIYE", 4);
+		page.Text(10 * W / 32, 22 * H / 32, "YIZE", 4);
+		page.Text(10 * W / 32, 23 * H / 32, "YIZE", 4);
+		page.Text(10 * W / 32, 24 * H / 32, "ZIXE", 4);
+		page.Text(10 * W / 32, 25 * H / 32, "ZIXE", 4);
+		page.Text(10 * W / 32, 26 * H / 32, "ZIYE", 4);
+		page.Text(10 * W / 32, 27 * H / 32, "ZIYE", 4);
+		page.Text(10 * W / 32, 28 * H / 32, "ZIZE", 4);
+		page.Text(10 * W / 32, 29 * H / 32, "ZIZE", 4);
 
 		for (int i = 0;i < 024;i++)
 		{
-			sprintf(Buffer, "%05d", block->Octals[i]);
-			skp->Text(15 * W / 32, (i + 10) * H / 32, Buffer, strlen(Buffer));
+			page.Printf(15 * W / 32, (i + 10) * H / 32, "%05d", block->Octals[i]);
 		}
 
-		skp->SetTextAlign(oapi::Sketchpad::RIGHT);
+		page.SetTextAlign(oapi::Sketchpad::RIGHT);
 
 		for (int i = 0;i < 9;i++)
 		{
-			sprintf(Buffer, "%f", block->REFSMMAT.data[i]);
-			skp->Text(27 * W / 32, (i * 2 + 12) * H / 32, Buffer, strlen(Buffer));
+			page.Printf(27 * W / 32, (i * 2 + 12) * H / 32, "%f", block->REFSMMAT.data[i]);
 		}
 
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
-		sprintf(Buffer, "%s", block->error.c_str());
-		skp->Text(16 * W / 32, 31 * H / 32, Buffer, strlen(Buffer));
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
+		page.Printf(16 * W / 32, 31 * H / 32, "%s", block->error.c_str());
 	}
 	else if (screen == 54)
 	{
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
 
-		skp->Text(4 * W / 8, 1 * H / 14, "Two Impulse Transfer (MED M72)", 30);
+		page.Text(4 * W / 8, 1 * H / 14, "Two Impulse Transfer (MED M72)", 30);
 
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
 
 		if (GC->rtcc->med_m72.Table == 1)
 		{
-			skp->Text(1 * W / 8, 2 * H / 14, "Multiple Solution", 17);
+			page.Text(1 * W / 8, 2 * H / 14, "Multiple Solution", 17);
 		}
 		else
 		{
-			skp->Text(1 * W / 8, 2 * H / 14, "Corrective Combination", 22);
+			page.Text(1 * W / 8, 2 * H / 14, "Corrective Combination", 22);
 		}
 
-		sprintf(Buffer, "%d", GC->rtcc->med_m72.Plan);
-		skp->Text(1 * W / 8, 4 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(1 * W / 8, 4 * H / 14, "%d", GC->rtcc->med_m72.Plan);
 
-		ThrusterName(Buffer, GC->rtcc->med_m72.Thruster);
-		skp->Text(1 * W / 8, 8 * H / 14, Buffer, strlen(Buffer));
+		page.Format(1 * W / 8, 8 * H / 14, this, &ApolloRTCCMFD::ThrusterName, GC->rtcc->med_m72.Thruster);
 
 		if (GC->MissionPlanningActive)
 		{
 			if (GC->rtcc->med_m72.DeleteGET > 0)
 			{
-				GET_Display(Buffer, GC->rtcc->med_m72.DeleteGET);
-				skp->Text(1 * W / 8, 6 * H / 14, Buffer, strlen(Buffer));
+				page.Format(1 * W / 8, 6 * H / 14, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->med_m72.DeleteGET, true);
 			}
 			else
 			{
-				skp->Text(1 * W / 8, 6 * H / 14, "Do not delete", 13);
+				page.Text(1 * W / 8, 6 * H / 14, "Do not delete", 13);
 			}
 
-			MPTAttitudeName(Buffer, GC->rtcc->med_m72.Attitude);
-			skp->Text(1 * W / 8, 10 * H / 14, Buffer, strlen(Buffer));
+			page.Format(1 * W / 8, 10 * H / 14, this, &ApolloRTCCMFD::MPTAttitudeName, GC->rtcc->med_m72.Attitude);
 
 			if (GC->rtcc->med_m72.UllageDT < 0)
 			{
@@ -4615,91 +3995,82 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 					sprintf_s(Buffer, "2 quads, %.1f s", GC->rtcc->med_m72.UllageDT);
 				}
 			}
-			skp->Text(1 * W / 8, 12 * H / 14, Buffer, strlen(Buffer));
+			page.Text(1 * W / 8, 12 * H / 14, Buffer, strlen(Buffer));
 
 			if (GC->rtcc->med_m72.Iteration)
 			{
-				skp->Text(5 * W / 8, 4 * H / 14, "Iterate", 7);
+				page.Text(5 * W / 8, 4 * H / 14, "Iterate", 7);
 			}
 			else
 			{
-				skp->Text(5 * W / 8, 4 * H / 14, "Do not iterate", 14);
+				page.Text(5 * W / 8, 4 * H / 14, "Do not iterate", 14);
 			}
 
 			
 			if (GC->rtcc->med_m72.Thruster == RTCC_ENGINETYPE_LMDPS)
 			{
-				sprintf_s(Buffer, "%.1f s", GC->rtcc->med_m72.TenPercentDT);
-				skp->Text(5 * W / 8, 6 * H / 14, Buffer, strlen(Buffer));
-				sprintf_s(Buffer, "%.3f", GC->rtcc->med_m72.DPSThrustFactor);
-				skp->Text(5 * W / 8, 8 * H / 14, Buffer, strlen(Buffer));
+				page.Printf(5 * W / 8, 6 * H / 14, "%.1f s", GC->rtcc->med_m72.TenPercentDT);
+				page.Printf(5 * W / 8, 8 * H / 14, "%.3f", GC->rtcc->med_m72.DPSThrustFactor);
 			}
 
 			if (GC->rtcc->med_m72.TimeFlag)
 			{
-				skp->Text(5 * W / 8, 10 * H / 14, "Impulsive TIG", 13);
+				page.Text(5 * W / 8, 10 * H / 14, "Impulsive TIG", 13);
 			}
 			else
 			{
-				skp->Text(5 * W / 8, 10 * H / 14, "Optimum TIG", 11);
+				page.Text(5 * W / 8, 10 * H / 14, "Optimum TIG", 11);
 			}
 		}
 		else
 		{
-			GET_Display(Buffer, G->P30TIG);
-			skp->Text(5 * W / 8, 10 * H / 21, Buffer, strlen(Buffer));
+			page.Format(5 * W / 8, 10 * H / 21, this, &ApolloRTCCMFD::GET_Display, G->P30TIG, true);
 
-			skp->Text(5 * W / 8, 11 * H / 21, "DVX", 3);
-			skp->Text(5 * W / 8, 12 * H / 21, "DVY", 3);
-			skp->Text(5 * W / 8, 13 * H / 21, "DVZ", 3);
+			page.Text(5 * W / 8, 11 * H / 21, "DVX", 3);
+			page.Text(5 * W / 8, 12 * H / 21, "DVY", 3);
+			page.Text(5 * W / 8, 13 * H / 21, "DVZ", 3);
 
-			AGC_Display(Buffer, G->dV_LVLH.x / 0.3048);
-			skp->Text(6 * W / 8, 11 * H / 21, Buffer, strlen(Buffer));
-			AGC_Display(Buffer, G->dV_LVLH.y / 0.3048);
-			skp->Text(6 * W / 8, 12 * H / 21, Buffer, strlen(Buffer));
-			AGC_Display(Buffer, G->dV_LVLH.z / 0.3048);
-			skp->Text(6 * W / 8, 13 * H / 21, Buffer, strlen(Buffer));
+			page.Format(6 * W / 8, 11 * H / 21, this, &ApolloRTCCMFD::AGC_Display, G->dV_LVLH.x / 0.3048);
+			page.Format(6 * W / 8, 12 * H / 21, this, &ApolloRTCCMFD::AGC_Display, G->dV_LVLH.y / 0.3048);
+			page.Format(6 * W / 8, 13 * H / 21, this, &ApolloRTCCMFD::AGC_Display, G->dV_LVLH.z / 0.3048);
 		}
 	}
 	else if (screen == 55)
 	{
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
 
 		if (GC->rtcc->med_m70.Plan == 0)
 		{
-			skp->Text(4 * W / 8, 1 * H / 14, "SPQ Transfer (MED M70)", 22);
+			page.Text(4 * W / 8, 1 * H / 14, "SPQ Transfer (MED M70)", 22);
 		}
 		else if (GC->rtcc->med_m70.Plan == 1)
 		{
-			skp->Text(4 * W / 8, 1 * H / 14, "DKI Transfer (MED M70)", 22);
+			page.Text(4 * W / 8, 1 * H / 14, "DKI Transfer (MED M70)", 22);
 		}
 		else
 		{
-			skp->Text(4 * W / 8, 1 * H / 14, "Descent Plan Transfer (MED M70)", 31);
+			page.Text(4 * W / 8, 1 * H / 14, "Descent Plan Transfer (MED M70)", 31);
 		}
 
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
 
 		if (GC->MissionPlanningActive)
 		{
 			if (GC->rtcc->med_m70.DeleteGET > 0)
 			{
-				GET_Display(Buffer, GC->rtcc->med_m70.DeleteGET);
-				skp->Text(1 * W / 8, 2 * H / 14, Buffer, strlen(Buffer));
+				page.Format(1 * W / 8, 2 * H / 14, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->med_m70.DeleteGET, true);
 			}
 			else
 			{
-				skp->Text(1 * W / 8, 2 * H / 14, "Do not delete", 13);
+				page.Text(1 * W / 8, 2 * H / 14, "Do not delete", 13);
 			}
 		}
 
-		ThrusterName(Buffer, GC->rtcc->med_m70.Thruster);
-		skp->Text(1 * W / 8, 4 * H / 14, Buffer, strlen(Buffer));
+		page.Format(1 * W / 8, 4 * H / 14, this, &ApolloRTCCMFD::ThrusterName, GC->rtcc->med_m70.Thruster);
 
 		if (GC->MissionPlanningActive)
 		{
-			MPTAttitudeName(Buffer, GC->rtcc->med_m70.Attitude);
-			skp->Text(1 * W / 8, 6 * H / 14, Buffer, strlen(Buffer));
+			page.Format(1 * W / 8, 6 * H / 14, this, &ApolloRTCCMFD::MPTAttitudeName, GC->rtcc->med_m70.Attitude);
 
 			if (GC->rtcc->med_m70.UllageDT < 0)
 			{
@@ -4716,92 +4087,82 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 					sprintf_s(Buffer, "2 quads, %.1f s", GC->rtcc->med_m70.UllageDT);
 				}
 			}
-			skp->Text(1 * W / 8, 8 * H / 14, Buffer, strlen(Buffer));
+			page.Text(1 * W / 8, 8 * H / 14, Buffer, strlen(Buffer));
 
 			if (GC->rtcc->med_m70.Iteration)
 			{
-				skp->Text(1 * W / 8, 10 * H / 14, "Iterate", 7);
+				page.Text(1 * W / 8, 10 * H / 14, "Iterate", 7);
 			}
 			else
 			{
-				skp->Text(1 * W / 8, 10 * H / 14, "Do not iterate", 14);
+				page.Text(1 * W / 8, 10 * H / 14, "Do not iterate", 14);
 			}
 
 			if (GC->rtcc->med_m70.TimeFlag)
 			{
-				skp->Text(1 * W / 8, 12 * H / 14, "Impulsive TIG", 13);
+				page.Text(1 * W / 8, 12 * H / 14, "Impulsive TIG", 13);
 			}
 			else
 			{
-				skp->Text(1 * W / 8, 12 * H / 14, "Optimum TIG", 11);
+				page.Text(1 * W / 8, 12 * H / 14, "Optimum TIG", 11);
 			}
 
 			if (GC->rtcc->med_m70.Thruster == RTCC_ENGINETYPE_LMDPS)
 			{
-				sprintf_s(Buffer, "%.1f s", GC->rtcc->med_m70.TenPercentDT);
-				skp->Text(5 * W / 8, 2 * H / 14, Buffer, strlen(Buffer));
-				sprintf_s(Buffer, "%.3f", GC->rtcc->med_m70.DPSThrustFactor);
-				skp->Text(5 * W / 8, 4 * H / 14, Buffer, strlen(Buffer));
+				page.Printf(5 * W / 8, 2 * H / 14, "%.1f s", GC->rtcc->med_m70.TenPercentDT);
+				page.Printf(5 * W / 8, 4 * H / 14, "%.3f", GC->rtcc->med_m70.DPSThrustFactor);
 			}
 		}
 
 		if (GC->MissionPlanningActive == false)
 		{
-			GET_Display(Buffer, G->P30TIG);
-			skp->Text(5 * W / 8, 10 * H / 21, Buffer, strlen(Buffer));
+			page.Format(5 * W / 8, 10 * H / 21, this, &ApolloRTCCMFD::GET_Display, G->P30TIG, true);
 
-			skp->Text(5 * W / 8, 11 * H / 21, "DVX", 3);
-			skp->Text(5 * W / 8, 12 * H / 21, "DVY", 3);
-			skp->Text(5 * W / 8, 13 * H / 21, "DVZ", 3);
+			page.Text(5 * W / 8, 11 * H / 21, "DVX", 3);
+			page.Text(5 * W / 8, 12 * H / 21, "DVY", 3);
+			page.Text(5 * W / 8, 13 * H / 21, "DVZ", 3);
 
-			AGC_Display(Buffer, G->dV_LVLH.x / 0.3048);
-			skp->Text(6 * W / 8, 11 * H / 21, Buffer, strlen(Buffer));
-			AGC_Display(Buffer, G->dV_LVLH.y / 0.3048);
-			skp->Text(6 * W / 8, 12 * H / 21, Buffer, strlen(Buffer));
-			AGC_Display(Buffer, G->dV_LVLH.z / 0.3048);
-			skp->Text(6 * W / 8, 13 * H / 21, Buffer, strlen(Buffer));
+			page.Format(6 * W / 8, 11 * H / 21, this, &ApolloRTCCMFD::AGC_Display, G->dV_LVLH.x / 0.3048);
+			page.Format(6 * W / 8, 12 * H / 21, this, &ApolloRTCCMFD::AGC_Display, G->dV_LVLH.y / 0.3048);
+			page.Format(6 * W / 8, 13 * H / 21, this, &ApolloRTCCMFD::AGC_Display, G->dV_LVLH.z / 0.3048);
 		}
 	}
 	else if (screen == 56)
 	{
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
 
-		skp->Text(4 * W / 8, 1 * H / 14, "DIRECT INPUT TO MPT (MED M66)", 29);
+		page.Text(4 * W / 8, 1 * H / 14, "DIRECT INPUT TO MPT (MED M66)", 29);
 
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
 
 		if (GC->rtcc->med_m66.Table == RTCC_MPT_CSM)
 		{
-			skp->Text(1 * W / 16, 2 * H / 14, "CSM", 3);
+			page.Text(1 * W / 16, 2 * H / 14, "CSM", 3);
 		}
 		else
 		{
-			skp->Text(1 * W / 16, 2 * H / 14, "LM", 2);
+			page.Text(1 * W / 16, 2 * H / 14, "LM", 2);
 		}
 
 		if (GC->rtcc->med_m66.ReplaceCode == 0)
 		{
-			skp->Text(1 * W / 16, 4 * H / 14, "Don't replace", 13);
+			page.Text(1 * W / 16, 4 * H / 14, "Don't replace", 13);
 		}
 		else
 		{
-			sprintf_s(Buffer, "%d", GC->rtcc->med_m66.ReplaceCode);
-			skp->Text(1 * W / 16, 4 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(1 * W / 16, 4 * H / 14, "%d", GC->rtcc->med_m66.ReplaceCode);
 		}
 
-		GET_Display(Buffer, GC->rtcc->med_m66.GETBI);
-		skp->Text(1 * W / 16, 6 * H / 14, Buffer, strlen(Buffer));
+		page.Format(1 * W / 16, 6 * H / 14, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->med_m66.GETBI, true);
 
-		ThrusterName(Buffer, GC->rtcc->med_m66.Thruster);
-		skp->Text(1 * W / 16, 8 * H / 14, Buffer, strlen(Buffer));
+		page.Format(1 * W / 16, 8 * H / 14, this, &ApolloRTCCMFD::ThrusterName, GC->rtcc->med_m66.Thruster);
 
-		MPTAttitudeName(Buffer, GC->rtcc->med_m66.AttitudeOpt);
-		skp->Text(1 * W / 16, 10 * H / 14, Buffer, strlen(Buffer));
+		page.Format(1 * W / 16, 10 * H / 14, this, &ApolloRTCCMFD::MPTAttitudeName, GC->rtcc->med_m66.AttitudeOpt);
 
 		if (GC->rtcc->med_m66.BurnParamNo == 1)
 		{
 			char Buffer2[4];
-			skp->Text(1 * W / 16, 12 * H / 14, "P1: DV or DT", 16);
+			page.Text(1 * W / 16, 12 * H / 14, "P1: DV or DT", 16);
 			if (GC->rtcc->PZBURN.P1_DVIND == 0)
 			{
 				sprintf(Buffer2, "MAG");
@@ -4814,113 +4175,103 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			{
 				sprintf(Buffer2, "XBT");
 			}
-			sprintf(Buffer, "%.1f ft/s, %s, %.1f s", GC->rtcc->PZBURN.P1_DV / 0.3048, Buffer2, GC->rtcc->PZBURN.P1_DT);
-			skp->Text(1 * W / 16, 13 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(1 * W / 16, 13 * H / 14, "%.1f ft/s, %s, %.1f s", GC->rtcc->PZBURN.P1_DV / 0.3048, Buffer2, GC->rtcc->PZBURN.P1_DT);
 		}
 		else if (GC->rtcc->med_m66.BurnParamNo == 2)
 		{
-			skp->Text(1 * W / 16, 12 * H / 14, "P2: DV Vector (AGC)", 19);
+			page.Text(1 * W / 16, 12 * H / 14, "P2: DV Vector (AGC)", 19);
 
-			sprintf(Buffer, "%+.1f %+.1f %+.1f", GC->rtcc->PZBURN.P2_DV.x / 0.3048, GC->rtcc->PZBURN.P2_DV.y / 0.3048, GC->rtcc->PZBURN.P2_DV.z / 0.3048);
-			skp->Text(1 * W / 16, 13 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(1 * W / 16, 13 * H / 14, "%+.1f %+.1f %+.1f", GC->rtcc->PZBURN.P2_DV.x / 0.3048, GC->rtcc->PZBURN.P2_DV.y / 0.3048, GC->rtcc->PZBURN.P2_DV.z / 0.3048);
 		}
 		else if (GC->rtcc->med_m66.BurnParamNo == 3)
 		{
-			skp->Text(1 * W / 16, 12 * H / 14, "P3: DV Vector (IMU)", 19);
+			page.Text(1 * W / 16, 12 * H / 14, "P3: DV Vector (IMU)", 19);
 
-			sprintf(Buffer, "%+.1f %+.1f %+.1f", GC->rtcc->PZBURN.P3_DV.x / 0.3048, GC->rtcc->PZBURN.P3_DV.y / 0.3048, GC->rtcc->PZBURN.P3_DV.z / 0.3048);
-			skp->Text(1 * W / 16, 13 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(1 * W / 16, 13 * H / 14, "%+.1f %+.1f %+.1f", GC->rtcc->PZBURN.P3_DV.x / 0.3048, GC->rtcc->PZBURN.P3_DV.y / 0.3048, GC->rtcc->PZBURN.P3_DV.z / 0.3048);
 		}
 		else if (GC->rtcc->med_m66.BurnParamNo == 4)
 		{
-			skp->Text(1 * W / 16, 12 * H / 14, "P4: DV Vector (LVLH)", 20);
+			page.Text(1 * W / 16, 12 * H / 14, "P4: DV Vector (LVLH)", 20);
 
-			sprintf(Buffer, "%+.1f %+.1f %+.1f", GC->rtcc->PZBURN.P4_DV.x / 0.3048, GC->rtcc->PZBURN.P4_DV.y / 0.3048, GC->rtcc->PZBURN.P4_DV.z / 0.3048);
-			skp->Text(1 * W / 16, 13 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(1 * W / 16, 13 * H / 14, "%+.1f %+.1f %+.1f", GC->rtcc->PZBURN.P4_DV.x / 0.3048, GC->rtcc->PZBURN.P4_DV.y / 0.3048, GC->rtcc->PZBURN.P4_DV.z / 0.3048);
 		}
 		else if (GC->rtcc->med_m66.BurnParamNo == 5)
 		{
-			skp->Text(1 * W / 16, 12 * H / 14, "P5: Lambert", 11);
+			page.Text(1 * W / 16, 12 * H / 14, "P5: Lambert", 11);
 		}
 
 		if (GC->rtcc->med_m66.BurnParamNo == 1)
 		{
 			if (GC->rtcc->med_m66.CoordInd == 0)
 			{
-				skp->Text(7 * W / 16, 2 * H / 14, "LVLH", 4);
+				page.Text(7 * W / 16, 2 * H / 14, "LVLH", 4);
 			}
 			else if (GC->rtcc->med_m66.CoordInd == 1)
 			{
-				skp->Text(7 * W / 16, 2 * H / 14, "IMU", 4);
+				page.Text(7 * W / 16, 2 * H / 14, "IMU", 4);
 			}
 			else
 			{
-				skp->Text(7 * W / 16, 2 * H / 14, "FDAI", 4);
+				page.Text(7 * W / 16, 2 * H / 14, "FDAI", 4);
 			}
-			sprintf(Buffer, "%06.2fP %06.2fY %06.2fR", GC->rtcc->med_m66.Att.x*DEG, GC->rtcc->med_m66.Att.y*DEG, GC->rtcc->med_m66.Att.z*DEG);
-			skp->Text(7 * W / 16, 3 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(7 * W / 16, 3 * H / 14, "%06.2fP %06.2fY %06.2fR", GC->rtcc->med_m66.Att.x*DEG, GC->rtcc->med_m66.Att.y*DEG, GC->rtcc->med_m66.Att.z*DEG);
 		}
 
 		if (GC->rtcc->med_m66.AttitudeOpt >= 3)
 		{
 			if (GC->rtcc->med_m66.HeadsUp)
 			{
-				skp->Text(10 * W / 16, 4 * H / 14, "Heads Up", 8);
+				page.Text(10 * W / 16, 4 * H / 14, "Heads Up", 8);
 			}
 			else
 			{
-				skp->Text(10 * W / 16, 4 * H / 14, "Heads Down", 10);
+				page.Text(10 * W / 16, 4 * H / 14, "Heads Down", 10);
 			}
 		}
 
 		if (GC->rtcc->med_m66.Thruster == RTCC_ENGINETYPE_LMDPS)
 		{
-			sprintf_s(Buffer, "%.1lf s", GC->rtcc->med_m66.TenPercentDT);
-			skp->Text(10 * W / 16, 6 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(10 * W / 16, 6 * H / 14, "%.1lf s", GC->rtcc->med_m66.TenPercentDT);
 
-			sprintf_s(Buffer, "%.3lf", GC->rtcc->med_m66.DPSThrustFactor);
-			skp->Text(10 * W / 16, 8 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(10 * W / 16, 8 * H / 14, "%.3lf", GC->rtcc->med_m66.DPSThrustFactor);
 		}
 
-		skp->Text(10 * W / 16, 10 * H / 14, "Page 1/2", 8);
+		page.Text(10 * W / 16, 10 * H / 14, "Page 1/2", 8);
 	}
 	else if (screen == 57)
 	{
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
 
-		skp->Text(4 * W / 8, 1 * H / 14, "GPM Transfer (MED M65)", 22);
+		page.Text(4 * W / 8, 1 * H / 14, "GPM Transfer (MED M65)", 22);
 
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
 
 		if (GC->MissionPlanningActive)
 		{
 			if (GC->rtcc->med_m65.Table == 1)
 			{
-				skp->Text(1 * W / 16, 2 * H / 14, "CSM", 3);
+				page.Text(1 * W / 16, 2 * H / 14, "CSM", 3);
 			}
 			else
 			{
-				skp->Text(1 * W / 16, 2 * H / 14, "LEM", 3);
+				page.Text(1 * W / 16, 2 * H / 14, "LEM", 3);
 			}
 
 			if (GC->rtcc->med_m65.ReplaceCode == 0)
 			{
-				skp->Text(1 * W / 16, 4 * H / 14, "Don't replace", 13);
+				page.Text(1 * W / 16, 4 * H / 14, "Don't replace", 13);
 			}
 			else
 			{
-				sprintf_s(Buffer, "%d", GC->rtcc->med_m65.ReplaceCode);
-				skp->Text(1 * W / 16, 4 * H / 14, Buffer, strlen(Buffer));
+				page.Printf(1 * W / 16, 4 * H / 14, "%d", GC->rtcc->med_m65.ReplaceCode);
 			}
 		}
 
-		ThrusterName(Buffer, GC->rtcc->med_m65.Thruster);
-		skp->Text(1 * W / 16, 6 * H / 14, Buffer, strlen(Buffer));
+		page.Format(1 * W / 16, 6 * H / 14, this, &ApolloRTCCMFD::ThrusterName, GC->rtcc->med_m65.Thruster);
 
 		if (GC->MissionPlanningActive)
 		{
-			MPTAttitudeName(Buffer, GC->rtcc->med_m65.Attitude);
-			skp->Text(1 * W / 16, 8 * H / 14, Buffer, strlen(Buffer));
+			page.Format(1 * W / 16, 8 * H / 14, this, &ApolloRTCCMFD::MPTAttitudeName, GC->rtcc->med_m65.Attitude);
 
 			if (GC->rtcc->med_m65.UllageDT < 0)
 			{
@@ -4930,437 +4281,362 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			{
 				sprintf_s(Buffer, "%lf s", GC->rtcc->med_m65.UllageDT);
 			}
-			skp->Text(1 * W / 16, 10 * H / 14, Buffer, strlen(Buffer));
+			page.Text(1 * W / 16, 10 * H / 14, Buffer, strlen(Buffer));
 
 			if (GC->rtcc->med_m65.UllageQuads)
 			{
-				skp->Text(1 * W / 16, 12 * H / 14, "4 Thrusters", 11);
+				page.Text(1 * W / 16, 12 * H / 14, "4 Thrusters", 11);
 			}
 			else
 			{
-				skp->Text(1 * W / 16, 12 * H / 14, "2 Thrusters", 11);
+				page.Text(1 * W / 16, 12 * H / 14, "2 Thrusters", 11);
 			}
 
 			if (GC->rtcc->med_m65.Iteration)
 			{
-				skp->Text(10 * W / 16, 2 * H / 14, "Iterate", 7);
+				page.Text(10 * W / 16, 2 * H / 14, "Iterate", 7);
 			}
 			else
 			{
-				skp->Text(10 * W / 16, 2 * H / 14, "Don't iterate", 13);
+				page.Text(10 * W / 16, 2 * H / 14, "Don't iterate", 13);
 			}
 
 			if (GC->rtcc->med_m65.Thruster == RTCC_ENGINETYPE_LMDPS)
 			{
-				sprintf_s(Buffer, "%lf s", GC->rtcc->med_m65.TenPercentDT);
-				skp->Text(10 * W / 16, 4 * H / 14, Buffer, strlen(Buffer));
+				page.Printf(10 * W / 16, 4 * H / 14, "%lf s", GC->rtcc->med_m65.TenPercentDT);
 
-				sprintf_s(Buffer, "%lf", GC->rtcc->med_m65.DPSThrustFactor);
-				skp->Text(10 * W / 16, 6 * H / 14, Buffer, strlen(Buffer));
+				page.Printf(10 * W / 16, 6 * H / 14, "%lf", GC->rtcc->med_m65.DPSThrustFactor);
 			}
 
 			if (GC->rtcc->med_m65.TimeFlag)
 			{
-				skp->Text(10 * W / 16, 8 * H / 14, "Impulsive TIG", 13);
+				page.Text(10 * W / 16, 8 * H / 14, "Impulsive TIG", 13);
 			}
 			else
 			{
-				skp->Text(10 * W / 16, 8 * H / 14, "Optimum TIG", 11);
+				page.Text(10 * W / 16, 8 * H / 14, "Optimum TIG", 11);
 			}
 		}
 
 		if (GC->MissionPlanningActive == false)
 		{
-			GET_Display(Buffer, G->P30TIG);
-			skp->Text(5 * W / 8, 17 * H / 21, Buffer, strlen(Buffer));
+			page.Format(5 * W / 8, 17 * H / 21, this, &ApolloRTCCMFD::GET_Display, G->P30TIG, true);
 
-			skp->Text(5 * W / 8, 18 * H / 21, "DVX", 3);
-			skp->Text(5 * W / 8, 19 * H / 21, "DVY", 3);
-			skp->Text(5 * W / 8, 20 * H / 21, "DVZ", 3);
+			page.Text(5 * W / 8, 18 * H / 21, "DVX", 3);
+			page.Text(5 * W / 8, 19 * H / 21, "DVY", 3);
+			page.Text(5 * W / 8, 20 * H / 21, "DVZ", 3);
 
-			AGC_Display(Buffer, G->dV_LVLH.x / 0.3048);
-			skp->Text(6 * W / 8, 18 * H / 21, Buffer, strlen(Buffer));
-			AGC_Display(Buffer, G->dV_LVLH.y / 0.3048);
-			skp->Text(6 * W / 8, 19 * H / 21, Buffer, strlen(Buffer));
-			AGC_Display(Buffer, G->dV_LVLH.z / 0.3048);
-			skp->Text(6 * W / 8, 20 * H / 21, Buffer, strlen(Buffer));
+			page.Format(6 * W / 8, 18 * H / 21, this, &ApolloRTCCMFD::AGC_Display, G->dV_LVLH.x / 0.3048);
+			page.Format(6 * W / 8, 19 * H / 21, this, &ApolloRTCCMFD::AGC_Display, G->dV_LVLH.y / 0.3048);
+			page.Format(6 * W / 8, 20 * H / 21, this, &ApolloRTCCMFD::AGC_Display, G->dV_LVLH.z / 0.3048);
 		}
 	}
 	else if (screen == 58)
 	{
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
 
-		skp->Text(4 * W / 8, (int)(0.5 * H / 14), "CHECKOUT MONITOR", 16);
+		page.Text(4 * W / 8, (int)(0.5 * H / 14), "CHECKOUT MONITOR", 16);
 
-		skp->SetFont(font2);
+		page.SetFont(font2);
 
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
 
-		skp->Text(1 * W / 32, 3 * H / 28, "GET", 3);
-		GET_Display(Buffer, GC->rtcc->EZCHECKDIS.GET, false);
-		skp->Text(4 * W / 32, 3 * H / 28, Buffer, strlen(Buffer));
+		page.Text(1 * W / 32, 3 * H / 28, "GET", 3);
+		page.Format(4 * W / 32, 3 * H / 28, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->EZCHECKDIS.GET, false);
 
-		skp->Text(1 * W / 32, 4 * H / 28, "GMT", 3);
-		GET_Display(Buffer, GC->rtcc->EZCHECKDIS.GMT, false);
-		skp->Text(4 * W / 32, 4 * H / 28, Buffer, strlen(Buffer));
+		page.Text(1 * W / 32, 4 * H / 28, "GMT", 3);
+		page.Format(4 * W / 32, 4 * H / 28, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->EZCHECKDIS.GMT, false);
 
-		skp->Text(1 * W / 32, 5 * H / 28, "VEH", 3);
-		skp->Text(4 * W / 32, 5 * H / 28, GC->rtcc->EZCHECKDIS.VEH, 3);
+		page.Text(1 * W / 32, 5 * H / 28, "VEH", 3);
+		page.Text(4 * W / 32, 5 * H / 28, GC->rtcc->EZCHECKDIS.VEH, 3);
 
-		skp->Text(9 * W / 32, 3 * H / 28, "R-DAY", 5);
-		sprintf(Buffer, "%02d:%02d:%04d", GC->rtcc->EZCHECKDIS.R_Day[0], GC->rtcc->EZCHECKDIS.R_Day[1], GC->rtcc->EZCHECKDIS.R_Day[2]);
-		skp->Text(13 * W / 32, 3 * H / 28, Buffer, strlen(Buffer));
-		skp->Text(9 * W / 32, 4 * H / 28, "VID", 3);
-		skp->Text(11 * W / 32, 4 * H / 28, GC->rtcc->EZCHECKDIS.VID, strlen(GC->rtcc->EZCHECKDIS.VID));
-		skp->Text(7 * W / 32, 5 * H / 28, "XT", 2);
-		skp->Text(18 * W / 32, 3 * H / 28, "K-FAC", 5);
-		skp->Text(16 * W / 32, 4 * H / 28, "RF", 2);
-		skp->Text(18 * W / 32, 4 * H / 28, GC->rtcc->EZCHECKDIS.RF, 3);
-		skp->Text(15 * W / 32, 5 * H / 28, "YT", 2);
-		skp->Text(21 * W / 32, 4 * H / 28, "A", 1);
+		page.Text(9 * W / 32, 3 * H / 28, "R-DAY", 5);
+		page.Printf(13 * W / 32, 3 * H / 28, "%02d:%02d:%04d", GC->rtcc->EZCHECKDIS.R_Day[0], GC->rtcc->EZCHECKDIS.R_Day[1], GC->rtcc->EZCHECKDIS.R_Day[2]);
+		page.Text(9 * W / 32, 4 * H / 28, "VID", 3);
+		page.Text(11 * W / 32, 4 * H / 28, GC->rtcc->EZCHECKDIS.VID, strlen(GC->rtcc->EZCHECKDIS.VID));
+		page.Text(7 * W / 32, 5 * H / 28, "XT", 2);
+		page.Text(18 * W / 32, 3 * H / 28, "K-FAC", 5);
+		page.Text(16 * W / 32, 4 * H / 28, "RF", 2);
+		page.Text(18 * W / 32, 4 * H / 28, GC->rtcc->EZCHECKDIS.RF, 3);
+		page.Text(15 * W / 32, 5 * H / 28, "YT", 2);
+		page.Text(21 * W / 32, 4 * H / 28, "A", 1);
 
-		skp->Text(25 * W / 32, 4 * H / 28, "CFG", 3);
-		skp->Text(23 * W / 32, 5 * H / 28, "ZT", 2);
-		skp->Text(25 * W / 32, 6 * H / 28, "OPTION", 6);
-		skp->Text(26 * W / 32, 7 * H / 28, "NV", 2);
+		page.Text(25 * W / 32, 4 * H / 28, "CFG", 3);
+		page.Text(23 * W / 32, 5 * H / 28, "ZT", 2);
+		page.Text(25 * W / 32, 6 * H / 28, "OPTION", 6);
+		page.Text(26 * W / 32, 7 * H / 28, "NV", 2);
 		if (GC->rtcc->EZCHECKDIS.NV > 0)
 		{
-			sprintf(Buffer, "%d", GC->rtcc->EZCHECKDIS.NV);
-			skp->Text(29 * W / 32, 7 * H / 28, Buffer, strlen(Buffer));
+			page.Printf(29 * W / 32, 7 * H / 28, "%d", GC->rtcc->EZCHECKDIS.NV);
 		}
 
-		skp->SetTextAlign(oapi::Sketchpad::RIGHT);
+		page.SetTextAlign(oapi::Sketchpad::RIGHT);
 
 		if (GC->rtcc->EZCHECKDIS.U_T.x > -1)
 		{
-			sprintf(Buffer, "%0.5f", GC->rtcc->EZCHECKDIS.U_T.x);
-			skp->Text(13 * W / 32, 5 * H / 28, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%0.5f", GC->rtcc->EZCHECKDIS.U_T.y);
-			skp->Text(21 * W / 32, 5 * H / 28, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%0.5f", GC->rtcc->EZCHECKDIS.U_T.z);
-			skp->Text(29 * W / 32, 5 * H / 28, Buffer, strlen(Buffer));
+			page.Printf(13 * W / 32, 5 * H / 28, "%0.5f", GC->rtcc->EZCHECKDIS.U_T.x);
+			page.Printf(21 * W / 32, 5 * H / 28, "%0.5f", GC->rtcc->EZCHECKDIS.U_T.y);
+			page.Printf(29 * W / 32, 5 * H / 28, "%0.5f", GC->rtcc->EZCHECKDIS.U_T.z);
 		}
 
-		skp->Text(31 * W / 32, 4 * H / 28, GC->rtcc->EZCHECKDIS.CFG, 3);
-		skp->Text(31 * W / 32, 6 * H / 28, GC->rtcc->EZCHECKDIS.Option, 3);
+		page.Text(31 * W / 32, 4 * H / 28, GC->rtcc->EZCHECKDIS.CFG, 3);
+		page.Text(31 * W / 32, 6 * H / 28, GC->rtcc->EZCHECKDIS.Option, 3);
 
-		skp->Text(2 * W / 32, 7 * H / 28, "X", 1);
-		skp->Text(2 * W / 32, 9 * H / 28, "Y", 1);
-		skp->Text(2 * W / 32, 11 * H / 28, "Z", 1);
-		skp->Text(2 * W / 32, 13 * H / 28, "DX", 2);
-		skp->Text(2 * W / 32, 15 * H / 28, "DY", 2);
-		skp->Text(2 * W / 32, 17 * H / 28, "DZ", 2);
+		page.Text(2 * W / 32, 7 * H / 28, "X", 1);
+		page.Text(2 * W / 32, 9 * H / 28, "Y", 1);
+		page.Text(2 * W / 32, 11 * H / 28, "Z", 1);
+		page.Text(2 * W / 32, 13 * H / 28, "DX", 2);
+		page.Text(2 * W / 32, 15 * H / 28, "DY", 2);
+		page.Text(2 * W / 32, 17 * H / 28, "DZ", 2);
 
 		if (GC->rtcc->EZCHECKDIS.unit == 0)
 		{
-			sprintf(Buffer, "%+013.9f", GC->rtcc->EZCHECKDIS.Pos.x);
-			skp->Text(10 * W / 32, 7 * H / 28, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%+013.9f", GC->rtcc->EZCHECKDIS.Pos.y);
-			skp->Text(10 * W / 32, 9 * H / 28, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%+013.9f", GC->rtcc->EZCHECKDIS.Pos.z);
-			skp->Text(10 * W / 32, 11 * H / 28, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%+013.9f", GC->rtcc->EZCHECKDIS.Vel.x);
-			skp->Text(10 * W / 32, 13 * H / 28, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%+013.9f", GC->rtcc->EZCHECKDIS.Vel.y);
-			skp->Text(10 * W / 32, 15 * H / 28, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%+013.9f", GC->rtcc->EZCHECKDIS.Vel.z);
-			skp->Text(10 * W / 32, 17 * H / 28, Buffer, strlen(Buffer));
-		}
-		else
-		{
-			sprintf(Buffer, "%+012.0f", GC->rtcc->EZCHECKDIS.Pos.x);
-			skp->Text(10 * W / 32, 7 * H / 28, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%+012.0f", GC->rtcc->EZCHECKDIS.Pos.y);
-			skp->Text(10 * W / 32, 9 * H / 28, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%+012.0f", GC->rtcc->EZCHECKDIS.Pos.z);
-			skp->Text(10 * W / 32, 11 * H / 28, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%+013.6f", GC->rtcc->EZCHECKDIS.Vel.x);
-			skp->Text(10 * W / 32, 13 * H / 28, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%+013.6f", GC->rtcc->EZCHECKDIS.Vel.y);
-			skp->Text(10 * W / 32, 15 * H / 28, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%+013.6f", GC->rtcc->EZCHECKDIS.Vel.z);
-			skp->Text(10 * W / 32, 17 * H / 28, Buffer, strlen(Buffer));
-		}
-
-		skp->Text(4 * W / 32, 19 * H / 28, "LO/C", 4);
-		GET_Display2(Buffer, GC->rtcc->EZCHECKDIS.LOC);
-		skp->Text(10 * W / 32, 19 * H / 28, Buffer, strlen(Buffer));
-		skp->Text(4 * W / 32, 20 * H / 28, "GRR/C", 5);
-		GET_Display2(Buffer, GC->rtcc->EZCHECKDIS.GRRC);
-		skp->Text(10 * W / 32, 20 * H / 28, Buffer, strlen(Buffer));
-		skp->Text(4 * W / 32, 21 * H / 28, "ZS/C", 4);
-		GET_Display2(Buffer, GC->rtcc->EZCHECKDIS.ZSC);
-		skp->Text(10 * W / 32, 21 * H / 28, Buffer, strlen(Buffer));
-		skp->Text(4 * W / 32, 22 * H / 28, "GRR/S", 5);
-		GET_Display2(Buffer, GC->rtcc->EZCHECKDIS.GRRS);
-		skp->Text(10 * W / 32, 22 * H / 28, Buffer, strlen(Buffer));
-		skp->Text(4 * W / 32, 23 * H / 28, "ZS/L", 4);
-		GET_Display2(Buffer, GC->rtcc->EZCHECKDIS.ZSL);
-		skp->Text(10 * W / 32, 23 * H / 28, Buffer, strlen(Buffer));
-		skp->Text(4 * W / 32, 24 * H / 28, "ZS/A", 4);
-		GET_Display2(Buffer, GC->rtcc->EZCHECKDIS.ZSA);
-		skp->Text(10 * W / 32, 24 * H / 28, Buffer, strlen(Buffer));
-		skp->Text(4 * W / 32, 25 * H / 28, "EPHB", 4);
-		GET_Display2(Buffer, GC->rtcc->EZCHECKDIS.EPHB);
-		skp->Text(10 * W / 32, 25 * H / 28, Buffer, strlen(Buffer));
-		skp->Text(4 * W / 32, 26 * H / 28, "EPHE", 4);
-		GET_Display2(Buffer, GC->rtcc->EZCHECKDIS.EPHE);
-		skp->Text(10 * W / 32, 26 * H / 28, Buffer, strlen(Buffer));
-		skp->Text(4 * W / 32, 27 * H / 28, "THT", 4);
-		GET_Display2(Buffer, GC->rtcc->EZCHECKDIS.THT);
-		skp->Text(10 * W / 32, 27 * H / 28, Buffer, strlen(Buffer));
-
-		skp->Text(13 * W / 32, 7 * H / 28, "V", 1);
-		sprintf(Buffer, "%07.1f", GC->rtcc->EZCHECKDIS.V_i);
-		skp->Text(17 * W / 32, 7 * H / 28, Buffer, strlen(Buffer));
-		skp->Text(13 * W / 32, 9 * H / 28, "PTH", 3);
-		sprintf(Buffer, "%+07.3f", GC->rtcc->EZCHECKDIS.gamma_i);
-		skp->Text(17 * W / 32, 9 * H / 28, Buffer, strlen(Buffer));
-		skp->Text(13 * W / 32, 11 * H / 28, "AZ", 2);
-		sprintf(Buffer, "%+07.3f", GC->rtcc->EZCHECKDIS.psi);
-		skp->Text(17 * W / 32, 11 * H / 28, Buffer, strlen(Buffer));
-		skp->Text(13 * W / 32, 13 * H / 28, "LATC", 4);
-		sprintf(Buffer, "%+07.4f", GC->rtcc->EZCHECKDIS.phi_c);
-		skp->Text(17 * W / 32, 13 * H / 28, Buffer, strlen(Buffer));
-		skp->Text(13 * W / 32, 15 * H / 28, "LONC", 4);
-		sprintf(Buffer, "%+07.3f", GC->rtcc->EZCHECKDIS.lambda);
-		skp->Text(17 * W / 32, 15 * H / 28, Buffer, strlen(Buffer));
-		skp->Text(12 * W / 32, 17 * H / 28, "HS", 2);
-		sprintf(Buffer, "%07.2f", GC->rtcc->EZCHECKDIS.h_s);
-		skp->Text(17 * W / 32, 17 * H / 28, Buffer, strlen(Buffer));
-
-		skp->Text(19 * W / 32, 7 * H / 28, "A", 1);
-		sprintf(Buffer, "%08.2f", GC->rtcc->EZCHECKDIS.a);
-		skp->Text(24 * W / 32, 7 * H / 28, Buffer, strlen(Buffer));
-		skp->Text(20 * W / 32, 9 * H / 28, "E", 1);
-		sprintf(Buffer, "%07.5f", GC->rtcc->EZCHECKDIS.e);
-		skp->Text(24 * W / 32, 9 * H / 28, Buffer, strlen(Buffer));
-		skp->Text(20 * W / 32, 11 * H / 28, "I", 1);
-		sprintf(Buffer, "%07.3f", GC->rtcc->EZCHECKDIS.i);
-		skp->Text(24 * W / 32, 11 * H / 28, Buffer, strlen(Buffer));
-		skp->Text(20 * W / 32, 13 * H / 28, "AP", 2);
-		sprintf(Buffer, "%07.3f", GC->rtcc->EZCHECKDIS.omega_p);
-		skp->Text(24 * W / 32, 13 * H / 28, Buffer, strlen(Buffer));
-		skp->Text(20 * W / 32, 15 * H / 28, "RAN", 3);
-		sprintf(Buffer, "%07.3f", GC->rtcc->EZCHECKDIS.Omega);
-		skp->Text(24 * W / 32, 15 * H / 28, Buffer, strlen(Buffer));
-		skp->Text(20 * W / 32, 17 * H / 28, "TA", 2);
-		skp->Text(21 * W / 32, 19 * H / 28, "MA", 2);
+			page.Printf(10 * W / 32, 7 * H / 28, "%+013.9f", GC->rtcc->EZCHECKDIS.Pos.x);
+			page.Printf(10 * W / 32, 9 * H / 28, "%+013.9f", GC->rtcc->EZCHECKDIS.Pos.y);
+			page.Printf(10 * W / 32, 11 * H / 28, "%+013.9f", GC->rtcc->EZCHECKDIS.Pos.z);
+			page.Printf(10 * W / 32, 13 * H / 28, "%+013.9f", GC->rtcc->EZCHECKDIS.Vel.x);
+			page.Printf(10 * W / 32, 15 * H / 28, "%+013.9f", GC->rtcc->EZCHECKDIS.Vel.y);
+			page.Printf(10 * W / 32, 17 * H / 28, "%+013.9f", GC->rtcc->EZCHECKDIS.Vel.z);
+		}
+		else
+		{
+			page.Printf(10 * W / 32, 7 * H / 28, "%+012.0f", GC->rtcc->EZCHECKDIS.Pos.x);
+			page.Printf(10 * W / 32, 9 * H / 28, "%+012.0f", GC->rtcc->EZCHECKDIS.Pos.y);
+			page.Printf(10 * W / 32, 11 * H / 28, "%+012.0f", GC->rtcc->EZCHECKDIS.Pos.z);
+			page.Printf(10 * W / 32, 13 * H / 28, "%+013.6f", GC->rtcc->EZCHECKDIS.Vel.x);
+			page.Printf(10 * W / 32, 15 * H / 28, "%+013.6f", GC->rtcc->EZCHECKDIS.Vel.y);
+			page.Printf(10 * W / 32, 17 * H / 28, "%+013.6f", GC->rtcc->EZCHECKDIS.Vel.z);
+		}
+
+		page.Text(4 * W / 32, 19 * H / 28, "LO/C", 4);
+		page.Format(10 * W / 32, 19 * H / 28, this, &ApolloRTCCMFD::GET_Display2, GC->rtcc->EZCHECKDIS.LOC);
+		page.Text(4 * W / 32, 20 * H / 28, "GRR/C", 5);
+		page.Format(10 * W / 32, 20 * H / 28, this, &ApolloRTCCMFD::GET_Display2, GC->rtcc->EZCHECKDIS.GRRC);
+		page.Text(4 * W / 32, 21 * H / 28, "ZS/C", 4);
+		page.Format(10 * W / 32, 21 * H / 28, this, &ApolloRTCCMFD::GET_Display2, GC->rtcc->EZCHECKDIS.ZSC);
+		page.Text(4 * W / 32, 22 * H / 28, "GRR/S", 5);
+		page.Format(10 * W / 32, 22 * H / 28, this, &ApolloRTCCMFD::GET_Display2, GC->rtcc->EZCHECKDIS.GRRS);
+		page.Text(4 * W / 32, 23 * H / 28, "ZS/L", 4);
+		page.Format(10 * W / 32, 23 * H / 28, this, &ApolloRTCCMFD::GET_Display2, GC->rtcc->EZCHECKDIS.ZSL);
+		page.Text(4 * W / 32, 24 * H / 28, "ZS/A", 4);
+		page.Format(10 * W / 32, 24 * H / 28, this, &ApolloRTCCMFD::GET_Display2, GC->rtcc->EZCHECKDIS.ZSA);
+		page.Text(4 * W / 32, 25 * H / 28, "EPHB", 4);
+		page.Format(10 * W / 32, 25 * H / 28, this, &ApolloRTCCMFD::GET_Display2, GC->rtcc->EZCHECKDIS.EPHB);
+		page.Text(4 * W / 32, 26 * H / 28, "EPHE", 4);
+		page.Format(10 * W / 32, 26 * H / 28, this, &ApolloRTCCMFD::GET_Display2, GC->rtcc->EZCHECKDIS.EPHE);
+		page.Text(4 * W / 32, 27 * H / 28, "THT", 4);
+		page.Format(10 * W / 32, 27 * H / 28, this, &ApolloRTCCMFD::GET_Display2, GC->rtcc->EZCHECKDIS.THT);
+
+		page.Text(13 * W / 32, 7 * H / 28, "V", 1);
+		page.Printf(17 * W / 32, 7 * H / 28, "%07.1f", GC->rtcc->EZCHECKDIS.V_i);
+		page.Text(13 * W / 32, 9 * H / 28, "PTH", 3);
+		page.Printf(17 * W / 32, 9 * H / 28, "%+07.3f", GC->rtcc->EZCHECKDIS.gamma_i);
+		page.Text(13 * W / 32, 11 * H / 28, "AZ", 2);
+		page.Printf(17 * W / 32, 11 * H / 28, "%+07.3f", GC->rtcc->EZCHECKDIS.psi);
+		page.Text(13 * W / 32, 13 * H / 28, "LATC", 4);
+		page.Printf(17 * W / 32, 13 * H / 28, "%+07.4f", GC->rtcc->EZCHECKDIS.phi_c);
+		page.Text(13 * W / 32, 15 * H / 28, "LONC", 4);
+		page.Printf(17 * W / 32, 15 * H / 28, "%+07.3f", GC->rtcc->EZCHECKDIS.lambda);
+		page.Text(12 * W / 32, 17 * H / 28, "HS", 2);
+		page.Printf(17 * W / 32, 17 * H / 28, "%07.2f", GC->rtcc->EZCHECKDIS.h_s);
+
+		page.Text(19 * W / 32, 7 * H / 28, "A", 1);
+		page.Printf(24 * W / 32, 7 * H / 28, "%08.2f", GC->rtcc->EZCHECKDIS.a);
+		page.Text(20 * W / 32, 9 * H / 28, "E", 1);
+		page.Printf(24 * W / 32, 9 * H / 28, "%07.5f", GC->rtcc->EZCHECKDIS.e);
+		page.Text(20 * W / 32, 11 * H / 28, "I", 1);
+		page.Printf(24 * W / 32, 11 * H / 28, "%07.3f", GC->rtcc->EZCHECKDIS.i);
+		page.Text(20 * W / 32, 13 * H / 28, "AP", 2);
+		page.Printf(24 * W / 32, 13 * H / 28, "%07.3f", GC->rtcc->EZCHECKDIS.omega_p);
+		page.Text(20 * W / 32, 15 * H / 28, "RAN", 3);
+		page.Printf(24 * W / 32, 15 * H / 28, "%07.3f", GC->rtcc->EZCHECKDIS.Omega);
+		page.Text(20 * W / 32, 17 * H / 28, "TA", 2);
+		page.Text(21 * W / 32, 19 * H / 28, "MA", 2);
 		if (GC->rtcc->EZCHECKDIS.TABlank == false)
 		{
-			sprintf(Buffer, "%07.3f", GC->rtcc->EZCHECKDIS.nu);
-			skp->Text(24 * W / 32, 17 * H / 28, Buffer, strlen(Buffer));
+			page.Printf(24 * W / 32, 17 * H / 28, "%07.3f", GC->rtcc->EZCHECKDIS.nu);
 		}
 		if (GC->rtcc->EZCHECKDIS.MABlank == false)
 		{
-			sprintf(Buffer, "%07.3f", GC->rtcc->EZCHECKDIS.m);
-			skp->Text(25 * W / 32, 19 * H / 28, Buffer, strlen(Buffer));
+			page.Printf(25 * W / 32, 19 * H / 28, "%07.3f", GC->rtcc->EZCHECKDIS.m);
 		}
-		skp->Text(27 * W / 32, 9 * H / 28, "WT", 2);
-		sprintf(Buffer, "%06.0f", GC->rtcc->EZCHECKDIS.WT);
-		skp->Text(31 * W / 32, 9 * H / 28, Buffer, strlen(Buffer));
-		skp->Text(27 * W / 32, 10 * H / 28, "WC", 2);
-		sprintf(Buffer, "%05.0f", GC->rtcc->EZCHECKDIS.WC);
-		skp->Text(31 * W / 32, 10 * H / 28, Buffer, strlen(Buffer));
-		skp->Text(27 * W / 32, 11 * H / 28, "SPS", 3);
+		page.Text(27 * W / 32, 9 * H / 28, "WT", 2);
+		page.Printf(31 * W / 32, 9 * H / 28, "%06.0f", GC->rtcc->EZCHECKDIS.WT);
+		page.Text(27 * W / 32, 10 * H / 28, "WC", 2);
+		page.Printf(31 * W / 32, 10 * H / 28, "%05.0f", GC->rtcc->EZCHECKDIS.WC);
+		page.Text(27 * W / 32, 11 * H / 28, "SPS", 3);
 		if (GC->rtcc->EZCHECKDIS.SPS >= 0)
 		{
-			sprintf(Buffer, "%05.0f", GC->rtcc->EZCHECKDIS.SPS);
-			skp->Text(31 * W / 32, 11 * H / 28, Buffer, strlen(Buffer));
+			page.Printf(31 * W / 32, 11 * H / 28, "%05.0f", GC->rtcc->EZCHECKDIS.SPS);
 		}
-		skp->Text(27 * W / 32, 12 * H / 28, "RCSC", 4);
+		page.Text(27 * W / 32, 12 * H / 28, "RCSC", 4);
 		if (GC->rtcc->EZCHECKDIS.RCS_C >= 0)
 		{
-			sprintf(Buffer, "%04.0f", GC->rtcc->EZCHECKDIS.RCS_C);
-			skp->Text(31 * W / 32, 12 * H / 28, Buffer, strlen(Buffer));
+			page.Printf(31 * W / 32, 12 * H / 28, "%04.0f", GC->rtcc->EZCHECKDIS.RCS_C);
 		}
-		skp->Text(27 * W / 32, 13 * H / 28, "WL", 2);
+		page.Text(27 * W / 32, 13 * H / 28, "WL", 2);
 		if (GC->rtcc->EZCHECKDIS.WL >= 0)
 		{
-			sprintf(Buffer, "%05.0f", GC->rtcc->EZCHECKDIS.WL);
-			skp->Text(31 * W / 32, 13 * H / 28, Buffer, strlen(Buffer));
+			page.Printf(31 * W / 32, 13 * H / 28, "%05.0f", GC->rtcc->EZCHECKDIS.WL);
 		}
-		skp->Text(27 * W / 32, 14 * H / 28, "APS", 3);
+		page.Text(27 * W / 32, 14 * H / 28, "APS", 3);
 		if (GC->rtcc->EZCHECKDIS.APS >= 0)
 		{
-			sprintf(Buffer, "%05.0f", GC->rtcc->EZCHECKDIS.APS);
-			skp->Text(31 * W / 32, 14 * H / 28, Buffer, strlen(Buffer));
+			page.Printf(31 * W / 32, 14 * H / 28, "%05.0f", GC->rtcc->EZCHECKDIS.APS);
 		}
-		skp->Text(27 * W / 32, 15 * H / 28, "DPS", 3);
+		page.Text(27 * W / 32, 15 * H / 28, "DPS", 3);
 		if (GC->rtcc->EZCHECKDIS.DPS >= 0)
 		{
-			sprintf(Buffer, "%05.0f", GC->rtcc->EZCHECKDIS.DPS);
-			skp->Text(31 * W / 32, 15 * H / 28, Buffer, strlen(Buffer));
+			page.Printf(31 * W / 32, 15 * H / 28, "%05.0f", GC->rtcc->EZCHECKDIS.DPS);
 		}
-		skp->Text(27 * W / 32, 16 * H / 28, "RCSL", 4);
+		page.Text(27 * W / 32, 16 * H / 28, "RCSL", 4);
 		if (GC->rtcc->EZCHECKDIS.RCS_L >= 0)
 		{
-			sprintf(Buffer, "%04.0f", GC->rtcc->EZCHECKDIS.RCS_L);
-			skp->Text(31 * W / 32, 16 * H / 28, Buffer, strlen(Buffer));
+			page.Printf(31 * W / 32, 16 * H / 28, "%04.0f", GC->rtcc->EZCHECKDIS.RCS_L);
 		}
-		skp->Text(27 * W / 32, 17 * H / 28, "J2", 2);
+		page.Text(27 * W / 32, 17 * H / 28, "J2", 2);
 		if (GC->rtcc->EZCHECKDIS.J2 >= 0)
 		{
-			sprintf(Buffer, "%05.0f", GC->rtcc->EZCHECKDIS.J2);
-			skp->Text(31 * W / 32, 17 * H / 28, Buffer, strlen(Buffer));
+			page.Printf(31 * W / 32, 17 * H / 28, "%05.0f", GC->rtcc->EZCHECKDIS.J2);
 		}
 
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
 
-		skp->Text(11 * W / 32, 19 * H / 28, "HA", 2);
-		sprintf(Buffer, "%07.2f", GC->rtcc->EZCHECKDIS.h_a);
-		skp->Text(15 * W / 32, 19 * H / 28, Buffer, strlen(Buffer));
-		skp->Text(11 * W / 32, 20 * H / 28, "HP", 2);
-		sprintf(Buffer, "%07.2f", GC->rtcc->EZCHECKDIS.h_p);
-		skp->Text(15 * W / 32, 20 * H / 28, Buffer, strlen(Buffer));
-		skp->Text(11 * W / 32, 21 * H / 28, "HO", 2);
-		skp->Text(11 * W / 32, 22 * H / 28, "HO", 2);
+		page.Text(11 * W / 32, 19 * H / 28, "HA", 2);
+		page.Printf(15 * W / 32, 19 * H / 28, "%07.2f", GC->rtcc->EZCHECKDIS.h_a);
+		page.Text(11 * W / 32, 20 * H / 28, "HP", 2);
+		page.Printf(15 * W / 32, 20 * H / 28, "%07.2f", GC->rtcc->EZCHECKDIS.h_p);
+		page.Text(11 * W / 32, 21 * H / 28, "HO", 2);
+		page.Text(11 * W / 32, 22 * H / 28, "HO", 2);
 		if (GC->rtcc->EZCHECKDIS.HOBlank == false)
 		{
-			sprintf(Buffer, "%07.2f", GC->rtcc->EZCHECKDIS.h_o_NM);
-			skp->Text(15 * W / 32, 21 * H / 28, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%07.0f", GC->rtcc->EZCHECKDIS.h_o_ft);
-			skp->Text(15 * W / 32, 22 * H / 28, Buffer, strlen(Buffer));
-		}
-		skp->Text(11 * W / 32, 23 * H / 28, "LATD", 4);
-		sprintf(Buffer, "%+07.3f", GC->rtcc->EZCHECKDIS.phi_D);
-		skp->Text(15 * W / 32, 23 * H / 28, Buffer, strlen(Buffer));
-		skp->Text(11 * W / 32, 24 * H / 28, "LOND", 4);
-		sprintf(Buffer, "%07.3f", GC->rtcc->EZCHECKDIS.lambda_D);
-		skp->Text(15 * W / 32, 24 * H / 28, Buffer, strlen(Buffer));
-		skp->Text(11 * W / 32, 25 * H / 28, "R", 1);
-		sprintf(Buffer, "%+09.2f", GC->rtcc->EZCHECKDIS.R);
-		skp->Text(15 * W / 32, 25 * H / 28, Buffer, strlen(Buffer));
-		skp->Text(11 * W / 32, 26 * H / 28, "DECL", 4);
-		sprintf(Buffer, "%+07.3f", GC->rtcc->EZCHECKDIS.deltaL);
-		skp->Text(15 * W / 32, 26 * H / 28, Buffer, strlen(Buffer));
-		skp->Text(11 * W / 32, 27 * H / 28, "LSB", 3);
-		skp->Text(20 * W / 32, 27 * H / 28, "LLS", 3);
+			page.Printf(15 * W / 32, 21 * H / 28, "%07.2f", GC->rtcc->EZCHECKDIS.h_o_NM);
+			page.Printf(15 * W / 32, 22 * H / 28, "%07.0f", GC->rtcc->EZCHECKDIS.h_o_ft);
+		}
+		page.Text(11 * W / 32, 23 * H / 28, "LATD", 4);
+		page.Printf(15 * W / 32, 23 * H / 28, "%+07.3f", GC->rtcc->EZCHECKDIS.phi_D);
+		page.Text(11 * W / 32, 24 * H / 28, "LOND", 4);
+		page.Printf(15 * W / 32, 24 * H / 28, "%07.3f", GC->rtcc->EZCHECKDIS.lambda_D);
+		page.Text(11 * W / 32, 25 * H / 28, "R", 1);
+		page.Printf(15 * W / 32, 25 * H / 28, "%+09.2f", GC->rtcc->EZCHECKDIS.R);
+		page.Text(11 * W / 32, 26 * H / 28, "DECL", 4);
+		page.Printf(15 * W / 32, 26 * H / 28, "%+07.3f", GC->rtcc->EZCHECKDIS.deltaL);
+		page.Text(11 * W / 32, 27 * H / 28, "LSB", 3);
+		page.Text(20 * W / 32, 27 * H / 28, "LLS", 3);
 		if (GC->rtcc->EZCHECKDIS.LSTBlank == false)
 		{
-			GET_Display(Buffer, GC->rtcc->EZCHECKDIS.LAL, false);
-			skp->Text(15 * W / 32, 27 * H / 28, Buffer, strlen(Buffer));
-			GET_Display(Buffer, GC->rtcc->EZCHECKDIS.LOL, false);
-			skp->Text(24 * W / 32, 27 * H / 28, Buffer, strlen(Buffer));
+			page.Format(15 * W / 32, 27 * H / 28, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->EZCHECKDIS.LAL, false);
+			page.Format(24 * W / 32, 27 * H / 28, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->EZCHECKDIS.LOL, false);
 		}
 
-		sprintf(Buffer, "%s", GC->rtcc->EZCHECKDIS.ErrorMessage.c_str());
-		skp->Text(28 * W / 32, 24 * H / 28, Buffer, strlen(Buffer));
+		page.Printf(28 * W / 32, 24 * H / 28, "%s", GC->rtcc->EZCHECKDIS.ErrorMessage.c_str());
 	}
 	else if (screen == 59)
 	{
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
 
-		skp->Text(5 * W / 8, 1 * H / 28, "MPT INITIALIZATION", 18);
+		page.Text(5 * W / 8, 1 * H / 28, "MPT INITIALIZATION", 18);
 
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
 
 		if (GC->rtcc->med_m50.Table == RTCC_MPT_LM)
 		{
-			skp->Text(1 * W / 16, 2 * H / 14, "LM", 2);
+			page.Text(1 * W / 16, 2 * H / 14, "LM", 2);
 		}
 		else
 		{
-			skp->Text(1 * W / 16, 2 * H / 14, "CSM", 3);
+			page.Text(1 * W / 16, 2 * H / 14, "CSM", 3);
 		}
 
 		if (GC->pMPTVessel != NULL)
 		{
 			sprintf(Buffer, GC->pMPTVessel->GetName());
-			skp->Text(1 * W / 16, 4 * H / 14, Buffer, strlen(Buffer));
+			page.Text(1 * W / 16, 4 * H / 14, Buffer, strlen(Buffer));
 		}
 		else
 		{
-			skp->Text(1 * W / 16, 4 * H / 14, "None", 4);
+			page.Text(1 * W / 16, 4 * H / 14, "None", 4);
 		}
 
 		if (GC->rtcc->med_m50.CSMWT >= 0)
 		{
-			sprintf(Buffer, "%.0f lbs", GC->rtcc->med_m50.CSMWT / 0.45359237);
-			skp->Text(1 * W / 16, 6 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(1 * W / 16, 6 * H / 14, "%.0f lbs", GC->rtcc->med_m50.CSMWT / 0.45359237);
 		}
 		else
 		{
-			skp->Text(1 * W / 16, 6 * H / 14, "No Update", 9);
+			page.Text(1 * W / 16, 6 * H / 14, "No Update", 9);
 		}
 
 		if (GC->rtcc->med_m50.SIVBWT >= 0)
 		{
-			sprintf(Buffer, "%.0f lbs", GC->rtcc->med_m50.SIVBWT / 0.45359237);
-			skp->Text(1 * W / 16, 8 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(1 * W / 16, 8 * H / 14, "%.0f lbs", GC->rtcc->med_m50.SIVBWT / 0.45359237);
 		}
 		else
 		{
-			skp->Text(1 * W / 16, 8 * H / 14, "No Update", 9);
+			page.Text(1 * W / 16, 8 * H / 14, "No Update", 9);
 		}
 
 		if (GC->rtcc->med_m50.LMWT >= 0)
 		{
-			sprintf(Buffer, "%.0f lbs", GC->rtcc->med_m50.LMWT / 0.45359237);
-			skp->Text(1 * W / 16, 10 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(1 * W / 16, 10 * H / 14, "%.0f lbs", GC->rtcc->med_m50.LMWT / 0.45359237);
 		}
 		else
 		{
-			skp->Text(1 * W / 16, 10 * H / 14, "No Update", 9);
+			page.Text(1 * W / 16, 10 * H / 14, "No Update", 9);
 		}
 
 		if (GC->rtcc->med_m50.LMASCWT >= 0)
 		{
-			sprintf(Buffer, "%.0f lbs", GC->rtcc->med_m50.LMASCWT / 0.45359237);
-			skp->Text(1 * W / 16, 12 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(1 * W / 16, 12 * H / 14, "%.0f lbs", GC->rtcc->med_m50.LMASCWT / 0.45359237);
 		}
 		else
 		{
-			skp->Text(1 * W / 16, 12 * H / 14, "No Update", 9);
+			page.Text(1 * W / 16, 12 * H / 14, "No Update", 9);
 		}
 
 		sprintf_s(Buffer, GC->rtcc->med_m55.ConfigCode.c_str());
-		skp->Text(6 * W / 8, 2 * H / 14, Buffer, strlen(Buffer));
+		page.Text(6 * W / 8, 2 * H / 14, Buffer, strlen(Buffer));
 
 		if (GC->mptInitError == 1)
 		{
-			skp->Text(7 * W / 16, 13 * H / 14, "Mass update successful!", 23);
+			page.Text(7 * W / 16, 13 * H / 14, "Mass update successful!", 23);
 		}
 		else if (GC->mptInitError == 2)
 		{
-			skp->Text(7 * W / 16, 13 * H / 14, "Mass update rejected!", 21);
+			page.Text(7 * W / 16, 13 * H / 14, "Mass update rejected!", 21);
 		}
 		else if (GC->mptInitError == 3)
 		{
-			skp->Text(7 * W / 16, 13 * H / 14, "Config update successful!", 25);
+			page.Text(7 * W / 16, 13 * H / 14, "Config update successful!", 25);
 		}
 		else if (GC->mptInitError == 4)
 		{
-			skp->Text(7 * W / 16, 13 * H / 14, "Config update rejected!", 23);
+			page.Text(7 * W / 16, 13 * H / 14, "Config update rejected!", 23);
 		}
 	}
 	else if (screen == 60)
 	{
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
-		skp->Text(4 * W / 8, 1 * H / 28, "LM DESCENT PLANNING (MSK 0086)", 30);
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
-		skp->SetFont(font2);
-
-		skp->Text(1 * W / 32, 3 * H / 28, "STA ID", 6);
-		skp->Text(1 * W / 32, 4 * H / 28, "LM WT", 5);
-		sprintf(Buffer, "%07.1f", GC->rtcc->PZLDPDIS.LMWT);
-		skp->Text(5 * W / 32, 4 * H / 28, Buffer, strlen(Buffer));
-		skp->Text(9 * W / 32, 3 * H / 28, "GMTV", 4);
-		skp->Text(9 * W / 32, 4 * H / 28, "GETV", 4);
-		skp->Text(17 * W / 32, 3 * H / 28, "MODE", 4);
-		sprintf(Buffer, "%d", GC->rtcc->PZLDPDIS.MODE);
-		skp->Text(21 * W / 32, 3 * H / 28, Buffer, strlen(Buffer));
-		skp->Text(17 * W / 32, 4 * H / 28, "TL", 2);
-
-		skp->SetTextAlign(oapi::Sketchpad::RIGHT);
-
-		GET_Display(Buffer, GC->rtcc->PZLDPDIS.GMTV, false);
-		skp->Text(16 * W / 32, 3 * H / 28, Buffer, strlen(Buffer));
-		GET_Display(Buffer, GC->rtcc->PZLDPDIS.GETV, false);
-		skp->Text(16 * W / 32, 4 * H / 28, Buffer, strlen(Buffer));
-
-		skp->Text(26 * W / 32, 3 * H / 28, "LAT LLS", 7);
-		skp->Text(26 * W / 32, 4 * H / 28, "LONG LLS", 8);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
+		page.Text(4 * W / 8, 1 * H / 28, "LM DESCENT PLANNING (MSK 0086)", 30);
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
+		page.SetFont(font2);
+
+		page.Text(1 * W / 32, 3 * H / 28, "STA ID", 6);
+		page.Text(1 * W / 32, 4 * H / 28, "LM WT", 5);
+		page.Printf(5 * W / 32, 4 * H / 28, "%07.1f", GC->rtcc->PZLDPDIS.LMWT);
+		page.Text(9 * W / 32, 3 * H / 28, "GMTV", 4);
+		page.Text(9 * W / 32, 4 * H / 28, "GETV", 4);
+		page.Text(17 * W / 32, 3 * H / 28, "MODE", 4);
+		page.Printf(21 * W / 32, 3 * H / 28, "%d", GC->rtcc->PZLDPDIS.MODE);
+		page.Text(17 * W / 32, 4 * H / 28, "TL", 2);
+
+		page.SetTextAlign(oapi::Sketchpad::RIGHT);
+
+		page.Format(16 * W / 32, 3 * H / 28, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->PZLDPDIS.GMTV, false);
+		page.Format(16 * W / 32, 4 * H / 28, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->PZLDPDIS.GETV, false);
+
+		page.Text(26 * W / 32, 3 * H / 28, "LAT LLS", 7);
+		page.Text(26 * W / 32, 4 * H / 28, "LONG LLS", 8);
 
 		if (GC->rtcc->PZLDPDIS.LAT_LLS > 0)
 		{
@@ -5370,7 +4646,7 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 		{
 			sprintf(Buffer, "%05.2fS", abs(GC->rtcc->PZLDPDIS.LAT_LLS));
 		}
-		skp->Text(31 * W / 32, 3 * H / 28, Buffer, strlen(Buffer));
+		page.Text(31 * W / 32, 3 * H / 28, Buffer, strlen(Buffer));
 		if (GC->rtcc->PZLDPDIS.LONG_LLS > 0)
 		{
 			sprintf(Buffer, "%06.2fE", GC->rtcc->PZLDPDIS.LONG_LLS);
@@ -5379,35 +4655,31 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 		{
 			sprintf(Buffer, "%06.2fW", abs(GC->rtcc->PZLDPDIS.LONG_LLS));
 		}
-		skp->Text(31 * W / 32, 4 * H / 28, Buffer, strlen(Buffer));
+		page.Text(31 * W / 32, 4 * H / 28, Buffer, strlen(Buffer));
 
-		sprintf(Buffer, "%07.3f", GC->rtcc->PZLDPDIS.DescAsc);
-		skp->Text(30 * W / 32, 20 * H / 28, Buffer, strlen(Buffer));
+		page.Printf(30 * W / 32, 20 * H / 28, "%07.3f", GC->rtcc->PZLDPDIS.DescAsc);
 
 		sprintf(Buffer, GC->rtcc->PZLDPDIS.DescAzMode);
-		skp->Text(27 * W / 32, 19 * H / 28, Buffer, strlen(Buffer));
+		page.Text(27 * W / 32, 19 * H / 28, Buffer, strlen(Buffer));
 
-		sprintf(Buffer, "%+06.2f", GC->rtcc->PZLDPDIS.PD_ThetaIgn);
-		skp->Text(10 * W / 32, 20 * H / 28, Buffer, strlen(Buffer));
+		page.Printf(10 * W / 32, 20 * H / 28, "%+06.2f", GC->rtcc->PZLDPDIS.PD_ThetaIgn);
 
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
 
-		skp->Text(1 * W / 64, 6 * H / 28, "MVR/REV", 7);
-		skp->Text(5 * W / 32, 6 * H / 28, "GETTH/GETIG", 11);
-		skp->Text(23 * W / 64, 6 * H / 28, "LIG/DV", 6);
-		skp->Text(15 * W / 32, 6 * H / 28, "HAC/HPC", 7);
-		skp->Text(20 * W / 32, 6 * H / 28, "DEL/THPC", 8);
-		skp->Text(25 * W / 32, 6 * H / 28, "DVX/DVY", 7);
-		skp->Text(30 * W / 32, 6 * H / 28, "DVZ", 3);
+		page.Text(1 * W / 64, 6 * H / 28, "MVR/REV", 7);
+		page.Text(5 * W / 32, 6 * H / 28, "GETTH/GETIG", 11);
+		page.Text(23 * W / 64, 6 * H / 28, "LIG/DV", 6);
+		page.Text(15 * W / 32, 6 * H / 28, "HAC/HPC", 7);
+		page.Text(20 * W / 32, 6 * H / 28, "DEL/THPC", 8);
+		page.Text(25 * W / 32, 6 * H / 28, "DVX/DVY", 7);
+		page.Text(30 * W / 32, 6 * H / 28, "DVZ", 3);
 
 		for (int i = 0;i < 4;i++)
 		{
 			sprintf(Buffer, GC->rtcc->PZLDPDIS.MVR[i].c_str());
-			skp->Text(2 * W / 32, (7 + 3 * i) * H / 28, Buffer, strlen(Buffer));
-			GET_Display(Buffer, GC->rtcc->PZLDPDIS.GETTH[i], false);
-			skp->Text(6 * W / 32, (7 + 3 * i) * H / 28, Buffer, strlen(Buffer));
-			GET_Display(Buffer, GC->rtcc->PZLDPDIS.GETIG[i], false);
-			skp->Text(6 * W / 32, (8 + 3 * i) * H / 28, Buffer, strlen(Buffer));
+			page.Text(2 * W / 32, (7 + 3 * i) * H / 28, Buffer, strlen(Buffer));
+			page.Format(6 * W / 32, (7 + 3 * i) * H / 28, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->PZLDPDIS.GETTH[i], false);
+			page.Format(6 * W / 32, (8 + 3 * i) * H / 28, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->PZLDPDIS.GETIG[i], false);
 			if (GC->rtcc->PZLDPDIS.LIG[i] > 0)
 			{
 				sprintf(Buffer, "%06.2fE", GC->rtcc->PZLDPDIS.LIG[i]);
@@ -5416,210 +4688,179 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			{
 				sprintf(Buffer, "%06.2fW", abs(GC->rtcc->PZLDPDIS.LIG[i]));
 			}
-			skp->Text(12 * W / 32, (7 + 3 * i) * H / 28, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%06.2f", GC->rtcc->PZLDPDIS.DV[i]);
-			skp->Text(12 * W / 32, (8 + 3 * i) * H / 28, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%+07.2f", GC->rtcc->PZLDPDIS.AC[i]);
-			skp->Text(17 * W / 32, (7 + 3 * i) * H / 28, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%+07.2f", GC->rtcc->PZLDPDIS.HPC[i]);
-			skp->Text(17 * W / 32, (8 + 3 * i) * H / 28, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%+06.1f", GC->rtcc->PZLDPDIS.DVVector[i].x);
-			skp->Text(25 * W / 32, (7 + 3 * i) * H / 28, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%+06.1f", GC->rtcc->PZLDPDIS.DVVector[i].y);
-			skp->Text(25 * W / 32, (8 + 3 * i) * H / 28, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%+06.1f", GC->rtcc->PZLDPDIS.DVVector[i].z);
-			skp->Text(29 * W / 32, (7 + 3 * i) * H / 28, Buffer, strlen(Buffer));
-		}
-
-		skp->Text(1 * W / 32, 19 * H / 28, "POWERED DESCENT", 15);
-		skp->Text(1 * W / 32, 20 * H / 28, "THETA IGN", 9);
-		skp->Text(1 * W / 32, 21 * H / 28, "PROP. REM", 9);
-
-		skp->Text(12 * W / 32, 19 * H / 28, "GETTH", 5);
-		GET_Display(Buffer, GC->rtcc->PZLDPDIS.PD_GETTH, false);
-		skp->Text(16 * W / 32, 19 * H / 28, Buffer, strlen(Buffer));
-		skp->Text(12 * W / 32, 20 * H / 28, "GETIG", 5);
-		GET_Display(Buffer, GC->rtcc->PZLDPDIS.PD_GETIG, false);
-		skp->Text(16 * W / 32, 20 * H / 28, Buffer, strlen(Buffer));
-		skp->Text(12 * W / 32, 21 * H / 28, "GETTD", 5);
-		GET_Display(Buffer, GC->rtcc->PZLDPDIS.PD_GETTD, false);
-		skp->Text(16 * W / 32, 21 * H / 28, Buffer, strlen(Buffer));
-
-		skp->Text(21 * W / 32, 19 * H / 28, "MODE", 4);
-		skp->Text(21 * W / 32, 20 * H / 28, "DESC AZ", 7);
-		skp->Text(21 * W / 32, 21 * H / 28, "SN.LK.A", 7);
+			page.Text(12 * W / 32, (7 + 3 * i) * H / 28, Buffer, strlen(Buffer));
+			page.Printf(12 * W / 32, (8 + 3 * i) * H / 28, "%06.2f", GC->rtcc->PZLDPDIS.DV[i]);
+			page.Printf(17 * W / 32, (7 + 3 * i) * H / 28, "%+07.2f", GC->rtcc->PZLDPDIS.AC[i]);
+			page.Printf(17 * W / 32, (8 + 3 * i) * H / 28, "%+07.2f", GC->rtcc->PZLDPDIS.HPC[i]);
+			page.Printf(25 * W / 32, (7 + 3 * i) * H / 28, "%+06.1f", GC->rtcc->PZLDPDIS.DVVector[i].x);
+			page.Printf(25 * W / 32, (8 + 3 * i) * H / 28, "%+06.1f", GC->rtcc->PZLDPDIS.DVVector[i].y);
+			page.Printf(29 * W / 32, (7 + 3 * i) * H / 28, "%+06.1f", GC->rtcc->PZLDPDIS.DVVector[i].z);
+		}
+
+		page.Text(1 * W / 32, 19 * H / 28, "POWERED DESCENT", 15);
+		page.Text(1 * W / 32, 20 * H / 28, "THETA IGN", 9);
+		page.Text(1 * W / 32, 21 * H / 28, "PROP. REM", 9);
+
+		page.Text(12 * W / 32, 19 * H / 28, "GETTH", 5);
+		page.Format(16 * W / 32, 19 * H / 28, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->PZLDPDIS.PD_GETTH, false);
+		page.Text(12 * W / 32, 20 * H / 28, "GETIG", 5);
+		page.Format(16 * W / 32, 20 * H / 28, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->PZLDPDIS.PD_GETIG, false);
+		page.Text(12 * W / 32, 21 * H / 28, "GETTD", 5);
+		page.Format(16 * W / 32, 21 * H / 28, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->PZLDPDIS.PD_GETTD, false);
+
+		page.Text(21 * W / 32, 19 * H / 28, "MODE", 4);
+		page.Text(21 * W / 32, 20 * H / 28, "DESC AZ", 7);
+		page.Text(21 * W / 32, 21 * H / 28, "SN.LK.A", 7);
 	}
 	else if (screen == 61)
 	{
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
 
-		skp->Text(4 * W / 8, 2 * H / 14, "LGC DESCENT TARGET UPDATE (295)", 31);
+		page.Text(4 * W / 8, 2 * H / 14, "LGC DESCENT TARGET UPDATE (295)", 31);
 
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
 
-		skp->Text(1 * W / 8, 4 * H / 14, "TLAND", 5);
-		GET_Display(Buffer, GC->rtcc->CZTDTGTU.GETTD);
-		skp->Text(3 * W / 8, 4 * H / 14, Buffer, strlen(Buffer));
-		skp->Text(1 * W / 8, 5 * H / 14, "LOAD NO", 7);
-		sprintf(Buffer, "%d", GC->rtcc->CZTDTGTU.SequenceNumber);
-		skp->Text(3 * W / 8, 5 * H / 14, Buffer, strlen(Buffer));
+		page.Text(1 * W / 8, 4 * H / 14, "TLAND", 5);
+		page.Format(3 * W / 8, 4 * H / 14, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->CZTDTGTU.GETTD, true);
+		page.Text(1 * W / 8, 5 * H / 14, "LOAD NO", 7);
+		page.Printf(3 * W / 8, 5 * H / 14, "%d", GC->rtcc->CZTDTGTU.SequenceNumber);
 
-		skp->Text(5 * W / 32, 13 * H / 28, "OID", 3);
-		skp->Text(10 * W / 32, 13 * H / 28, "FCT", 3);
-		skp->Text(15 * W / 32, 13 * H / 28, "DSKY V72", 8);
+		page.Text(5 * W / 32, 13 * H / 28, "OID", 3);
+		page.Text(10 * W / 32, 13 * H / 28, "FCT", 3);
+		page.Text(15 * W / 32, 13 * H / 28, "DSKY V72", 8);
 
 		for (int i = 1;i <= 5;i++)
 		{
-			sprintf(Buffer, "%o", i);
-			skp->Text(5 * W / 32, (i + 14) * H / 28, Buffer, strlen(Buffer));
+			page.Printf(5 * W / 32, (i + 14) * H / 28, "%o", i);
 		}
 
-		skp->Text(10 * W / 32, 15 * H / 28, "INDEX", 5);
-		skp->Text(10 * W / 32, 16 * H / 28, "ADD1", 4);
-		skp->Text(10 * W / 32, 17 * H / 28, "TLAND", 5);
-		skp->Text(10 * W / 32, 18 * H / 28, "ADD2", 4);
-		skp->Text(10 * W / 32, 19 * H / 28, "TLAND", 5);
+		page.Text(10 * W / 32, 15 * H / 28, "INDEX", 5);
+		page.Text(10 * W / 32, 16 * H / 28, "ADD1", 4);
+		page.Text(10 * W / 32, 17 * H / 28, "TLAND", 5);
+		page.Text(10 * W / 32, 18 * H / 28, "ADD2", 4);
+		page.Text(10 * W / 32, 19 * H / 28, "TLAND", 5);
 
 		for (int i = 0;i < 5;i++)
 		{
-			sprintf(Buffer, "%05d", GC->rtcc->CZTDTGTU.Octals[i]);
-			skp->Text(15 * W / 32, (i + 15) * H / 28, Buffer, strlen(Buffer));
+			page.Printf(15 * W / 32, (i + 15) * H / 28, "%05d", GC->rtcc->CZTDTGTU.Octals[i]);
 		}
 	}
 	else if (screen == 62)
 	{
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
 
-		skp->Text(4 * W / 8, 1 * H / 14, "SUNRISE/SUNSET TIMES (MSK 1502)", 31);
+		page.Text(4 * W / 8, 1 * H / 14, "SUNRISE/SUNSET TIMES (MSK 1502)", 31);
 
-		skp->SetFont(font2);
+		page.SetFont(font2);
 
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
 
-		skp->Text(9 * W / 32, 4 * H / 28, "SUNRISE", 7);
-		skp->Text(25 * W / 32, 4 * H / 28, "SUNSET", 6);
+		page.Text(9 * W / 32, 4 * H / 28, "SUNRISE", 7);
+		page.Text(25 * W / 32, 4 * H / 28, "SUNSET", 6);
 
-		skp->Text(1 * W / 32, 5 * H / 28, "REV", 3);
-		skp->Text(1 * W / 32, 6 * H / 28, "NO", 2);
+		page.Text(1 * W / 32, 5 * H / 28, "REV", 3);
+		page.Text(1 * W / 32, 6 * H / 28, "NO", 2);
 
-		skp->Text(9 * W / 64, 5 * H / 28, "GETTR", 5);
-		skp->Text(9 * W / 64, 6 * H / 28, "HH:MM:SS", 8);
+		page.Text(9 * W / 64, 5 * H / 28, "GETTR", 5);
+		page.Text(9 * W / 64, 6 * H / 28, "HH:MM:SS", 8);
 
-		skp->Text(19 * W / 64, 5 * H / 28, "GETSR", 5);
-		skp->Text(19 * W / 64, 6 * H / 28, "HH:MM:SS", 8);
+		page.Text(19 * W / 64, 5 * H / 28, "GETSR", 5);
+		page.Text(19 * W / 64, 6 * H / 28, "HH:MM:SS", 8);
 
-		skp->Text(27 * W / 64, 5 * H / 28, "PIT", 3);
-		skp->Text(27 * W / 64, 6 * H / 28, "DEG", 3);
+		page.Text(27 * W / 64, 5 * H / 28, "PIT", 3);
+		page.Text(27 * W / 64, 6 * H / 28, "DEG", 3);
 
-		skp->Text(63 * W / 128, 5 * H / 28, "YAW", 3);
-		skp->Text(63 * W / 128, 6 * H / 28, "DEG", 3);
+		page.Text(63 * W / 128, 5 * H / 28, "YAW", 3);
+		page.Text(63 * W / 128, 6 * H / 28, "DEG", 3);
 
-		skp->Text(39 * W / 64, 5 * H / 28, "GETTS", 5);
-		skp->Text(39 * W / 64, 6 * H / 28, "HH:MM:SS", 8);
+		page.Text(39 * W / 64, 5 * H / 28, "GETTS", 5);
+		page.Text(39 * W / 64, 6 * H / 28, "HH:MM:SS", 8);
 
-		skp->Text(49 * W / 64, 5 * H / 28, "GETSS", 5);
-		skp->Text(49 * W / 64, 6 * H / 28, "HH:MM:SS", 8);
+		page.Text(49 * W / 64, 5 * H / 28, "GETSS", 5);
+		page.Text(49 * W / 64, 6 * H / 28, "HH:MM:SS", 8);
 
-		skp->Text(56 * W / 64, 5 * H / 28, "PIT", 3);
-		skp->Text(56 * W / 64, 6 * H / 28, "DEG", 3);
+		page.Text(56 * W / 64, 5 * H / 28, "PIT", 3);
+		page.Text(56 * W / 64, 6 * H / 28, "DEG", 3);
 
-		skp->Text(61 * W / 64, 5 * H / 28, "YAW", 3);
-		skp->Text(61 * W / 64, 6 * H / 28, "DEG", 3);
+		page.Text(61 * W / 64, 5 * H / 28, "YAW", 3);
+		page.Text(61 * W / 64, 6 * H / 28, "DEG", 3);
 
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
 
 		for (int i = 0;i < 8;i++)
 		{
-			sprintf(Buffer, "%02d", GC->rtcc->EZSSTAB.data[i].REV);
-			skp->Text(1 * W / 32, (i + 8) * H / 28, Buffer, strlen(Buffer));
+			page.Printf(1 * W / 32, (i + 8) * H / 28, "%02d", GC->rtcc->EZSSTAB.data[i].REV);
 
-			GET_Display(Buffer, GC->rtcc->EZSSTAB.data[i].GETTR, false);
-			skp->Text(3 * W / 32, (i + 8) * H / 28, Buffer, strlen(Buffer));
-			GET_Display(Buffer, GC->rtcc->EZSSTAB.data[i].GETSR, false);
-			skp->Text(8 * W / 32, (i + 8) * H / 28, Buffer, strlen(Buffer));
+			page.Format(3 * W / 32, (i + 8) * H / 28, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->EZSSTAB.data[i].GETTR, false);
+			page.Format(8 * W / 32, (i + 8) * H / 28, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->EZSSTAB.data[i].GETSR, false);
 
-			sprintf(Buffer, "%03.0f", GC->rtcc->EZSSTAB.data[i].theta_SR);
-			skp->Text(13 * W / 32, (i + 8) * H / 28, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%03.0f", GC->rtcc->EZSSTAB.data[i].psi_SR);
-			skp->Text(15 * W / 32, (i + 8) * H / 28, Buffer, strlen(Buffer));
+			page.Printf(13 * W / 32, (i + 8) * H / 28, "%03.0f", GC->rtcc->EZSSTAB.data[i].theta_SR);
+			page.Printf(15 * W / 32, (i + 8) * H / 28, "%03.0f", GC->rtcc->EZSSTAB.data[i].psi_SR);
 
-			GET_Display(Buffer, GC->rtcc->EZSSTAB.data[i].GETTS, false);
-			skp->Text(35 * W / 64, (i + 8) * H / 28, Buffer, strlen(Buffer));
-			GET_Display(Buffer, GC->rtcc->EZSSTAB.data[i].GETSS, false);
-			skp->Text(45 * W / 64, (i + 8) * H / 28, Buffer, strlen(Buffer));
+			page.Format(35 * W / 64, (i + 8) * H / 28, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->EZSSTAB.data[i].GETTS, false);
+			page.Format(45 * W / 64, (i + 8) * H / 28, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->EZSSTAB.data[i].GETSS, false);
 
-			sprintf(Buffer, "%03.0f", GC->rtcc->EZSSTAB.data[i].theta_SS);
-			skp->Text(55 * W / 64, (i + 8) * H / 28, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%03.0f", GC->rtcc->EZSSTAB.data[i].psi_SS);
-			skp->Text(59 * W / 64, (i + 8) * H / 28, Buffer, strlen(Buffer));
+			page.Printf(55 * W / 64, (i + 8) * H / 28, "%03.0f", GC->rtcc->EZSSTAB.data[i].theta_SS);
+			page.Printf(59 * W / 64, (i + 8) * H / 28, "%03.0f", GC->rtcc->EZSSTAB.data[i].psi_SS);
 		}
 	}
 	else if (screen == 63)
 	{
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
 
-		skp->Text(4 * W / 8, 1 * H / 14, "MOONRISE/MOONSET TIMES (MSK 1501)", 33);
+		page.Text(4 * W / 8, 1 * H / 14, "MOONRISE/MOONSET TIMES (MSK 1501)", 33);
 
-		skp->SetFont(font2);
+		page.SetFont(font2);
 
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
 
-		skp->Text(9 * W / 32, 4 * H / 28, "MOONRISE", 8);
-		skp->Text(25 * W / 32, 4 * H / 28, "MOONSET", 7);
+		page.Text(9 * W / 32, 4 * H / 28, "MOONRISE", 8);
+		page.Text(25 * W / 32, 4 * H / 28, "MOONSET", 7);
 
-		skp->Text(1 * W / 32, 5 * H / 28, "REV", 3);
-		skp->Text(1 * W / 32, 6 * H / 28, "NO", 2);
+		page.Text(1 * W / 32, 5 * H / 28, "REV", 3);
+		page.Text(1 * W / 32, 6 * H / 28, "NO", 2);
 
-		skp->Text(9 * W / 64, 5 * H / 28, "GETTR", 5);
-		skp->Text(9 * W / 64, 6 * H / 28, "HH:MM:SS", 8);
+		page.Text(9 * W / 64, 5 * H / 28, "GETTR", 5);
+		page.Text(9 * W / 64, 6 * H / 28, "HH:MM:SS", 8);
 
-		skp->Text(19 * W / 64, 5 * H / 28, "GETMR", 5);
-		skp->Text(19 * W / 64, 6 * H / 28, "HH:MM:SS", 8);
+		page.Text(19 * W / 64, 5 * H / 28, "GETMR", 5);
+		page.Text(19 * W / 64, 6 * H / 28, "HH:MM:SS", 8);
 
-		skp->Text(27 * W / 64, 5 * H / 28, "PIT", 3);
-		skp->Text(27 * W / 64, 6 * H / 28, "DEG", 3);
+		page.Text(27 * W / 64, 5 * H / 28, "PIT", 3);
+		page.Text(27 * W / 64, 6 * H / 28, "DEG", 3);
 
-		skp->Text(63 * W / 128, 5 * H / 28, "YAW", 3);
-		skp->Text(63 * W / 128, 6 * H / 28, "DEG", 3);
+		page.Text(63 * W / 128, 5 * H / 28, "YAW", 3);
+		page.Text(63 * W / 128, 6 * H / 28, "DEG", 3);
 
-		skp->Text(39 * W / 64, 5 * H / 28, "GETTS", 5);
-		skp->Text(39 * W / 64, 6 * H / 28, "HH:MM:SS", 8);
+		page.Text(39 * W / 64, 5 * H / 28, "GETTS", 5);
+		page.Text(39 * W / 64, 6 * H / 28, "HH:MM:SS", 8);
 
-		skp->Text(49 * W / 64, 5 * H / 28, "GETMS", 5);
-		skp->Text(49 * W / 64, 6 * H / 28, "HH:MM:SS", 8);
+		page.Text(49 * W / 64, 5 * H / 28, "GETMS", 5);
+		page.Text(49 * W / 64, 6 * H / 28, "HH:MM:SS", 8);
 
-		skp->Text(56 * W / 64, 5 * H / 28, "PIT", 3);
-		skp->Text(56 * W / 64, 6 * H / 28, "DEG", 3);
+		page.Text(56 * W / 64, 5 * H / 28, "PIT", 3);
+		page.Text(56 * W / 64, 6 * H / 28, "DEG", 3);
 
-		skp->Text(61 * W / 64, 5 * H / 28, "YAW", 3);
-		skp->Text(61 * W / 64, 6 * H / 28, "DEG", 3);
+		page.Text(61 * W / 64, 5 * H / 28, "YAW", 3);
+		page.Text(61 * W / 64, 6 * H / 28, "DEG", 3);
 
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
 
 		for (int i = 0;i < 8;i++)
 		{
-			sprintf(Buffer, "%02d", GC->rtcc->EZMMTAB.data[i].REV);
-			skp->Text(1 * W / 32, (i + 8) * H / 28, Buffer, strlen(Buffer));
+			page.Printf(1 * W / 32, (i + 8) * H / 28, "%02d", GC->rtcc->EZMMTAB.data[i].REV);
 
-			GET_Display(Buffer, GC->rtcc->EZMMTAB.data[i].GETTR, false);
-			skp->Text(3 * W / 32, (i + 8) * H / 28, Buffer, strlen(Buffer));
-			GET_Display(Buffer, GC->rtcc->EZMMTAB.data[i].GETSR, false);
-			skp->Text(8 * W / 32, (i + 8) * H / 28, Buffer, strlen(Buffer));
+			page.Format(3 * W / 32, (i + 8) * H / 28, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->EZMMTAB.data[i].GETTR, false);
+			page.Format(8 * W / 32, (i + 8) * H / 28, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->EZMMTAB.data[i].GETSR, false);
 
-			sprintf(Buffer, "%03.0f", GC->rtcc->EZMMTAB.data[i].theta_SR);
-			skp->Text(13 * W / 32, (i + 8) * H / 28, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%03.0f", GC->rtcc->EZMMTAB.data[i].psi_SR);
-			skp->Text(15 * W / 32, (i + 8) * H / 28, Buffer, strlen(Buffer));
+			page.Printf(13 * W / 32, (i + 8) * H / 28, "%03.0f", GC->rtcc->EZMMTAB.data[i].theta_SR);
+			page.Printf(15 * W / 32, (i + 8) * H / 28, "%03.0f", GC->rtcc->EZMMTAB.data[i].psi_SR);
 
-			GET_Display(Buffer, GC->rtcc->EZMMTAB.data[i].GETTS, false);
-			skp->Text(35 * W / 64, (i + 8) * H / 28, Buffer, strlen(Buffer));
-			GET_Display(Buffer, GC->rtcc->EZMMTAB.data[i].GETSS, false);
-			skp->Text(45 * W / 64, (i + 8) * H / 28, Buffer, strlen(Buffer));
+			page.Format(35 * W / 64, (i + 8) * H / 28, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->EZMMTAB.data[i].GETTS, false);
+			page.Format(45 * W / 64, (i + 8) * H / 28, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->EZMMTAB.data[i].GETSS, false);
 
-			sprintf(Buffer, "%03.0f", GC->rtcc->EZMMTAB.data[i].theta_SS);
-			skp->Text(55 * W / 64, (i + 8) * H / 28, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%03.0f", GC->rtcc->EZMMTAB.data[i].psi_SS);
-			skp->Text(59 * W / 64, (i + 8) * H / 28, Buffer, strlen(Buffer));
+			page.Printf(55 * W / 64, (i + 8) * H / 28, "%03.0f", GC->rtcc->EZMMTAB.data[i].theta_SS);
+			page.Printf(59 * W / 64, (i + 8) * H / 28, "%03.0f", GC->rtcc->EZMMTAB.data[i].psi_SS);
 		}
 	}
 	//FDO Launch Analog No. 1
@@ -5631,103 +4872,103 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			GC->rtcc->FDOLaunchAnalog1(sv);
 		}
 
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
 
-		skp->Text(4 * W / 8, 1 * H / 14, "FDO LAUNCH ANALOG NO 1 (MSK 0040)", 33);
+		page.Text(4 * W / 8, 1 * H / 14, "FDO LAUNCH ANALOG NO 1 (MSK 0040)", 33);
 
-		skp->SetFont(font2);
+		page.SetFont(font2);
 
-		skp->SetTextAlign(oapi::Sketchpad::CENTER, oapi::Sketchpad::BASELINE);
+		page.SetTextAlign(oapi::Sketchpad::CENTER, oapi::Sketchpad::BASELINE);
 
-		skp->Text(2 * W / 64, 13 * H / 80, "2.0", 3);
-		skp->Text(5 * W / 64, 13 * H / 80, "35", 2);
-		skp->Text(8 * W / 64, 13 * H / 80, "40", 2);
+		page.Text(2 * W / 64, 13 * H / 80, "2.0", 3);
+		page.Text(5 * W / 64, 13 * H / 80, "35", 2);
+		page.Text(8 * W / 64, 13 * H / 80, "40", 2);
 
-		skp->Text(2 * W / 64, 20 * H / 80, "1.5", 3);
-		skp->Text(5 * W / 64, 20 * H / 80, "30", 2);
-		skp->Text(8 * W / 64, 20 * H / 80, "35", 2);
+		page.Text(2 * W / 64, 20 * H / 80, "1.5", 3);
+		page.Text(5 * W / 64, 20 * H / 80, "30", 2);
+		page.Text(8 * W / 64, 20 * H / 80, "35", 2);
 
-		skp->Text(2 * W / 64, 27 * H / 80, "1.0", 3);
-		skp->Text(5 * W / 64, 27 * H / 80, "25", 2);
-		skp->Text(8 * W / 64, 27 * H / 80, "30", 2);
+		page.Text(2 * W / 64, 27 * H / 80, "1.0", 3);
+		page.Text(5 * W / 64, 27 * H / 80, "25", 2);
+		page.Text(8 * W / 64, 27 * H / 80, "30", 2);
 
-		skp->Text(5 * W / 64, 61 * H / 160, "(y)", 3);
+		page.Text(5 * W / 64, 61 * H / 160, "(y)", 3);
 
-		skp->Text(2 * W / 64, 34 * H / 80, ".5", 2);
-		skp->Text(5 * W / 64, 34 * H / 80, "20", 2);
-		skp->Text(8 * W / 64, 34 * H / 80, "25", 2);
+		page.Text(2 * W / 64, 34 * H / 80, ".5", 2);
+		page.Text(5 * W / 64, 34 * H / 80, "20", 2);
+		page.Text(8 * W / 64, 34 * H / 80, "25", 2);
 
-		skp->Text(2 * W / 64, 41 * H / 80, "0", 1);
-		skp->Text(5 * W / 64, 41 * H / 80, "15", 2);
-		skp->Text(8 * W / 64, 41 * H / 80, "20", 2);
+		page.Text(2 * W / 64, 41 * H / 80, "0", 1);
+		page.Text(5 * W / 64, 41 * H / 80, "15", 2);
+		page.Text(8 * W / 64, 41 * H / 80, "20", 2);
 
-		skp->Text(2 * W / 64, 48 * H / 80, "-.5", 3);
-		skp->Text(5 * W / 64, 48 * H / 80, "10", 2);
-		skp->Text(8 * W / 64, 48 * H / 80, "15", 2);
+		page.Text(2 * W / 64, 48 * H / 80, "-.5", 3);
+		page.Text(5 * W / 64, 48 * H / 80, "10", 2);
+		page.Text(8 * W / 64, 48 * H / 80, "15", 2);
 
-		skp->Text(2 * W / 64, 55 * H / 80, "-1.0", 4);
-		skp->Text(5 * W / 64, 55 * H / 80, "5", 1);
-		skp->Text(8 * W / 64, 55 * H / 80, "10", 2);
+		page.Text(2 * W / 64, 55 * H / 80, "-1.0", 4);
+		page.Text(5 * W / 64, 55 * H / 80, "5", 1);
+		page.Text(8 * W / 64, 55 * H / 80, "10", 2);
 
-		skp->Text(2 * W / 64, 62 * H / 80, "-1.5", 4);
-		skp->Text(5 * W / 64, 62 * H / 80, "0", 1);
-		skp->Text(8 * W / 64, 62 * H / 80, "5", 1);
+		page.Text(2 * W / 64, 62 * H / 80, "-1.5", 4);
+		page.Text(5 * W / 64, 62 * H / 80, "0", 1);
+		page.Text(8 * W / 64, 62 * H / 80, "5", 1);
 
-		skp->Text(2 * W / 64, 69 * H / 80, "-2.0", 4);
-		skp->Text(5 * W / 64, 69 * H / 80, "-5", 2);
-		skp->Text(8 * W / 64, 69 * H / 80, "0", 1);
+		page.Text(2 * W / 64, 69 * H / 80, "-2.0", 4);
+		page.Text(5 * W / 64, 69 * H / 80, "-5", 2);
+		page.Text(8 * W / 64, 69 * H / 80, "0", 1);
 
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
 
-		skp->Text(3 * W / 20, 21 * H / 24, "0", 1);
-		skp->Text(3 * W / 20, 22 * H / 24, "5", 1);
-		skp->Text(3 * W / 20, 23 * H / 24, "21", 2);
+		page.Text(3 * W / 20, 21 * H / 24, "0", 1);
+		page.Text(3 * W / 20, 22 * H / 24, "5", 1);
+		page.Text(3 * W / 20, 23 * H / 24, "21", 2);
 
-		skp->Text(13 * W / 60, 22 * H / 24, "6.5", 3);
+		page.Text(13 * W / 60, 22 * H / 24, "6.5", 3);
 
-		skp->Text(17 * W / 60, 21 * H / 24, "1", 1);
-		skp->Text(17 * W / 60, 22 * H / 24, "8", 1);
-		skp->Text(17 * W / 60, 23 * H / 24, "22", 2);
+		page.Text(17 * W / 60, 21 * H / 24, "1", 1);
+		page.Text(17 * W / 60, 22 * H / 24, "8", 1);
+		page.Text(17 * W / 60, 23 * H / 24, "22", 2);
 
-		skp->Text(21 * W / 60, 22 * H / 24, "9.5", 3);
+		page.Text(21 * W / 60, 22 * H / 24, "9.5", 3);
 
-		skp->Text(25 * W / 60, 21 * H / 24, "2", 1);
-		skp->Text(25 * W / 60, 22 * H / 24, "11", 2);
-		skp->Text(25 * W / 60, 23 * H / 24, "23", 2);
+		page.Text(25 * W / 60, 21 * H / 24, "2", 1);
+		page.Text(25 * W / 60, 22 * H / 24, "11", 2);
+		page.Text(25 * W / 60, 23 * H / 24, "23", 2);
 
-		skp->Text(29 * W / 60, 22 * H / 24, "12.5", 4);
-		skp->Text(29 * W / 60, 23 * H / 24, "(V)", 3);
+		page.Text(29 * W / 60, 22 * H / 24, "12.5", 4);
+		page.Text(29 * W / 60, 23 * H / 24, "(V)", 3);
 
-		skp->Text(33 * W / 60, 21 * H / 24, "3", 1);
-		skp->Text(33 * W / 60, 22 * H / 24, "14", 2);
-		skp->Text(33 * W / 60, 23 * H / 24, "24", 2);
+		page.Text(33 * W / 60, 21 * H / 24, "3", 1);
+		page.Text(33 * W / 60, 22 * H / 24, "14", 2);
+		page.Text(33 * W / 60, 23 * H / 24, "24", 2);
 
-		skp->Text(37 * W / 60, 22 * H / 24, "15.5", 4);
+		page.Text(37 * W / 60, 22 * H / 24, "15.5", 4);
 
-		skp->Text(41 * W / 60, 21 * H / 24, "4", 1);
-		skp->Text(41 * W / 60, 22 * H / 24, "17", 2);
-		skp->Text(41 * W / 60, 23 * H / 24, "25", 2);
+		page.Text(41 * W / 60, 21 * H / 24, "4", 1);
+		page.Text(41 * W / 60, 22 * H / 24, "17", 2);
+		page.Text(41 * W / 60, 23 * H / 24, "25", 2);
 
-		skp->Text(45 * W / 60, 22 * H / 24, "18.5", 4);
+		page.Text(45 * W / 60, 22 * H / 24, "18.5", 4);
 
-		skp->Text(49 * W / 60, 21 * H / 24, "5", 1);
-		skp->Text(49 * W / 60, 22 * H / 24, "20", 2);
-		skp->Text(49 * W / 60, 23 * H / 24, "26", 2);
+		page.Text(49 * W / 60, 21 * H / 24, "5", 1);
+		page.Text(49 * W / 60, 22 * H / 24, "20", 2);
+		page.Text(49 * W / 60, 23 * H / 24, "26", 2);
 
-		skp->Text(53 * W / 60, 22 * H / 24, "21.5", 4);
+		page.Text(53 * W / 60, 22 * H / 24, "21.5", 4);
 
-		skp->Text(57 * W / 60, 21 * H / 24, "6", 1);
-		skp->Text(57 * W / 60, 22 * H / 24, "23", 2);
-		skp->Text(57 * W / 60, 23 * H / 24, "27", 2);
+		page.Text(57 * W / 60, 21 * H / 24, "6", 1);
+		page.Text(57 * W / 60, 22 * H / 24, "23", 2);
+		page.Text(57 * W / 60, 23 * H / 24, "27", 2);
 
-		skp->Line(W * 3 / 20, H * 3 / 20, W * 19 / 20, H * 3 / 20);
-		skp->Line(W * 3 / 20, H * 3 / 20, W * 3 / 20, H * 17 / 20);
-		skp->Line(W * 3 / 20, H * 17 / 20, W * 19 / 20, H * 17 / 20);
-		skp->Line(W * 19 / 20, H * 3 / 20, W * 19 / 20, H * 17 / 20);
+		page.Line(W * 3 / 20, H * 3 / 20, W * 19 / 20, H * 3 / 20);
+		page.Line(W * 3 / 20, H * 3 / 20, W * 3 / 20, H * 17 / 20);
+		page.Line(W * 3 / 20, H * 17 / 20, W * 19 / 20, H * 17 / 20);
+		page.Line(W * 19 / 20, H * 3 / 20, W * 19 / 20, H * 17 / 20);
 
 		for (unsigned i = 0;i < GC->rtcc->fdolaunchanalog1tab.XVal.size();i++)
 		{
-			skp->Pixel((int)(GC->rtcc->fdolaunchanalog1tab.XVal[i] * W), (int)(GC->rtcc->fdolaunchanalog1tab.YVal[i] * H), 0x00FFFF);
+			page.Pixel((int)(GC->rtcc->fdolaunchanalog1tab.XVal[i] * W), (int)(GC->rtcc->fdolaunchanalog1tab.YVal[i] * H), 0x00FFFF);
 		}
 
 	}
@@ -5740,95 +4981,95 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			GC->rtcc->FDOLaunchAnalog2(sv);
 		}
 
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
 
-		skp->Text(4 * W / 8, 1 * H / 14, "FDO LAUNCH ANALOG NO 2 (MSK 0041)", 33);
+		page.Text(4 * W / 8, 1 * H / 14, "FDO LAUNCH ANALOG NO 2 (MSK 0041)", 33);
 
-		skp->SetFont(font2);
+		page.SetFont(font2);
 
-		skp->SetTextAlign(oapi::Sketchpad::CENTER, oapi::Sketchpad::BASELINE);
+		page.SetTextAlign(oapi::Sketchpad::CENTER, oapi::Sketchpad::BASELINE);
 
-		skp->Text(2 * W / 64, 10 * H / 60, "0", 1);
-		skp->Text(5 * W / 64, 10 * H / 60, "0", 1);
-		skp->Text(8 * W / 64, 10 * H / 60, "0", 1);
+		page.Text(2 * W / 64, 10 * H / 60, "0", 1);
+		page.Text(5 * W / 64, 10 * H / 60, "0", 1);
+		page.Text(8 * W / 64, 10 * H / 60, "0", 1);
 
-		skp->Text(2 * W / 64, 17 * H / 60, "-2", 2);
-		skp->Text(5 * W / 64, 17 * H / 60, "-2", 2);
-		skp->Text(8 * W / 64, 17 * H / 60, "-6", 2);
+		page.Text(2 * W / 64, 17 * H / 60, "-2", 2);
+		page.Text(5 * W / 64, 17 * H / 60, "-2", 2);
+		page.Text(8 * W / 64, 17 * H / 60, "-6", 2);
 
-		skp->Text(2 * W / 64, 24 * H / 60, "-4", 2);
-		skp->Text(5 * W / 64, 24 * H / 60, "-4", 2);
-		skp->Text(8 * W / 64, 24 * H / 60, "-12", 3);
+		page.Text(2 * W / 64, 24 * H / 60, "-4", 2);
+		page.Text(5 * W / 64, 24 * H / 60, "-4", 2);
+		page.Text(8 * W / 64, 24 * H / 60, "-12", 3);
 
-		skp->Text(5 * W / 64, 55 * H / 120, "(yEI)", 5);
+		page.Text(5 * W / 64, 55 * H / 120, "(yEI)", 5);
 
-		skp->Text(2 * W / 64, 31 * H / 60, "-6", 2);
-		skp->Text(5 * W / 64, 31 * H / 60, "-6", 2);
-		skp->Text(8 * W / 64, 31 * H / 60, "-18", 3);
+		page.Text(2 * W / 64, 31 * H / 60, "-6", 2);
+		page.Text(5 * W / 64, 31 * H / 60, "-6", 2);
+		page.Text(8 * W / 64, 31 * H / 60, "-18", 3);
 
-		skp->Text(2 * W / 64, 38 * H / 60, "-8", 2);
-		skp->Text(5 * W / 64, 38 * H / 60, "-8", 2);
-		skp->Text(8 * W / 64, 38 * H / 60, "-24", 3);
+		page.Text(2 * W / 64, 38 * H / 60, "-8", 2);
+		page.Text(5 * W / 64, 38 * H / 60, "-8", 2);
+		page.Text(8 * W / 64, 38 * H / 60, "-24", 3);
 
-		skp->Text(2 * W / 64, 45 * H / 60, "-10", 3);
-		skp->Text(5 * W / 64, 45 * H / 60, "-10", 3);
-		skp->Text(8 * W / 64, 45 * H / 60, "-30", 3);
+		page.Text(2 * W / 64, 45 * H / 60, "-10", 3);
+		page.Text(5 * W / 64, 45 * H / 60, "-10", 3);
+		page.Text(8 * W / 64, 45 * H / 60, "-30", 3);
 
-		skp->Text(2 * W / 64, 52 * H / 60, "-12", 3);
-		skp->Text(5 * W / 64, 52 * H / 60, "-12", 3);
-		skp->Text(8 * W / 64, 52 * H / 60, "-36", 3);
+		page.Text(2 * W / 64, 52 * H / 60, "-12", 3);
+		page.Text(5 * W / 64, 52 * H / 60, "-12", 3);
+		page.Text(8 * W / 64, 52 * H / 60, "-36", 3);
 
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
 
-		skp->Text(3 * W / 20, 21 * H / 24, "6", 1);
-		skp->Text(3 * W / 20, 22 * H / 24, "22.5", 4);
-		skp->Text(3 * W / 20, 23 * H / 24, "25", 2);
+		page.Text(3 * W / 20, 21 * H / 24, "6", 1);
+		page.Text(3 * W / 20, 22 * H / 24, "22.5", 4);
+		page.Text(3 * W / 20, 23 * H / 24, "25", 2);
 
-		skp->Text(83 * W / 340, 21 * H / 24, "8", 1);
-		skp->Text(83 * W / 340, 22 * H / 24, "23", 2);
-		skp->Text(83 * W / 340, 23 * H / 24, "26", 2);
+		page.Text(83 * W / 340, 21 * H / 24, "8", 1);
+		page.Text(83 * W / 340, 22 * H / 24, "23", 2);
+		page.Text(83 * W / 340, 23 * H / 24, "26", 2);
 
-		skp->Text(115 * W / 340, 21 * H / 24, "10", 2);
-		skp->Text(115 * W / 340, 22 * H / 24, "23.5", 4);
-		skp->Text(115 * W / 340, 23 * H / 24, "27", 2);
+		page.Text(115 * W / 340, 21 * H / 24, "10", 2);
+		page.Text(115 * W / 340, 22 * H / 24, "23.5", 4);
+		page.Text(115 * W / 340, 23 * H / 24, "27", 2);
 
-		skp->Text(147 * W / 340, 21 * H / 24, "12", 2);
-		skp->Text(147 * W / 340, 22 * H / 24, "24", 2);
-		skp->Text(147 * W / 340, 23 * H / 24, "28", 2);
+		page.Text(147 * W / 340, 21 * H / 24, "12", 2);
+		page.Text(147 * W / 340, 22 * H / 24, "24", 2);
+		page.Text(147 * W / 340, 23 * H / 24, "28", 2);
 
-		skp->Text(163 * W / 340, 22 * H / 24, "V", 1);
+		page.Text(163 * W / 340, 22 * H / 24, "V", 1);
 
-		skp->Text(179 * W / 340, 21 * H / 24, "14", 2);
-		skp->Text(179 * W / 340, 22 * H / 24, "24.5", 4);
-		skp->Text(179 * W / 340, 23 * H / 24, "29", 2);
+		page.Text(179 * W / 340, 21 * H / 24, "14", 2);
+		page.Text(179 * W / 340, 22 * H / 24, "24.5", 4);
+		page.Text(179 * W / 340, 23 * H / 24, "29", 2);
 
-		skp->Text(211 * W / 340, 21 * H / 24, "16", 2);
-		skp->Text(211 * W / 340, 22 * H / 24, "25", 2);
-		skp->Text(211 * W / 340, 23 * H / 24, "30", 2);
+		page.Text(211 * W / 340, 21 * H / 24, "16", 2);
+		page.Text(211 * W / 340, 22 * H / 24, "25", 2);
+		page.Text(211 * W / 340, 23 * H / 24, "30", 2);
 
-		skp->Text(243 * W / 340, 21 * H / 24, "18", 2);
-		skp->Text(243 * W / 340, 22 * H / 24, "25.5", 4);
-		skp->Text(243 * W / 340, 23 * H / 24, "31", 2);
+		page.Text(243 * W / 340, 21 * H / 24, "18", 2);
+		page.Text(243 * W / 340, 22 * H / 24, "25.5", 4);
+		page.Text(243 * W / 340, 23 * H / 24, "31", 2);
 
-		skp->Text(275 * W / 340, 21 * H / 24, "20", 2);
-		skp->Text(275 * W / 340, 22 * H / 24, "26", 2);
-		skp->Text(275 * W / 340, 23 * H / 24, "32", 2);
+		page.Text(275 * W / 340, 21 * H / 24, "20", 2);
+		page.Text(275 * W / 340, 22 * H / 24, "26", 2);
+		page.Text(275 * W / 340, 23 * H / 24, "32", 2);
 
-		skp->Text(307 * W / 340, 21 * H / 24, "22", 2);
-		skp->Text(307 * W / 340, 22 * H / 24, "26.5", 4);
-		skp->Text(307 * W / 340, 23 * H / 24, "33", 2);
+		page.Text(307 * W / 340, 21 * H / 24, "22", 2);
+		page.Text(307 * W / 340, 22 * H / 24, "26.5", 4);
+		page.Text(307 * W / 340, 23 * H / 24, "33", 2);
 
-		skp->Text(323 * W / 340, 21 * H / 24, "23", 2);
-		skp->Text(323 * W / 340, 23 * H / 24, "33.5", 4);
+		page.Text(323 * W / 340, 21 * H / 24, "23", 2);
+		page.Text(323 * W / 340, 23 * H / 24, "33.5", 4);
 
-		skp->Line(W * 3 / 20, H * 3 / 20, W * 19 / 20, H * 3 / 20);
-		skp->Line(W * 3 / 20, H * 3 / 20, W * 3 / 20, H * 17 / 20);
-		skp->Line(W * 3 / 20, H * 17 / 20, W * 19 / 20, H * 17 / 20);
-		skp->Line(W * 19 / 20, H * 3 / 20, W * 19 / 20, H * 17 / 20);
+		page.Line(W * 3 / 20, H * 3 / 20, W * 19 / 20, H * 3 / 20);
+		page.Line(W * 3 / 20, H * 3 / 20, W * 3 / 20, H * 17 / 20);
+		page.Line(W * 3 / 20, H * 17 / 20, W * 19 / 20, H * 17 / 20);
+		page.Line(W * 19 / 20, H * 3 / 20, W * 19 / 20, H * 17 / 20);
 
 		for (unsigned i = 0;i < GC->rtcc->fdolaunchanalog2tab.XVal.size();i++)
 		{
-			skp->Pixel((int)(GC->rtcc->fdolaunchanalog2tab.XVal[i] * W), (int)(GC->rtcc->fdolaunchanalog2tab.YVal[i] * H), 0x00FFFF);
+			page.Pixel((int)(GC->rtcc->fdolaunchanalog2tab.XVal[i] * W), (int)(GC->rtcc->fdolaunchanalog2tab.YVal[i] * H), 0x00FFFF);
 		}
 
 	}
@@ -5837,311 +5078,264 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 	{
 		if (RTETradeoffScreen == 0)
 		{
-			skp->SetTextAlign(oapi::Sketchpad::CENTER);
-			skp->Text(4 * W / 8, 1 * H / 14, "RTE TRADE OFF INPUTS", 32);
+			page.SetTextAlign(oapi::Sketchpad::CENTER);
+			page.Text(4 * W / 8, 1 * H / 14, "RTE TRADE OFF INPUTS", 32);
 
-			skp->SetTextAlign(oapi::Sketchpad::LEFT);
+			page.SetTextAlign(oapi::Sketchpad::LEFT);
 
 			if (G->RTETradeoffMode == 0)
 			{
-				skp->Text(1 * W / 16, 2 * H / 14, "Near-Earth", 11);
+				page.Text(1 * W / 16, 2 * H / 14, "Near-Earth", 11);
 
-				sprintf(Buffer, "%s", GC->rtcc->med_f70.Site.c_str());
-				skp->Text(1 * W / 16, 6 * H / 14, Buffer, strlen(Buffer));
-				GET_Display(Buffer, GC->rtcc->med_f70.T_V *3600.0, false);
-				skp->Text(1 * W / 16, 8 * H / 14, Buffer, strlen(Buffer));
-				GET_Display(Buffer, GC->rtcc->med_f70.T_omin*3600.0, false);
-				skp->Text(1 * W / 16, 10 * H / 14, Buffer, strlen(Buffer));
-				GET_Display(Buffer, GC->rtcc->med_f70.T_omax*3600.0, false);
-				skp->Text(1 * W / 16, 12 * H / 14, Buffer, strlen(Buffer));
+				page.Printf(1 * W / 16, 6 * H / 14, "%s", GC->rtcc->med_f70.Site.c_str());
+				page.Format(1 * W / 16, 8 * H / 14, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->med_f70.T_V *3600.0, false);
+				page.Format(1 * W / 16, 10 * H / 14, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->med_f70.T_omin*3600.0, false);
+				page.Format(1 * W / 16, 12 * H / 14, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->med_f70.T_omax*3600.0, false);
 
 				if (GC->rtcc->med_f70.EntryProfile == 1)
 				{
-					skp->Text(10 * W / 16, 10 * H / 14, "Constant G", 10);
+					page.Text(10 * W / 16, 10 * H / 14, "Constant G", 10);
 				}
 				else
 				{
-					skp->Text(10 * W / 16, 10 * H / 14, "G&N", 3);
+					page.Text(10 * W / 16, 10 * H / 14, "G&N", 3);
 				}
 			}
 			else
 			{
-				skp->Text(1 * W / 16, 2 * H / 14, "Remote-Earth", 13);
+				page.Text(1 * W / 16, 2 * H / 14, "Remote-Earth", 13);
 
-				sprintf(Buffer, "%d", GC->rtcc->med_f71.Page);
-				skp->Text(1 * W / 16, 4 * H / 14, Buffer, strlen(Buffer));
-				sprintf(Buffer, "%s", GC->rtcc->med_f71.Site.c_str());
-				skp->Text(1 * W / 16, 6 * H / 14, Buffer, strlen(Buffer));
-				GET_Display(Buffer, GC->rtcc->med_f71.T_V *3600.0, false);
-				skp->Text(1 * W / 16, 8 * H / 14, Buffer, strlen(Buffer));
-				GET_Display(Buffer, GC->rtcc->med_f71.T_omin*3600.0, false);
-				skp->Text(1 * W / 16, 10 * H / 14, Buffer, strlen(Buffer));
-				GET_Display(Buffer, GC->rtcc->med_f71.T_omax*3600.0, false);
-				skp->Text(1 * W / 16, 12 * H / 14, Buffer, strlen(Buffer));
+				page.Printf(1 * W / 16, 4 * H / 14, "%d", GC->rtcc->med_f71.Page);
+				page.Printf(1 * W / 16, 6 * H / 14, "%s", GC->rtcc->med_f71.Site.c_str());
+				page.Format(1 * W / 16, 8 * H / 14, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->med_f71.T_V *3600.0, false);
+				page.Format(1 * W / 16, 10 * H / 14, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->med_f71.T_omin*3600.0, false);
+				page.Format(1 * W / 16, 12 * H / 14, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->med_f71.T_omax*3600.0, false);
 
 				if (GC->rtcc->med_f71.EntryProfile == 1)
 				{
-					skp->Text(10 * W / 16, 10 * H / 14, "Constant G", 10);
+					page.Text(10 * W / 16, 10 * H / 14, "Constant G", 10);
 				}
 				else
 				{
-					skp->Text(10 * W / 16, 10 * H / 14, "G&N", 3);
+					page.Text(10 * W / 16, 10 * H / 14, "G&N", 3);
 				}
 			}
 		}
 		else
 		{
-			skp->SetTextAlign(oapi::Sketchpad::CENTER);
-			skp->Text(4 * W / 8, 1 * H / 14, "RTE TRADE OFF DISPLAY (MSK 0364)", 32);
+			page.SetTextAlign(oapi::Sketchpad::CENTER);
+			page.Text(4 * W / 8, 1 * H / 14, "RTE TRADE OFF DISPLAY (MSK 0364)", 32);
 
-			skp->SetFont(font2);
+			page.SetFont(font2);
 
-			skp->SetTextAlign(oapi::Sketchpad::CENTER, oapi::Sketchpad::BASELINE);
+			page.SetTextAlign(oapi::Sketchpad::CENTER, oapi::Sketchpad::BASELINE);
 
-			skp->Line(W * 1 / 10, H * 3 / 20, W * 19 / 20, H * 3 / 20);
-			skp->Line(W * 1 / 10, H * 3 / 20, W * 1 / 10, H * 9 / 10);
-			skp->Line(W * 1 / 10, H * 9 / 10, W * 19 / 20, H * 9 / 10);
-			skp->Line(W * 19 / 20, H * 3 / 20, W * 19 / 20, H * 9 / 10);
+			page.Line(W * 1 / 10, H * 3 / 20, W * 19 / 20, H * 3 / 20);
+			page.Line(W * 1 / 10, H * 3 / 20, W * 1 / 10, H * 9 / 10);
+			page.Line(W * 1 / 10, H * 9 / 10, W * 19 / 20, H * 9 / 10);
+			page.Line(W * 19 / 20, H * 3 / 20, W * 19 / 20, H * 9 / 10);
 
 			unsigned p = RTETradeoffScreen - 1;
 
-			sprintf(Buffer, "%d", GC->rtcc->RTETradeoffTableBuffer[p].XLabels[0]);
-			skp->Text(4 * W / 40, 23 * H / 24, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%d", GC->rtcc->RTETradeoffTableBuffer[p].XLabels[1]);
-			skp->Text(21 * W / 40, 23 * H / 24, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%d", GC->rtcc->RTETradeoffTableBuffer[p].XLabels[2]);
-			skp->Text(38 * W / 40, 23 * H / 24, Buffer, strlen(Buffer));
+			page.Printf(4 * W / 40, 23 * H / 24, "%d", GC->rtcc->RTETradeoffTableBuffer[p].XLabels[0]);
+			page.Printf(21 * W / 40, 23 * H / 24, "%d", GC->rtcc->RTETradeoffTableBuffer[p].XLabels[1]);
+			page.Printf(38 * W / 40, 23 * H / 24, "%d", GC->rtcc->RTETradeoffTableBuffer[p].XLabels[2]);
 
-			sprintf(Buffer, "%d", GC->rtcc->RTETradeoffTableBuffer[p].YLabels[2]);
-			skp->Text(1 * W / 16, 6 * H / 40, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%d", GC->rtcc->RTETradeoffTableBuffer[p].YLabels[1]);
-			skp->Text(1 * W / 16, 21 * H / 40, Buffer, strlen(Buffer));
-			sprintf(Buffer, "%d", GC->rtcc->RTETradeoffTableBuffer[p].YLabels[0]);
-			skp->Text(1 * W / 16, 36 * H / 40, Buffer, strlen(Buffer));
+			page.Printf(1 * W / 16, 6 * H / 40, "%d", GC->rtcc->RTETradeoffTableBuffer[p].YLabels[2]);
+			page.Printf(1 * W / 16, 21 * H / 40, "%d", GC->rtcc->RTETradeoffTableBuffer[p].YLabels[1]);
+			page.Printf(1 * W / 16, 36 * H / 40, "%d", GC->rtcc->RTETradeoffTableBuffer[p].YLabels[0]);
 
-			sprintf(Buffer, "Site: %s", GC->rtcc->RTETradeoffTableBuffer[p].Site.c_str());
-			skp->Text(12 * W / 40, 23 * H / 24, Buffer, strlen(Buffer));
+			page.Printf(12 * W / 40, 23 * H / 24, "Site: %s", GC->rtcc->RTETradeoffTableBuffer[p].Site.c_str());
 
-			sprintf(Buffer, "%s", GC->rtcc->RTETradeoffTableBuffer[p].XAxisName.c_str());
-			skp->Text(29 * W / 40, 23 * H / 24, Buffer, strlen(Buffer));
+			page.Printf(29 * W / 40, 23 * H / 24, "%s", GC->rtcc->RTETradeoffTableBuffer[p].XAxisName.c_str());
 
-			skp->SetFont(font2vert);
-			sprintf(Buffer, "%s", GC->rtcc->RTETradeoffTableBuffer[p].YAxisName.c_str());
-			skp->Text(1 * W / 32, 14 * H / 40, Buffer, strlen(Buffer));
-			skp->SetFont(font2);
+			page.SetFont(font2vert);
+			page.Printf(1 * W / 32, 14 * H / 40, "%s", GC->rtcc->RTETradeoffTableBuffer[p].YAxisName.c_str());
+			page.SetFont(font2);
 
-			skp->SetPen(pen);
+			page.SetPen(pen);
 
 			for (unsigned i = 0;i < GC->rtcc->RTETradeoffTableBuffer[p].curves;i++)
 			{
 				if (GC->rtcc->RTETradeoffTableBuffer[p].TZDisplay[i] >= 0)
 				{
-					sprintf(Buffer, "%d", GC->rtcc->RTETradeoffTableBuffer[p].TZDisplay[i]);
-					skp->Text((int)(GC->rtcc->RTETradeoffTableBuffer[p].TZxval[i] * W), (int)(GC->rtcc->RTETradeoffTableBuffer[p].TZyval[i] * H), Buffer, strlen(Buffer));
+					page.Printf((int)(GC->rtcc->RTETradeoffTableBuffer[p].TZxval[i] * W), (int)(GC->rtcc->RTETradeoffTableBuffer[p].TZyval[i] * H), "%d", GC->rtcc->RTETradeoffTableBuffer[p].TZDisplay[i]);
 				}
 
 				for (unsigned j = 0;j < GC->rtcc->RTETradeoffTableBuffer[p].NumInCurve[i] - 1;j++)
 				{
-					skp->Line((int)(GC->rtcc->RTETradeoffTableBuffer[p].xval[i][j] * W), (int)(GC->rtcc->RTETradeoffTableBuffer[p].yval[i][j] * H),
+					page.Line((int)(GC->rtcc->RTETradeoffTableBuffer[p].xval[i][j] * W), (int)(GC->rtcc->RTETradeoffTableBuffer[p].yval[i][j] * H),
 						(int)(GC->rtcc->RTETradeoffTableBuffer[p].xval[i][j + 1] * W), (int)(GC->rtcc->RTETradeoffTableBuffer[p].yval[i][j + 1] * H));
 				}
 			}
 		}
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
-		skp->SetFont(font2);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
+		page.SetFont(font2);
 
-		sprintf(Buffer, "%d/5", RTETradeoffScreen);
-		skp->Text(15 * W / 16, 1 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(15 * W / 16, 1 * H / 14, "%d/5", RTETradeoffScreen);
 	}
 	//Detailed Maneuver Table 1 and 2
 	else if (screen == 67 || screen == 68)
 	{
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
 
 		DetailedManeuverTable *tab;
 		if (screen == 67)
 		{
 			tab = &GC->rtcc->DMTBuffer[0];
-			skp->Text(4 * W / 8, 1 * H / 14, "FDO DETAILED MANEUVER TABLE (MSK 0054)", 38);
+			page.Text(4 * W / 8, 1 * H / 14, "FDO DETAILED MANEUVER TABLE (MSK 0054)", 38);
 		}
 		else
 		{
 			tab = &GC->rtcc->DMTBuffer[1];
-			skp->Text(4 * W / 8, 1 * H / 14, "FDO DETAILED MANEUVER TABLE (MSK 0069)", 38);
+			page.Text(4 * W / 8, 1 * H / 14, "FDO DETAILED MANEUVER TABLE (MSK 0069)", 38);
 		}
 
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
-		skp->SetFont(font2);
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
+		page.SetFont(font2);
 
-		skp->Text(1 * W / 64, 5 * H / 32, "C STA ID", 8);
-		skp->Text(1 * W / 64, 6 * H / 32, "GMTV", 4);
-		skp->Text(1 * W / 64, 7 * H / 32, "GETV", 4);
-		skp->Text(1 * W / 64, 8 * H / 32, "CODE", 4);
+		page.Text(1 * W / 64, 5 * H / 32, "C STA ID", 8);
+		page.Text(1 * W / 64, 6 * H / 32, "GMTV", 4);
+		page.Text(1 * W / 64, 7 * H / 32, "GETV", 4);
+		page.Text(1 * W / 64, 8 * H / 32, "CODE", 4);
 
-		skp->Text(18 * W / 64, 5 * H / 32, "L STA ID", 8);
-		skp->Text(18 * W / 64, 6 * H / 32, "GMTV", 4);
-		skp->Text(18 * W / 64, 7 * H / 32, "GETV", 4);
-		skp->Text(20 * W / 64, 8 * H / 32, "REF", 3);
+		page.Text(18 * W / 64, 5 * H / 32, "L STA ID", 8);
+		page.Text(18 * W / 64, 6 * H / 32, "GMTV", 4);
+		page.Text(18 * W / 64, 7 * H / 32, "GETV", 4);
+		page.Text(20 * W / 64, 8 * H / 32, "REF", 3);
 
-		skp->Text(35 * W / 64, 5 * H / 32, "C STA ID", 8);
-		skp->Text(35 * W / 64, 6 * H / 32, "GMTV", 4);
-		skp->Text(35 * W / 64, 7 * H / 32, "GETV", 4);
-		skp->Text(35 * W / 64, 8 * H / 32, "GETR", 4);
+		page.Text(35 * W / 64, 5 * H / 32, "C STA ID", 8);
+		page.Text(35 * W / 64, 6 * H / 32, "GMTV", 4);
+		page.Text(35 * W / 64, 7 * H / 32, "GETV", 4);
+		page.Text(35 * W / 64, 8 * H / 32, "GETR", 4);
 
-		skp->Text(52 * W / 64, 5 * H / 32, "WT", 2);
-		skp->Text(52 * W / 64, 6 * H / 32, "WC", 2);
-		skp->Text(52 * W / 64, 7 * H / 32, "WL", 2);
-		skp->Text(52 * W / 64, 8 * H / 32, "WF", 2);
+		page.Text(52 * W / 64, 5 * H / 32, "WT", 2);
+		page.Text(52 * W / 64, 6 * H / 32, "WC", 2);
+		page.Text(52 * W / 64, 7 * H / 32, "WL", 2);
+		page.Text(52 * W / 64, 8 * H / 32, "WF", 2);
 
-		skp->Text(1 * W / 64, 10 * H / 32, "GETI", 4);
-		skp->Text(1 * W / 64, 11 * H / 32, "PETI", 4);
-		skp->Text(1 * W / 64, 12 * H / 32, "DVM", 3);
-		skp->Text(1 * W / 64, 13 * H / 32, "DVREM", 5);
-		skp->Text(1 * W / 64, 14 * H / 32, "DVC", 3);
+		page.Text(1 * W / 64, 10 * H / 32, "GETI", 4);
+		page.Text(1 * W / 64, 11 * H / 32, "PETI", 4);
+		page.Text(1 * W / 64, 12 * H / 32, "DVM", 3);
+		page.Text(1 * W / 64, 13 * H / 32, "DVREM", 5);
+		page.Text(1 * W / 64, 14 * H / 32, "DVC", 3);
 
-		skp->Text(18 * W / 64, 10 * H / 32, "DTB", 3);
-		skp->Text(18 * W / 64, 11 * H / 32, "DTU", 3);
+		page.Text(18 * W / 64, 10 * H / 32, "DTB", 3);
+		page.Text(18 * W / 64, 11 * H / 32, "DTU", 3);
 
-		skp->Text(29 * W / 64, 10 * H / 32, "DT TO", 5);
-		skp->Text(29 * W / 64, 11 * H / 32, "DV TO", 5);
+		page.Text(29 * W / 64, 10 * H / 32, "DT TO", 5);
+		page.Text(29 * W / 64, 11 * H / 32, "DV TO", 5);
 
-		skp->Text(41 * W / 64, 10 * H / 32, "REFSMMAT", 8);
+		page.Text(41 * W / 64, 10 * H / 32, "REFSMMAT", 8);
 
-		skp->Text(52 * W / 64, 10 * H / 32, "DEL P", 5);
-		skp->Text(52 * W / 64, 11 * H / 32, "DEL Y", 5);
+		page.Text(52 * W / 64, 10 * H / 32, "DEL P", 5);
+		page.Text(52 * W / 64, 11 * H / 32, "DEL Y", 5);
 
-		skp->Text(17 * W / 64, 12 * H / 32, "VGX", 3);
-		skp->Text(17 * W / 64, 13 * H / 32, "VGY", 3);
-		skp->Text(17 * W / 64, 14 * H / 32, "VGZ", 3);
+		page.Text(17 * W / 64, 12 * H / 32, "VGX", 3);
+		page.Text(17 * W / 64, 13 * H / 32, "VGY", 3);
+		page.Text(17 * W / 64, 14 * H / 32, "VGZ", 3);
 
 		if (tab->isCSMTV)
 		{
-			skp->Text(29 * W / 64, 12 * H / 32, "OR", 2);
-			skp->Text(29 * W / 64, 13 * H / 32, "IP", 2);
-			skp->Text(29 * W / 64, 14 * H / 32, "MY", 2);
-		}
-		else
-		{
-			skp->Text(29 * W / 64, 12 * H / 32, "OY", 2);
-			skp->Text(29 * W / 64, 13 * H / 32, "IP", 2);
-			skp->Text(29 * W / 64, 14 * H / 32, "MR", 2);
-		}
-
-		skp->Text(40 * W / 64, 12 * H / 32, "YB", 2);
-		skp->Text(40 * W / 64, 13 * H / 32, "PB", 2);
-		skp->Text(40 * W / 64, 14 * H / 32, "RB", 2);
-
-		skp->Text(52 * W / 64, 12 * H / 32, "YH", 2);
-		skp->Text(52 * W / 64, 13 * H / 32, "PH", 2);
-		skp->Text(52 * W / 64, 14 * H / 32, "RH", 2);
-
-		skp->Text(1 * W / 64, 16 * H / 32, "VF", 2);
-		skp->Text(1 * W / 64, 17 * H / 32, "VS", 2);
-		skp->Text(1 * W / 64, 18 * H / 32, "VD", 2);
-		skp->Text(1 * W / 64, 19 * H / 32, "DH", 2);
-		skp->Text(1 * W / 64, 20 * H / 32, "PHASE", 5);
-		skp->Text(1 * W / 64, 21 * H / 32, "PHASE DOT", 9);
-		skp->Text(1 * W / 64, 22 * H / 32, "WEDGE ANG", 9);
-		skp->Text(1 * W / 64, 23 * H / 32, "YD", 2);
-
-		skp->Text(17 * W / 64, 16 * H / 32, "H BI", 4);
-		skp->Text(17 * W / 64, 17 * H / 32, "P BI", 4);
-		skp->Text(17 * W / 64, 18 * H / 32, "L BI", 4);
-		skp->Text(17 * W / 64, 19 * H / 32, "F BI", 4);
-
-		skp->Text(29 * W / 64, 16 * H / 32, "HA", 2);
-		skp->Text(29 * W / 64, 17 * H / 32, "HP", 2);
-		skp->Text(29 * W / 64, 18 * H / 32, "L AN", 4);
-		skp->Text(29 * W / 64, 19 * H / 32, "E", 1);
-		skp->Text(29 * W / 64, 20 * H / 32, "I", 1);
-		skp->Text(29 * W / 64, 21 * H / 32, "WP", 2);
-
-		skp->Text(42 * W / 64, 16 * H / 32, "VP", 2);
-		skp->Text(42 * W / 64, 17 * H / 32, "THETA P", 7);
-		skp->Text(42 * W / 64, 18 * H / 32, "DELTA P", 7);
-		skp->Text(42 * W / 64, 19 * H / 32, "P LLS", 5);
-		skp->Text(42 * W / 64, 20 * H / 32, "L LLS", 5);
-		skp->Text(42 * W / 64, 21 * H / 32, "R LLS", 5);
-
-		skp->Text(1 * W / 64, 25 * H / 32, "PGNS", 4);
-		skp->Text(1 * W / 64, 26 * H / 32, "EXT DV", 6);
-		skp->Text(1 * W / 64, 27 * H / 32, "GETI", 4);
-		skp->Text(2 * W / 64, 28 * H / 32, "VX", 2);
-		skp->Text(2 * W / 64, 29 * H / 32, "VY", 2);
-		skp->Text(2 * W / 64, 30 * H / 32, "VZ", 2);
-
-		skp->Text(18 * W / 64, 25 * H / 32, "AGS", 3);
-		skp->Text(18 * W / 64, 26 * H / 32, "EXT DV", 6);
-		skp->Text(18 * W / 64, 27 * H / 32, "GETI", 4);
-		skp->Text(19 * W / 64, 28 * H / 32, "VX", 2);
-		skp->Text(19 * W / 64, 29 * H / 32, "VY", 2);
-		skp->Text(19 * W / 64, 30 * H / 32, "VZ", 2);
-
-		skp->SetTextAlign(oapi::Sketchpad::RIGHT);
-
-		sprintf_s(Buffer, "%s", tab->C_STA_ID);
-		skp->Text(17 * W / 64, 5 * H / 32, Buffer, strlen(Buffer));
-		GET_Display3(Buffer, tab->C_GMTV);
-		skp->Text(17 * W / 64, 6 * H / 32, Buffer, strlen(Buffer));
-		GET_Display3(Buffer, tab->C_GETV);
-		skp->Text(17 * W / 64, 7 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%s", tab->CODE);
-		skp->Text(19 * W / 64, 8 * H / 32, Buffer, strlen(Buffer));
-
-		sprintf_s(Buffer, "%s", tab->L_STA_ID);
-		skp->Text(34 * W / 64, 5 * H / 32, Buffer, strlen(Buffer));
-		GET_Display3(Buffer, tab->L_GMTV);
-		skp->Text(34 * W / 64, 6 * H / 32, Buffer, strlen(Buffer));
-		GET_Display3(Buffer, tab->L_GETV);
-		skp->Text(34 * W / 64, 7 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%s", tab->REF);
-		skp->Text(34 * W / 64, 8 * H / 32, Buffer, strlen(Buffer));
-
-		sprintf_s(Buffer, "%s", tab->X_STA_ID);
-		skp->Text(51 * W / 64, 5 * H / 32, Buffer, strlen(Buffer));
-		GET_Display3(Buffer, tab->X_GMTV);
-		skp->Text(51 * W / 64, 6 * H / 32, Buffer, strlen(Buffer));
-		GET_Display3(Buffer, tab->X_GETV);
-		skp->Text(51 * W / 64, 7 * H / 32, Buffer, strlen(Buffer));
-		GET_Display3(Buffer, tab->GETR);
-		skp->Text(51 * W / 64, 8 * H / 32, Buffer, strlen(Buffer));
-
-		sprintf_s(Buffer, "%07.1f", tab->WT);
-		skp->Text(63 * W / 64, 5 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%07.1f", tab->WC);
-		skp->Text(63 * W / 64, 6 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%07.1f", tab->WL);
-		skp->Text(63 * W / 64, 7 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%07.1f", tab->WF);
-		skp->Text(63 * W / 64, 8 * H / 32, Buffer, strlen(Buffer));
-
-		GET_Display3(Buffer, tab->GETI);
-		skp->Text(17 * W / 64, 10 * H / 32, Buffer, strlen(Buffer));
-		GET_Display3(Buffer, tab->PETI);
-		skp->Text(17 * W / 64, 11 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.1f", tab->DVM);
-		skp->Text(15 * W / 64, 12 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.1f", tab->DVREM);
-		skp->Text(15 * W / 64, 13 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.1f", tab->DVC);
-		skp->Text(15 * W / 64, 14 * H / 32, Buffer, strlen(Buffer));
+			page.Text(29 * W / 64, 12 * H / 32, "OR", 2);
+			page.Text(29 * W / 64, 13 * H / 32, "IP", 2);
+			page.Text(29 * W / 64, 14 * H / 32, "MY", 2);
+		}
+		else
+		{
+			page.Text(29 * W / 64, 12 * H / 32, "OY", 2);
+			page.Text(29 * W / 64, 13 * H / 32, "IP", 2);
+			page.Text(29 * W / 64, 14 * H / 32, "MR", 2);
+		}
+
+		page.Text(40 * W / 64, 12 * H / 32, "YB", 2);
+		page.Text(40 * W / 64, 13 * H / 32, "PB", 2);
+		page.Text(40 * W / 64, 14 * H / 32, "RB", 2);
+
+		page.Text(52 * W / 64, 12 * H / 32, "YH", 2);
+		page.Text(52 * W / 64, 13 * H / 32, "PH", 2);
+		page.Text(52 * W / 64, 14 * H / 32, "RH", 2);
+
+		page.Text(1 * W / 64, 16 * H / 32, "VF", 2);
+		page.Text(1 * W / 64, 17 * H / 32, "VS", 2);
+		page.Text(1 * W / 64, 18 * H / 32, "VD", 2);
+		page.Text(1 * W / 64, 19 * H / 32, "DH", 2);
+		page.Text(1 * W / 64, 20 * H / 32, "PHASE", 5);
+		page.Text(1 * W / 64, 21 * H / 32, "PHASE DOT", 9);
+		page.Text(1 * W / 64, 22 * H / 32, "WEDGE ANG", 9);
+		page.Text(1 * W / 64, 23 * H / 32, "YD", 2);
+
+		page.Text(17 * W / 64, 16 * H / 32, "H BI", 4);
+		page.Text(17 * W / 64, 17 * H / 32, "P BI", 4);
+		page.Text(17 * W / 64, 18 * H / 32, "L BI", 4);
+		page.Text(17 * W / 64, 19 * H / 32, "F BI", 4);
+
+		page.Text(29 * W / 64, 16 * H / 32, "HA", 2);
+		page.Text(29 * W / 64, 17 * H / 32, "HP", 2);
+		page.Text(29 * W / 64, 18 * H / 32, "L AN", 4);
+		page.Text(29 * W / 64, 19 * H / 32, "E", 1);
+		page.Text(29 * W / 64, 20 * H / 32, "I", 1);
+		page.Text(29 * W / 64, 21 * H / 32, "WP", 2);
+
+		page.Text(42 * W / 64, 16 * H / 32, "VP", 2);
+		page.Text(42 * W / 64, 17 * H / 32, "THETA P", 7);
+		page.Text(42 * W / 64, 18 * H / 32, "DELTA P", 7);
+		page.Text(42 * W / 64, 19 * H / 32, "P LLS", 5);
+		page.Text(42 * W / 64, 20 * H / 32, "L LLS", 5);
+		page.Text(42 * W / 64, 21 * H / 32, "R LLS", 5);
+
+		page.Text(1 * W / 64, 25 * H / 32, "PGNS", 4);
+		page.Text(1 * W / 64, 26 * H / 32, "EXT DV", 6);
+		page.Text(1 * W / 64, 27 * H / 32, "GETI", 4);
+		page.Text(2 * W / 64, 28 * H / 32, "VX", 2);
+		page.Text(2 * W / 64, 29 * H / 32, "VY", 2);
+		page.Text(2 * W / 64, 30 * H / 32, "VZ", 2);
+
+		page.Text(18 * W / 64, 25 * H / 32, "AGS", 3);
+		page.Text(18 * W / 64, 26 * H / 32, "EXT DV", 6);
+		page.Text(18 * W / 64, 27 * H / 32, "GETI", 4);
+		page.Text(19 * W / 64, 28 * H / 32, "VX", 2);
+		page.Text(19 * W / 64, 29 * H / 32, "VY", 2);
+		page.Text(19 * W / 64, 30 * H / 32, "VZ", 2);
+
+		page.SetTextAlign(oapi::Sketchpad::RIGHT);
+
+		page.Printf(17 * W / 64, 5 * H / 32, "%s", tab->C_STA_ID);
+		page.Format(17 * W / 64, 6 * H / 32, this, &ApolloRTCCMFD::GET_Display3, tab->C_GMTV);
+		page.Format(17 * W / 64, 7 * H / 32, this, &ApolloRTCCMFD::GET_Display3, tab->C_GETV);
+		page.Printf(19 * W / 64, 8 * H / 32, "%s", tab->CODE);
+
+		page.Printf(34 * W / 64, 5 * H / 32, "%s", tab->L_STA_ID);
+		page.Format(34 * W / 64, 6 * H / 32, this, &ApolloRTCCMFD::GET_Display3, tab->L_GMTV);
+		page.Format(34 * W / 64, 7 * H / 32, this, &ApolloRTCCMFD::GET_Display3, tab->L_GETV);
+		page.Printf(34 * W / 64, 8 * H / 32, "%s", tab->REF);
+
+		page.Printf(51 * W / 64, 5 * H / 32, "%s", tab->X_STA_ID);
+		page.Format(51 * W / 64, 6 * H / 32, this, &ApolloRTCCMFD::GET_Display3, tab->X_GMTV);
+		page.Format(51 * W / 64, 7 * H / 32, this, &ApolloRTCCMFD::GET_Display3, tab->X_GETV);
+		page.Format(51 * W / 64, 8 * H / 32, this, &ApolloRTCCMFD::GET_Display3, tab->GETR);
+
+		page.Printf(63 * W / 64, 5 * H / 32, "%07.1f", tab->WT);
+		page.Printf(63 * W / 64, 6 * H / 32, "%07.1f", tab->WC);
+		page.Printf(63 * W / 64, 7 * H / 32, "%07.1f", tab->WL);
+		page.Printf(63 * W / 64, 8 * H / 32, "%07.1f", tab->WF);
+
+		page.Format(17 * W / 64, 10 * H / 32, this, &ApolloRTCCMFD::GET_Display3, tab->GETI);
+		page.Format(17 * W / 64, 11 * H / 32, this, &ApolloRTCCMFD::GET_Display3, tab->PETI);
+		page.Printf(15 * W / 64, 12 * H / 32, "%.1f", tab->DVM);
+		page.Printf(15 * W / 64, 13 * H / 32, "%.1f", tab->DVREM);
+		page.Printf(15 * W / 64, 14 * H / 32, "%.1f", tab->DVC);
 
 		int hh, mm;
 		double ss;
 		SStoHHMMSS(tab->DT_B, hh, mm, ss);
-		sprintf_s(Buffer, "%d:%04.1f", mm, ss);
-		skp->Text(28 * W / 64, 10 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.2f", tab->DT_U);
-		skp->Text(28 * W / 64, 11 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.1f", tab->VG.x);
-		skp->Text(28 * W / 64, 12 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.1f", tab->VG.y);
-		skp->Text(28 * W / 64, 13 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.1f", tab->VG.z);
-		skp->Text(28 * W / 64, 14 * H / 32, Buffer, strlen(Buffer));
-
-		sprintf_s(Buffer, "%.2f", tab->DT_TO);
-		skp->Text(40 * W / 64, 10 * H / 32, Buffer, strlen(Buffer));
+		page.Printf(28 * W / 64, 10 * H / 32, "%d:%04.1f", mm, ss);
+		page.Printf(28 * W / 64, 11 * H / 32, "%.2f", tab->DT_U);
+		page.Printf(28 * W / 64, 12 * H / 32, "%.1f", tab->VG.x);
+		page.Printf(28 * W / 64, 13 * H / 32, "%.1f", tab->VG.y);
+		page.Printf(28 * W / 64, 14 * H / 32, "%.1f", tab->VG.z);
+
+		page.Printf(40 * W / 64, 10 * H / 32, "%.2f", tab->DT_TO);
 		if (tab->DV_TO >= 10.0)
 		{
 			sprintf_s(Buffer, "%.1f", tab->DV_TO);
@@ -6150,53 +5344,32 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 		{
 			sprintf_s(Buffer, "%.2f", tab->DV_TO);
 		}
-		skp->Text(40 * W / 64, 11 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.1f", tab->IMUAtt.x);
-		skp->Text(39 * W / 64, 12 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.1f", tab->IMUAtt.y);
-		skp->Text(39 * W / 64, 13 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.1f", tab->IMUAtt.z);
-		skp->Text(39 * W / 64, 14 * H / 32, Buffer, strlen(Buffer));
-
-		sprintf_s(Buffer, "%s", tab->REFSMMAT_Code);
-		skp->Text(50 * W / 64, 11 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.1f", tab->FDAIAtt.x);
-		skp->Text(51 * W / 64, 12 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.1f", tab->FDAIAtt.y);
-		skp->Text(51 * W / 64, 13 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.1f", tab->FDAIAtt.z);
-		skp->Text(51 * W / 64, 14 * H / 32, Buffer, strlen(Buffer));
-
-		sprintf_s(Buffer, "%5.2f", tab->DEL_P);
-		skp->Text(63 * W / 64, 10 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%5.2f", tab->DEL_Y);
-		skp->Text(63 * W / 64, 11 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.1f", tab->LVLHAtt.x);
-		skp->Text(63 * W / 64, 12 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.1f", tab->LVLHAtt.y);
-		skp->Text(63 * W / 64, 13 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.1f", tab->LVLHAtt.z);
-		skp->Text(63 * W / 64, 14 * H / 32, Buffer, strlen(Buffer));
-
-		sprintf_s(Buffer, "%.2f", tab->VF);
-		skp->Text(15 * W / 64, 16 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.2f", tab->VS);
-		skp->Text(15 * W / 64, 17 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.2f", tab->VD);
-		skp->Text(15 * W / 64, 18 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.2f", tab->DH);
-		skp->Text(15 * W / 64, 19 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.3f", tab->PHASE);
-		skp->Text(19 * W / 64, 20 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.3f", tab->PHASE_DOT);
-		skp->Text(19 * W / 64, 21 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.3f", tab->WEDGE_ANG);
-		skp->Text(19 * W / 64, 22 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.4f", tab->YD);
-		skp->Text(19 * W / 64, 23 * H / 32, Buffer, strlen(Buffer));
-
-		sprintf_s(Buffer, "%.1f", tab->H_BI);
-		skp->Text(28 * W / 64, 16 * H / 32, Buffer, strlen(Buffer));
+		page.Text(40 * W / 64, 11 * H / 32, Buffer, strlen(Buffer));
+		page.Printf(39 * W / 64, 12 * H / 32, "%.1f", tab->IMUAtt.x);
+		page.Printf(39 * W / 64, 13 * H / 32, "%.1f", tab->IMUAtt.y);
+		page.Printf(39 * W / 64, 14 * H / 32, "%.1f", tab->IMUAtt.z);
+
+		page.Printf(50 * W / 64, 11 * H / 32, "%s", tab->REFSMMAT_Code);
+		page.Printf(51 * W / 64, 12 * H / 32, "%.1f", tab->FDAIAtt.x);
+		page.Printf(51 * W / 64, 13 * H / 32, "%.1f", tab->FDAIAtt.y);
+		page.Printf(51 * W / 64, 14 * H / 32, "%.1f", tab->FDAIAtt.z);
+
+		page.Printf(63 * W / 64, 10 * H / 32, "%5.2f", tab->DEL_P);
+		page.Printf(63 * W / 64, 11 * H / 32, "%5.2f", tab->DEL_Y);
+		page.Printf(63 * W / 64, 12 * H / 32, "%.1f", tab->LVLHAtt.x);
+		page.Printf(63 * W / 64, 13 * H / 32, "%.1f", tab->LVLHAtt.y);
+		page.Printf(63 * W / 64, 14 * H / 32, "%.1f", tab->LVLHAtt.z);
+
+		page.Printf(15 * W / 64, 16 * H / 32, "%.2f", tab->VF);
+		page.Printf(15 * W / 64, 17 * H / 32, "%.2f", tab->VS);
+		page.Printf(15 * W / 64, 18 * H / 32, "%.2f", tab->VD);
+		page.Printf(15 * W / 64, 19 * H / 32, "%.2f", tab->DH);
+		page.Printf(19 * W / 64, 20 * H / 32, "%.3f", tab->PHASE);
+		page.Printf(19 * W / 64, 21 * H / 32, "%.3f", tab->PHASE_DOT);
+		page.Printf(19 * W / 64, 22 * H / 32, "%.3f", tab->WEDGE_ANG);
+		page.Printf(19 * W / 64, 23 * H / 32, "%.4f", tab->YD);
+
+		page.Printf(28 * W / 64, 16 * H / 32, "%.1f", tab->H_BI);
 		if (tab->P_BI > 0)
 		{
 			sprintf_s(Buffer, "%.2f N", tab->P_BI);
@@ -6205,7 +5378,7 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 		{
 			sprintf_s(Buffer, "%.2f S", abs(tab->P_BI));
 		}
-		skp->Text(28 * W / 64, 17 * H / 32, Buffer, strlen(Buffer));
+		page.Text(28 * W / 64, 17 * H / 32, Buffer, strlen(Buffer));
 		if (tab->L_BI > 0)
 		{
 			sprintf_s(Buffer, "%.2f E", tab->L_BI);
@@ -6214,14 +5387,11 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 		{
 			sprintf_s(Buffer, "%.2f W", abs(tab->L_BI));
 		}
-		skp->Text(28 * W / 64, 18 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.2f", tab->F_BI);
-		skp->Text(28 * W / 64, 19 * H / 32, Buffer, strlen(Buffer));
+		page.Text(28 * W / 64, 18 * H / 32, Buffer, strlen(Buffer));
+		page.Printf(28 * W / 64, 19 * H / 32, "%.2f", tab->F_BI);
 
-		sprintf_s(Buffer, "%.3f", tab->HA);
-		skp->Text(41 * W / 64, 16 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.3f", tab->HP);
-		skp->Text(41 * W / 64, 17 * H / 32, Buffer, strlen(Buffer));
+		page.Printf(41 * W / 64, 16 * H / 32, "%.3f", tab->HA);
+		page.Printf(41 * W / 64, 17 * H / 32, "%.3f", tab->HP);
 		if (tab->L_AN > 0)
 		{
 			sprintf_s(Buffer, "%.2f E", tab->L_AN);
@@ -6230,20 +5400,14 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 		{
 			sprintf_s(Buffer, "%.2f W", abs(tab->L_AN));
 		}
-		skp->Text(41 * W / 64, 18 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.8f", tab->E);
-		skp->Text(41 * W / 64, 19 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.4f", tab->I);
-		skp->Text(41 * W / 64, 20 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.4f", tab->WP);
-		skp->Text(41 * W / 64, 21 * H / 32, Buffer, strlen(Buffer));
-
-		sprintf_s(Buffer, "%.2f", tab->VP);
-		skp->Text(57 * W / 64, 16 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.2f", tab->THETA_P);
-		skp->Text(57 * W / 64, 17 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.2f", tab->DELTA_P);
-		skp->Text(57 * W / 64, 18 * H / 32, Buffer, strlen(Buffer));
+		page.Text(41 * W / 64, 18 * H / 32, Buffer, strlen(Buffer));
+		page.Printf(41 * W / 64, 19 * H / 32, "%.8f", tab->E);
+		page.Printf(41 * W / 64, 20 * H / 32, "%.4f", tab->I);
+		page.Printf(41 * W / 64, 21 * H / 32, "%.4f", tab->WP);
+
+		page.Printf(57 * W / 64, 16 * H / 32, "%.2f", tab->VP);
+		page.Printf(57 * W / 64, 17 * H / 32, "%.2f", tab->THETA_P);
+		page.Printf(57 * W / 64, 18 * H / 32, "%.2f", tab->DELTA_P);
 		if (tab->P_LLS > 0)
 		{
 			sprintf_s(Buffer, "%.2f N", tab->P_LLS);
@@ -6252,7 +5416,7 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 		{
 			sprintf_s(Buffer, "%.2f S", abs(tab->P_LLS));
 		}
-		skp->Text(57 * W / 64, 19 * H / 32, Buffer, strlen(Buffer));
+		page.Text(57 * W / 64, 19 * H / 32, Buffer, strlen(Buffer));
 		if (tab->L_LLS > 0)
 		{
 			sprintf_s(Buffer, "%.2f E", tab->L_LLS);
@@ -6261,110 +5425,92 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 		{
 			sprintf_s(Buffer, "%.2f W", abs(tab->L_LLS));
 		}
-		skp->Text(57 * W / 64, 20 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.2f", tab->R_LLS);
-		skp->Text(57 * W / 64, 21 * H / 32, Buffer, strlen(Buffer));
-
-		GET_Display3(Buffer, tab->PGNS_GETI);
-		skp->Text(17 * W / 64, 27 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.4f", tab->PGNS_DV.x);
-		skp->Text(17 * W / 64, 28 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.4f", tab->PGNS_DV.y);
-		skp->Text(17 * W / 64, 29 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.4f", tab->PGNS_DV.z);
-		skp->Text(17 * W / 64, 30 * H / 32, Buffer, strlen(Buffer));
-
-		GET_Display3(Buffer, tab->AGS_GETI);
-		skp->Text(34 * W / 64, 27 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.4f", tab->AGS_DV.x);
-		skp->Text(34 * W / 64, 28 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.4f", tab->AGS_DV.y);
-		skp->Text(34 * W / 64, 29 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.4f", tab->AGS_DV.z);
-		skp->Text(34 * W / 64, 30 * H / 32, Buffer, strlen(Buffer));
-
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
-		sprintf_s(Buffer, "%s", tab->error.c_str());
-		skp->Text(32 * W / 64, 31 * H / 32, Buffer, strlen(Buffer));
+		page.Text(57 * W / 64, 20 * H / 32, Buffer, strlen(Buffer));
+		page.Printf(57 * W / 64, 21 * H / 32, "%.2f", tab->R_LLS);
+
+		page.Format(17 * W / 64, 27 * H / 32, this, &ApolloRTCCMFD::GET_Display3, tab->PGNS_GETI);
+		page.Printf(17 * W / 64, 28 * H / 32, "%.4f", tab->PGNS_DV.x);
+		page.Printf(17 * W / 64, 29 * H / 32, "%.4f", tab->PGNS_DV.y);
+		page.Printf(17 * W / 64, 30 * H / 32, "%.4f", tab->PGNS_DV.z);
+
+		page.Format(34 * W / 64, 27 * H / 32, this, &ApolloRTCCMFD::GET_Display3, tab->AGS_GETI);
+		page.Printf(34 * W / 64, 28 * H / 32, "%.4f", tab->AGS_DV.x);
+		page.Printf(34 * W / 64, 29 * H / 32, "%.4f", tab->AGS_DV.y);
+		page.Printf(34 * W / 64, 30 * H / 32, "%.4f", tab->AGS_DV.z);
+
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
+		page.Printf(32 * W / 64, 31 * H / 32, "%s", tab->error.c_str());
 	}
 	else if (screen == 69)
 	{
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
-		skp->Text(4 * W / 8, 1 * H / 14, "SPQ Initialization (MED K06)", 28);
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
-		sprintf_s(Buffer, "%.1f NM", GC->rtcc->GZGENCSN.SPQDeltaH / 1852.0);
-		skp->Text(1 * W / 16, 2 * H / 14, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.2f", GC->rtcc->GZGENCSN.SPQElevationAngle*DEG);
-		skp->Text(1 * W / 16, 4 * H / 14, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.2f", GC->rtcc->GZGENCSN.SPQTerminalPhaseAngle*DEG);
-		skp->Text(1 * W / 16, 6 * H / 14, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.1f NM", GC->rtcc->GZGENCSN.SPQMinimumPerifocus / 1852.0);
-		skp->Text(1 * W / 16, 8 * H / 14, Buffer, strlen(Buffer));
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
+		page.Text(4 * W / 8, 1 * H / 14, "SPQ Initialization (MED K06)", 28);
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
+		page.Printf(1 * W / 16, 2 * H / 14, "%.1f NM", GC->rtcc->GZGENCSN.SPQDeltaH / 1852.0);
+		page.Printf(1 * W / 16, 4 * H / 14, "%.2f", GC->rtcc->GZGENCSN.SPQElevationAngle*DEG);
+		page.Printf(1 * W / 16, 6 * H / 14, "%.2f", GC->rtcc->GZGENCSN.SPQTerminalPhaseAngle*DEG);
+		page.Printf(1 * W / 16, 8 * H / 14, "%.1f NM", GC->rtcc->GZGENCSN.SPQMinimumPerifocus / 1852.0);
 		if (GC->rtcc->GZGENCSN.TPIDefinition == 1)
 		{
-			skp->Text(1 * W / 16, 10 * H / 14, "Chaser Day/Night Time", 21);
+			page.Text(1 * W / 16, 10 * H / 14, "Chaser Day/Night Time", 21);
 			sprintf_s(Buffer, "%.1f min", GC->rtcc->GZGENCSN.TPIDefinitionValue / 60.0);
 		}
 		else if (GC->rtcc->GZGENCSN.TPIDefinition == 2)
 		{
-			skp->Text(1 * W / 16, 10 * H / 14, "Chaser Longitude", 18);
+			page.Text(1 * W / 16, 10 * H / 14, "Chaser Longitude", 18);
 			sprintf_s(Buffer, "%.1f", GC->rtcc->GZGENCSN.TPIDefinitionValue*DEG);
 		}
 		else if (GC->rtcc->GZGENCSN.TPIDefinition == 3)
 		{
-			skp->Text(1 * W / 16, 10 * H / 14, "On time", 7);
+			page.Text(1 * W / 16, 10 * H / 14, "On time", 7);
 			GET_Display(Buffer, GC->rtcc->GZGENCSN.TPIDefinitionValue);
 		}
 		else if (GC->rtcc->GZGENCSN.TPIDefinition == 4)
 		{
-			skp->Text(1 * W / 16, 10 * H / 14, "Target Day/Night Time", 21);
+			page.Text(1 * W / 16, 10 * H / 14, "Target Day/Night Time", 21);
 			sprintf_s(Buffer, "%.1f min", GC->rtcc->GZGENCSN.TPIDefinitionValue / 60.0);
 		}
 		else if (GC->rtcc->GZGENCSN.TPIDefinition == 5)
 		{
-			skp->Text(1 * W / 16, 10 * H / 14, "Target Longitude", 16);
+			page.Text(1 * W / 16, 10 * H / 14, "Target Longitude", 16);
 			sprintf_s(Buffer, "%.1f", GC->rtcc->GZGENCSN.TPIDefinitionValue*DEG);
 		}
-		skp->Text(1 * W / 16, 12 * H / 14, Buffer, strlen(Buffer));
+		page.Text(1 * W / 16, 12 * H / 14, Buffer, strlen(Buffer));
 
 		if (GC->rtcc->med_k01.I_CDH == 1)
 		{
-			skp->Text(8 * W / 16, 2 * H / 14, "CDH at upcoming apsis:", 21);
+			page.Text(8 * W / 16, 2 * H / 14, "CDH at upcoming apsis:", 21);
 			sprintf_s(Buffer, "%d", GC->rtcc->med_k01.CDH_Apsis);
 		}
 		else if (GC->rtcc->med_k01.I_CDH == 2)
 		{
-			skp->Text(8 * W / 16, 2 * H / 14, "CDH on time:", 12);
+			page.Text(8 * W / 16, 2 * H / 14, "CDH on time:", 12);
 			GET_Display3(Buffer, GC->rtcc->med_k01.CDH_Time);
 		}
 		else
 		{
-			skp->Text(8 * W / 16, 2 * H / 14, "Angle from CSI to CDH:", 22);
+			page.Text(8 * W / 16, 2 * H / 14, "Angle from CSI to CDH:", 22);
 			sprintf_s(Buffer, "%.1lf", GC->rtcc->med_k01.CDH_Angle*DEG);
 		}
 
-		skp->Text(8 * W / 16, 4 * H / 14, Buffer, strlen(Buffer));
+		page.Text(8 * W / 16, 4 * H / 14, Buffer, strlen(Buffer));
 	}
 	else if (screen == 70)
 	{
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
-		skp->Text(4 * W / 8, 1 * H / 14, "DKI Initialization (MED K05)", 28);
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
-		sprintf_s(Buffer, "%.1f NM", GC->rtcc->GZGENCSN.DKIDeltaH / 1852.0);
-		skp->Text(1 * W / 16, 2 * H / 14, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.2f", GC->rtcc->GZGENCSN.DKIElevationAngle*DEG);
-		skp->Text(1 * W / 16, 4 * H / 14, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.2f", GC->rtcc->GZGENCSN.DKITerminalPhaseAngle*DEG);
-		skp->Text(1 * W / 16, 6 * H / 14, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.1f NM", GC->rtcc->GZGENCSN.DKIMinPerigee / 1852.0);
-		skp->Text(1 * W / 16, 8 * H / 14, Buffer, strlen(Buffer));
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
+		page.Text(4 * W / 8, 1 * H / 14, "DKI Initialization (MED K05)", 28);
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
+		page.Printf(1 * W / 16, 2 * H / 14, "%.1f NM", GC->rtcc->GZGENCSN.DKIDeltaH / 1852.0);
+		page.Printf(1 * W / 16, 4 * H / 14, "%.2f", GC->rtcc->GZGENCSN.DKIElevationAngle*DEG);
+		page.Printf(1 * W / 16, 6 * H / 14, "%.2f", GC->rtcc->GZGENCSN.DKITerminalPhaseAngle*DEG);
+		page.Printf(1 * W / 16, 8 * H / 14, "%.1f NM", GC->rtcc->GZGENCSN.DKIMinPerigee / 1852.0);
 	}
 	else if (screen == 75)
 	{
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
-		skp->Text(4 * W / 8, 1 * H / 14, "ON LINE MONITOR (MSK 1629)", 28);
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
-		skp->SetFont(font2);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
+		page.Text(4 * W / 8, 1 * H / 14, "ON LINE MONITOR (MSK 1629)", 28);
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
+		page.SetFont(font2);
 
 		unsigned line = 0;
 
@@ -6373,7 +5519,7 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			for (unsigned j = 0;j < GC->rtcc->RTCCONLINEMON.data[i].message.size();j++)
 			{
 				sprintf(Buffer, GC->rtcc->RTCCONLINEMON.data[i].message[j].c_str());
-				skp->Text(1 * W / 32, (4 + line) * H / 32, Buffer, strlen(Buffer));
+				page.Text(1 * W / 32, (4 + line) * H / 32, Buffer, strlen(Buffer));
 				line++;
 				if (line >= 28)
 				{
@@ -6389,50 +5535,46 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 	}
 	else if (screen == 76)
 	{
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
 		if (GC->rtcc->med_m78.Type)
 		{
-			skp->Text(4 * W / 8, 1 * H / 14, "LOI Transfer (MED M78)", 22);
+			page.Text(4 * W / 8, 1 * H / 14, "LOI Transfer (MED M78)", 22);
 		}
 		else
 		{
-			skp->Text(4 * W / 8, 1 * H / 14, "MCC Transfer (MED M78)", 22);
+			page.Text(4 * W / 8, 1 * H / 14, "MCC Transfer (MED M78)", 22);
 		}
 
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
 
 		if (GC->MissionPlanningActive)
 		{
 			if (GC->rtcc->med_m78.Table == 1)
 			{
-				skp->Text(1 * W / 16, 2 * H / 14, "CSM", 3);
+				page.Text(1 * W / 16, 2 * H / 14, "CSM", 3);
 			}
 			else
 			{
-				skp->Text(1 * W / 16, 2 * H / 14, "LEM", 3);
+				page.Text(1 * W / 16, 2 * H / 14, "LEM", 3);
 			}
 
 			if (GC->rtcc->med_m78.ReplaceCode == 0)
 			{
-				skp->Text(1 * W / 16, 4 * H / 14, "Don't replace", 13);
+				page.Text(1 * W / 16, 4 * H / 14, "Don't replace", 13);
 			}
 			else
 			{
-				sprintf_s(Buffer, "%d", GC->rtcc->med_m78.ReplaceCode);
-				skp->Text(1 * W / 16, 4 * H / 14, Buffer, strlen(Buffer));
+				page.Printf(1 * W / 16, 4 * H / 14, "%d", GC->rtcc->med_m78.ReplaceCode);
 			}
 		}
 
-		sprintf_s(Buffer, "%d", GC->rtcc->med_m78.ManeuverNumber);
-		skp->Text(1 * W / 16, 6 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(1 * W / 16, 6 * H / 14, "%d", GC->rtcc->med_m78.ManeuverNumber);
 
-		ThrusterName(Buffer, GC->rtcc->med_m78.Thruster);
-		skp->Text(1 * W / 16, 8 * H / 14, Buffer, strlen(Buffer));
+		page.Format(1 * W / 16, 8 * H / 14, this, &ApolloRTCCMFD::ThrusterName, GC->rtcc->med_m78.Thruster);
 
 		if (GC->MissionPlanningActive)
 		{
-			MPTAttitudeName(Buffer, GC->rtcc->med_m78.Attitude);
-			skp->Text(1 * W / 16, 10 * H / 14, Buffer, strlen(Buffer));
+			page.Format(1 * W / 16, 10 * H / 14, this, &ApolloRTCCMFD::MPTAttitudeName, GC->rtcc->med_m78.Attitude);
 
 			if (GC->rtcc->med_m78.UllageDT < 0)
 			{
@@ -6449,199 +5591,167 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 					sprintf_s(Buffer, "2 quads, %.1f s", GC->rtcc->med_m78.UllageDT);
 				}
 			}
-			skp->Text(1 * W / 16, 12 * H / 14, Buffer, strlen(Buffer));
+			page.Text(1 * W / 16, 12 * H / 14, Buffer, strlen(Buffer));
 
 			if (GC->rtcc->med_m78.Iteration)
 			{
-				skp->Text(10 * W / 16, 2 * H / 14, "Iterate", 7);
+				page.Text(10 * W / 16, 2 * H / 14, "Iterate", 7);
 			}
 			else
 			{
-				skp->Text(10 * W / 16, 2 * H / 14, "Don't iterate", 13);
+				page.Text(10 * W / 16, 2 * H / 14, "Don't iterate", 13);
 			}
 
 			if (GC->rtcc->med_m78.Thruster == RTCC_ENGINETYPE_LMDPS)
 			{
-				sprintf_s(Buffer, "%lf s", GC->rtcc->med_m78.TenPercentDT);
-				skp->Text(10 * W / 16, 4 * H / 14, Buffer, strlen(Buffer));
+				page.Printf(10 * W / 16, 4 * H / 14, "%lf s", GC->rtcc->med_m78.TenPercentDT);
 
-				sprintf_s(Buffer, "%lf", GC->rtcc->med_m78.DPSThrustFactor);
-				skp->Text(10 * W / 16, 6 * H / 14, Buffer, strlen(Buffer));
+				page.Printf(10 * W / 16, 6 * H / 14, "%lf", GC->rtcc->med_m78.DPSThrustFactor);
 			}
 
 			if (GC->rtcc->med_m78.TimeFlag)
 			{
-				skp->Text(10 * W / 16, 8 * H / 14, "Impulsive TIG", 13);
+				page.Text(10 * W / 16, 8 * H / 14, "Impulsive TIG", 13);
 			}
 			else
 			{
-				skp->Text(10 * W / 16, 8 * H / 14, "Optimum TIG", 11);
+				page.Text(10 * W / 16, 8 * H / 14, "Optimum TIG", 11);
 			}
 		}
 
 		if (GC->MissionPlanningActive == false)
 		{
-			GET_Display(Buffer, G->P30TIG);
-			skp->Text(5 * W / 8, 17 * H / 21, Buffer, strlen(Buffer));
+			page.Format(5 * W / 8, 17 * H / 21, this, &ApolloRTCCMFD::GET_Display, G->P30TIG, true);
 
-			skp->Text(5 * W / 8, 18 * H / 21, "DVX", 3);
-			skp->Text(5 * W / 8, 19 * H / 21, "DVY", 3);
-			skp->Text(5 * W / 8, 20 * H / 21, "DVZ", 3);
+			page.Text(5 * W / 8, 18 * H / 21, "DVX", 3);
+			page.Text(5 * W / 8, 19 * H / 21, "DVY", 3);
+			page.Text(5 * W / 8, 20 * H / 21, "DVZ", 3);
 
-			AGC_Display(Buffer, G->dV_LVLH.x / 0.3048);
-			skp->Text(6 * W / 8, 18 * H / 21, Buffer, strlen(Buffer));
-			AGC_Display(Buffer, G->dV_LVLH.y / 0.3048);
-			skp->Text(6 * W / 8, 19 * H / 21, Buffer, strlen(Buffer));
-			AGC_Display(Buffer, G->dV_LVLH.z / 0.3048);
-			skp->Text(6 * W / 8, 20 * H / 21, Buffer, strlen(Buffer));
+			page.Format(6 * W / 8, 18 * H / 21, this, &ApolloRTCCMFD::AGC_Display, G->dV_LVLH.x / 0.3048);
+			page.Format(6 * W / 8, 19 * H / 21, this, &ApolloRTCCMFD::AGC_Display, G->dV_LVLH.y / 0.3048);
+			page.Format(6 * W / 8, 20 * H / 21, this, &ApolloRTCCMFD::AGC_Display, G->dV_LVLH.z / 0.3048);
 		}
 	}
 	else if (screen == 77)
 	{
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
-		skp->Text(4 * W / 8, 1 * H / 14, "SKELETON FLIGHT PLAN TABLE (MSK 1597)", 37);
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
-		skp->SetFont(font2);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
+		page.Text(4 * W / 8, 1 * H / 14, "SKELETON FLIGHT PLAN TABLE (MSK 1597)", 37);
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
+		page.SetFont(font2);
 
 		int i = GC->rtcc->PZSFPTAB.DisplayBlockNum - 1;
 
-		skp->Text(2 * W / 32, 5 * H / 35, "BLOCK NUMBER", 12);
-		skp->Text(2 * W / 32, 6 * H / 35, "01-GMT TIME FLAG", 16);
-		skp->Text(2 * W / 32, 7 * H / 35, "02-MODE", 7);
-		skp->Text(2 * W / 32, 8 * H / 35, "03-GMT OF TLI PERICYN.", 22);
-		skp->Text(2 * W / 32, 9 * H / 35, "04-LAT. OF TLI PERICYN.", 23);
-		skp->Text(2 * W / 32, 10 * H / 35, "05-LONG. OF TLI PERICYN.", 24);
-		skp->Text(2 * W / 32, 11 * H / 35, "06-HEIGHT OF TLI PERICYN.", 25);
-		skp->Text(2 * W / 32, 12 * H / 35, "07-GMT OF LOI PERICYN.", 22);
-		skp->Text(2 * W / 32, 13 * H / 35, "08-LAT. OF LOI PERICYN.", 23);
-		skp->Text(2 * W / 32, 14 * H / 35, "09-LONG. OF LOI PERICYN.", 24);
-		skp->Text(2 * W / 32, 15 * H / 35, "10-HEIGHT OF LOI PERICYN.", 25);
-		skp->Text(2 * W / 32, 16 * H / 35, "11-GET OF TLI IGNITION", 22);
-		skp->Text(2 * W / 32, 17 * H / 35, "12-GMT OF NODE", 14);
-		skp->Text(2 * W / 32, 18 * H / 35, "13-LAT. OF NODE", 15);
-		skp->Text(2 * W / 32, 19 * H / 35, "14-LONG. OF NODE", 16);
-		skp->Text(2 * W / 32, 20 * H / 35, "15-HEIGHT OF NODE", 17);
-		skp->Text(2 * W / 32, 21 * H / 35, "16-DELTA AZIMUTH OF LOI", 23);
-		skp->Text(2 * W / 32, 22 * H / 35, "17-FLIGHT PATH ANGLE AT LOI", 27);
-		skp->Text(2 * W / 32, 23 * H / 35, "18-DELTA TIME OF LPO", 20);
-		skp->Text(2 * W / 32, 24 * H / 35, "19-DELTA TIME OF LLS", 20);
-		skp->Text(2 * W / 32, 25 * H / 35, "20-AZIMUTH OF LLS", 17);
-		skp->Text(2 * W / 32, 26 * H / 35, "21-LAT. OF LLS", 14);
-		skp->Text(2 * W / 32, 27 * H / 35, "22-LONG. OF LLS", 15);
-		skp->Text(2 * W / 32, 28 * H / 35, "23-RADIUS OF LLS", 16);
-		skp->Text(2 * W / 32, 29 * H / 35, "24-DELTA AZIMUTH OF TEI", 23);
-		skp->Text(2 * W / 32, 30 * H / 35, "25-DELTA V OF TEI", 17);
-		skp->Text(2 * W / 32, 31 * H / 35, "26-DELTA TIME OF TEI", 20);
-		//skp->Text(2 * W / 32, 32 * H / 35, "27-INCLINATION OF FREE RET.", 27);
-		//skp->Text(2 * W / 32, 33 * H / 35, "28-DELTA T OF UPDATED NOM.", 26);
-
-		skp->SetTextAlign(oapi::Sketchpad::RIGHT);
+		page.Text(2 * W / 32, 5 * H / 35, "BLOCK NUMBER", 12);
+		page.Text(2 * W / 32, 6 * H / 35, "01-GMT TIME FLAG", 16);
+		page.Text(2 * W / 32, 7 * H / 35, "02-MODE", 7);
+		page.Text(2 * W / 32, 8 * H / 35, "03-GMT OF TLI PERICYN.", 22);
+		page.Text(2 * W / 32, 9 * H / 35, "04-LAT. OF TLI PERICYN.", 23);
+		page.Text(2 * W / 32, 10 * H / 35, "05-LONG. OF TLI PERICYN.", 24);
+		page.Text(2 * W / 32, 11 * H / 35, "06-HEIGHT OF TLI PERICYN.", 25);
+		page.Text(2 * W / 32, 12 * H / 35, "07-GMT OF LOI PERICYN.", 22);
+		page.Text(2 * W / 32, 13 * H / 35, "08-LAT. OF LOI PERICYN.", 23);
+		page.Text(2 * W / 32, 14 * H / 35, "09-LONG. OF LOI PERICYN.", 24);
+		page.Text(2 * W / 32, 15 * H / 35, "10-HEIGHT OF LOI PERICYN.", 25);
+		page.Text(2 * W / 32, 16 * H / 35, "11-GET OF TLI IGNITION", 22);
+		page.Text(2 * W / 32, 17 * H / 35, "12-GMT OF NODE", 14);
+		page.Text(2 * W / 32, 18 * H / 35, "13-LAT. OF NODE", 15);
+		page.Text(2 * W / 32, 19 * H / 35, "14-LONG. OF NODE", 16);
+		page.Text(2 * W / 32, 20 * H / 35, "15-HEIGHT OF NODE", 17);
+		page.Text(2 * W / 32, 21 * H / 35, "16-DELTA AZIMUTH OF LOI", 23);
+		page.Text(2 * W / 32, 22 * H / 35, "17-FLIGHT PATH ANGLE AT LOI", 27);
+		page.Text(2 * W / 32, 23 * H / 35, "18-DELTA TIME OF LPO", 20);
+		page.Text(2 * W / 32, 24 * H / 35, "19-DELTA TIME OF LLS", 20);
+		page.Text(2 * W / 32, 25 * H / 35, "20-AZIMUTH OF LLS", 17);
+		page.Text(2 * W / 32, 26 * H / 35, "21-LAT. OF LLS", 14);
+		page.Text(2 * W / 32, 27 * H / 35, "22-LONG. OF LLS", 15);
+		page.Text(2 * W / 32, 28 * H / 35, "23-RADIUS OF LLS", 16);
+		page.Text(2 * W / 32, 29 * H / 35, "24-DELTA AZIMUTH OF TEI", 23);
+		page.Text(2 * W / 32, 30 * H / 35, "25-DELTA V OF TEI", 17);
+		page.Text(2 * W / 32, 31 * H / 35, "26-DELTA TIME OF TEI", 20);
+		//page.Text(2 * W / 32, 32 * H / 35, "27-INCLINATION OF FREE RET.", 27);
+		//page.Text(2 * W / 32, 33 * H / 35, "28-DELTA T OF UPDATED NOM.", 26);
+
+		page.SetTextAlign(oapi::Sketchpad::RIGHT);
 
 		if (i == 0)
 		{
-			skp->Text(25 * W / 32, 5 * H / 35, "1 (PREFLIGHT)", 13);
-		}
-		else
-		{
-			skp->Text(25 * W / 32, 5 * H / 35, "2 (NOMINAL)", 11);
-		}
-		GET_Display2(Buffer, GC->rtcc->PZSFPTAB.blocks[i].GMTTimeFlag);
-		skp->Text(25 * W / 32, 6 * H / 35, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%d", GC->rtcc->PZSFPTAB.blocks[i].mode);
-		skp->Text(25 * W / 32, 7 * H / 35, Buffer, strlen(Buffer));
-		GET_Display2(Buffer, GC->rtcc->PZSFPTAB.blocks[i].GMT_pc1);
-		skp->Text(25 * W / 32, 8 * H / 35, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.3lf", GC->rtcc->PZSFPTAB.blocks[i].lat_pc1*DEG);
-		skp->Text(25 * W / 32, 9 * H / 35, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.3lf", GC->rtcc->PZSFPTAB.blocks[i].lng_pc1*DEG);
-		skp->Text(25 * W / 32, 10 * H / 35, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.3lf", GC->rtcc->PZSFPTAB.blocks[i].h_pc1 / 1852.0);
-		skp->Text(25 * W / 32, 11 * H / 35, Buffer, strlen(Buffer));
-		GET_Display2(Buffer, GC->rtcc->PZSFPTAB.blocks[i].GMT_pc2);
-		skp->Text(25 * W / 32, 12 * H / 35, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.3lf", GC->rtcc->PZSFPTAB.blocks[i].lat_pc2*DEG);
-		skp->Text(25 * W / 32, 13 * H / 35, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.3lf", GC->rtcc->PZSFPTAB.blocks[i].lng_pc2*DEG);
-		skp->Text(25 * W / 32, 14 * H / 35, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.3lf", GC->rtcc->PZSFPTAB.blocks[i].h_pc2 / 1852.0);
-		skp->Text(25 * W / 32, 15 * H / 35, Buffer, strlen(Buffer));
-		GET_Display2(Buffer, GC->rtcc->PZSFPTAB.blocks[i].GET_TLI);
-		skp->Text(25 * W / 32, 16 * H / 35, Buffer, strlen(Buffer));
-		GET_Display2(Buffer, GC->rtcc->PZSFPTAB.blocks[i].GMT_nd);
-		skp->Text(25 * W / 32, 17 * H / 35, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.3lf", GC->rtcc->PZSFPTAB.blocks[i].lat_nd*DEG);
-		skp->Text(25 * W / 32, 18 * H / 35, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.3lf", GC->rtcc->PZSFPTAB.blocks[i].lng_nd*DEG);
-		skp->Text(25 * W / 32, 19 * H / 35, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.3lf", GC->rtcc->PZSFPTAB.blocks[i].h_nd / 1852.0);
-		skp->Text(25 * W / 32, 20 * H / 35, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.3lf", GC->rtcc->PZSFPTAB.blocks[i].dpsi_loi*DEG);
-		skp->Text(25 * W / 32, 21 * H / 35, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.3lf", GC->rtcc->PZSFPTAB.blocks[i].gamma_loi*DEG);
-		skp->Text(25 * W / 32, 22 * H / 35, Buffer, strlen(Buffer));
-		GET_Display2(Buffer, GC->rtcc->PZSFPTAB.blocks[i].T_lo);
-		skp->Text(25 * W / 32, 23 * H / 35, Buffer, strlen(Buffer));
-		GET_Display2(Buffer, GC->rtcc->PZSFPTAB.blocks[i].dt_lls);
-		skp->Text(25 * W / 32, 24 * H / 35, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.3lf", GC->rtcc->PZSFPTAB.blocks[i].psi_lls*DEG);
-		skp->Text(25 * W / 32, 25 * H / 35, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.3lf", GC->rtcc->PZSFPTAB.blocks[i].lat_lls*DEG);
-		skp->Text(25 * W / 32, 26 * H / 35, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.3lf", GC->rtcc->PZSFPTAB.blocks[i].lng_lls*DEG);
-		skp->Text(25 * W / 32, 27 * H / 35, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.3lf", GC->rtcc->PZSFPTAB.blocks[i].rad_lls / 1852.0);
-		skp->Text(25 * W / 32, 28 * H / 35, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.3lf", GC->rtcc->PZSFPTAB.blocks[i].dpsi_tei*DEG);
-		skp->Text(25 * W / 32, 29 * H / 35, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.3lf", GC->rtcc->PZSFPTAB.blocks[i].dv_tei / 0.3048);
-		skp->Text(25 * W / 32, 30 * H / 35, Buffer, strlen(Buffer));
-		GET_Display2(Buffer, GC->rtcc->PZSFPTAB.blocks[i].T_te);
-		skp->Text(25 * W / 32, 31 * H / 35, Buffer, strlen(Buffer));
+			page.Text(25 * W / 32, 5 * H / 35, "1 (PREFLIGHT)", 13);
+		}
+		else
+		{
+			page.Text(25 * W / 32, 5 * H / 35, "2 (NOMINAL)", 11);
+		}
+		page.Format(25 * W / 32, 6 * H / 35, this, &ApolloRTCCMFD::GET_Display2, GC->rtcc->PZSFPTAB.blocks[i].GMTTimeFlag);
+		page.Printf(25 * W / 32, 7 * H / 35, "%d", GC->rtcc->PZSFPTAB.blocks[i].mode);
+		page.Format(25 * W / 32, 8 * H / 35, this, &ApolloRTCCMFD::GET_Display2, GC->rtcc->PZSFPTAB.blocks[i].GMT_pc1);
+		page.Printf(25 * W / 32, 9 * H / 35, "%.3lf", GC->rtcc->PZSFPTAB.blocks[i].lat_pc1*DEG);
+		page.Printf(25 * W / 32, 10 * H / 35, "%.3lf", GC->rtcc->PZSFPTAB.blocks[i].lng_pc1*DEG);
+		page.Printf(25 * W / 32, 11 * H / 35, "%.3lf", GC->rtcc->PZSFPTAB.blocks[i].h_pc1 / 1852.0);
+		page.Format(25 * W / 32, 12 * H / 35, this, &ApolloRTCCMFD::GET_Display2, GC->rtcc->PZSFPTAB.blocks[i].GMT_pc2);
+		page.Printf(25 * W / 32, 13 * H / 35, "%.3lf", GC->rtcc->PZSFPTAB.blocks[i].lat_pc2*DEG);
+		page.Printf(25 * W / 32, 14 * H / 35, "%.3lf", GC->rtcc->PZSFPTAB.blocks[i].lng_pc2*DEG);
+		page.Printf(25 * W / 32, 15 * H / 35, "%.3lf", GC->rtcc->PZSFPTAB.blocks[i].h_pc2 / 1852.0);
+		page.Format(25 * W / 32, 16 * H / 35, this, &ApolloRTCCMFD::GET_Display2, GC->rtcc->PZSFPTAB.blocks[i].GET_TLI);
+		page.Format(25 * W / 32, 17 * H / 35, this, &ApolloRTCCMFD::GET_Display2, GC->rtcc->PZSFPTAB.blocks[i].GMT_nd);
+		page.Printf(25 * W / 32, 18 * H / 35, "%.3lf", GC->rtcc->PZSFPTAB.blocks[i].lat_nd*DEG);
+		page.Printf(25 * W / 32, 19 * H / 35, "%.3lf", GC->rtcc->PZSFPTAB.blocks[i].lng_nd*DEG);
+		page.Printf(25 * W / 32, 20 * H / 35, "%.3lf", GC->rtcc->PZSFPTAB.blocks[i].h_nd / 1852.0);
+		page.Printf(25 * W / 32, 21 * H / 35, "%.3lf", GC->rtcc->PZSFPTAB.blocks[i].dpsi_loi*DEG);
+		page.Printf(25 * W / 32, 22 * H / 35, "%.3lf", GC->rtcc->PZSFPTAB.blocks[i].gamma_loi*DEG);
+		page.Format(25 * W / 32, 23 * H / 35, this, &ApolloRTCCMFD::GET_Display2, GC->rtcc->PZSFPTAB.blocks[i].T_lo);
+		page.Format(25 * W / 32, 24 * H / 35, this, &ApolloRTCCMFD::GET_Display2, GC->rtcc->PZSFPTAB.blocks[i].dt_lls);
+		page.Printf(25 * W / 32, 25 * H / 35, "%.3lf", GC->rtcc->PZSFPTAB.blocks[i].psi_lls*DEG);
+		page.Printf(25 * W / 32, 26 * H / 35, "%.3lf", GC->rtcc->PZSFPTAB.blocks[i].lat_lls*DEG);
+		page.Printf(25 * W / 32, 27 * H / 35, "%.3lf", GC->rtcc->PZSFPTAB.blocks[i].lng_lls*DEG);
+		page.Printf(25 * W / 32, 28 * H / 35, "%.3lf", GC->rtcc->PZSFPTAB.blocks[i].rad_lls / 1852.0);
+		page.Printf(25 * W / 32, 29 * H / 35, "%.3lf", GC->rtcc->PZSFPTAB.blocks[i].dpsi_tei*DEG);
+		page.Printf(25 * W / 32, 30 * H / 35, "%.3lf", GC->rtcc->PZSFPTAB.blocks[i].dv_tei / 0.3048);
+		page.Format(25 * W / 32, 31 * H / 35, this, &ApolloRTCCMFD::GET_Display2, GC->rtcc->PZSFPTAB.blocks[i].T_te);
 	}
 	else if (screen == 78)
 	{
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
-		skp->Text(4 * W / 8, 1 * H / 14, "MIDCOURSE TRADEOFF (MSK 0079)", 29);
-		skp->SetFont(font2);
-		skp->SetPen(pen2);
-
-		skp->Text(22 * W / 64, 5 * H / 32, "1", 1);
-		skp->Text(33 * W / 64, 5 * H / 32, "2", 1);
-		skp->Text(44 * W / 64, 5 * H / 32, "3", 1);
-		skp->Text(55 * W / 64, 5 * H / 32, "4", 1);
-		skp->Line(16 * W / 64, 13 * H / 64, 60 * W / 64, 13 * H / 64);
-		skp->Line(16 * W / 64, 13 * H / 64, 16 * W / 64, 31 * H / 32);
-		skp->Line(27 * W / 64, 13 * H / 64, 27 * W / 64, 31 * H / 32);
-		skp->Line(38 * W / 64, 13 * H / 64, 38 * W / 64, 31 * H / 32);
-		skp->Line(49 * W / 64, 13 * H / 64, 49 * W / 64, 31 * H / 32);
-		skp->Line(60 * W / 64, 13 * H / 64, 60 * W / 64, 31 * H / 32);
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
-		skp->Text(1 * W / 32, 5 * H / 32, "COLUMN", 6);
-		skp->Text(1 * W / 32, 7 * H / 32, "MODE", 4);
-		skp->Text(1 * W / 32, 8 * H / 32, "RETURN", 6);
-		skp->Text(1 * W / 32, 9 * H / 32, "AZ MIN", 6);
-		skp->Text(1 * W / 32, 10 * H / 32, "AZ MAX", 6);
-		skp->Text(1 * W / 32, 11 * H / 32, "WEIGHT", 6);
-		skp->Text(1 * W / 32, 12 * H / 32, "GETMCC", 6);
-		skp->Text(1 * W / 32, 13 * H / 32, "DV MCC", 6);
-		skp->Text(1 * W / 32, 14 * H / 32, "YAW MCC", 7);
-		skp->Text(1 * W / 32, 15 * H / 32, "H PYCN", 6);
-		skp->Text(1 * W / 32, 16 * H / 32, "GET LOI", 7);
-		skp->Text(1 * W / 32, 17 * H / 32, "DV LOI", 6);
-		skp->Text(1 * W / 32, 18 * H / 32, "AZ ACT", 6);
-		skp->Text(1 * W / 32, 19 * H / 32, "I FR", 4);
-		skp->Text(1 * W / 32, 20 * H / 32, "I PR", 4);
-		skp->Text(1 * W / 32, 21 * H / 32, "V EI", 4);
-		skp->Text(1 * W / 32, 22 * H / 32, "G EI", 4);
-		skp->Text(1 * W / 32, 23 * H / 32, "GETTEI", 6);
-		skp->Text(1 * W / 32, 24 * H / 32, "DV TEI", 6);
-		skp->Text(1 * W / 32, 25 * H / 32, "DV REM", 6);
-		skp->Text(1 * W / 32, 26 * H / 32, "GET LC", 6);
-		skp->Text(1 * W / 32, 27 * H / 32, "LAT IP", 6);
-		skp->Text(1 * W / 32, 28 * H / 32, "LNG IP", 6);
-		skp->Text(1 * W / 32, 29 * H / 32, "DV PC", 5);
-
-		skp->SetTextAlign(oapi::Sketchpad::RIGHT);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
+		page.Text(4 * W / 8, 1 * H / 14, "MIDCOURSE TRADEOFF (MSK 0079)", 29);
+		page.SetFont(font2);
+		page.SetPen(pen2);
+
+		page.Text(22 * W / 64, 5 * H / 32, "1", 1);
+		page.Text(33 * W / 64, 5 * H / 32, "2", 1);
+		page.Text(44 * W / 64, 5 * H / 32, "3", 1);
+		page.Text(55 * W / 64, 5 * H / 32, "4", 1);
+		page.Line(16 * W / 64, 13 * H / 64, 60 * W / 64, 13 * H / 64);
+		page.Line(16 * W / 64, 13 * H / 64, 16 * W / 64, 31 * H / 32);
+		page.Line(27 * W / 64, 13 * H / 64, 27 * W / 64, 31 * H / 32);
+		page.Line(38 * W / 64, 13 * H / 64, 38 * W / 64, 31 * H / 32);
+		page.Line(49 * W / 64, 13 * H / 64, 49 * W / 64, 31 * H / 32);
+		page.Line(60 * W / 64, 13 * H / 64, 60 * W / 64, 31 * H / 32);
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
+		page.Text(1 * W / 32, 5 * H / 32, "COLUMN", 6);
+		page.Text(1 * W / 32, 7 * H / 32, "MODE", 4);
+		page.Text(1 * W / 32, 8 * H / 32, "RETURN", 6);
+		page.Text(1 * W / 32, 9 * H / 32, "AZ MIN", 6);
+		page.Text(1 * W / 32, 10 * H / 32, "AZ MAX", 6);
+		page.Text(1 * W / 32, 11 * H / 32, "WEIGHT", 6);
+		page.Text(1 * W / 32, 12 * H / 32, "GETMCC", 6);
+		page.Text(1 * W / 32, 13 * H / 32, "DV MCC", 6);
+		page.Text(1 * W / 32, 14 * H / 32, "YAW MCC", 7);
+		page.Text(1 * W / 32, 15 * H / 32, "H PYCN", 6);
+		page.Text(1 * W / 32, 16 * H / 32, "GET LOI", 7);
+		page.Text(1 * W / 32, 17 * H / 32, "DV LOI", 6);
+		page.Text(1 * W / 32, 18 * H / 32, "AZ ACT", 6);
+		page.Text(1 * W / 32, 19 * H / 32, "I FR", 4);
+		page.Text(1 * W / 32, 20 * H / 32, "I PR", 4);
+		page.Text(1 * W / 32, 21 * H / 32, "V EI", 4);
+		page.Text(1 * W / 32, 22 * H / 32, "G EI", 4);
+		page.Text(1 * W / 32, 23 * H / 32, "GETTEI", 6);
+		page.Text(1 * W / 32, 24 * H / 32, "DV TEI", 6);
+		page.Text(1 * W / 32, 25 * H / 32, "DV REM", 6);
+		page.Text(1 * W / 32, 26 * H / 32, "GET LC", 6);
+		page.Text(1 * W / 32, 27 * H / 32, "LAT IP", 6);
+		page.Text(1 * W / 32, 28 * H / 32, "LNG IP", 6);
+		page.Text(1 * W / 32, 29 * H / 32, "DV PC", 5);
+
+		page.SetTextAlign(oapi::Sketchpad::RIGHT);
 
 		for (int i = 0;i < 4;i++)
 		{
@@ -6650,8 +5760,7 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 				continue;
 			}
 
-			sprintf_s(Buffer, "%d", GC->rtcc->PZMCCDIS.data[i].Mode);
-			skp->Text((26 + 11 * i) * W / 64, 7 * H / 32, Buffer, strlen(Buffer));
+			page.Printf((26 + 11 * i) * W / 64, 7 * H / 32, "%d", GC->rtcc->PZMCCDIS.data[i].Mode);
 			if (GC->rtcc->PZMCCDIS.data[i].Return == 0)
 			{
 				sprintf_s(Buffer, "N/A");
@@ -6664,216 +5773,160 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			{
 				sprintf_s(Buffer, "FREE");
 			}
-			skp->Text((26 + 11 * i) * W / 64, 8 * H / 32, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.3lf", GC->rtcc->PZMCCDIS.data[i].AZ_min*DEG);
-			skp->Text((26 + 11 * i) * W / 64, 9 * H / 32, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.3lf", GC->rtcc->PZMCCDIS.data[i].AZ_max*DEG);
-			skp->Text((26 + 11 * i) * W / 64, 10 * H / 32, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.0lf", (GC->rtcc->PZMCCDIS.data[i].CSMWT + GC->rtcc->PZMCCDIS.data[i].LMWT) / 0.45359237);
-			skp->Text((26 + 11 * i) * W / 64, 11 * H / 32, Buffer, strlen(Buffer));
-			GET_Display(Buffer, GC->rtcc->PZMCCDIS.data[i].GET_MCC, false);
-			skp->Text((26 + 11 * i) * W / 64, 12 * H / 32, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.1lf", length(GC->rtcc->PZMCCDIS.data[i].DV_MCC) / 0.3048);
-			skp->Text((26 + 11 * i) * W / 64, 13 * H / 32, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.3lf", GC->rtcc->PZMCCDIS.data[i].YAW_MCC*DEG);
-			skp->Text((26 + 11 * i) * W / 64, 14 * H / 32, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.3lf", GC->rtcc->PZMCCDIS.data[i].h_PC / 1852.0);
-			skp->Text((26 + 11 * i) * W / 64, 15 * H / 32, Buffer, strlen(Buffer));
-			GET_Display(Buffer, GC->rtcc->PZMCCDIS.data[i].GET_LOI, false);
-			skp->Text((26 + 11 * i) * W / 64, 16 * H / 32, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.1lf", length(GC->rtcc->PZMCCDIS.data[i].DV_LOI) / 0.3048);
-			skp->Text((26 + 11 * i) * W / 64, 17 * H / 32, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.3lf", GC->rtcc->PZMCCDIS.data[i].AZ_act*DEG);
-			skp->Text((26 + 11 * i) * W / 64, 18 * H / 32, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.3lf", GC->rtcc->PZMCCDIS.data[i].incl_fr*DEG);
-			skp->Text((26 + 11 * i) * W / 64, 19 * H / 32, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.3lf", GC->rtcc->PZMCCDIS.data[i].incl_pr*DEG);
-			skp->Text((26 + 11 * i) * W / 64, 20 * H / 32, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.1lf", GC->rtcc->PZMCCDIS.data[i].v_EI / 0.3048);
-			skp->Text((26 + 11 * i) * W / 64, 21 * H / 32, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.3lf", GC->rtcc->PZMCCDIS.data[i].gamma_EI*DEG);
-			skp->Text((26 + 11 * i) * W / 64, 22 * H / 32, Buffer, strlen(Buffer));
-			GET_Display(Buffer, GC->rtcc->PZMCCDIS.data[i].GET_TEI, false);
-			skp->Text((26 + 11 * i) * W / 64, 23 * H / 32, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.1lf", length(GC->rtcc->PZMCCDIS.data[i].DV_TEI) / 0.3048);
-			skp->Text((26 + 11 * i) * W / 64, 24 * H / 32, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.1lf", GC->rtcc->PZMCCDIS.data[i].DV_REM / 0.3048);
-			skp->Text((26 + 11 * i) * W / 64, 25 * H / 32, Buffer, strlen(Buffer));
-			GET_Display(Buffer, GC->rtcc->PZMCCDIS.data[i].GET_LC, false);
-			skp->Text((26 + 11 * i) * W / 64, 26 * H / 32, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.3lf", GC->rtcc->PZMCCDIS.data[i].lat_IP*DEG);
-			skp->Text((26 + 11 * i) * W / 64, 27 * H / 32, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.3lf", GC->rtcc->PZMCCDIS.data[i].lng_IP*DEG);
-			skp->Text((26 + 11 * i) * W / 64, 28 * H / 32, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.1lf", length(GC->rtcc->PZMCCDIS.data[i].DV_LOPC / 0.3048));
-			skp->Text((26 + 11 * i) * W / 64, 29 * H / 32, Buffer, strlen(Buffer));
+			page.Text((26 + 11 * i) * W / 64, 8 * H / 32, Buffer, strlen(Buffer));
+			page.Printf((26 + 11 * i) * W / 64, 9 * H / 32, "%.3lf", GC->rtcc->PZMCCDIS.data[i].AZ_min*DEG);
+			page.Printf((26 + 11 * i) * W / 64, 10 * H / 32, "%.3lf", GC->rtcc->PZMCCDIS.data[i].AZ_max*DEG);
+			page.Printf((26 + 11 * i) * W / 64, 11 * H / 32, "%.0lf", (GC->rtcc->PZMCCDIS.data[i].CSMWT + GC->rtcc->PZMCCDIS.data[i].LMWT) / 0.45359237);
+			page.Format((26 + 11 * i) * W / 64, 12 * H / 32, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->PZMCCDIS.data[i].GET_MCC, false);
+			page.Printf((26 + 11 * i) * W / 64, 13 * H / 32, "%.1lf", length(GC->rtcc->PZMCCDIS.data[i].DV_MCC) / 0.3048);
+			page.Printf((26 + 11 * i) * W / 64, 14 * H / 32, "%.3lf", GC->rtcc->PZMCCDIS.data[i].YAW_MCC*DEG);
+			page.Printf((26 + 11 * i) * W / 64, 15 * H / 32, "%.3lf", GC->rtcc->PZMCCDIS.data[i].h_PC / 1852.0);
+			page.Format((26 + 11 * i) * W / 64, 16 * H / 32, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->PZMCCDIS.data[i].GET_LOI, false);
+			page.Printf((26 + 11 * i) * W / 64, 17 * H / 32, "%.1lf", length(GC->rtcc->PZMCCDIS.data[i].DV_LOI) / 0.3048);
+			page.Printf((26 + 11 * i) * W / 64, 18 * H / 32, "%.3lf", GC->rtcc->PZMCCDIS.data[i].AZ_act*DEG);
+			page.Printf((26 + 11 * i) * W / 64, 19 * H / 32, "%.3lf", GC->rtcc->PZMCCDIS.data[i].incl_fr*DEG);
+			page.Printf((26 + 11 * i) * W / 64, 20 * H / 32, "%.3lf", GC->rtcc->PZMCCDIS.data[i].incl_pr*DEG);
+			page.Printf((26 + 11 * i) * W / 64, 21 * H / 32, "%.1lf", GC->rtcc->PZMCCDIS.data[i].v_EI / 0.3048);
+			page.Printf((26 + 11 * i) * W / 64, 22 * H / 32, "%.3lf", GC->rtcc->PZMCCDIS.data[i].gamma_EI*DEG);
+			page.Format((26 + 11 * i) * W / 64, 23 * H / 32, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->PZMCCDIS.data[i].GET_TEI, false);
+			page.Printf((26 + 11 * i) * W / 64, 24 * H / 32, "%.1lf", length(GC->rtcc->PZMCCDIS.data[i].DV_TEI) / 0.3048);
+			page.Printf((26 + 11 * i) * W / 64, 25 * H / 32, "%.1lf", GC->rtcc->PZMCCDIS.data[i].DV_REM / 0.3048);
+			page.Format((26 + 11 * i) * W / 64, 26 * H / 32, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->PZMCCDIS.data[i].GET_LC, false);
+			page.Printf((26 + 11 * i) * W / 64, 27 * H / 32, "%.3lf", GC->rtcc->PZMCCDIS.data[i].lat_IP*DEG);
+			page.Printf((26 + 11 * i) * W / 64, 28 * H / 32, "%.3lf", GC->rtcc->PZMCCDIS.data[i].lng_IP*DEG);
+			page.Printf((26 + 11 * i) * W / 64, 29 * H / 32, "%.1lf", length(GC->rtcc->PZMCCDIS.data[i].DV_LOPC / 0.3048));
 		}
 	}
 	else if (screen == 79)
 	{
 		if (G->TLImaneuver == 0)
 		{
-			skp->Text(1 * W / 8, 2 * H / 14, "TLI (nodal)", 11);
+			page.Text(1 * W / 8, 2 * H / 14, "TLI (nodal)", 11);
 		}
 		else if (G->TLImaneuver == 1)
 		{
-			skp->Text(1 * W / 8, 2 * H / 14, "TLI (free return)", 17);
+			page.Text(1 * W / 8, 2 * H / 14, "TLI (free return)", 17);
 		}
 
-		skp->Text(4 * W / 8, 1 * H / 14, "TLI PLANNING DISPLAY (MSK 0080)", 31);
+		page.Text(4 * W / 8, 1 * H / 14, "TLI PLANNING DISPLAY (MSK 0080)", 31);
 
-		skp->Text(4 * W / 8, 6 * H / 14, "Under construction!", 19);
+		page.Text(4 * W / 8, 6 * H / 14, "Under construction!", 19);
 	}
 	else if (screen == 80)
 	{
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
-		skp->Text(4 * W / 8, 1 * H / 14, "MIDCOURSE INPUTS AND CONSTANTS", 30);
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
-		skp->SetFont(font2);
-
-		skp->Text(1 * W / 16, 4 * H / 28, "MED F22", 7);
-		skp->Text(1 * W / 16, 5 * H / 28, "Azimuth Constraints (Modes 3/5)", 31);
-		sprintf_s(Buffer, "%.2lf", GC->rtcc->PZMCCPLN.AZ_min*DEG);
-		skp->Text(2 * W / 16, 6 * H / 28, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.2lf", GC->rtcc->PZMCCPLN.AZ_max*DEG);
-		skp->Text(2 * W / 16, 7 * H / 28, Buffer, strlen(Buffer));
-
-		skp->Text(1 * W / 16, 9 * H / 28, "MED F23", 7);
-		skp->Text(1 * W / 16, 10 * H / 28, "Min/Max GET at Node (Modes 4/5)", 31);
-		GET_Display(Buffer, GC->rtcc->PZMCCPLN.TLMIN*3600.0);
-		skp->Text(2 * W / 16, 11 * H / 28, Buffer, strlen(Buffer));
-		GET_Display(Buffer, GC->rtcc->PZMCCPLN.TLMAX*3600.0);
-		skp->Text(2 * W / 16, 12 * H / 28, Buffer, strlen(Buffer));
-
-		skp->Text(1 * W / 16, 14 * H / 28, "MED F24", 7);
-		skp->Text(1 * W / 16, 15 * H / 28, "Gamma and Reentry Range", 23);
-		sprintf_s(Buffer, "%.2lf", GC->rtcc->PZMCCPLN.gamma_reentry*DEG);
-		skp->Text(2 * W / 16, 16 * H / 28, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.0lf NM", GC->rtcc->PZMCCPLN.Reentry_range);
-		skp->Text(2 * W / 16, 17 * H / 28, Buffer, strlen(Buffer));
-
-		skp->Text(1 * W / 16, 19 * H / 28, "MED F29", 7);
-		skp->Text(1 * W / 16, 20 * H / 28, "Pericynthion height limits (Mode 9)", 35);
-		sprintf_s(Buffer, "Min: %.0lf NM", GC->rtcc->PZMCCPLN.H_PCYN_MIN / 1852.0);
-		skp->Text(2 * W / 16, 21 * H / 28, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "Max: %.0lf NM", GC->rtcc->PZMCCPLN.H_PCYN_MAX / 1852.0);
-		skp->Text(2 * W / 16, 22 * H / 28, Buffer, strlen(Buffer));
-
-		skp->Text(1 * W / 16, 24 * H / 28, "Latitude Bias (Modes 8/9)", 25);
-		sprintf_s(Buffer, "%.1lf", GC->rtcc->PZMCCPLN.LATBIAS*DEG);
-		skp->Text(2 * W / 16, 25 * H / 28, Buffer, strlen(Buffer));
-
-		skp->Text(8 * W / 16, 4 * H / 28, "LOI/DOI Geometry (Modes 2/4)", 28);
-		sprintf_s(Buffer, "HALOI1 %.1lf", GC->rtcc->PZMCCPLN.H_A_LPO1 / 1852.0);
-		skp->Text(9 * W / 16, 5 * H / 28, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "HPLOI1 %.1lf", GC->rtcc->PZMCCPLN.H_P_LPO1 / 1852.0);
-		skp->Text(9 * W / 16, 6 * H / 28, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "HALOI2 %.1lf", GC->rtcc->PZMCCPLN.H_A_LPO2 / 1852.0);
-		skp->Text(9 * W / 16, 7 * H / 28, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "HPLOI2 %.2lf", GC->rtcc->PZMCCPLN.H_P_LPO2 / 1852.0);
-		skp->Text(9 * W / 16, 8 * H / 28, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "REVS1 %.2lf", GC->rtcc->PZMCCPLN.REVS1);
-		skp->Text(9 * W / 16, 9 * H / 28, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "REVS2 %d", GC->rtcc->PZMCCPLN.REVS2);
-		skp->Text(9 * W / 16, 10 * H / 28, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "SITEROT %.1lf", GC->rtcc->PZMCCPLN.SITEROT*DEG);
-		skp->Text(9 * W / 16, 11 * H / 28, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "ETA1 %.3lf", GC->rtcc->PZMCCPLN.ETA1*DEG);
-		skp->Text(9 * W / 16, 12 * H / 28, Buffer, strlen(Buffer));
-
-		skp->Text(8 * W / 16, 14 * H / 28, "Mission Constants", 17);
-		sprintf_s(Buffer, "M %d", GC->rtcc->PZMCCPLN.LOPC_M);
-		skp->Text(9 * W / 16, 15 * H / 28, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "N %d", GC->rtcc->PZMCCPLN.LOPC_N);
-		skp->Text(9 * W / 16, 16 * H / 28, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "I PR MAX %.3lf", GC->rtcc->PZMCCPLN.INCL_PR_MAX*DEG);
-		skp->Text(9 * W / 16, 17 * H / 28, Buffer, strlen(Buffer));
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
+		page.Text(4 * W / 8, 1 * H / 14, "MIDCOURSE INPUTS AND CONSTANTS", 30);
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
+		page.SetFont(font2);
+
+		page.Text(1 * W / 16, 4 * H / 28, "MED F22", 7);
+		page.Text(1 * W / 16, 5 * H / 28, "Azimuth Constraints (Modes 3/5)", 31);
+		page.Printf(2 * W / 16, 6 * H / 28, "%.2lf", GC->rtcc->PZMCCPLN.AZ_min*DEG);
+		page.Printf(2 * W / 16, 7 * H / 28, "%.2lf", GC->rtcc->PZMCCPLN.AZ_max*DEG);
+
+		page.Text(1 * W / 16, 9 * H / 28, "MED F23", 7);
+		page.Text(1 * W / 16, 10 * H / 28, "Min/Max GET at Node (Modes 4/5)", 31);
+		page.Format(2 * W / 16, 11 * H / 28, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->PZMCCPLN.TLMIN*3600.0, true);
+		page.Format(2 * W / 16, 12 * H / 28, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->PZMCCPLN.TLMAX*3600.0, true);
+
+		page.Text(1 * W / 16, 14 * H / 28, "MED F24", 7);
+		page.Text(1 * W / 16, 15 * H / 28, "Gamma and Reentry Range", 23);
+		page.Printf(2 * W / 16, 16 * H / 28, "%.2lf", GC->rtcc->PZMCCPLN.gamma_reentry*DEG);
+		page.Printf(2 * W / 16, 17 * H / 28, "%.0lf NM", GC->rtcc->PZMCCPLN.Reentry_range);
+
+		page.Text(1 * W / 16, 19 * H / 28, "MED F29", 7);
+		page.Text(1 * W / 16, 20 * H / 28, "Pericynthion height limits (Mode 9)", 35);
+		page.Printf(2 * W / 16, 21 * H / 28, "Min: %.0lf NM", GC->rtcc->PZMCCPLN.H_PCYN_MIN / 1852.0);
+		page.Printf(2 * W / 16, 22 * H / 28, "Max: %.0lf NM", GC->rtcc->PZMCCPLN.H_PCYN_MAX / 1852.0);
+
+		page.Text(1 * W / 16, 24 * H / 28, "Latitude Bias (Modes 8/9)", 25);
+		page.Printf(2 * W / 16, 25 * H / 28, "%.1lf", GC->rtcc->PZMCCPLN.LATBIAS*DEG);
+
+		page.Text(8 * W / 16, 4 * H / 28, "LOI/DOI Geometry (Modes 2/4)", 28);
+		page.Printf(9 * W / 16, 5 * H / 28, "HALOI1 %.1lf", GC->rtcc->PZMCCPLN.H_A_LPO1 / 1852.0);
+		page.Printf(9 * W / 16, 6 * H / 28, "HPLOI1 %.1lf", GC->rtcc->PZMCCPLN.H_P_LPO1 / 1852.0);
+		page.Printf(9 * W / 16, 7 * H / 28, "HALOI2 %.1lf", GC->rtcc->PZMCCPLN.H_A_LPO2 / 1852.0);
+		page.Printf(9 * W / 16, 8 * H / 28, "HPLOI2 %.2lf", GC->rtcc->PZMCCPLN.H_P_LPO2 / 1852.0);
+		page.Printf(9 * W / 16, 9 * H / 28, "REVS1 %.2lf", GC->rtcc->PZMCCPLN.REVS1);
+		page.Printf(9 * W / 16, 10 * H / 28, "REVS2 %d", GC->rtcc->PZMCCPLN.REVS2);
+		page.Printf(9 * W / 16, 11 * H / 28, "SITEROT %.1lf", GC->rtcc->PZMCCPLN.SITEROT*DEG);
+		page.Printf(9 * W / 16, 12 * H / 28, "ETA1 %.3lf", GC->rtcc->PZMCCPLN.ETA1*DEG);
+
+		page.Text(8 * W / 16, 14 * H / 28, "Mission Constants", 17);
+		page.Printf(9 * W / 16, 15 * H / 28, "M %d", GC->rtcc->PZMCCPLN.LOPC_M);
+		page.Printf(9 * W / 16, 16 * H / 28, "N %d", GC->rtcc->PZMCCPLN.LOPC_N);
+		page.Printf(9 * W / 16, 17 * H / 28, "I PR MAX %.3lf", GC->rtcc->PZMCCPLN.INCL_PR_MAX*DEG);
 
 	}
 	else if (screen == 81)
 	{
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
-		skp->Text(4 * W / 8, 1 * H / 14, "NODAL TARGET CONVERSION", 30);
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
+		page.Text(4 * W / 8, 1 * H / 14, "NODAL TARGET CONVERSION", 30);
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
 
 		if (G->NodeConvOpt)
 		{
-			skp->Text(1 * W / 16, 2 * H / 14, "Selenographic to EMP", 20);
+			page.Text(1 * W / 16, 2 * H / 14, "Selenographic to EMP", 20);
 		}
 		else
 		{
-			skp->Text(1 * W / 16, 2 * H / 14, "EMP to Selenographic", 20);
+			page.Text(1 * W / 16, 2 * H / 14, "EMP to Selenographic", 20);
 		}
 
-		GET_Display3(Buffer, G->NodeConvGET);
-		skp->Text(1 * W / 16, 4 * H / 14, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.3lf", G->NodeConvLat*DEG);
-		skp->Text(1 * W / 16, 6 * H / 14, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.3lf", G->NodeConvLng*DEG);
-		skp->Text(1 * W / 16, 8 * H / 14, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.3lf NM", G->NodeConvHeight / 1852.0);
-		skp->Text(1 * W / 16, 10 * H / 14, Buffer, strlen(Buffer));
+		page.Format(1 * W / 16, 4 * H / 14, this, &ApolloRTCCMFD::GET_Display3, G->NodeConvGET);
+		page.Printf(1 * W / 16, 6 * H / 14, "%.3lf", G->NodeConvLat*DEG);
+		page.Printf(1 * W / 16, 8 * H / 14, "%.3lf", G->NodeConvLng*DEG);
+		page.Printf(1 * W / 16, 10 * H / 14, "%.3lf NM", G->NodeConvHeight / 1852.0);
 
-		skp->Text(9 * W / 16, 8 * H / 14, "Result:", 7);
-		sprintf_s(Buffer, "%.3lf Lat", G->NodeConvResLat*DEG);
-		skp->Text(9 * W / 16, 9 * H / 14, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.3lf Lng", G->NodeConvResLng*DEG);
-		skp->Text(9 * W / 16, 10 * H / 14, Buffer, strlen(Buffer));
+		page.Text(9 * W / 16, 8 * H / 14, "Result:", 7);
+		page.Printf(9 * W / 16, 9 * H / 14, "%.3lf Lat", G->NodeConvResLat*DEG);
+		page.Printf(9 * W / 16, 10 * H / 14, "%.3lf Lng", G->NodeConvResLng*DEG);
 	}
 	else if (screen == 82)
 	{
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
-		skp->Text(4 * W / 8, 1 * H / 14, "LOI Initialization", 18);
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
-
-		sprintf_s(Buffer, "%.1lf NM", GC->rtcc->PZLOIPLN.HA_LLS);
-		skp->Text(1 * W / 16, 2 * H / 14, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.2lf NM", GC->rtcc->PZLOIPLN.HP_LLS);
-		skp->Text(1 * W / 16, 4 * H / 14, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.1lf", GC->rtcc->PZLOIPLN.DW);
-		skp->Text(1 * W / 16, 6 * H / 14, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.2lf", GC->rtcc->PZLOIPLN.REVS1);
-		skp->Text(1 * W / 16, 8 * H / 14, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%d", GC->rtcc->PZLOIPLN.REVS2);
-		skp->Text(1 * W / 16, 10 * H / 14, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.1lf", GC->rtcc->PZLOIPLN.eta_1);
-		skp->Text(1 * W / 16, 12 * H / 14, Buffer, strlen(Buffer));
-
-		sprintf_s(Buffer, "%.1lf NM", GC->rtcc->PZLOIPLN.dh_bias);
-		skp->Text(5 * W / 8, 2 * H / 14, Buffer, strlen(Buffer));
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
+		page.Text(4 * W / 8, 1 * H / 14, "LOI Initialization", 18);
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
+
+		page.Printf(1 * W / 16, 2 * H / 14, "%.1lf NM", GC->rtcc->PZLOIPLN.HA_LLS);
+		page.Printf(1 * W / 16, 4 * H / 14, "%.2lf NM", GC->rtcc->PZLOIPLN.HP_LLS);
+		page.Printf(1 * W / 16, 6 * H / 14, "%.1lf", GC->rtcc->PZLOIPLN.DW);
+		page.Printf(1 * W / 16, 8 * H / 14, "%.2lf", GC->rtcc->PZLOIPLN.REVS1);
+		page.Printf(1 * W / 16, 10 * H / 14, "%d", GC->rtcc->PZLOIPLN.REVS2);
+		page.Printf(1 * W / 16, 12 * H / 14, "%.1lf", GC->rtcc->PZLOIPLN.eta_1);
+
+		page.Printf(5 * W / 8, 2 * H / 14, "%.1lf NM", GC->rtcc->PZLOIPLN.dh_bias);
 
 		if (GC->rtcc->PZLOIPLN.PlaneSolnForInterSoln)
 		{
-			skp->Text(5 * W / 8, 4 * H / 14, "Plane solution", 18);
+			page.Text(5 * W / 8, 4 * H / 14, "Plane solution", 18);
 		}
 		else
 		{
-			skp->Text(5 * W / 8, 4 * H / 14, "Min theta solution", 18);
+			page.Text(5 * W / 8, 4 * H / 14, "Min theta solution", 18);
 		}
 	}
 	else if (screen == 83)
 	{
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
-		skp->Text(4 * W / 8, 1 * H / 14, "LUNAR ORBIT INSERTION PLANNING (MSK 0078)", 41);
-		skp->SetFont(font2);
-		skp->Text(4 * W / 8, 71 * H / 128, "INTERSECTION", 12);
-		skp->Text(4 * W / 8, 85 * H / 128, "COPLANAR", 8);
-		skp->Text(4 * W / 8, 99 * H / 128, "MIN THETA", 9);
-		skp->Text(4 * W / 8, 113 * H / 128, "PLANE", 5);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
+		page.Text(4 * W / 8, 1 * H / 14, "LUNAR ORBIT INSERTION PLANNING (MSK 0078)", 41);
+		page.SetFont(font2);
+		page.Text(4 * W / 8, 71 * H / 128, "INTERSECTION", 12);
+		page.Text(4 * W / 8, 85 * H / 128, "COPLANAR", 8);
+		page.Text(4 * W / 8, 99 * H / 128, "MIN THETA", 9);
+		page.Text(4 * W / 8, 113 * H / 128, "PLANE", 5);
 
-		skp->SetTextAlign(oapi::Sketchpad::RIGHT);
+		page.SetTextAlign(oapi::Sketchpad::RIGHT);
 
-		skp->Text(5 * W / 32, 4 * H / 32, "CSM STA", 7);
-		skp->Text(6 * W / 32, 5 * H / 32, "GET VECTOR", 10);
+		page.Text(5 * W / 32, 4 * H / 32, "CSM STA", 7);
+		page.Text(6 * W / 32, 5 * H / 32, "GET VECTOR", 10);
 
-		sprintf(Buffer, "%s", GC->rtcc->PZLRBTI.StaID.c_str());
-		skp->Text(12 * W / 32, 4 * H / 32, Buffer, strlen(Buffer));
-		GET_Display(Buffer, GC->rtcc->PZLRBTI.VectorGET, false);
-		skp->Text(12 * W / 32, 5 * H / 32, Buffer, strlen(Buffer));
+		page.Printf(12 * W / 32, 4 * H / 32, "%s", GC->rtcc->PZLRBTI.StaID.c_str());
+		page.Format(12 * W / 32, 5 * H / 32, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->PZLRBTI.VectorGET, false);
 
-		skp->Text(7 * W / 32, 7 * H / 32, "LAT LLS", 7);
-		skp->Text(7 * W / 32, 8 * H / 32, "LNG LLS", 7);
-		skp->Text(7 * W / 32, 9 * H / 32, "R LLS", 5);
+		page.Text(7 * W / 32, 7 * H / 32, "LAT LLS", 7);
+		page.Text(7 * W / 32, 8 * H / 32, "LNG LLS", 7);
+		page.Text(7 * W / 32, 9 * H / 32, "R LLS", 5);
 
 		if (GC->rtcc->PZLRBTI.lat_lls >= 0)
 		{
@@ -6883,7 +5936,7 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 		{
 			sprintf(Buffer, "%.4lfS", -GC->rtcc->PZLRBTI.lat_lls);
 		}
-		skp->Text(13 * W / 32, 7 * H / 32, Buffer, strlen(Buffer));
+		page.Text(13 * W / 32, 7 * H / 32, Buffer, strlen(Buffer));
 		if (GC->rtcc->PZLRBTI.lng_lls >= 0)
 		{
 			sprintf(Buffer, "%.4lfE", GC->rtcc->PZLRBTI.lng_lls);
@@ -6892,157 +5945,124 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 		{
 			sprintf(Buffer, "%.4lfW", -GC->rtcc->PZLRBTI.lng_lls);
 		}
-		skp->Text(13 * W / 32, 8 * H / 32, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%.4lf", GC->rtcc->PZLRBTI.R_lls);
-		skp->Text(13 * W / 32, 9 * H / 32, Buffer, strlen(Buffer));
+		page.Text(13 * W / 32, 8 * H / 32, Buffer, strlen(Buffer));
+		page.Printf(13 * W / 32, 9 * H / 32, "%.4lf", GC->rtcc->PZLRBTI.R_lls);
 
-		skp->Text(18 * W / 32, 7 * H / 32, "REVS1", 5);
-		skp->Text(18 * W / 32, 8 * H / 32, "REVS2", 5);
-		skp->Text(18 * W / 32, 9 * H / 32, "DHBIAS", 6);
+		page.Text(18 * W / 32, 7 * H / 32, "REVS1", 5);
+		page.Text(18 * W / 32, 8 * H / 32, "REVS2", 5);
+		page.Text(18 * W / 32, 9 * H / 32, "DHBIAS", 6);
 		if (GC->rtcc->PZLRBTI.planesoln)
 		{
-			skp->Text(18 * W / 32, 10 * H / 32, "PLANE", 5);
+			page.Text(18 * W / 32, 10 * H / 32, "PLANE", 5);
 		}
 		else
 		{
-			skp->Text(18 * W / 32, 10 * H / 32, "MIN THETA", 9);
+			page.Text(18 * W / 32, 10 * H / 32, "MIN THETA", 9);
 		}
 
-		sprintf(Buffer, "%.2lf", GC->rtcc->PZLRBTI.REVS1);
-		skp->Text(21 * W / 32, 7 * H / 32, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%d", GC->rtcc->PZLRBTI.REVS2);
-		skp->Text(21 * W / 32, 8 * H / 32, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%+.1lf", GC->rtcc->PZLRBTI.DHBIAS);
-		skp->Text(21 * W / 32, 9 * H / 32, Buffer, strlen(Buffer));
+		page.Printf(21 * W / 32, 7 * H / 32, "%.2lf", GC->rtcc->PZLRBTI.REVS1);
+		page.Printf(21 * W / 32, 8 * H / 32, "%d", GC->rtcc->PZLRBTI.REVS2);
+		page.Printf(21 * W / 32, 9 * H / 32, "%+.1lf", GC->rtcc->PZLRBTI.DHBIAS);
 
-		skp->Text(27 * W / 32, 7 * H / 32, "HALOI1", 6);
-		skp->Text(27 * W / 32, 8 * H / 32, "HPLOI1", 6);
-		skp->Text(27 * W / 32, 9 * H / 32, "HALOI2", 6);
-		skp->Text(27 * W / 32, 10 * H / 32, "HPLOI2", 6);
+		page.Text(27 * W / 32, 7 * H / 32, "HALOI1", 6);
+		page.Text(27 * W / 32, 8 * H / 32, "HPLOI1", 6);
+		page.Text(27 * W / 32, 9 * H / 32, "HALOI2", 6);
+		page.Text(27 * W / 32, 10 * H / 32, "HPLOI2", 6);
 
-		sprintf(Buffer, "%.1lf", GC->rtcc->PZLRBTI.HALOI1);
-		skp->Text(31 * W / 32, 7 * H / 32, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%.1lf", GC->rtcc->PZLRBTI.HPLOI1);
-		skp->Text(31 * W / 32, 8 * H / 32, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%.1lf", GC->rtcc->PZLRBTI.HALOI2);
-		skp->Text(31 * W / 32, 9 * H / 32, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%.2lf", GC->rtcc->PZLRBTI.HPLOI2);
-		skp->Text(31 * W / 32, 10 * H / 32, Buffer, strlen(Buffer));
+		page.Printf(31 * W / 32, 7 * H / 32, "%.1lf", GC->rtcc->PZLRBTI.HALOI1);
+		page.Printf(31 * W / 32, 8 * H / 32, "%.1lf", GC->rtcc->PZLRBTI.HPLOI1);
+		page.Printf(31 * W / 32, 9 * H / 32, "%.1lf", GC->rtcc->PZLRBTI.HALOI2);
+		page.Printf(31 * W / 32, 10 * H / 32, "%.2lf", GC->rtcc->PZLRBTI.HPLOI2);
 
-		skp->Text(6 * W / 32, 12 * H / 32, "AZMN FND", 8);
-		skp->Text(6 * W / 32, 13 * H / 32, "AZMX FND", 8);
+		page.Text(6 * W / 32, 12 * H / 32, "AZMN FND", 8);
+		page.Text(6 * W / 32, 13 * H / 32, "AZMX FND", 8);
 
-		sprintf(Buffer, "%.1lf", GC->rtcc->PZLRBTI.AZMN_f_ND);
-		skp->Text(10 * W / 32, 12 * H / 32, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%.1lf", GC->rtcc->PZLRBTI.AZMX_f_ND);
-		skp->Text(10 * W / 32, 13 * H / 32, Buffer, strlen(Buffer));
+		page.Printf(10 * W / 32, 12 * H / 32, "%.1lf", GC->rtcc->PZLRBTI.AZMN_f_ND);
+		page.Printf(10 * W / 32, 13 * H / 32, "%.1lf", GC->rtcc->PZLRBTI.AZMX_f_ND);
 
-		skp->Text(17 * W / 32, 12 * H / 32, "AZLLS", 5);
-		skp->Text(17 * W / 32, 13 * H / 32, "FLLS", 4);
+		page.Text(17 * W / 32, 12 * H / 32, "AZLLS", 5);
+		page.Text(17 * W / 32, 13 * H / 32, "FLLS", 4);
 
-		sprintf(Buffer, "%.1lf", GC->rtcc->PZLRBTI.AZ_LLS);
-		skp->Text(21 * W / 32, 12 * H / 32, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%.1lf", GC->rtcc->PZLRBTI.f_LLS);
-		skp->Text(21 * W / 32, 13 * H / 32, Buffer, strlen(Buffer));
+		page.Printf(21 * W / 32, 12 * H / 32, "%.1lf", GC->rtcc->PZLRBTI.AZ_LLS);
+		page.Printf(21 * W / 32, 13 * H / 32, "%.1lf", GC->rtcc->PZLRBTI.f_LLS);
 
-		skp->Text(27 * W / 32, 12 * H / 32, "DVMAX+", 6);
-		skp->Text(27 * W / 32, 13 * H / 32, "DVMAX-", 6);
-		skp->Text(27 * W / 32, 14 * H / 32, "RA-RP GT", 8);
+		page.Text(27 * W / 32, 12 * H / 32, "DVMAX+", 6);
+		page.Text(27 * W / 32, 13 * H / 32, "DVMAX-", 6);
+		page.Text(27 * W / 32, 14 * H / 32, "RA-RP GT", 8);
 
-		sprintf(Buffer, "%.0lf", GC->rtcc->PZLRBTI.DVMAXp);
-		skp->Text(31 * W / 32, 12 * H / 32, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%.0lf", GC->rtcc->PZLRBTI.DVMAXm);
-		skp->Text(31 * W / 32, 13 * H / 32, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%.1lf", GC->rtcc->PZLRBTI.RARPGT);
-		skp->Text(31 * W / 32, 14 * H / 32, Buffer, strlen(Buffer));
+		page.Printf(31 * W / 32, 12 * H / 32, "%.0lf", GC->rtcc->PZLRBTI.DVMAXp);
+		page.Printf(31 * W / 32, 13 * H / 32, "%.0lf", GC->rtcc->PZLRBTI.DVMAXm);
+		page.Printf(31 * W / 32, 14 * H / 32, "%.1lf", GC->rtcc->PZLRBTI.RARPGT);
 
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
-		skp->Text(2 * W / 32, 16 * H / 32, "CODE", 4);
-		skp->Text(11 * W / 64, 16 * H / 32, "GETLOI", 6);
-		skp->Text(19 * W / 64, 16 * H / 32, "DVLOI1", 6);
-		skp->Text(27 * W / 64, 16 * H / 32, "DVLOI2", 6);
-		skp->Text(17 * W / 32, 16 * H / 32, "HND", 3);
-		skp->Text(20 * W / 32, 16 * H / 32, "FND/H", 5);
-		skp->Text(93 * W / 128, 16 * H / 32, "HPC", 3);
-		skp->Text(53 * W / 64, 16 * H / 32, "THETA", 5);
-		skp->Text(30 * W / 32, 16 * H / 32, "FND/E", 5);
-		skp->SetTextAlign(oapi::Sketchpad::RIGHT);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
+		page.Text(2 * W / 32, 16 * H / 32, "CODE", 4);
+		page.Text(11 * W / 64, 16 * H / 32, "GETLOI", 6);
+		page.Text(19 * W / 64, 16 * H / 32, "DVLOI1", 6);
+		page.Text(27 * W / 64, 16 * H / 32, "DVLOI2", 6);
+		page.Text(17 * W / 32, 16 * H / 32, "HND", 3);
+		page.Text(20 * W / 32, 16 * H / 32, "FND/H", 5);
+		page.Text(93 * W / 128, 16 * H / 32, "HPC", 3);
+		page.Text(53 * W / 64, 16 * H / 32, "THETA", 5);
+		page.Text(30 * W / 32, 16 * H / 32, "FND/E", 5);
+		page.SetTextAlign(oapi::Sketchpad::RIGHT);
 
-		skp->SetPen(pen2);
+		page.SetPen(pen2);
 
 		for (int i = 0;i < 5;i++)
 		{
 			//Horizontal lines
-			skp->Line(1 * W / 64, (31 + 7 * i) * H / 64, 63 * W / 64, (31 + 7 * i) * H / 64);
-			skp->Line(1 * W / 64, (35 + 7 * i) * H / 64, 63 * W / 64, (35 + 7 * i) * H / 64);
+			page.Line(1 * W / 64, (31 + 7 * i) * H / 64, 63 * W / 64, (31 + 7 * i) * H / 64);
+			page.Line(1 * W / 64, (35 + 7 * i) * H / 64, 63 * W / 64, (35 + 7 * i) * H / 64);
 			//Vertical lines
-			skp->Line(1 * W / 64, (31 + 7 * i) * H / 64, 1 * W / 64, (35 + 7 * i) * H / 64);
-			skp->Line(7 * W / 64, (31 + 7 * i) * H / 64, 7 * W / 64, (35 + 7 * i) * H / 64);
-			skp->Line(15 * W / 64, (31 + 7 * i) * H / 64, 15 * W / 64, (35 + 7 * i) * H / 64);
-			skp->Line(23 * W / 64, (31 + 7 * i) * H / 64, 23 * W / 64, (35 + 7 * i) * H / 64);
-			skp->Line(31 * W / 64, (31 + 7 * i) * H / 64, 31 * W / 64, (35 + 7 * i) * H / 64);
-			skp->Line(73 * W / 128, (31 + 7 * i) * H / 64, 73 * W / 128, (35 + 7 * i) * H / 64);
-			skp->Line(43 * W / 64, (31 + 7 * i) * H / 64, 43 * W / 64, (35 + 7 * i) * H / 64);
-			skp->Line(49 * W / 64, (31 + 7 * i) * H / 64, 49 * W / 64, (35 + 7 * i) * H / 64);
-			skp->Line(113 * W / 128, (31 + 7 * i) * H / 64, 113 * W / 128, (35 + 7 * i) * H / 64);
-			skp->Line(63 * W / 64, (31 + 7 * i) * H / 64, 63 * W / 64, (35 + 7 * i) * H / 64);
+			page.Line(1 * W / 64, (31 + 7 * i) * H / 64, 1 * W / 64, (35 + 7 * i) * H / 64);
+			page.Line(7 * W / 64, (31 + 7 * i) * H / 64, 7 * W / 64, (35 + 7 * i) * H / 64);
+			page.Line(15 * W / 64, (31 + 7 * i) * H / 64, 15 * W / 64, (35 + 7 * i) * H / 64);
+			page.Line(23 * W / 64, (31 + 7 * i) * H / 64, 23 * W / 64, (35 + 7 * i) * H / 64);
+			page.Line(31 * W / 64, (31 + 7 * i) * H / 64, 31 * W / 64, (35 + 7 * i) * H / 64);
+			page.Line(73 * W / 128, (31 + 7 * i) * H / 64, 73 * W / 128, (35 + 7 * i) * H / 64);
+			page.Line(43 * W / 64, (31 + 7 * i) * H / 64, 43 * W / 64, (35 + 7 * i) * H / 64);
+			page.Line(49 * W / 64, (31 + 7 * i) * H / 64, 49 * W / 64, (35 + 7 * i) * H / 64);
+			page.Line(113 * W / 128, (31 + 7 * i) * H / 64, 113 * W / 128, (35 + 7 * i) * H / 64);
+			page.Line(63 * W / 64, (31 + 7 * i) * H / 64, 63 * W / 64, (35 + 7 * i) * H / 64);
 		}		
 
 		for (int i = 0;i < 4;i++)
 		{
-			sprintf_s(Buffer, "%d", 2 * i + 1);
-			skp->Text(2 * W / 32, (38 + 7 * i) * H / 64, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%d", 2 * i + 2);
-			skp->Text(2 * W / 32, (40 + 7 * i) * H / 64, Buffer, strlen(Buffer));
-
-			GET_Display_HHMM(Buffer, GC->rtcc->PZLRBTI.sol[2 * i].GETLOI);
-			skp->Text(7 * W / 32, (38 + 7 * i) * H / 64, Buffer, strlen(Buffer));
-			GET_Display_HHMM(Buffer, GC->rtcc->PZLRBTI.sol[2 * i + 1].GETLOI);
-			skp->Text(7 * W / 32, (40 + 7 * i) * H / 64, Buffer, strlen(Buffer));
-
-			sprintf_s(Buffer, "%.0lf", GC->rtcc->PZLRBTI.sol[2 * i].DVLOI1);
-			skp->Text(11 * W / 32, (38 + 7 * i) * H / 64, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.0lf", GC->rtcc->PZLRBTI.sol[2 * i + 1].DVLOI1);
-			skp->Text(11 * W / 32, (40 + 7 * i) * H / 64, Buffer, strlen(Buffer));
-
-			sprintf_s(Buffer, "%.0lf", GC->rtcc->PZLRBTI.sol[2 * i].DVLOI2);
-			skp->Text(15 * W / 32, (38 + 7 * i) * H / 64, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.0lf", GC->rtcc->PZLRBTI.sol[2 * i + 1].DVLOI2);
-			skp->Text(15 * W / 32, (40 + 7 * i) * H / 64, Buffer, strlen(Buffer));
-
-			sprintf_s(Buffer, "%.1lf", GC->rtcc->PZLRBTI.sol[2 * i].H_ND);
-			skp->Text(18 * W / 32, (38 + 7 * i) * H / 64, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.1lf", GC->rtcc->PZLRBTI.sol[2 * i + 1].H_ND);
-			skp->Text(18 * W / 32, (40 + 7 * i) * H / 64, Buffer, strlen(Buffer));
-
-			sprintf_s(Buffer, "%.1lf", GC->rtcc->PZLRBTI.sol[2 * i].f_ND_H);
-			skp->Text(21 * W / 32, (38 + 7 * i) * H / 64, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.1lf", GC->rtcc->PZLRBTI.sol[2 * i + 1].f_ND_H);
-			skp->Text(21 * W / 32, (40 + 7 * i) * H / 64, Buffer, strlen(Buffer));
-
-			sprintf_s(Buffer, "%.0lf", GC->rtcc->PZLRBTI.sol[2 * i].H_PC);
-			skp->Text(24 * W / 32, (38 + 7 * i) * H / 64, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.0lf", GC->rtcc->PZLRBTI.sol[2 * i + 1].H_PC);
-			skp->Text(24 * W / 32, (40 + 7 * i) * H / 64, Buffer, strlen(Buffer));
-
-			sprintf_s(Buffer, "%.2lf", GC->rtcc->PZLRBTI.sol[2 * i].Theta);
-			skp->Text(28 * W / 32, (38 + 7 * i) * H / 64, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.2lf", GC->rtcc->PZLRBTI.sol[2 * i + 1].Theta);
-			skp->Text(28 * W / 32, (40 + 7 * i) * H / 64, Buffer, strlen(Buffer));
-
-			sprintf_s(Buffer, "%.1lf", GC->rtcc->PZLRBTI.sol[2 * i].f_ND_E);
-			skp->Text(31 * W / 32, (38 + 7 * i) * H / 64, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.1lf", GC->rtcc->PZLRBTI.sol[2 * i + 1].f_ND_E);
-			skp->Text(31 * W / 32, (40 + 7 * i) * H / 64, Buffer, strlen(Buffer));
-		}
-
-		skp->SetTextAlign(oapi::Sketchpad::RIGHT);
+			page.Printf(2 * W / 32, (38 + 7 * i) * H / 64, "%d", 2 * i + 1);
+			page.Printf(2 * W / 32, (40 + 7 * i) * H / 64, "%d", 2 * i + 2);
+
+			page.Format(7 * W / 32, (38 + 7 * i) * H / 64, this, &ApolloRTCCMFD::GET_Display_HHMM, GC->rtcc->PZLRBTI.sol[2 * i].GETLOI);
+			page.Format(7 * W / 32, (40 + 7 * i) * H / 64, this, &ApolloRTCCMFD::GET_Display_HHMM, GC->rtcc->PZLRBTI.sol[2 * i + 1].GETLOI);
+
+			page.Printf(11 * W / 32, (38 + 7 * i) * H / 64, "%.0lf", GC->rtcc->PZLRBTI.sol[2 * i].DVLOI1);
+			page.Printf(11 * W / 32, (40 + 7 * i) * H / 64, "%.0lf", GC->rtcc->PZLRBTI.sol[2 * i + 1].DVLOI1);
+
+			page.Printf(15 * W / 32, (38 + 7 * i) * H / 64, "%.0lf", GC->rtcc->PZLRBTI.sol[2 * i].DVLOI2);
+			page.Printf(15 * W / 32, (40 + 7 * i) * H / 64, "%.0lf", GC->rtcc->PZLRBTI.sol[2 * i + 1].DVLOI2);
+
+			page.Printf(18 * W / 32, (38 + 7 * i) * H / 64, "%.1lf", GC->rtcc->PZLRBTI.sol[2 * i].H_ND);
+			page.Printf(18 * W / 32, (40 + 7 * i) * H / 64, "%.1lf", GC->rtcc->PZLRBTI.sol[2 * i + 1].H_ND);
+
+			page.Printf(21 * W / 32, (38 + 7 * i) * H / 64, "%.1lf", GC->rtcc->PZLRBTI.sol[2 * i].f_ND_H);
+			page.Printf(21 * W / 32, (40 + 7 * i) * H / 64, "%.1lf", GC->rtcc->PZLRBTI.sol[2 * i + 1].f_ND_H);
+
+			page.Printf(24 * W / 32, (38 + 7 * i) * H / 64, "%.0lf", GC->rtcc->PZLRBTI.sol[2 * i].H_PC);
+			page.Printf(24 * W / 32, (40 + 7 * i) * H / 64, "%.0lf", GC->rtcc->PZLRBTI.sol[2 * i + 1].H_PC);
+
+			page.Printf(28 * W / 32, (38 + 7 * i) * H / 64, "%.2lf", GC->rtcc->PZLRBTI.sol[2 * i].Theta);
+			page.Printf(28 * W / 32, (40 + 7 * i) * H / 64, "%.2lf", GC->rtcc->PZLRBTI.sol[2 * i + 1].Theta);
+
+			page.Printf(31 * W / 32, (38 + 7 * i) * H / 64, "%.1lf", GC->rtcc->PZLRBTI.sol[2 * i].f_ND_E);
+			page.Printf(31 * W / 32, (40 + 7 * i) * H / 64, "%.1lf", GC->rtcc->PZLRBTI.sol[2 * i + 1].f_ND_E);
+		}
+
+		page.SetTextAlign(oapi::Sketchpad::RIGHT);
 	}
 	else if (screen == 84)
 	{
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
-		skp->Text(4 * W / 8, 1 * H / 14, "DIRECT INPUT TO MPT (MED M66)", 29);
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
+		page.Text(4 * W / 8, 1 * H / 14, "DIRECT INPUT TO MPT (MED M66)", 29);
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
 
 		if (GC->rtcc->med_m66.UllageDT < 0)
 		{
@@ -7052,193 +6072,168 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 		{
 			sprintf_s(Buffer, "%.0lfs Ullage DT", GC->rtcc->med_m66.UllageDT);
 		}
-		skp->Text(1 * W / 16, 2 * H / 14, Buffer, strlen(Buffer));
+		page.Text(1 * W / 16, 2 * H / 14, Buffer, strlen(Buffer));
 
 		if (GC->rtcc->med_m66.UllageQuads)
 		{
-			skp->Text(1 * W / 16, 4 * H / 14, "4 Thrusters", 11);
+			page.Text(1 * W / 16, 4 * H / 14, "4 Thrusters", 11);
 		}
 		else
 		{
-			skp->Text(1 * W / 16, 4 * H / 14, "2 Thrusters", 11);
+			page.Text(1 * W / 16, 4 * H / 14, "2 Thrusters", 11);
 		}
 		
 		if (GC->rtcc->med_m66.BurnParamNo == 1 && GC->rtcc->med_m66.CoordInd >= 1)
 		{
-			skp->Text(1 * W / 16, 6 * H / 14, "REFSMMAT: CUR", 13);
+			page.Text(1 * W / 16, 6 * H / 14, "REFSMMAT: CUR", 13);
 		}
 
 		if (GC->rtcc->med_m66.ConfigChangeInd == 0)
 		{
-			skp->Text(1 * W / 16, 8 * H / 14, "No change", 9);
+			page.Text(1 * W / 16, 8 * H / 14, "No change", 9);
 		}
 		else
 		{
 			if (GC->rtcc->med_m66.ConfigChangeInd == 1)
 			{
-				skp->Text(1 * W / 16, 8 * H / 14, "Undocking", 9);
+				page.Text(1 * W / 16, 8 * H / 14, "Undocking", 9);
 			}
 			else if (GC->rtcc->med_m66.ConfigChangeInd == 2)
 			{
-				skp->Text(1 * W / 16, 8 * H / 14, "Docking", 7);
+				page.Text(1 * W / 16, 8 * H / 14, "Docking", 7);
 			}
 
 			sprintf_s(Buffer, GC->rtcc->med_m66.FinalConfig.c_str());
-			skp->Text(1 * W / 16, 10 * H / 14, Buffer, strlen(Buffer));
+			page.Text(1 * W / 16, 10 * H / 14, Buffer, strlen(Buffer));
 		}
 
-		sprintf_s(Buffer, "%+.1lf Delta Docking Angle", GC->rtcc->med_m66.DeltaDA*DEG);
-		skp->Text(1 * W / 16, 12 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(1 * W / 16, 12 * H / 14, "%+.1lf Delta Docking Angle", GC->rtcc->med_m66.DeltaDA*DEG);
 
 		if (GC->rtcc->med_m66.TrimAngleIndicator == 0)
 		{
-			skp->Text(10 * W / 16, 2 * H / 14, "Compute Trim", 12);
+			page.Text(10 * W / 16, 2 * H / 14, "Compute Trim", 12);
 		}
 		else
 		{
-			skp->Text(10 * W / 16, 2 * H / 14, "System Parameters", 17);
+			page.Text(10 * W / 16, 2 * H / 14, "System Parameters", 17);
 		}
 
-		skp->Text(10 * W / 16, 4 * H / 14, "Transfer to MPT", 15);
-		skp->Text(10 * W / 16, 10 * H / 14, "Page 2/2", 8);
+		page.Text(10 * W / 16, 4 * H / 14, "Transfer to MPT", 15);
+		page.Text(10 * W / 16, 10 * H / 14, "Page 2/2", 8);
 	}
 	else if (screen == 85)
 	{
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
-		skp->Text(4 * W / 8, 2 * H / 28, "EXPERIMENTAL SITE ACQUISITION (MSK 1506)", 40);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
+		page.Text(4 * W / 8, 2 * H / 28, "EXPERIMENTAL SITE ACQUISITION (MSK 1506)", 40);
 
-		skp->SetFont(font2);
+		page.SetFont(font2);
 
-		skp->Text(22 * W / 32, 4 * H / 28, "STA ID", 6);
-		skp->Text(2 * W / 32, 6 * H / 28, "REV", 3);
-		skp->Text(5 * W / 32, 6 * H / 28, "STA", 3);
-		skp->Text(9 * W / 32, 6 * H / 28, "GETAOS", 6);
-		skp->Text(55 * W / 128, 6 * H / 28, "GNDRNG", 6);
-		skp->Text(17 * W / 32, 6 * H / 28, "ALT", 3);
-		skp->Text(20 * W / 32, 6 * H / 28, "EMAX", 4);
-		skp->Text(24 * W / 32, 6 * H / 28, "GETCA", 5);
-		skp->Text(29 * W / 32, 6 * H / 28, "GETLOS", 8);
+		page.Text(22 * W / 32, 4 * H / 28, "STA ID", 6);
+		page.Text(2 * W / 32, 6 * H / 28, "REV", 3);
+		page.Text(5 * W / 32, 6 * H / 28, "STA", 3);
+		page.Text(9 * W / 32, 6 * H / 28, "GETAOS", 6);
+		page.Text(55 * W / 128, 6 * H / 28, "GNDRNG", 6);
+		page.Text(17 * W / 32, 6 * H / 28, "ALT", 3);
+		page.Text(20 * W / 32, 6 * H / 28, "EMAX", 4);
+		page.Text(24 * W / 32, 6 * H / 28, "GETCA", 5);
+		page.Text(29 * W / 32, 6 * H / 28, "GETLOS", 8);
 
-		sprintf_s(Buffer, "PAGE %02d OF %02d", GC->rtcc->EZDPSAD2.curpage, GC->rtcc->EZDPSAD2.pages);
-		skp->Text(6 * W / 32, 4 * H / 28, Buffer, strlen(Buffer));
+		page.Printf(6 * W / 32, 4 * H / 28, "PAGE %02d OF %02d", GC->rtcc->EZDPSAD2.curpage, GC->rtcc->EZDPSAD2.pages);
 
 		for (unsigned i = 0;i < GC->rtcc->EZDPSAD2.numcontacts[GC->rtcc->EZDPSAD2.curpage - 1];i++)
 		{
-			sprintf_s(Buffer, "%03d", GC->rtcc->EZDPSAD2.REV[GC->rtcc->EZDPSAD2.curpage - 1][i]);
-			skp->Text(2 * W / 32, (i + 8) * H / 28, Buffer, strlen(Buffer));
+			page.Printf(2 * W / 32, (i + 8) * H / 28, "%03d", GC->rtcc->EZDPSAD2.REV[GC->rtcc->EZDPSAD2.curpage - 1][i]);
 
 			sprintf_s(Buffer, GC->rtcc->EZDPSAD2.STA[GC->rtcc->EZDPSAD2.curpage - 1][i].c_str());
-			skp->Text(5 * W / 32, (i + 8) * H / 28, Buffer, strlen(Buffer));
+			page.Text(5 * W / 32, (i + 8) * H / 28, Buffer, strlen(Buffer));
 
 			if (GC->rtcc->EZDPSAD2.BestAvailableAOS[GC->rtcc->EZDPSAD2.curpage - 1][i])
 			{
-				skp->Text(8 * W / 32, (i + 8) * H / 28, "*", 1);
+				page.Text(8 * W / 32, (i + 8) * H / 28, "*", 1);
 			}
-			GET_Display(Buffer, GC->rtcc->EZDPSAD2.GETAOS[GC->rtcc->EZDPSAD2.curpage - 1][i], false);
-			skp->Text(9 * W / 32, (i + 8) * H / 28, Buffer, strlen(Buffer));
+			page.Format(9 * W / 32, (i + 8) * H / 28, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->EZDPSAD2.GETAOS[GC->rtcc->EZDPSAD2.curpage - 1][i], false);
 
-			sprintf_s(Buffer, "%.1f", GC->rtcc->EZDPSAD2.GNDRNG[GC->rtcc->EZDPSAD2.curpage - 1][i]);
-			skp->Text(14 * W / 32, (i + 8) * H / 28, Buffer, strlen(Buffer));
+			page.Printf(14 * W / 32, (i + 8) * H / 28, "%.1f", GC->rtcc->EZDPSAD2.GNDRNG[GC->rtcc->EZDPSAD2.curpage - 1][i]);
 
-			sprintf_s(Buffer, "%04.1f", GC->rtcc->EZDPSAD2.ALT[GC->rtcc->EZDPSAD2.curpage - 1][i]);
-			skp->Text(17 * W / 32, (i + 8) * H / 28, Buffer, strlen(Buffer));
+			page.Printf(17 * W / 32, (i + 8) * H / 28, "%04.1f", GC->rtcc->EZDPSAD2.ALT[GC->rtcc->EZDPSAD2.curpage - 1][i]);
 
 			if (GC->rtcc->EZDPSAD2.BestAvailableEMAX[GC->rtcc->EZDPSAD2.curpage - 1][i])
 			{
-				skp->Text(19 * W / 32, (i + 8) * H / 28, "*", 1);
+				page.Text(19 * W / 32, (i + 8) * H / 28, "*", 1);
 			}
-			sprintf_s(Buffer, "%04.1f", GC->rtcc->EZDPSAD2.ELMAX[GC->rtcc->EZDPSAD2.curpage - 1][i]);
-			skp->Text(20 * W / 32, (i + 8) * H / 28, Buffer, strlen(Buffer));
+			page.Printf(20 * W / 32, (i + 8) * H / 28, "%04.1f", GC->rtcc->EZDPSAD2.ELMAX[GC->rtcc->EZDPSAD2.curpage - 1][i]);
 
-			GET_Display(Buffer, GC->rtcc->EZDPSAD2.GETCA[GC->rtcc->EZDPSAD2.curpage - 1][i], false);
-			skp->Text(24 * W / 32, (i + 8) * H / 28, Buffer, strlen(Buffer));
+			page.Format(24 * W / 32, (i + 8) * H / 28, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->EZDPSAD2.GETCA[GC->rtcc->EZDPSAD2.curpage - 1][i], false);
 
 			if (GC->rtcc->EZDPSAD2.BestAvailableLOS[GC->rtcc->EZDPSAD2.curpage - 1][i])
 			{
-				skp->Text(27 * W / 32, (i + 8) * H / 28, "*", 1);
+				page.Text(27 * W / 32, (i + 8) * H / 28, "*", 1);
 			}
-			GET_Display(Buffer, GC->rtcc->EZDPSAD2.GETLOS[GC->rtcc->EZDPSAD2.curpage - 1][i], false);
-			skp->Text(29 * W / 32, (i + 8) * H / 28, Buffer, strlen(Buffer));
+			page.Format(29 * W / 32, (i + 8) * H / 28, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->EZDPSAD2.GETLOS[GC->rtcc->EZDPSAD2.curpage - 1][i], false);
 		}
 	}
 	else if (screen == 86)
 	{
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
-		skp->Text(4 * W / 8, 2 * H / 32, "RELATIVE MOTION DIGITALS (MSK 0060)", 35);
-		skp->SetFont(font2);
-
-		sprintf_s(Buffer, "%s", GC->rtcc->EZRMDT.error.c_str());
-		skp->Text(16 * W / 32, 31 * H / 32, Buffer, strlen(Buffer));
-
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
-		skp->Text(1 * W / 32, 4 * H / 32, "CSM STAID", 9);
-		skp->Text(1 * W / 32, 5 * H / 32, "GMTV", 4);
-		GET_Display(Buffer, GC->rtcc->EZRMDT.CSMGMTV, false);
-		skp->Text(4 * W / 32, 5 * H / 32, Buffer, strlen(Buffer));
-		skp->Text(1 * W / 32, 6 * H / 32, "GETV", 4);
-		GET_Display(Buffer, GC->rtcc->EZRMDT.CSMGETV, false);
-		skp->Text(4 * W / 32, 6 * H / 32, Buffer, strlen(Buffer));
-		skp->Text(1 * W / 32, 7 * H / 32, "MODE", 4);
-		sprintf_s(Buffer, "%c", GC->rtcc->EZRMDT.Mode);
-		skp->Text(4 * W / 32, 7 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "GET%s", GC->rtcc->EZRMDT.PETorSH.c_str());
-		skp->Text(5 * W / 128, 8 * H / 32, Buffer, strlen(Buffer));
-
-		skp->Text(10 * W / 32, 4 * H / 32, "LM STAID", 8);
-		skp->Text(10 * W / 32, 5 * H / 32, "GMTV", 4);
-		GET_Display(Buffer, GC->rtcc->EZRMDT.LMGMTV, false);
-		skp->Text(13 * W / 32, 5 * H / 32, Buffer, strlen(Buffer));
-		skp->Text(10 * W / 32, 6 * H / 32, "GETV", 4);
-		GET_Display(Buffer, GC->rtcc->EZRMDT.LMGETV, false);
-		skp->Text(13 * W / 32, 6 * H / 32, Buffer, strlen(Buffer));
-
-		skp->Text(19 * W / 32, 4 * H / 32, "GETR", 4);
-		GET_Display(Buffer, GC->rtcc->EZRMDT.GETR, false);
-		skp->Text(22 * W / 32, 4 * H / 32, Buffer, strlen(Buffer));
-		skp->Text(19 * W / 32, 5 * H / 32, "VEH", 3);
-		sprintf_s(Buffer, "%s", GC->rtcc->EZRMDT.VEH.c_str());
-		skp->Text(43 * W / 64, 5 * H / 32, Buffer, strlen(Buffer));
-
-		sprintf_s(Buffer, "%c", GC->rtcc->EZRMDT.AXIS);
-		skp->Text(25 * W / 32, 5 * H / 32, Buffer, strlen(Buffer));
-		skp->Text(26 * W / 32, 5 * H / 32, "AXIS AT TGT", 11);
-		skp->Text(19 * W / 32, 6 * H / 32, "REFSMMAT NO", 11);
-		sprintf_s(Buffer, "%s", GC->rtcc->EZRMDT.REFSMMAT.c_str());
-		skp->Text(53 * W / 64, 6 * H / 32, Buffer, strlen(Buffer));
-
-		skp->SetPen(pen2);
-		skp->Line(5 * W / 32, 15 * H / 64, W, 15 * H / 64);
-		skp->Line(11 * W / 64, 15 * H / 64, 11 * W / 64, 62 * H / 64);
-		skp->Line(18 * W / 64, 15 * H / 64, 18 * W / 64, 62 * H / 64);
-		skp->Line(26 * W / 64, 15 * H / 64, 26 * W / 64, 62 * H / 64);
-		skp->Line(33 * W / 64, 15 * H / 64, 33 * W / 64, 62 * H / 64);
-		skp->Line(40 * W / 64, 15 * H / 64, 40 * W / 64, 62 * H / 64);
-		skp->Line(48 * W / 64, 15 * H / 64, 48 * W / 64, 62 * H / 64);
-		skp->Line(56 * W / 64, 15 * H / 64, 56 * W / 64, 62 * H / 64);
-
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
-		sprintf_s(Buffer, "R%s", GC->rtcc->EZRMDT.YDotorT.c_str());
-		skp->Text(29 * W / 128, 8 * H / 32, Buffer, strlen(Buffer));
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
+		page.Text(4 * W / 8, 2 * H / 32, "RELATIVE MOTION DIGITALS (MSK 0060)", 35);
+		page.SetFont(font2);
+
+		page.Printf(16 * W / 32, 31 * H / 32, "%s", GC->rtcc->EZRMDT.error.c_str());
+
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
+		page.Text(1 * W / 32, 4 * H / 32, "CSM STAID", 9);
+		page.Text(1 * W / 32, 5 * H / 32, "GMTV", 4);
+		page.Format(4 * W / 32, 5 * H / 32, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->EZRMDT.CSMGMTV, false);
+		page.Text(1 * W / 32, 6 * H / 32, "GETV", 4);
+		page.Format(4 * W / 32, 6 * H / 32, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->EZRMDT.CSMGETV, false);
+		page.Text(1 * W / 32, 7 * H / 32, "MODE", 4);
+		page.Printf(4 * W / 32, 7 * H / 32, "%c", GC->rtcc->EZRMDT.Mode);
+		page.Printf(5 * W / 128, 8 * H / 32, "GET%s", GC->rtcc->EZRMDT.PETorSH.c_str());
+
+		page.Text(10 * W / 32, 4 * H / 32, "LM STAID", 8);
+		page.Text(10 * W / 32, 5 * H / 32, "GMTV", 4);
+		page.Format(13 * W / 32, 5 * H / 32, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->EZRMDT.LMGMTV, false);
+		page.Text(10 * W / 32, 6 * H / 32, "GETV", 4);
+		page.Format(13 * W / 32, 6 * H / 32, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->EZRMDT.LMGETV, false);
+
+		page.Text(19 * W / 32, 4 * H / 32, "GETR", 4);
+		page.Format(22 * W / 32, 4 * H / 32, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->EZRMDT.GETR, false);
+		page.Text(19 * W / 32, 5 * H / 32, "VEH", 3);
+		page.Printf(43 * W / 64, 5 * H / 32, "%s", GC->rtcc->EZRMDT.VEH.c_str());
+
+		page.Printf(25 * W / 32, 5 * H / 32, "%c", GC->rtcc->EZRMDT.AXIS);
+		page.Text(26 * W / 32, 5 * H / 32, "AXIS AT TGT", 11);
+		page.Text(19 * W / 32, 6 * H / 32, "REFSMMAT NO", 11);
+		page.Printf(53 * W / 64, 6 * H / 32, "%s", GC->rtcc->EZRMDT.REFSMMAT.c_str());
+
+		page.SetPen(pen2);
+		page.Line(5 * W / 32, 15 * H / 64, W, 15 * H / 64);
+		page.Line(11 * W / 64, 15 * H / 64, 11 * W / 64, 62 * H / 64);
+		page.Line(18 * W / 64, 15 * H / 64, 18 * W / 64, 62 * H / 64);
+		page.Line(26 * W / 64, 15 * H / 64, 26 * W / 64, 62 * H / 64);
+		page.Line(33 * W / 64, 15 * H / 64, 33 * W / 64, 62 * H / 64);
+		page.Line(40 * W / 64, 15 * H / 64, 40 * W / 64, 62 * H / 64);
+		page.Line(48 * W / 64, 15 * H / 64, 48 * W / 64, 62 * H / 64);
+		page.Line(56 * W / 64, 15 * H / 64, 56 * W / 64, 62 * H / 64);
+
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
+		page.Printf(29 * W / 128, 8 * H / 32, "R%s", GC->rtcc->EZRMDT.YDotorT.c_str());
 		if (GC->rtcc->EZRMDT.Mode == '1')
 		{
-			skp->Text(62 * W / 256, 57 * H / 256, ".", 1);
+			page.Text(62 * W / 256, 57 * H / 256, ".", 1);
 		}
-		skp->Text(81 * W / 256, 57 * H / 256, ".", 1);
-		skp->Text(22 * W / 64, 8 * H / 32, "R/PB", 4);
-		skp->Text(59 * W / 128, 8 * H / 32, "AZ/YB", 5);
-		skp->Text(73 * W / 128, 8 * H / 32, "EL/RB", 5);
-		sprintf_s(Buffer, "X/P%c", GC->rtcc->EZRMDT.Pitch);
-		skp->Text(89 * W / 128, 8 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "Z/Y%c", GC->rtcc->EZRMDT.Yaw);
-		skp->Text(26 * W / 32, 8 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "Y/R%c", GC->rtcc->EZRMDT.Roll);
-		skp->Text(30 * W / 32, 8 * H / 32, Buffer, strlen(Buffer));
+		page.Text(81 * W / 256, 57 * H / 256, ".", 1);
+		page.Text(22 * W / 64, 8 * H / 32, "R/PB", 4);
+		page.Text(59 * W / 128, 8 * H / 32, "AZ/YB", 5);
+		page.Text(73 * W / 128, 8 * H / 32, "EL/RB", 5);
+		page.Printf(89 * W / 128, 8 * H / 32, "X/P%c", GC->rtcc->EZRMDT.Pitch);
+		page.Printf(26 * W / 32, 8 * H / 32, "Z/Y%c", GC->rtcc->EZRMDT.Yaw);
+		page.Printf(30 * W / 32, 8 * H / 32, "Y/R%c", GC->rtcc->EZRMDT.Roll);
 
-		skp->SetTextAlign(oapi::Sketchpad::RIGHT);
+		page.SetTextAlign(oapi::Sketchpad::RIGHT);
 		for (int i = 0;i < GC->rtcc->EZRMDT.solns;i++)
 		{
-			GET_Display(Buffer, GC->rtcc->EZRMDT.data[i].GET, false);
-			skp->Text(5 * W / 32, (9 + i * 2) * H / 32, Buffer, strlen(Buffer));
+			page.Format(5 * W / 32, (9 + i * 2) * H / 32, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->EZRMDT.data[i].GET, false);
 
 			if (GC->rtcc->EZRMDT.Mode == '1')
 			{
@@ -7248,269 +6243,215 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			{
 				sprintf_s(Buffer, "%.1lf", GC->rtcc->EZRMDT.data[i].PETorShaft);
 			}
-			skp->Text(5 * W / 32, (10 + i * 2) * H / 32, Buffer, strlen(Buffer));
+			page.Text(5 * W / 32, (10 + i * 2) * H / 32, Buffer, strlen(Buffer));
 			if (GC->rtcc->EZRMDT.data[i].R <= 9999.9)
 			{
-				sprintf_s(Buffer, "%.1lf", GC->rtcc->EZRMDT.data[i].R);
-				skp->Text(35 * W / 128, (9 + i * 2) * H / 32, Buffer, strlen(Buffer));
+				page.Printf(35 * W / 128, (9 + i * 2) * H / 32, "%.1lf", GC->rtcc->EZRMDT.data[i].R);
 			}
 			if (GC->rtcc->EZRMDT.Mode == '1')
 			{
 				if (abs(GC->rtcc->EZRMDT.data[i].YdotorTrun) <= 999.9)
 				{
-					sprintf_s(Buffer, "%+.1lf", GC->rtcc->EZRMDT.data[i].YdotorTrun);
-					skp->Text(35 * W / 128, (10 + i * 2) * H / 32, Buffer, strlen(Buffer));
+					page.Printf(35 * W / 128, (10 + i * 2) * H / 32, "%+.1lf", GC->rtcc->EZRMDT.data[i].YdotorTrun);
 				}
 			}
 			else
 			{
-				sprintf_s(Buffer, "%.1lf", GC->rtcc->EZRMDT.data[i].YdotorTrun);
-				skp->Text(35 * W / 128, (10 + i * 2) * H / 32, Buffer, strlen(Buffer));
+				page.Printf(35 * W / 128, (10 + i * 2) * H / 32, "%.1lf", GC->rtcc->EZRMDT.data[i].YdotorTrun);
 			}
 			
 			if (abs(GC->rtcc->EZRMDT.data[i].RDOT) <= 999.9)
 			{
-				sprintf_s(Buffer, "%+.1lf", GC->rtcc->EZRMDT.data[i].RDOT);
-				skp->Text(25 * W / 64, (9 + i * 2) * H / 32, Buffer, strlen(Buffer));
-			}
-			sprintf_s(Buffer, "%.1lf", GC->rtcc->EZRMDT.data[i].PB);
-			skp->Text(25 * W / 64, (10 + i * 2) * H / 32, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.1lf", GC->rtcc->EZRMDT.data[i].AZH);
-			skp->Text(32 * W / 64, (9 + i * 2) * H / 32, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.1lf", GC->rtcc->EZRMDT.data[i].YB);
-			skp->Text(32 * W / 64, (10 + i * 2) * H / 32, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.1lf", GC->rtcc->EZRMDT.data[i].EL);
-			skp->Text(39 * W / 64, (9 + i * 2) * H / 32, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.1lf", GC->rtcc->EZRMDT.data[i].RB);
-			skp->Text(39 * W / 64, (10 + i * 2) * H / 32, Buffer, strlen(Buffer));
+				page.Printf(25 * W / 64, (9 + i * 2) * H / 32, "%+.1lf", GC->rtcc->EZRMDT.data[i].RDOT);
+			}
+			page.Printf(25 * W / 64, (10 + i * 2) * H / 32, "%.1lf", GC->rtcc->EZRMDT.data[i].PB);
+			page.Printf(32 * W / 64, (9 + i * 2) * H / 32, "%.1lf", GC->rtcc->EZRMDT.data[i].AZH);
+			page.Printf(32 * W / 64, (10 + i * 2) * H / 32, "%.1lf", GC->rtcc->EZRMDT.data[i].YB);
+			page.Printf(39 * W / 64, (9 + i * 2) * H / 32, "%.1lf", GC->rtcc->EZRMDT.data[i].EL);
+			page.Printf(39 * W / 64, (10 + i * 2) * H / 32, "%.1lf", GC->rtcc->EZRMDT.data[i].RB);
 			if (GC->rtcc->EZRMDT.Mode == '1' && abs(GC->rtcc->EZRMDT.data[i].X) <= 9999.9)
 			{
-				sprintf_s(Buffer, "%.1lf%c", GC->rtcc->EZRMDT.data[i].X, GC->rtcc->EZRMDT.data[i].XInd);
-				skp->Text(95 * W / 128, (9 + i * 2) * H / 32, Buffer, strlen(Buffer));
+				page.Printf(95 * W / 128, (9 + i * 2) * H / 32, "%.1lf%c", GC->rtcc->EZRMDT.data[i].X, GC->rtcc->EZRMDT.data[i].XInd);
 			}
-			sprintf_s(Buffer, "%.1lf", GC->rtcc->EZRMDT.data[i].Pitch);
-			skp->Text(95 * W / 128, (10 + i * 2) * H / 32, Buffer, strlen(Buffer));
+			page.Printf(95 * W / 128, (10 + i * 2) * H / 32, "%.1lf", GC->rtcc->EZRMDT.data[i].Pitch);
 			if (GC->rtcc->EZRMDT.Mode == '1' && abs(GC->rtcc->EZRMDT.data[i].Z) <= 9999.9)
 			{
-				sprintf_s(Buffer, "%.1lf%c", GC->rtcc->EZRMDT.data[i].Z, GC->rtcc->EZRMDT.data[i].ZInd);
-				skp->Text(111 * W / 128, (9 + i * 2) * H / 32, Buffer, strlen(Buffer));
+				page.Printf(111 * W / 128, (9 + i * 2) * H / 32, "%.1lf%c", GC->rtcc->EZRMDT.data[i].Z, GC->rtcc->EZRMDT.data[i].ZInd);
 			}
-			sprintf_s(Buffer, "%.1lf", GC->rtcc->EZRMDT.data[i].Yaw);
-			skp->Text(111 * W / 128, (10 + i * 2) * H / 32, Buffer, strlen(Buffer));
+			page.Printf(111 * W / 128, (10 + i * 2) * H / 32, "%.1lf", GC->rtcc->EZRMDT.data[i].Yaw);
 			if (GC->rtcc->EZRMDT.Mode == '1' && abs(GC->rtcc->EZRMDT.data[i].Y) <= 999.9)
 			{
-				sprintf_s(Buffer, "%.1lf%c", GC->rtcc->EZRMDT.data[i].Y, GC->rtcc->EZRMDT.data[i].YInd);
-				skp->Text(63 * W / 64, (9 + i * 2) * H / 32, Buffer, strlen(Buffer));
+				page.Printf(63 * W / 64, (9 + i * 2) * H / 32, "%.1lf%c", GC->rtcc->EZRMDT.data[i].Y, GC->rtcc->EZRMDT.data[i].YInd);
 			}
-			sprintf_s(Buffer, "%.1lf", GC->rtcc->EZRMDT.data[i].Roll);
-			skp->Text(63 * W / 64, (10 + i * 2) * H / 32, Buffer, strlen(Buffer));
+			page.Printf(63 * W / 64, (10 + i * 2) * H / 32, "%.1lf", GC->rtcc->EZRMDT.data[i].Roll);
 		}
 	}
 	else if (screen == 87)
 	{
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
-		skp->Text(4 * W / 8, 2 * H / 32, "RENDEZVOUS EVALUATION DISPLAY (MSK 0058)", 40);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
+		page.Text(4 * W / 8, 2 * H / 32, "RENDEZVOUS EVALUATION DISPLAY (MSK 0058)", 40);
 
 		sprintf_s(Buffer, GC->rtcc->PZREDT.ErrorMessage.c_str());
-		skp->Text(32 * W / 64, 30 * H / 32, Buffer, strlen(Buffer));
-		skp->SetFont(font2);
-
-		skp->Text(6 * W / 32, 4 * H / 32, "ID", 2);
-		skp->Text(12 * W / 32, 4 * H / 32, "M", 1);
-
-		skp->Text(4 * W / 64, 6 * H / 32, "GET", 3);
-		skp->Text(14 * W / 64, 6 * H / 32, "DT", 2);
-		skp->Text(22 * W / 64, 6 * H / 32, "DV", 2);
-		skp->Text(27 * W / 64, 6 * H / 32, "VEH", 3);
-		skp->Text(33 * W / 64, 6 * H / 32, "PURP", 4);
-		//skp->Text(39 * W / 64, 6 * H / 32, "CODE", 4);
-		skp->Text(40 * W / 64, 6 * H / 32, "PHASE", 5);
-		skp->Text(48 * W / 64, 6 * H / 32, "HEIGHT", 6);
-		skp->Text(55 * W / 64, 6 * H / 32, "HA", 2);
-		skp->Text(61 * W / 64, 6 * H / 32, "HP", 2);
-
-		skp->Text(6 * W / 64, 19 * H / 32, "PITCH", 5);
-		skp->Text(14 * W / 64, 19 * H / 32, "YAW", 3);
-		skp->Text(22 * W / 64, 19 * H / 32, "VX", 2);
-		skp->Text(30 * W / 64, 19 * H / 32, "VY", 2);
-		skp->Text(38 * W / 64, 19 * H / 32, "VZ", 2);
-
-		sprintf_s(Buffer, "%d", GC->rtcc->PZREDT.ID);
-		skp->Text(8 * W / 32, 4 * H / 32, Buffer, strlen(Buffer));
+		page.Text(32 * W / 64, 30 * H / 32, Buffer, strlen(Buffer));
+		page.SetFont(font2);
+
+		page.Text(6 * W / 32, 4 * H / 32, "ID", 2);
+		page.Text(12 * W / 32, 4 * H / 32, "M", 1);
+
+		page.Text(4 * W / 64, 6 * H / 32, "GET", 3);
+		page.Text(14 * W / 64, 6 * H / 32, "DT", 2);
+		page.Text(22 * W / 64, 6 * H / 32, "DV", 2);
+		page.Text(27 * W / 64, 6 * H / 32, "VEH", 3);
+		page.Text(33 * W / 64, 6 * H / 32, "PURP", 4);
+		//page.Text(39 * W / 64, 6 * H / 32, "CODE", 4);
+		page.Text(40 * W / 64, 6 * H / 32, "PHASE", 5);
+		page.Text(48 * W / 64, 6 * H / 32, "HEIGHT", 6);
+		page.Text(55 * W / 64, 6 * H / 32, "HA", 2);
+		page.Text(61 * W / 64, 6 * H / 32, "HP", 2);
+
+		page.Text(6 * W / 64, 19 * H / 32, "PITCH", 5);
+		page.Text(14 * W / 64, 19 * H / 32, "YAW", 3);
+		page.Text(22 * W / 64, 19 * H / 32, "VX", 2);
+		page.Text(30 * W / 64, 19 * H / 32, "VY", 2);
+		page.Text(38 * W / 64, 19 * H / 32, "VZ", 2);
+
+		page.Printf(8 * W / 32, 4 * H / 32, "%d", GC->rtcc->PZREDT.ID);
 		if (GC->rtcc->PZREDT.isDKI)
 		{
-			sprintf_s(Buffer, "%d", GC->rtcc->PZREDT.M);
-			skp->Text(14 * W / 32, 4 * H / 32, Buffer, strlen(Buffer));
+			page.Printf(14 * W / 32, 4 * H / 32, "%d", GC->rtcc->PZREDT.M);
 		}
 
-		skp->SetTextAlign(oapi::Sketchpad::RIGHT);
+		page.SetTextAlign(oapi::Sketchpad::RIGHT);
 		for (int i = 0;i < GC->rtcc->PZREDT.NumMans;i++)
 		{
-			GET_Display3(Buffer, GC->rtcc->PZREDT.GET[i]);
-			skp->Text(11 * W / 64, (7 + i * 2) * H / 32, Buffer, strlen(Buffer));
+			page.Format(11 * W / 64, (7 + i * 2) * H / 32, this, &ApolloRTCCMFD::GET_Display3, GC->rtcc->PZREDT.GET[i]);
 			if (i > 0)
 			{
-				GET_Display3(Buffer, GC->rtcc->PZREDT.DT[i]);
-				skp->Text(20 * W / 64, (6 + i * 2) * H / 32, Buffer, strlen(Buffer));
+				page.Format(20 * W / 64, (6 + i * 2) * H / 32, this, &ApolloRTCCMFD::GET_Display3, GC->rtcc->PZREDT.DT[i]);
 			}
-			sprintf_s(Buffer, "%.2lf", GC->rtcc->PZREDT.DV[i]);
-			skp->Text(24 * W / 64, (7 + i * 2) * H / 32, Buffer, strlen(Buffer));
+			page.Printf(24 * W / 64, (7 + i * 2) * H / 32, "%.2lf", GC->rtcc->PZREDT.DV[i]);
 			sprintf_s(Buffer, GC->rtcc->PZREDT.VEH[i].c_str());
-			skp->Text(29 * W / 64, (7 + i * 2) * H / 32, Buffer, strlen(Buffer));
+			page.Text(29 * W / 64, (7 + i * 2) * H / 32, Buffer, strlen(Buffer));
 			sprintf_s(Buffer, GC->rtcc->PZREDT.PURP[i].c_str());
-			skp->Text(35 * W / 64, (7 + i * 2) * H / 32, Buffer, strlen(Buffer));
+			page.Text(35 * W / 64, (7 + i * 2) * H / 32, Buffer, strlen(Buffer));
 			if (GC->rtcc->PZREDT.isDKI)
 			{
-				sprintf_s(Buffer, "%.2lf", GC->rtcc->PZREDT.CODE[i]);
-				skp->Text(40 * W / 64, (7 + i * 2) * H / 32, Buffer, strlen(Buffer));
-			}
-			sprintf_s(Buffer, "%.4lf", GC->rtcc->PZREDT.PHASE[i]);
-			skp->Text(43 * W / 64, (7 + i * 2) * H / 32, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.4lf", GC->rtcc->PZREDT.HEIGHT[i]);
-			skp->Text(51 * W / 64, (7 + i * 2) * H / 32, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.2lf", GC->rtcc->PZREDT.HA[i]);
-			skp->Text(57 * W / 64, (7 + i * 2) * H / 32, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.2lf", GC->rtcc->PZREDT.HP[i]);
-			skp->Text(63 * W / 64, (7 + i * 2) * H / 32, Buffer, strlen(Buffer));
-
-			sprintf_s(Buffer, "%.3lf", GC->rtcc->PZREDT.Pitch[i]);
-			skp->Text(8 * W / 64, (20 + i) * H / 32, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.3lf", GC->rtcc->PZREDT.Yaw[i]);
-			skp->Text(16 * W / 64, (20 + i) * H / 32, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.3lf", GC->rtcc->PZREDT.DVVector[i].x);
-			skp->Text(24 * W / 64, (20 + i) * H / 32, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.3lf", GC->rtcc->PZREDT.DVVector[i].y);
-			skp->Text(32 * W / 64, (20 + i) * H / 32, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.3lf", GC->rtcc->PZREDT.DVVector[i].z);
-			skp->Text(40 * W / 64, (20 + i) * H / 32, Buffer, strlen(Buffer));
+				page.Printf(40 * W / 64, (7 + i * 2) * H / 32, "%.2lf", GC->rtcc->PZREDT.CODE[i]);
+			}
+			page.Printf(43 * W / 64, (7 + i * 2) * H / 32, "%.4lf", GC->rtcc->PZREDT.PHASE[i]);
+			page.Printf(51 * W / 64, (7 + i * 2) * H / 32, "%.4lf", GC->rtcc->PZREDT.HEIGHT[i]);
+			page.Printf(57 * W / 64, (7 + i * 2) * H / 32, "%.2lf", GC->rtcc->PZREDT.HA[i]);
+			page.Printf(63 * W / 64, (7 + i * 2) * H / 32, "%.2lf", GC->rtcc->PZREDT.HP[i]);
+
+			page.Printf(8 * W / 64, (20 + i) * H / 32, "%.3lf", GC->rtcc->PZREDT.Pitch[i]);
+			page.Printf(16 * W / 64, (20 + i) * H / 32, "%.3lf", GC->rtcc->PZREDT.Yaw[i]);
+			page.Printf(24 * W / 64, (20 + i) * H / 32, "%.3lf", GC->rtcc->PZREDT.DVVector[i].x);
+			page.Printf(32 * W / 64, (20 + i) * H / 32, "%.3lf", GC->rtcc->PZREDT.DVVector[i].y);
+			page.Printf(40 * W / 64, (20 + i) * H / 32, "%.3lf", GC->rtcc->PZREDT.DVVector[i].z);
 		}
 	}
 	else if (screen == 88)
 	{
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
-		skp->Text(4 * W / 8, 2 * H / 32, "Init for LM Targeting and Launch Window (K13)", 45);
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
-
-		sprintf_s(Buffer, "%.3lf", GC->rtcc->PZLTRT.PoweredFlightArc*DEG);
-		skp->Text(1 * W / 16, 2 * H / 14, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.1lf s", GC->rtcc->PZLTRT.PoweredFlightTime);
-		skp->Text(1 * W / 16, 4 * H / 14, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.0lf ft", GC->rtcc->PZLTRT.InsertionHeight / 0.3048);
-		skp->Text(1 * W / 16, 6 * H / 14, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.1lf ft/s", GC->rtcc->PZLTRT.InsertionHorizontalVelocity / 0.3048);
-		skp->Text(1 * W / 16, 8 * H / 14, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.1lf ft/s", GC->rtcc->PZLTRT.InsertionRadialVelocity / 0.3048);
-		skp->Text(1 * W / 16, 10 * H / 14, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.2lf", GC->rtcc->PZLTRT.YawSteerCap*DEG);
-		skp->Text(1 * W / 16, 12 * H / 14, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.2lf hrs", GC->rtcc->PZLTRT.MaxAscLifetime / 3600.0);
-		skp->Text(10 * W / 16, 2 * H / 14, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.2lf NM", GC->rtcc->PZLTRT.MinSafeHeight / 1852.0);
-		skp->Text(10 * W / 16, 4 * H / 14, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.2lf ft/s", GC->rtcc->PZLTRT.LMMaxDeltaV / 0.3048);
-		skp->Text(10 * W / 16, 6 * H / 14, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.2lf ft/s", GC->rtcc->PZLTRT.CSMMaxDeltaV / 0.3048);
-		skp->Text(10 * W / 16, 8 * H / 14, Buffer, strlen(Buffer));
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
+		page.Text(4 * W / 8, 2 * H / 32, "Init for LM Targeting and Launch Window (K13)", 45);
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
+
+		page.Printf(1 * W / 16, 2 * H / 14, "%.3lf", GC->rtcc->PZLTRT.PoweredFlightArc*DEG);
+		page.Printf(1 * W / 16, 4 * H / 14, "%.1lf s", GC->rtcc->PZLTRT.PoweredFlightTime);
+		page.Printf(1 * W / 16, 6 * H / 14, "%.0lf ft", GC->rtcc->PZLTRT.InsertionHeight / 0.3048);
+		page.Printf(1 * W / 16, 8 * H / 14, "%.1lf ft/s", GC->rtcc->PZLTRT.InsertionHorizontalVelocity / 0.3048);
+		page.Printf(1 * W / 16, 10 * H / 14, "%.1lf ft/s", GC->rtcc->PZLTRT.InsertionRadialVelocity / 0.3048);
+		page.Printf(1 * W / 16, 12 * H / 14, "%.2lf", GC->rtcc->PZLTRT.YawSteerCap*DEG);
+		page.Printf(10 * W / 16, 2 * H / 14, "%.2lf hrs", GC->rtcc->PZLTRT.MaxAscLifetime / 3600.0);
+		page.Printf(10 * W / 16, 4 * H / 14, "%.2lf NM", GC->rtcc->PZLTRT.MinSafeHeight / 1852.0);
+		page.Printf(10 * W / 16, 6 * H / 14, "%.2lf ft/s", GC->rtcc->PZLTRT.LMMaxDeltaV / 0.3048);
+		page.Printf(10 * W / 16, 8 * H / 14, "%.2lf ft/s", GC->rtcc->PZLTRT.CSMMaxDeltaV / 0.3048);
 	}
 	else if (screen == 89)
 	{
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
-		skp->Text(4 * W / 8, 2 * H / 32, "LAUNCH WINDOW INITIALIZATION (K14)", 34);
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
-
-		skp->Text(1 * W / 16, 2 * H / 14, "Targeting Parameters", 34);
-		sprintf_s(Buffer, "%.1lf min", GC->rtcc->PZLTRT.dt_bias / 60.0);
-		skp->Text(1 * W / 16, 4 * H / 14, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.2lf", GC->rtcc->PZLTRT.ElevationAngle*DEG);
-		skp->Text(1 * W / 16, 6 * H / 14, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.2lf", GC->rtcc->PZLTRT.TerminalPhaseTravelAngle*DEG);
-		skp->Text(1 * W / 16, 8 * H / 14, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.2lf NM", GC->rtcc->PZLTRT.TPF_Height_Offset / 1852.0);
-		skp->Text(1 * W / 16, 10 * H / 14, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.2lf", GC->rtcc->PZLTRT.TPF_Phase_Offset*DEG);
-		skp->Text(1 * W / 16, 12 * H / 14, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.2lf NM", GC->rtcc->PZLTRT.Height_Diff_Begin / 1852.0);
-		skp->Text(10 * W / 16, 2 * H / 14, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.2lf NM", GC->rtcc->PZLTRT.Height_Diff_Incr / 1852.0);
-		skp->Text(10 * W / 16, 4 * H / 14, Buffer, strlen(Buffer));
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
+		page.Text(4 * W / 8, 2 * H / 32, "LAUNCH WINDOW INITIALIZATION (K14)", 34);
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
+
+		page.Text(1 * W / 16, 2 * H / 14, "Targeting Parameters", 34);
+		page.Printf(1 * W / 16, 4 * H / 14, "%.1lf min", GC->rtcc->PZLTRT.dt_bias / 60.0);
+		page.Printf(1 * W / 16, 6 * H / 14, "%.2lf", GC->rtcc->PZLTRT.ElevationAngle*DEG);
+		page.Printf(1 * W / 16, 8 * H / 14, "%.2lf", GC->rtcc->PZLTRT.TerminalPhaseTravelAngle*DEG);
+		page.Printf(1 * W / 16, 10 * H / 14, "%.2lf NM", GC->rtcc->PZLTRT.TPF_Height_Offset / 1852.0);
+		page.Printf(1 * W / 16, 12 * H / 14, "%.2lf", GC->rtcc->PZLTRT.TPF_Phase_Offset*DEG);
+		page.Printf(10 * W / 16, 2 * H / 14, "%.2lf NM", GC->rtcc->PZLTRT.Height_Diff_Begin / 1852.0);
+		page.Printf(10 * W / 16, 4 * H / 14, "%.2lf NM", GC->rtcc->PZLTRT.Height_Diff_Incr / 1852.0);
 	}
 	else if (screen == 90)
 	{
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
-		skp->Text(4 * W / 8, 2 * H / 32, "LUNAR RENDEZVOUS PLAN TABLE", 27);
-		skp->SetFont(font2);
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
-
-		skp->Text(1 * W / 32, 4 * H / 32, "CSM STA", 7);
-		skp->Text(1 * W / 32, 5 * H / 32, "GMTV", 4);
-		skp->Text(1 * W / 32, 6 * H / 32, "GETV", 4);
-		skp->Text(1 * W / 32, 7 * H / 32, "MVR VEH", 7);
-
-		skp->Text(9 * W / 32, 4 * H / 32, "LM POSITION", 11);
-		skp->TextW(9 * W / 32, 5 * H / 32, L"\u03C6LLS", 4);
-		skp->TextW(9 * W / 32, 6 * H / 32, L"\u03BBLLS", 4);
-		skp->Text(9 * W / 32, 7 * H / 32, "THT", 3);
-
-		skp->Text(33 * W / 64, 4 * H / 32, "LM STA", 6);
-		skp->Text(33 * W / 64, 5 * H / 32, "GMTV", 4);
-		skp->Text(33 * W / 64, 6 * H / 32, "GETV", 4);
-		skp->Text(33 * W / 64, 7 * H / 32, "DTCSI", 5);
-
-		skp->Text(49 * W / 64, 4 * H / 32, "LM LIFE", 11);
-		skp->Text(49 * W / 64, 5 * H / 32, "DV MAX", 6);
-		skp->Text(49 * W / 64, 6 * H / 32, "MIN H", 5);
-		skp->Text(49 * W / 64, 7 * H / 32, "WT", 2);
-
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
-
-		skp->Text(2 * W / 32, 9 * H / 32, "ID", 2);
-		skp->Text(4 * W / 32, 9 * H / 32, "M", 1);
-		skp->Text(6 * W / 32, 9 * H / 32, "DH", 2);
-		skp->Text(10 * W / 32, 9 * H / 32, "GETLO", 5);
-		skp->Text(10 * W / 32, 10 * H / 32, "GETINS", 6);
-		skp->Text(15 * W / 32, 9 * H / 32, "GETCSI", 6);
-		skp->Text(15 * W / 32, 10 * H / 32, "DVCSI", 5);
-		skp->Text(20 * W / 32, 9 * H / 32, "GETCDH", 6);
-		skp->Text(20 * W / 32, 10 * H / 32, "DVCDH", 5);
-		skp->Text(25 * W / 32, 9 * H / 32, "GETTPI", 6);
-		skp->Text(25 * W / 32, 10 * H / 32, "DVTPI", 5);
-		skp->Text(30 * W / 32, 9 * H / 32, "DVTPF", 5);
-		skp->Text(30 * W / 32, 10 * H / 32, "DVT", 3);
-
-		skp->SetTextAlign(oapi::Sketchpad::RIGHT);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
+		page.Text(4 * W / 8, 2 * H / 32, "LUNAR RENDEZVOUS PLAN TABLE", 27);
+		page.SetFont(font2);
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
+
+		page.Text(1 * W / 32, 4 * H / 32, "CSM STA", 7);
+		page.Text(1 * W / 32, 5 * H / 32, "GMTV", 4);
+		page.Text(1 * W / 32, 6 * H / 32, "GETV", 4);
+		page.Text(1 * W / 32, 7 * H / 32, "MVR VEH", 7);
+
+		page.Text(9 * W / 32, 4 * H / 32, "LM POSITION", 11);
+		page.TextW(9 * W / 32, 5 * H / 32, L"\u03C6LLS", 4);
+		page.TextW(9 * W / 32, 6 * H / 32, L"\u03BBLLS", 4);
+		page.Text(9 * W / 32, 7 * H / 32, "THT", 3);
+
+		page.Text(33 * W / 64, 4 * H / 32, "LM STA", 6);
+		page.Text(33 * W / 64, 5 * H / 32, "GMTV", 4);
+		page.Text(33 * W / 64, 6 * H / 32, "GETV", 4);
+		page.Text(33 * W / 64, 7 * H / 32, "DTCSI", 5);
+
+		page.Text(49 * W / 64, 4 * H / 32, "LM LIFE", 11);
+		page.Text(49 * W / 64, 5 * H / 32, "DV MAX", 6);
+		page.Text(49 * W / 64, 6 * H / 32, "MIN H", 5);
+		page.Text(49 * W / 64, 7 * H / 32, "WT", 2);
+
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
+
+		page.Text(2 * W / 32, 9 * H / 32, "ID", 2);
+		page.Text(4 * W / 32, 9 * H / 32, "M", 1);
+		page.Text(6 * W / 32, 9 * H / 32, "DH", 2);
+		page.Text(10 * W / 32, 9 * H / 32, "GETLO", 5);
+		page.Text(10 * W / 32, 10 * H / 32, "GETINS", 6);
+		page.Text(15 * W / 32, 9 * H / 32, "GETCSI", 6);
+		page.Text(15 * W / 32, 10 * H / 32, "DVCSI", 5);
+		page.Text(20 * W / 32, 9 * H / 32, "GETCDH", 6);
+		page.Text(20 * W / 32, 10 * H / 32, "DVCDH", 5);
+		page.Text(25 * W / 32, 9 * H / 32, "GETTPI", 6);
+		page.Text(25 * W / 32, 10 * H / 32, "DVTPI", 5);
+		page.Text(30 * W / 32, 9 * H / 32, "DVTPF", 5);
+		page.Text(30 * W / 32, 10 * H / 32, "DVT", 3);
+
+		page.SetTextAlign(oapi::Sketchpad::RIGHT);
 
 		if (GC->MissionPlanningActive)
 		{
-			GET_Display(Buffer, GC->rtcc->GMTfromGET(GC->rtcc->med_k15.CSMVectorTime), false);
-			skp->Text(8 * W / 32, 5 * H / 32, Buffer, strlen(Buffer));
-			GET_Display(Buffer, GC->rtcc->med_k15.CSMVectorTime, false);
-			skp->Text(8 * W / 32, 6 * H / 32, Buffer, strlen(Buffer));
+			page.Format(8 * W / 32, 5 * H / 32, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->GMTfromGET(GC->rtcc->med_k15.CSMVectorTime), false);
+			page.Format(8 * W / 32, 6 * H / 32, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->med_k15.CSMVectorTime, false);
 		}
 
 		if (GC->rtcc->med_k15.Chaser == 1)
 		{
-			skp->Text(8 * W / 32, 7 * H / 32, "CSM", 3);
+			page.Text(8 * W / 32, 7 * H / 32, "CSM", 3);
 		}
 		else
 		{
-			skp->Text(8 * W / 32, 7 * H / 32, "LEM", 3);
+			page.Text(8 * W / 32, 7 * H / 32, "LEM", 3);
 		}
 
-		sprintf_s(Buffer, "%+.4lf", GC->rtcc->BZLAND.lat[0] * DEG);
-		skp->Text(31 * W / 64, 5 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%+.4lf", GC->rtcc->BZLAND.lng[0] * DEG);
-		skp->Text(31 * W / 64, 6 * H / 32, Buffer, strlen(Buffer));
-		GET_Display(Buffer, GC->rtcc->med_k15.ThresholdTime, false);
-		skp->Text(31 * W / 64, 7 * H / 32, Buffer, strlen(Buffer));
+		page.Printf(31 * W / 64, 5 * H / 32, "%+.4lf", GC->rtcc->BZLAND.lat[0] * DEG);
+		page.Printf(31 * W / 64, 6 * H / 32, "%+.4lf", GC->rtcc->BZLAND.lng[0] * DEG);
+		page.Format(31 * W / 64, 7 * H / 32, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->med_k15.ThresholdTime, false);
 
 		if (GC->rtcc->med_k15.CSI_Flag > 0)
 		{
-			GET_Display(Buffer, GC->rtcc->med_k15.CSI_Flag, false);
-			skp->Text(24 * W / 32, 7 * H / 32, Buffer, strlen(Buffer));
+			page.Format(24 * W / 32, 7 * H / 32, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->med_k15.CSI_Flag, false);
 		}
 
-		sprintf_s(Buffer, "%.1lf h", GC->rtcc->PZLTRT.MaxAscLifetime / 3600.0);
-		skp->Text(31 * W / 32, 4 * H / 32, Buffer, strlen(Buffer));
+		page.Printf(31 * W / 32, 4 * H / 32, "%.1lf h", GC->rtcc->PZLTRT.MaxAscLifetime / 3600.0);
 		if (GC->rtcc->med_k15.Chaser == 1)
 		{
 			sprintf_s(Buffer, "%.0lf", GC->rtcc->PZLTRT.CSMMaxDeltaV / 0.3048);
@@ -7519,205 +6460,156 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 		{
 			sprintf_s(Buffer, "%.0lf", GC->rtcc->PZLTRT.LMMaxDeltaV / 0.3048);
 		}
-		skp->Text(31 * W / 32, 5 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.1lf", GC->rtcc->PZLTRT.MinSafeHeight / 1852.0);
-		skp->Text(31 * W / 32, 6 * H / 32, Buffer, strlen(Buffer));
+		page.Text(31 * W / 32, 5 * H / 32, Buffer, strlen(Buffer));
+		page.Printf(31 * W / 32, 6 * H / 32, "%.1lf", GC->rtcc->PZLTRT.MinSafeHeight / 1852.0);
 
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
 		
 		for (int i = 0;i < GC->rtcc->PZLRPT.plans;i++)
 		{
-			sprintf_s(Buffer, "%d", GC->rtcc->PZLRPT.data[i].ID);
-			skp->Text(2 * W / 32, (12 + 3 * i) * H / 32, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%d", GC->rtcc->PZLRPT.data[i].N);
-			skp->Text(4 * W / 32, (12 + 3 * i) * H / 32, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.1lf", GC->rtcc->PZLRPT.data[i].DH);
-			skp->Text(6 * W / 32, (12 + 3 * i) * H / 32, Buffer, strlen(Buffer));
-			GET_Display(Buffer, GC->rtcc->PZLRPT.data[i].GETLO, false);
-			skp->Text(10 * W / 32, (12 + 3 * i) * H / 32, Buffer, strlen(Buffer));
-			GET_Display(Buffer, GC->rtcc->PZLRPT.data[i].T_INS, false);
-			skp->Text(10 * W / 32, (13 + 3 * i) * H / 32, Buffer, strlen(Buffer));
-			GET_Display(Buffer, GC->rtcc->PZLRPT.data[i].T_CSI, false);
-			skp->Text(15 * W / 32, (12 + 3 * i) * H / 32, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.1lf", GC->rtcc->PZLRPT.data[i].DVCSI);
-			skp->Text(15 * W / 32, (13 + 3 * i) * H / 32, Buffer, strlen(Buffer));
-			GET_Display(Buffer, GC->rtcc->PZLRPT.data[i].T_CDH, false);
-			skp->Text(20 * W / 32, (12 + 3 * i) * H / 32, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.1lf", GC->rtcc->PZLRPT.data[i].DVCDH);
-			skp->Text(20 * W / 32, (13 + 3 * i) * H / 32, Buffer, strlen(Buffer));
-			GET_Display(Buffer, GC->rtcc->PZLRPT.data[i].T_TPI, false);
-			skp->Text(25 * W / 32, (12 + 3 * i) * H / 32, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.1lf", GC->rtcc->PZLRPT.data[i].DVTPI);
-			skp->Text(25 * W / 32, (13 + 3 * i) * H / 32, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.1lf", GC->rtcc->PZLRPT.data[i].DVTPF);
-			skp->Text(30 * W / 32, (12 + 3 * i) * H / 32, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.1lf", GC->rtcc->PZLRPT.data[i].DVT);
-			skp->Text(30 * W / 32, (13 + 3 * i) * H / 32, Buffer, strlen(Buffer));
+			page.Printf(2 * W / 32, (12 + 3 * i) * H / 32, "%d", GC->rtcc->PZLRPT.data[i].ID);
+			page.Printf(4 * W / 32, (12 + 3 * i) * H / 32, "%d", GC->rtcc->PZLRPT.data[i].N);
+			page.Printf(6 * W / 32, (12 + 3 * i) * H / 32, "%.1lf", GC->rtcc->PZLRPT.data[i].DH);
+			page.Format(10 * W / 32, (12 + 3 * i) * H / 32, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->PZLRPT.data[i].GETLO, false);
+			page.Format(10 * W / 32, (13 + 3 * i) * H / 32, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->PZLRPT.data[i].T_INS, false);
+			page.Format(15 * W / 32, (12 + 3 * i) * H / 32, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->PZLRPT.data[i].T_CSI, false);
+			page.Printf(15 * W / 32, (13 + 3 * i) * H / 32, "%.1lf", GC->rtcc->PZLRPT.data[i].DVCSI);
+			page.Format(20 * W / 32, (12 + 3 * i) * H / 32, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->PZLRPT.data[i].T_CDH, false);
+			page.Printf(20 * W / 32, (13 + 3 * i) * H / 32, "%.1lf", GC->rtcc->PZLRPT.data[i].DVCDH);
+			page.Format(25 * W / 32, (12 + 3 * i) * H / 32, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->PZLRPT.data[i].T_TPI, false);
+			page.Printf(25 * W / 32, (13 + 3 * i) * H / 32, "%.1lf", GC->rtcc->PZLRPT.data[i].DVTPI);
+			page.Printf(30 * W / 32, (12 + 3 * i) * H / 32, "%.1lf", GC->rtcc->PZLRPT.data[i].DVTPF);
+			page.Printf(30 * W / 32, (13 + 3 * i) * H / 32, "%.1lf", GC->rtcc->PZLRPT.data[i].DVT);
 		}
 	}
 	else if (screen == 91)
 	{
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
-		skp->SetFont(font2);
-		skp->SetPen(pen2);
-		skp->Text(4 * W / 8, 3 * H / 32, "LUNAR LAUNCH TARGETING TABLE", 39);
-		skp->Text(30 * W / 32, 3 * H / 32, "0077", 4);
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
-		skp->Text(1 * W / 32, 4 * H / 32, "CSM STA ID", 10);
-		skp->Text(1 * W / 32, 5 * H / 32, "GETTH", 5);
-		skp->Text(1 * W / 32, 6 * H / 32, "GETV", 4);
-		skp->Text(17 * W / 32, 4 * H / 32, "LM POSITION", 11);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
+		page.SetFont(font2);
+		page.SetPen(pen2);
+		page.Text(4 * W / 8, 3 * H / 32, "LUNAR LAUNCH TARGETING TABLE", 39);
+		page.Text(30 * W / 32, 3 * H / 32, "0077", 4);
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
+		page.Text(1 * W / 32, 4 * H / 32, "CSM STA ID", 10);
+		page.Text(1 * W / 32, 5 * H / 32, "GETTH", 5);
+		page.Text(1 * W / 32, 6 * H / 32, "GETV", 4);
+		page.Text(17 * W / 32, 4 * H / 32, "LM POSITION", 11);
 
-		skp->TextW(24 * W / 32, 4 * H / 32, L"\u03C6LLS", 4);
-		skp->TextW(24 * W / 32, 5 * H / 32, L"\u03BBLLS", 4);
-		skp->Text(24 * W / 32, 6 * H / 32, "RLLS", 4);
+		page.TextW(24 * W / 32, 4 * H / 32, L"\u03C6LLS", 4);
+		page.TextW(24 * W / 32, 5 * H / 32, L"\u03BBLLS", 4);
+		page.Text(24 * W / 32, 6 * H / 32, "RLLS", 4);
 
-		skp->Line(1 * W / 64, 15 * H / 64, 63 * W / 64, 15 * H / 64);
+		page.Line(1 * W / 64, 15 * H / 64, 63 * W / 64, 15 * H / 64);
 
-		skp->TextW(1 * W / 32, 9 * H / 32, L"PF\u2222", 3);
-		skp->TextW(1 * W / 32, 10 * H / 32, L"PF\u0394T", 4);
-		skp->Text(1 * W / 32, 11 * H / 32, "HINS", 4);
-		skp->TextW(1 * W / 32, 12 * H / 32, L"\u1E58INS", 4);
-		skp->Text(1 * W / 32, 13 * H / 32, "YSTEER", 6);
+		page.TextW(1 * W / 32, 9 * H / 32, L"PF\u2222", 3);
+		page.TextW(1 * W / 32, 10 * H / 32, L"PF\u0394T", 4);
+		page.Text(1 * W / 32, 11 * H / 32, "HINS", 4);
+		page.TextW(1 * W / 32, 12 * H / 32, L"\u1E58INS", 4);
+		page.Text(1 * W / 32, 13 * H / 32, "YSTEER", 6);
 
-		skp->TextW(11 * W / 32, 9 * H / 32, L"\u0394T(INS-TPI)", 11);
-		skp->TextW(11 * W / 32, 10 * H / 32, L"\u0394TNOM", 5);
+		page.TextW(11 * W / 32, 9 * H / 32, L"\u0394T(INS-TPI)", 11);
+		page.TextW(11 * W / 32, 10 * H / 32, L"\u0394TNOM", 5);
 
-		skp->TextW(23 * W / 32, 9 * H / 32, L"\u0394HTPI", 5);
-		skp->TextW(23 * W / 32, 10 * H / 32, L"\u0394\u03B8TPI", 5);
-		skp->TextW(23 * W / 32, 11 * H / 32, L"\u03C9T", 2);
-		skp->Text(23 * W / 32, 12 * H / 32, "HPMIN", 5);
-		skp->TextW(23 * W / 32, 13 * H / 32, L"EL \u2222", 4);
+		page.TextW(23 * W / 32, 9 * H / 32, L"\u0394HTPI", 5);
+		page.TextW(23 * W / 32, 10 * H / 32, L"\u0394\u03B8TPI", 5);
+		page.TextW(23 * W / 32, 11 * H / 32, L"\u03C9T", 2);
+		page.Text(23 * W / 32, 12 * H / 32, "HPMIN", 5);
+		page.TextW(23 * W / 32, 13 * H / 32, L"EL \u2222", 4);
 
-		skp->Line(1 * W / 64, 16 * H / 32, 63 * W / 64, 16 * H / 32);
+		page.Line(1 * W / 64, 16 * H / 32, 63 * W / 64, 16 * H / 32);
 
-		skp->Text(1 * W / 32, 17 * H / 32, "GETLOR", 6);
-		skp->Text(16 * W / 32, 17 * H / 32, "VH", 2);
+		page.Text(1 * W / 32, 17 * H / 32, "GETLOR", 6);
+		page.Text(16 * W / 32, 17 * H / 32, "VH", 2);
 
-		skp->Line(1 * W / 64, 19 * H / 32, 63 * W / 64, 19 * H / 32);
+		page.Line(1 * W / 64, 19 * H / 32, 63 * W / 64, 19 * H / 32);
 
-		skp->Text(1 * W / 32, 19 * H / 32, "CODE", 4);
-		skp->Text(5 * W / 32, 19 * H / 32, "GET", 3);
-		skp->TextW(11 * W / 32, 19 * H / 32, L"\u0394V", 2);
-		skp->TextW(15 * W / 32, 19 * H / 32, L"\u0394VX", 3);
-		skp->TextW(20 * W / 32, 19 * H / 32, L"\u0394VY", 3);
-		skp->TextW(25 * W / 32, 19 * H / 32, L"\u0394VZ", 3);
-		skp->Text(28 * W / 32, 19 * H / 32, "HA/HP", 5);
+		page.Text(1 * W / 32, 19 * H / 32, "CODE", 4);
+		page.Text(5 * W / 32, 19 * H / 32, "GET", 3);
+		page.TextW(11 * W / 32, 19 * H / 32, L"\u0394V", 2);
+		page.TextW(15 * W / 32, 19 * H / 32, L"\u0394VX", 3);
+		page.TextW(20 * W / 32, 19 * H / 32, L"\u0394VY", 3);
+		page.TextW(25 * W / 32, 19 * H / 32, L"\u0394VZ", 3);
+		page.Text(28 * W / 32, 19 * H / 32, "HA/HP", 5);
 
-		skp->Line(1 * W / 64, 41 * H / 64, 63 * W / 64, 41 * H / 64);
+		page.Line(1 * W / 64, 41 * H / 64, 63 * W / 64, 41 * H / 64);
 
-		skp->Text(1 * W / 32, 21 * H / 32, "TPI", 3);
-		skp->Text(1 * W / 32, 23 * H / 32, "TPF", 3);
+		page.Text(1 * W / 32, 21 * H / 32, "TPI", 3);
+		page.Text(1 * W / 32, 23 * H / 32, "TPF", 3);
 
-		skp->Line(1 * W / 64, 25 * H / 32, 63 * W / 64, 25 * H / 32);
+		page.Line(1 * W / 64, 25 * H / 32, 63 * W / 64, 25 * H / 32);
 
-		skp->TextW(25 * W / 32, 27 * H / 32, L"H\u2090T", 3);
-		skp->TextW(25 * W / 32, 28 * H / 32, L"H\u209AT", 3);
+		page.TextW(25 * W / 32, 27 * H / 32, L"H\u2090T", 3);
+		page.TextW(25 * W / 32, 28 * H / 32, L"H\u209AT", 3);
 
-		skp->SetTextAlign(oapi::Sketchpad::RIGHT);
+		page.SetTextAlign(oapi::Sketchpad::RIGHT);
 
 		if (GC->MissionPlanningActive)
 		{
 			//TBD: STA ID
 
-			GET_Display(Buffer, GC->rtcc->med_k50.GETV, false);
-			skp->Text(8 * W / 32, 6 * H / 32, Buffer, strlen(Buffer));
+			page.Format(8 * W / 32, 6 * H / 32, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->med_k50.GETV, false);
 		}
 		else
 		{
 			if (G->target != NULL)
 			{
 				sprintf(Buffer, G->target->GetName());
-				skp->Text(12 * W / 32, 4 * H / 32, Buffer, strlen(Buffer));
+				page.Text(12 * W / 32, 4 * H / 32, Buffer, strlen(Buffer));
 			}
 			else
 			{
-				skp->Text(12 * W / 32, 4 * H / 32, "No Target!", 10);
-			}
-		}
-
-		GET_Display(Buffer, GC->rtcc->med_k50.GETTH, false);
-		skp->Text(9 * W / 32, 5 * H / 32, Buffer, strlen(Buffer));
-
-		sprintf_s(Buffer, "%+.4lf", GC->rtcc->BZLAND.lat[RTCC_LMPOS_BEST] * DEG);
-		skp->Text(31 * W / 32, 4 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%+.4lf", GC->rtcc->BZLAND.lng[RTCC_LMPOS_BEST] * DEG);
-		skp->Text(31 * W / 32, 5 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.4lf", GC->rtcc->BZLAND.rad[RTCC_LMPOS_BEST] / 1852.0);
-		skp->Text(31 * W / 32, 6 * H / 32, Buffer, strlen(Buffer));
-
-		sprintf_s(Buffer, "%.3lf", GC->rtcc->PZLTRT.PoweredFlightArc*DEG);
-		skp->Text(8 * W / 32, 9 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.2lf", GC->rtcc->PZLTRT.PoweredFlightTime);
-		skp->Text(8 * W / 32, 10 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.0lf", GC->rtcc->PZLTRT.InsertionHeight / 0.3048);
-		skp->Text(8 * W / 32, 11 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%+.1lf", GC->rtcc->PZLTRT.InsertionRadialVelocity / 0.3048);
-		skp->Text(8 * W / 32, 12 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.2lf", GC->rtcc->PZLTRT.YawSteerCap*DEG);
-		skp->Text(8 * W / 32, 13 * H / 32, Buffer, strlen(Buffer));
-
-		sprintf_s(Buffer, "%.2lf", GC->rtcc->PZLTRT.DT_Ins_TPI / 60.0);
-		skp->Text(20 * W / 32, 9 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.2lf", GC->rtcc->PZLTRT.DT_Ins_TPI_NOM / 60.0);
-		skp->Text(20 * W / 32, 10 * H / 32, Buffer, strlen(Buffer));
-
-		sprintf_s(Buffer, "%+.2lf", GC->rtcc->PZLTRT.DT_DH / 1852.0);
-		skp->Text(31 * W / 32, 9 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%+.2lf", GC->rtcc->PZLTRT.DT_Theta_i*DEG);
-		skp->Text(31 * W / 32, 10 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.1lf", GC->rtcc->PZLTRT.TerminalPhaseTravelAngle*DEG);
-		skp->Text(31 * W / 32, 11 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%+.1lf", GC->rtcc->PZLTRT.MinSafeHeight / 1852.0);
-		skp->Text(31 * W / 32, 12 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.1lf", GC->rtcc->PZLTRT.ElevationAngle*DEG);
-		skp->Text(31 * W / 32, 13 * H / 32, Buffer, strlen(Buffer));
-
-		GET_Display2(Buffer, GC->rtcc->PZLLTT.GETLOR);
-		skp->Text(11 * W / 32, 17 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.1lf", GC->rtcc->PZLLTT.VH / 0.3048);
-		skp->Text(21 * W / 32, 17 * H / 32, Buffer, strlen(Buffer));
-
-		GET_Display(Buffer, GC->rtcc->PZLLTT.GET_TPI, false);
-		skp->Text(8 * W / 32, 21 * H / 32, Buffer, strlen(Buffer));
-		GET_Display(Buffer, GC->rtcc->PZLLTT.GET_TPF, false);
-		skp->Text(8 * W / 32, 23 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.1lf", GC->rtcc->PZLLTT.DV_TPI / 0.3048);
-		skp->Text(12 * W / 32, 21 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.1lf", GC->rtcc->PZLLTT.DV_TPF / 0.3048);
-		skp->Text(12 * W / 32, 23 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%+.1lf", GC->rtcc->PZLLTT.DV_TPI_LVLH.x / 0.3048);
-		skp->Text(17 * W / 32, 21 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%+.1lf", GC->rtcc->PZLLTT.DV_TPF_LVLH.x / 0.3048);
-		skp->Text(17 * W / 32, 23 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%+.1lf", GC->rtcc->PZLLTT.DV_TPI_LVLH.y / 0.3048);
-		skp->Text(22 * W / 32, 21 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%+.1lf", GC->rtcc->PZLLTT.DV_TPF_LVLH.y / 0.3048);
-		skp->Text(22 * W / 32, 23 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%+.1lf", GC->rtcc->PZLLTT.DV_TPI_LVLH.z / 0.3048);
-		skp->Text(27 * W / 32, 21 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%+.1lf", GC->rtcc->PZLLTT.DV_TPF_LVLH.z / 0.3048);
-		skp->Text(27 * W / 32, 23 * H / 32, Buffer, strlen(Buffer));
-
-		sprintf_s(Buffer, "%.1lf", GC->rtcc->PZLLTT.HA_TPI / 1852.0);
-		skp->Text(31 * W / 32, 21 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%+.1lf", GC->rtcc->PZLLTT.HP_TPI / 1852.0);
-		skp->Text(31 * W / 32, 22 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%.1lf", GC->rtcc->PZLLTT.HA_TPF / 1852.0);
-		skp->Text(31 * W / 32, 23 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%+.1lf", GC->rtcc->PZLLTT.HP_TPF / 1852.0);
-		skp->Text(31 * W / 32, 24 * H / 32, Buffer, strlen(Buffer));
-
-		sprintf_s(Buffer, "%.1lf", GC->rtcc->PZLLTT.HA_T / 1852.0);
-		skp->Text(31 * W / 32, 27 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%+.1lf", GC->rtcc->PZLLTT.HP_T / 1852.0);
-		skp->Text(31 * W / 32, 28 * H / 32, Buffer, strlen(Buffer));
+				page.Text(12 * W / 32, 4 * H / 32, "No Target!", 10);
+			}
+		}
+
+		page.Format(9 * W / 32, 5 * H / 32, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->med_k50.GETTH, false);
+
+		page.Printf(31 * W / 32, 4 * H / 32, "%+.4lf", GC->rtcc->BZLAND.lat[RTCC_LMPOS_BEST] * DEG);
+		page.Printf(31 * W / 32, 5 * H / 32, "%+.4lf", GC->rtcc->BZLAND.lng[RTCC_LMPOS_BEST] * DEG);
+		page.Printf(31 * W / 32, 6 * H / 32, "%.4lf", GC->rtcc->BZLAND.rad[RTCC_LMPOS_BEST] / 1852.0);
+
+		page.Printf(8 * W / 32, 9 * H / 32, "%.3lf", GC->rtcc->PZLTRT.PoweredFlightArc*DEG);
+		page.Printf(8 * W / 32, 10 * H / 32, "%.2lf", GC->rtcc->PZLTRT.PoweredFlightTime);
+		page.Printf(8 * W / 32, 11 * H / 32, "%.0lf", GC->rtcc->PZLTRT.InsertionHeight / 0.3048);
+		page.Printf(8 * W / 32, 12 * H / 32, "%+.1lf", GC->rtcc->PZLTRT.InsertionRadialVelocity / 0.3048);
+		page.Printf(8 * W / 32, 13 * H / 32, "%.2lf", GC->rtcc->PZLTRT.YawSteerCap*DEG);
+
+		page.Printf(20 * W / 32, 9 * H / 32, "%.2lf", GC->rtcc->PZLTRT.DT_Ins_TPI / 60.0);
+		page.Printf(20 * W / 32, 10 * H / 32, "%.2lf", GC->rtcc->PZLTRT.DT_Ins_TPI_NOM / 60.0);
+
+		page.Printf(31 * W / 32, 9 * H / 32, "%+.2lf", GC->rtcc->PZLTRT.DT_DH / 1852.0);
+		page.Printf(31 * W / 32, 10 * H / 32, "%+.2lf", GC->rtcc->PZLTRT.DT_Theta_i*DEG);
+		page.Printf(31 * W / 32, 11 * H / 32, "%.1lf", GC->rtcc->PZLTRT.TerminalPhaseTravelAngle*DEG);
+		page.Printf(31 * W / 32, 12 * H / 32, "%+.1lf", GC->rtcc->PZLTRT.MinSafeHeight / 1852.0);
+		page.Printf(31 * W / 32, 13 * H / 32, "%.1lf", GC->rtcc->PZLTRT.ElevationAngle*DEG);
+
+		page.Format(11 * W / 32, 17 * H / 32, this, &ApolloRTCCMFD::GET_Display2, GC->rtcc->PZLLTT.GETLOR);
+		page.Printf(21 * W / 32, 17 * H / 32, "%.1lf", GC->rtcc->PZLLTT.VH / 0.3048);
+
+		page.Format(8 * W / 32, 21 * H / 32, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->PZLLTT.GET_TPI, false);
+		page.Format(8 * W / 32, 23 * H / 32, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->PZLLTT.GET_TPF, false);
+		page.Printf(12 * W / 32, 21 * H / 32, "%.1lf", GC->rtcc->PZLLTT.DV_TPI / 0.3048);
+		page.Printf(12 * W / 32, 23 * H / 32, "%.1lf", GC->rtcc->PZLLTT.DV_TPF / 0.3048);
+		page.Printf(17 * W / 32, 21 * H / 32, "%+.1lf", GC->rtcc->PZLLTT.DV_TPI_LVLH.x / 0.3048);
+		page.Printf(17 * W / 32, 23 * H / 32, "%+.1lf", GC->rtcc->PZLLTT.DV_TPF_LVLH.x / 0.3048);
+		page.Printf(22 * W / 32, 21 * H / 32, "%+.1lf", GC->rtcc->PZLLTT.DV_TPI_LVLH.y / 0.3048);
+		page.Printf(22 * W / 32, 23 * H / 32, "%+.1lf", GC->rtcc->PZLLTT.DV_TPF_LVLH.y / 0.3048);
+		page.Printf(27 * W / 32, 21 * H / 32, "%+.1lf", GC->rtcc->PZLLTT.DV_TPI_LVLH.z / 0.3048);
+		page.Printf(27 * W / 32, 23 * H / 32, "%+.1lf", GC->rtcc->PZLLTT.DV_TPF_LVLH.z / 0.3048);
+
+		page.Printf(31 * W / 32, 21 * H / 32, "%.1lf", GC->rtcc->PZLLTT.HA_TPI / 1852.0);
+		page.Printf(31 * W / 32, 22 * H / 32, "%+.1lf", GC->rtcc->PZLLTT.HP_TPI / 1852.0);
+		page.Printf(31 * W / 32, 23 * H / 32, "%.1lf", GC->rtcc->PZLLTT.HA_TPF / 1852.0);
+		page.Printf(31 * W / 32, 24 * H / 32, "%+.1lf", GC->rtcc->PZLLTT.HP_TPF / 1852.0);
+
+		page.Printf(31 * W / 32, 27 * H / 32, "%.1lf", GC->rtcc->PZLLTT.HA_T / 1852.0);
+		page.Printf(31 * W / 32, 28 * H / 32, "%+.1lf", GC->rtcc->PZLLTT.HP_T / 1852.0);
 	}
 	else if (screen == 92)
 	{
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
-		skp->Text(4 * W / 8, 2 * H / 32, "TPI TIMES", 9);
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
+		page.Text(4 * W / 8, 2 * H / 32, "TPI TIMES", 9);
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
 
 		if (G->target != NULL)
 		{
@@ -7727,137 +6619,129 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 		{
 			sprintf_s(Buffer, "No Target!");
 		}
-		skp->Text(1 * W / 8, 2 * H / 14, Buffer, strlen(Buffer));
+		page.Text(1 * W / 8, 2 * H / 14, Buffer, strlen(Buffer));
 
 		if (G->DKI_TPI_Mode == 0)
 		{
-			skp->Text(1 * W / 8, 4 * H / 14, "TPI on time", 11);
+			page.Text(1 * W / 8, 4 * H / 14, "TPI on time", 11);
 		}
 		else if (G->DKI_TPI_Mode == 1)
 		{
-			skp->Text(1 * W / 8, 4 * H / 14, "TPI at orbital midnight", 23);
+			page.Text(1 * W / 8, 4 * H / 14, "TPI at orbital midnight", 23);
 		}
 		else
 		{
-			skp->Text(1 * W / 8, 4 * H / 14, "TPI at X min before sunrise:", 28);
+			page.Text(1 * W / 8, 4 * H / 14, "TPI at X min before sunrise:", 28);
 		}
 
 		if (G->DKI_TPI_Mode == 2)
 		{
-			sprintf_s(Buffer, "%.1f min", G->DKI_dt_TPI_sunrise / 60.0);
-			skp->Text(1 * W / 8, 6 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(1 * W / 8, 6 * H / 14, "%.1f min", G->DKI_dt_TPI_sunrise / 60.0);
 		}
 
-		GET_Display(Buffer, G->t_TPIguess, false);
-		skp->Text(1 * W / 8, 8 * H / 14, Buffer, strlen(Buffer));
+		page.Format(1 * W / 8, 8 * H / 14, this, &ApolloRTCCMFD::GET_Display, G->t_TPIguess, false);
 
-		GET_Display(Buffer, G->t_TPI, false);
-		skp->Text(1 * W / 8, 10 * H / 14, Buffer, strlen(Buffer));
+		page.Format(1 * W / 8, 10 * H / 14, this, &ApolloRTCCMFD::GET_Display, G->t_TPI, false);
 
 	}
 	else if (screen == 93)
 	{
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
-		skp->SetFont(fonttest);
-		skp->SetPen(pen2);
-		skp->Text(4 * W / 8, 2 * H / 32, "VECTOR COMPARE DISPLAY", 39);
-		skp->Text(30 * W / 32, 2 * H / 32, "1590", 4);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
+		page.SetFont(fonttest);
+		page.SetPen(pen2);
+		page.Text(4 * W / 8, 2 * H / 32, "VECTOR COMPARE DISPLAY", 39);
+		page.Text(30 * W / 32, 2 * H / 32, "1590", 4);
 
 		sprintf_s(Buffer, GC->rtcc->VectorCompareDisplayBuffer.error.c_str());
-		skp->Text(16 * W / 32, 31 * H / 32, Buffer, strlen(Buffer));
-
-		skp->Text(15 * W / 64, 7 * H / 32, "V1", 2);
-		skp->Text(29 * W / 64, 7 * H / 32, "V2", 2);
-		skp->Text(43 * W / 64, 7 * H / 32, "V3", 2);
-		skp->Text(57 * W / 64, 7 * H / 32, "V4", 2);
-
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
-		skp->Text(1 * W / 32, 5 * H / 32, "VEH", 3);
-		skp->Text(6 * W / 32, 5 * H / 32, "REF", 3);
-		skp->Text(21 * W / 32, 4 * H / 32, "PET", 3);
-		skp->Text(21 * W / 32, 5 * H / 32, "GMTR", 4);
-		skp->TextW(1 * W / 32, 10 * H / 32, L"H\u2090", 2);
-		skp->TextW(1 * W / 32, 11 * H / 32, L"H\u209A", 2);
-		skp->Text(1 * W / 32, 12 * H / 32, "V", 1);
-		skp->TextW(1 * W / 32, 13 * H / 32, L"\u03B3", 1);
-		skp->TextW(1 * W / 32, 14 * H / 32, L"\u03C8", 1);
-		skp->TextW(1 * W / 32, 15 * H / 32, L"\u03C6", 1);
-		skp->TextW(1 * W / 32, 16 * H / 32, L"\u03BB", 1);
-		skp->Text(1 * W / 32, 17 * H / 32, "h", 1);
-		skp->Text(1 * W / 32, 18 * H / 32, "a", 1);
-		skp->Text(1 * W / 32, 19 * H / 32, "e", 1);
-		skp->Text(1 * W / 32, 20 * H / 32, "i", 1);
-		skp->TextW(1 * W / 32, 21 * H / 32, L"\u0398\u209A", 2);
-		skp->TextW(1 * W / 32, 22 * H / 32, L"\u03A9", 1);
-		skp->TextW(1 * W / 32, 23 * H / 32, L"\u03BD", 1);
-		skp->Text(1 * W / 32, 24 * H / 32, "U", 1);
-		skp->Text(1 * W / 32, 25 * H / 32, "V", 1);
-		skp->Text(1 * W / 32, 26 * H / 32, "W", 1);
-		skp->TextW(1 * W / 32, 27 * H / 32, L"\u0307U", 2);
-		skp->TextW(1 * W / 32, 28 * H / 32, L"\u0307V", 2);
-		skp->TextW(1 * W / 32, 29 * H / 32, L"\u0307W", 2);
-
-		skp->Line(11 * W / 32, 8 * H / 32, 11 * W / 32, 31 * H / 32);
-		skp->Line(18 * W / 32, 8 * H / 32, 18 * W / 32, 31 * H / 32);
-		skp->Line(25 * W / 32, 8 * H / 32, 25 * W / 32, 31 * H / 32);
-
-		skp->Line(0, 18 * H / 32, W, 18 * H / 32);
-		skp->Line(0, 24 * H / 32, W, 24 * H / 32);
+		page.Text(16 * W / 32, 31 * H / 32, Buffer, strlen(Buffer));
+
+		page.Text(15 * W / 64, 7 * H / 32, "V1", 2);
+		page.Text(29 * W / 64, 7 * H / 32, "V2", 2);
+		page.Text(43 * W / 64, 7 * H / 32, "V3", 2);
+		page.Text(57 * W / 64, 7 * H / 32, "V4", 2);
+
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
+		page.Text(1 * W / 32, 5 * H / 32, "VEH", 3);
+		page.Text(6 * W / 32, 5 * H / 32, "REF", 3);
+		page.Text(21 * W / 32, 4 * H / 32, "PET", 3);
+		page.Text(21 * W / 32, 5 * H / 32, "GMTR", 4);
+		page.TextW(1 * W / 32, 10 * H / 32, L"H\u2090", 2);
+		page.TextW(1 * W / 32, 11 * H / 32, L"H\u209A", 2);
+		page.Text(1 * W / 32, 12 * H / 32, "V", 1);
+		page.TextW(1 * W / 32, 13 * H / 32, L"\u03B3", 1);
+		page.TextW(1 * W / 32, 14 * H / 32, L"\u03C8", 1);
+		page.TextW(1 * W / 32, 15 * H / 32, L"\u03C6", 1);
+		page.TextW(1 * W / 32, 16 * H / 32, L"\u03BB", 1);
+		page.Text(1 * W / 32, 17 * H / 32, "h", 1);
+		page.Text(1 * W / 32, 18 * H / 32, "a", 1);
+		page.Text(1 * W / 32, 19 * H / 32, "e", 1);
+		page.Text(1 * W / 32, 20 * H / 32, "i", 1);
+		page.TextW(1 * W / 32, 21 * H / 32, L"\u0398\u209A", 2);
+		page.TextW(1 * W / 32, 22 * H / 32, L"\u03A9", 1);
+		page.TextW(1 * W / 32, 23 * H / 32, L"\u03BD", 1);
+		page.Text(1 * W / 32, 24 * H / 32, "U", 1);
+		page.Text(1 * W / 32, 25 * H / 32, "V", 1);
+		page.Text(1 * W / 32, 26 * H / 32, "W", 1);
+		page.TextW(1 * W / 32, 27 * H / 32, L"\u0307U", 2);
+		page.TextW(1 * W / 32, 28 * H / 32, L"\u0307V", 2);
+		page.TextW(1 * W / 32, 29 * H / 32, L"\u0307W", 2);
+
+		page.Line(11 * W / 32, 8 * H / 32, 11 * W / 32, 31 * H / 32);
+		page.Line(18 * W / 32, 8 * H / 32, 18 * W / 32, 31 * H / 32);
+		page.Line(25 * W / 32, 8 * H / 32, 25 * W / 32, 31 * H / 32);
+
+		page.Line(0, 18 * H / 32, W, 18 * H / 32);
+		page.Line(0, 24 * H / 32, W, 24 * H / 32);
 
 		if (GC->rtcc->med_s80.time > 0.0)
 		{
-			skp->Text(1 * W / 32, 4 * H / 32, "GMT", 3);
-			GET_Display2(Buffer, GC->rtcc->med_s80.time);
-			skp->Text(4 * W / 32, 4 * H / 32, Buffer, strlen(Buffer));
+			page.Text(1 * W / 32, 4 * H / 32, "GMT", 3);
+			page.Format(4 * W / 32, 4 * H / 32, this, &ApolloRTCCMFD::GET_Display2, GC->rtcc->med_s80.time);
 		}
 		else if (GC->rtcc->med_s80.time < 0.0)
 		{
-			skp->Text(1 * W / 32, 4 * H / 32, "GET", 3);
-			GET_Display2(Buffer, -GC->rtcc->med_s80.time);
-			skp->Text(4 * W / 32, 4 * H / 32, Buffer, strlen(Buffer));
+			page.Text(1 * W / 32, 4 * H / 32, "GET", 3);
+			page.Format(4 * W / 32, 4 * H / 32, this, &ApolloRTCCMFD::GET_Display2, -GC->rtcc->med_s80.time);
 		}
 		else
 		{
-			skp->Text(1 * W / 32, 4 * H / 32, "Time From V1", 12);
+			page.Text(1 * W / 32, 4 * H / 32, "Time From V1", 12);
 		}
 		
 		if (GC->rtcc->med_s80.VEH == 1)
 		{
-			skp->Text(3 * W / 32, 5 * H / 32, "CSM", 3);
+			page.Text(3 * W / 32, 5 * H / 32, "CSM", 3);
 		}
 		else
 		{
-			skp->Text(3 * W / 32, 5 * H / 32, "LEM", 3);
+			page.Text(3 * W / 32, 5 * H / 32, "LEM", 3);
 		}
 
 		if (GC->rtcc->med_s80.REF == BODY_EARTH)
 		{
-			skp->Text(8 * W / 32, 5 * H / 32, "E", 1);
+			page.Text(8 * W / 32, 5 * H / 32, "E", 1);
 		}
 		else
 		{
-			skp->Text(8 * W / 32, 5 * H / 32, "M", 1);
+			page.Text(8 * W / 32, 5 * H / 32, "M", 1);
 		}
 
-		skp->SetTextAlign(oapi::Sketchpad::RIGHT);
+		page.SetTextAlign(oapi::Sketchpad::RIGHT);
 
-		GET_Display2(Buffer, GC->rtcc->VectorCompareDisplayBuffer.PET);
-		skp->Text(31 * W / 32, 4 * H / 32, Buffer, strlen(Buffer));
-		GET_Display2(Buffer, GC->rtcc->VectorCompareDisplayBuffer.GMTR);
-		skp->Text(31 * W / 32, 5 * H / 32, Buffer, strlen(Buffer));
+		page.Format(31 * W / 32, 4 * H / 32, this, &ApolloRTCCMFD::GET_Display2, GC->rtcc->VectorCompareDisplayBuffer.PET);
+		page.Format(31 * W / 32, 5 * H / 32, this, &ApolloRTCCMFD::GET_Display2, GC->rtcc->VectorCompareDisplayBuffer.GMTR);
 
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
 		for (int i = 0;i < 4;i++)
 		{
 			sprintf_s(Buffer, GC->rtcc->med_s80.VID[i].c_str());
-			skp->Text((15 + 14 * i) * W / 64, 9 * H / 32, Buffer, strlen(Buffer));
+			page.Text((15 + 14 * i) * W / 64, 9 * H / 32, Buffer, strlen(Buffer));
 		}
-		skp->SetTextAlign(oapi::Sketchpad::RIGHT);
+		page.SetTextAlign(oapi::Sketchpad::RIGHT);
 
 		for (int i = 0;i < GC->rtcc->VectorCompareDisplayBuffer.NumVec;i++)
 		{
-			GET_Display2(Buffer, GC->rtcc->VectorCompareDisplayBuffer.data[i].GMT);
-			skp->Text((21 + 14 * i) * W / 64, 8 * H / 32, Buffer, strlen(Buffer));
+			page.Format((21 + 14 * i) * W / 64, 8 * H / 32, this, &ApolloRTCCMFD::GET_Display2, GC->rtcc->VectorCompareDisplayBuffer.data[i].GMT);
 			
 			if (GC->rtcc->VectorCompareDisplayBuffer.showHA[i])
 			{
@@ -7869,10 +6753,9 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 				{
 					sprintf_s(Buffer, "%+.3lf", GC->rtcc->VectorCompareDisplayBuffer.data[i].HA);
 				}
-				skp->Text((21 + 14 * i) * W / 64, 10 * H / 32, Buffer, strlen(Buffer));
+				page.Text((21 + 14 * i) * W / 64, 10 * H / 32, Buffer, strlen(Buffer));
 			}
-			sprintf_s(Buffer, "%+.3lf", GC->rtcc->VectorCompareDisplayBuffer.data[i].HP);
-			skp->Text((21 + 14 * i) * W / 64, 11 * H / 32, Buffer, strlen(Buffer));
+			page.Printf((21 + 14 * i) * W / 64, 11 * H / 32, "%+.3lf", GC->rtcc->VectorCompareDisplayBuffer.data[i].HP);
 			if (i == 0)
 			{
 				sprintf_s(Buffer, "%.3lf", GC->rtcc->VectorCompareDisplayBuffer.data[i].v);
@@ -7881,9 +6764,8 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			{
 				sprintf_s(Buffer, "%+.3lf", GC->rtcc->VectorCompareDisplayBuffer.data[i].v);
 			}
-			skp->Text((21 + 14 * i) * W / 64, 12 * H / 32, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%+.5lf", GC->rtcc->VectorCompareDisplayBuffer.data[i].gamma);
-			skp->Text((21 + 14 * i) * W / 64, 13 * H / 32, Buffer, strlen(Buffer));
+			page.Text((21 + 14 * i) * W / 64, 12 * H / 32, Buffer, strlen(Buffer));
+			page.Printf((21 + 14 * i) * W / 64, 13 * H / 32, "%+.5lf", GC->rtcc->VectorCompareDisplayBuffer.data[i].gamma);
 			if (i == 0)
 			{
 				sprintf_s(Buffer, "%.5lf", GC->rtcc->VectorCompareDisplayBuffer.data[i].psi);
@@ -7892,7 +6774,7 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			{
 				sprintf_s(Buffer, "%+.5lf", GC->rtcc->VectorCompareDisplayBuffer.data[i].psi);
 			}
-			skp->Text((21 + 14 * i) * W / 64, 14 * H / 32, Buffer, strlen(Buffer));
+			page.Text((21 + 14 * i) * W / 64, 14 * H / 32, Buffer, strlen(Buffer));
 			if (i == 0)
 			{
 				if (GC->rtcc->VectorCompareDisplayBuffer.data[i].phi > 0)
@@ -7908,7 +6790,7 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			{
 				sprintf_s(Buffer, "%+.5lf", GC->rtcc->VectorCompareDisplayBuffer.data[i].phi);
 			}
-			skp->Text((21 + 14 * i) * W / 64, 15 * H / 32, Buffer, strlen(Buffer));
+			page.Text((21 + 14 * i) * W / 64, 15 * H / 32, Buffer, strlen(Buffer));
 			if (i == 0)
 			{
 				if (GC->rtcc->VectorCompareDisplayBuffer.data[i].lambda > 0)
@@ -7924,7 +6806,7 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			{
 				sprintf_s(Buffer, "%+.5lf", GC->rtcc->VectorCompareDisplayBuffer.data[i].lambda);
 			}
-			skp->Text((21 + 14 * i) * W / 64, 16 * H / 32, Buffer, strlen(Buffer));
+			page.Text((21 + 14 * i) * W / 64, 16 * H / 32, Buffer, strlen(Buffer));
 			if (i == 0)
 			{
 				sprintf_s(Buffer, "%.3lf", GC->rtcc->VectorCompareDisplayBuffer.data[i].h);
@@ -7933,7 +6815,7 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			{
 				sprintf_s(Buffer, "%+.3lf", GC->rtcc->VectorCompareDisplayBuffer.data[i].h);
 			}
-			skp->Text((21 + 14 * i) * W / 64, 17 * H / 32, Buffer, strlen(Buffer));
+			page.Text((21 + 14 * i) * W / 64, 17 * H / 32, Buffer, strlen(Buffer));
 			if (i == 0)
 			{
 				sprintf_s(Buffer, "%.3lf", GC->rtcc->VectorCompareDisplayBuffer.data[i].a);
@@ -7942,7 +6824,7 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			{
 				sprintf_s(Buffer, "%+.3lf", GC->rtcc->VectorCompareDisplayBuffer.data[i].a);
 			}
-			skp->Text((21 + 14 * i) * W / 64, 18 * H / 32, Buffer, strlen(Buffer));
+			page.Text((21 + 14 * i) * W / 64, 18 * H / 32, Buffer, strlen(Buffer));
 			if (i == 0)
 			{
 				sprintf_s(Buffer, "%.5lf", GC->rtcc->VectorCompareDisplayBuffer.data[i].e);
@@ -7951,7 +6833,7 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			{
 				sprintf_s(Buffer, "%+.5lf", GC->rtcc->VectorCompareDisplayBuffer.data[i].e);
 			}
-			skp->Text((21 + 14 * i) * W / 64, 19 * H / 32, Buffer, strlen(Buffer));
+			page.Text((21 + 14 * i) * W / 64, 19 * H / 32, Buffer, strlen(Buffer));
 			if (i == 0)
 			{
 				sprintf_s(Buffer, "%.5lf", GC->rtcc->VectorCompareDisplayBuffer.data[i].i);
@@ -7960,7 +6842,7 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			{
 				sprintf_s(Buffer, "%+.5lf", GC->rtcc->VectorCompareDisplayBuffer.data[i].i);
 			}
-			skp->Text((21 + 14 * i) * W / 64, 20 * H / 32, Buffer, strlen(Buffer));
+			page.Text((21 + 14 * i) * W / 64, 20 * H / 32, Buffer, strlen(Buffer));
 			if (GC->rtcc->VectorCompareDisplayBuffer.showWPAndTA[i])
 			{
 				if (i == 0)
@@ -7971,7 +6853,7 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 				{
 					sprintf_s(Buffer, "%+.5lf", GC->rtcc->VectorCompareDisplayBuffer.data[i].theta_p);
 				}
-				skp->Text((21 + 14 * i) * W / 64, 21 * H / 32, Buffer, strlen(Buffer));
+				page.Text((21 + 14 * i) * W / 64, 21 * H / 32, Buffer, strlen(Buffer));
 				if (i == 0)
 				{
 					sprintf_s(Buffer, "%.5lf", GC->rtcc->VectorCompareDisplayBuffer.data[i].nu);
@@ -7980,7 +6862,7 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 				{
 					sprintf_s(Buffer, "%+.5lf", GC->rtcc->VectorCompareDisplayBuffer.data[i].nu);
 				}
-				skp->Text((21 + 14 * i) * W / 64, 23 * H / 32, Buffer, strlen(Buffer));
+				page.Text((21 + 14 * i) * W / 64, 23 * H / 32, Buffer, strlen(Buffer));
 			}
 			if (i == 0)
 			{
@@ -7990,7 +6872,7 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			{
 				sprintf_s(Buffer, "%+.5lf", GC->rtcc->VectorCompareDisplayBuffer.data[i].Omega);
 			}
-			skp->Text((21 + 14 * i) * W / 64, 22 * H / 32, Buffer, strlen(Buffer));
+			page.Text((21 + 14 * i) * W / 64, 22 * H / 32, Buffer, strlen(Buffer));
 			if (i == 0)
 			{
 				sprintf_s(Buffer, "%.2lf", GC->rtcc->VectorCompareDisplayBuffer.data[i].U);
@@ -7999,7 +6881,7 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			{
 				sprintf_s(Buffer, "%+.2lf", GC->rtcc->VectorCompareDisplayBuffer.data[i].U);
 			}
-			skp->Text((21 + 14 * i) * W / 64, 24 * H / 32, Buffer, strlen(Buffer));
+			page.Text((21 + 14 * i) * W / 64, 24 * H / 32, Buffer, strlen(Buffer));
 			if (i == 0)
 			{
 				sprintf_s(Buffer, "%.2lf", GC->rtcc->VectorCompareDisplayBuffer.data[i].V);
@@ -8008,7 +6890,7 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			{
 				sprintf_s(Buffer, "%+.2lf", GC->rtcc->VectorCompareDisplayBuffer.data[i].V);
 			}
-			skp->Text((21 + 14 * i) * W / 64, 25 * H / 32, Buffer, strlen(Buffer));
+			page.Text((21 + 14 * i) * W / 64, 25 * H / 32, Buffer, strlen(Buffer));
 			if (i == 0)
 			{
 				sprintf_s(Buffer, "%.2lf", GC->rtcc->VectorCompareDisplayBuffer.data[i].W);
@@ -8017,7 +6899,7 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			{
 				sprintf_s(Buffer, "%+.2lf", GC->rtcc->VectorCompareDisplayBuffer.data[i].W);
 			}
-			skp->Text((21 + 14 * i) * W / 64, 26 * H / 32, Buffer, strlen(Buffer));
+			page.Text((21 + 14 * i) * W / 64, 26 * H / 32, Buffer, strlen(Buffer));
 			if (i == 0)
 			{
 				sprintf_s(Buffer, "%.2lf", GC->rtcc->VectorCompareDisplayBuffer.data[i].U_dot);
@@ -8026,7 +6908,7 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			{
 				sprintf_s(Buffer, "%+.2lf", GC->rtcc->VectorCompareDisplayBuffer.data[i].U_dot);
 			}
-			skp->Text((21 + 14 * i) * W / 64, 27 * H / 32, Buffer, strlen(Buffer));
+			page.Text((21 + 14 * i) * W / 64, 27 * H / 32, Buffer, strlen(Buffer));
 			if (i == 0)
 			{
 				sprintf_s(Buffer, "%.2lf", GC->rtcc->VectorCompareDisplayBuffer.data[i].V_dot);
@@ -8035,7 +6917,7 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			{
 				sprintf_s(Buffer, "%+.2lf", GC->rtcc->VectorCompareDisplayBuffer.data[i].V_dot);
 			}
-			skp->Text((21 + 14 * i) * W / 64, 28 * H / 32, Buffer, strlen(Buffer));
+			page.Text((21 + 14 * i) * W / 64, 28 * H / 32, Buffer, strlen(Buffer));
 			if (i == 0)
 			{
 				sprintf_s(Buffer, "%.2lf", GC->rtcc->VectorCompareDisplayBuffer.data[i].W_dot);
@@ -8044,264 +6926,201 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			{
 				sprintf_s(Buffer, "%+.2lf", GC->rtcc->VectorCompareDisplayBuffer.data[i].W_dot);
 			}
-			skp->Text((21 + 14 * i) * W / 64, 29 * H / 32, Buffer, strlen(Buffer));
+			page.Text((21 + 14 * i) * W / 64, 29 * H / 32, Buffer, strlen(Buffer));
 		}
 	}
 	else if (screen == 95)
 	{
-		skp->SetFont(font3);
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
-		skp->Text(4 * W / 8, 3 * H / 26, "GUIDANCE OPTICS SUPPORT TABLE", 29);
-		sprintf_s(Buffer, "%s", GC->rtcc->GOSTDisplayBuffer.err.c_str());
-		skp->Text(1 * W / 2, 25 * H / 26, Buffer, strlen(Buffer));
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
-		skp->Text(38 * W / 43, 3 * H / 26, "0229", 4);
-
-		skp->Text(3 * W / 43, 5 * H / 26, "CODE", 4);
-		skp->TextW(17 * W / 43, 5 * H / 26, L"\u03B8\u2095", 2);
-		skp->TextW(25 * W / 43, 5 * H / 26, L"\u03C8\u2095", 2);
-		skp->TextW(33 * W / 43, 5 * H / 26, L"\u03C6\u2095", 2);
-
-		skp->Text(2 * W / 43, 6 * H / 26, "GETAC", 5);
-		skp->Text(20 * W / 43, 6 * H / 26, "IGA", 3);
-		skp->Text(31 * W / 43, 6 * H / 26, "IRA", 3);
-
-		skp->Text(2 * W / 43, 7 * H / 26, "SXT", 3);
-		skp->Text(13 * W / 43, 7 * H / 26, "SFT", 3);
-		skp->Text(20 * W / 43, 7 * H / 26, "TRN", 3);
-		skp->Text(30 * W / 43, 7 * H / 26, "SFT", 3);
-		skp->Text(38 * W / 43, 7 * H / 26, "TRN", 3);
-
-		skp->Text(2 * W / 43, 8 * H / 26, "S1", 2);
-		skp->Text(9 * W / 43, 8 * H / 26, "INP", 3);
-		skp->Text(25 * W / 43, 8 * H / 26, "RTCC", 4);
-
-		skp->Text(2 * W / 43, 9 * H / 26, "S2", 2);
-		skp->Text(9 * W / 43, 9 * H / 26, "INP", 3);
-		skp->Text(25 * W / 43, 9 * H / 26, "RTCC", 4);
-
-		skp->Text(2 * W / 43, 10 * H / 26, "SCT", 3);
-
-		skp->Text(1 * W / 43, 11 * H / 26, "S", 1);
-		skp->Text(15 * W / 43, 11 * H / 26, "M", 1);
-		skp->Text(21 * W / 43, 11 * H / 26, "R", 1);
-		skp->Text(26 * W / 43, 11 * H / 26, "RT ASC", 6);
-		skp->Text(37 * W / 43, 11 * H / 26, "DEC", 3);
-
-		skp->Text(1 * W / 43, 12 * H / 26, "1", 1);
-		skp->Text(6 * W / 43, 12 * H / 26, "SF", 2);
-
-		skp->Text(1 * W / 43, 13 * H / 26, "2", 1);
-		skp->Text(6 * W / 43, 13 * H / 26, "TR", 2);
-
-		skp->Text(1 * W / 43, 15 * H / 26, "BORESIGHT", 9);
-		skp->Text(11 * W / 43, 15 * H / 26, "SPA", 3);
-		skp->Text(18 * W / 43, 15 * H / 26, "SPX", 3);
-		skp->Text(24 * W / 43, 15 * H / 26, "RT ASC", 6);
-		skp->Text(36 * W / 43, 15 * H / 26, "DEC", 3);
-
-		skp->Text(2 * W / 43, 16 * H / 26, "S1", 2);
-		skp->Text(2 * W / 43, 17 * H / 26, "S2", 2);
-
-		skp->Text(1 * W / 43, 18 * H / 26, "LOS", 3);
-		skp->Text(6 * W / 43, 18 * H / 26, "IX", 2);
-		skp->Text(18 * W / 43, 18 * H / 26, "IY", 2);
-		skp->Text(30 * W / 43, 18 * H / 26, "IZ", 2);
-
-		skp->Text(1 * W / 43, 19 * H / 26, "GET", 3);
-		skp->Text(14 * W / 43, 19 * H / 26, "SC", 2);
-		skp->Text(20 * W / 43, 19 * H / 26, "RA", 2);
-		skp->Text(31 * W / 43, 19 * H / 26, "DEC", 3);
-
-		skp->Text(18 * W / 43, 20 * H / 26, "P", 1);
-		skp->Text(27 * W / 43, 20 * H / 26, "Y", 1);
-		skp->Text(36 * W / 43, 20 * H / 26, "R", 1);
-		skp->Text(2 * W / 43, 21 * H / 26, "MAT", 3);
-		skp->Text(18 * W / 43, 21 * H / 26, "P", 1);
-		skp->Text(27 * W / 43, 21 * H / 26, "Y", 1);
-		skp->Text(36 * W / 43, 21 * H / 26, "R", 1);
-
-		skp->Text(1 * W / 43, 22 * H / 26, "X/XE", 4);
-		skp->Text(1 * W / 43, 23 * H / 26, "Y/XE", 4);
-		skp->Text(1 * W / 43, 24 * H / 26, "Z/XE", 4);
-
-		skp->Text(15 * W / 43, 22 * H / 26, "X/YE", 4);
-		skp->Text(15 * W / 43, 23 * H / 26, "Y/YE", 4);
-		skp->Text(15 * W / 43, 24 * H / 26, "Z/YE", 4);
+		page.SetFont(font3);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
+		page.Text(4 * W / 8, 3 * H / 26, "GUIDANCE OPTICS SUPPORT TABLE", 29);
+		page.Printf(1 * W / 2, 25 * H / 26, "%s", GC->rtcc->GOSTDisplayBuffer.err.c_str());
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
+		page.Text(38 * W / 43, 3 * H / 26, "0229", 4);
+
+		page.Text(3 * W / 43, 5 * H / 26, "CODE", 4);
+		page.TextW(17 * W / 43, 5 * H / 26, L"\u03B8\u2095", 2);
+		page.TextW(25 * W / 43, 5 * H / 26, L"\u03C8\u2095", 2);
+		page.TextW(33 * W / 43, 5 * H / 26, L"\u03C6\u2095", 2);
+
+		page.Text(2 * W / 43, 6 * H / 26, "GETAC", 5);
+		page.Text(20 * W / 43, 6 * H / 26, "IGA", 3);
+		page.Text(31 * W / 43, 6 * H / 26, "IRA", 3);
+
+		page.Text(2 * W / 43, 7 * H / 26, "SXT", 3);
+		page.Text(13 * W / 43, 7 * H / 26, "SFT", 3);
+		page.Text(20 * W / 43, 7 * H / 26, "TRN", 3);
+		page.Text(30 * W / 43, 7 * H / 26, "SFT", 3);
+		page.Text(38 * W / 43, 7 * H / 26, "TRN", 3);
+
+		page.Text(2 * W / 43, 8 * H / 26, "S1", 2);
+		page.Text(9 * W / 43, 8 * H / 26, "INP", 3);
+		page.Text(25 * W / 43, 8 * H / 26, "RTCC", 4);
+
+		page.Text(2 * W / 43, 9 * H / 26, "S2", 2);
+		page.Text(9 * W / 43, 9 * H / 26, "INP", 3);
+		page.Text(25 * W / 43, 9 * H / 26, "RTCC", 4);
+
+		page.Text(2 * W / 43, 10 * H / 26, "SCT", 3);
+
+		page.Text(1 * W / 43, 11 * H / 26, "S", 1);
+		page.Text(15 * W / 43, 11 * H / 26, "M", 1);
+		page.Text(21 * W / 43, 11 * H / 26, "R", 1);
+		page.Text(26 * W / 43, 11 * H / 26, "RT ASC", 6);
+		page.Text(37 * W / 43, 11 * H / 26, "DEC", 3);
+
+		page.Text(1 * W / 43, 12 * H / 26, "1", 1);
+		page.Text(6 * W / 43, 12 * H / 26, "SF", 2);
+
+		page.Text(1 * W / 43, 13 * H / 26, "2", 1);
+		page.Text(6 * W / 43, 13 * H / 26, "TR", 2);
+
+		page.Text(1 * W / 43, 15 * H / 26, "BORESIGHT", 9);
+		page.Text(11 * W / 43, 15 * H / 26, "SPA", 3);
+		page.Text(18 * W / 43, 15 * H / 26, "SPX", 3);
+		page.Text(24 * W / 43, 15 * H / 26, "RT ASC", 6);
+		page.Text(36 * W / 43, 15 * H / 26, "DEC", 3);
+
+		page.Text(2 * W / 43, 16 * H / 26, "S1", 2);
+		page.Text(2 * W / 43, 17 * H / 26, "S2", 2);
+
+		page.Text(1 * W / 43, 18 * H / 26, "LOS", 3);
+		page.Text(6 * W / 43, 18 * H / 26, "IX", 2);
+		page.Text(18 * W / 43, 18 * H / 26, "IY", 2);
+		page.Text(30 * W / 43, 18 * H / 26, "IZ", 2);
+
+		page.Text(1 * W / 43, 19 * H / 26, "GET", 3);
+		page.Text(14 * W / 43, 19 * H / 26, "SC", 2);
+		page.Text(20 * W / 43, 19 * H / 26, "RA", 2);
+		page.Text(31 * W / 43, 19 * H / 26, "DEC", 3);
+
+		page.Text(18 * W / 43, 20 * H / 26, "P", 1);
+		page.Text(27 * W / 43, 20 * H / 26, "Y", 1);
+		page.Text(36 * W / 43, 20 * H / 26, "R", 1);
+		page.Text(2 * W / 43, 21 * H / 26, "MAT", 3);
+		page.Text(18 * W / 43, 21 * H / 26, "P", 1);
+		page.Text(27 * W / 43, 21 * H / 26, "Y", 1);
+		page.Text(36 * W / 43, 21 * H / 26, "R", 1);
+
+		page.Text(1 * W / 43, 22 * H / 26, "X/XE", 4);
+		page.Text(1 * W / 43, 23 * H / 26, "Y/XE", 4);
+		page.Text(1 * W / 43, 24 * H / 26, "Z/XE", 4);
+
+		page.Text(15 * W / 43, 22 * H / 26, "X/YE", 4);
+		page.Text(15 * W / 43, 23 * H / 26, "Y/YE", 4);
+		page.Text(15 * W / 43, 24 * H / 26, "Z/YE", 4);
 		
-		skp->Text(29 * W / 43, 22 * H / 26, "X/ZE", 4);
-		skp->Text(29 * W / 43, 23 * H / 26, "Y/ZE", 4);
-		skp->Text(29 * W / 43, 24 * H / 26, "Z/ZE", 4);
-
-		skp->SetTextAlign(oapi::Sketchpad::RIGHT);
-
-		sprintf_s(Buffer, "%s", GC->rtcc->GOSTDisplayBuffer.data.CODE.c_str());
-		skp->Text(15 * W / 43, 5 * H / 26, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%05.1lf", GC->rtcc->GOSTDisplayBuffer.data.Att_H.x);
-		skp->Text(23 * W / 43, 5 * H / 26, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%05.1lf", GC->rtcc->GOSTDisplayBuffer.data.Att_H.y);
-		skp->Text(31 * W / 43, 5 * H / 26, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%05.1lf", GC->rtcc->GOSTDisplayBuffer.data.Att_H.z);
-		skp->Text(40 * W / 43, 5 * H / 26, Buffer, strlen(Buffer));
-
-		GET_Display(Buffer, GC->rtcc->GOSTDisplayBuffer.data.GETAC, false);
-		skp->Text(16 * W / 43, 6 * H / 26, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%05.1lf", GC->rtcc->GOSTDisplayBuffer.data.IGA);
-		skp->Text(28 * W / 43, 6 * H / 26, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%s", GC->rtcc->GOSTDisplayBuffer.data.IRA.c_str());
-		skp->Text(40 * W / 43, 6 * H / 26, Buffer, strlen(Buffer));
-
-		sprintf_s(Buffer, "%03o", GC->rtcc->GOSTDisplayBuffer.data.SXT_STAR[0]);
-		skp->Text(7 * W / 43, 8 * H / 26, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%05.1lf", GC->rtcc->GOSTDisplayBuffer.data.SXT_SFT_INP[0]);
-		skp->Text(16 * W / 43, 8 * H / 26, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%05.1lf", GC->rtcc->GOSTDisplayBuffer.data.SXT_TRN_INP[0]);
-		skp->Text(23 * W / 43, 8 * H / 26, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%05.1lf", GC->rtcc->GOSTDisplayBuffer.data.SXT_SFT_RTCC[0]);
-		skp->Text(33 * W / 43, 8 * H / 26, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%05.1lf", GC->rtcc->GOSTDisplayBuffer.data.SXT_TRN_RTCC[0]);
-		skp->Text(40 * W / 43, 8 * H / 26, Buffer, strlen(Buffer));
-
-		sprintf_s(Buffer, "%03o", GC->rtcc->GOSTDisplayBuffer.data.SXT_STAR[1]);
-		skp->Text(7 * W / 43, 9 * H / 26, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%05.1lf", GC->rtcc->GOSTDisplayBuffer.data.SXT_SFT_INP[1]);
-		skp->Text(16 * W / 43, 9 * H / 26, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%05.1lf", GC->rtcc->GOSTDisplayBuffer.data.SXT_TRN_INP[1]);
-		skp->Text(23 * W / 43, 9 * H / 26, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%05.1lf", GC->rtcc->GOSTDisplayBuffer.data.SXT_SFT_RTCC[1]);
-		skp->Text(33 * W / 43, 9 * H / 26, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%05.1lf", GC->rtcc->GOSTDisplayBuffer.data.SXT_TRN_RTCC[1]);
-		skp->Text(40 * W / 43, 9 * H / 26, Buffer, strlen(Buffer));
-
-		sprintf_s(Buffer, "%03o", GC->rtcc->GOSTDisplayBuffer.data.SCT_S[0]);
-		skp->Text(5 * W / 43, 12 * H / 26, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%05.1lf", GC->rtcc->GOSTDisplayBuffer.data.SCT_SF);
-		skp->Text(12 * W / 43, 12 * H / 26, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%+05.1lf", GC->rtcc->GOSTDisplayBuffer.data.SCT_M[0]);
-		skp->Text(17 * W / 43, 12 * H / 26, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%+05.1lf", GC->rtcc->GOSTDisplayBuffer.data.SCT_R[0]);
-		skp->Text(23 * W / 43, 12 * H / 26, Buffer, strlen(Buffer));
-		Angle_Display(Buffer, GC->rtcc->GOSTDisplayBuffer.data.SCT_RTASC[0], false);
-		skp->Text(32 * W / 43, 12 * H / 26, Buffer, strlen(Buffer));
-		Angle_Display(Buffer, GC->rtcc->GOSTDisplayBuffer.data.SCT_DEC[0]);
-		skp->Text(42 * W / 43, 12 * H / 26, Buffer, strlen(Buffer));
-
-		sprintf_s(Buffer, "%03o", GC->rtcc->GOSTDisplayBuffer.data.SCT_S[1]);
-		skp->Text(5 * W / 43, 13 * H / 26, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%04.1lf", GC->rtcc->GOSTDisplayBuffer.data.SCT_TR);
-		skp->Text(12 * W / 43, 13 * H / 26, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%+05.1lf", GC->rtcc->GOSTDisplayBuffer.data.SCT_M[1]);
-		skp->Text(17 * W / 43, 13 * H / 26, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%+05.1lf", GC->rtcc->GOSTDisplayBuffer.data.SCT_R[1]);
-		skp->Text(23 * W / 43, 13 * H / 26, Buffer, strlen(Buffer));
-		Angle_Display(Buffer, GC->rtcc->GOSTDisplayBuffer.data.SCT_RTASC[1], false);
-		skp->Text(32 * W / 43, 13 * H / 26, Buffer, strlen(Buffer));
-		Angle_Display(Buffer, GC->rtcc->GOSTDisplayBuffer.data.SCT_DEC[1]);
-		skp->Text(42 * W / 43, 13 * H / 26, Buffer, strlen(Buffer));
-
-		sprintf_s(Buffer, "%03o", GC->rtcc->GOSTDisplayBuffer.data.BS_S[0]);
-		skp->Text(7 * W / 43, 16 * H / 26, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%+05.1lf", GC->rtcc->GOSTDisplayBuffer.data.BS_SPA[0]);
-		skp->Text(14 * W / 43, 16 * H / 26, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%+05.1lf", GC->rtcc->GOSTDisplayBuffer.data.BS_SXP[0]);
-		skp->Text(21 * W / 43, 16 * H / 26, Buffer, strlen(Buffer));
-		Angle_Display(Buffer, GC->rtcc->GOSTDisplayBuffer.data.BS_RTASC[0], false);
-		skp->Text(31 * W / 43, 16 * H / 26, Buffer, strlen(Buffer));
-		Angle_Display(Buffer, GC->rtcc->GOSTDisplayBuffer.data.BS_DEC[0]);
-		skp->Text(41 * W / 43, 16 * H / 26, Buffer, strlen(Buffer));
-
-		sprintf_s(Buffer, "%03o", GC->rtcc->GOSTDisplayBuffer.data.BS_S[1]);
-		skp->Text(7 * W / 43, 17 * H / 26, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%+05.1lf", GC->rtcc->GOSTDisplayBuffer.data.BS_SPA[1]);
-		skp->Text(14 * W / 43, 17 * H / 26, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%+05.1lf", GC->rtcc->GOSTDisplayBuffer.data.BS_SXP[1]);
-		skp->Text(21 * W / 43, 17 * H / 26, Buffer, strlen(Buffer));
-		Angle_Display(Buffer, GC->rtcc->GOSTDisplayBuffer.data.BS_RTASC[1], false);
-		skp->Text(31 * W / 43, 17 * H / 26, Buffer, strlen(Buffer));
-		Angle_Display(Buffer, GC->rtcc->GOSTDisplayBuffer.data.BS_DEC[1]);
-		skp->Text(41 * W / 43, 17 * H / 26, Buffer, strlen(Buffer));
-
-		sprintf_s(Buffer, "%+.5lf", GC->rtcc->GOSTDisplayBuffer.data.Landmark_LOS.x);
-		skp->Text(15 * W / 43, 18 * H / 26, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%+.5lf", GC->rtcc->GOSTDisplayBuffer.data.Landmark_LOS.y);
-		skp->Text(27 * W / 43, 18 * H / 26, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%+.5lf", GC->rtcc->GOSTDisplayBuffer.data.Landmark_LOS.z);
-		skp->Text(39 * W / 43, 18 * H / 26, Buffer, strlen(Buffer));
-
-		GET_Display(Buffer, GC->rtcc->GOSTDisplayBuffer.data.Landmark_GET, false);
-		skp->Text(12 * W / 43, 19 * H / 26, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%s", GC->rtcc->GOSTDisplayBuffer.data.Landmark_SC.c_str());
-		skp->Text(19 * W / 43, 19 * H / 26, Buffer, strlen(Buffer));
-		Angle_Display(Buffer, GC->rtcc->GOSTDisplayBuffer.data.Landmark_RA, false);
-		skp->Text(29 * W / 43, 19 * H / 26, Buffer, strlen(Buffer));
-		Angle_Display(Buffer, GC->rtcc->GOSTDisplayBuffer.data.Landmark_DEC);
-		skp->Text(42 * W / 43, 19 * H / 26, Buffer, strlen(Buffer));
-
-		sprintf_s(Buffer, "%05.1lf", GC->rtcc->GOSTDisplayBuffer.data.Att[0].x);
-		skp->Text(24 * W / 43, 20 * H / 26, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%05.1lf", GC->rtcc->GOSTDisplayBuffer.data.Att[0].y);
-		skp->Text(33 * W / 43, 20 * H / 26, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%05.1lf", GC->rtcc->GOSTDisplayBuffer.data.Att[0].z);
-		skp->Text(42 * W / 43, 20 * H / 26, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%05.1lf", GC->rtcc->GOSTDisplayBuffer.data.Att[1].x);
-		skp->Text(24 * W / 43, 21 * H / 26, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%05.1lf", GC->rtcc->GOSTDisplayBuffer.data.Att[1].y);
-		skp->Text(33 * W / 43, 21 * H / 26, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%05.1lf", GC->rtcc->GOSTDisplayBuffer.data.Att[1].z);
-		skp->Text(42 * W / 43, 21 * H / 26, Buffer, strlen(Buffer));
-
-		sprintf_s(Buffer, "%s", GC->rtcc->GOSTDisplayBuffer.data.MAT.c_str());
-		skp->Text(12 * W / 43, 21 * H / 26, Buffer, strlen(Buffer));
-
-		sprintf_s(Buffer, "%+.7lf", GC->rtcc->GOSTDisplayBuffer.data.REFSMMAT.m11);
-		skp->Text(13 * W / 43, 22 * H / 26, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%+.7lf", GC->rtcc->GOSTDisplayBuffer.data.REFSMMAT.m21);
-		skp->Text(13 * W / 43, 23 * H / 26, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%+.7lf", GC->rtcc->GOSTDisplayBuffer.data.REFSMMAT.m31);
-		skp->Text(13 * W / 43, 24 * H / 26, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%+.7lf", GC->rtcc->GOSTDisplayBuffer.data.REFSMMAT.m12);
-		skp->Text(27 * W / 43, 22 * H / 26, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%+.7lf", GC->rtcc->GOSTDisplayBuffer.data.REFSMMAT.m22);
-		skp->Text(27 * W / 43, 23 * H / 26, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%+.7lf", GC->rtcc->GOSTDisplayBuffer.data.REFSMMAT.m32);
-		skp->Text(27 * W / 43, 24 * H / 26, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%+.7lf", GC->rtcc->GOSTDisplayBuffer.data.REFSMMAT.m13);
-		skp->Text(42 * W / 43, 22 * H / 26, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%+.7lf", GC->rtcc->GOSTDisplayBuffer.data.REFSMMAT.m23);
-		skp->Text(42 * W / 43, 23 * H / 26, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%+.7lf", GC->rtcc->GOSTDisplayBuffer.data.REFSMMAT.m33);
-		skp->Text(42 * W / 43, 24 * H / 26, Buffer, strlen(Buffer));
+		page.Text(29 * W / 43, 22 * H / 26, "X/ZE", 4);
+		page.Text(29 * W / 43, 23 * H / 26, "Y/ZE", 4);
+		page.Text(29 * W / 43, 24 * H / 26, "Z/ZE", 4);
+
+		page.SetTextAlign(oapi::Sketchpad::RIGHT);
+
+		page.Printf(15 * W / 43, 5 * H / 26, "%s", GC->rtcc->GOSTDisplayBuffer.data.CODE.c_str());
+		page.Printf(23 * W / 43, 5 * H / 26, "%05.1lf", GC->rtcc->GOSTDisplayBuffer.data.Att_H.x);
+		page.Printf(31 * W / 43, 5 * H / 26, "%05.1lf", GC->rtcc->GOSTDisplayBuffer.data.Att_H.y);
+		page.Printf(40 * W / 43, 5 * H / 26, "%05.1lf", GC->rtcc->GOSTDisplayBuffer.data.Att_H.z);
+
+		page.Format(16 * W / 43, 6 * H / 26, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->GOSTDisplayBuffer.data.GETAC, false);
+		page.Printf(28 * W / 43, 6 * H / 26, "%05.1lf", GC->rtcc->GOSTDisplayBuffer.data.IGA);
+		page.Printf(40 * W / 43, 6 * H / 26, "%s", GC->rtcc->GOSTDisplayBuffer.data.IRA.c_str());
+
+		page.Printf(7 * W / 43, 8 * H / 26, "%03o", GC->rtcc->GOSTDisplayBuffer.data.SXT_STAR[0]);
+		page.Printf(16 * W / 43, 8 * H / 26, "%05.1lf", GC->rtcc->GOSTDisplayBuffer.data.SXT_SFT_INP[0]);
+		page.Printf(23 * W / 43, 8 * H / 26, "%05.1lf", GC->rtcc->GOSTDisplayBuffer.data.SXT_TRN_INP[0]);
+		page.Printf(33 * W / 43, 8 * H / 26, "%05.1lf", GC->rtcc->GOSTDisplayBuffer.data.SXT_SFT_RTCC[0]);
+		page.Printf(40 * W / 43, 8 * H / 26, "%05.1lf", GC->rtcc->GOSTDisplayBuffer.data.SXT_TRN_RTCC[0]);
+
+		page.Printf(7 * W / 43, 9 * H / 26, "%03o", GC->rtcc->GOSTDisplayBuffer.data.SXT_STAR[1]);
+		page.Printf(16 * W / 43, 9 * H / 26, "%05.1lf", GC->rtcc->GOSTDisplayBuffer.data.SXT_SFT_INP[1]);
+		page.Printf(23 * W / 43, 9 * H / 26, "%05.1lf", GC->rtcc->GOSTDisplayBuffer.data.SXT_TRN_INP[1]);
+		page.Printf(33 * W / 43, 9 * H / 26, "%05.1lf", GC->rtcc->GOSTDisplayBuffer.data.SXT_SFT_RTCC[1]);
+		page.Printf(40 * W / 43, 9 * H / 26, "%05.1lf", GC->rtcc->GOSTDisplayBuffer.data.SXT_TRN_RTCC[1]);
+
+		page.Printf(5 * W / 43, 12 * H / 26, "%03o", GC->rtcc->GOSTDisplayBuffer.data.SCT_S[0]);
+		page.Printf(12 * W / 43, 12 * H / 26, "%05.1lf", GC->rtcc->GOSTDisplayBuffer.data.SCT_SF);
+		page.Printf(17 * W / 43, 12 * H / 26, "%+05.1lf", GC->rtcc->GOSTDisplayBuffer.data.SCT_M[0]);
+		page.Printf(23 * W / 43, 12 * H / 26, "%+05.1lf", GC->rtcc->GOSTDisplayBuffer.data.SCT_R[0]);
+		page.Format(32 * W / 43, 12 * H / 26, this, &ApolloRTCCMFD::Angle_Display, GC->rtcc->GOSTDisplayBuffer.data.SCT_RTASC[0], false);
+		page.Format(42 * W / 43, 12 * H / 26, this, &ApolloRTCCMFD::Angle_Display, GC->rtcc->GOSTDisplayBuffer.data.SCT_DEC[0], true);
+
+		page.Printf(5 * W / 43, 13 * H / 26, "%03o", GC->rtcc->GOSTDisplayBuffer.data.SCT_S[1]);
+		page.Printf(12 * W / 43, 13 * H / 26, "%04.1lf", GC->rtcc->GOSTDisplayBuffer.data.SCT_TR);
+		page.Printf(17 * W / 43, 13 * H / 26, "%+05.1lf", GC->rtcc->GOSTDisplayBuffer.data.SCT_M[1]);
+		page.Printf(23 * W / 43, 13 * H / 26, "%+05.1lf", GC->rtcc->GOSTDisplayBuffer.data.SCT_R[1]);
+		page.Format(32 * W / 43, 13 * H / 26, this, &ApolloRTCCMFD::Angle_Display, GC->rtcc->GOSTDisplayBuffer.data.SCT_RTASC[1], false);
+		page.Format(42 * W / 43, 13 * H / 26, this, &ApolloRTCCMFD::Angle_Display, GC->rtcc->GOSTDisplayBuffer.data.SCT_DEC[1], true);
+
+		page.Printf(7 * W / 43, 16 * H / 26, "%03o", GC->rtcc->GOSTDisplayBuffer.data.BS_S[0]);
+		page.Printf(14 * W / 43, 16 * H / 26, "%+05.1lf", GC->rtcc->GOSTDisplayBuffer.data.BS_SPA[0]);
+		page.Printf(21 * W / 43, 16 * H / 26, "%+05.1lf", GC->rtcc->GOSTDisplayBuffer.data.BS_SXP[0]);
+		page.Format(31 * W / 43, 16 * H / 26, this, &ApolloRTCCMFD::Angle_Display, GC->rtcc->GOSTDisplayBuffer.data.BS_RTASC[0], false);
+		page.Format(41 * W / 43, 16 * H / 26, this, &ApolloRTCCMFD::Angle_Display, GC->rtcc->GOSTDisplayBuffer.data.BS_DEC[0], true);
+
+		page.Printf(7 * W / 43, 17 * H / 26, "%03o", GC->rtcc->GOSTDisplayBuffer.data.BS_S[1]);
+		page.Printf(14 * W / 43, 17 * H / 26, "%+05.1lf", GC->rtcc->GOSTDisplayBuffer.data.BS_SPA[1]);
+		page.Printf(21 * W / 43, 17 * H / 26, "%+05.1lf", GC->rtcc->GOSTDisplayBuffer.data.BS_SXP[1]);
+		page.Format(31 * W / 43, 17 * H / 26, this, &ApolloRTCCMFD::Angle_Display, GC->rtcc->GOSTDisplayBuffer.data.BS_RTASC[1], false);
+		page.Format(41 * W / 43, 17 * H / 26, this, &ApolloRTCCMFD::Angle_Display, GC->rtcc->GOSTDisplayBuffer.data.BS_DEC[1], true);
+
+		page.Printf(15 * W / 43, 18 * H / 26, "%+.5lf", GC->rtcc->GOSTDisplayBuffer.data.Landmark_LOS.x);
+		page.Printf(27 * W / 43, 18 * H / 26, "%+.5lf", GC->rtcc->GOSTDisplayBuffer.data.Landmark_LOS.y);
+		page.Printf(39 * W / 43, 18 * H / 26, "%+.5lf", GC->rtcc->GOSTDisplayBuffer.data.Landmark_LOS.z);
+
+		page.Format(12 * W / 43, 19 * H / 26, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->GOSTDisplayBuffer.data.Landmark_GET, false);
+		page.Printf(19 * W / 43, 19 * H / 26, "%s", GC->rtcc->GOSTDisplayBuffer.data.Landmark_SC.c_str());
+		page.Format(29 * W / 43, 19 * H / 26, this, &ApolloRTCCMFD::Angle_Display, GC->rtcc->GOSTDisplayBuffer.data.Landmark_RA, false);
+		page.Format(42 * W / 43, 19 * H / 26, this, &ApolloRTCCMFD::Angle_Display, GC->rtcc->GOSTDisplayBuffer.data.Landmark_DEC, true);
+
+		page.Printf(24 * W / 43, 20 * H / 26, "%05.1lf", GC->rtcc->GOSTDisplayBuffer.data.Att[0].x);
+		page.Printf(33 * W / 43, 20 * H / 26, "%05.1lf", GC->rtcc->GOSTDisplayBuffer.data.Att[0].y);
+		page.Printf(42 * W / 43, 20 * H / 26, "%05.1lf", GC->rtcc->GOSTDisplayBuffer.data.Att[0].z);
+		page.Printf(24 * W / 43, 21 * H / 26, "%05.1lf", GC->rtcc->GOSTDisplayBuffer.data.Att[1].x);
+		page.Printf(33 * W / 43, 21 * H / 26, "%05.1lf", GC->rtcc->GOSTDisplayBuffer.data.Att[1].y);
+		page.Printf(42 * W / 43, 21 * H / 26, "%05.1lf", GC->rtcc->GOSTDisplayBuffer.data.Att[1].z);
+
+		page.Printf(12 * W / 43, 21 * H / 26, "%s", GC->rtcc->GOSTDisplayBuffer.data.MAT.c_str());
+
+		page.Printf(13 * W / 43, 22 * H / 26, "%+.7lf", GC->rtcc->GOSTDisplayBuffer.data.REFSMMAT.m11);
+		page.Printf(13 * W / 43, 23 * H / 26, "%+.7lf", GC->rtcc->GOSTDisplayBuffer.data.REFSMMAT.m21);
+		page.Printf(13 * W / 43, 24 * H / 26, "%+.7lf", GC->rtcc->GOSTDisplayBuffer.data.REFSMMAT.m31);
+		page.Printf(27 * W / 43, 22 * H / 26, "%+.7lf", GC->rtcc->GOSTDisplayBuffer.data.REFSMMAT.m12);
+		page.Printf(27 * W / 43, 23 * H / 26, "%+.7lf", GC->rtcc->GOSTDisplayBuffer.data.REFSMMAT.m22);
+		page.Printf(27 * W / 43, 24 * H / 26, "%+.7lf", GC->rtcc->GOSTDisplayBuffer.data.REFSMMAT.m32);
+		page.Printf(42 * W / 43, 22 * H / 26, "%+.7lf", GC->rtcc->GOSTDisplayBuffer.data.REFSMMAT.m13);
+		page.Printf(42 * W / 43, 23 * H / 26, "%+.7lf", GC->rtcc->GOSTDisplayBuffer.data.REFSMMAT.m23);
+		page.Printf(42 * W / 43, 24 * H / 26, "%+.7lf", GC->rtcc->GOSTDisplayBuffer.data.REFSMMAT.m33);
 	}
 	else if (screen == 96)
 	{
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
-		skp->Text(1 * W / 2, 3 * H / 32, "SLV NAVIGATION UPDATE (MSK 235)", 31);
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
-
-		skp->Text(3 * W / 32, 5 * H / 32, "LOAD NO", 7);
-		skp->Text(11 * W / 32, 5 * H / 32, "GETSV", 5);
-		skp->Text(11 * W / 32, 7 * H / 32, "GRR/S", 5);
-
-		skp->Text(4 * W / 32, 10 * H / 32, "FCT", 3);
-		skp->Text(14 * W / 32, 10 * H / 32, "ENGLISH", 31);
-		skp->Text(24 * W / 32, 10 * H / 32, "METRIC", 31);
-
-		skp->Text(4 * W / 32, 13 * H / 32, "Z DOT", 5);
-		skp->Text(4 * W / 32, 15 * H / 32, "X DOT", 5);
-		skp->Text(4 * W / 32, 17 * H / 32, "Y DOT", 5);
-		skp->Text(4 * W / 32, 19 * H / 32, "Z POS", 5);
-		skp->Text(4 * W / 32, 21 * H / 32, "X POS", 5);
-		skp->Text(4 * W / 32, 23 * H / 32, "Y POS", 5);
-		skp->Text(4 * W / 32, 25 * H / 32, "TIME", 4);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
+		page.Text(1 * W / 2, 3 * H / 32, "SLV NAVIGATION UPDATE (MSK 235)", 31);
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
+
+		page.Text(3 * W / 32, 5 * H / 32, "LOAD NO", 7);
+		page.Text(11 * W / 32, 5 * H / 32, "GETSV", 5);
+		page.Text(11 * W / 32, 7 * H / 32, "GRR/S", 5);
+
+		page.Text(4 * W / 32, 10 * H / 32, "FCT", 3);
+		page.Text(14 * W / 32, 10 * H / 32, "ENGLISH", 31);
+		page.Text(24 * W / 32, 10 * H / 32, "METRIC", 31);
+
+		page.Text(4 * W / 32, 13 * H / 32, "Z DOT", 5);
+		page.Text(4 * W / 32, 15 * H / 32, "X DOT", 5);
+		page.Text(4 * W / 32, 17 * H / 32, "Y DOT", 5);
+		page.Text(4 * W / 32, 19 * H / 32, "Z POS", 5);
+		page.Text(4 * W / 32, 21 * H / 32, "X POS", 5);
+		page.Text(4 * W / 32, 23 * H / 32, "Y POS", 5);
+		page.Text(4 * W / 32, 25 * H / 32, "TIME", 4);
 
 		if (G->svtarget != NULL)
 		{
 			sprintf(Buffer, G->svtarget->GetName());
-			skp->Text(6 * W / 8, 2 * H / 14, Buffer, strlen(Buffer));
+			page.Text(6 * W / 8, 2 * H / 14, Buffer, strlen(Buffer));
 		}
 		else
 		{
-			skp->Text(6 * W / 8, 2 * H / 14, "No Target!", 10);
+			page.Text(6 * W / 8, 2 * H / 14, "No Target!", 10);
 		}
 
 		if (G->SVDesiredGET < 0)
@@ -8312,174 +7131,155 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 		{
 			GET_Display2(Buffer, G->SVDesiredGET);
 		}
-		skp->Text(16 * W / 32, 5 * H / 32, Buffer, strlen(Buffer));
-		GET_Display2(Buffer, GC->rtcc->GetIUClockZero());
-		skp->Text(16 * W / 32, 7 * H / 32, Buffer, strlen(Buffer));
-
-		sprintf_s(Buffer, "%+.1lf", GC->rtcc->CZNAVSLV.DotS.z / 0.3048);
-		skp->Text(14 * W / 32, 13 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%+.1lf", GC->rtcc->CZNAVSLV.DotS.z);
-		skp->Text(24 * W / 32, 13 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%+.1lf", GC->rtcc->CZNAVSLV.DotS.x / 0.3048);
-		skp->Text(14 * W / 32, 15 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%+.1lf", GC->rtcc->CZNAVSLV.DotS.x);
-		skp->Text(24 * W / 32, 15 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%+.1lf", GC->rtcc->CZNAVSLV.DotS.y / 0.3048);
-		skp->Text(14 * W / 32, 17 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%+.1lf", GC->rtcc->CZNAVSLV.DotS.y);
-		skp->Text(24 * W / 32, 17 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%+.1lf", GC->rtcc->CZNAVSLV.PosS.z / 1852.0);
-		skp->Text(14 * W / 32, 19 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%+.1lf", GC->rtcc->CZNAVSLV.PosS.z / 1000.0);
-		skp->Text(24 * W / 32, 19 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%+.1lf", GC->rtcc->CZNAVSLV.PosS.x / 1852.0);
-		skp->Text(14 * W / 32, 21 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%+.1lf", GC->rtcc->CZNAVSLV.PosS.x / 1000.0);
-		skp->Text(24 * W / 32, 21 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%+.1lf", GC->rtcc->CZNAVSLV.PosS.y / 1852.0);
-		skp->Text(14 * W / 32, 23 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%+.1lf", GC->rtcc->CZNAVSLV.PosS.y / 1000.0);
-		skp->Text(24 * W / 32, 23 * H / 32, Buffer, strlen(Buffer));
-
-		GET_Display2(Buffer, GC->rtcc->CZNAVSLV.NUPTIM);
-		skp->Text(14 * W / 32, 25 * H / 32, Buffer, strlen(Buffer));
-		sprintf_s(Buffer, "%+.4lf", GC->rtcc->CZNAVSLV.NUPTIM / 3600.0);
-		skp->Text(24 * W / 32, 25 * H / 32, Buffer, strlen(Buffer));
+		page.Text(16 * W / 32, 5 * H / 32, Buffer, strlen(Buffer));
+		page.Format(16 * W / 32, 7 * H / 32, this, &ApolloRTCCMFD::GET_Display2, GC->rtcc->GetIUClockZero());
+
+		page.Printf(14 * W / 32, 13 * H / 32, "%+.1lf", GC->rtcc->CZNAVSLV.DotS.z / 0.3048);
+		page.Printf(24 * W / 32, 13 * H / 32, "%+.1lf", GC->rtcc->CZNAVSLV.DotS.z);
+		page.Printf(14 * W / 32, 15 * H / 32, "%+.1lf", GC->rtcc->CZNAVSLV.DotS.x / 0.3048);
+		page.Printf(24 * W / 32, 15 * H / 32, "%+.1lf", GC->rtcc->CZNAVSLV.DotS.x);
+		page.Printf(14 * W / 32, 17 * H / 32, "%+.1lf", GC->rtcc->CZNAVSLV.DotS.y / 0.3048);
+		page.Printf(24 * W / 32, 17 * H / 32, "%+.1lf", GC->rtcc->CZNAVSLV.DotS.y);
+		page.Printf(14 * W / 32, 19 * H / 32, "%+.1lf", GC->rtcc->CZNAVSLV.PosS.z / 1852.0);
+		page.Printf(24 * W / 32, 19 * H / 32, "%+.1lf", GC->rtcc->CZNAVSLV.PosS.z / 1000.0);
+		page.Printf(14 * W / 32, 21 * H / 32, "%+.1lf", GC->rtcc->CZNAVSLV.PosS.x / 1852.0);
+		page.Printf(24 * W / 32, 21 * H / 32, "%+.1lf", GC->rtcc->CZNAVSLV.PosS.x / 1000.0);
+		page.Printf(14 * W / 32, 23 * H / 32, "%+.1lf", GC->rtcc->CZNAVSLV.PosS.y / 1852.0);
+		page.Printf(24 * W / 32, 23 * H / 32, "%+.1lf", GC->rtcc->CZNAVSLV.PosS.y / 1000.0);
+
+		page.Format(14 * W / 32, 25 * H / 32, this, &ApolloRTCCMFD::GET_Display2, GC->rtcc->CZNAVSLV.NUPTIM);
+		page.Printf(24 * W / 32, 25 * H / 32, "%+.4lf", GC->rtcc->CZNAVSLV.NUPTIM / 3600.0);
 
 	}
 	else if (screen == 97)
 	{
 		G->CycleVectorPanelSummary();
 
-		skp->SetFont(font4);
-		skp->SetPen(pen2);
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
+		page.SetFont(font4);
+		page.SetPen(pen2);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
 
-		skp->Text(5 * W / 8, 1 * H / 32, "VECTOR PANEL SUMMARY", 20);
-		skp->Text(38 * W / 43, 1 * H / 32, "1591", 4);
+		page.Text(5 * W / 8, 1 * H / 32, "VECTOR PANEL SUMMARY", 20);
+		page.Text(38 * W / 43, 1 * H / 32, "1591", 4);
 		
-		skp->SetTextAlign(oapi::Sketchpad::LEFT, oapi::Sketchpad::BASELINE);
-
-		skp->Text(2 * W / 43, 3 * H / 32, "CSM ANCHOR", 10);
-		Text(skp, 10 * W / 43, 3 * H / 32, GC->rtcc->VectorPanelSummaryBuffer.AnchorVectorID[0]);
-		skp->Text(17 * W / 43, 3 * H / 32, "CURRENT GMT", 11);
-		skp->Text(29 * W / 43, 3 * H / 32, "LM ANCHOR", 9);
-		Text(skp, 37 * W / 43, 3 * H / 32, GC->rtcc->VectorPanelSummaryBuffer.AnchorVectorID[1]);
-
-		skp->Text(3 * W / 43, 4 * H / 32, "GMTAV", 10);
-		Text(skp, 8 * W / 43, 4 * H / 32, GC->rtcc->VectorPanelSummaryBuffer.AnchorVectorGMT[0]);
-		Text(skp, 19 * W / 43, 4 * H / 32, GC->rtcc->VectorPanelSummaryBuffer.CurrentGMT);
-		skp->Text(30 * W / 43, 4 * H / 32, "GMTAV", 10);
-		Text(skp, 35 * W / 43, 4 * H / 32, GC->rtcc->VectorPanelSummaryBuffer.AnchorVectorGMT[1]);
-
-		skp->Line(0, 5 * H / 32, W, 5 * H / 32);
-		skp->Line(0, 7 * H / 32, W, 7 * H / 32);
-		skp->Line(W / 2, 5 * H / 32, W / 2, H);
-		skp->Line(0, 15 * H / 32, W, 15 * H / 32);
-		skp->Line(W / 4, 7 * H / 32, W / 4, H);
-		skp->Line(3 * W / 4, 7 * H / 32, 3 * W / 4, H);
-		skp->Line(W / 4, 20 * H / 32, W / 2, 20 * H / 32);
-		skp->Line(3 * W / 4, 20 * H / 32, W, 20 * H / 32);
-		skp->Line(0, 23 * H / 32, W / 4, 23 * H / 32);
-		skp->Line(W / 2, 23 * H / 32, 3 * W / 4, 23 * H / 32);
-		skp->Line(W / 4, 25 * H / 32, W / 2, 25 * H / 32);
-		skp->Line(3 * W / 4, 25 * H / 32, W, 25 * H / 32);
-
-		skp->Text(5 * W / 43, 13 * H / 64, "CSM VECTORS", 11);
-		skp->Text(26 * W / 43, 13 * H / 64, "LM VECTORS", 10);
+		page.SetTextAlign(oapi::Sketchpad::LEFT, oapi::Sketchpad::BASELINE);
+
+		page.Text(2 * W / 43, 3 * H / 32, "CSM ANCHOR", 10);
+		page.Text(10 * W / 43, 3 * H / 32, GC->rtcc->VectorPanelSummaryBuffer.AnchorVectorID[0]);
+		page.Text(17 * W / 43, 3 * H / 32, "CURRENT GMT", 11);
+		page.Text(29 * W / 43, 3 * H / 32, "LM ANCHOR", 9);
+		page.Text(37 * W / 43, 3 * H / 32, GC->rtcc->VectorPanelSummaryBuffer.AnchorVectorID[1]);
+
+		page.Text(3 * W / 43, 4 * H / 32, "GMTAV", 10);
+		page.Text(8 * W / 43, 4 * H / 32, GC->rtcc->VectorPanelSummaryBuffer.AnchorVectorGMT[0]);
+		page.Text(19 * W / 43, 4 * H / 32, GC->rtcc->VectorPanelSummaryBuffer.CurrentGMT);
+		page.Text(30 * W / 43, 4 * H / 32, "GMTAV", 10);
+		page.Text(35 * W / 43, 4 * H / 32, GC->rtcc->VectorPanelSummaryBuffer.AnchorVectorGMT[1]);
+
+		page.Line(0, 5 * H / 32, W, 5 * H / 32);
+		page.Line(0, 7 * H / 32, W, 7 * H / 32);
+		page.Line(W / 2, 5 * H / 32, W / 2, H);
+		page.Line(0, 15 * H / 32, W, 15 * H / 32);
+		page.Line(W / 4, 7 * H / 32, W / 4, H);
+		page.Line(3 * W / 4, 7 * H / 32, 3 * W / 4, H);
+		page.Line(W / 4, 20 * H / 32, W / 2, 20 * H / 32);
+		page.Line(3 * W / 4, 20 * H / 32, W, 20 * H / 32);
+		page.Line(0, 23 * H / 32, W / 4, 23 * H / 32);
+		page.Line(W / 2, 23 * H / 32, 3 * W / 4, 23 * H / 32);
+		page.Line(W / 4, 25 * H / 32, W / 2, 25 * H / 32);
+		page.Line(3 * W / 4, 25 * H / 32, W, 25 * H / 32);
+
+		page.Text(5 * W / 43, 13 * H / 64, "CSM VECTORS", 11);
+		page.Text(26 * W / 43, 13 * H / 64, "LM VECTORS", 10);
 
 		for (int i = 0;i < 2;i++)
 		{
-			skp->Text((22 * i + 1) * W / 44, 8 * H / 32, "CMC", 3);
-			skp->Text((22 * i + 1) * W / 44, 16 * H / 32, "LGC", 3);
-			skp->Text((22 * i + 1) * W / 44, 24 * H / 32, "AGS", 3);
+			page.Text((22 * i + 1) * W / 44, 8 * H / 32, "CMC", 3);
+			page.Text((22 * i + 1) * W / 44, 16 * H / 32, "LGC", 3);
+			page.Text((22 * i + 1) * W / 44, 24 * H / 32, "AGS", 3);
 
-			skp->Text((22 * i + 12) * W / 44, 8 * H / 32, "IU", 2);
-			skp->Text((22 * i + 11) * W / 44, 16 * H / 32, "HIGHSPEED RADAR", 15);
-			skp->Text((22 * i + 12) * W / 44, 21 * H / 32, "DC VECTOR", 9);
-			skp->Text((22 * i + 12) * W / 44, 26 * H / 32, "LAST EXECUTED", 13);
-			skp->Text((22 * i + 13) * W / 44, 27 * H / 32, "MANEUVER", 8);
+			page.Text((22 * i + 12) * W / 44, 8 * H / 32, "IU", 2);
+			page.Text((22 * i + 11) * W / 44, 16 * H / 32, "HIGHSPEED RADAR", 15);
+			page.Text((22 * i + 12) * W / 44, 21 * H / 32, "DC VECTOR", 9);
+			page.Text((22 * i + 12) * W / 44, 26 * H / 32, "LAST EXECUTED", 13);
+			page.Text((22 * i + 13) * W / 44, 27 * H / 32, "MANEUVER", 8);
 
 			//CMC, LGC and AGS
 			for (int j = 0;j < 3;j++)
 			{
-				skp->Text((22 * i + 2) * W / 44, (j * 8 + 9) * H / 32, "UV", 2);
-				Text(skp, (22 * i + 4) * W / 44, (j * 8 + 9) * H / 32, GC->rtcc->VectorPanelSummaryBuffer.CompUsableID[i][j]);
-				Text(skp, (22 * i + 4) * W / 44, (j * 8 + 10) * H / 32, GC->rtcc->VectorPanelSummaryBuffer.CompUsableGMT[i][j]);
-				skp->Text((22 * i + 2) * W / 44, (j * 8 + 11) * H / 32, "EV", 2);
-				Text(skp, (22 * i + 4) * W / 44, (j * 8 + 11) * H / 32, GC->rtcc->VectorPanelSummaryBuffer.CompEvalID[i][j]);
-				Text(skp, (22 * i + 4) * W / 44, (j * 8 + 12) * H / 32, GC->rtcc->VectorPanelSummaryBuffer.CompEvalGMT[i][j]);
-				skp->Text((22 * i + 2) * W / 44, (j * 8 + 13) * H / 32, "TH", 3);
-				Text(skp, (22 * i + 4) * W / 44, (j * 8 + 13) * H / 32, GC->rtcc->VectorPanelSummaryBuffer.CompTelemetryHighGMT[i][j]);
-				skp->Text((22 * i + 2) * W / 44, (j * 8 + 14) * H / 32, "TL", 3);
-				Text(skp, (22 * i + 4) * W / 44, (j * 8 + 14) * H / 32, GC->rtcc->VectorPanelSummaryBuffer.CompTelemetryLowGMT[i][j]);
+				page.Text((22 * i + 2) * W / 44, (j * 8 + 9) * H / 32, "UV", 2);
+				page.Text((22 * i + 4) * W / 44, (j * 8 + 9) * H / 32, GC->rtcc->VectorPanelSummaryBuffer.CompUsableID[i][j]);
+				page.Text((22 * i + 4) * W / 44, (j * 8 + 10) * H / 32, GC->rtcc->VectorPanelSummaryBuffer.CompUsableGMT[i][j]);
+				page.Text((22 * i + 2) * W / 44, (j * 8 + 11) * H / 32, "EV", 2);
+				page.Text((22 * i + 4) * W / 44, (j * 8 + 11) * H / 32, GC->rtcc->VectorPanelSummaryBuffer.CompEvalID[i][j]);
+				page.Text((22 * i + 4) * W / 44, (j * 8 + 12) * H / 32, GC->rtcc->VectorPanelSummaryBuffer.CompEvalGMT[i][j]);
+				page.Text((22 * i + 2) * W / 44, (j * 8 + 13) * H / 32, "TH", 3);
+				page.Text((22 * i + 4) * W / 44, (j * 8 + 13) * H / 32, GC->rtcc->VectorPanelSummaryBuffer.CompTelemetryHighGMT[i][j]);
+				page.Text((22 * i + 2) * W / 44, (j * 8 + 14) * H / 32, "TL", 3);
+				page.Text((22 * i + 4) * W / 44, (j * 8 + 14) * H / 32, GC->rtcc->VectorPanelSummaryBuffer.CompTelemetryLowGMT[i][j]);
 			}
 
 			//IU
-			skp->Text((22 * i + 13) * W / 44, 9 * H / 32, "UV", 2);
-			Text(skp, (22 * i + 15) * W / 44, 9 * H / 32, GC->rtcc->VectorPanelSummaryBuffer.CompUsableID[i][3]);
-			Text(skp, (22 * i + 15) * W / 44, 10 * H / 32, GC->rtcc->VectorPanelSummaryBuffer.CompUsableGMT[i][3]);
-			skp->Text((22 * i + 13) * W / 44, 11 * H / 32, "EV", 2);
-			Text(skp, (22 * i + 15) * W / 44, 11 * H / 32, GC->rtcc->VectorPanelSummaryBuffer.CompEvalID[i][3]);
-			Text(skp, (22 * i + 15) * W / 44, 12 * H / 32, GC->rtcc->VectorPanelSummaryBuffer.CompEvalGMT[i][3]);
-			skp->Text((22 * i + 13) * W / 44, 13 * H / 32, "TH", 3);
-			Text(skp, (22 * i + 15) * W / 44, 13 * H / 32, GC->rtcc->VectorPanelSummaryBuffer.CompTelemetryHighGMT[i][3]);
-			skp->Text((22 * i + 13) * W / 44, 14 * H / 32, "TL", 3);
-			Text(skp, (22 * i + 15) * W / 44, 14 * H / 32, GC->rtcc->VectorPanelSummaryBuffer.CompTelemetryLowGMT[i][3]);
+			page.Text((22 * i + 13) * W / 44, 9 * H / 32, "UV", 2);
+			page.Text((22 * i + 15) * W / 44, 9 * H / 32, GC->rtcc->VectorPanelSummaryBuffer.CompUsableID[i][3]);
+			page.Text((22 * i + 15) * W / 44, 10 * H / 32, GC->rtcc->VectorPanelSummaryBuffer.CompUsableGMT[i][3]);
+			page.Text((22 * i + 13) * W / 44, 11 * H / 32, "EV", 2);
+			page.Text((22 * i + 15) * W / 44, 11 * H / 32, GC->rtcc->VectorPanelSummaryBuffer.CompEvalID[i][3]);
+			page.Text((22 * i + 15) * W / 44, 12 * H / 32, GC->rtcc->VectorPanelSummaryBuffer.CompEvalGMT[i][3]);
+			page.Text((22 * i + 13) * W / 44, 13 * H / 32, "TH", 3);
+			page.Text((22 * i + 15) * W / 44, 13 * H / 32, GC->rtcc->VectorPanelSummaryBuffer.CompTelemetryHighGMT[i][3]);
+			page.Text((22 * i + 13) * W / 44, 14 * H / 32, "TL", 3);
+			page.Text((22 * i + 15) * W / 44, 14 * H / 32, GC->rtcc->VectorPanelSummaryBuffer.CompTelemetryLowGMT[i][3]);
 
 			//HSR
-			skp->Text((22 * i + 13) * W / 44, 18 * H / 32, "UV", 2);
-			Text(skp, (22 * i + 15) * W / 44, 18 * H / 32, GC->rtcc->VectorPanelSummaryBuffer.HSRID[i]);
-			Text(skp, (22 * i + 15) * W / 44, 19 * H / 32, GC->rtcc->VectorPanelSummaryBuffer.HSRGMT[i]);
+			page.Text((22 * i + 13) * W / 44, 18 * H / 32, "UV", 2);
+			page.Text((22 * i + 15) * W / 44, 18 * H / 32, GC->rtcc->VectorPanelSummaryBuffer.HSRID[i]);
+			page.Text((22 * i + 15) * W / 44, 19 * H / 32, GC->rtcc->VectorPanelSummaryBuffer.HSRGMT[i]);
 
 			//DC
-			skp->Text((22 * i + 13) * W / 44, 23 * H / 32, "UV", 2);
-			Text(skp, (22 * i + 15) * W / 44, 23 * H / 32, GC->rtcc->VectorPanelSummaryBuffer.DCID[i]);
-			Text(skp, (22 * i + 15) * W / 44, 24 * H / 32, GC->rtcc->VectorPanelSummaryBuffer.DCGMT[i]);
+			page.Text((22 * i + 13) * W / 44, 23 * H / 32, "UV", 2);
+			page.Text((22 * i + 15) * W / 44, 23 * H / 32, GC->rtcc->VectorPanelSummaryBuffer.DCID[i]);
+			page.Text((22 * i + 15) * W / 44, 24 * H / 32, GC->rtcc->VectorPanelSummaryBuffer.DCGMT[i]);
 
 			//Last Executed Maneuver
-			skp->Text((22 * i + 12) * W / 44, 28 * H / 32, "GMTUL", 5);
-			Text(skp, (22 * i + 17) * W / 44, 28 * H / 32, GC->rtcc->VectorPanelSummaryBuffer.LastManGMTUL[i]);
-			skp->Text((22 * i + 12) * W / 44, 29 * H / 32, "GMTBO", 5);
-			Text(skp, (22 * i + 17) * W / 44, 29 * H / 32, GC->rtcc->VectorPanelSummaryBuffer.LastManGMTBO[i]);
+			page.Text((22 * i + 12) * W / 44, 28 * H / 32, "GMTUL", 5);
+			page.Text((22 * i + 17) * W / 44, 28 * H / 32, GC->rtcc->VectorPanelSummaryBuffer.LastManGMTUL[i]);
+			page.Text((22 * i + 12) * W / 44, 29 * H / 32, "GMTBO", 5);
+			page.Text((22 * i + 17) * W / 44, 29 * H / 32, GC->rtcc->VectorPanelSummaryBuffer.LastManGMTBO[i]);
 		}
 	}
 	else if (screen == 103)
 	{
-		skp->Text(5 * W / 8, 1 * H / 32, "Retrofire Constraints", 21);
+		page.Text(5 * W / 8, 1 * H / 32, "Retrofire Constraints", 21);
 
-		ThrusterName(Buffer, GC->rtcc->RZC1RCNS.Thruster);
-		skp->Text(1 * W / 16, 2 * H / 14, Buffer, strlen(Buffer));
+		page.Format(1 * W / 16, 2 * H / 14, this, &ApolloRTCCMFD::ThrusterName, GC->rtcc->RZC1RCNS.Thruster);
 
 		if (GC->rtcc->RZC1RCNS.BurnMode == 1)
 		{
-			skp->Text(1 * W / 16, 4 * H / 14, "DV", 2);
+			page.Text(1 * W / 16, 4 * H / 14, "DV", 2);
 
-			sprintf_s(Buffer, "DV = %.1lf", GC->rtcc->RZC1RCNS.dv / 0.3048);
-			skp->Text(1 * W / 16, 6 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(1 * W / 16, 6 * H / 14, "DV = %.1lf", GC->rtcc->RZC1RCNS.dv / 0.3048);
 		}
 		else if (GC->rtcc->RZC1RCNS.BurnMode == 2)
 		{
-			skp->Text(1 * W / 16, 4 * H / 14, "DT", 2);
+			page.Text(1 * W / 16, 4 * H / 14, "DT", 2);
 
-			sprintf_s(Buffer, "DT = %.1lf", GC->rtcc->RZC1RCNS.dt);
-			skp->Text(1 * W / 16, 6 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(1 * W / 16, 6 * H / 14, "DT = %.1lf", GC->rtcc->RZC1RCNS.dt);
 		}
 		else
 		{
-			skp->Text(1 * W / 16, 4 * H / 14, "V, Gamma", 8);
+			page.Text(1 * W / 16, 4 * H / 14, "V, Gamma", 8);
 		}
 
 		if (GC->rtcc->RZC1RCNS.AttitudeMode == 1)
 		{
-			skp->Text(1 * W / 16, 8 * H / 14, "LVLH", 4);
+			page.Text(1 * W / 16, 8 * H / 14, "LVLH", 4);
 
-			sprintf_s(Buffer, "%+.1lf %+.1lf %+.1lf", GC->rtcc->RZC1RCNS.LVLHAttitude.x*DEG, GC->rtcc->RZC1RCNS.LVLHAttitude.y*DEG, GC->rtcc->RZC1RCNS.LVLHAttitude.z*DEG);
-			skp->Text(1 * W / 16, 10 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(1 * W / 16, 10 * H / 14, "%+.1lf %+.1lf %+.1lf", GC->rtcc->RZC1RCNS.LVLHAttitude.x*DEG, GC->rtcc->RZC1RCNS.LVLHAttitude.y*DEG, GC->rtcc->RZC1RCNS.LVLHAttitude.z*DEG);
 		}
 		else
 		{
-			skp->Text(1 * W / 16, 8 * H / 14, "31.7 window line", 17);
+			page.Text(1 * W / 16, 8 * H / 14, "31.7 window line", 17);
 		}
 
 
@@ -8493,245 +7293,195 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			{
 				sprintf_s(Buffer, "2 quads, %.1lf s ullage", GC->rtcc->RZC1RCNS.UllageTime);
 			}
-			skp->Text(1 * W / 16, 12 * H / 14, Buffer, strlen(Buffer));
+			page.Text(1 * W / 16, 12 * H / 14, Buffer, strlen(Buffer));
 		}
 
 		GC->rtcc->EMGSTGENName(GC->rtcc->RZC1RCNS.REFSMMAT, Buffer);
-		skp->Text(9 * W / 16, 2 * H / 14, Buffer, strlen(Buffer));
+		page.Text(9 * W / 16, 2 * H / 14, Buffer, strlen(Buffer));
 
 		if (GC->rtcc->RZC1RCNS.GimbalIndicator == 1)
 		{
-			skp->Text(9 * W / 16, 4 * H / 14, "Use System Parameters", 21);
+			page.Text(9 * W / 16, 4 * H / 14, "Use System Parameters", 21);
 		}
 		else
 		{
-			skp->Text(9 * W / 16, 4 * H / 14, "Compute Gimbal Trims", 20);
+			page.Text(9 * W / 16, 4 * H / 14, "Compute Gimbal Trims", 20);
 		}
 
-		sprintf_s(Buffer, "%+.1lf", GC->rtcc->RZC1RCNS.InitialBankAngle*DEG);
-		skp->Text(9 * W / 16, 6 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(9 * W / 16, 6 * H / 14, "%+.1lf", GC->rtcc->RZC1RCNS.InitialBankAngle*DEG);
 
-		sprintf_s(Buffer, "%.1lf gs", GC->rtcc->RZC1RCNS.GLevel);
-		skp->Text(9 * W / 16, 8 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(9 * W / 16, 8 * H / 14, "%.1lf gs", GC->rtcc->RZC1RCNS.GLevel);
 
-		sprintf_s(Buffer, "%+.1lf", GC->rtcc->RZC1RCNS.FinalBankAngle*DEG);
-		skp->Text(9 * W / 16, 10 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(9 * W / 16, 10 * H / 14, "%+.1lf", GC->rtcc->RZC1RCNS.FinalBankAngle*DEG);
 	}
 	else if (screen == 104)
 	{
 		int hh, mm;
 		double secs;
 
-		skp->Text(2 * W / 8, 2 * H / 26, "Retrofire Digitals (MSK 356)", 28);
-
-		skp->SetFont(font3);
-		skp->SetPen(pen2);
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
-
-		skp->Text(2 * W / 44, 5 * H / 26, "AREA", 4);
-		skp->Text(2 * W / 44, 6 * H / 26, "MATRIX", 6);
-		skp->Text(2 * W / 44, 7 * H / 26, "WT TAA", 6);
-		skp->Text(2 * W / 44, 8 * H / 26, "RLH PLH YLH", 11);
-		skp->Text(2 * W / 44, 9 * H / 26, "RO PI YM", 8);
-		skp->Text(2 * W / 44, 10 * H / 26, "VC BT", 5);
-		skp->Text(2 * W / 44, 11 * H / 26, "VT U DT", 7);
-		skp->Text(2 * W / 44, 12 * H / 26, "H", 1);
-		skp->Text(2 * W / 44, 13 * H / 26, "GETI", 4);
-		skp->Text(2 * W / 44, 14 * H / 26, "GMTI", 4);
-		skp->Text(2 * W / 44, 15 * H / 26, "RET", 3);
-		skp->Text(2 * W / 44, 16 * H / 26, "V EI", 4);
-		skp->Text(6 * W / 44, 16 * H / 26, "GAM EI", 6);
-		skp->Text(2 * W / 44, 17 * H / 26, "BA", 2);
-		skp->Text(2 * W / 44, 18 * H / 26, "RETRB", 5);
-		skp->Text(2 * W / 44, 19 * H / 26, "LAT ML", 6);
-		skp->Text(8 * W / 44, 19 * H / 26, "LNG ML", 6);
-		skp->Text(2 * W / 44, 20 * H / 26, "LAT T", 5);
-		skp->Text(8 * W / 44, 20 * H / 26, "LNG T", 5);
-		skp->Text(2 * W / 44, 21 * H / 26, "LAT IP", 6);
-		skp->Text(8 * W / 44, 21 * H / 26, "LNG IP", 6);
-		skp->Text(2 * W / 44, 22 * H / 26, "LAT ZL", 6);
-		skp->Text(8 * W / 44, 22 * H / 26, "LNG ZL", 6);
-		skp->Text(2 * W / 44, 23 * H / 26, "DLAT", 4);
-		skp->Text(8 * W / 44, 23 * H / 26, "DLNG", 4);
+		page.Text(2 * W / 8, 2 * H / 26, "Retrofire Digitals (MSK 356)", 28);
+
+		page.SetFont(font3);
+		page.SetPen(pen2);
+		page.SetTextAlign(oapi::Sketchpad::LEFT);
+
+		page.Text(2 * W / 44, 5 * H / 26, "AREA", 4);
+		page.Text(2 * W / 44, 6 * H / 26, "MATRIX", 6);
+		page.Text(2 * W / 44, 7 * H / 26, "WT TAA", 6);
+		page.Text(2 * W / 44, 8 * H / 26, "RLH PLH YLH", 11);
+		page.Text(2 * W / 44, 9 * H / 26, "RO PI YM", 8);
+		page.Text(2 * W / 44, 10 * H / 26, "VC BT", 5);
+		page.Text(2 * W / 44, 11 * H / 26, "VT U DT", 7);
+		page.Text(2 * W / 44, 12 * H / 26, "H", 1);
+		page.Text(2 * W / 44, 13 * H / 26, "GETI", 4);
+		page.Text(2 * W / 44, 14 * H / 26, "GMTI", 4);
+		page.Text(2 * W / 44, 15 * H / 26, "RET", 3);
+		page.Text(2 * W / 44, 16 * H / 26, "V EI", 4);
+		page.Text(6 * W / 44, 16 * H / 26, "GAM EI", 6);
+		page.Text(2 * W / 44, 17 * H / 26, "BA", 2);
+		page.Text(2 * W / 44, 18 * H / 26, "RETRB", 5);
+		page.Text(2 * W / 44, 19 * H / 26, "LAT ML", 6);
+		page.Text(8 * W / 44, 19 * H / 26, "LNG ML", 6);
+		page.Text(2 * W / 44, 20 * H / 26, "LAT T", 5);
+		page.Text(8 * W / 44, 20 * H / 26, "LNG T", 5);
+		page.Text(2 * W / 44, 21 * H / 26, "LAT IP", 6);
+		page.Text(8 * W / 44, 21 * H / 26, "LNG IP", 6);
+		page.Text(2 * W / 44, 22 * H / 26, "LAT ZL", 6);
+		page.Text(8 * W / 44, 22 * H / 26, "LNG ZL", 6);
+		page.Text(2 * W / 44, 23 * H / 26, "DLAT", 4);
+		page.Text(8 * W / 44, 23 * H / 26, "DLNG", 4);
 		
-		skp->Line(14 * W / 44, 6 * H / 26, 14 * W / 44, 24 * H / 26);
+		page.Line(14 * W / 44, 6 * H / 26, 14 * W / 44, 24 * H / 26);
 
 		if (GC->rtcc->RZRFDP.Indicator == 0)
 		{
-			sprintf_s(Buffer, "%s", GC->rtcc->RZRFDP.RefsID.c_str());
-			skp->Text(16 * W / 44, 6 * H / 26, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.1lf", GC->rtcc->RZRFDP.CSMWeightRetro);
-			skp->Text(16 * W / 44, 7 * H / 26, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.0lf", GC->rtcc->RZRFDP.TrueAnomalyRetro);
-			skp->Text(22 * W / 44, 7 * H / 26, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.1lf %.1lf %.1lf", GC->rtcc->RZRFDP.Att_LVLH.x, GC->rtcc->RZRFDP.Att_LVLH.y, GC->rtcc->RZRFDP.Att_LVLH.z);
-			skp->Text(16 * W / 44, 8 * H / 26, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.1lf %.1lf %.1lf", GC->rtcc->RZRFDP.Att_IMU.x, GC->rtcc->RZRFDP.Att_IMU.y, GC->rtcc->RZRFDP.Att_IMU.z);
-			skp->Text(16 * W / 44, 9 * H / 26, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.1lf", GC->rtcc->RZRFDP.DVC);
-			skp->Text(16 * W / 44, 10 * H / 26, Buffer, strlen(Buffer));
+			page.Printf(16 * W / 44, 6 * H / 26, "%s", GC->rtcc->RZRFDP.RefsID.c_str());
+			page.Printf(16 * W / 44, 7 * H / 26, "%.1lf", GC->rtcc->RZRFDP.CSMWeightRetro);
+			page.Printf(22 * W / 44, 7 * H / 26, "%.0lf", GC->rtcc->RZRFDP.TrueAnomalyRetro);
+			page.Printf(16 * W / 44, 8 * H / 26, "%.1lf %.1lf %.1lf", GC->rtcc->RZRFDP.Att_LVLH.x, GC->rtcc->RZRFDP.Att_LVLH.y, GC->rtcc->RZRFDP.Att_LVLH.z);
+			page.Printf(16 * W / 44, 9 * H / 26, "%.1lf %.1lf %.1lf", GC->rtcc->RZRFDP.Att_IMU.x, GC->rtcc->RZRFDP.Att_IMU.y, GC->rtcc->RZRFDP.Att_IMU.z);
+			page.Printf(16 * W / 44, 10 * H / 26, "%.1lf", GC->rtcc->RZRFDP.DVC);
 			SStoHHMMSS(GC->rtcc->RZRFDP.BurnTime, hh, mm, secs);
-			sprintf_s(Buffer, "%02d:%04.1lf", mm, secs);
-			skp->Text(22 * W / 44, 10 * H / 26, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.1lf", GC->rtcc->RZRFDP.DVT);
-			skp->Text(16 * W / 44, 11 * H / 26, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%+d", GC->rtcc->RZRFDP.UllageQuads);
-			skp->Text(21 * W / 44, 11 * H / 26, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.1lf", GC->rtcc->RZRFDP.UllageDT);
-			skp->Text(24 * W / 44, 11 * H / 26, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.1lf", GC->rtcc->RZRFDP.H_Retro);
-			skp->Text(16 * W / 44, 12 * H / 26, Buffer, strlen(Buffer));
-			GET_Display2(Buffer, GC->rtcc->RZRFDP.GETI);
-			skp->Text(16 * W / 44, 13 * H / 26, Buffer, strlen(Buffer));
-			GET_Display(Buffer, GC->rtcc->RZRFDP.GMTI, false);
-			skp->Text(16 * W / 44, 14 * H / 26, Buffer, strlen(Buffer));
+			page.Printf(22 * W / 44, 10 * H / 26, "%02d:%04.1lf", mm, secs);
+			page.Printf(16 * W / 44, 11 * H / 26, "%.1lf", GC->rtcc->RZRFDP.DVT);
+			page.Printf(21 * W / 44, 11 * H / 26, "%+d", GC->rtcc->RZRFDP.UllageQuads);
+			page.Printf(24 * W / 44, 11 * H / 26, "%.1lf", GC->rtcc->RZRFDP.UllageDT);
+			page.Printf(16 * W / 44, 12 * H / 26, "%.1lf", GC->rtcc->RZRFDP.H_Retro);
+			page.Format(16 * W / 44, 13 * H / 26, this, &ApolloRTCCMFD::GET_Display2, GC->rtcc->RZRFDP.GETI);
+			page.Format(16 * W / 44, 14 * H / 26, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->RZRFDP.GMTI, false);
 			SStoHHMMSS(GC->rtcc->RZRFDP.RET400k, hh, mm, secs);
-			sprintf_s(Buffer, "%d:%02.0lf", mm, secs);
-			skp->Text(16 * W / 44, 15 * H / 26, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.0lf", GC->rtcc->RZRFDP.V400k);
-			skp->Text(16 * W / 44, 16 * H / 26, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.2lf", GC->rtcc->RZRFDP.Gamma400k);
-			skp->Text(22 * W / 44, 16 * H / 26, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.1lf", GC->rtcc->RZRFDP.BankAngle);
-			skp->Text(16 * W / 44, 17 * H / 26, Buffer, strlen(Buffer));
+			page.Printf(16 * W / 44, 15 * H / 26, "%d:%02.0lf", mm, secs);
+			page.Printf(16 * W / 44, 16 * H / 26, "%.0lf", GC->rtcc->RZRFDP.V400k);
+			page.Printf(22 * W / 44, 16 * H / 26, "%.2lf", GC->rtcc->RZRFDP.Gamma400k);
+			page.Printf(16 * W / 44, 17 * H / 26, "%.1lf", GC->rtcc->RZRFDP.BankAngle);
 			SStoHHMMSS(GC->rtcc->RZRFDP.RETRB, hh, mm, secs);
-			sprintf_s(Buffer, "%d:%02.0lf", mm, secs);
-			skp->Text(16 * W / 44, 18 * H / 26, Buffer, strlen(Buffer));
-			FormatLatitude(Buffer, GC->rtcc->RZRFDP.lat_ML);
-			skp->Text(16 * W / 44, 19 * H / 26, Buffer, strlen(Buffer));
-			FormatLongitude(Buffer, GC->rtcc->RZRFDP.lng_ML);
-			skp->Text(24 * W / 44, 19 * H / 26, Buffer, strlen(Buffer));
-			FormatLatitude(Buffer, GC->rtcc->RZRFDP.lat_T*DEG);
-			skp->Text(16 * W / 44, 20 * H / 26, Buffer, strlen(Buffer));
-			FormatLongitude(Buffer, GC->rtcc->RZRFDP.lng_T*DEG);
-			skp->Text(24 * W / 44, 20 * H / 26, Buffer, strlen(Buffer));
-			FormatLatitude(Buffer, GC->rtcc->RZRFDP.lat_IP);
-			skp->Text(16 * W / 44, 21 * H / 26, Buffer, strlen(Buffer));
-			FormatLongitude(Buffer, GC->rtcc->RZRFDP.lng_IP);
-			skp->Text(24 * W / 44, 21 * H / 26, Buffer, strlen(Buffer));
-			FormatLatitude(Buffer, GC->rtcc->RZRFDP.lat_ZL);
-			skp->Text(16 * W / 44, 22 * H / 26, Buffer, strlen(Buffer));
-			FormatLongitude(Buffer, GC->rtcc->RZRFDP.lng_ZL);
-			skp->Text(24 * W / 44, 22 * H / 26, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.2lf %.2lf NM", GC->rtcc->RZRFDP.dlat_NM, GC->rtcc->RZRFDP.dlng_NM);
-			skp->Text(16 * W / 44, 23 * H / 26, Buffer, strlen(Buffer));
+			page.Printf(16 * W / 44, 18 * H / 26, "%d:%02.0lf", mm, secs);
+			page.Format(16 * W / 44, 19 * H / 26, this, &ApolloRTCCMFD::FormatLatitude, GC->rtcc->RZRFDP.lat_ML);
+			page.Format(24 * W / 44, 19 * H / 26, this, &ApolloRTCCMFD::FormatLongitude, GC->rtcc->RZRFDP.lng_ML);
+			page.Format(16 * W / 44, 20 * H / 26, this, &ApolloRTCCMFD::FormatLatitude, GC->rtcc->RZRFDP.lat_T*DEG);
+			page.Format(24 * W / 44, 20 * H / 26, this, &ApolloRTCCMFD::FormatLongitude, GC->rtcc->RZRFDP.lng_T*DEG);
+			page.Format(16 * W / 44, 21 * H / 26, this, &ApolloRTCCMFD::FormatLatitude, GC->rtcc->RZRFDP.lat_IP);
+			page.Format(24 * W / 44, 21 * H / 26, this, &ApolloRTCCMFD::FormatLongitude, GC->rtcc->RZRFDP.lng_IP);
+			page.Format(16 * W / 44, 22 * H / 26, this, &ApolloRTCCMFD::FormatLatitude, GC->rtcc->RZRFDP.lat_ZL);
+			page.Format(24 * W / 44, 22 * H / 26, this, &ApolloRTCCMFD::FormatLongitude, GC->rtcc->RZRFDP.lng_ZL);
+			page.Printf(16 * W / 44, 23 * H / 26, "%.2lf %.2lf NM", GC->rtcc->RZRFDP.dlat_NM, GC->rtcc->RZRFDP.dlng_NM);
 		}
 		else if (GC->rtcc->RZRFDP.Indicator == 1)
 		{
-			skp->Text(16 * W / 44, 13 * H / 26, "NO DATA", 7);
+			page.Text(16 * W / 44, 13 * H / 26, "NO DATA", 7);
 		}
 		else
 		{
-			skp->Text(16 * W / 44, 13 * H / 26, "ERROR - REFER TO ONLINE", 23);
+			page.Text(16 * W / 44, 13 * H / 26, "ERROR - REFER TO ONLINE", 23);
 		}
 	}
 	else if (screen == 105)
 	{
-		skp->Text(2 * W / 8, 2 * H / 26, "Retrofire External DV (MSK 329)", 31);
-
-		skp->Text(1 * W / 8, 10 * H / 26, "GETI", 4);
-		skp->Text(1 * W / 8, 11 * H / 26, "VGX XDV", 7);
-		skp->Text(1 * W / 8, 12 * H / 26, "VGY XDV", 7);
-		skp->Text(1 * W / 8, 13 * H / 26, "VGZ XDV", 7);
-		skp->Text(1 * W / 8, 14 * H / 26, "DEL P", 5);
-		skp->Text(1 * W / 8, 15 * H / 26, "DEL Y", 5);
-		skp->Text(1 * W / 8, 16 * H / 26, "DT TO", 5);
-		skp->Text(1 * W / 8, 17 * H / 26, "DV TO", 5);
-		skp->Text(1 * W / 8, 18 * H / 26, "HA", 2);
-		skp->Text(1 * W / 8, 19 * H / 26, "HP", 2);
-		skp->Text(1 * W / 8, 20 * H / 26, "LAT IP", 6);
-		skp->Text(1 * W / 8, 21 * H / 26, "LNG IP", 6);
+		page.Text(2 * W / 8, 2 * H / 26, "Retrofire External DV (MSK 329)", 31);
+
+		page.Text(1 * W / 8, 10 * H / 26, "GETI", 4);
+		page.Text(1 * W / 8, 11 * H / 26, "VGX XDV", 7);
+		page.Text(1 * W / 8, 12 * H / 26, "VGY XDV", 7);
+		page.Text(1 * W / 8, 13 * H / 26, "VGZ XDV", 7);
+		page.Text(1 * W / 8, 14 * H / 26, "DEL P", 5);
+		page.Text(1 * W / 8, 15 * H / 26, "DEL Y", 5);
+		page.Text(1 * W / 8, 16 * H / 26, "DT TO", 5);
+		page.Text(1 * W / 8, 17 * H / 26, "DV TO", 5);
+		page.Text(1 * W / 8, 18 * H / 26, "HA", 2);
+		page.Text(1 * W / 8, 19 * H / 26, "HP", 2);
+		page.Text(1 * W / 8, 20 * H / 26, "LAT IP", 6);
+		page.Text(1 * W / 8, 21 * H / 26, "LNG IP", 6);
 
 		if (GC->rtcc->RZRFDP.Indicator == 0)
 		{
-			GET_Display2(Buffer, GC->rtcc->RZRFDP.GETI);
-			skp->Text(4 * W / 8, 10 * H / 26, Buffer, strlen(Buffer));
-
-			AGC_Display(Buffer, GC->rtcc->RZRFDP.VG_XDX.x);
-			skp->Text(4 * W / 8, 11 * H / 26, Buffer, strlen(Buffer));
-			AGC_Display(Buffer, GC->rtcc->RZRFDP.VG_XDX.y);
-			skp->Text(4 * W / 8, 12 * H / 26, Buffer, strlen(Buffer));
-			AGC_Display(Buffer, GC->rtcc->RZRFDP.VG_XDX.z);
-			skp->Text(4 * W / 8, 13 * H / 26, Buffer, strlen(Buffer));
-
-			sprintf_s(Buffer, "%+.2lf", GC->rtcc->RZRFDP.P_G);
-			skp->Text(4 * W / 8, 14 * H / 26, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%+.2lf", GC->rtcc->RZRFDP.Y_G);
-			skp->Text(4 * W / 8, 15 * H / 26, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.2lf", GC->rtcc->RZRFDP.DT_TO);
-			skp->Text(4 * W / 8, 16 * H / 26, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.2lf", GC->rtcc->RZRFDP.DV_TO);
-			skp->Text(4 * W / 8, 17 * H / 26, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.1lf", GC->rtcc->RZRFDP.H_apo);
-			skp->Text(4 * W / 8, 18 * H / 26, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.1lf", GC->rtcc->RZRFDP.H_peri);
-			skp->Text(4 * W / 8, 19 * H / 26, Buffer, strlen(Buffer));
-			FormatLatitude(Buffer, GC->rtcc->RZRFDP.lat_IP);
-			skp->Text(4 * W / 8, 20 * H / 26, Buffer, strlen(Buffer));
-			FormatLongitude(Buffer, GC->rtcc->RZRFDP.lng_IP);
-			skp->Text(4 * W / 8, 21 * H / 26, Buffer, strlen(Buffer));
+			page.Format(4 * W / 8, 10 * H / 26, this, &ApolloRTCCMFD::GET_Display2, GC->rtcc->RZRFDP.GETI);
+
+			page.Format(4 * W / 8, 11 * H / 26, this, &ApolloRTCCMFD::AGC_Display, GC->rtcc->RZRFDP.VG_XDX.x);
+			page.Format(4 * W / 8, 12 * H / 26, this, &ApolloRTCCMFD::AGC_Display, GC->rtcc->RZRFDP.VG_XDX.y);
+			page.Format(4 * W / 8, 13 * H / 26, this, &ApolloRTCCMFD::AGC_Display, GC->rtcc->RZRFDP.VG_XDX.z);
+
+			page.Printf(4 * W / 8, 14 * H / 26, "%+.2lf", GC->rtcc->RZRFDP.P_G);
+			page.Printf(4 * W / 8, 15 * H / 26, "%+.2lf", GC->rtcc->RZRFDP.Y_G);
+			page.Printf(4 * W / 8, 16 * H / 26, "%.2lf", GC->rtcc->RZRFDP.DT_TO);
+			page.Printf(4 * W / 8, 17 * H / 26, "%.2lf", GC->rtcc->RZRFDP.DV_TO);
+			page.Printf(4 * W / 8, 18 * H / 26, "%.1lf", GC->rtcc->RZRFDP.H_apo);
+			page.Printf(4 * W / 8, 19 * H / 26, "%.1lf", GC->rtcc->RZRFDP.H_peri);
+			page.Format(4 * W / 8, 20 * H / 26, this, &ApolloRTCCMFD::FormatLatitude, GC->rtcc->RZRFDP.lat_IP);
+			page.Format(4 * W / 8, 21 * H / 26, this, &ApolloRTCCMFD::FormatLongitude, GC->rtcc->RZRFDP.lng_IP);
 		}
 		else if (GC->rtcc->RZRFDP.Indicator == 1)
 		{
-			skp->Text(16 * W / 44, 13 * H / 26, "NO DATA", 7);
+			page.Text(16 * W / 44, 13 * H / 26, "NO DATA", 7);
 		}
 	}
 	else if (screen == 106)
 	{
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
-		skp->Text(4 * W / 8, 2 * H / 26, "Recovery Target Selection (MSK 1454)", 36);
-		skp->SetFont(font3);
+		page.SetTextAlign(oapi::Sketchpad::CENTER);
+		page.Text(4 * W / 8, 2 * H / 26, "Recovery Target Selection (MSK 1454)", 36);
+		page.SetFont(font3);
 
-		sprintf_s(Buffer, "%d/%d", GC->rtcc->RZDRTSD.CurrentPage, GC->rtcc->RZDRTSD.TotalNumPages);
-		skp->Text(7 * W / 8, 4 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(7 * W / 8, 4 * H / 14, "%d/%d", GC->rtcc->RZDRTSD.CurrentPage, GC->rtcc->RZDRTSD.TotalNumPages);
 
-		//skp->Text(2 * W / 44, 5 * H / 26, "N", 1);
-		skp->Text(4 * W / 44, 10 * H / 26, "REV", 3);
-		skp->Text(9 * W / 44, 10 * H / 26, "GET", 3);
-		skp->Text(17 * W / 44, 10 * H / 26, "GMT", 3);
-		skp->Text(24 * W / 44, 10 * H / 26, "LAT", 3);
-		skp->Text(31 * W / 44, 10 * H / 26, "LNG", 3);
-		skp->Text(39 * W / 44, 10 * H / 26, "AZI", 3);
+		//page.Text(2 * W / 44, 5 * H / 26, "N", 1);
+		page.Text(4 * W / 44, 10 * H / 26, "REV", 3);
+		page.Text(9 * W / 44, 10 * H / 26, "GET", 3);
+		page.Text(17 * W / 44, 10 * H / 26, "GMT", 3);
+		page.Text(24 * W / 44, 10 * H / 26, "LAT", 3);
+		page.Text(31 * W / 44, 10 * H / 26, "LNG", 3);
+		page.Text(39 * W / 44, 10 * H / 26, "AZI", 3);
 
 		int j = (GC->rtcc->RZDRTSD.CurrentPage - 1) * 10;
 		for (int i = 0; i < 10;i++)
 		{
 			if (GC->rtcc->RZDRTSD.table[i + j].DataIndicator) break;
 
-			sprintf_s(Buffer, "%d", i + j + 1);
-			skp->Text(2 * W / 44, (12 + i) * H / 26, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%d", GC->rtcc->RZDRTSD.table[i + j].Rev);
-			skp->Text(4 * W / 44, (12 + i) * H / 26, Buffer, strlen(Buffer));
+			page.Printf(2 * W / 44, (12 + i) * H / 26, "%d", i + j + 1);
+			page.Printf(4 * W / 44, (12 + i) * H / 26, "%d", GC->rtcc->RZDRTSD.table[i + j].Rev);
 
-			GET_Display(Buffer, GC->rtcc->RZDRTSD.table[i + j].GET, false);
-			skp->Text(9 * W / 44, (12 + i) * H / 26, Buffer, strlen(Buffer));
-			GET_Display(Buffer, GC->rtcc->RZDRTSD.table[i + j].GMT, false);
-			skp->Text(17 * W / 44, (12 + i) * H / 26, Buffer, strlen(Buffer));
+			page.Format(9 * W / 44, (12 + i) * H / 26, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->RZDRTSD.table[i + j].GET, false);
+			page.Format(17 * W / 44, (12 + i) * H / 26, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->RZDRTSD.table[i + j].GMT, false);
 
-			FormatLatitude(Buffer, GC->rtcc->RZDRTSD.table[i + j].Latitude);
-			skp->Text(24 * W / 44, (12 + i) * H / 26, Buffer, strlen(Buffer));
-			FormatLongitude(Buffer, GC->rtcc->RZDRTSD.table[i + j].Longitude);
-			skp->Text(31 * W / 44, (12 + i) * H / 26, Buffer, strlen(Buffer));
+			page.Format(24 * W / 44, (12 + i) * H / 26, this, &ApolloRTCCMFD::FormatLatitude, GC->rtcc->RZDRTSD.table[i + j].Latitude);
+			page.Format(31 * W / 44, (12 + i) * H / 26, this, &ApolloRTCCMFD::FormatLongitude, GC->rtcc->RZDRTSD.table[i + j].Longitude);
 
-			sprintf_s(Buffer, "%06.2lf", GC->rtcc->RZDRTSD.table[i + j].Azimuth);
-			skp->Text(39 * W / 44, (12 + i) * H / 26, Buffer, strlen(Buffer));
+			page.Printf(39 * W / 44, (12 + i) * H / 26, "%06.2lf", GC->rtcc->RZDRTSD.table[i + j].Azimuth);
 		}
 	}
 	else if (screen == 107)
 	{
-		skp->Text(4 * W / 8, 1 * H / 32, "Abort Scan Table Inputs", 23);
+		page.Text(4 * W / 8, 1 * H / 32, "Abort Scan Table Inputs", 23);
 
 		if (G->RTEASTType == 75)
 		{
-			skp->Text(1 * W / 16, 2 * H / 14, "Unspecified Area", 21);
+			page.Text(1 * W / 16, 2 * H / 14, "Unspecified Area", 21);
 		}
 		else if (G->RTEASTType == 76)
 		{
-			skp->Text(1 * W / 16, 2 * H / 14, "Specific Site", 13);
+			page.Text(1 * W / 16, 2 * H / 14, "Specific Site", 13);
 		}
 		else
 		{
-			skp->Text(1 * W / 16, 2 * H / 14, "Lunar Search", 12);
+			page.Text(1 * W / 16, 2 * H / 14, "Lunar Search", 12);
 		}
 
 		//4: Type TCUA, FCUA or Site
@@ -8745,114 +7495,96 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 		
 		if (G->RTEASTType == 75)
 		{
-			sprintf_s(Buffer, "%s", GC->rtcc->med_f75.Type.c_str());
-			skp->Text(1 * W / 16, 4 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(1 * W / 16, 4 * H / 14, "%s", GC->rtcc->med_f75.Type.c_str());
 
 			if (GC->MissionPlanningActive)
 			{
-				GET_Display(Buffer, GC->rtcc->med_f75.T_V, false);
-				skp->Text(1 * W / 16, 6 * H / 14, Buffer, strlen(Buffer));
+				page.Format(1 * W / 16, 6 * H / 14, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->med_f75.T_V, false);
 			}
 
-			GET_Display(Buffer, GC->rtcc->med_f75.T_0, false);
-			skp->Text(1 * W / 16, 8 * H / 14, Buffer, strlen(Buffer));
+			page.Format(1 * W / 16, 8 * H / 14, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->med_f75.T_0, false);
 
-			sprintf_s(Buffer, "%.0lf ft/s", GC->rtcc->med_f75.DVMAX);
-			skp->Text(1 * W / 16, 10 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(1 * W / 16, 10 * H / 14, "%.0lf ft/s", GC->rtcc->med_f75.DVMAX);
 
-			sprintf_s(Buffer, "%s", GC->rtcc->med_f75.EntryProfile.c_str());
-			skp->Text(10 * W / 16, 4 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(10 * W / 16, 4 * H / 14, "%s", GC->rtcc->med_f75.EntryProfile.c_str());
 
-			sprintf_s(Buffer, "%.2lf", GC->rtcc->med_f75.Inclination*DEG);
-			skp->Text(10 * W / 16, 8 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(10 * W / 16, 8 * H / 14, "%.2lf", GC->rtcc->med_f75.Inclination*DEG);
 		}
 		else if (G->RTEASTType == 76)
 		{
-			sprintf_s(Buffer, "%s", GC->rtcc->med_f76.Site.c_str());
-			skp->Text(1 * W / 16, 4 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(1 * W / 16, 4 * H / 14, "%s", GC->rtcc->med_f76.Site.c_str());
 
 			if (GC->MissionPlanningActive)
 			{
-				GET_Display(Buffer, GC->rtcc->med_f76.T_V, false);
-				skp->Text(1 * W / 16, 6 * H / 14, Buffer, strlen(Buffer));
+				page.Format(1 * W / 16, 6 * H / 14, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->med_f76.T_V, false);
 			}
 
-			GET_Display(Buffer, GC->rtcc->med_f76.T_0, false);
-			skp->Text(1 * W / 16, 8 * H / 14, Buffer, strlen(Buffer));
+			page.Format(1 * W / 16, 8 * H / 14, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->med_f76.T_0, false);
 
-			GET_Display(Buffer, GC->rtcc->med_f76.T_Z, false);
-			skp->Text(1 * W / 16, 12 * H / 14, Buffer, strlen(Buffer));
+			page.Format(1 * W / 16, 12 * H / 14, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->med_f76.T_Z, false);
 
-			sprintf_s(Buffer, "%s", GC->rtcc->med_f76.EntryProfile.c_str());
-			skp->Text(10 * W / 16, 4 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(10 * W / 16, 4 * H / 14, "%s", GC->rtcc->med_f76.EntryProfile.c_str());
 
-			sprintf_s(Buffer, "%.2lf", GC->rtcc->med_f76.Inclination*DEG);
-			skp->Text(10 * W / 16, 8 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(10 * W / 16, 8 * H / 14, "%.2lf", GC->rtcc->med_f76.Inclination*DEG);
 		}
 		else
 		{
-			sprintf_s(Buffer, "%s", GC->rtcc->med_f77.Site.c_str());
-			skp->Text(1 * W / 16, 4 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(1 * W / 16, 4 * H / 14, "%s", GC->rtcc->med_f77.Site.c_str());
 
 			if (GC->MissionPlanningActive)
 			{
-				GET_Display(Buffer, GC->rtcc->med_f77.T_V, false);
-				skp->Text(1 * W / 16, 6 * H / 14, Buffer, strlen(Buffer));
+				page.Format(1 * W / 16, 6 * H / 14, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->med_f77.T_V, false);
 			}
 
-			GET_Display(Buffer, GC->rtcc->med_f77.T_min, false);
-			skp->Text(1 * W / 16, 8 * H / 14, Buffer, strlen(Buffer));
+			page.Format(1 * W / 16, 8 * H / 14, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->med_f77.T_min, false);
 
 			if (GC->rtcc->med_f77.Site != "FCUA")
 			{
-				GET_Display(Buffer, GC->rtcc->med_f77.T_Z, false);
-				skp->Text(1 * W / 16, 12 * H / 14, Buffer, strlen(Buffer));
+				page.Format(1 * W / 16, 12 * H / 14, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->med_f77.T_Z, false);
 			}
 
-			sprintf_s(Buffer, "%s", GC->rtcc->med_f77.EntryProfile.c_str());
-			skp->Text(10 * W / 16, 4 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(10 * W / 16, 4 * H / 14, "%s", GC->rtcc->med_f77.EntryProfile.c_str());
 
-			sprintf_s(Buffer, "%.2lf", GC->rtcc->med_f77.Inclination*DEG);
-			skp->Text(10 * W / 16, 8 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(10 * W / 16, 8 * H / 14, "%.2lf", GC->rtcc->med_f77.Inclination*DEG);
 		}
 	}
 	else if (screen == 108)
 	{
-		skp->Text(2 * W / 8, 2 * H / 32, "ABORT SCAN TABLE (MSK 362)", 26);
+		page.Text(2 * W / 8, 2 * H / 32, "ABORT SCAN TABLE (MSK 362)", 26);
 
-		skp->SetFont(font2);
-		skp->SetPen(pen2);
-		skp->SetTextAlign(oapi::Sketchpad::LEFT, oapi::Sketchpad::BASELINE);
+		page.SetFont(font2);
+		page.SetPen(pen2);
+		page.SetTextAlign(oapi::Sketchpad::LEFT, oapi::Sketchpad::BASELINE);
 
-		skp->Line(0, 5 * H / 32, W, 5 * H / 32);
-		skp->Line(0, 9 * H / 32, W, 9 * H / 32);
-		skp->Line(4 * W / 32, 5 * H / 32, 4 * W / 32, 31 * H / 32);
-		skp->Line(8 * W / 32, 5 * H / 32, 8 * W / 32, 31 * H / 32);
-		skp->Line(14 * W / 32, 5 * H / 32, 14 * W / 32, 31 * H / 32);
-		skp->Line(18 * W / 32, 5 * H / 32, 18 * W / 32, 31 * H / 32);
-		skp->Line(22 * W / 32, 5 * H / 32, 22 * W / 32, 31 * H / 32);
-		skp->Line(55 * W / 64, 5 * H / 32, 55 * W / 64, 31 * H / 32);
+		page.Line(0, 5 * H / 32, W, 5 * H / 32);
+		page.Line(0, 9 * H / 32, W, 9 * H / 32);
+		page.Line(4 * W / 32, 5 * H / 32, 4 * W / 32, 31 * H / 32);
+		page.Line(8 * W / 32, 5 * H / 32, 8 * W / 32, 31 * H / 32);
+		page.Line(14 * W / 32, 5 * H / 32, 14 * W / 32, 31 * H / 32);
+		page.Line(18 * W / 32, 5 * H / 32, 18 * W / 32, 31 * H / 32);
+		page.Line(22 * W / 32, 5 * H / 32, 22 * W / 32, 31 * H / 32);
+		page.Line(55 * W / 64, 5 * H / 32, 55 * W / 64, 31 * H / 32);
 
-		skp->Text(1 * W / 64, 6 * H / 32, "CODE", 4);
+		page.Text(1 * W / 64, 6 * H / 32, "CODE", 4);
 
-		skp->Text(5 * W / 32, 6 * H / 32, "SITE", 4);
-		skp->Text(5 * W / 32, 7 * H / 32, "AM", 2);
+		page.Text(5 * W / 32, 6 * H / 32, "SITE", 4);
+		page.Text(5 * W / 32, 7 * H / 32, "AM", 2);
 
-		skp->Text(10 * W / 32, 6 * H / 32, "GETI", 4);
-		skp->Text(10 * W / 32, 7 * H / 32, "GETV", 4);
+		page.Text(10 * W / 32, 6 * H / 32, "GETI", 4);
+		page.Text(10 * W / 32, 7 * H / 32, "GETV", 4);
 
-		skp->Text(15 * W / 32, 6 * H / 32, "DV", 2);
-		skp->Text(15 * W / 32, 7 * H / 32, "INCL", 4);
-		skp->Text(15 * W / 32, 8 * H / 32, "HPC", 3);
+		page.Text(15 * W / 32, 6 * H / 32, "DV", 2);
+		page.Text(15 * W / 32, 7 * H / 32, "INCL", 4);
+		page.Text(15 * W / 32, 8 * H / 32, "HPC", 3);
 
-		skp->Text(19 * W / 32, 6 * H / 32, "VEI", 3);
-		skp->Text(19 * W / 32, 7 * H / 32, "GEI", 3);
+		page.Text(19 * W / 32, 6 * H / 32, "VEI", 3);
+		page.Text(19 * W / 32, 7 * H / 32, "GEI", 3);
 
-		skp->Text(24 * W / 32, 6 * H / 32, "GETEI", 5);
-		skp->Text(24 * W / 32, 7 * H / 32, "GETL", 4);
+		page.Text(24 * W / 32, 6 * H / 32, "GETEI", 5);
+		page.Text(24 * W / 32, 7 * H / 32, "GETL", 4);
 
-		skp->Text(56 * W / 64, 6 * H / 32, "LAT IP", 6);
-		skp->Text(56 * W / 64, 7 * H / 32, "LNG IP", 6);
+		page.Text(56 * W / 64, 6 * H / 32, "LAT IP", 6);
+		page.Text(56 * W / 64, 7 * H / 32, "LNG IP", 6);
 
 		ASTData *tab;
 		for (int i = 0;i < 7;i++)
@@ -8860,18 +7592,13 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			tab = &GC->rtcc->PZREAP.AbortScanTableData[i];
 			if (tab->ASTCode == 0) continue;
 
-			sprintf_s(Buffer, "%d", tab->ASTCode);
-			skp->Text(1 * W / 32, (10 + 3 * i) * H / 32, Buffer, strlen(Buffer));
+			page.Printf(1 * W / 32, (10 + 3 * i) * H / 32, "%d", tab->ASTCode);
 
-			sprintf_s(Buffer, "%s", tab->SiteID.c_str());
-			skp->Text(9 * W / 64, (10 + 3 * i) * H / 32, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%s", tab->AbortMode.c_str());
-			skp->Text(9 * W / 64, (11 + 3 * i) * H / 32, Buffer, strlen(Buffer));
+			page.Printf(9 * W / 64, (10 + 3 * i) * H / 32, "%s", tab->SiteID.c_str());
+			page.Printf(9 * W / 64, (11 + 3 * i) * H / 32, "%s", tab->AbortMode.c_str());
 
-			GET_Display(Buffer, GC->rtcc->GETfromGMT(tab->AbortGMT), false);
-			skp->Text(9 * W / 32, (10 + 3 * i) * H / 32, Buffer, strlen(Buffer));
-			GET_Display(Buffer, GC->rtcc->GETfromGMT(tab->VectorGMT), false);
-			skp->Text(9 * W / 32, (11 + 3 * i) * H / 32, Buffer, strlen(Buffer));
+			page.Format(9 * W / 32, (10 + 3 * i) * H / 32, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->GETfromGMT(tab->AbortGMT), false);
+			page.Format(9 * W / 32, (11 + 3 * i) * H / 32, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->GETfromGMT(tab->VectorGMT), false);
 
 			if (tab->dv >= 304.8)
 			{
@@ -8885,7 +7612,7 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			{
 				sprintf_s(Buffer, "%.2lf", tab->dv / 0.3048);
 			}
-			skp->Text(29 * W / 64, (10 + 3 * i) * H / 32, Buffer, strlen(Buffer));
+			page.Text(29 * W / 64, (10 + 3 * i) * H / 32, Buffer, strlen(Buffer));
 			if (tab->incl_EI < 0)
 			{
 				sprintf(Buffer, "A%.2f", abs(tab->incl_EI*DEG));
@@ -8894,112 +7621,89 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 			{
 				sprintf(Buffer, "D%.2f", tab->incl_EI*DEG);
 			}
-			skp->Text(29 * W / 64, (11 + 3 * i) * H / 32, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.1lf", tab->h_PC / 1852.0);
-			skp->Text(29 * W / 64, (12 + 3 * i) * H / 32, Buffer, strlen(Buffer));
+			page.Text(29 * W / 64, (11 + 3 * i) * H / 32, Buffer, strlen(Buffer));
+			page.Printf(29 * W / 64, (12 + 3 * i) * H / 32, "%.1lf", tab->h_PC / 1852.0);
 
-			sprintf_s(Buffer, "%.0lf", tab->v_EI / 0.3048);
-			skp->Text(19 * W / 32, (10 + 3 * i) * H / 32, Buffer, strlen(Buffer));
-			sprintf_s(Buffer, "%.2lf", tab->gamma_EI*DEG);
-			skp->Text(19 * W / 32, (11 + 3 * i) * H / 32, Buffer, strlen(Buffer));
+			page.Printf(19 * W / 32, (10 + 3 * i) * H / 32, "%.0lf", tab->v_EI / 0.3048);
+			page.Printf(19 * W / 32, (11 + 3 * i) * H / 32, "%.2lf", tab->gamma_EI*DEG);
 
-			GET_Display(Buffer, GC->rtcc->GETfromGMT(tab->ReentryGMT), false);
-			skp->Text(23 * W / 32, (10 + 3 * i) * H / 32, Buffer, strlen(Buffer));
-			GET_Display(Buffer, GC->rtcc->GETfromGMT(tab->SplashdownGMT), false);
-			skp->Text(23 * W / 32, (11 + 3 * i) * H / 32, Buffer, strlen(Buffer));
+			page.Format(23 * W / 32, (10 + 3 * i) * H / 32, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->GETfromGMT(tab->ReentryGMT), false);
+			page.Format(23 * W / 32, (11 + 3 * i) * H / 32, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->GETfromGMT(tab->SplashdownGMT), false);
 
-			FormatLatitude(Buffer, tab->lat_SPL*DEG);
-			skp->Text(56 * W / 64, (10 + 3 * i) * H / 32, Buffer, strlen(Buffer));
-			FormatLongitude(Buffer, tab->lng_SPL*DEG);
-			skp->Text(56 * W / 64, (11 + 3 * i) * H / 32, Buffer, strlen(Buffer));
+			page.Format(56 * W / 64, (10 + 3 * i) * H / 32, this, &ApolloRTCCMFD::FormatLatitude, tab->lat_SPL*DEG);
+			page.Format(56 * W / 64, (11 + 3 * i) * H / 32, this, &ApolloRTCCMFD::FormatLongitude, tab->lng_SPL*DEG);
 		}
 	}
 	else if (screen == 109)
 	{
-		skp->Text(2 * W / 8, 2 * H / 32, "RTE Digitals Manual Maneuver Input", 26);
+		page.Text(2 * W / 8, 2 * H / 32, "RTE Digitals Manual Maneuver Input", 26);
 
 		if (GC->MissionPlanningActive)
 		{
-			GET_Display(Buffer, GC->rtcc->med_f81.VectorTime, false);
-			skp->Text(1 * W / 16, 2 * H / 14, Buffer, strlen(Buffer));
+			page.Format(1 * W / 16, 2 * H / 14, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->med_f81.VectorTime, false);
 		}
 
-		GET_Display(Buffer, GC->rtcc->med_f81.IgnitionTime, false);
-		skp->Text(1 * W / 16, 4 * H / 14, Buffer, strlen(Buffer));
+		page.Format(1 * W / 16, 4 * H / 14, this, &ApolloRTCCMFD::GET_Display, GC->rtcc->med_f81.IgnitionTime, false);
 
-		sprintf_s(Buffer, "%.2lf", GC->rtcc->med_f81.lat_tgt*DEG);
-		skp->Text(1 * W / 16, 6 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(1 * W / 16, 6 * H / 14, "%.2lf", GC->rtcc->med_f81.lat_tgt*DEG);
 
-		sprintf_s(Buffer, "%.2lf", GC->rtcc->med_f81.lng_tgt*DEG);
-		skp->Text(1 * W / 16, 8 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(1 * W / 16, 8 * H / 14, "%.2lf", GC->rtcc->med_f81.lng_tgt*DEG);
 
 		if (GC->rtcc->med_f81.RefBody == BODY_EARTH)
 		{
-			skp->Text(1 * W / 16, 10 * H / 14, "EARTH", 5);
+			page.Text(1 * W / 16, 10 * H / 14, "EARTH", 5);
 		}
 		else
 		{
-			skp->Text(1 * W / 16, 10 * H / 14, "MOON", 4);
+			page.Text(1 * W / 16, 10 * H / 14, "MOON", 4);
 		}
 
-		sprintf_s(Buffer, "%+.1lf %+.1lf %+.1lf", GC->rtcc->med_f81.XDV.x / 0.3048, GC->rtcc->med_f81.XDV.y / 0.3048, GC->rtcc->med_f81.XDV.z / 0.3048);
-		skp->Text(1 * W / 16, 12 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(1 * W / 16, 12 * H / 14, "%+.1lf %+.1lf %+.1lf", GC->rtcc->med_f81.XDV.x / 0.3048, GC->rtcc->med_f81.XDV.y / 0.3048, GC->rtcc->med_f81.XDV.z / 0.3048);
 
-		skp->Text(8 * W / 16, 10 * H / 14, "Load splashdown target", 22);
+		page.Text(8 * W / 16, 10 * H / 14, "Load splashdown target", 22);
 	}
 	else if (screen == 110)
 	{
-		skp->Text(2 * W / 8, 2 * H / 32, "RTE Digitals Entry Profile", 26);
+		page.Text(2 * W / 8, 2 * H / 32, "RTE Digitals Entry Profile", 26);
 
-		sprintf_s(Buffer, "%s", GC->rtcc->med_f82.PrimaryEP.c_str());
-		skp->Text(1 * W / 16, 2 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(1 * W / 16, 2 * H / 14, "%s", GC->rtcc->med_f82.PrimaryEP.c_str());
 
-		sprintf_s(Buffer, "%.2lf", GC->rtcc->med_f82.PrimaryInitialBank*DEG);
-		skp->Text(1 * W / 16, 4 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(1 * W / 16, 4 * H / 14, "%.2lf", GC->rtcc->med_f82.PrimaryInitialBank*DEG);
 
-		sprintf_s(Buffer, "%.2lf", GC->rtcc->med_f82.PrimaryGLIT);
-		skp->Text(1 * W / 16, 6 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(1 * W / 16, 6 * H / 14, "%.2lf", GC->rtcc->med_f82.PrimaryGLIT);
 
 		if (GC->rtcc->med_f82.PrimaryEP == "HB1")
 		{
-			sprintf_s(Buffer, "%s", GC->rtcc->med_f82.PrimaryRollDirection.c_str());
-			skp->Text(1 * W / 16, 8 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(1 * W / 16, 8 * H / 14, "%s", GC->rtcc->med_f82.PrimaryRollDirection.c_str());
 
 			if (GC->rtcc->med_f82.PrimaryLongT > 999.9)
 			{
-				skp->Text(1 * W / 16, 10 * H / 14, "Constant G", 10);
+				page.Text(1 * W / 16, 10 * H / 14, "Constant G", 10);
 			}
 			else
 			{
-				sprintf_s(Buffer, "%.2lf", GC->rtcc->med_f82.PrimaryLongT*DEG);
-				skp->Text(1 * W / 16, 10 * H / 14, Buffer, strlen(Buffer));
+				page.Printf(1 * W / 16, 10 * H / 14, "%.2lf", GC->rtcc->med_f82.PrimaryLongT*DEG);
 			}
 		}
 
-		sprintf_s(Buffer, "%s", GC->rtcc->med_f82.BackupEP.c_str());
-		skp->Text(10 * W / 16, 2 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(10 * W / 16, 2 * H / 14, "%s", GC->rtcc->med_f82.BackupEP.c_str());
 
-		sprintf_s(Buffer, "%.2lf", GC->rtcc->med_f82.BackupInitialBank*DEG);
-		skp->Text(10 * W / 16, 4 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(10 * W / 16, 4 * H / 14, "%.2lf", GC->rtcc->med_f82.BackupInitialBank*DEG);
 
-		sprintf_s(Buffer, "%.2lf", GC->rtcc->med_f82.BackupGLIT);
-		skp->Text(10 * W / 16, 6 * H / 14, Buffer, strlen(Buffer));
+		page.Printf(10 * W / 16, 6 * H / 14, "%.2lf", GC->rtcc->med_f82.BackupGLIT);
 
 		if (GC->rtcc->med_f82.BackupEP == "HB1")
 		{
-			sprintf_s(Buffer, "%s", GC->rtcc->med_f82.PrimaryRollDirection.c_str());
-			skp->Text(10 * W / 16, 8 * H / 14, Buffer, strlen(Buffer));
+			page.Printf(10 * W / 16, 8 * H / 14, "%s", GC->rtcc->med_f82.PrimaryRollDirection.c_str());
 
 			if (GC->rtcc->med_f82.BackupLongT > 999.9)
 			{
-				skp->Text(10 * W / 16, 10 * H / 14, "Constant G", 10);
+				page.Text(10 * W / 16, 10 * H / 14, "Constant G", 10);
 			}
 			else
 			{
-				sprintf_s(Buffer, "%.2lf", GC->rtcc->med_f82.BackupLongT*DEG);
-				skp->Text(10 * W / 16, 10 * H / 14, Buffer, strlen(Buffer));
+				page.Printf(10 * W / 16, 10 * H / 14, "%.2lf", GC->rtcc->med_f82.BackupLongT*DEG);
 			}
 		}
 	}
-	return true;
 }
\ No newline at end of file
@@ -21,6 +21,7 @@ See http://nassp.sourceforge.net/license/ for more details.
 
 **************************************************************************/
 
+#include <cmath>
 #include "CoastNumericalIntegrator.h"
 #include "OrbMech.h"
 #include "rtcc.h"
@@ -51,6 +52,17 @@ bool CoastIntegrator2::Propagate(VECTOR3 R00, VECTOR3 V00, double gmt, double tm
 	SetBodyParameters(planet);
 	ISTOPS = stopcond;
 
+	//A state that isn't finite meets neither the end condition nor the maximum time and would never stop
+	if (!std::isfinite(length(R00) + length(V00) + gmt + deltat))
+	{
+		R2 = R00;
+		V2 = V00;
+		T2 = gmt;
+		outplanet = planet;
+		ITS = 0;
+		return false;
+	}
+
 	delta = _V(0, 0, 0);
 	nu = _V(0, 0, 0);
 	x = 0;
@@ -27,6 +27,7 @@ See http://nassp.sourceforge.net/license/ for more details.
 #include "OrbMech.h"
 #include "EntryCalculations.h"
 #include "CSMLMGuidanceSim.h"
+#include "WorkerPool.h"
 #include "rtcc.h"
 
 namespace EntryCalculations
@@ -4542,134 +4543,158 @@ void ConicRTEEarthNew::ATP(std::vector<ATPData> line)
 
 void ConicRTEEarthNew::MAIN()
 {
-	//Pre-initialization
-	VECTOR3 DV, V_a_uncal, V_a_cal;
-	double beta_r, dv, U_r, DVC, T, VT_a, VR_a, v_a, beta_a, T_z, alpha, delta, lambda, p, eta_ar, phi, phi_z, theta_z, TP;
-	int J, J_m, FLAG, QA;
-	EphemerisData sv;
+	struct AbortTimeSolution
+	{
+		std::vector<TradeoffData> TOData;
+		DiscreteData SolData;
+	};
+
+	int J, J_m;
 
-	J = 0;
 	J_m = XArray.size();
 
-	do
+	std::vector<AbortTimeSolution> sol(J_m);
+
+	//Every abort time is solved by its own copy of the processor, in its initialized state
+	const ConicRTEEarthNew &init = *this;
+	WorkerPool::ParallelFor(J_m, [&](int j)
 	{
-		sv = XArray[J];
+		ConicRTEEarthNew proc(init);
+		proc.TOData.clear();
+		proc.SolData = DiscreteData();
+		proc.MAINAbortTime(XArray[j]);
+		sol[j].TOData = proc.TOData;
+		sol[j].SolData = proc.SolData;
+	}, MaxThreads);
 
-		if (sv.RBI != BODY_EARTH)
+	//Merge in the order of the state vector array
+	for (J = 0;J < J_m;J++)
+	{
+		TOData.insert(TOData.end(), sol[J].TOData.begin(), sol[J].TOData.end());
+		if (sol[J].SolData.NOSOLN != 1)
 		{
-			goto ConicRTEEarth_MAIN_E;
+			//Discrete solution of the latest abort time is used
+			SolData = sol[J].SolData;
 		}
+	}
+}
+
+void ConicRTEEarthNew::MAINAbortTime(EphemerisData sv)
+{
+	VECTOR3 DV, V_a_uncal, V_a_cal;
+	double beta_r, dv, U_r, DVC, T, VT_a, VR_a, v_a, beta_a, T_z, alpha, delta, lambda, p, eta_ar, phi, phi_z, theta_z, TP;
+	int FLAG, QA;
+
+	if (sv.RBI != BODY_EARTH)
+	{
+		goto ConicRTEEarth_MAIN_E;
+	}
 
-		OrbMech::EclipticToECI(sv.R, sv.V, OrbMech::MJDfromGET(sv.GMT, GMTbase), sv.R, sv.V);
+	OrbMech::EclipticToECI(sv.R, sv.V, OrbMech::MJDfromGET(sv.GMT, GMTbase), sv.R, sv.V);
 
-		X0 = sv.R / KMPER / 1000.0;
-		U0 = sv.V*SCPHR / KMPER / 1000.0;
-		T0 = sv.GMT / SCPHR;
-		INITAL();
+	X0 = sv.R / KMPER / 1000.0;
+	U0 = sv.V*SCPHR / KMPER / 1000.0;
+	T0 = sv.GMT / SCPHR;
+	INITAL();
+	if (NOSOLN == 1)
+	{
+		goto ConicRTEEarth_MAIN_E;
+	}
+	if (Mode == 1)
+	{
+		beta_r = EntryCalculations::ReentryTargetLine(U_rmax*KMPER*1000.0 / SCPHR, false);
+		FCUA(0, X0, beta_r, dv, U_r, v_a, beta_a);
 		if (NOSOLN == 1)
 		{
 			goto ConicRTEEarth_MAIN_E;
 		}
-		if (Mode == 1)
+		VT_a = v_a * sin(beta_a);
+		//Radial velocity
+		VR_a = v_a * cos(beta_a);
+	ConicRTEEarth_MAIN_A:
+		VACOMP(VR_a, VT_a, beta_r, theta_0, DV, T_z, V_a_uncal, alpha, delta, lambda);
+		if (Mode != 1)
 		{
-			beta_r = EntryCalculations::ReentryTargetLine(U_rmax*KMPER*1000.0 / SCPHR, false);
-			FCUA(0, X0, beta_r, dv, U_r, v_a, beta_a);
-			if (NOSOLN == 1)
-			{
-				goto ConicRTEEarth_MAIN_E;
-			}
-			VT_a = v_a * sin(beta_a);
-			//Radial velocity
-			VR_a = v_a * cos(beta_a);
-		ConicRTEEarth_MAIN_A:
-			VACOMP(VR_a, VT_a, beta_r, theta_0, DV, T_z, V_a_uncal, alpha, delta, lambda);
-			if (Mode != 1)
-			{
-				VUP2(X0, V_a_uncal, T, beta_r, V_a_cal);
-			}
-			else
-			{
-				V_a_cal = V_a_uncal;
-			}
-			//Store solutions
-			//T_ar_stored = T;
-			//OrbMech::rv_from_r0v0(X0, V_a, T_ar_stored, RR_vec, VV_vec, mu);
-			T_ar_stored = OrbMech::time_radius(X0, V_a_uncal, RR, -1.0, mu);
-			OrbMech::rv_from_r0v0(X0, V_a_uncal, T_ar_stored, RR_vec, VV_vec, mu);
-			StoreSolution(V_a_cal - U0, delta, T0, T, T_z);
+			VUP2(X0, V_a_uncal, T, beta_r, V_a_cal);
 		}
 		else
 		{
-			TMIN(dv, FLAG, T, U_r, VT_a, VR_a, beta_r);
-			if (NOSOLN != 0)
-			{
-				goto ConicRTEEarth_MAIN_E;
-			}
-			if (Mode == 0)
+			V_a_cal = V_a_uncal;
+		}
+		//Store solutions
+		//T_ar_stored = T;
+		//OrbMech::rv_from_r0v0(X0, V_a, T_ar_stored, RR_vec, VV_vec, mu);
+		T_ar_stored = OrbMech::time_radius(X0, V_a_uncal, RR, -1.0, mu);
+		OrbMech::rv_from_r0v0(X0, V_a_uncal, T_ar_stored, RR_vec, VV_vec, mu);
+		StoreSolution(V_a_cal - U0, delta, T0, T, T_z);
+	}
+	else
+	{
+		TMIN(dv, FLAG, T, U_r, VT_a, VR_a, beta_r);
+		if (NOSOLN != 0)
+		{
+			goto ConicRTEEarth_MAIN_E;
+		}
+		if (Mode == 0)
+		{
+			DVC = dv;
+			goto ConicRTEEarth_MAIN_A;
+		}
+		T_mt = T;
+	ConicRTEEarth_MAIN_B:
+		VELCOM(T, r0, beta_r, DT, p, QA, SW6, U_r, VR_a, VT_a, beta_a, eta_ar, dv);
+		MSDS(VR_a, VT_a, beta_r, theta_0, delta, phi, phi_z, lambda, theta_z);
+		if (SW2 == 0 || Mode >= 4)
+		{
+			if (T > T_mt && abs(MD) < 1e-4 && (Mode == 2 || Mode == 3))
 			{
-				DVC = dv;
-				goto ConicRTEEarth_MAIN_A;
+				SW2 = 1;
+				//MD1 = 50;
+				//TARSP?
+				goto ConicRTEEarth_MAIN_C;
 			}
-			T_mt = T;
-		ConicRTEEarth_MAIN_B:
-			VELCOM(T, r0, beta_r, DT, p, QA, SW6, U_r, VR_a, VT_a, beta_a, eta_ar, dv);
-			MSDS(VR_a, VT_a, beta_r, theta_0, delta, phi, phi_z, lambda, theta_z);
-			if (SW2 == 0 || Mode >= 4)
+			else
 			{
-				if (T > T_mt && abs(MD) < 1e-4 && (Mode == 2 || Mode == 3))
-				{
-					SW2 = 1;
-					//MD1 = 50;
-					//TARSP?
-					goto ConicRTEEarth_MAIN_C;
-				}
-				else
+				TCOMP(dv, delta, T, TP);
+				if (STORE)
 				{
-					TCOMP(dv, delta, T, TP);
-					if (STORE)
-					{
-						VACOMP(VR_a, VT_a, beta_r, theta_0, DV, T_z, V_a_uncal, alpha, delta, lambda);
+					VACOMP(VR_a, VT_a, beta_r, theta_0, DV, T_z, V_a_uncal, alpha, delta, lambda);
 
-						//OrbMech::rv_from_r0v0(X0, V_a_uncal, T_ar_stored, RR_vec, VV_vec, mu);
-						T_ar_stored = OrbMech::time_radius(X0, V_a_uncal, RR, -1.0, mu);
-						OrbMech::rv_from_r0v0(X0, V_a_uncal, T_ar_stored, RR_vec, VV_vec, mu);
+					//OrbMech::rv_from_r0v0(X0, V_a_uncal, T_ar_stored, RR_vec, VV_vec, mu);
+					T_ar_stored = OrbMech::time_radius(X0, V_a_uncal, RR, -1.0, mu);
+					OrbMech::rv_from_r0v0(X0, V_a_uncal, T_ar_stored, RR_vec, VV_vec, mu);
 
-						VUP2(X0, V_a_uncal, T_ar_stored, beta_r, V_a_cal);
-						StoreSolution(V_a_cal - U0, delta, T0, T, T_z);
-						STORE = false;
-					}
-				ConicRTEEarth_MAIN_C:
+					VUP2(X0, V_a_uncal, T_ar_stored, beta_r, V_a_cal);
+					StoreSolution(V_a_cal - U0, delta, T0, T, T_z);
+					STORE = false;
+				}
+			ConicRTEEarth_MAIN_C:
 
-					if (SOL && (Mode == 2 || Mode == 3) && MDM != 0)
-					{
-						//SCAN();
-					}
+				if (SOL && (Mode == 2 || Mode == 3) && MDM != 0)
+				{
+					//SCAN();
+				}
 
-					if (END == 1)
+				if (END == 1)
+				{
+					if (NOSOLN == 2)
 					{
-						if (NOSOLN == 2)
-						{
-							goto ConicRTEEarth_MAIN_A;
-						}
-						else
-						{
-							goto ConicRTEEarth_MAIN_E;
-						}
+						goto ConicRTEEarth_MAIN_A;
 					}
 					else
 					{
-						goto ConicRTEEarth_MAIN_B;
+						goto ConicRTEEarth_MAIN_E;
 					}
 				}
+				else
+				{
+					goto ConicRTEEarth_MAIN_B;
+				}
 			}
 		}
-	ConicRTEEarth_MAIN_E:
-		J++;
-		if (J >= J_m)
-		{
-			return;
-		}
-	} while (J < J_m);
+	}
+ConicRTEEarth_MAIN_E:
+	return;
 }
 
 void ConicRTEEarthNew::StoreSolution(VECTOR3 dv, double lat, double t0, double t, double tz)
@@ -4894,7 +4919,8 @@ RTEEarth_INITAL_C:
 
 	DNDT = PRTIAL(FLAG, r0, U_rmax);
 	delta = asin(cos(eta_ar + eta_rz_avg))*dotp(R0, _V(0, 0, 1)) + sin(eta_ar + eta_rz_avg)*dotp(R2, _V(0, 0, 1));
-	double eps = 0.005; //TBD
+	double eps;
+	eps = 0.005; //TBD
 	if (DNDT > w_E*pow(cos(delta), 2) / cos(I_0) + eps)
 	{
 		T1 = TSW6;
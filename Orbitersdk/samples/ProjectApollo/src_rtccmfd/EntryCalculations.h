@@ -381,6 +381,7 @@ class ConicRTEEarthNew : public RTCCModule
 {
 public:
 	ConicRTEEarthNew(RTCC *r, std::vector<EphemerisData> &SVArray);
+	//Solves all abort times of the state vector array, concurrently
 	void MAIN();
 	void Init(double dvm, int icrngg, double irmax, double urmax, double rrbi, int imsfn);
 	void READ(int Mode, double gmtbase, double tzmin, double tzmax);
@@ -388,8 +389,13 @@ public:
 
 	std::vector<TradeoffData> TOData;
 	DiscreteData SolData;
+	//Threads used by MAIN, 0 = all hardware threads
+	unsigned MaxThreads = 0;
 protected:
 
+	//Solution for a single abort time
+	void MAINAbortTime(EphemerisData sv);
+
 	//SUBROUTINES:
 	void INITAL();
 	void DVMINQ(int FLAG, int QE, int Q0, double beta_r, double &DV, int &QA, double &V_a, double &beta_a);
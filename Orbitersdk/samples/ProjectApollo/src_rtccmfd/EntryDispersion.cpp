@@ -0,0 +1,192 @@
+/****************************************************************************
+This file is part of Project Apollo - NASSP
+
+RTCC Reentry Dispersion Analysis
+
+Project Apollo is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+Project Apollo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Project Apollo; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+See http://nassp.sourceforge.net/license/ for more details.
+
+**************************************************************************/
+
+#include <random>
+#include "EntryDispersion.h"
+#include "ReentryNumericalIntegrator.h"
+#include "WorkerPool.h"
+#include "rtcc.h"
+
+EntryDispersion::EntryDispersion(RTCC *r) : RTCCModule(r)
+{
+}
+
+void EntryDispersion::Main(const EntryDispersionInputTable &in, EntryDispersionOutputTable &out)
+{
+	std::vector<double> miss, gmax, qmax, Q;
+	unsigned i;
+
+	out = EntryDispersionOutputTable();
+	if (in.Cases <= 0) return;
+
+	DrawCases(in, out);
+
+	//Each case has its own integrator and writes only to its own slot
+	WorkerPool::ParallelFor(in.Cases, [&](int j)
+	{
+		FlyCase(in, out.Cases[j]);
+	}, in.MaxThreads);
+
+	for (i = 0;i < out.Cases.size();i++)
+	{
+		const EntryDispersionCase &c = out.Cases[i];
+
+		if (c.out.IEND == 1)
+		{
+			out.TimeLimits++;
+		}
+		else if (c.out.IEND == 3)
+		{
+			out.Skipouts++;
+		}
+		else if (c.out.IEND == 2)
+		{
+			out.Impacts++;
+			gmax.push_back(c.out.gmax);
+			qmax.push_back(c.out.qmax);
+			Q.push_back(c.out.Q);
+			if (c.KSWCH == 3)
+			{
+				miss.push_back(Distance(c.out.lat_IP, c.out.lng_IP, c.lat_T, c.lng_T));
+			}
+		}
+	}
+
+	Footprint(out);
+	Statistics(miss, out.TargetMiss);
+	Statistics(gmax, out.gmax);
+	Statistics(qmax, out.qmax);
+	Statistics(Q, out.Q);
+}
+
+void EntryDispersion::DrawCases(const EntryDispersionInputTable &in, EntryDispersionOutputTable &out)
+{
+	std::mt19937 gen(in.Seed);
+	std::normal_distribution<double> norm(0.0, 1.0);
+	double dn, de;
+	int i, mode;
+
+	out.Cases.resize(in.Cases);
+	for (i = 0;i < in.Cases;i++)
+	{
+		EntryDispersionCase &c = out.Cases[i];
+
+		//Always draw all values, so that a case doesn't change when another dispersion is switched off
+		c.DensityFactor = max(0.1, 1.0 + in.DensitySigma*norm(gen));
+		c.LiftFactor = max(0.0, 1.0 + in.LiftSigma*norm(gen));
+		c.dFPA = in.FPASigma*norm(gen);
+		dn = in.TargetSigma*norm(gen);
+		de = in.TargetSigma*norm(gen);
+		mode = (int)(gen() % (in.Modes.size() > 0 ? in.Modes.size() : 1));
+
+		c.lat_T = in.Nominal.lat_T + dn / OrbMech::R_Earth;
+		c.lng_T = in.Nominal.lng_T + de / (OrbMech::R_Earth*cos(in.Nominal.lat_T));
+		c.KSWCH = in.Modes.size() > 0 ? in.Modes[mode] : in.Nominal.KSWCH;
+	}
+}
+
+void EntryDispersion::FlyCase(const EntryDispersionInputTable &in, EntryDispersionCase &c)
+{
+	RMMYNIInputTable tab = in.Nominal;
+	VECTOR3 H;
+
+	tab.DensityFactor = c.DensityFactor;
+	tab.LiftFactor = c.LiftFactor;
+	tab.ErrorTolerance = in.ErrorTolerance;
+	tab.lat_T = c.lat_T;
+	tab.lng_T = c.lng_T;
+	tab.KSWCH = c.KSWCH;
+
+	//Turn the velocity in the orbital plane, a positive change raises the flight-path angle
+	H = unit(crossp(tab.R0, tab.V0));
+	tab.V0 = tab.V0*cos(c.dFPA) + crossp(tab.V0, H)*sin(c.dFPA);
+
+	ReentryNumericalIntegrator integ(pRTCC);
+	integ.Main(tab, c.out);
+}
+
+void EntryDispersion::Footprint(EntryDispersionOutputTable &out)
+{
+	VECTOR3 U;
+	double dlng, dn2, de2;
+	unsigned i;
+	int n;
+
+	//Mean impact point from the mean direction
+	U = _V(0, 0, 0);
+	n = 0;
+	for (i = 0;i < out.Cases.size();i++)
+	{
+		if (out.Cases[i].out.IEND != 2) continue;
+		U += OrbMech::r_from_latlong(out.Cases[i].out.lat_IP, out.Cases[i].out.lng_IP);
+		n++;
+	}
+	if (n == 0) return;
+	OrbMech::latlong_from_r(U, out.lat_mean, out.lng_mean);
+
+	dn2 = de2 = 0.0;
+	for (i = 0;i < out.Cases.size();i++)
+	{
+		const RMMYNIOutputTable &o = out.Cases[i].out;
+
+		if (o.IEND != 2) continue;
+
+		dlng = o.lng_IP - out.lng_mean;
+		while (dlng > PI) dlng -= PI2;
+		while (dlng < -PI) dlng += PI2;
+		dn2 += pow((o.lat_IP - out.lat_mean)*OrbMech::R_Earth, 2);
+		de2 += pow(dlng*cos(out.lat_mean)*OrbMech::R_Earth, 2);
+		out.maxmiss = max(out.maxmiss, Distance(o.lat_IP, o.lng_IP, out.lat_mean, out.lng_mean));
+	}
+	out.sigma_north = sqrt(dn2 / n);
+	out.sigma_east = sqrt(de2 / n);
+}
+
+void EntryDispersion::Statistics(const std::vector<double> &val, EntryDispersionStatistics &stat)
+{
+	double sum, sum2;
+	unsigned i;
+
+	if (val.size() == 0) return;
+
+	sum = sum2 = 0.0;
+	stat.max = val[0];
+	for (i = 0;i < val.size();i++)
+	{
+		sum += val[i];
+		sum2 += val[i] * val[i];
+		stat.max = max(stat.max, val[i]);
+	}
+	stat.mean = sum / val.size();
+	stat.sigma = sqrt(max(0.0, sum2 / val.size() - stat.mean*stat.mean));
+}
+
+double EntryDispersion::Distance(double lat1, double lng1, double lat2, double lng2)
+{
+	double cosang;
+
+	cosang = dotp(OrbMech::r_from_latlong(lat1, lng1), OrbMech::r_from_latlong(lat2, lng2));
+	if (cosang > 1.0) cosang = 1.0;
+	else if (cosang < -1.0) cosang = -1.0;
+	return acos(cosang)*OrbMech::R_Earth;
+}
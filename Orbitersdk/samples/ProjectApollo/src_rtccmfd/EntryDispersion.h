@@ -0,0 +1,44 @@
+/****************************************************************************
+This file is part of Project Apollo - NASSP
+
+RTCC Reentry Dispersion Analysis (Header)
+
+Project Apollo is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+Project Apollo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Project Apollo; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+See http://nassp.sourceforge.net/license/ for more details.
+
+**************************************************************************/
+
+#pragma once
+
+#include "Orbitersdk.h"
+#include "RTCCModule.h"
+#include "RTCCTables.h"
+
+//Flies a nominal entry many times with dispersed atmosphere density, lift, entry flight-path angle, target and mode. All
+//cases are drawn from the seed before they are flown by the reentry numerical integrator on worker threads, so the
+//results don't depend on the number of threads.
+class EntryDispersion : public RTCCModule
+{
+public:
+	EntryDispersion(RTCC *r);
+	void Main(const EntryDispersionInputTable &in, EntryDispersionOutputTable &out);
+protected:
+	void DrawCases(const EntryDispersionInputTable &in, EntryDispersionOutputTable &out);
+	void FlyCase(const EntryDispersionInputTable &in, EntryDispersionCase &c);
+	void Footprint(EntryDispersionOutputTable &out);
+	void Statistics(const std::vector<double> &val, EntryDispersionStatistics &stat);
+	double Distance(double lat1, double lng1, double lat2, double lng2);
+};
@@ -0,0 +1,277 @@
+/****************************************************************************
+This file is part of Project Apollo - NASSP
+
+Fixed Capacity Matrix and Vector Types (Header)
+
+Project Apollo is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+Project Apollo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Project Apollo; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+See http://nassp.sourceforge.net/license/ for more details.
+
+**************************************************************************/
+
+#pragma once
+
+#include <cmath>
+
+//Vector with a compile time capacity and a run time size. Storage is contiguous and never allocated on the heap
+template <int NMAX> struct FixedVector
+{
+	FixedVector() : n(0) {}
+	explicit FixedVector(int size) { Resize(size); }
+	void Resize(int size) { n = size; }
+	void Zero() { for (int i = 0;i < n;i++) data[i] = 0.0; }
+	int Size() const { return n; }
+	double &operator[](int i) { return data[i]; }
+	const double &operator[](int i) const { return data[i]; }
+
+	double data[NMAX];
+	int n;
+};
+
+//Row-major matrix with a compile time capacity and a run time size. Rows are padded to the capacity, so the column loops
+//in the routines below run over contiguous memory.
+template <int RMAX, int CMAX> struct FixedMatrix
+{
+	FixedMatrix() : rows(0), cols(0) {}
+	FixedMatrix(int r, int c) { Resize(r, c); }
+	void Resize(int r, int c) { rows = r; cols = c; }
+	void Zero() { for (int i = 0;i < rows;i++) for (int j = 0;j < cols;j++) data[i][j] = 0.0; }
+	double &operator()(int i, int j) { return data[i][j]; }
+	const double &operator()(int i, int j) const { return data[i][j]; }
+	double *Row(int i) { return data[i]; }
+	const double *Row(int i) const { return data[i]; }
+
+	double data[RMAX][CMAX];
+	int rows, cols;
+};
+
+namespace FixedLinAlg
+{
+	//C = A^T * diag(w) * A, A is NxM, C is MxM
+	template <int RMAX, int CMAX, int NMAX, int MMAX> void WeightedNormalMatrix(const FixedMatrix<RMAX, CMAX> &A, const FixedVector<NMAX> &w, FixedMatrix<MMAX, MMAX> &C)
+	{
+		int i, j, k;
+		double wk;
+
+		C.Resize(A.cols, A.cols);
+		C.Zero();
+		for (k = 0;k < A.rows;k++)
+		{
+			wk = w[k];
+			const double *a = A.Row(k);
+			for (i = 0;i < A.cols;i++)
+			{
+				double wa = wk * a[i];
+				double *c = C.Row(i);
+				//Only the lower triangle, the matrix is symmetric
+				for (j = 0;j <= i;j++)
+				{
+					c[j] += wa * a[j];
+				}
+			}
+		}
+		for (i = 0;i < A.cols;i++)
+		{
+			for (j = i + 1;j < A.cols;j++)
+			{
+				C(i, j) = C(j, i);
+			}
+		}
+	}
+
+	//c = A^T * b, A is NxM
+	template <int RMAX, int CMAX, int NMAX, int MMAX> void TransposeMultiply(const FixedMatrix<RMAX, CMAX> &A, const FixedVector<NMAX> &b, FixedVector<MMAX> &c)
+	{
+		int i, k;
+
+		c.Resize(A.cols);
+		c.Zero();
+		for (k = 0;k < A.rows;k++)
+		{
+			const double *a = A.Row(k);
+			for (i = 0;i < A.cols;i++)
+			{
+				c[i] += a[i] * b[k];
+			}
+		}
+	}
+
+	//In place Cholesky decomposition A = L*L^T of a symmetric positive definite matrix, lower triangle holds L. Returns false if A is not positive definite
+	template <int NMAX> bool CholeskyDecompose(FixedMatrix<NMAX, NMAX> &A)
+	{
+		int i, j, k;
+		double sum;
+
+		for (j = 0;j < A.rows;j++)
+		{
+			double *aj = A.Row(j);
+			sum = aj[j];
+			for (k = 0;k < j;k++)
+			{
+				sum -= aj[k] * aj[k];
+			}
+			if (sum <= 0.0)
+			{
+				return false;
+			}
+			aj[j] = sqrt(sum);
+			for (i = j + 1;i < A.rows;i++)
+			{
+				double *ai = A.Row(i);
+				sum = ai[j];
+				for (k = 0;k < j;k++)
+				{
+					sum -= ai[k] * aj[k];
+				}
+				ai[j] = sum / aj[j];
+			}
+		}
+		return true;
+	}
+
+	//Solves L*L^T*x = b with the output of CholeskyDecompose
+	template <int NMAX, int VMAX> void CholeskySolve(const FixedMatrix<NMAX, NMAX> &L, const FixedVector<VMAX> &b, FixedVector<VMAX> &x)
+	{
+		int i, k, n = L.rows;
+
+		x.Resize(n);
+		for (i = 0;i < n;i++)
+		{
+			const double *li = L.Row(i);
+			x[i] = b[i];
+			for (k = 0;k < i;k++)
+			{
+				x[i] -= li[k] * x[k];
+			}
+			x[i] /= li[i];
+		}
+		for (i = n - 1;i >= 0;i--)
+		{
+			for (k = i + 1;k < n;k++)
+			{
+				x[i] -= L(k, i) * x[k];
+			}
+			x[i] /= L(i, i);
+		}
+	}
+
+	//In place LU decomposition with partial pivoting. Returns false if the matrix is singular
+	template <int NMAX> bool LUDecompose(FixedMatrix<NMAX, NMAX> &A, int *P)
+	{
+		int i, j, k, imax, n = A.rows;
+		double maxA, absA, tmp;
+
+		for (i = 0;i < n;i++)
+		{
+			P[i] = i;
+		}
+		for (i = 0;i < n;i++)
+		{
+			maxA = 0.0;
+			imax = i;
+			for (k = i;k < n;k++)
+			{
+				if ((absA = fabs(A(k, i))) > maxA)
+				{
+					maxA = absA;
+					imax = k;
+				}
+			}
+			if (maxA == 0.0)
+			{
+				return false;
+			}
+			if (imax != i)
+			{
+				j = P[i]; P[i] = P[imax]; P[imax] = j;
+				for (k = 0;k < n;k++)
+				{
+					tmp = A(i, k); A(i, k) = A(imax, k); A(imax, k) = tmp;
+				}
+			}
+			const double *ai = A.Row(i);
+			for (j = i + 1;j < n;j++)
+			{
+				double *aj = A.Row(j);
+				aj[i] /= ai[i];
+				for (k = i + 1;k < n;k++)
+				{
+					aj[k] -= aj[i] * ai[k];
+				}
+			}
+		}
+		return true;
+	}
+
+	//Solves A*x = b with the output of LUDecompose
+	template <int NMAX, int VMAX> void LUSolve(const FixedMatrix<NMAX, NMAX> &A, const int *P, const FixedVector<VMAX> &b, FixedVector<VMAX> &x)
+	{
+		int i, k, n = A.rows;
+
+		x.Resize(n);
+		for (i = 0;i < n;i++)
+		{
+			const double *ai = A.Row(i);
+			x[i] = b[P[i]];
+			for (k = 0;k < i;k++)
+			{
+				x[i] -= ai[k] * x[k];
+			}
+		}
+		for (i = n - 1;i >= 0;i--)
+		{
+			const double *ai = A.Row(i);
+			for (k = i + 1;k < n;k++)
+			{
+				x[i] -= ai[k] * x[k];
+			}
+			x[i] /= ai[i];
+		}
+	}
+
+	//Solves the symmetric system A*x = b, Cholesky first and LU if A isn't positive definite. A is overwritten. Returns false if A is singular
+	template <int NMAX, int VMAX> bool SolveSymmetric(FixedMatrix<NMAX, NMAX> &A, const FixedVector<VMAX> &b, FixedVector<VMAX> &x)
+	{
+		static_assert(VMAX >= NMAX, "Vector capacity too small");
+
+		FixedVector<NMAX> diag(A.rows);
+		int i, j, P[NMAX];
+
+		for (i = 0;i < A.rows;i++)
+		{
+			diag[i] = A(i, i);
+		}
+		if (CholeskyDecompose(A))
+		{
+			CholeskySolve(A, b, x);
+			return true;
+		}
+		//Cholesky only wrote the lower triangle, restore it from the upper triangle
+		for (i = 0;i < A.rows;i++)
+		{
+			A(i, i) = diag[i];
+			for (j = 0;j < i;j++)
+			{
+				A(i, j) = A(j, i);
+			}
+		}
+		if (LUDecompose(A, P) == false)
+		{
+			return false;
+		}
+		LUSolve(A, P, b, x);
+		return true;
+	}
+}
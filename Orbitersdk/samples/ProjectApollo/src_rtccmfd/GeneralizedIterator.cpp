@@ -42,152 +42,53 @@ namespace GenIterator
 		}
 	}
 
-	void tmat_mul_mat(double **A, double **B, int m, int n, int p, double **C)
+	void MatrixMultiply(GeneralizedIteratorWorkspace &ws, const std::vector<double> &W_Y, const std::vector<double> &dy)
 	{
-		//A is NxM
-		//B is NxP
-		//C is MxP
+		//P is NxM
+		//W_Y, dy, b are N
+		//c is M
+		//C is MxM
 
-		int i, j, k;
+		int i, n = ws.P.rows;
 
-		for (i = 0;i < m;i++)
+		ws.b.Resize(n);
+		ws.w.Resize(n);
+		for (i = 0;i < n;i++)
 		{
-			for (j = 0;j < p;j++)
-			{
-				C[i][j] = 0.0;
-				for (k = 0;k < n;k++)
-				{
-					C[i][j] += A[k][i] * B[k][j];
-				}
-			}
+			ws.w[i] = W_Y[i];
+			ws.b[i] = W_Y[i] * dy[i];
 		}
+		FixedLinAlg::TransposeMultiply(ws.P, ws.b, ws.c);
+		FixedLinAlg::WeightedNormalMatrix(ws.P, ws.w, ws.C);
 	}
 
-	void diag_mul_mat(const std::vector<double> &a, double **B, int m, int n, double **C)
+	void ComputeCoefficients(GeneralizedIteratorWorkspace &ws, const std::vector<double> &W_X, double lambda)
 	{
-		//a is M
-		//B is MxN
-		//C is MxN
-
-		int i, j;
+		//D = C + lambda*diag(W_X), MxM
+		int i, j, m = ws.C.rows;
 
+		ws.D.Resize(m, m);
 		for (i = 0;i < m;i++)
 		{
-			for (j = 0;j < n;j++)
-			{
-				C[i][j] = a[i] * B[i][j];
-			}
-		}
-	}
-
-	void vec_mul_vec(const std::vector<double> &a, const std::vector<double> &b, double *c)
-	{
-		for (unsigned i = 0;i < a.size();i++)
-		{
-			c[i] = a[i] * b[i];
-		}
-	}
-
-	void vec_mul_skal(const std::vector<double> &a, double b, double *c)
-	{
-		for (unsigned i = 0;i < a.size();i++)
-		{
-			c[i] = a[i] * b;
-		}
-	}
-
-	void mat_mul_vec(double **A, double *b, int m, int n, double *c)
-	{
-		for (int i = 0;i < m;i++)
-		{
-			c[i] = 0.0;
-			for (int j = 0;j < n;j++)
-			{
-				c[i] += A[i][j] * b[j];
-			}
-		}
-	}
-
-	void tmat_mul_vec(double **A, double *b, int m, int n, double *c)
-	{
-		for (int i = 0;i < m;i++)
-		{
-			c[i] = 0.0;
-			for (int j = 0;j < n;j++)
-			{
-				c[i] += A[j][i] * b[j];
-			}
-		}
-	}
-
-	void mat_plus_vec(double **A, double *b, int n, double **C)
-	{
-		int i, j;
-
-		for (i = 0;i < n;i++)
-		{
-			for (j = 0;j < n;j++)
+			for (j = 0;j < m;j++)
 			{
-				C[i][j] = A[i][j];
-				if (i == j)
-				{
-					C[i][j] += b[i];
-				}
+				ws.D(i, j) = ws.C(i, j);
 			}
+			ws.D(i, i) += lambda * W_X[i];
 		}
 	}
 
-	void MatrixMultiply(double **P, const std::vector<double> &W_X, const std::vector<double> &W_Y, const std::vector<double> &dy, int m, int n, double **C, double *c)
+	bool SolveEquations(GeneralizedIteratorWorkspace &ws, std::vector<double> &dx)
 	{
-		//W_X is M
-		//W_Y is N
-		//P is NxM
-		//dy, b are N
-		//c is M
-		//B is NxM
-		//C is MxM
-
-		double *b = new double[n];
-		double **B = new double*[n];
-		int i;
-
-		for (i = 0;i < n;i++)
+		//D is symmetric and normally positive definite
+		if (FixedLinAlg::SolveSymmetric(ws.D, ws.c, ws.dx) == false)
 		{
-			B[i] = new double[m];
+			return true;
 		}
-
-		vec_mul_vec(W_Y, dy, b);
-		tmat_mul_vec(P, b, m, n, c);
-		diag_mul_mat(W_Y, P, n, m, B);
-		tmat_mul_mat(P, B, m, n, m, C);
-
-		delete[] b;
-		delete[] B;
-	}
-
-	void ComputeCoefficients(double **CARR, const std::vector<double> &W_X, double lambda, int m, int n, double **D)
-	{
-		//A is M
-		//C is MxM
-		//D is MxM
-		double *A = new double[m];
-
-		vec_mul_skal(W_X, lambda, A);
-		mat_plus_vec(CARR, A, m, D);
-
-		delete[] A;
-	}
-
-	bool SolveEquations(double **D, double *c, int m, std::vector<double> &dx)
-	{
-		int *PP = new int[m + 1];
-
-		if (OrbMech::LUPDecompose(D, m, 0.0, PP) == 0)
+		for (int i = 0;i < ws.dx.Size();i++)
 		{
-			return true;
+			dx[i] = ws.dx[i];
 		}
-		OrbMech::LUPSolve(D, PP, c, m, dx);
-		delete[] PP;
 		return false;
 	}
 
@@ -218,11 +119,11 @@ namespace GenIterator
 
 	bool GeneralizedIterator(bool(*state_evaluation)(void*, std::vector<double>&, void*, std::vector<double>&, bool), GeneralizedIteratorBlock vars, void *constants, void *data, std::vector<double> &x_res, std::vector<double> &y_res)
 	{
-		double lambda, R, R_old, w_avg, **P, **CARR, *CVEC, **DARR;
+		double lambda, R, R_old, w_avg;
 		bool select = true, hasclass3, errind;
 		int n, nMax, class1num, j_optm;
 		unsigned N, M, i, j;
-		std::vector<double> Target, var_star, v_l, *Y, var_star_temp, var_star_cur, Y_star, C, dx, dy, dy_temp, W_Y, W_Y_apo, W_X, step, LowerLimit, UpperLimit, trajin, trajout, depweight, borderinterval;
+		std::vector<double> Target, var_star, v_l, Y, var_star_temp, var_star_cur, Y_star, C, dx, dy, dy_temp, W_Y, W_Y_apo, W_X, step, LowerLimit, UpperLimit, trajin, trajout, depweight, borderinterval;
 		std::vector<double> Y_star_best;
 		std::vector<int> xmap, ymap, yclass, KPULL;
 
@@ -271,9 +172,6 @@ namespace GenIterator
 			}
 		}
 
-		//Set up a vector
-		Y = new std::vector<double>[M];
-
 		var_star.assign(M, 0);
 		var_star_cur.assign(M, 0);
 		dx.assign(M, 0);
@@ -290,34 +188,15 @@ namespace GenIterator
 		KPULL.assign(N, 0);
 		j_optm = -1;
 
-		for (i = 0;i < M;i++)
-		{
-			Y[i].assign(N, 0);
-		}
+		Y.assign(N, 0);
 
-		P = new double*[N];
-		CARR = new double *[M];
-		DARR = new double *[M];
-		CVEC = new double[M];
-		for (i = 0;i < M;i++)
-		{
-			CVEC[i] = 0.0;
-			CARR[i] = new double[M];
-			DARR[i] = new double[M];
-			for (j = 0;j < M;j++)
-			{
-				CARR[i][j] = 0.0;
-				DARR[i][j] = 0.0;
-			}
-		}
-		for (i = 0;i < N;i++)
-		{
-			P[i] = new double[M];
-			for (j = 0;j < M;j++)
-			{
-				P[i][j] = 0.0;
-			}
-		}
+		GeneralizedIteratorWorkspace ws;
+		ws.P.Resize(N, M);
+		ws.P.Zero();
+		ws.C.Resize(M, M);
+		ws.C.Zero();
+		ws.c.Resize(M);
+		ws.c.Zero();
 
 		//Set up iteration counters
 		nMax = 100;
@@ -517,7 +396,7 @@ namespace GenIterator
 
 			OpenRanks(xmap, v_l, trajin, M);
 			errind = state_evaluation(data, trajin, constants, trajout, select);
-			CloseRanks(ymap, trajout, Y[j], NGENITER);
+			CloseRanks(ymap, trajout, Y, NGENITER);
 
 			if (errind)
 			{
@@ -527,13 +406,13 @@ namespace GenIterator
 			//Calculate matrix valuess
 			for (i = 0;i < N;i++)
 			{
-				P[i][j] = (Y[j][i] - Y_star[i]) / step[j];
+				ws.P(i, j) = (Y[i] - Y_star[i]) / step[j];
 			}
 		}
-		MatrixMultiply(P, W_X, W_Y_apo, dy, M, N, CARR, CVEC);
+		MatrixMultiply(ws, W_Y_apo, dy);
 	NewGeneralizedIterator_D:
-		ComputeCoefficients(CARR, W_X, lambda, M, N, DARR);
-		if (SolveEquations(DARR, CVEC, M, dx) == false)
+		ComputeCoefficients(ws, W_X, lambda);
+		if (SolveEquations(ws, dx) == false)
 		{
 			goto NewGeneralizedIterator_G;
 		}
@@ -781,11 +660,6 @@ namespace GenIterator
 		goto NewGeneralizedIterator_EE;
 
 	NewGeneralizedIterator_END:
-		delete[] Y;
-		delete[] P;
-		delete[] CARR;
-		delete[] CVEC;
-
 		x_res = var_star;
 		y_res = Y_star_best;
 
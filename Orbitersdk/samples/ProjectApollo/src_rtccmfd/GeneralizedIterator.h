@@ -24,6 +24,7 @@ See http://nassp.sourceforge.net/license/ for more details.
 #pragma once
 
 #include <vector>
+#include "FixedMatrix.h"
 
 namespace GenIterator
 {
@@ -46,10 +47,29 @@ namespace GenIterator
 		double DepVarWeight[30];
 	};
 
+	//Storage for the linear algebra of one iterator run, nothing is allocated inside the iteration loop
+	struct GeneralizedIteratorWorkspace
+	{
+		//Partial derivatives of the dependent variables, NxM
+		FixedMatrix<NGENITER, MGENITER> P;
+		//Weighted normal matrix, MxM
+		FixedMatrix<MGENITER, MGENITER> C;
+		//Coefficient matrix of the linear system, MxM
+		FixedMatrix<MGENITER, MGENITER> D;
+		//Right hand side, M
+		FixedVector<MGENITER> c;
+		//Solution, M
+		FixedVector<MGENITER> dx;
+		//Weighted residuals, N
+		FixedVector<NGENITER> b;
+		//Dependent variable weights, N
+		FixedVector<NGENITER> w;
+	};
+
 	void OpenRanks(std::vector<int> &xmap, std::vector<double> &in, std::vector<double> &out, int m);
 	void CloseRanks(std::vector<int> &ymap, std::vector<double> &in, std::vector<double> &out, int n2);
 	bool GeneralizedIterator(bool(*state_evaluation)(void *, std::vector<double>&, void*, std::vector<double>&, bool), GeneralizedIteratorBlock vars, void *constants, void *data, std::vector<double> &x_res, std::vector<double> &y_res);
-	void MatrixMultiply(double **P, const std::vector<double> &W_X, const std::vector<double> &W_Y, const std::vector<double> &dy, int m, int n, double **C, double *c);
-	void ComputeCoefficients(double **CARR, const std::vector<double> &W_X, double lambda, int m, int n, double **D);
-	bool SolveEquations(double **D, double *c, int m, std::vector<double> &dx);
+	void MatrixMultiply(GeneralizedIteratorWorkspace &ws, const std::vector<double> &W_Y, const std::vector<double> &dy);
+	void ComputeCoefficients(GeneralizedIteratorWorkspace &ws, const std::vector<double> &W_X, double lambda);
+	bool SolveEquations(GeneralizedIteratorWorkspace &ws, std::vector<double> &dx);
 }
@@ -25,6 +25,7 @@ See http://nassp.sourceforge.net/license/ for more details.
 #include "Orbitersdk.h"
 #include "OrbMech.h"
 #include "LMGuidanceSim.h"
+#include "WorkerPool.h"
 
 const double AscentGuidance::F_APS = 15297.43;
 const double AscentGuidance::F_DPS = 43203.3275;
@@ -478,4 +479,376 @@ VECTOR3 AscDescIntegrator::gravity(VECTOR3 R)
 	g = -U_R * mu_M / rr;
 
 	return g;
-}
\ No newline at end of file
+}
+
+LMPoweredFlightOptions::LMPoweredFlightOptions()
+{
+	Harmonics = true;
+	//Of the order of the DPS and APS responses
+	TauThrottle = 0.2;
+	ThrottleRate = 40000.0;
+	TauBuildup = 0.3;
+	F_max = 0.0;
+	MaxRate = 10.0*RAD;
+	TolR = 0.1;
+	TolV = 1e-4;
+}
+
+//Number of integrated variables: R, V, mass, thrust, DV
+#define LMPF_N 9
+
+const double AscDescVariableIntegrator::mu_M = GGRAV * 7.34763862e+22;
+const double AscDescVariableIntegrator::dt_cycle = 2.0;
+const double AscDescVariableIntegrator::dt_min = 1e-4;
+const double AscDescVariableIntegrator::TolM = 1e-4;
+const double AscDescVariableIntegrator::TolF = 1.0;
+
+AscDescVariableIntegrator::AscDescVariableIntegrator()
+{
+	U_TD_cur = U_Z = U_slew0 = K_slew = _V(0, 0, 0);
+	F_cmd = Isp_cmd = slew = 0.0;
+	Buildup = false;
+	F_act = DV = 0.0;
+	h_next = dt_cycle;
+	Steps = Rejected = 0;
+}
+
+void AscDescVariableIntegrator::Init(VECTOR3 U_TD_init, VECTOR3 U_Pole, const LMPoweredFlightOptions &o)
+{
+	U_TD_cur = U_TD_init;
+	U_Z = unit(U_Pole);
+	opt = o;
+	F_act = DV = 0.0;
+	Buildup = false;
+	h_next = dt_cycle;
+	Steps = Rejected = 0;
+}
+
+VECTOR3 AscDescVariableIntegrator::gravity(VECTOR3 R) const
+{
+	VECTOR3 U_R, a_dP;
+	double r, costheta, P2, P3, P4;
+
+	r = length(R);
+	U_R = R / r;
+	if (opt.Harmonics == false)
+	{
+		return -U_R * mu_M / (r*r);
+	}
+
+	//Zonal harmonics like the coast integrators
+	costheta = dotp(U_R, U_Z);
+	P2 = 3.0 * costheta;
+	P3 = 0.5*(15.0*costheta*costheta - 3.0);
+	P4 = 1.0 / 3.0*(7.0*costheta*P3 - 4.0*P2);
+	a_dP = (U_R*P3 - U_Z * P2)*OrbMech::J2_Moon * pow(OrbMech::R_Moon / r, 2);
+	a_dP += (U_R*P4 - U_Z * P3)*OrbMech::J3_Moon * pow(OrbMech::R_Moon / r, 3);
+
+	return (a_dP - U_R)*mu_M / (r*r);
+}
+
+VECTOR3 AscDescVariableIntegrator::Attitude(double tau) const
+{
+	double ang;
+
+	if (slew <= 0.0)
+	{
+		return U_slew0;
+	}
+	ang = min(opt.MaxRate*tau, slew);
+	return U_slew0 * cos(ang) + crossp(K_slew, U_slew0)*sin(ang);
+}
+
+void AscDescVariableIntegrator::Derivatives(double tau, const double *y, double *dy) const
+{
+	VECTOR3 R, V, U, G;
+	double m, F, Fdot;
+
+	R = _V(y[0], y[1], y[2]);
+	V = _V(y[3], y[4], y[5]);
+	m = y[6];
+	F = y[7];
+
+	U = Attitude(tau);
+	G = gravity(R) + U * F / m;
+
+	if (Buildup)
+	{
+		Fdot = opt.TauBuildup > 0.0 ? (F_cmd - F) / opt.TauBuildup : 0.0;
+	}
+	else
+	{
+		Fdot = opt.TauThrottle > 0.0 ? (F_cmd - F) / opt.TauThrottle : 0.0;
+		if (opt.ThrottleRate > 0.0)
+		{
+			if (Fdot > opt.ThrottleRate) Fdot = opt.ThrottleRate;
+			else if (Fdot < -opt.ThrottleRate) Fdot = -opt.ThrottleRate;
+		}
+	}
+
+	dy[0] = V.x;
+	dy[1] = V.y;
+	dy[2] = V.z;
+	dy[3] = G.x;
+	dy[4] = G.y;
+	dy[5] = G.z;
+	dy[6] = Isp_cmd > 0.0 ? -F / Isp_cmd : 0.0;
+	dy[7] = Fdot;
+	dy[8] = F / m;
+}
+
+double AscDescVariableIntegrator::Step(double tau, double h, const double *y, double *ynew) const
+{
+	//Dormand-Prince 5(4)
+	static const double c[7] = { 0.0, 1.0 / 5.0, 3.0 / 10.0, 4.0 / 5.0, 8.0 / 9.0, 1.0, 1.0 };
+	static const double a[7][6] = {
+		{ 0.0 },
+		{ 1.0 / 5.0 },
+		{ 3.0 / 40.0, 9.0 / 40.0 },
+		{ 44.0 / 45.0, -56.0 / 15.0, 32.0 / 9.0 },
+		{ 19372.0 / 6561.0, -25360.0 / 2187.0, 64448.0 / 6561.0, -212.0 / 729.0 },
+		{ 9017.0 / 3168.0, -355.0 / 33.0, 46732.0 / 5247.0, 49.0 / 176.0, -5103.0 / 18656.0 },
+		{ 35.0 / 384.0, 0.0, 500.0 / 1113.0, 125.0 / 192.0, -2187.0 / 6784.0, 11.0 / 84.0 } };
+	//Difference of the 5th and 4th order weights
+	static const double e[7] = { 71.0 / 57600.0, 0.0, -71.0 / 16695.0, 71.0 / 1920.0, -17253.0 / 339200.0, 22.0 / 525.0, -1.0 / 40.0 };
+	double k[7][LMPF_N], yt[LMPF_N], err[LMPF_N], tol, E;
+	int i, j, l;
+
+	for (i = 0;i < 7;i++)
+	{
+		for (l = 0;l < LMPF_N;l++)
+		{
+			yt[l] = y[l];
+			for (j = 0;j < i;j++)
+			{
+				yt[l] += h * a[i][j] * k[j][l];
+			}
+		}
+		Derivatives(tau + c[i] * h, yt, k[i]);
+	}
+	//The last stage is the new state
+	for (l = 0;l < LMPF_N;l++)
+	{
+		ynew[l] = yt[l];
+		err[l] = 0.0;
+		for (i = 0;i < 7;i++)
+		{
+			err[l] += h * e[i] * k[i][l];
+		}
+	}
+
+	E = 0.0;
+	for (l = 0;l < 8;l++)
+	{
+		if (l < 3) tol = opt.TolR;
+		else if (l < 6) tol = opt.TolV;
+		else if (l == 6) tol = TolM;
+		else tol = TolF;
+		E = max(E, abs(err[l]) / tol);
+	}
+	return E;
+}
+
+bool AscDescVariableIntegrator::Integration(VECTOR3 &R, VECTOR3 &V, double &mnow, double &t_total, VECTOR3 U_TD, double t_remain, double Thrust, double Isp)
+{
+	double y[LMPF_N], ynew[LMPF_N], T, tau, h, E;
+	VECTOR3 K;
+	int l;
+	bool last;
+
+	if (t_remain <= 0.0)
+	{
+		return true;
+	}
+	T = min(dt_cycle, t_remain);
+
+	//Commands of this cycle
+	F_cmd = Thrust;
+	if (opt.F_max > 0.0 && F_cmd > opt.F_max)
+	{
+		F_cmd = opt.F_max;
+	}
+	Isp_cmd = Isp;
+	if (F_cmd > 0.0 && F_act <= 0.0)
+	{
+		Buildup = true;
+	}
+	if ((Buildup && opt.TauBuildup <= 0.0) || (!Buildup && opt.TauThrottle <= 0.0 && opt.ThrottleRate <= 0.0))
+	{
+		F_act = F_cmd;
+	}
+
+	U_slew0 = U_TD_cur;
+	slew = acos2(dotp(unit(U_TD), U_TD_cur));
+	K = crossp(U_TD_cur, U_TD);
+	if (length(K) < 1e-12)
+	{
+		//No rotation, or no unique one
+		U_slew0 = U_TD_cur = unit(U_TD);
+		slew = 0.0;
+	}
+	else
+	{
+		K_slew = unit(K);
+	}
+
+	y[0] = R.x;
+	y[1] = R.y;
+	y[2] = R.z;
+	y[3] = V.x;
+	y[4] = V.y;
+	y[5] = V.z;
+	y[6] = mnow;
+	y[7] = F_act;
+	y[8] = 0.0;
+
+	tau = 0.0;
+	h = h_next;
+	while (tau < T)
+	{
+		//Last step of the cycle
+		last = tau + h > T - dt_min;
+		if (last)
+		{
+			h = T - tau;
+		}
+		E = Step(tau, h, y, ynew);
+		if (E <= 1.0 || h <= dt_min)
+		{
+			tau += h;
+			for (l = 0;l < LMPF_N;l++)
+			{
+				y[l] = ynew[l];
+			}
+			Steps++;
+		}
+		else
+		{
+			Rejected++;
+			last = false;
+		}
+		h = h * max(0.2, min(5.0, E > 0.0 ? 0.9*pow(E, -0.2) : 5.0));
+		if (h < dt_min) h = dt_min;
+		//A last step cut short at the end of the cycle says little about the step size for the next one
+		if (!last)
+		{
+			h_next = h;
+		}
+	}
+
+	R = _V(y[0], y[1], y[2]);
+	V = _V(y[3], y[4], y[5]);
+	mnow = y[6];
+	F_act = y[7];
+	DV += y[8];
+	U_TD_cur = Attitude(T);
+	t_total += T;
+
+	if (Buildup && F_act >= 0.9*F_cmd)
+	{
+		Buildup = false;
+	}
+
+	return t_remain <= dt_cycle;
+}
+
+const int LMPoweredFlightSim::MaxCycles = 3000;
+
+LMPoweredFlightResult::LMPoweredFlightResult()
+{
+	Err = true;
+	t_IG = t_CO = 0.0;
+	R = V = _V(0, 0, 0);
+	m = DV = 0.0;
+	Cycles = Steps = Rejected = 0;
+}
+
+LMPoweredFlightSim::LMPoweredFlightSim(const LMPoweredFlightOptions &o) : opt(o)
+{
+}
+
+bool LMPoweredFlightSim::Descent(const LMDescentCase &c, LGCDescentConstants *consts, LMPoweredFlightResult &res) const
+{
+	DescentGuidance descguid;
+	AscDescVariableIntegrator integ;
+	VECTOR3 U_FDP;
+	double t_go, Thrust, isp;
+	bool stop = false;
+
+	res = LMPoweredFlightResult();
+	res.t_IG = c.t_IG;
+	res.R = c.R;
+	res.V = c.V;
+	res.m = c.m;
+	res.t_CO = c.t0;
+	t_go = c.t_go;
+
+	descguid.Init(c.R, c.V, c.m, c.t_IG, c.REFSMMAT, c.R_LSP, c.t_IG, c.W, c.t_go, consts);
+	integ.Init(c.U_FDP, c.U_Pole, opt);
+
+	while (stop == false && res.Cycles < MaxCycles)
+	{
+		descguid.Guidance(res.R, res.V, res.m, res.t_CO, U_FDP, t_go, Thrust, isp);
+		stop = integ.Integration(res.R, res.V, res.m, res.t_CO, U_FDP, t_go, Thrust, isp);
+		res.Cycles++;
+	}
+
+	res.DV = integ.GetDV();
+	res.Steps = integ.GetSteps();
+	res.Rejected = integ.GetRejectedSteps();
+	res.Err = !stop || !(length(res.R) > 0.0) || !(res.m > 0.0);
+	return res.Err;
+}
+
+bool LMPoweredFlightSim::Ascent(const LMAscentCase &c, LMPoweredFlightResult &res) const
+{
+	AscentGuidance asc;
+	AscDescVariableIntegrator integ;
+	VECTOR3 U_FDP;
+	double t_go, Thrust, isp;
+	bool stop = false;
+
+	res = LMPoweredFlightResult();
+	res.t_IG = c.t0;
+	res.R = c.R;
+	res.V = c.V;
+	res.m = c.m;
+	res.t_CO = c.t0;
+
+	asc.Init(c.R_C, c.V_C, c.m, c.r_LS, c.v_LH, c.v_LV);
+	integ.Init(unit(c.R), c.U_Pole, opt);
+
+	while (stop == false && res.Cycles < MaxCycles)
+	{
+		asc.Guidance(res.R, res.V, res.m, res.t_CO, U_FDP, t_go, Thrust, isp);
+		stop = integ.Integration(res.R, res.V, res.m, res.t_CO, U_FDP, t_go, Thrust, isp);
+		res.Cycles++;
+	}
+
+	res.DV = integ.GetDV();
+	res.Steps = integ.GetSteps();
+	res.Rejected = integ.GetRejectedSteps();
+	res.Err = !stop || !(length(res.R) > 0.0) || !(res.m > 0.0);
+	return res.Err;
+}
+
+void LMPoweredFlightSim::DescentTable(const std::vector<LMDescentCase> &cases, LGCDescentConstants *consts, std::vector<LMPoweredFlightResult> &res, unsigned maxthreads) const
+{
+	res.assign(cases.size(), LMPoweredFlightResult());
+
+	//Each flight has its own guidance and integrator, the descent targets are only read
+	WorkerPool::ParallelFor((int)cases.size(), [&](int i)
+	{
+		Descent(cases[i], consts, res[i]);
+	}, maxthreads);
+}
+
+void LMPoweredFlightSim::AscentTable(const std::vector<LMAscentCase> &cases, std::vector<LMPoweredFlightResult> &res, unsigned maxthreads) const
+{
+	res.assign(cases.size(), LMPoweredFlightResult());
+
+	WorkerPool::ParallelFor((int)cases.size(), [&](int i)
+	{
+		Ascent(cases[i], res[i]);
+	}, maxthreads);
+}
@@ -24,6 +24,8 @@ See http://nassp.sourceforge.net/license/ for more details.
 
 #pragma once
 
+#include <vector>
+
 class AscentGuidance
 {
 public:
@@ -180,4 +182,134 @@ protected:
 	VECTOR3 G_P, G_PDT;
 	//Current thrust direction
 	VECTOR3 U_TD_cur;
-};
\ No newline at end of file
+};
+
+//Models of the variable step powered flight simulation
+struct LMPoweredFlightOptions
+{
+	LMPoweredFlightOptions();
+
+	//Lunar J2 and J3 (true) or point mass gravity (false)
+	bool Harmonics;
+	//Time constant of the thrust following a throttle command, s. 0 = immediate
+	double TauThrottle;
+	//Largest rate of change of the thrust, N/s. 0 = unlimited
+	double ThrottleRate;
+	//Time constant of the thrust buildup after ignition, s. 0 = immediate
+	double TauBuildup;
+	//Thrust commands are limited to this, N. 0 = no limit
+	double F_max;
+	//Maximum attitude rate, rad/s
+	double MaxRate;
+	//Error allowed per integration step in position (m) and velocity (m/s)
+	double TolR, TolV;
+};
+
+//Integrates the LM powered flight over one guidance cycle per call, like AscDescIntegrator, but with a Dormand-Prince 5(4)
+//step with error control inside of the cycle. Thrust, mass and DV are integrated with the trajectory, so thrust transients
+//change the mass flow as well. The attitude moves to the commanded thrust direction at the maximum rate during the cycle.
+class AscDescVariableIntegrator
+{
+public:
+	AscDescVariableIntegrator();
+	//U_TD_init: thrust direction, U_Pole: lunar pole in the frame of the state vectors
+	void Init(VECTOR3 U_TD_init, VECTOR3 U_Pole, const LMPoweredFlightOptions &opt);
+	//Same arguments as AscDescIntegrator::Integration. Returns true at the end of the last cycle
+	bool Integration(VECTOR3 &R, VECTOR3 &V, double &mnow, double &t_total, VECTOR3 U_TD, double t_remain, double Thrust, double Isp);
+	VECTOR3 GetCurrentTD() { return U_TD_cur; }
+	//Actual thrust, N
+	double GetThrust() const { return F_act; }
+	//Integrated thrust acceleration, m/s
+	double GetDV() const { return DV; }
+	int GetSteps() const { return Steps; }
+	int GetRejectedSteps() const { return Rejected; }
+private:
+	VECTOR3 gravity(VECTOR3 R) const;
+	//Thrust direction at time tau into the cycle
+	VECTOR3 Attitude(double tau) const;
+	//Derivatives of the state R, V, mass, thrust and DV
+	void Derivatives(double tau, const double *y, double *dy) const;
+	//One step from tau with length h. Returns the error relative to the tolerances
+	double Step(double tau, double h, const double *y, double *ynew) const;
+protected:
+	//Lunar gravitational constant
+	static const double mu_M;
+	//Guidance cycle
+	static const double dt_cycle;
+	//Smallest step, s
+	static const double dt_min;
+	//Error allowed in mass (kg) and thrust (N)
+	static const double TolM, TolF;
+
+	LMPoweredFlightOptions opt;
+	VECTOR3 U_TD_cur, U_Z;
+	//Thrust command, specific impulse and attitude slew of the current cycle
+	double F_cmd, Isp_cmd, slew;
+	VECTOR3 U_slew0, K_slew;
+	//Engine started and thrust not built up yet
+	bool Buildup;
+	double F_act, DV, h_next;
+	int Steps, Rejected;
+};
+
+//Start of a powered descent, like RTCC::PoweredDescentProcessor sets it up
+struct LMDescentCase
+{
+	//State and mass at the start of ullage
+	VECTOR3 R, V;
+	double m, t0;
+	//Time of ignition
+	double t_IG;
+	//Guidance inputs
+	MATRIX3 REFSMMAT;
+	VECTOR3 R_LSP, W, U_FDP;
+	double t_go;
+	//Lunar pole
+	VECTOR3 U_Pole;
+};
+
+//Start of a powered ascent, like RTCC::LunarAscentProcessor sets it up
+struct LMAscentCase
+{
+	//Launch site state and LM mass at liftoff
+	VECTOR3 R, V;
+	double m, t0;
+	//CSM state at liftoff
+	VECTOR3 R_C, V_C;
+	//Landing site radius and insertion velocities
+	double r_LS, v_LH, v_LV;
+	VECTOR3 U_Pole;
+};
+
+struct LMPoweredFlightResult
+{
+	LMPoweredFlightResult();
+
+	//No guidance solution, or no cutoff
+	bool Err;
+	//Ignition and cutoff time
+	double t_IG, t_CO;
+	//State and mass at cutoff
+	VECTOR3 R, V;
+	double m;
+	//Integrated thrust acceleration, m/s
+	double DV;
+	int Cycles, Steps, Rejected;
+};
+
+//Flies the LGC descent and ascent guidance with the variable step integrator. The tables fly many cases on the worker pool.
+class LMPoweredFlightSim
+{
+public:
+	LMPoweredFlightSim(const LMPoweredFlightOptions &o);
+	//Returns true on error
+	bool Descent(const LMDescentCase &c, LGCDescentConstants *consts, LMPoweredFlightResult &res) const;
+	bool Ascent(const LMAscentCase &c, LMPoweredFlightResult &res) const;
+	void DescentTable(const std::vector<LMDescentCase> &cases, LGCDescentConstants *consts, std::vector<LMPoweredFlightResult> &res, unsigned maxthreads = 0) const;
+	void AscentTable(const std::vector<LMAscentCase> &cases, std::vector<LMPoweredFlightResult> &res, unsigned maxthreads = 0) const;
+protected:
+	//Guidance cycles before a flight is given up
+	static const int MaxCycles;
+
+	LMPoweredFlightOptions opt;
+};
@@ -825,7 +825,8 @@ namespace rtcc
 			goto LOI_INTER_B3;
 		}
 		R_p = (R[2] + R[3]) / 2.0;
-		double dh2 = DELTAH(R_p, r_N, dw_a, U_L, R_N_u, U_S, SGN);
+		double dh2;
+		dh2 = DELTAH(R_p, r_N, dw_a, U_L, R_N_u, U_S, SGN);
 		if (abs(dh2 - opt.dh_bias) < 0.1)
 		{
 			goto LOI_INTER_B3;
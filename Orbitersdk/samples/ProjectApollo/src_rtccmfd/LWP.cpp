@@ -18,7 +18,9 @@
   along with this program.  If not, see <https://www.gnu.org/licenses/>.
   **************************************************************************/
 
+#include <chrono>
 #include "Orbitersdk.h"
+#include "WorkerPool.h"
 #include "LWP.h"
 
 LaunchWindowProcessor::LaunchWindowProcessor()
@@ -242,16 +244,13 @@ void LaunchWindowProcessor::NPLAN(double &MJDIP)
 	} while (abs(DLON) >= DOS && ITER <= CMAX);
 }
 
-void LaunchWindowProcessor::LWT()
+//Inplane lift-off time for the current window side, searched from MJDIP on
+bool LaunchWindowProcessor::INPLN(double &MJDIP)
 {
 	SV sv_P;
-	double MJDIP, V, delta, DV, MJDIP0;
+	double V, delta, DV, MJDIP0;
 	ITERSTATE iter;
 
-	MJDIP = sv_T.MJD;
-	
-LWT1:
-
 	iter.dv = 0.0;
 	NPLAN(MJDIP);
 	MJDIP0 = MJDIP;
@@ -269,12 +268,29 @@ LWT1:
 			OrbMech::ITER(iter.c_I, iter.s_F, iter.err, iter.p_H, iter.dv, iter.erro, iter.dvo, DX1);
 			if (iter.s_F)
 			{
-				error = 3;
-				return;
+				return false;
 			}
 		}
 	} while (abs(iter.err) > DVTOL);
 
+	return true;
+}
+
+void LaunchWindowProcessor::LWT()
+{
+	SV sv_P;
+	double MJDIP, delta;
+
+	MJDIP = sv_T.MJD;
+	
+LWT1:
+
+	if (INPLN(MJDIP) == false)
+	{
+		error = 3;
+		return;
+	}
+
 	if (NS != 1)
 	{
 		MJDOPEN = MJDIP + DTOPT / 24.0 / 3600.0;
@@ -333,6 +349,14 @@ double LaunchWindowProcessor::PHANG(SV sv_P, int phcont, int wrp)
 }
 
 double LaunchWindowProcessor::GMTLS(double MJDI)
+{
+	int ITER;
+
+	return GMTLS(MJDI, 0.0, ITER);
+}
+
+//Lift-off time after which the chaser is inserted at phase angle OFF from the target
+double LaunchWindowProcessor::GMTLS(double MJDI, double OFF, int &ITER)
 {
 	SV sv_P;
 	double DT, STAR, phase, n, delta;
@@ -340,14 +364,18 @@ double LaunchWindowProcessor::GMTLS(double MJDI)
 	DT = 1000.0;
 	STAR = MJDI;
 	n = OrbMech::GetMeanMotion(sv_T.R, sv_T.V, mu);
+	ITER = 0;
 
 	do
 	{
 		LENSR(STAR, YSMAX, sv_P, delta);
-		phase = PHANG(sv_P, 2, 0);
+		phase = PHANG(sv_P, 2, 0) - OFF;
+		while (phase >= PI) phase -= PI2;
+		while (phase < -PI) phase += PI2;
 		DT = -phase / n;
 		STAR += DT / 24.0 / 3600.0;
-	} while (abs(DT) > DET);
+		ITER++;
+	} while (abs(DT) > DET && ITER < 10 * CMAX);
 	return STAR;
 }
 
@@ -587,6 +615,127 @@ void LaunchWindowProcessor::LWPOT()
 	lwp_param_table->PHASE[1] = PHANG(sv_P, NEGTIV, WRAP);
 }
 
+void LaunchWindowProcessor::SWEEP(const LWPSweepSettings &set, LWPSweepTable &tab)
+{
+	struct PlaneSolution
+	{
+		bool ok;
+		double MJDPLANE;
+		//Target at the inplane time
+		SV sv_T;
+	};
+
+	LWPSettings base = set.Base;
+	unsigned threads;
+	int nns, nr, noff, nplane, npts, ITSUM, i;
+
+	auto t0 = std::chrono::steady_clock::now();
+
+	tab = LWPSweepTable();
+	nns = set.NS.size();
+	nr = set.RINS.size();
+	noff = set.OFFSET.size();
+	if (set.NDAYS <= 0 || nns == 0 || nr == 0 || noff == 0) return;
+
+	Init(base);
+	//The integrated propagation goes through the Orbiter API, which may only be used from the simulation thread
+	threads = SVPROP == 1 ? 1 : set.MaxThreads;
+
+	//Target at the start of each day, each propagated from the previous day
+	std::vector<SV> sv_day(set.NDAYS);
+	sv_day[0] = UPDATE(sv_T, (set.MJDSTART - sv_T.MJD)*24.0*3600.0);
+	for (i = 1;i < set.NDAYS;i++)
+	{
+		sv_day[i] = UPDATE(sv_day[i - 1], set.DAYSTEP*24.0*3600.0);
+	}
+
+	auto t1 = std::chrono::steady_clock::now();
+
+	//Inplane times of each day and side
+	const LaunchWindowProcessor &init = *this;
+	nplane = set.NDAYS*nns;
+	std::vector<PlaneSolution> plane(nplane);
+	WorkerPool::ParallelFor(nplane, [&](int j)
+	{
+		LaunchWindowProcessor proc(init);
+		double MJDIP;
+
+		proc.NS = set.NS[j % nns];
+		proc.sv_T = sv_day[j / nns];
+		MJDIP = proc.sv_T.MJD;
+		plane[j].ok = proc.INPLN(MJDIP);
+		plane[j].MJDPLANE = MJDIP + DTOPT / 24.0 / 3600.0;
+		plane[j].sv_T = proc.sv_T;
+	}, threads);
+
+	auto t2 = std::chrono::steady_clock::now();
+
+	//Lift-off time and targeting of each grid point
+	npts = nplane * nr*noff;
+	tab.Points.resize(npts);
+	WorkerPool::ParallelFor(npts, [&](int k)
+	{
+		LWPSweepPoint &p = tab.Points[k];
+		const PlaneSolution &pl = plane[k / (nr*noff)];
+		int r = (k / noff) % nr;
+		double UINS;
+		SV sv_P;
+
+		p.DAY = k / (nns*nr*noff);
+		p.NS = set.NS[(k / (nr*noff)) % nns];
+		p.RINS = set.RINS[r];
+		p.OFFSET = set.OFFSET[k % noff];
+		if (pl.ok == false)
+		{
+			p.LWPERROR = 3;
+			return;
+		}
+
+		LaunchWindowProcessor proc(init);
+		proc.NS = p.NS;
+		proc.sv_T = pl.sv_T;
+		proc.MJDPLANE = pl.MJDPLANE;
+		proc.VINS = init.VINS*sqrt(init.RINS / p.RINS);
+		proc.RINS = p.RINS;
+
+		proc.MJDLO = proc.GMTLS(pl.MJDPLANE, p.OFFSET, p.ITER);
+		if (p.ITER >= 10 * CMAX)
+		{
+			p.LWPERROR = 4;
+		}
+		proc.NSERT(proc.MJDLO, UINS, sv_P, p.DH);
+		proc.TARGT(sv_P);
+
+		p.MJDPLANE = pl.MJDPLANE;
+		p.MJDLO = proc.MJDLO;
+		p.AZL = proc.AZL;
+		p.IIGM = proc.IIGM;
+		p.TIGM = proc.TIGM;
+		p.PA = proc.PA;
+	}, threads);
+
+	auto t3 = std::chrono::steady_clock::now();
+
+	ITSUM = 0;
+	for (i = 0;i < npts;i++)
+	{
+		if (tab.Points[i].LWPERROR)
+		{
+			tab.Failed++;
+			continue;
+		}
+		tab.Solved++;
+		ITSUM += tab.Points[i].ITER;
+		if (tab.Points[i].ITER > tab.ITERMAX) tab.ITERMAX = tab.Points[i].ITER;
+	}
+	if (tab.Solved > 0) tab.ITERMEAN = (double)ITSUM / (double)tab.Solved;
+
+	tab.TTARGET = std::chrono::duration<double>(t1 - t0).count();
+	tab.TPLANE = std::chrono::duration<double>(t2 - t1).count();
+	tab.TLIFTOFF = std::chrono::duration<double>(t3 - t2).count();
+	tab.TTOTAL = std::chrono::duration<double>(t3 - t0).count();
+}
+
 void LaunchWindowProcessor::GetOutput(LWPSummary &out)
 {
 	out.LWPERROR = error;
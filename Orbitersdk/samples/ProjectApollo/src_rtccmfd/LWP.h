@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include <vector>
 #include "OrbMech.h"
 
 using namespace OrbMech;
@@ -108,6 +109,62 @@ struct LWPSettings
 	LWPParameterTable *lwp_param_table;
 };
 
+//Launch window sweep over launch days, window sides, insertion radii and phase angle offsets. The inplane time of each
+//day and side is solved once and shared by all insertion radii and phase angle offsets.
+struct LWPSweepSettings
+{
+	//Settings of the single solution. The grid values below replace their counterparts.
+	LWPSettings Base;
+	//The search for the inplane time of day i starts at MJDSTART + i*DAYSTEP
+	double MJDSTART = 0.0;
+	int NDAYS = 1;
+	double DAYSTEP = 1.0;
+	//Window sides, each with its own launch azimuth: 0 = opening (ascending node), 1 = closing (descending node)
+	std::vector<int> NS;
+	//Radii of insertion. The velocity at insertion keeps its ratio to circular velocity of the base settings.
+	std::vector<double> RINS;
+	//Phase angles desired at insertion
+	std::vector<double> OFFSET;
+	//0 = all hardware threads
+	unsigned MaxThreads = 0;
+};
+
+struct LWPSweepPoint
+{
+	int DAY = 0;
+	int NS = 0;
+	double RINS = 0.0;
+	double OFFSET = 0.0;
+	//0 = no error, 3 = no inplane time, 4 = lift-off time not converged
+	int LWPERROR = 0;
+	double MJDPLANE = 0.0;
+	double MJDLO = 0.0;
+	double AZL = 0.0;
+	double IIGM = 0.0;
+	double TIGM = 0.0;
+	double PA = 0.0;
+	//Difference of target and chaser radius at insertion
+	double DH = 0.0;
+	//Lift-off time iterations
+	int ITER = 0;
+};
+
+struct LWPSweepTable
+{
+	//Grid points ordered by day, side, insertion radius and phase angle offset
+	std::vector<LWPSweepPoint> Points;
+	int Solved = 0;
+	int Failed = 0;
+	//Lift-off time iterations, mean and maximum
+	double ITERMEAN = 0.0;
+	int ITERMAX = 0;
+	//Wall clock time (s) of the target propagation, the inplane times, the lift-off times and the whole sweep
+	double TTARGET = 0.0;
+	double TPLANE = 0.0;
+	double TLIFTOFF = 0.0;
+	double TTOTAL = 0.0;
+};
+
 class LaunchWindowProcessor
 {
 public:
@@ -116,13 +173,17 @@ public:
 	void SetGlobalConstants(double mu, double w_E, double R_E);
 	void LWP();
 	void GetOutput(LWPSummary &out);
+	//Solves all grid points of the sweep. Global constants have to be set first.
+	void SWEEP(const LWPSweepSettings &set, LWPSweepTable &tab);
 protected:
 	void LWT();
+	bool INPLN(double &MJDIP);
 	SV UPDATE(SV sv0, double dt);
 	void NPLAN(double &MJDIP);
 	void LENSR(double mjdlo, double ysmax, SV &sv_P, double &delta);
 	double PHANG(SV sv_P, int phcont, int wrp);
 	double GMTLS(double MJDI);
+	double GMTLS(double MJDI, double OFF, int &ITER);
 	void RLOT();
 	void TARGT(SV &sv_P);
 	SV PositionMatch(SV sv_A, SV sv_P);
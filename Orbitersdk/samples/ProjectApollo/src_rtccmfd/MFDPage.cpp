@@ -0,0 +1,173 @@
+/****************************************************************************
+This file is part of Project Apollo - NASSP
+
+RTCC MFD Page Model
+
+Project Apollo is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+Project Apollo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Project Apollo; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+See http://nassp.sourceforge.net/license/ for more details.
+
+**************************************************************************/
+
+#include "MFDPage.h"
+
+MFDPage::MFDPage()
+{
+	page = -1;
+	count = 0;
+	formatted = 0;
+	buffer[0] = 0;
+}
+
+void MFDPage::Begin(int id)
+{
+	if (id != page)
+	{
+		Clear();
+		page = id;
+	}
+	count = 0;
+	formatted = 0;
+}
+
+void MFDPage::Clear()
+{
+	commands.clear();
+	page = -1;
+	count = 0;
+}
+
+MFDPage::Command &MFDPage::Next(CommandType type, int x, int y)
+{
+	if (count == (int)commands.size())
+	{
+		commands.push_back(Command());
+		commands.back().Type = type;
+	}
+
+	Command &c = commands[count++];
+	if (c.Type != type)
+	{
+		//A different command than on the last refresh, nothing of it can be kept
+		c.Type = type;
+		c.Deps.clear();
+	}
+	c.x = x;
+	c.y = y;
+	return c;
+}
+
+char *MFDPage::Reformat(Command &c)
+{
+	if (!c.Deps.empty() && c.Deps == deps) return NULL;
+
+	c.Deps = deps;
+	formatted++;
+	return buffer;
+}
+
+void MFDPage::SetFont(oapi::Font *font)
+{
+	Next(MFDPAGE_FONT).Ptr = font;
+}
+
+void MFDPage::SetPen(oapi::Pen *pen)
+{
+	Next(MFDPAGE_PEN).Ptr = pen;
+}
+
+void MFDPage::SetTextAlign(int horizontal, int vertical)
+{
+	Next(MFDPAGE_ALIGN, horizontal, vertical);
+}
+
+void MFDPage::Text(int x, int y, const char *str, int len)
+{
+	Command &c = Next(MFDPAGE_TEXT, x, y);
+
+	c.Deps.clear();
+	c.Str.assign(str, len);
+}
+
+void MFDPage::Text(int x, int y, const std::string &str)
+{
+	Text(x, y, str.c_str(), (int)str.length());
+}
+
+void MFDPage::TextW(int x, int y, const wchar_t *str, int len)
+{
+	Next(MFDPAGE_TEXTW, x, y).WStr.assign(str, len);
+}
+
+void MFDPage::Line(int x0, int y0, int x1, int y1)
+{
+	Command &c = Next(MFDPAGE_LINE, x0, y0);
+
+	c.x2 = x1;
+	c.y2 = y1;
+}
+
+void MFDPage::Pixel(int x, int y, unsigned col)
+{
+	Next(MFDPAGE_PIXEL, x, y).Col = col;
+}
+
+std::string MFDPage::RenderText(int W, int H, int cols, int rows) const
+{
+	std::vector<std::string> grid(rows, std::string(cols, ' '));
+	std::string out;
+	int i, j, col, row, len, align = 0;
+
+	for (i = 0;i < count;i++)
+	{
+		const Command &c = commands[i];
+
+		if (c.Type == MFDPAGE_ALIGN)
+		{
+			align = c.x;
+			continue;
+		}
+		if (c.Type != MFDPAGE_TEXT && c.Type != MFDPAGE_TEXTW) continue;
+
+		len = (int)(c.Type == MFDPAGE_TEXT ? c.Str.length() : c.WStr.length());
+		col = c.x * cols / W;
+		row = c.y * rows / H;
+		//Center and right alignment
+		if (align == 1) col -= len / 2;
+		else if (align == 2) col -= len;
+		if (row < 0 || row >= rows) continue;
+
+		for (j = 0;j < len;j++)
+		{
+			if (col + j < 0 || col + j >= cols) continue;
+			if (c.Type == MFDPAGE_TEXT)
+			{
+				grid[row][col + j] = c.Str[j];
+			}
+			else
+			{
+				//Greek letters and other symbols are not in the text
+				grid[row][col + j] = c.WStr[j] < 128 ? (char)c.WStr[j] : '?';
+			}
+		}
+	}
+
+	for (i = 0;i < rows;i++)
+	{
+		out += grid[i].substr(0, grid[i].find_last_not_of(' ') + 1);
+		out += '\n';
+	}
+	return out;
+}
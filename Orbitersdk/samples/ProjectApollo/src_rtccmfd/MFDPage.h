@@ -0,0 +1,207 @@
+/****************************************************************************
+This file is part of Project Apollo - NASSP
+
+RTCC MFD Page Model (Header)
+
+Project Apollo is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+Project Apollo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Project Apollo; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+See http://nassp.sourceforge.net/license/ for more details.
+
+**************************************************************************/
+
+#pragma once
+
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include <type_traits>
+
+namespace oapi
+{
+	class Font;
+	class Pen;
+}
+
+// ****************************************************************
+// The RTCC MFD draws a page by going through the draw commands of
+// the current screen on every refresh. The page records these
+// commands in order instead of passing them to the sketchpad, and
+// keeps them from one refresh to the next.
+//
+// A formatted line is given with the values it depends on, which
+// are the arguments of its format or formatting function. They are
+// stored with the line and the line is only formatted again when
+// one of them is different from the last refresh. Lines are matched
+// by their position in the page, so a line that moves because the
+// lines before it changed is formatted again as well.
+//
+// The recorded page is then drawn to the sketchpad, or written as
+// plain text on a grid of characters to look at it without Orbiter.
+// ****************************************************************
+
+class MFDPage
+{
+public:
+	MFDPage();
+
+	//Starts recording page id. Lines kept from a different page are dropped.
+	void Begin(int id);
+	//Drops all lines
+	void Clear();
+
+	void SetFont(oapi::Font *font);
+	void SetPen(oapi::Pen *pen);
+	//Alignments as in oapi::Sketchpad
+	void SetTextAlign(int horizontal, int vertical = 0);
+	void Text(int x, int y, const char *str, int len);
+	void Text(int x, int y, const std::string &str);
+	void TextW(int x, int y, const wchar_t *str, int len);
+	void Line(int x0, int y0, int x1, int y1);
+	void Pixel(int x, int y, unsigned col);
+
+	//Line formatted with sprintf. Only chars, numbers and strings can be arguments.
+	template<typename... Args> void Printf(int x, int y, const char *fmt, Args... args);
+	//Line formatted by a member function of obj, which writes to its first argument
+	template<class C, typename... P, typename... Args> void Format(int x, int y, C *obj, void (C::*f)(char *, P...), Args... args);
+
+	//Draws the recorded page
+	template<class S> void Render(S *skp) const;
+	//Writes the text of the recorded page to a grid of cols x rows characters, for a page of W x H pixels
+	std::string RenderText(int W, int H, int cols, int rows) const;
+
+	//Commands of the last recorded page and how many lines of it had to be formatted
+	int Commands() const { return count; }
+	int Formatted() const { return formatted; }
+
+protected:
+	enum CommandType
+	{
+		MFDPAGE_FONT,
+		MFDPAGE_PEN,
+		MFDPAGE_ALIGN,
+		MFDPAGE_TEXT,
+		MFDPAGE_TEXTW,
+		MFDPAGE_LINE,
+		MFDPAGE_PIXEL
+	};
+
+	struct Command
+	{
+		CommandType Type;
+		int x, y, x2, y2;
+		void *Ptr;
+		unsigned Col;
+		//Values the text was formatted from, empty for plain text
+		std::string Deps;
+		std::string Str;
+		std::wstring WStr;
+	};
+
+	Command &Next(CommandType type, int x = 0, int y = 0);
+	//Formatted text of the next line. Returns NULL if deps are the same as the last time, otherwise the buffer to format into.
+	char *Reformat(Command &c);
+
+	template<typename T> void Dep(T v)
+	{
+		static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value, "Only chars, numbers and strings can be line arguments");
+		deps.append((const char *)&v, sizeof(v));
+	}
+	void Dep(const char *s)
+	{
+		//Including the terminating zero, so strings next to each other stay apart
+		deps.append(s, strlen(s) + 1);
+	}
+	void Dep(char *s) { Dep((const char *)s); }
+	void Deps() {}
+	template<typename T, typename... Args> void Deps(T v, Args... args)
+	{
+		Dep(v);
+		Deps(args...);
+	}
+
+	std::vector<Command> commands;
+	int page;
+	int count;
+	int formatted;
+	std::string deps;
+	char buffer[256];
+};
+
+template<typename... Args> void MFDPage::Printf(int x, int y, const char *fmt, Args... args)
+{
+	Command &c = Next(MFDPAGE_TEXT, x, y);
+	char *buf;
+
+	deps.clear();
+	deps.append((const char *)&fmt, sizeof(fmt));
+	Deps(args...);
+	if ((buf = Reformat(c)) != NULL)
+	{
+		snprintf(buf, sizeof(buffer), fmt, args...);
+		c.Str = buf;
+	}
+}
+
+template<class C, typename... P, typename... Args> void MFDPage::Format(int x, int y, C *obj, void (C::*f)(char *, P...), Args... args)
+{
+	Command &c = Next(MFDPAGE_TEXT, x, y);
+	char *buf;
+
+	deps.clear();
+	deps.append((const char *)&f, sizeof(f));
+	Deps(args...);
+	if ((buf = Reformat(c)) != NULL)
+	{
+		buf[0] = 0;
+		(obj->*f)(buf, args...);
+		c.Str = buf;
+	}
+}
+
+template<class S> void MFDPage::Render(S *skp) const
+{
+	int i;
+
+	for (i = 0;i < count;i++)
+	{
+		const Command &c = commands[i];
+
+		switch (c.Type)
+		{
+		case MFDPAGE_FONT:
+			skp->SetFont((oapi::Font *)c.Ptr);
+			break;
+		case MFDPAGE_PEN:
+			skp->SetPen((oapi::Pen *)c.Ptr);
+			break;
+		case MFDPAGE_ALIGN:
+			skp->SetTextAlign((typename S::TAlign_horizontal)c.x, (typename S::TAlign_vertical)c.y);
+			break;
+		case MFDPAGE_TEXT:
+			skp->Text(c.x, c.y, c.Str.c_str(), (int)c.Str.length());
+			break;
+		case MFDPAGE_TEXTW:
+			skp->TextW(c.x, c.y, (wchar_t *)c.WStr.c_str(), (int)c.WStr.length());
+			break;
+		case MFDPAGE_LINE:
+			skp->Line(c.x, c.y, c.x2, c.y2);
+			break;
+		case MFDPAGE_PIXEL:
+			skp->Pixel(c.x, c.y, c.Col);
+			break;
+		}
+	}
+}
@@ -1,4 +1,5 @@
 #include "OrbMech.h"
+#include "FixedMatrix.h"
 #include <limits>
 #include <vector>
 
@@ -431,6 +432,443 @@ double stumpC(double z)
 	return c;
 }
 
+//Lanes processed together by the batch functions
+static const int BATCH_LANES = 8;
+//Largest argument of the Stumpff series
+static const double STUMPFF_ZMAX = 1.0;
+//Terms of the Stumpff series, good to rounding for arguments up to STUMPFF_ZMAX
+static const int STUMPFF_TERMS = 10;
+
+void ConicBatch::resize(int n)
+{
+	rx.resize(n);
+	ry.resize(n);
+	rz.resize(n);
+	vx.resize(n);
+	vy.resize(n);
+	vz.resize(n);
+}
+
+void ConicBatch::set(int i, VECTOR3 R, VECTOR3 V)
+{
+	rx[i] = R.x;
+	ry[i] = R.y;
+	rz[i] = R.z;
+	vx[i] = V.x;
+	vy[i] = V.y;
+	vz[i] = V.z;
+}
+
+void ConicBatch::get(int i, VECTOR3 &R, VECTOR3 &V) const
+{
+	R = _V(rx[i], ry[i], rz[i]);
+	V = _V(vx[i], vy[i], vz[i]);
+}
+
+//stumpC and stumpS of one block of lanes. The argument is quartered until it is small enough for the series, then the
+//double angle formulas c2(4z) = c1(z)^2/2 and c3(4z) = (c2(z) + c0(z)*c3(z))/4 give the functions of the full argument.
+//There are only multiplications and selects, so the lane loops vectorize for elliptic and hyperbolic arguments alike. The
+//lane counts and masks are doubles like the data, so the selects need no conversions.
+static void stumpCS_lanes(const double *z, double *C, double *S)
+{
+	//1/(2i+2)! and 1/(2i+3)!
+	static const double C2[STUMPFF_TERMS] = { 1.0 / 2.0, 1.0 / 24.0, 1.0 / 720.0, 1.0 / 40320.0, 1.0 / 3628800.0, 1.0 / 479001600.0, 1.0 / 87178291200.0, 1.0 / 20922789888000.0, 1.0 / 6402373705728000.0, 1.0 / 2432902008176640000.0 };
+	static const double C3[STUMPFF_TERMS] = { 1.0 / 6.0, 1.0 / 120.0, 1.0 / 5040.0, 1.0 / 362880.0, 1.0 / 39916800.0, 1.0 / 6227020800.0, 1.0 / 1307674368000.0, 1.0 / 355687428096000.0, 1.0 / 121645100408832000.0, 1.0 / 51090942171709440000.0 };
+	double zr[BATCH_LANES], k[BATCH_LANES], c0[BATCH_LANES], c1[BATCH_LANES], c2[BATCH_LANES], c3[BATCH_LANES];
+	double d0, d1, d2, d3, m, any;
+	int pass, kmax, i, j;
+
+	for (j = 0;j < BATCH_LANES;j++)
+	{
+		zr[j] = z[j];
+		k[j] = 0.0;
+	}
+	//64 quarterings cover any finite argument
+	for (pass = 0;pass < 64;pass++)
+	{
+		any = 0.0;
+		for (j = 0;j < BATCH_LANES;j++)
+		{
+			m = abs(zr[j]) > STUMPFF_ZMAX ? 1.0 : 0.0;
+			zr[j] = m != 0.0 ? 0.25*zr[j] : zr[j];
+			k[j] += m;
+			any += m;
+		}
+		if (any == 0.0) break;
+	}
+	kmax = pass;
+
+	for (j = 0;j < BATCH_LANES;j++)
+	{
+		c2[j] = C2[STUMPFF_TERMS - 1];
+		c3[j] = C3[STUMPFF_TERMS - 1];
+	}
+	for (i = STUMPFF_TERMS - 2;i >= 0;i--)
+	{
+		for (j = 0;j < BATCH_LANES;j++)
+		{
+			c2[j] = C2[i] - zr[j] * c2[j];
+			c3[j] = C3[i] - zr[j] * c3[j];
+		}
+	}
+	for (j = 0;j < BATCH_LANES;j++)
+	{
+		c0[j] = 1.0 - zr[j] * c2[j];
+		c1[j] = 1.0 - zr[j] * c3[j];
+	}
+
+	//A lane stops doubling once it is back at its own argument
+	for (pass = 0;pass < kmax;pass++)
+	{
+		for (j = 0;j < BATCH_LANES;j++)
+		{
+			d0 = pass < k[j] ? 2.0*c0[j] * c0[j] - 1.0 : c0[j];
+			d1 = pass < k[j] ? c0[j] * c1[j] : c1[j];
+			d2 = pass < k[j] ? 0.5*c1[j] * c1[j] : c2[j];
+			d3 = pass < k[j] ? 0.25*(c2[j] + c0[j] * c3[j]) : c3[j];
+			c0[j] = d0;
+			c1[j] = d1;
+			c2[j] = d2;
+			c3[j] = d3;
+		}
+	}
+
+	for (j = 0;j < BATCH_LANES;j++)
+	{
+		C[j] = c2[j];
+		S[j] = c3[j];
+	}
+}
+
+void stumpCS_batch(int n, const double *z, double *C, double *S)
+{
+	double zl[BATCH_LANES], Cl[BATCH_LANES], Sl[BATCH_LANES];
+	int b, w, j;
+
+	for (b = 0;b + BATCH_LANES <= n;b += BATCH_LANES)
+	{
+		stumpCS_lanes(z + b, C + b, S + b);
+	}
+	//The unused lanes of the last block get zero arguments
+	w = n - b;
+	if (w > 0)
+	{
+		for (j = 0;j < BATCH_LANES;j++)
+		{
+			zl[j] = j < w ? z[b + j] : 0.0;
+		}
+		stumpCS_lanes(zl, Cl, Sl);
+		for (j = 0;j < w;j++)
+		{
+			C[b + j] = Cl[j];
+			S[b + j] = Sl[j];
+		}
+	}
+}
+
+void kepler_U_batch(int n, const double *dt, const double *ro, const double *vro, const double *a, double mu, double *x)
+{
+	double xl[BATCH_LANES], al[BATCH_LANES], rol[BATCH_LANES], p[BATCH_LANES], q[BATCH_LANES], sdt[BATCH_LANES];
+	double z[BATCH_LANES], C[BATCH_LANES], S[BATCH_LANES], act[BATCH_LANES];
+	double error2, smu, F, dFdx, ratio, any;
+	int nMax, b, w, it, j;
+
+	error2 = 1e-8;
+	nMax = 1000;
+	smu = sqrt(mu);
+
+	//Each block of contiguous states runs the Newton iteration of kepler_U together. A lane that has converged keeps its
+	//value through the masked update, and the block is done when no lane is active.
+	for (b = 0;b < n;b += BATCH_LANES)
+	{
+		w = n - b < BATCH_LANES ? n - b : BATCH_LANES;
+
+		//The unused lanes of the last block start converged, with a harmless equation
+		for (j = 0;j < BATCH_LANES;j++)
+		{
+			if (j < w)
+			{
+				xl[j] = x[b + j];
+				al[j] = a[b + j];
+				rol[j] = ro[b + j];
+				p[j] = ro[b + j] * vro[b + j] / smu;
+				q[j] = 1.0 - a[b + j] * ro[b + j];
+				sdt[j] = smu * dt[b + j];
+				act[j] = 1.0;
+			}
+			else
+			{
+				xl[j] = al[j] = p[j] = q[j] = sdt[j] = 0.0;
+				rol[j] = 1.0;
+				act[j] = 0.0;
+			}
+		}
+
+		for (it = 0;it <= nMax;it++)
+		{
+			for (j = 0;j < BATCH_LANES;j++)
+			{
+				z[j] = al[j] * xl[j] * xl[j];
+			}
+			stumpCS_lanes(z, C, S);
+			any = 0.0;
+			for (j = 0;j < BATCH_LANES;j++)
+			{
+				F = p[j] * xl[j] * xl[j] * C[j] + q[j] * xl[j] * xl[j] * xl[j] * S[j] + rol[j] * xl[j] - sdt[j];
+				dFdx = p[j] * xl[j] * (1.0 - z[j] * S[j]) + q[j] * xl[j] * xl[j] * C[j] + rol[j];
+				ratio = F / dFdx;
+				xl[j] = act[j] != 0.0 ? xl[j] - ratio : xl[j];
+				act[j] = abs(ratio) > error2 ? act[j] : 0.0;
+				any += act[j];
+			}
+			if (any == 0.0) break;
+		}
+
+		for (j = 0;j < w;j++)
+		{
+			x[b + j] = xl[j];
+		}
+	}
+}
+
+//Initial guess of rv_from_r0v0
+static double kepler_U_guess(VECTOR3 R0, VECTOR3 V0, double t, double alpha, double mu)
+{
+	if (abs(alpha) > 0.00000001 || length(V0) == 0.0)
+	{
+		return sqrt(mu)*abs(alpha)*t;
+	}
+
+	VECTOR3 H = crossp(R0, V0);
+	double hmag = length(H);
+	double p = hmag * hmag / mu;
+	double s = 0.5  * (PI05 - atan(3.0 *sqrt(mu / (p*p*p))* t));
+	double w = atan(power(tan(s), 1.0 / 3.0));
+	return sqrt(p) * (2.0 *cot(2.0 *w));
+}
+
+void rv_from_r0v0_batch(const ConicBatch &sv0, const double *dt, ConicBatch &sv1, double mu)
+{
+	int n = sv0.size();
+	std::vector<double> r0(n), vr0(n), alpha(n), x(n), z(n), C(n), S(n);
+	double smu, f, g, fdot, gdot, r, v0;
+	int i;
+
+	sv1.resize(n);
+	smu = sqrt(mu);
+
+	for (i = 0;i < n;i++)
+	{
+		r0[i] = sqrt(sv0.rx[i] * sv0.rx[i] + sv0.ry[i] * sv0.ry[i] + sv0.rz[i] * sv0.rz[i]);
+		v0 = sqrt(sv0.vx[i] * sv0.vx[i] + sv0.vy[i] * sv0.vy[i] + sv0.vz[i] * sv0.vz[i]);
+		vr0[i] = (sv0.rx[i] * sv0.vx[i] + sv0.ry[i] * sv0.vy[i] + sv0.rz[i] * sv0.vz[i]) / r0[i];
+		alpha[i] = 2.0 / r0[i] - v0 * v0 / mu;
+		x[i] = kepler_U_guess(_V(sv0.rx[i], sv0.ry[i], sv0.rz[i]), _V(sv0.vx[i], sv0.vy[i], sv0.vz[i]), dt[i], alpha[i], mu);
+	}
+
+	kepler_U_batch(n, dt, r0.data(), vr0.data(), alpha.data(), mu, x.data());
+
+	for (i = 0;i < n;i++)
+	{
+		z[i] = alpha[i] * x[i] * x[i];
+	}
+	stumpCS_batch(n, z.data(), C.data(), S.data());
+
+	for (i = 0;i < n;i++)
+	{
+		f = 1.0 - x[i] * x[i] / r0[i] * C[i];
+		g = dt[i] - 1.0 / smu * x[i] * x[i] * x[i] * S[i];
+		sv1.rx[i] = sv0.rx[i] * f + sv0.vx[i] * g;
+		sv1.ry[i] = sv0.ry[i] * f + sv0.vy[i] * g;
+		sv1.rz[i] = sv0.rz[i] * f + sv0.vz[i] * g;
+		r = sqrt(sv1.rx[i] * sv1.rx[i] + sv1.ry[i] * sv1.ry[i] + sv1.rz[i] * sv1.rz[i]);
+		fdot = smu / r / r0[i] * (z[i] * S[i] - 1.0)*x[i];
+		gdot = 1.0 - x[i] * x[i] / r * C[i];
+		sv1.vx[i] = sv0.rx[i] * fdot + sv0.vx[i] * gdot;
+		sv1.vy[i] = sv0.ry[i] * fdot + sv0.vy[i] * gdot;
+		sv1.vz[i] = sv0.rz[i] * fdot + sv0.vz[i] * gdot;
+	}
+}
+
+void rv_from_r0v0_batch(VECTOR3 R0, VECTOR3 V0, int n, const double *dt, ConicBatch &sv1, double mu)
+{
+	ConicBatch sv0;
+	int i;
+
+	sv0.resize(n);
+	for (i = 0;i < n;i++)
+	{
+		sv0.set(i, R0, V0);
+	}
+	rv_from_r0v0_batch(sv0, dt, sv1, mu);
+}
+
+//fraction_xi of one block of lanes. The continued fraction of fraction_pq is summed with the same forward recurrence, with
+//an(n) = n^2 + 2n + 4 and ad(n) = 4n^2 + 8n + 15 in closed form. A lane stops adding terms after the first one below 1e-9.
+static void fraction_xi_lanes(const double *x, double *xi)
+{
+	double eta[BATCH_LANES], sq[BATCH_LANES], d[BATCH_LANES], u[BATCH_LANES], pq[BATCH_LANES], act[BATCH_LANES];
+	double cf, dn, un, sum, any;
+	int n, j;
+
+	for (j = 0;j < BATCH_LANES;j++)
+	{
+		sq[j] = sqrt(1.0 + x[j]);
+		eta[j] = (sq[j] - 1.0) / (sq[j] + 1.0);
+		d[j] = 1.0;
+		u[j] = 1.0 / 5.0;
+		pq[j] = u[j];
+		act[j] = 1.0;
+	}
+	for (n = 1;n <= 1000;n++)
+	{
+		cf = -(double)(n*n + 2 * n + 4) / (double)(4 * n*n + 8 * n + 15);
+		any = 0.0;
+		for (j = 0;j < BATCH_LANES;j++)
+		{
+			dn = 1.0 / (1.0 - cf * eta[j] * d[j]);
+			un = u[j] * (dn - 1.0);
+			sum = act[j] != 0.0 ? pq[j] + un : pq[j];
+			dn = act[j] != 0.0 ? dn : d[j];
+			un = act[j] != 0.0 ? un : u[j];
+			d[j] = dn;
+			u[j] = un;
+			pq[j] = sum;
+			act[j] = abs(un) > 1e-9 ? act[j] : 0.0;
+			any += act[j];
+		}
+		if (any == 0.0) break;
+	}
+	for (j = 0;j < BATCH_LANES;j++)
+	{
+		xi[j] = 1.0 / (8.0*(sq[j] + 1.0))*(3.0 + pq[j] / (1.0 + eta[j] * pq[j]));
+	}
+}
+
+//Largest root of z^3 - 3z = 2w for w >= 0 in one block of lanes, which is 2cosh(acosh(w)/3) of elegant_lambert for w >= 1
+//and 2cos(acos(w)/3) below. Newton's method starts above the root, from 2 + 2/9*(w - 1) or 2, and falls to it monotonically.
+static void lambert_cubic_lanes(const double *w, double *z)
+{
+	double act[BATCH_LANES];
+	double dz, any;
+	int it, j;
+
+	for (j = 0;j < BATCH_LANES;j++)
+	{
+		z[j] = w[j] > 1.0 ? 2.0 + 2.0 / 9.0*(w[j] - 1.0) : 2.0;
+		act[j] = 1.0;
+	}
+	for (it = 0;it < 100;it++)
+	{
+		any = 0.0;
+		for (j = 0;j < BATCH_LANES;j++)
+		{
+			dz = (z[j] * z[j] * z[j] - 3.0*z[j] - 2.0*w[j]) / (3.0*z[j] * z[j] - 3.0);
+			z[j] = act[j] != 0.0 ? z[j] - dz : z[j];
+			//The next step would be below rounding
+			act[j] = dz > 1e-12*z[j] ? act[j] : 0.0;
+			any += act[j];
+		}
+		if (any == 0.0) break;
+	}
+}
+
+void elegant_lambert_batch(int n, const VECTOR3 *R1, const VECTOR3 *V1, const VECTOR3 *R2, const double *dt, int N, bool prog, double mu, VECTOR3 *V)
+{
+	std::vector<double> r1(n), lambda(n), s(n), l(n), m(n), x(n);
+	double xl[BATCH_LANES], ll[BATCH_LANES], ml[BATCH_LANES], xi[BATCH_LANES], h1[BATCH_LANES], wl[BATCH_LANES], z[BATCH_LANES];
+	double act[BATCH_LANES];
+	double tol, r2, c, theta, T, h2, B, y, den, x_new, ratio, any;
+	int nMax, b, w, it, i, j;
+	VECTOR3 c12;
+
+	//Only the single revolution solution has no second branch to choose from
+	if (N != 0)
+	{
+		for (i = 0;i < n;i++)
+		{
+			V[i] = elegant_lambert(R1[i], V1[i], R2[i], dt[i], N, prog, mu);
+		}
+		return;
+	}
+
+	tol = 1e-8;
+	nMax = 1000;
+
+	for (i = 0;i < n;i++)
+	{
+		r1[i] = length(R1[i]);
+		r2 = length(R2[i]);
+		c = length(R2[i] - R1[i]);
+		s[i] = (r1[i] + r2 + c) / 2;
+
+		c12 = crossp(unit(R1[i]), unit(R2[i]));
+		theta = acos(dotp(R1[i], R2[i]) / r1[i] / r2);
+		if ((prog == true && c12.z < 0) || (prog == false && c12.z >= 0))
+		{
+			theta = PI2 - theta;
+		}
+
+		lambda[i] = sqrt(r1[i] * r2) / s[i] * cos(theta / 2.0);
+		T = sqrt(8.0 * mu / (s[i] * s[i] * s[i]))*dt[i];
+		l[i] = (1.0 - lambda[i]) / (1.0 + lambda[i]);
+		l[i] *= l[i];
+		m[i] = T * T / pow(1.0 + lambda[i], 6.0);
+		x[i] = 1.0 + 4.0 * l[i];
+	}
+
+	//Same iteration as elegant_lambert on blocks of contiguous transfers, with masked lanes like in kepler_U_batch
+	for (b = 0;b < n;b += BATCH_LANES)
+	{
+		w = n - b < BATCH_LANES ? n - b : BATCH_LANES;
+
+		//The unused lanes of the last block repeat the first transfer of the block and start converged
+		for (j = 0;j < BATCH_LANES;j++)
+		{
+			i = j < w ? b + j : b;
+			xl[j] = x[i];
+			ll[j] = l[i];
+			ml[j] = m[i];
+			act[j] = j < w ? 1.0 : 0.0;
+		}
+
+		for (it = 0;it <= nMax;it++)
+		{
+			fraction_xi_lanes(xl, xi);
+			for (j = 0;j < BATCH_LANES;j++)
+			{
+				den = (1.0 + 2.0*xl[j] + ll[j])*(3.0 + xl[j] * (1.0 + 4.0*xi[j]));
+				h1[j] = (ll[j] + xl[j])*(ll[j] + xl[j])*(1.0 + xi[j] * (1.0 + 3.0*xl[j])) / den;
+				h2 = ml[j] * (1.0 + (xl[j] - ll[j])*xi[j]) / den;
+				B = 27.0 * h2 / (4.0 * (1.0 + h1[j])*(1.0 + h1[j])*(1.0 + h1[j]));
+				wl[j] = sqrt(B + 1.0);
+			}
+			lambert_cubic_lanes(wl, z);
+			any = 0.0;
+			for (j = 0;j < BATCH_LANES;j++)
+			{
+				y = 2.0 / 3.0 * (1.0 + h1[j])*(wl[j] / z[j] + 1.0);
+				x_new = sqrt(0.25*(1.0 - ll[j])*(1.0 - ll[j]) + ml[j] / y / y) - (1.0 + ll[j]) / 2.0;
+				ratio = xl[j] - x_new;
+				xl[j] = act[j] != 0.0 ? x_new : xl[j];
+				act[j] = abs(ratio) > tol ? act[j] : 0.0;
+				any += act[j];
+			}
+			if (any == 0.0) break;
+		}
+
+		for (j = 0;j < w;j++)
+		{
+			x[b + j] = xl[j];
+		}
+	}
+
+	for (i = 0;i < n;i++)
+	{
+		V[i] = ((R2[i] - R1[i]) + R1[i] * s[i] * (1.0 + lambda[i])*(1.0 + lambda[i]) * (l[i] + x[i]) / (r1[i] * (1.0 + x[i]))) * 1.0 / (lambda[i] * (1 + lambda[i]))*sqrt(mu*(1.0 + x[i]) / (2.0 * s[i] * s[i] * s[i] * (l[i] + x[i])));
+	}
+}
+
 double power(double b, double e)
 {
 	double res;
@@ -3791,6 +4229,9 @@ template <typename T> int sign(T val) {
 	return (T(0) < val) - (val < T(0));
 }
 
+//Used outside of this file
+template int sign<double>(double val);
+
 int DoubleToBuffer(double x, double q, int m)
 {
 	int c = 0, out = 0, f = 1;
@@ -5672,12 +6113,13 @@ double QuadraticIterator(int &c, int &s, double &varguess, double *var, double *
 
 bool SolveSystem(int n, double *A, double *b, double *x, double *det)
 {
-	int e = 0, *p = new int[n];
+	int e = 0, pbuf[SERIES_MAX], *p = pbuf;
+	if (n > SERIES_MAX) p = new int[n];
 	for (int i = 0;i<n;i++) p[i] = i;
 	for (int k = 0;k<n;k++) {
 		int r = 0; double d = 0.0;
 		for (int s = k;s<n;s++) if (fabs(A[s*n + k])>d) { d = fabs(A[s*n + k]); r = s; }
-		if (d == 0.0) { delete[]p; return false; }
+		if (d == 0.0) { if (p != pbuf) delete[]p; return false; }
 		if (r != k) { // Do Swaps
 			for (int i = 0;i<n;i++) { double x = A[k*n + i]; A[k*n + i] = A[r*n + i]; A[r*n + i] = x; }
 			int x = p[k]; p[k] = p[r]; p[r] = x; e++;
@@ -5687,31 +6129,34 @@ bool SolveSystem(int n, double *A, double *b, double *x, double *det)
 	for (int i = 0;i<n;i++) { x[i] = b[p[i]];	for (int j = 0;j<i;j++) x[i] -= A[i*n + j] * x[j]; }
 	for (int i = n - 1;i >= 0;i--) { for (int j = i + 1;j<n;j++) x[i] -= A[i*n + j] * x[j]; x[i] /= A[i*n + i]; }
 	if (det) { *det = 1.0; for (int i = 0;i<n;i++) *det *= A[i*n + i]; if (e & 1) *det *= -1.0; }
-	delete[]p;
+	if (p != pbuf) delete[]p;
 	return true;
 }
 
 
 bool SolveSeries(double *x, double *y, int ndata, double *out, int m)
 {
+	if (m > SERIES_MAX) return false;
 
-	double *v = new double[m];
-	double *q = new double[m];
-	double *M = new double[m*m];
+	//Normal equations of the least squares fit, symmetric positive definite
+	FixedMatrix<SERIES_MAX, SERIES_MAX> M(m, m);
+	FixedVector<SERIES_MAX> v(m), q(m), sol;
 
-	memset(M, 0, m*m * sizeof(double));
-	memset(q, 0, m * sizeof(double));
+	M.Zero();
+	q.Zero();
 
 	for (int i = 0;i<ndata;i++) {
 		v[0] = 1.0;
 		for (int f = 1;f<m;f++) v[f] = v[f - 1] * x[i];
-		for (int f = 0;f<m;f++) for (int g = 0;g<m;g++) M[f*m + g] += (v[f] * v[g]);
+		//Lower triangle only, the upper one is mirrored below
+		for (int f = 0;f<m;f++) for (int g = 0;g<=f;g++) M(f, g) += (v[f] * v[g]);
 		for (int f = 0;f<m;f++) q[f] += (v[f] * y[i]);
 	}
+	for (int f = 0;f<m;f++) for (int g = f + 1;g<m;g++) M(f, g) = M(g, f);
 
-	bool bRet = SolveSystem(m, M, q, out, NULL);
-	delete[]v; delete[]q; delete[]M;
-	return bRet;
+	if (FixedLinAlg::SolveSymmetric(M, q, sol) == false) return false;
+	for (int f = 0;f<m;f++) out[f] = sol[f];
+	return true;
 }
 
 void RotatePerigeeToSpecifiedLongitude(VECTOR3 R, VECTOR3 V, double mjd, OBJHANDLE plan, double lng_des, int N, double mu, double &dv, double &dTIG, double &dt)
@@ -7356,7 +7801,9 @@ void PMMAEG::CALL(AEGHeader &header, AEGDataBlock &in, AEGDataBlock &out)
 	}
 	out.ENTRY = 1;
 
-	double dt = in.TE - in.TS;
+	//Not initialized in the declaration, the error exits above jump past it
+	double dt;
+	dt = in.TE - in.TS;
 
 	if (in.TIMA == 0)
 	{
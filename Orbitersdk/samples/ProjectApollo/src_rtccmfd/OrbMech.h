@@ -473,7 +473,10 @@ namespace OrbMech {
 	VECTOR3 CoellipticDV(VECTOR3 R_A2, VECTOR3 R_PC, VECTOR3 V_PC, double mu);
 	VECTOR3 ApplyHorizontalDV(VECTOR3 R, VECTOR3 V, double dv);
 	double QuadraticIterator(int &c, int &s, double &varguess, double *var, double *obj, double obj0, double initstep, double maxstep);
+	//Max order of systems solved without heap allocation
+	const int SERIES_MAX = 30;
 	bool SolveSystem(int n, double *A, double *b, double *x, double *det);
+	//Least squares polynomial fit with m coefficients, m <= SERIES_MAX
 	bool SolveSeries(double *x, double *y, int ndata, double *out, int m);
 	void GetLunarEquatorialCoordinates(double MJD, double &ra, double &dec, double &radius);
 	void EMPToEcl(VECTOR3 R_EMP, VECTOR3 V_EMP, double MJD, VECTOR3 &R_Ecl, VECTOR3 &V_Ecl);
@@ -525,6 +528,29 @@ namespace OrbMech {
 	double stumpS(double z);
 	void f_and_g(double x, double t, double ro, double a, double &f, double &g, double mu);
 	void fDot_and_gDot(double x, double r, double ro, double a, double &fdot, double &gdot, double mu);
+
+	//Batch versions of the conic functions. The states are kept as structure of arrays and the iterations run on blocks of
+	//contiguous lanes with a convergence mask per lane, without branches or transcendental functions in the lane loops, so the
+	//compiler can vectorize them. Each result agrees with the scalar function for that element to rounding.
+	struct ConicBatch
+	{
+		void resize(int n);
+		int size() const { return (int)rx.size(); }
+		void set(int i, VECTOR3 R, VECTOR3 V);
+		void get(int i, VECTOR3 &R, VECTOR3 &V) const;
+
+		std::vector<double> rx, ry, rz, vx, vy, vz;
+	};
+	//stumpC and stumpS for n arguments
+	void stumpCS_batch(int n, const double *z, double *C, double *S);
+	//kepler_U for n states, x holds the initial guesses and returns the universal anomalies
+	void kepler_U_batch(int n, const double *dt, const double *ro, const double *vro, const double *a, double mu, double *x);
+	//Propagates state i of sv0 by dt[i]
+	void rv_from_r0v0_batch(const ConicBatch &sv0, const double *dt, ConicBatch &sv1, double mu);
+	//Propagates one state by n time offsets
+	void rv_from_r0v0_batch(VECTOR3 R0, VECTOR3 V0, int n, const double *dt, ConicBatch &sv1, double mu);
+	//elegant_lambert for n transfers
+	void elegant_lambert_batch(int n, const VECTOR3 *R1, const VECTOR3 *V1, const VECTOR3 *R2, const double *dt, int N, bool prog, double mu, VECTOR3 *V);
 	double atan3(double x, double y);
 	VECTOR3 imulimit(VECTOR3 a);
 	double imulimit(double a);
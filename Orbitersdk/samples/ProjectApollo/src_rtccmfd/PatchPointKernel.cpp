@@ -0,0 +1,284 @@
+/****************************************************************************
+This file is part of Project Apollo - NASSP
+
+Patch Point Kernel
+
+Project Apollo is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+Project Apollo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Project Apollo; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+See http://nassp.sourceforge.net/license/ for more details.
+
+**************************************************************************/
+
+#include <cmath>
+#include "PatchPointKernel.h"
+#include "OrbMech.h"
+
+const double MoonStateSpline::NodeSpacing = 3600.0;
+const int MoonStateSpline::MaxNodes = 24 * 60;
+
+MoonStateSpline::MoonStateSpline()
+{
+	Clear();
+}
+
+void MoonStateSpline::SetSource(MoonStateSource src)
+{
+	source = src;
+	Clear();
+}
+
+void MoonStateSpline::Clear()
+{
+	GMT_first = 0.0;
+	R.clear();
+	V.clear();
+	SourceCalls = 0;
+}
+
+bool MoonStateSpline::Sample(double GMT, VECTOR3 &R_EM, VECTOR3 &V_EM)
+{
+	if (!source) return true;
+	SourceCalls++;
+	return source(GMT, R_EM, V_EM);
+}
+
+bool MoonStateSpline::Extend(double GMT)
+{
+	VECTOR3 R_EM, V_EM;
+	int k, n, i;
+
+	if (!std::isfinite(GMT)) return true;
+
+	if (R.empty())
+	{
+		GMT_first = floor(GMT / NodeSpacing)*NodeSpacing;
+		if (Sample(GMT_first, R_EM, V_EM)) return true;
+		R.push_back(R_EM);
+		V.push_back(V_EM);
+	}
+
+	k = (int)floor((GMT - GMT_first) / NodeSpacing);
+	//Too far away to add nodes for it
+	if (k < 0 ? (int)R.size() - k > MaxNodes : k + 2 > MaxNodes) return true;
+
+	//Nodes ahead of the first one
+	if (k < 0)
+	{
+		std::vector<VECTOR3> R_new(-k), V_new(-k);
+
+		for (i = 0;i < -k;i++)
+		{
+			if (Sample(GMT_first + (double)(k + i)*NodeSpacing, R_new[i], V_new[i])) return true;
+		}
+		R.insert(R.begin(), R_new.begin(), R_new.end());
+		V.insert(V.begin(), V_new.begin(), V_new.end());
+		GMT_first += (double)k*NodeSpacing;
+		k = 0;
+	}
+	//Nodes behind the last one
+	n = (int)R.size();
+	for (i = n;i <= k + 1;i++)
+	{
+		if (Sample(GMT_first + (double)i*NodeSpacing, R_EM, V_EM)) return true;
+		R.push_back(R_EM);
+		V.push_back(V_EM);
+	}
+	return false;
+}
+
+bool MoonStateSpline::Build(double GMT0, double GMT1)
+{
+	if (Extend(GMT0)) return true;
+	return Extend(GMT1);
+}
+
+bool MoonStateSpline::Evaluate(double GMT, VECTOR3 &R_EM, VECTOR3 &V_EM)
+{
+	double s, s2, s3, h00, h10, h01, h11, d00, d10, d01, d11;
+	int k;
+
+	if (Extend(GMT))
+	{
+		//Outside of the spline
+		return Sample(GMT, R_EM, V_EM);
+	}
+
+	k = (int)floor((GMT - GMT_first) / NodeSpacing);
+	s = (GMT - GMT_first) / NodeSpacing - (double)k;
+	s2 = s * s;
+	s3 = s2 * s;
+
+	//Hermite basis functions and their derivatives
+	h00 = 2.0*s3 - 3.0*s2 + 1.0;
+	h10 = s3 - 2.0*s2 + s;
+	h01 = -2.0*s3 + 3.0*s2;
+	h11 = s3 - s2;
+	d00 = 6.0*(s2 - s);
+	d10 = 3.0*s2 - 4.0*s + 1.0;
+	d01 = -d00;
+	d11 = 3.0*s2 - 2.0*s;
+
+	R_EM = R[k] * h00 + V[k] * (h10*NodeSpacing) + R[k + 1] * h01 + V[k + 1] * (h11*NodeSpacing);
+	V_EM = (R[k] * d00 + R[k + 1] * d01) / NodeSpacing + V[k] * d10 + V[k + 1] * d11;
+	return false;
+}
+
+//The old PATCH loop stopped after 10 evaluations. From a good first guess the kernel converges in far fewer,
+//but the steps are limited until the root is bracketed and bisection then gains one bit per step. With a first guess
+//of half the true beta, 10 evaluations leave about 5% of the cases of patchpoint_bench unconverged, while 20
+//converge all of them. As the Moon comes from the spline, the extra steps cost no ephemeris calls.
+const int PatchPointKernel::MaxIter = 20;
+const double PatchPointKernel::Tolerance = 10e-12;
+
+PatchPointKernel::PatchPointKernel(MoonStateSpline &moon) : Moon(moon)
+{
+	GMT0 = r0 = sigma0 = ainv = sqrt_mu = 0.0;
+	iter = 0;
+	DRatio = 0.0;
+}
+
+void PatchPointKernel::Conic(double beta, VECTOR3 &R, VECTOR3 &V, double &GMT) const
+{
+	double a, F1, F2, F3, F4, t, r, f, g, fdot, gdot;
+
+	a = -beta * beta*ainv;
+	F1 = OrbMech::stumpS(-a);
+	F2 = OrbMech::stumpC(-a);
+	F3 = a * F1 + 1.0;
+	F4 = a * F2 + 1.0;
+
+	t = (beta*beta*F1 + sigma0 * beta*F2 + r0 * F3)*beta / sqrt_mu;
+	GMT = GMT0 + t;
+	r = (sigma0*F3 + beta * F2)*beta + r0 * F4;
+	f = 1.0 - beta * beta*F2 / r0;
+	g = t - beta * beta*beta*F1 / sqrt_mu;
+	fdot = -sqrt_mu * beta*F3 / (r0 * r);
+	gdot = 1.0 - beta * beta*F2 / r;
+	R = R0 * f + V0 * g;
+	V = R0 * fdot + V0 * gdot;
+}
+
+bool PatchPointKernel::Solve(VECTOR3 R0, VECTOR3 V0, double GMT0, double beta, int KREF, double mu1, double mu2, double Ratio_desired, VECTOR3 &R2, VECTOR3 &V2, double &GMT2)
+{
+	VECTOR3 R1, V1, R_EM, V_EM, R21, A2;
+	double GMTF, r1, r2, r21, d1, d2, v12, v22, Ratio, DRatioDBeta, DDRatioDDBeta, disc, dbeta, beta_new, DRatio_last;
+	double beta_lo = 0.0, beta_hi = 0.0, lo, hi, dbeta_max;
+	bool has_lo = false, has_hi = false;
+
+	this->R0 = R0;
+	this->V0 = V0;
+	this->GMT0 = GMT0;
+	r0 = length(R0);
+	sqrt_mu = sqrt(mu1);
+	sigma0 = dotp(R0, V0) / sqrt_mu;
+	ainv = 2.0 / r0 - dotp(V0, V0) / mu1;
+	iter = 0;
+	DRatio = DRatio_last = 0.0;
+	dbeta_max = beta != 0.0 ? fabs(beta) : sqrt(r0);
+
+	while (true)
+	{
+		Conic(beta, R1, V1, GMTF);
+		if (Moon.Evaluate(GMTF, R_EM, V_EM))
+		{
+			return true;
+		}
+		if (KREF == 1)
+		{
+			R2 = R1 - R_EM;
+			V2 = V1 - V_EM;
+			R21 = R_EM;
+		}
+		else
+		{
+			R2 = R1 + R_EM;
+			V2 = V1 + V_EM;
+			R21 = -R_EM;
+		}
+		GMT2 = GMTF;
+		r1 = length(R1);
+		r2 = length(R2);
+		Ratio = r2 / r1;
+		DRatio = Ratio_desired - Ratio;
+		if (!std::isfinite(DRatio))
+		{
+			return true;
+		}
+		//Like the RTCC, the last state is used if the iteration limit is reached
+		if (fabs(DRatio) < Tolerance || iter >= MaxIter)
+		{
+			return false;
+		}
+
+		//Bracket. The ratio is below the desired one at beta_lo and above it at beta_hi.
+		if (DRatio > 0.0)
+		{
+			beta_lo = beta;
+			has_lo = true;
+		}
+		else
+		{
+			beta_hi = beta;
+			has_hi = true;
+		}
+
+		//Second order step
+		r21 = length(R21);
+		d1 = dotp(R1, V1);
+		d2 = dotp(R2, V2);
+		v12 = dotp(V1, V1);
+		v22 = dotp(V2, V2);
+		A2 = -R1 * mu1 / (r1*r1*r1) + R21 * (mu1 + mu2) / (r21*r21*r21);
+		DRatioDBeta = 1.0 / r2 / sqrt_mu * (d2 - r2 * r2*d1 / r1 / r1);
+		DDRatioDDBeta = r1 / mu1 * (v22 + dotp(R2, A2)) / r2 - d1 * d2 / (mu1*r1*r2) - d2 * d2*r1 / (mu1*r2*r2*r2) - r2 * v12 / r1 / mu1 + r2 / r1 / r1 + 2.0*d1*d1*r2 / (mu1*r1*r1*r1);
+		disc = DRatioDBeta * DRatioDBeta + 2.0*DRatio*DDRatioDDBeta;
+		if (disc < 0.0)
+		{
+			disc = DRatioDBeta * DRatioDBeta;
+		}
+		dbeta = 2.0*DRatio / (DRatioDBeta + (DRatioDBeta >= 0.0 ? 1.0 : -1.0)*sqrt(disc));
+		beta_new = beta + dbeta;
+
+		if (has_lo && has_hi)
+		{
+			lo = beta_lo < beta_hi ? beta_lo : beta_hi;
+			hi = beta_lo < beta_hi ? beta_hi : beta_lo;
+			if (hi - lo <= 1e-15*fabs(beta))
+			{
+				return false;
+			}
+			if (!std::isfinite(beta_new) || beta_new <= lo || beta_new >= hi || (iter > 0 && fabs(DRatio) > 0.5*fabs(DRatio_last)))
+			{
+				beta_new = 0.5*(lo + hi);
+			}
+		}
+		else
+		{
+			if (!std::isfinite(dbeta))
+			{
+				return true;
+			}
+			//Steps no larger than the first guess until the root is bracketed
+			if (fabs(dbeta) > dbeta_max)
+			{
+				beta_new = beta + (dbeta > 0.0 ? dbeta_max : -dbeta_max);
+			}
+		}
+
+		DRatio_last = DRatio;
+		beta = beta_new;
+		iter++;
+	}
+}
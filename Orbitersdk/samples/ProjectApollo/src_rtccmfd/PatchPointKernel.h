@@ -0,0 +1,98 @@
+/****************************************************************************
+This file is part of Project Apollo - NASSP
+
+Patch Point Kernel (Header)
+
+Project Apollo is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+Project Apollo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Project Apollo; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+See http://nassp.sourceforge.net/license/ for more details.
+
+**************************************************************************/
+
+#pragma once
+
+#include <functional>
+#include <vector>
+#include "Orbitersdk.h"
+
+//Moon position (m) and velocity (m/s) relative to the Earth at GMT (s). Returns true on error
+typedef std::function<bool(double GMT, VECTOR3 &R_EM, VECTOR3 &V_EM)> MoonStateSource;
+
+//Moon state as a cubic Hermite spline through the positions and velocities of the source on nodes one hour apart.
+//Each node is sampled once, the first time a time next to it is needed, so a trajectory costs one source call per
+//hour of its time span. The interpolation error is in the order of a centimeter.
+class MoonStateSpline
+{
+public:
+	MoonStateSpline();
+	//Removes all nodes and sets the source
+	void SetSource(MoonStateSource src);
+	void Clear();
+	//Samples all nodes from GMT0 to GMT1 ahead of time. Returns true on error
+	bool Build(double GMT0, double GMT1);
+	//Moon state at GMT. Returns true on error
+	bool Evaluate(double GMT, VECTOR3 &R_EM, VECTOR3 &V_EM);
+
+	int GetNumNodes() const { return (int)R.size(); }
+	int GetSourceCalls() const { return SourceCalls; }
+
+	//Time between nodes, s
+	static const double NodeSpacing;
+	//Largest number of nodes. Times beyond that are taken directly from the source.
+	static const int MaxNodes;
+protected:
+	//Makes the nodes cover the interval around GMT. Returns true on error or if that needs too many nodes
+	bool Extend(double GMT);
+	bool Sample(double GMT, VECTOR3 &R_EM, VECTOR3 &V_EM);
+
+	MoonStateSource source;
+	//GMT of the first node
+	double GMT_first;
+	std::vector<VECTOR3> R, V;
+	int SourceCalls;
+};
+
+//Patch point between the Earth and Moon spheres of influence on a conic, the point where the ratio of the
+//distances to both bodies reaches a given value. The conic is propagated in closed form with the universal
+//anomaly beta, with the quantities of the initial state computed once. The root of the distance ratio is
+//found with the second order step of the RTCC patching routine, safeguarded by a bracket: a step that
+//leaves the bracket or does not halve the error is replaced by bisection.
+class PatchPointKernel
+{
+public:
+	PatchPointKernel(MoonStateSpline &moon);
+
+	//R0, V0 and GMT0 are the state relative to body 1, KREF = 1 for the Earth and 2 for the Moon. beta is the
+	//first guess. Returns the state at the patch point relative to body 2. Returns true on error
+	bool Solve(VECTOR3 R0, VECTOR3 V0, double GMT0, double beta, int KREF, double mu1, double mu2, double Ratio_desired, VECTOR3 &R2, VECTOR3 &V2, double &GMT2);
+
+	int GetIterations() const { return iter; }
+	//Distance ratio error of the last solution
+	double GetError() const { return DRatio; }
+
+	static const int MaxIter;
+	static const double Tolerance;
+protected:
+	//State on the conic at beta
+	void Conic(double beta, VECTOR3 &R, VECTOR3 &V, double &GMT) const;
+
+	MoonStateSpline &Moon;
+	//Initial state and its conic quantities
+	VECTOR3 R0, V0;
+	//sigma0 = dotp(R0, V0) / sqrt(mu)
+	double GMT0, r0, sigma0, ainv, sqrt_mu;
+	int iter;
+	double DRatio;
+};
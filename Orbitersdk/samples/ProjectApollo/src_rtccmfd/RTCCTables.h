@@ -25,6 +25,7 @@
 #pragma once
 
 #include <vector>
+#include <string>
 #include "Orbitersdk.h"
 
 struct EphemerisData
@@ -344,6 +345,11 @@ struct RMMYNIInputTable
 	double RLDIR = 1.0;
 	//Time to reverse bank angle
 	double t_RB = 0.0;
+	//Factors on atmosphere density and lift coefficient, for dispersion studies
+	double DensityFactor = 1.0;
+	double LiftFactor = 1.0;
+	//Error tolerance (m) of the adaptive step in the phases without guidance. 0 = fixed step
+	double ErrorTolerance = 0.0;
 };
 
 struct RMMYNIOutputTable
@@ -358,10 +364,74 @@ struct RMMYNIOutputTable
 	double t_gc = 0.0;
 	double gmax = 0.0;
 	double t_gmax = 0.0;
+	//Maximum stagnation point heating rate (W/m^2) and heat load (J/m^2)
+	double qmax = 0.0;
+	double Q = 0.0;
 	//1 = time limit, 2 = impact, 3 = skipout
 	int IEND;
 };
 
+struct EntryDispersionInputTable
+{
+	//Nominal entry
+	RMMYNIInputTable Nominal;
+	//Number of cases
+	int Cases = 1000;
+	//Seed of the random numbers, the same seed gives the same cases
+	unsigned Seed = 1;
+	//1 sigma of the atmosphere density and lift coefficient factors
+	double DensitySigma = 0.1;
+	double LiftSigma = 0.05;
+	//1 sigma of the entry interface flight-path angle (rad)
+	double FPASigma = 0.05*RAD;
+	//1 sigma of the target north and east (m)
+	double TargetSigma = 0.0;
+	//Modes flown with equal probability, the nominal mode if empty
+	std::vector<int> Modes;
+	//Error tolerance of the adaptive step (m)
+	double ErrorTolerance = 1.0;
+	//0 = all hardware threads
+	unsigned MaxThreads = 0;
+};
+
+struct EntryDispersionCase
+{
+	double DensityFactor;
+	double LiftFactor;
+	double dFPA;
+	double lat_T, lng_T;
+	int KSWCH;
+	RMMYNIOutputTable out;
+};
+
+struct EntryDispersionStatistics
+{
+	double mean = 0.0;
+	double sigma = 0.0;
+	double max = 0.0;
+};
+
+struct EntryDispersionOutputTable
+{
+	std::vector<EntryDispersionCase> Cases;
+	//Number of impacts, skipouts and cases stopped by the time limit
+	int Impacts = 0;
+	int Skipouts = 0;
+	int TimeLimits = 0;
+	//Footprint of the impacts: mean impact point, 1 sigma north and east of it (m), largest distance from it (m)
+	double lat_mean = 0.0;
+	double lng_mean = 0.0;
+	double sigma_north = 0.0;
+	double sigma_east = 0.0;
+	double maxmiss = 0.0;
+	//Distance of the impacts from their target (m), G&N cases only
+	EntryDispersionStatistics TargetMiss;
+	//Maximum g, maximum heating rate (W/m^2) and heat load (J/m^2) of the impacts
+	EntryDispersionStatistics gmax;
+	EntryDispersionStatistics qmax;
+	EntryDispersionStatistics Q;
+};
+
 struct ReentryConstraintsTable
 {
 	//R31
@@ -101,6 +101,9 @@ void ReentryNumericalIntegrator::Main(const RMMYNIInputTable &in, RMMYNIOutputTa
 	H_EMS = in.H_EMS;
 	K1 = in.K1;
 	K2 = in.K2;
+	DensityFactor = in.DensityFactor;
+	LiftFactor = in.LiftFactor;
+	TOL = in.ErrorTolerance;
 	EphemerisBuildInd = false; //TBD
 
 	gmax = 0;
@@ -114,6 +117,9 @@ void ReentryNumericalIntegrator::Main(const RMMYNIInputTable &in, RMMYNIOutputTa
 	TE = STEP;
 	IREVBANK = false;
 	EPS = 1e-14*3600.0;
+	HADAPT = STEP;
+	qdot = qmax = HeatingRate(R_cur, V_cur);
+	Q = 0.0;
 
 	//Null output table
 	out.lat_IP = 0.0;
@@ -125,7 +131,8 @@ void ReentryNumericalIntegrator::Main(const RMMYNIInputTable &in, RMMYNIOutputTa
 	out.t_drogue = 0.0;
 	out.t_main = 0.0;
 
-	double v, fpa;
+	double v, fpa, qdot_new;
+	bool adaptive;
 
 	IEND = 0;
 
@@ -137,6 +144,11 @@ void ReentryNumericalIntegrator::Main(const RMMYNIInputTable &in, RMMYNIOutputTa
 	do
 	{
 		//Determine next step
+		adaptive = TOL > 0.0 && IsAdaptiveStepPhase();
+		if (adaptive)
+		{
+			TE = T + AdaptiveStepLimit();
+		}
 		if (EphemerisBuildInd)
 		{
 			//Should we store ephemeris?
@@ -164,7 +176,15 @@ void ReentryNumericalIntegrator::Main(const RMMYNIInputTable &in, RMMYNIOutputTa
 
 		DT = TE - T;
 
-		RungeKuttaIntegrationRoutine(R_prev, V_prev, DT, R_cur, V_cur);
+		if (adaptive)
+		{
+			DT = AdaptiveIntegrationRoutine(R_prev, V_prev, DT, R_cur, V_cur);
+			TE = T + DT;
+		}
+		else
+		{
+			RungeKuttaIntegrationRoutine(R_prev, V_prev, DT, R_cur, V_cur);
+		}
 		T += DT;
 
 		//Switch to reverse bank angle?
@@ -180,7 +200,15 @@ void ReentryNumericalIntegrator::Main(const RMMYNIInputTable &in, RMMYNIOutputTa
 		v = length(V_cur);
 		fpa = asin(dotp(unit(R_cur), unit(V_cur)))*DEG;
 		CalculateDragAcceleration(R_cur, V_cur);
-		
+
+		//Heating
+		qdot_new = HeatingRate(R_cur, V_cur);
+		Q += (qdot + qdot_new) / 2.0*DT;
+		qdot = qdot_new;
+		if (qdot > qmax)
+		{
+			qmax = qdot;
+		}
 
 		//Configuration changes
 		if (droguedeployed == false && alt < 23500.0*0.3048)
@@ -239,6 +267,8 @@ void ReentryNumericalIntegrator::Main(const RMMYNIInputTable &in, RMMYNIOutputTa
 		}
 		out.t_gmax = GMT0+ t_gmax;
 		out.gmax = gmax;
+		out.qmax = qmax;
+		out.Q = Q;
 		if (droguedeployed)
 		{
 			out.t_drogue = GMT0 + t_drogue;
@@ -272,6 +302,86 @@ void ReentryNumericalIntegrator::RungeKuttaIntegrationRoutine(VECTOR3 R_N, VECTO
 	//V_EMS1 = V_EMS + (K1EMS + K2EMS * 2.0 + K3EMS * 2.0 + K4EMS) / 6.0;
 }
 
+bool ReentryNumericalIntegrator::IsAdaptiveStepPhase()
+{
+	//The guidance is sampled every step, so while it can act on the trajectory the step stays at the guidance cycle. The
+	//descent on the parachutes is stiff, the normal step is already close to the largest stable one. That leaves the coast
+	//before the atmosphere is felt.
+	return droguedeployed == false && K05G == false && KGC == false && A_X < 0.01*9.80665 && A_X < g_c_BU*9.80665;
+}
+
+double ReentryNumericalIntegrator::AdaptiveStepLimit()
+{
+	double alt, rdot, dt;
+
+	alt = length(R_cur) - OrbMech::R_Earth;
+	rdot = dotp(unit(R_cur), V_cur);
+	dt = 60.0;
+
+	if (rdot < 0.0 && alt < 400000.0*0.3048)
+	{
+		//In the atmosphere descend by at most one scale height per step
+		dt = min(dt, HS / (-rdot));
+	}
+	return max(dt, STEP);
+}
+
+double ReentryNumericalIntegrator::AdaptiveIntegrationRoutine(VECTOR3 R_N, VECTOR3 V_N, double dtmax, VECTOR3 &R_N1, VECTOR3 &V_N1)
+{
+	VECTOR3 R1, V1, R2, V2, R_M, V_M;
+	double dt, err, Bank0;
+
+	//Step doubling: one step compared to two half steps gives the error of the latter
+	Bank0 = Bank;
+	while (true)
+	{
+		dt = min(HADAPT, dtmax);
+
+		Bank = Bank0;
+		RungeKuttaIntegrationRoutine(R_N, V_N, dt, R1, V1);
+		Bank = Bank0;
+		RungeKuttaIntegrationRoutine(R_N, V_N, dt / 2.0, R_M, V_M);
+		RungeKuttaIntegrationRoutine(R_M, V_M, dt / 2.0, R2, V2);
+		err = length(R2 - R1) / 15.0;
+
+		if (err <= TOL || dt <= 0.1)
+		{
+			break;
+		}
+		HADAPT = dt * max(0.2, 0.9*pow(TOL / err, 0.2));
+	}
+
+	if (err > 0.0)
+	{
+		HADAPT = dt * min(4.0, 0.9*pow(TOL / err, 0.2));
+	}
+	else
+	{
+		HADAPT = dt * 4.0;
+	}
+
+	R_N1 = R2;
+	V_N1 = V2;
+	return dt;
+}
+
+double ReentryNumericalIntegrator::HeatingRate(VECTOR3 R, VECTOR3 V)
+{
+	//Sutton-Graves stagnation point heating, with the radius of the CM heat shield
+	const double K_SG = 1.7415e-4;
+	const double R_NOSE = 4.694;
+	VECTOR3 V_rel;
+	double alt, rho, spos, v;
+
+	alt = length(R) - OrbMech::R_Earth;
+	pRTCC->GLFDEN(alt, rho, spos);
+	rho *= DensityFactor;
+
+	V_rel = _V(V.x + R.y*OrbMech::w_Earth, V.y - R.x*OrbMech::w_Earth, V.z);
+	v = length(V_rel);
+	return K_SG * sqrt(rho / R_NOSE)*v*v*v;
+}
+
 VECTOR3 ReentryNumericalIntegrator::SecondDerivativeRoutine(VECTOR3 R, VECTOR3 V)
 {
 	double AOA;
@@ -298,6 +408,7 @@ VECTOR3 ReentryNumericalIntegrator::LiftDragAcceleration(VECTOR3 R, VECTOR3 V, d
 
 	alt = length(R) - OrbMech::R_Earth;
 	pRTCC->GLFDEN(alt, rho, spos);
+	rho *= DensityFactor;
 
 	V_R.x = V.x + R.y*OrbMech::w_Earth;
 	V_R.y = V.y - R.x*OrbMech::w_Earth;
@@ -309,6 +420,7 @@ VECTOR3 ReentryNumericalIntegrator::LiftDragAcceleration(VECTOR3 R, VECTOR3 V, d
 
 	mach = v_R / spos;
 	CalculateLiftDrag(mach, C_L, C_D, AOA);
+	C_L *= LiftFactor;
 
 	A_D = -V_R * 0.5*C_D*rho*N*v_R;
 	A_L = (p_apo*cos(Bank) + h_apo * sin(Bank))*0.5*C_L*rho*N*v_R*v_R; //changed from -sin(Bank)
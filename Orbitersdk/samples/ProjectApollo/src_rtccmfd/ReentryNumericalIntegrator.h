@@ -218,6 +218,10 @@ public:
 	void Main(const RMMYNIInputTable &in, RMMYNIOutputTable &out);
 protected:
 	void RungeKuttaIntegrationRoutine(VECTOR3 R_N, VECTOR3 V_N, double dt, VECTOR3 &R_N1, VECTOR3 &V_N1);
+	bool IsAdaptiveStepPhase();
+	double AdaptiveStepLimit();
+	double AdaptiveIntegrationRoutine(VECTOR3 R_N, VECTOR3 V_N, double dtmax, VECTOR3 &R_N1, VECTOR3 &V_N1);
+	double HeatingRate(VECTOR3 R, VECTOR3 V);
 	VECTOR3 SecondDerivativeRoutine(VECTOR3 R, VECTOR3 V);
 	VECTOR3 GravityAcceleration(VECTOR3 R);
 	VECTOR3 LiftDragAcceleration(VECTOR3 R, VECTOR3 V, double &AOA);
@@ -313,6 +317,14 @@ protected:
 	//Reverse bank angle implemented
 	bool IREVBANK;
 	double EPS;
+	//Error tolerance of the adaptive step, 0 = fixed step
+	double TOL;
+	//Next adaptive step size
+	double HADAPT;
+	//Dispersion factors
+	double DensityFactor, LiftFactor;
+	//Stagnation point heating rate, its maximum and the heat load
+	double qdot, qmax, Q;
 
 	//Parameters for constant G and G&N
 	double VSAT;
@@ -0,0 +1,179 @@
+/****************************************************************************
+This file is part of Project Apollo - NASSP
+
+Chebyshev Sun/Moon Ephemeris
+
+Project Apollo is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+Project Apollo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Project Apollo; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+See http://nassp.sourceforge.net/license/ for more details.
+
+**************************************************************************/
+
+#include "SunMoonEphemeris.h"
+#include "OrbMech.h"
+
+const double SunMoonEphemeris::MoonSegmentLength = 4.0;
+const double SunMoonEphemeris::SunSegmentLength = 8.0;
+
+SunMoonEphemeris::SunMoonEphemeris()
+{
+	Clear();
+}
+
+void SunMoonEphemeris::Clear()
+{
+	MJD0 = MJD1 = 0.0;
+	NumMoonSegments = NumSunSegments = 0;
+	MoonCoeff.clear();
+	SunCoeff.clear();
+}
+
+bool SunMoonEphemeris::Generate(double MJD_start, double MJD_end)
+{
+	Clear();
+
+	if (MJD_end <= MJD_start) return true;
+	if (oapiGetObjectByName("Moon") == NULL || oapiGetObjectByName("Earth") == NULL) return true;
+
+	NumMoonSegments = (int)ceil((MJD_end - MJD_start) / MoonSegmentLength);
+	NumSunSegments = (int)ceil((MJD_end - MJD_start) / SunSegmentLength);
+
+	MoonCoeff.resize(NumMoonSegments * 3 * CHEBY_EPHEM_NUMCOEFF);
+	SunCoeff.resize(NumSunSegments * 3 * CHEBY_EPHEM_NUMCOEFF);
+
+	for (int i = 0;i < NumMoonSegments;i++)
+	{
+		FitSegment(0, MJD_start + MoonSegmentLength * (double)i, MoonSegmentLength, &MoonCoeff[i * 3 * CHEBY_EPHEM_NUMCOEFF]);
+	}
+	for (int i = 0;i < NumSunSegments;i++)
+	{
+		FitSegment(1, MJD_start + SunSegmentLength * (double)i, SunSegmentLength, &SunCoeff[i * 3 * CHEBY_EPHEM_NUMCOEFF]);
+	}
+
+	MJD0 = MJD_start;
+	MJD1 = MJD_end;
+
+	return false;
+}
+
+bool SunMoonEphemeris::IsCovered(double MJD) const
+{
+	return (NumMoonSegments > 0 && MJD >= MJD0 && MJD <= MJD1);
+}
+
+bool SunMoonEphemeris::Evaluate(double MJD, VECTOR3 &R_EM, VECTOR3 &V_EM, VECTOR3 &R_ES) const
+{
+	double dt, x, val[3], dval[3];
+	int i;
+
+	if (IsCovered(MJD) == false) return true;
+
+	dt = MJD - MJD0;
+
+	//Moon, position and velocity from the same coefficients
+	i = (int)(dt / MoonSegmentLength);
+	if (i >= NumMoonSegments) i = NumMoonSegments - 1;
+	x = 2.0*(dt - MoonSegmentLength * (double)i) / MoonSegmentLength - 1.0;
+	Clenshaw(&MoonCoeff[i * 3 * CHEBY_EPHEM_NUMCOEFF], x, val, dval);
+	R_EM = _V(val[0], val[1], val[2]);
+	//dx/dt is 2/length, converted from per day to per hour
+	V_EM = _V(dval[0], dval[1], dval[2])*2.0 / (MoonSegmentLength*24.0);
+
+	//Sun, position only
+	i = (int)(dt / SunSegmentLength);
+	if (i >= NumSunSegments) i = NumSunSegments - 1;
+	x = 2.0*(dt - SunSegmentLength * (double)i) / SunSegmentLength - 1.0;
+	Clenshaw(&SunCoeff[i * 3 * CHEBY_EPHEM_NUMCOEFF], x, val, dval);
+	R_ES = _V(val[0], val[1], val[2]);
+
+	return false;
+}
+
+void SunMoonEphemeris::FitSegment(int body, double MJD_seg, double length, double *coeff)
+{
+	const int N = CHEBY_EPHEM_NUMCOEFF;
+	VECTOR3 F[N];
+	double x_j, fac;
+	int j, k, l;
+
+	//Sample at the Chebyshev nodes of the segment
+	for (j = 0;j < N;j++)
+	{
+		x_j = cos(PI*((double)j + 0.5) / (double)N);
+		F[j] = SampleBody(body, MJD_seg + 0.5*(x_j + 1.0)*length);
+	}
+
+	//Discrete Chebyshev transform, exact interpolation at the nodes
+	for (l = 0;l < 3;l++)
+	{
+		for (k = 0;k < N;k++)
+		{
+			coeff[l * N + k] = 0.0;
+			for (j = 0;j < N;j++)
+			{
+				coeff[l * N + k] += F[j].data[l] * cos(PI*(double)k*((double)j + 0.5) / (double)N);
+			}
+			fac = (k == 0) ? 1.0 : 2.0;
+			coeff[l * N + k] *= fac / (double)N;
+		}
+	}
+}
+
+void SunMoonEphemeris::Clenshaw(const double *coeff, double x, double *val, double *dval)
+{
+	const int N = CHEBY_EPHEM_NUMCOEFF;
+	double b1[3], b2[3], d1[3], d2[3], b, d;
+	int k, l;
+
+	for (l = 0;l < 3;l++)
+	{
+		b1[l] = b2[l] = d1[l] = d2[l] = 0.0;
+	}
+
+	//All three coordinates in one pass, the derivative follows from differentiating the recurrence
+	for (k = N - 1;k >= 1;k--)
+	{
+		for (l = 0;l < 3;l++)
+		{
+			d = 2.0*b1[l] + 2.0*x*d1[l] - d2[l];
+			b = coeff[l * N + k] + 2.0*x*b1[l] - b2[l];
+			d2[l] = d1[l];
+			d1[l] = d;
+			b2[l] = b1[l];
+			b1[l] = b;
+		}
+	}
+	for (l = 0;l < 3;l++)
+	{
+		val[l] = coeff[l * N] + x * b1[l] - b2[l];
+		dval[l] = b1[l] + x * d1[l] - d2[l];
+	}
+}
+
+VECTOR3 SunMoonEphemeris::SampleBody(int body, double MJD)
+{
+	double Pos[12];
+
+	if (body == 0)
+	{
+		CELBODY *cMoon = oapiGetCelbodyInterface(oapiGetObjectByName("Moon"));
+		cMoon->clbkEphemeris(MJD, EPHEM_TRUEPOS, Pos);
+		return _V(Pos[0], Pos[2], Pos[1]) / OrbMech::R_Earth;
+	}
+
+	CELBODY *cEarth = oapiGetCelbodyInterface(oapiGetObjectByName("Earth"));
+	cEarth->clbkEphemeris(MJD, EPHEM_TRUEPOS | EPHEM_TRUEVEL, Pos);
+	return -OrbMech::Polar2Cartesian(Pos[2] * AU, Pos[1], Pos[0]) / OrbMech::R_Earth;
+}
@@ -0,0 +1,68 @@
+/****************************************************************************
+This file is part of Project Apollo - NASSP
+
+Chebyshev Sun/Moon Ephemeris (Header)
+
+Project Apollo is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+Project Apollo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Project Apollo; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+See http://nassp.sourceforge.net/license/ for more details.
+
+**************************************************************************/
+
+#pragma once
+
+#include <vector>
+#include "Orbitersdk.h"
+
+//Number of Chebyshev coefficients per coordinate and segment
+#define CHEBY_EPHEM_NUMCOEFF 14
+
+//Sun/Moon ephemeris stored as fixed length Chebyshev polynomial segments. The segments are fit to the Orbiter
+//celestial body ephemerides once and then evaluated with a constant time lookup per call.
+class SunMoonEphemeris
+{
+public:
+	SunMoonEphemeris();
+	//Clears all segments
+	void Clear();
+	//Fits segments from MJD_start to MJD_end to the Orbiter ephemerides of the Earth and Moon. Returns true on error
+	bool Generate(double MJD_start, double MJD_end);
+	//Is MJD covered by the ephemeris?
+	bool IsCovered(double MJD) const;
+	//Moon position (Er) and velocity (Er/hr) relative to the Earth and Sun position (Er) relative to the Earth. Returns true on error
+	bool Evaluate(double MJD, VECTOR3 &R_EM, VECTOR3 &V_EM, VECTOR3 &R_ES) const;
+
+	double GetStartMJD() const { return MJD0; }
+	double GetEndMJD() const { return MJD1; }
+
+	//Length of a Moon segment, days
+	static const double MoonSegmentLength;
+	//Length of a Sun segment, days
+	static const double SunSegmentLength;
+protected:
+	//Fits coefficients for one segment of a body. body = 0 for the Moon, 1 for the Sun
+	void FitSegment(int body, double MJD_seg, double length, double *coeff);
+	//Evaluates one coordinate set and its derivative with respect to the normalized time
+	static void Clenshaw(const double *coeff, double x, double *val, double *dval);
+	//Samples the Orbiter ephemeris of a body, in Er
+	VECTOR3 SampleBody(int body, double MJD);
+
+	//First and last MJD of the ephemeris
+	double MJD0, MJD1;
+	int NumMoonSegments, NumSunSegments;
+	//Coefficients, [segment][coordinate][coefficient]
+	std::vector<double> MoonCoeff;
+	std::vector<double> SunCoeff;
+};
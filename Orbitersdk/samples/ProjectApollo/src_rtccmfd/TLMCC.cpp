@@ -21,10 +21,14 @@ See http://nassp.sourceforge.net/license/ for more details.
 
 **************************************************************************/
 
+#include <cmath>
+#include <chrono>
+#include <algorithm>
 #include "OrbMech.h"
 #include "GeneralizedIterator.h"
 #include "rtcc.h"
 #include "TLMCC.h"
+#include "WorkerPool.h"
 
 TLMCCProcessor::TLMCCProcessor(RTCC *r) : RTCCModule(r)
 {
@@ -36,6 +40,7 @@ TLMCCProcessor::TLMCCProcessor(RTCC *r) : RTCCModule(r)
 	Reentry_dt = 500.0;
 	isp_SPS = 3080.0;
 	isp_DPS = 3107.0;
+	IterError = false;
 }
 
 void TLMCCProcessor::Init(TLMCCDataTable data, TLMCCMEDQuantities med, TLMCCMissionConstants cst)
@@ -48,6 +53,8 @@ void TLMCCProcessor::Init(TLMCCDataTable data, TLMCCMEDQuantities med, TLMCCMiss
 	outarray.sv_loi.RBI = BODY_MOON;
 	outarray.SGSLOI.RBI = BODY_MOON;
 	outarray.sv_lls2.RBI = BODY_MOON;
+	IterError = false;
+	MoonSpline.SetSource([this](double GMT, VECTOR3 &R_EM, VECTOR3 &V_EM) { VECTOR3 R_ES; return EPHEM(GMT, R_EM, V_EM, R_ES); });
 }
 
 void TLMCCProcessor::Main(TLMCCOutputData &out)
@@ -302,6 +309,81 @@ void TLMCCProcessor::Main(TLMCCOutputData &out)
 	out.outtab = outtab;
 }
 
+void TLMCCProcessor::SCAN(const TLMCCScanSettings &set, TLMCCScanTable &tab)
+{
+	int nmode, ntime, n, i;
+
+	auto t0 = std::chrono::steady_clock::now();
+
+	tab = TLMCCScanTable();
+	nmode = set.MODES.size();
+	ntime = set.T_MCC.size();
+	n = nmode * ntime;
+	if (n == 0) return;
+
+	//The processor only reads from the RTCC, which makes the options independent of each other
+	tab.Points.resize(n);
+	WorkerPool::ParallelFor(n, [&](int k)
+	{
+		TLMCCScanPoint &p = tab.Points[k];
+		TLMCCMEDQuantities med = set.MED;
+		TLMCCProcessor proc(pRTCC);
+
+		p.Mode = set.MODES[k / ntime];
+		p.T_MCC = set.T_MCC[k % ntime];
+		med.Mode = p.Mode;
+		med.T_MCC = p.T_MCC;
+
+		proc.Init(set.DataTable, med, set.Constants);
+		proc.Main(p.out);
+
+		p.DV_MCC = length(p.out.display.DV_MCC);
+		p.DV_LOI = length(p.out.display.DV_LOI);
+		p.DV_LOPC = length(p.out.display.DV_LOPC);
+		p.DV_TEI = length(p.out.display.DV_TEI);
+		p.DV_TOTAL = p.DV_MCC + p.DV_LOI + p.DV_LOPC + p.DV_TEI;
+		p.Error = proc.IterError || !std::isfinite(p.DV_TOTAL);
+
+		//Landing site modes
+		if (p.Mode >= 2 && p.Mode <= 5)
+		{
+			p.AZ_act = p.out.display.AZ_act;
+			if (p.AZ_act < p.out.display.AZ_min)
+			{
+				p.DAZ = p.out.display.AZ_min - p.AZ_act;
+			}
+			else if (p.AZ_act > p.out.display.AZ_max)
+			{
+				p.DAZ = p.AZ_act - p.out.display.AZ_max;
+			}
+		}
+	}, set.MaxThreads);
+
+	tab.Ranking.resize(n);
+	for (i = 0;i < n;i++)
+	{
+		tab.Ranking[i] = i;
+		if (tab.Points[i].Error) tab.Failed++;
+		else tab.Solved++;
+	}
+	//0 = converged and within the azimuth limits, 1 = outside of them, 2 = failed
+	auto group = [&](const TLMCCScanPoint &p) { return p.Error ? 2 : (p.DAZ > 0.01*RAD ? 1 : 0); };
+	std::stable_sort(tab.Ranking.begin(), tab.Ranking.end(), [&](int a, int b)
+	{
+		const TLMCCScanPoint &pa = tab.Points[a], &pb = tab.Points[b];
+		if (group(pa) != group(pb)) return group(pa) < group(pb);
+		//Failed options can have no DV at all, they stay in scan order
+		if (group(pa) == 2) return false;
+		return pa.DV_TOTAL < pb.DV_TOTAL;
+	});
+	for (i = 0;i < n;i++)
+	{
+		tab.Points[tab.Ranking[i]].Rank = i + 1;
+	}
+
+	tab.TTOTAL = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+}
+
 VECTOR3 TLMCCProcessor::CalcLOIDV(EphemerisData sv_MCC_apo, double gamma_nd)
 {
 	EphemerisData sv_nd;
@@ -400,6 +482,7 @@ void TLMCCProcessor::Option2()
 	pRTCC->PMMCEN(outarray.sv_lls2, 0.0, 10.0*24.0*3600.0, 1, GMT_TEI - outarray.sv_lls2.GMT, 1.0, sv_TEI1, ITS);
 	sv_TEI2 = sv_TEI1;
 
+	int iter = 0;
 	do
 	{
 		R_TEI_EMP = sv_TEI2.R;
@@ -420,6 +503,13 @@ void TLMCCProcessor::Option2()
 		}
 		dt = dlng * 20.0 / RAD;
 		pRTCC->PMMCEN(sv_TEI2, 0.0, 10.0*24.0*3600.0, 1, dt, 1.0, sv_TEI2, ITS);
+		iter++;
+		//Without a lunar orbit the longitude doesn't converge
+		if (iter == 20)
+		{
+			IterError = true;
+			break;
+		}
 	} while (abs(dt) > 0.1);
 
 	VECTOR3 RF, VF;
@@ -460,6 +550,7 @@ void TLMCCProcessor::Option2()
 	VECTOR3 DV6 = _V(outarray.dv_mcc, outarray.dgamma_mcc, outarray.dpsi_mcc);
 	BURN(sv_MCC.R, sv_MCC.V, DV6.x*R_E / 3600.0, DV6.y, DV6.z, isp_MCC, mfm0, RF, VF);
 	VECTOR3 DV_temp = VF - sv_MCC.V;
+	VECTOR3 V_temp;
 
 	EphemerisData S_apo;
 	VECTOR3 NewGuess, DV7, DV8;
@@ -481,7 +572,8 @@ TLMCC_Option_2_E:
 	S2C.V = VF;
 	DV_temp = S2C.V - S_apo.V;
 	RVIO(true, S_apo.R, S1.V, r, v1, theta, phi, gamma1, psi1);
-	RVIO(true, S1.R, S1.V + DV_temp, r, v2, theta, phi, gamma2, psi2);
+	V_temp = S1.V + DV_temp;
+	RVIO(true, S1.R, V_temp, r, v2, theta, phi, gamma2, psi2);
 	NewGuess = _V((v2 - v1)*3600.0 / R_E, gamma2 - gamma1, psi2 - psi1);
 
 	outtab.GMT_pc1 = outtab.GMT_pc2 = outarray.GMT_pl;
@@ -566,6 +658,7 @@ void TLMCCProcessor::Option3()
 	pRTCC->PMMCEN(outarray.sv_lls2, 0.0, 10.0*24.0*3600.0, 1, GMT_TEI - outarray.sv_lls2.GMT, 1.0, sv_TEI1, ITS);
 	sv_TEI2 = sv_TEI1; 
 	
+	int iter = 0;
 	do
 	{
 		R_TEI_EMP = sv_TEI2.R;
@@ -586,6 +679,13 @@ void TLMCCProcessor::Option3()
 		}
 		dt = dlng * 20.0 / RAD;
 		pRTCC->PMMCEN(sv_TEI2, 0.0, 10.0*24.0*3600.0, 1, dt, 1.0, sv_TEI2, ITS);
+		iter++;
+		//Without a lunar orbit the longitude doesn't converge
+		if (iter == 20)
+		{
+			IterError = true;
+			break;
+		}
 	} while (abs(dt) > 0.1);
 
 	VECTOR3 RF, VF;
@@ -625,6 +725,7 @@ void TLMCCProcessor::Option3()
 	outarray.dt_bias_conic_prec = GMT_pl6 - GMT_pl3;
 	VECTOR3 DV6 = _V(outarray.dv_mcc, outarray.dgamma_mcc, outarray.dpsi_mcc);
 	BURN(sv_MCC.R, sv_MCC.V, DV6.x*R_E / 3600.0, DV6.y, DV6.z, isp_MCC, mfm0, RF, VF);
+	VECTOR3 V_temp;
 	VECTOR3 DV_temp = VF - sv_MCC.V;
 
 	EphemerisData S_apo;
@@ -647,7 +748,8 @@ TLMCC_Option_3_E:
 	S2C.V = VF;
 	DV_temp = S2C.V - S_apo.V;
 	RVIO(true, S_apo.R, S1.V, r, v1, theta, phi, gamma1, psi1);
-	RVIO(true, S1.R, S1.V + DV_temp, r, v2, theta, phi, gamma2, psi2);
+	V_temp = S1.V + DV_temp;
+	RVIO(true, S1.R, V_temp, r, v2, theta, phi, gamma2, psi2);
 	NewGuess = _V((v2 - v1)*3600.0 / R_E, gamma2 - gamma1, psi2 - psi1);
 
 	outtab.GMT_pc1 = outtab.GMT_pc2 = outarray.GMT_pl;
@@ -799,6 +901,7 @@ void TLMCCProcessor::Option4()
 	pRTCC->PMMCEN(outarray.sv_lls2, 0.0, 10.0*24.0*3600.0, 1, GMT_TEI - outarray.sv_lls2.GMT, 1.0, sv_TEI1, ITS);
 	sv_TEI2 = sv_TEI1;
 
+	int iter = 0;
 	do
 	{
 		R_TEI_EMP = sv_TEI2.R;
@@ -819,6 +922,13 @@ void TLMCCProcessor::Option4()
 		}
 		dt = dlng * 20.0 / RAD;
 		pRTCC->PMMCEN(sv_TEI2, 0.0, 10.0*24.0*3600.0, 1, dt, 1.0, sv_TEI2, ITS);
+		iter++;
+		//Without a lunar orbit the longitude doesn't converge
+		if (iter == 20)
+		{
+			IterError = true;
+			break;
+		}
 	} while (abs(dt) > 0.1);
 
 	VECTOR3 RF, VF;
@@ -855,6 +965,7 @@ void TLMCCProcessor::Option4()
 
 	//Step 4
 	IntegratedXYZTTrajectory(sv_MCC, outarray.dv_mcc, outarray.dgamma_mcc, outarray.dpsi_mcc, DataTable.rad_lls + h_nd2, lat_nd2, lng_nd2, GMT_nd2*3600.0);
+	VECTOR3 V_temp;
 
 	VECTOR3 DV4, DV_temp, NewGuess, DV5, DV6;
 	double r, v1, theta, phi, gamma1, psi1, v2, gamma2, psi2, GMT_nd, v_c, dv_char5, dv_char6;
@@ -866,7 +977,8 @@ TLMCC_Option_4_D:
 	S_apo = S2C;
 	S_apo.V = S2C.V - DV_temp;
 	RVIO(true, S_apo.R, S1.V, r, v1, theta, phi, gamma1, psi1);
-	RVIO(true, S1.R, S1.V + DV_temp, r, v2, theta, phi, gamma2, psi2);
+	V_temp = S1.V + DV_temp;
+	RVIO(true, S1.R, V_temp, r, v2, theta, phi, gamma2, psi2);
 	NewGuess = _V((v2 - v1)*3600.0 / R_E, gamma2 - gamma1, psi2 - psi1);
 	outarray.LOIOffset = S3I.V - S3C.V;
 
@@ -879,7 +991,8 @@ TLMCC_Option_4_D:
 	S2C.V = VF;
 	DV_temp = S2C.V - S_apo.V;
 	RVIO(true, S_apo.R, S1.V, r, v1, theta, phi, gamma1, psi1);
-	RVIO(true, S1.R, S1.V + DV_temp, r, v2, theta, phi, gamma2, psi2);
+	V_temp = S1.V + DV_temp;
+	RVIO(true, S1.R, V_temp, r, v2, theta, phi, gamma2, psi2);
 	NewGuess = _V((v2 - v1)*3600.0 / R_E, gamma2 - gamma1, psi2 - psi1);
 
 	//Step 6
@@ -1022,6 +1135,7 @@ void TLMCCProcessor::Option5()
 	pRTCC->PMMCEN(outarray.sv_lls2, 0.0, 10.0*24.0*3600.0, 1, GMT_TEI - outarray.sv_lls2.GMT, 1.0, sv_TEI1, ITS);
 	sv_TEI2 = sv_TEI1;
 
+	int iter = 0;
 	do
 	{
 		R_TEI_EMP = sv_TEI2.R;
@@ -1042,6 +1156,13 @@ void TLMCCProcessor::Option5()
 		}
 		dt = dlng * 20.0 / RAD;
 		pRTCC->PMMCEN(sv_TEI2, 0.0, 10.0*24.0*3600.0, 1, dt, 1.0, sv_TEI2, ITS);
+		iter++;
+		//Without a lunar orbit the longitude doesn't converge
+		if (iter == 20)
+		{
+			IterError = true;
+			break;
+		}
 	} while (abs(dt) > 0.1);
 
 	VECTOR3 RF, VF;
@@ -1077,6 +1198,7 @@ void TLMCCProcessor::Option5()
 	double R_nd2 = DataTable.rad_lls + h_nd2;
 	ConvergeTLMC(v_nd2, psi_nd2, lng_nd2, lat_nd2, R_nd2 / R_E, GMT_nd2, true);
 
+	VECTOR3 V_temp;
 	//Step 4
 	IntegratedXYZTTrajectory(sv_MCC, outarray.dv_mcc, outarray.dgamma_mcc, outarray.dpsi_mcc, R_nd2, lat_nd2, lng_nd2, GMT_nd2*3600.0);
 	
@@ -1090,7 +1212,8 @@ TLMCC_Option_5_D:
 	S_apo = S2C;
 	S_apo.V = S2C.V - DV_temp;
 	RVIO(true, S_apo.R, S1.V, r, v1, theta, phi, gamma1, psi1);
-	RVIO(true, S1.R, S1.V + DV_temp, r, v2, theta, phi, gamma2, psi2);
+	V_temp = S1.V + DV_temp;
+	RVIO(true, S1.R, V_temp, r, v2, theta, phi, gamma2, psi2);
 	NewGuess = _V((v2 - v1)*3600.0 / R_E, gamma2 - gamma1, psi2 - psi1);
 	outarray.LOIOffset = S3I.V - S3C.V;
 
@@ -1103,7 +1226,8 @@ TLMCC_Option_5_D:
 	S2C.V = VF;
 	DV_temp = S2C.V - S_apo.V;
 	RVIO(true, S_apo.R, S1.V, r, v1, theta, phi, gamma1, psi1);
-	RVIO(true, S1.R, S1.V + DV_temp, r, v2, theta, phi, gamma2, psi2);
+	V_temp = S1.V + DV_temp;
+	RVIO(true, S1.R, V_temp, r, v2, theta, phi, gamma2, psi2);
 	NewGuess = _V((v2 - v1)*3600.0 / R_E, gamma2 - gamma1, psi2 - psi1);
 
 	//Step 6
@@ -1354,6 +1478,7 @@ void TLMCCProcessor::Option9A()
 	ConicFreeReturnFlyby(sv_MCC, outarray.dv_mcc, outarray.dgamma_mcc, outarray.dpsi_mcc, h_pl, lat_split);
 
 	VECTOR3 DV3 = _V(outarray.dv_mcc, outarray.dgamma_mcc, outarray.dpsi_mcc);
+	VECTOR3 V_temp;
 	ConvergeTLMC(V, psi, lng, lat_split, R, T, true);
 
 	//Step 4
@@ -1406,7 +1531,8 @@ TLMCC_Option_9A_C:
 	S2C.V = VF;
 	DV_temp = S2C.V - S_apo.V;
 	RVIO(true, S_apo.R, S1.V, r, v1, theta, phi, gamma1, psi1);
-	RVIO(true, S1.R, S1.V + DV_temp, r, v2, theta, phi, gamma2, psi2);
+	V_temp = S1.V + DV_temp;
+	RVIO(true, S1.R, V_temp, r, v2, theta, phi, gamma2, psi2);
 	NewGuess = _V((v2 - v1)*3600.0 / R_E, gamma2 - gamma1, psi2 - psi1);
 
 	//Step 9
@@ -1477,6 +1603,7 @@ void TLMCCProcessor::Option9B()
 	}
 
 	//Step 3
+	VECTOR3 V_temp;
 	ConicFreeReturnFlyby(sv_MCC, outarray.dv_mcc, outarray.dgamma_mcc, outarray.dpsi_mcc, h_pl, lat_split);
 
 	VECTOR3 DV3 = _V(outarray.dv_mcc, outarray.dgamma_mcc, outarray.dpsi_mcc);
@@ -1542,7 +1669,8 @@ TLMCC_Option_9B_C:
 	S2C.V = VF;
 	DV_temp = S2C.V - S_apo.V;
 	RVIO(true, S_apo.R, S1.V, r, v1, theta, phi, gamma1, psi1);
-	RVIO(true, S1.R, S1.V + DV_temp, r, v2, theta, phi, gamma2, psi2);
+	V_temp = S1.V + DV_temp;
+	RVIO(true, S1.R, V_temp, r, v2, theta, phi, gamma2, psi2);
 	NewGuess = _V((v2 - v1)*3600.0 / R_E, gamma2 - gamma1, psi2 - psi1);
 
 	//Step 8
@@ -1613,7 +1741,9 @@ bool TLMCCProcessor::ConvergeTLMC(double V, double azi, double lng, double lat,
 
 	std::vector<double> result;
 	std::vector<double> y_vals;
-	return GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals);
+	bool err = GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals);
+	if (err) IterError = true;
+	return err;
 }
 
 void TLMCCProcessor::IntegratedXYZTTrajectory(EphemerisData sv0, double dv_guess, double dgamma_guess, double dpsi_guess, double R_nd, double lat_nd, double lng_nd, double GMT_node)
@@ -1661,7 +1791,7 @@ void TLMCCProcessor::IntegratedXYZTTrajectory(EphemerisData sv0, double dv_guess
 
 	std::vector<double> result;
 	std::vector<double> y_vals;
-	GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals);
+	if (GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals)) IterError = true;
 }
 
 void TLMCCProcessor::ConicFreeReturnInclinationFlyby(EphemerisData sv0, double dv_guess, double dgamma_guess, double dpsi_guess, double H_pl, double inc_pg, double lat_pl_min, double lat_pl_max)
@@ -1718,7 +1848,7 @@ void TLMCCProcessor::ConicFreeReturnInclinationFlyby(EphemerisData sv0, double d
 
 	std::vector<double> result;
 	std::vector<double> y_vals;
-	GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals);
+	if (GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals)) IterError = true;
 }
 
 void TLMCCProcessor::ConicFreeReturnOptimizedInclinationFlyby(EphemerisData sv0, double dv_guess, double dgamma_guess, double dpsi_guess, double inc_pg_min, double inc_pg_max, int inc_class)
@@ -1774,7 +1904,7 @@ void TLMCCProcessor::ConicFreeReturnOptimizedInclinationFlyby(EphemerisData sv0,
 
 	std::vector<double> result;
 	std::vector<double> y_vals;
-	GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals);
+	if (GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals)) IterError = true;
 }
 
 void TLMCCProcessor::IntegratedFreeReturnFlyby(EphemerisData sv0, double dv_guess, double dgamma_guess, double dpsi_guess, double H_pl, double lat_pl)
@@ -1826,7 +1956,7 @@ void TLMCCProcessor::IntegratedFreeReturnFlyby(EphemerisData sv0, double dv_gues
 
 	std::vector<double> result;
 	std::vector<double> y_vals;
-	GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals);
+	if (GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals)) IterError = true;
 }
 
 void TLMCCProcessor::ConicFreeReturnFlyby(EphemerisData sv0, double dv_guess, double dgamma_guess, double dpsi_guess, double H_pl, double lat_pl)
@@ -1879,7 +2009,7 @@ void TLMCCProcessor::ConicFreeReturnFlyby(EphemerisData sv0, double dv_guess, do
 
 	std::vector<double> result;
 	std::vector<double> y_vals;
-	GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals);
+	if (GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals)) IterError = true;
 }
 
 void TLMCCProcessor::IntegratedFreeReturnInclinationFlyby(EphemerisData sv0, double dv_guess, double dgamma_guess, double dpsi_guess, double H_pl, double inc_fr)
@@ -1926,7 +2056,7 @@ void TLMCCProcessor::IntegratedFreeReturnInclinationFlyby(EphemerisData sv0, dou
 
 	std::vector<double> result;
 	std::vector<double> y_vals;
-	GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals);
+	if (GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals)) IterError = true;
 }
 
 void TLMCCProcessor::ConicFreeReturnOptimizedFixedOrbitToLLS(EphemerisData sv0, double dv_guess, double dgamma_guess, double dpsi_guess, double gamma_loi)
@@ -1994,7 +2124,7 @@ void TLMCCProcessor::ConicFreeReturnOptimizedFixedOrbitToLLS(EphemerisData sv0,
 
 	std::vector<double> result;
 	std::vector<double> y_vals;
-	GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals);
+	if (GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals)) IterError = true;
 }
 
 void TLMCCProcessor::ConicNonfreeReturnOptimizedFixedOrbitToLLS(EphemerisData sv0, double dv_guess, double dgamma_guess, double dpsi_guess, double gamma_loi, double T_min, double T_max)
@@ -2054,7 +2184,7 @@ void TLMCCProcessor::ConicNonfreeReturnOptimizedFixedOrbitToLLS(EphemerisData sv
 
 	std::vector<double> result;
 	std::vector<double> y_vals;
-	GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals);
+	if (GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals)) IterError = true;
 }
 
 void TLMCCProcessor::ConicFreeReturnOptimizedFreeOrbitToLOPC(EphemerisData sv0, double dv_guess, double dgamma_guess, double dpsi_guess, double gamma_loi, double dpsi_loi, double DT_lls, double AZ_min, double AZ_max)
@@ -2150,7 +2280,7 @@ void TLMCCProcessor::ConicFreeReturnOptimizedFreeOrbitToLOPC(EphemerisData sv0,
 
 	std::vector<double> result;
 	std::vector<double> y_vals;
-	GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals);
+	if (GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals)) IterError = true;
 }
 
 void TLMCCProcessor::ConicNonfreeReturnOptimizedFreeOrbitToLOPC(EphemerisData sv0, double dv_guess, double dgamma_guess, double dpsi_guess, double T_min, double T_max, double h_pl)
@@ -2231,7 +2361,7 @@ void TLMCCProcessor::ConicNonfreeReturnOptimizedFreeOrbitToLOPC(EphemerisData sv
 
 	std::vector<double> result;
 	std::vector<double> y_vals;
-	GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals);
+	if (GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals)) IterError = true;
 }
 
 void TLMCCProcessor::ConicTransEarthInjection(double T_lo, double dv_tei, double dgamma_tei, double dpsi_tei, double T_te, bool lngiter)
@@ -2296,7 +2426,7 @@ void TLMCCProcessor::ConicTransEarthInjection(double T_lo, double dv_tei, double
 
 	std::vector<double> result;
 	std::vector<double> y_vals;
-	GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals);
+	if (GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals)) IterError = true;
 }
 
 void TLMCCProcessor::ConicFullMissionFreeOrbit(EphemerisData sv0, double dv_guess, double dgamma_guess, double dpsi_guess, double h_pl, double gamma_loi, double dpsi_loi, double dt_lls, double T_lo, double dv_tei, double dgamma_tei, double dpsi_tei, double T_te, double AZ_min, double AZ_max, double mass, bool freereturn, double T_min, double T_max)
@@ -2466,7 +2596,7 @@ void TLMCCProcessor::ConicFullMissionFreeOrbit(EphemerisData sv0, double dv_gues
 
 	std::vector<double> result;
 	std::vector<double> y_vals;
-	GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals);
+	if (GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals)) IterError = true;
 }
 
 void TLMCCProcessor::ConicFullMissionFixedOrbit(EphemerisData sv0, double dv_guess, double dgamma_guess, double dpsi_guess, double gamma_loi, double T_lo, double dv_tei, double dgamma_tei, double dpsi_tei, double T_te, double mass, bool freereturn, double T_min, double T_max)
@@ -2600,7 +2730,7 @@ void TLMCCProcessor::ConicFullMissionFixedOrbit(EphemerisData sv0, double dv_gue
 
 	std::vector<double> result;
 	std::vector<double> y_vals;
-	GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals);
+	if (GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals)) IterError = true;
 }
 
 bool ConvergeTLMCPointer(void *data, std::vector<double> &var, void *varPtr, std::vector<double>& arr, bool mode)
@@ -3066,8 +3196,10 @@ TLMCC_Conic_A1:
 		}
 	}
 
-	VECTOR3 Rtemp = vars->SGSLOI.R;
-	VECTOR3 Vtemp = vars->SGSLOI.V;
+	VECTOR3 Rtemp;
+	Rtemp = vars->SGSLOI.R;
+	VECTOR3 Vtemp;
+	Vtemp = vars->SGSLOI.V;
 	LIBRAT(Rtemp, Vtemp, vars->GMT_nd, 6);
 	U_DS = unit(crossp(Rtemp, Vtemp));
 
@@ -3087,7 +3219,8 @@ TLMCC_Conic_A1:
 	outarray.M_loi = MCOMP(DV_LOI, MEDQuantities.Config, MEDQuantities.useSPS, outarray.M_mcc);
 
 	gamma = vars->gamma_L - vars->gamma1;
-	double DV_DOI = sqrt(vars->V2*vars->V2 + vars->V_L * vars->V_L - 2.0*vars->V_L*vars->V2*cos(gamma));
+	double DV_DOI;
+	DV_DOI = sqrt(vars->V2*vars->V2 + vars->V_L * vars->V_L - 2.0*vars->V_L*vars->V2*cos(gamma));
 	outarray.M_cir = MCOMP(DV_DOI, MEDQuantities.Config, MEDQuantities.useSPS, outarray.M_loi);
 
 	LIBRAT(vars->sv_lls1.R, vars->sv_lls1.V, vars->sv_lls1.GMT, 5);
@@ -3225,9 +3358,8 @@ bool TLMCCProcessor::PATCH(VECTOR3 &R, VECTOR3 &V, double &GMT, int Q, int KREF)
 {
 	//KREF = 1: Earth reference input, 2: Moon reference input
 
-	VECTOR3 R_EM, V_EM, R_ES, R1, V1, R2, V2, R21, A2;
-	double beta, Ratio_desired, GMTF, r1, r2, r21, mu1, mu2, d1, d2, v12, v22, DRatioDBeta, DDRatioDDBeta, Ratio, DRatio, dbeta;
-	int i = 0;
+	VECTOR3 R2, V2;
+	double beta, Ratio_desired, GMTF, mu1, mu2;
 
 	if (KREF == 1)
 	{
@@ -3294,57 +3426,11 @@ bool TLMCCProcessor::PATCH(VECTOR3 &R, VECTOR3 &V, double &GMT, int Q, int KREF)
 		mu2 = mu_E;
 	}
 
-	do
+	PatchPointKernel kernel(MoonSpline);
+	if (kernel.Solve(R, V, GMT, beta, KREF, mu1, mu2, Ratio_desired, R2, V2, GMTF))
 	{
-		XBETA(R, V, GMT, beta, KREF, R1, V1, GMTF);
-		if (EPHEM(GMTF, R_EM, V_EM, R_ES))
-		{
-			return true;
-		}
-		if (KREF == 1)
-		{
-			R2 = R1 - R_EM;
-			V2 = V1 - V_EM;
-			R21 = R_EM;
-		}
-		else
-		{
-			R2 = R1 + R_EM;
-			V2 = V1 + V_EM;
-			R21 = -R_EM;
-		}
-		r1 = length(R1);
-		r2 = length(R2);
-		/*if (KREF == 1)
-		{
-			if (r1 > 60.0*R_E) return true;
-		}
-		else
-		{
-			if (r1 > 15.0*R_E) return true;
-		}*/
-		Ratio = r2 / r1;
-		DRatio = Ratio_desired - Ratio;
-		if (abs(DRatio) < 10e-12)
-		{
-			break;
-		}
-		r21 = length(R21);
-		d1 = dotp(R1, V1);
-		d2 = dotp(R2, V2);
-		v12 = dotp(V1, V1);
-		v22 = dotp(V2, V2);
-		A2 = -R1 * mu1 / pow(r1, 3) + R21 * (mu1 + mu2) / pow(r21, 3);
-		DRatioDBeta = 1.0 / r2 / sqrt(mu1)*(d2 - r2 * r2*d1 / r1 / r1);
-		DDRatioDDBeta = r1 / mu1 * (v22 + dotp(R2, A2)) / r2 - d1 * d2 / (mu1*r1*r2) - d2 * d2*r1 / (mu1*pow(r2, 3)) - r2 * v12 / r1 / mu1 + r2 / r1 / r1 + 2.0*d1*d1*r2 / (mu1*pow(r1, 3));
-		if (DRatioDBeta*DRatioDBeta + 2.0*DRatio*DDRatioDDBeta < 0)
-		{
-			DDRatioDDBeta = 0.0;
-		}
-		dbeta = 2.0*DRatio / (DRatioDBeta + DRatioDBeta / abs(DRatioDBeta)*sqrt(DRatioDBeta*DRatioDBeta + 2.0*DRatio*DDRatioDDBeta));
-		beta = beta + dbeta;
-		i++;
-	} while (i < 10);
+		return true;
+	}
 
 	R = R2;
 	V = V2;
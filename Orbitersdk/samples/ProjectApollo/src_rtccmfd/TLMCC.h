@@ -23,7 +23,9 @@ See http://nassp.sourceforge.net/license/ for more details.
 
 #pragma once
 
+#include <vector>
 #include "RTCCModule.h"
+#include "PatchPointKernel.h"
 
 struct TLMCCDataTable
 {
@@ -285,12 +287,63 @@ struct TLMCCGeneralizedIteratorArray
 	double V_L;
 };
 
+//Midcourse option scan. Every mode is solved at every midcourse time, each on its own processor.
+struct TLMCCScanSettings
+{
+	//Inputs of the single solution. Mode and T_MCC are replaced by the grid values.
+	TLMCCDataTable DataTable;
+	TLMCCMEDQuantities MED;
+	TLMCCMissionConstants Constants;
+	//Modes 1 to 9
+	std::vector<int> MODES;
+	//GMT of the midcourse corrections
+	std::vector<double> T_MCC;
+	//0 = all hardware threads
+	unsigned MaxThreads = 0;
+};
+
+struct TLMCCScanPoint
+{
+	int Mode = 0;
+	double T_MCC = 0.0;
+	//true if a generalized iterator run of the mode didn't converge or the solution isn't finite
+	bool Error = false;
+	//Delta V magnitudes of the maneuvers the mode plans, zero for those it doesn't, and their sum
+	double DV_MCC = 0.0;
+	double DV_LOI = 0.0;
+	double DV_LOPC = 0.0;
+	double DV_TEI = 0.0;
+	double DV_TOTAL = 0.0;
+	//Azimuth of approach to the landing site and how far it is outside of the azimuth limits, 0 if inside or no landing site mode
+	double AZ_act = 0.0;
+	double DAZ = 0.0;
+	//Position in the ranking, 1 = best
+	int Rank = 0;
+	//Full solution, as displayed and transferred to the MPT by the single solution
+	TLMCCOutputData out;
+};
+
+struct TLMCCScanTable
+{
+	//Options ordered by mode and midcourse time
+	std::vector<TLMCCScanPoint> Points;
+	//Indices of Points, best option first. Converged options within the azimuth limits come first, then converged options
+	//outside of them, then the failed ones. Each group is ordered by total DV.
+	std::vector<int> Ranking;
+	int Solved = 0;
+	int Failed = 0;
+	//Wall clock time of the scan (s)
+	double TTOTAL = 0.0;
+};
+
 class TLMCCProcessor : public RTCCModule
 {
 public:
 	TLMCCProcessor(RTCC *r);
 	void Init(TLMCCDataTable data, TLMCCMEDQuantities med, TLMCCMissionConstants cst);
 	void Main(TLMCCOutputData &out);
+	//Solves all options of the scan and ranks them
+	void SCAN(const TLMCCScanSettings &set, TLMCCScanTable &tab);
 
 	//The trajectory computers
 	bool FirstGuessTrajectoryComputer(std::vector<double> &var, void *varPtr, std::vector<double>& arr, bool mode);
@@ -372,4 +425,8 @@ protected:
 
 	TLMCCGeneralizedIteratorArray outarray;
 	TLMCCDataTable outtab;
+	//Set if any generalized iterator run since Init returned an error
+	bool IterError;
+	//Moon ephemeris for the patch point iterations, sampled once per run
+	MoonStateSpline MoonSpline;
 };
\ No newline at end of file
@@ -668,8 +668,10 @@ RTCC_PITFPC_2:
 		goto RTCC_PITFPC_5;
 	}
 	//Parabolic
-	double ETAP = acos(XAORP / rad - 1.0);
-	double TEMP1 = sin(ETAP / 2.0) / cos(ETAP / 2.0);
+	double ETAP;
+	ETAP = acos(XAORP / rad - 1.0);
+	double TEMP1;
+	TEMP1 = sin(ETAP / 2.0) / cos(ETAP / 2.0);
 	TP = XAORP / 2.0*sqrt(XAORP / MU)*(TEMP1 + 1.0 / 3.0*pow(TEMP1, 3.0));
 	goto RTCC_PITFPC_4;
 RTCC_PITFPC_3:
@@ -209,7 +209,8 @@ int RTCC::ELNMVC(double TL, double TR, int L, unsigned &NumVec, int &TUP)
 	}
 	double TREQ, T_Mid;
 	unsigned LB, UB, Mid;
-	bool firstpass = true;
+	bool firstpass;
+	firstpass = true;
 	LB = 0;
 	UB = tab->EPHEM.table.size() - 1;
 	TREQ = TL;
@@ -744,7 +745,8 @@ void RTCC::ELVCTR(const ELVCTRInputTable &in, ELVCTROutputTable &out, EphemerisD
 		goto RTCC_ELVCTR_H;
 	RTCC_ELVCTR_3:
 		ORER = 1;
-		unsigned E = 0;
+		unsigned E;
+		E = 0;
 		while (EPH.table[E].GMT <= in.GMT)
 		{
 			//Direct hit
@@ -1554,7 +1556,8 @@ void RTCC::PLAWDT(const PLAWDTInput &in, PLAWDTOutput &out)
 		out.KFactor = mpt->KFactor;
 	}
 	//Search for TLI
-	bool tli = false;
+	bool tli;
+	tli = false;
 	unsigned tlinum;
 	for (unsigned i = 0;i < mpt->ManeuverNum;i++)
 	{
@@ -1809,51 +1812,46 @@ RTCC_PLAWDT_9_T:
 //Sun/Moon Ephemeris Interpolation Program
 bool RTCC::PLEFEM(int IND, double HOUR, int YEAR, VECTOR3 &R_EM, VECTOR3 &V_EM, VECTOR3 &R_ES)
 {
-	double T, C[6];
-	int i, j, k, l;
-
 	if (IND > 0)
 	{
 		HOUR = HOUR + SystemParameters.MCCBES;
 	}
 	//TBD: Convert from universal time to ephemeris time
-	//T is 0 to 1, from last to next 12 hour interval
-	T = (HOUR - floor(HOUR / 12.0) * 12.0) / 12.0;
-	C[0] = -((T + 1.0)*T*(T - 1.0)*(T - 2.0)*(T - 3.0)) / 120.0;
-	C[1] = ((T + 2.0)*T*(T - 1.0)*(T - 2.0)*(T - 3.0)) / 24.0;
-	C[2] = -((T + 2.0)*(T + 1.0)*(T - 1.0)*(T - 2.0)*(T - 3.0)) / 12.0;
-	C[3] = ((T + 2.0)*(T + 1.0)*T*(T - 2.0)*(T - 3.0)) / 12.0;
-	C[4] = -((T + 2.0)*(T + 1.0)*T*(T - 1.0)*(T - 3.0)) / 24.0;
-	C[5] = ((T + 2.0)*(T + 1.0)*T*(T - 1.0)*(T - 2.0)) / 120.0;
-	
 	//Calculate MJD from GMT
 	double MJD = SystemParameters.GMTBASE + HOUR / 24.0;
-	//Calculate position of time in array
-	i = (int)((MJD - MDGSUN.MJD)*2.0);
-	//Calculate starting point in the array
-	j = i - 2;
-	//Is time contained in Sun/Moon data array?
-	if (j < 0 || j > 65) goto RTCC_PLEFEM_A;
 
-	VECTOR3 *X[3] = {MDGSUN.R_EM, MDGSUN.V_EM, MDGSUN.R_ES };
-	double x[9];
-	for (k = 0;k < 3;k++)
-	{
-		for (l = 0;l < 3;l++)
-		{
-			x[k * 3 + l] = C[0] * X[k][j].data[l] + C[1] * X[k][j + 1].data[l] + C[2] * X[k][j + 2].data[l] + C[3] * X[k][j + 3].data[l] + C[4] * X[k][j + 4].data[l] + C[5] * X[k][j + 5].data[l];
-		}
-	}
-	R_EM = _V(x[0], x[1], x[2])*OrbMech::R_Earth;
-	V_EM = _V(x[3], x[4], x[5])*OrbMech::R_Earth / 3600.0;
-	R_ES = _V(x[6], x[7], x[8])*OrbMech::R_Earth;
-	
+	//Is time contained in Sun/Moon ephemeris?
+	if (MDGSUN.Evaluate(MJD, R_EM, V_EM, R_ES)) goto RTCC_PLEFEM_A;
+
+	R_EM = R_EM * OrbMech::R_Earth;
+	V_EM = V_EM * OrbMech::R_Earth / 3600.0;
+	R_ES = R_ES * OrbMech::R_Earth;
+
 	return false;
 RTCC_PLEFEM_A:
 	//Error return
 	return true;
 }
 
+bool RTCC::PLEFEM(int IND, const std::vector<double> &HOUR, int YEAR, std::vector<VECTOR3> &R_EM, std::vector<VECTOR3> &V_EM, std::vector<VECTOR3> &R_ES)
+{
+	bool err = false;
+	unsigned i;
+
+	R_EM.resize(HOUR.size());
+	V_EM.resize(HOUR.size());
+	R_ES.resize(HOUR.size());
+
+	for (i = 0;i < HOUR.size();i++)
+	{
+		if (PLEFEM(IND, HOUR[i], YEAR, R_EM[i], V_EM[i], R_ES[i]))
+		{
+			err = true;
+		}
+	}
+	return err;
+}
+
 bool RTCC::PLEFEM(int IND, double HOUR, int YEAR, MATRIX3 &M_LIB)
 {
 	//Calculate MJD from GMT
@@ -28,7 +28,7 @@
 
 #define ORBITER_MODULE
 
-#include "orbitersdk.h"
+#include "Orbitersdk.h"
 #include "stdio.h"
 
 #include "PanelSDK/PanelSDK.h"
@@ -37,7 +37,7 @@
 #include "connector.h"
 #include "sivbsystems.h"
 #include "sivb.h"
-#include "astp.h"
+#include "ASTP.h"
 
 HINSTANCE g_hDLL;
 
@@ -5332,6 +5332,9 @@ void LVDCSV::ReadFlightSequenceProgram(char *fspfile)
 	{
 		while (getline(file, line))
 		{
+			//Windows line endings, when read on another system
+			if (!line.empty() && line[line.length() - 1] == '\r') line.erase(line.length() - 1);
+
 			if (line.compare("END") == 0)
 			{
 				break;
@@ -888,6 +888,7 @@ private:								// Saturn LV
 	friend class ApolloRTCCMFD;
 	friend class RTCC;
 	friend class ARCore;
+	friend class LVDCAscent;
 };
 
 /* ********************
@@ -1202,6 +1203,7 @@ private:
 	};
 
 	friend class ARCore;
+	friend class LVDCAscent;
 };
 
 #define LVDC_START_STRING "LVDC_BEGIN"
@@ -36,7 +36,7 @@
 #include "toggleswitch.h"
 
 #include "apolloguidance.h"
-#include "csmcomputer.h"
+#include "CSMcomputer.h"
 #include "ioChannels.h"
 
 #include "s1bsystems.h"
@@ -82,6 +82,9 @@ Saturn1b::Saturn1b (OBJHANDLE hObj, int fmodel) : Saturn (hObj, fmodel),
 Saturn1b::~Saturn1b()
 
 {
+	// The systems worker must be done before the stages are deleted
+	systemsStepper.Wait();
+
 	ReleaseSurfaces();
 
 	if (iu)
@@ -661,6 +664,7 @@ void Saturn1b::CalculateStageMass()
 }
 
 int Saturn1b::clbkConsumeBufferedKey(DWORD key, bool down, char *kstate) {
+	systemsStepper.Wait();
 
 	if (FirstTimestep) return 0;
 
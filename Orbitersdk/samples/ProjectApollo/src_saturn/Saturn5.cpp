@@ -38,7 +38,7 @@
 
 #include "toggleswitch.h"
 #include "apolloguidance.h"
-#include "csmcomputer.h"
+#include "CSMcomputer.h"
 #include "ioChannels.h"
 
 #include "s1csystems.h"
@@ -196,6 +196,9 @@ void SaturnV::initSaturnV()
 SaturnV::~SaturnV()
 
 {
+	// The systems worker must be done before the stages are deleted
+	systemsStepper.Wait();
+
 	TRACESETUP("~SaturnV");
 
 	ReleaseSurfaces();
@@ -883,6 +886,7 @@ void SaturnV::ConfigureStageEngines(int stage_state)
 }
 
 int SaturnV::clbkConsumeBufferedKey(DWORD key, bool down, char *kstate) {
+	systemsStepper.Wait();
 
 	if (FirstTimestep) return 0;
 
@@ -35,8 +35,8 @@
 
 #include "toggleswitch.h"
 #include "apolloguidance.h"
-#include "csmcomputer.h"
-#include "lemcomputer.h"
+#include "CSMcomputer.h"
+#include "LEMcomputer.h"
 
 #include "saturn.h"
 #include "saturnv.h"
@@ -48,7 +48,7 @@
 #include "s1c.h"
 #include "sm.h"
 #include "Sat5Abort1.h"
-#include "Sat5Abort2.h"
+#include "sat5abort2.h"
 #include "Sat5Abort3.h"
 #include "Mission.h"
 
@@ -24,7 +24,7 @@
 
 // To force orbitersdk.h to use <fstream> in any compiler version
 #pragma include_alias( <fstream.h>, <fstream> )
-#include "orbitersdk.h"
+#include "Orbitersdk.h"
 #include <stdio.h>
 
 #include "nasspdefs.h"
@@ -56,6 +56,15 @@ FDAI::FDAI() {
 	ACSource = NULL;
 	noAC = false;
 	vessel = NULL;
+
+	hDC2 = NULL;
+	hBMP = NULL;
+	hBMP_old = NULL;
+	ballBits = NULL;
+	hBmpRollRotated = NULL;
+	rollRotatedAngle = 0;
+	rollRotatedX = 0;
+	rollRotatedY = 0;
 }
 
 void FDAI::Init(VESSEL *v)
@@ -63,118 +72,50 @@ void FDAI::Init(VESSEL *v)
 	vessel = v;
 }
 
-void FDAI::InitGL() {
-
-	GLuint      PixelFormat;
-	BITMAPINFOHEADER BIH;
-	int iSize = sizeof(BITMAPINFOHEADER);
-	BIH.biSize = iSize;
-	BIH.biWidth = 180;				//size of the sphere is 180x180
-	BIH.biHeight = 180;
-	BIH.biPlanes = 1;
-	BIH.biBitCount = 16;//default is 16.
-	BIH.biCompression = BI_RGB;
-	BIH.biSizeImage = 0;
-	void* m_pBits;
-	hDC2 = CreateCompatibleDC(NULL);//we make a new DC and DIbitmap for OpenGL to draw onto
-	static  PIXELFORMATDESCRIPTOR pfd2;
-	DescribePixelFormat(hDC2, 1, sizeof(PIXELFORMATDESCRIPTOR), &pfd2);//just get a random pixel format.. 
-	BIH.biBitCount = pfd2.cColorBits;//to get the current bit depth.. !?
-	hBMP = CreateDIBSection(hDC2, (BITMAPINFO*)&BIH, DIB_RGB_COLORS, &m_pBits, NULL, 0);
+void FDAI::InitBall() {
+
+	BITMAPINFO bi;
+	void *bits = NULL;
+
+	memset(&bi, 0, sizeof(bi));
+	bi.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
+	bi.bmiHeader.biWidth = 180;				//size of the sphere is 180x180
+	bi.bmiHeader.biHeight = -180;			//top-down rows, as the renderer writes them
+	bi.bmiHeader.biPlanes = 1;
+	bi.bmiHeader.biBitCount = 32;
+	bi.bmiHeader.biCompression = BI_RGB;
+	hDC2 = CreateCompatibleDC(NULL);//we make a new DC and DIbitmap for the ball renderer to draw onto
+	hBMP = CreateDIBSection(hDC2, &bi, DIB_RGB_COLORS, &bits, NULL, 0);
 	hBMP_old = (HBITMAP)SelectObject(hDC2, hBMP);
-	static  PIXELFORMATDESCRIPTOR pfd = {                             // pfd Tells Windows How We Want Things To Be
-		sizeof(PIXELFORMATDESCRIPTOR),                              // Size Of This Pixel Format Descriptor
-		1,                                                          // Version Number
-		PFD_DRAW_TO_BITMAP |                                        // Format Must Support Bitmap Rendering
-		PFD_SUPPORT_OPENGL |
-		PFD_SUPPORT_GDI,											// Format Must Support OpenGL,                                           
-		0,//        PFD_TYPE_RGBA,                                              // Request An RGBA Format
-		16,															// Select Our Color Depth
-		0, 0, 0, 0, 0, 0,                                           // Color Bits Ignored
-		0,//1,                                                          // No Alpha Buffer
-		0,                                                          // Shift Bit Ignored
-		0,                                                          // No Accumulation Buffer
-		0, 0, 0, 0,                                                 // Accumulation Bits Ignored
-		0,//16,                                                         // 16Bit Z-Buffer (Depth Buffer)  
-		0,                                                          // No Stencil Buffer
-		0,                                                          // No Auxiliary Buffer
-		0,//PFD_MAIN_PLANE,                                             // Main Drawing Layer
-		0,                                                          // Reserved
-		0, 0, 0                                                     // Layer Masks Ignored
-	};
-	pfd.cColorBits = pfd2.cColorBits;//same color depth needed.
-	DWORD code;
-	code = GetLastError();
-	PixelFormat = ChoosePixelFormat(hDC2, &pfd);// now pretend we want a new format
-	int ret;
-	ret = SetPixelFormat(hDC2, PixelFormat, &pfd);
-	code = GetLastError();
-	hRC = wglCreateContext(hDC2);
-	ret = wglMakeCurrent(hDC2, hRC);				//all standard OpenGL init so far
+	ballBits = (unsigned *)bits;
+	if (ballBits) memset(ballBits, 0, 180 * 180 * sizeof(unsigned));	// Panel Background color
 
 	//We load the texture
-	int texture_index;
+	ball.Init(180);
 	if (LM_FDAI)
 	{
-		texture_index = LoadOGLBitmap("Textures\\ProjectApollo\\FDAI_Ball_LM.dds");
+		ball.LoadTexture("Textures\\ProjectApollo\\FDAI_Ball_LM.dds");
 	}
 	else
 	{
-		texture_index = LoadOGLBitmap("Textures\\ProjectApollo\\FDAI_Ball.dds");
+		ball.LoadTexture("Textures\\ProjectApollo\\FDAI_Ball.dds");
 	}
-	if (texture_index > 0) glEnable(GL_TEXTURE_2D);
-
-	glShadeModel(GL_SMOOTH);                        // Enable Smooth Shading
-	glClearColor(0.0f, 0.0f, 0.0f, 0.0f);           // Panel Background color
-	glClearDepth(1.0f);                             // Depth Buffer Setup
-	glEnable(GL_DEPTH_TEST);                        // Enables Depth Testing
-	glDepthFunc(GL_LESS);                           // The Type Of Depth Testing To Do
-	glViewport(0, 0, 180, 180);                     // Reset The Current Viewport
-	glMatrixMode(GL_PROJECTION);                    // Select The Projection Matrix
-	glLoadIdentity();                               // Reset The Projection Matrix
-	gluPerspective(45.0f, 1.0, 1.0f, 1000.0f);
-	glMatrixMode(GL_MODELVIEW);                     // Select The Modelview Matrix          
-	glLoadIdentity();                               // Reset The Projection Matrix
-
-	//some ambiental setup
-	GLfloat light_position[] = { -10.0,10.0,10.0,0.0 };
-	GLfloat light_diffuse[] = { 1.0f, 1.0f, 1.0f, 1.0f };
-	GLfloat light_ambient[] = { 1.0f, 1.0f, 1.0f, 1.0f };
-	GLfloat mat_specular[] = { (float) 0.5, (float) 0.5, (float) 0.5, 1.0 };
-	GLfloat mat_shin[] = { 5.0 };
-	glMaterialfv(GL_FRONT, GL_SPECULAR, mat_specular);
-	glEnable(GL_LIGHTING);
-	glLightfv(GL_LIGHT0, GL_DIFFUSE, light_diffuse);
-	glLightfv(GL_LIGHT0, GL_POSITION, light_position);
-	glLightfv(GL_LIGHT0, GL_AMBIENT, light_ambient);
-	glLightfv(GL_LIGHT0, GL_SPECULAR, mat_specular);
-	glEnable(GL_LIGHT0);
-
-	//defining our geometry and composing a display list;
-	list_name = glGenLists(1);
-	glNewList(list_name, GL_COMPILE);
-	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);             // Clear The Screen And The Depth Buffer        
-	glColor3f(1.0, 1.0, 1.0);
-	quadObj = gluNewQuadric();
-	gluQuadricTexture(quadObj, GL_TRUE);
-	gluSphere(quadObj, 12, 24, 24);
-	glEndList();
-
-	init = 1;		//that's it. If we made it so far, we can use OpenGL
+
+	init = 1;
 }
 
 FDAI::~FDAI() {
 
 	if (init) {
-		gluDeleteQuadric(quadObj);
-		wglMakeCurrent(NULL, NULL);	//standard OpenGL release
-		BOOL ret = wglDeleteContext(hRC);
-		hRC = NULL;
 		SelectObject(hDC2, hBMP_old);//remember to delete DC and bitmap memory we created
 		DeleteObject(hBMP);
 		DeleteDC(hDC2);
 		hDC2 = 0;
 	}
+	if (hBmpRollRotated) {
+		DeleteObject(hBmpRollRotated);
+		hBmpRollRotated = NULL;
+	}
 }
 
 void FDAI::RegisterMe(int index, int x, int y) {
@@ -266,32 +207,18 @@ void FDAI::RotateBall(double simdt) {
 		now.x += delta;
 }
 
-void FDAI::MoveBall2D()
-{
-	glLoadIdentity();
-	gluLookAt(0.0, -35.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0);
-
-	glRotatef(90.0, 0.0, 1.0, 0.0);
-
-	glRotated(now.y / PI * 180.0, 0.0, 1.0, 0.0);	//attitude.x
-	glRotated(now.x / PI * 180.0, 1.0, 0.0, 0.0);	//attitude.z
-	glRotated(now.z / PI * 180.0, 0.0, 0.0, 1.0);	//attitude.y
-
-	lastPaintAtt = now;
-}
-
 void FDAI::PaintMe(VECTOR3 rates, VECTOR3 errors, SURFHANDLE surf, SURFHANDLE hFDAI,
 	SURFHANDLE hFDAIRoll, SURFHANDLE hFDAIOff, SURFHANDLE hFDAINeedles, HBITMAP hBmpRoll, int smooth) {
 
-	if (!init) InitGL();
+	if (!init) InitBall();
 
-	// Don't do the OpenGL calculations every timestep
+	// Don't render the ball every timestep
 	if (smooth || lastPaintTime == -1 || ((length(lastPaintAtt - target) > 0.005 || oapiGetSysTime() > lastPaintTime + 2.0) && oapiGetSysTime() > lastPaintTime + 0.1)) {
-		int ret = wglMakeCurrent(hDC2, hRC);
-		MoveBall2D();
-		glCallList(list_name);	//render
-		glFlush();
-		glFinish();
+		if (ballBits) {
+			GdiFlush();	// GDI must be done with the DIB section before we write to it
+			ball.Render(now.y, now.x, now.z, ballBits, 180);
+		}
+		lastPaintAtt = now;
 
 		lastPaintTime = oapiGetSysTime();
 	}
@@ -299,31 +226,32 @@ void FDAI::PaintMe(VECTOR3 rates, VECTOR3 errors, SURFHANDLE surf, SURFHANDLE hF
 	HDC hDC = oapiGetDC(surf);
 	BitBlt(hDC, 43, 43, 150, 150, hDC2, 10, 10, SRCCOPY);//then we bitblt onto the panel.
 
-	// roll indicator
-	HDC hDCRotate;
-	int rotateX, rotateY;
+	// roll indicator, only rotated again when the roll changes
 	double angle = -target.y;
 
-	HDC hDCTemp = CreateCompatibleDC(hDC);
-	HBITMAP hBmpTemp = (HBITMAP)SelectObject(hDCTemp, hBmpRoll);
+	if (!hBmpRollRotated || angle != rollRotatedAngle) {
+		HDC hDCRotate;
+
+		if (hBmpRollRotated) DeleteObject(hBmpRollRotated);
+
+		HDC hDCTemp = CreateCompatibleDC(hDC);
+		HBITMAP hBmpTemp = (HBITMAP)SelectObject(hDCTemp, hBmpRoll);
 
-	HBITMAP hBmpRotate = RotateMemoryDC(hBmpRoll, hDCTemp, 20, 20, (float)(PI - angle), hDCRotate, rotateX, rotateY);
-	HBITMAP hBmpXXX = CreateCompatibleBitmap(hDCRotate, rotateX, rotateY);
-	SelectObject(hDCRotate, hBmpXXX);
+		hBmpRollRotated = RotateMemoryDC(hBmpRoll, hDCTemp, 20, 20, (float)(PI - angle), hDCRotate, rollRotatedX, rollRotatedY);
+		rollRotatedAngle = angle;
+
+		DeleteDC(hDCRotate);	// this releases the rotated bitmap for DrawTransparentBitmap
+		SelectObject(hDCTemp, hBmpTemp);
+		DeleteDC(hDCTemp);
+	}
 
 	double radius = 62;
 	// Was + 93 and 92
-	int targetX = ((int)(sin(-angle) * radius)) + 123 - ((int)(rotateX / 2));
-	int targetY = ((int)(-cos(-angle) * radius)) + 122 - ((int)(rotateY / 2));
+	int targetX = ((int)(sin(-angle) * radius)) + 123 - ((int)(rollRotatedX / 2));
+	int targetY = ((int)(-cos(-angle) * radius)) + 122 - ((int)(rollRotatedY / 2));
 	int targetZ = 0;
 
-	DrawTransparentBitmap(hDC, hBmpRotate, targetX, targetY, 0x00FF00FF);
-
-	DeleteObject(hBmpXXX);
-	DeleteObject(hBmpTemp);
-	DeleteObject(hBmpRotate);
-	DeleteDC(hDCTemp);
-	DeleteDC(hDCRotate);
+	DrawTransparentBitmap(hDC, hBmpRollRotated, targetX, targetY, 0x00FF00FF);
 
 	oapiReleaseDC(surf, hDC);
 
@@ -459,52 +387,6 @@ void FDAI::SystemTimestep(double simdt) {
 	}
 }
 
-int FDAI::LoadOGLBitmap(char *filename) {
-
-	unsigned char *l_texture;
-	int l_index, l_index2 = 0;
-	FILE *file;
-	BITMAPFILEHEADER fileheader;
-	BITMAPINFOHEADER infoheader;
-	RGBTRIPLE rgb;
-	int num_texture = 1; //we only use one OGL texture ,so...
-
-
-	if ((file = fopen(filename, "rb")) == NULL) return (-1);
-	fread(&fileheader, sizeof(fileheader), 1, file);
-	fseek(file, sizeof(fileheader), SEEK_SET);
-	fread(&infoheader, sizeof(infoheader), 1, file);
-
-	l_texture = (byte *)malloc(infoheader.biWidth * infoheader.biHeight * 4);
-	memset(l_texture, 0, infoheader.biWidth * infoheader.biHeight * 4);
-
-	for (l_index = 0; l_index < infoheader.biWidth*infoheader.biHeight; l_index++)
-	{
-		fread(&rgb, sizeof(rgb), 1, file);
-
-		l_texture[l_index2 + 0] = rgb.rgbtRed; // Red component
-		l_texture[l_index2 + 1] = rgb.rgbtGreen; // Green component
-		l_texture[l_index2 + 2] = rgb.rgbtBlue; // Blue component
-		l_texture[l_index2 + 3] = 255; // Alpha value
-		l_index2 += 4; // Go to the next position
-	}
-
-	fclose(file); // Closes the file stream
-
-	glBindTexture(GL_TEXTURE_2D, num_texture);
-
-	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-	//glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-	glTexEnvf(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
-	glTexImage2D(GL_TEXTURE_2D, 0, 4, infoheader.biWidth, infoheader.biHeight,
-		0, GL_RGBA, GL_UNSIGNED_BYTE, l_texture);
-	free(l_texture);
-
-	return (num_texture);
-}
-
 void DrawTransparentBitmap(HDC hdc, HBITMAP hBitmap, short xStart,
 	short yStart, COLORREF cTransparentColor) {
 
@@ -0,0 +1,346 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  Software renderer for the FDAI ball
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#include <stdio.h>
+#include <math.h>
+#include "FDAIBall.h"
+
+//Define FDAIBALL_NO_SIMD to build the scalar reference path
+#if !defined(FDAIBALL_NO_SIMD) && (defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__))
+#define FDAIBALL_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+	const float PI_F = 3.14159265f;
+
+	//Ball and view geometry of the former OpenGL rendering
+	const double BALL_RADIUS = 12.0;
+	const double VIEW_DISTANCE = 35.0;
+	const double VIEW_HALF_ANGLE = 22.5 * 3.14159265358979323846 / 180.0;
+
+	//Arctangent on [0,1], Abramowitz & Stegun 4.4.49, error below 1e-5
+	const float ATAN_C1 = 0.9998660f;
+	const float ATAN_C3 = -0.3302995f;
+	const float ATAN_C5 = 0.1801410f;
+	const float ATAN_C7 = -0.0851330f;
+	const float ATAN_C9 = 0.0208351f;
+
+	float FastAtan2(float y, float x)
+	{
+		float ax = fabsf(x), ay = fabsf(y);
+		float mx = ax > ay ? ax : ay;
+		float mn = ax > ay ? ay : ax;
+		float a = mx > 0.0f ? mn / mx : 0.0f;
+		float s = a * a;
+		float r = a * (ATAN_C1 + s * (ATAN_C3 + s * (ATAN_C5 + s * (ATAN_C7 + s * ATAN_C9))));
+		if (ay > ax) r = 0.5f*PI_F - r;
+		if (x < 0.0f) r = PI_F - r;
+		if (y < 0.0f) r = -r;
+		return r;
+	}
+
+#ifdef FDAIBALL_SSE2
+	__m128 FastAtan2(__m128 y, __m128 x)
+	{
+		const __m128 signmask = _mm_set1_ps(-0.0f);
+		__m128 ax = _mm_andnot_ps(signmask, x);
+		__m128 ay = _mm_andnot_ps(signmask, y);
+		__m128 mx = _mm_max_ps(ax, ay);
+		__m128 mn = _mm_min_ps(ax, ay);
+		__m128 nonzero = _mm_cmpgt_ps(mx, _mm_setzero_ps());
+		__m128 a = _mm_and_ps(nonzero, _mm_div_ps(mn, _mm_or_ps(mx, _mm_andnot_ps(nonzero, _mm_set1_ps(1.0f)))));
+		__m128 s = _mm_mul_ps(a, a);
+		__m128 r = _mm_add_ps(_mm_set1_ps(ATAN_C7), _mm_mul_ps(s, _mm_set1_ps(ATAN_C9)));
+		r = _mm_add_ps(_mm_set1_ps(ATAN_C5), _mm_mul_ps(s, r));
+		r = _mm_add_ps(_mm_set1_ps(ATAN_C3), _mm_mul_ps(s, r));
+		r = _mm_add_ps(_mm_set1_ps(ATAN_C1), _mm_mul_ps(s, r));
+		r = _mm_mul_ps(a, r);
+		__m128 m = _mm_cmpgt_ps(ay, ax);
+		r = _mm_or_ps(_mm_and_ps(m, _mm_sub_ps(_mm_set1_ps(0.5f*PI_F), r)), _mm_andnot_ps(m, r));
+		m = _mm_cmplt_ps(x, _mm_setzero_ps());
+		r = _mm_or_ps(_mm_and_ps(m, _mm_sub_ps(_mm_set1_ps(PI_F), r)), _mm_andnot_ps(m, r));
+		return _mm_xor_ps(r, _mm_and_ps(signmask, y));
+	}
+#endif
+
+	//Rotation matrices as in glRotate
+	void RotationX(double a, double R[9])
+	{
+		double c = cos(a), s = sin(a);
+		R[0] = 1.0; R[1] = 0.0; R[2] = 0.0;
+		R[3] = 0.0; R[4] = c; R[5] = -s;
+		R[6] = 0.0; R[7] = s; R[8] = c;
+	}
+
+	void RotationY(double a, double R[9])
+	{
+		double c = cos(a), s = sin(a);
+		R[0] = c; R[1] = 0.0; R[2] = s;
+		R[3] = 0.0; R[4] = 1.0; R[5] = 0.0;
+		R[6] = -s; R[7] = 0.0; R[8] = c;
+	}
+
+	void RotationZ(double a, double R[9])
+	{
+		double c = cos(a), s = sin(a);
+		R[0] = c; R[1] = -s; R[2] = 0.0;
+		R[3] = s; R[4] = c; R[5] = 0.0;
+		R[6] = 0.0; R[7] = 0.0; R[8] = 1.0;
+	}
+
+	void Multiply(const double A[9], const double B[9], double C[9])
+	{
+		int i, j;
+		for (i = 0;i < 3;i++)
+		{
+			for (j = 0;j < 3;j++)
+			{
+				C[i * 3 + j] = A[i * 3] * B[j] + A[i * 3 + 1] * B[3 + j] + A[i * 3 + 2] * B[6 + j];
+			}
+		}
+	}
+}
+
+FDAIBall::FDAIBall()
+{
+	size = 0;
+	npix = 0;
+	texW = 0;
+	texH = 0;
+}
+
+void FDAIBall::Init(int sz)
+{
+	int i, j;
+	double tanhalf, xn, yn, d[3], b, c, disc, t, n[3], len, ndotl, ndoth, lv;
+
+	size = sz;
+	nx.clear(); ny.clear(); nz.clear();
+	pixelX.clear(); pixelY.clear();
+	light.clear();
+
+	//View frame: camera on the -y axis looking at the ball center, z up. Light and viewer direction in the same frame,
+	//the light was set up in eye coordinates at (-10,10,10).
+	const double L[3] = { -1.0 / sqrt(3.0), -1.0 / sqrt(3.0), 1.0 / sqrt(3.0) };
+	double H[3] = { L[0], L[1] - 1.0, L[2] };
+	len = sqrt(H[0] * H[0] + H[1] * H[1] + H[2] * H[2]);
+	H[0] /= len; H[1] /= len; H[2] /= len;
+
+	tanhalf = tan(VIEW_HALF_ANGLE);
+	for (j = 0;j < size;j++)
+	{
+		yn = 1.0 - 2.0*(j + 0.5) / size;
+		for (i = 0;i < size;i++)
+		{
+			xn = 2.0*(i + 0.5) / size - 1.0;
+
+			//Ray from the camera through the pixel center
+			d[0] = xn * tanhalf;
+			d[1] = 1.0;
+			d[2] = yn * tanhalf;
+			b = -VIEW_DISTANCE * d[1];
+			c = VIEW_DISTANCE * VIEW_DISTANCE - BALL_RADIUS * BALL_RADIUS;
+			len = d[0] * d[0] + d[1] * d[1] + d[2] * d[2];
+			disc = b * b - len * c;
+			if (disc < 0.0) continue;
+			t = (-b - sqrt(disc)) / len;
+
+			n[0] = t * d[0] / BALL_RADIUS;
+			n[1] = (t * d[1] - VIEW_DISTANCE) / BALL_RADIUS;
+			n[2] = t * d[2] / BALL_RADIUS;
+
+			//Fixed function lighting: global and light ambient, diffuse and specular
+			ndotl = n[0] * L[0] + n[1] * L[1] + n[2] * L[2];
+			lv = 0.2*0.2 + 0.2*1.0;
+			if (ndotl > 0.0)
+			{
+				lv += 0.8*ndotl;
+				ndoth = n[0] * H[0] + n[1] * H[1] + n[2] * H[2];
+				if (ndoth > 0.0) lv += 0.5*0.5*pow(ndoth, 5.0);
+			}
+			if (lv > 1.0) lv = 1.0;
+
+			nx.push_back((float)n[0]);
+			ny.push_back((float)n[1]);
+			nz.push_back((float)n[2]);
+			pixelX.push_back(i);
+			pixelY.push_back(j);
+			light.push_back((int)(lv*256.0 + 0.5));
+		}
+	}
+
+	npix = (int)nx.size();
+	while (nx.size() % 4)
+	{
+		nx.push_back(nx.back());
+		ny.push_back(ny.back());
+		nz.push_back(nz.back());
+		pixelX.push_back(pixelX.back());
+		pixelY.push_back(pixelY.back());
+		light.push_back(light.back());
+	}
+}
+
+bool FDAIBall::LoadTexture(const char *filename)
+{
+	unsigned char header[54], rgb[3];
+	int width, height, i;
+	FILE *file;
+
+	if ((file = fopen(filename, "rb")) == NULL) return false;
+	if (fread(header, 1, 54, file) != 54 || header[0] != 'B' || header[1] != 'M')
+	{
+		fclose(file);
+		return false;
+	}
+	width = header[18] | (header[19] << 8) | (header[20] << 16) | (header[21] << 24);
+	height = header[22] | (header[23] << 8) | (header[24] << 16) | (header[25] << 24);
+	if (width <= 0 || height <= 0)
+	{
+		fclose(file);
+		return false;
+	}
+
+	std::vector<unsigned> texels(width * height);
+	for (i = 0;i < width * height;i++)
+	{
+		if (fread(rgb, 1, 3, file) != 3) break;
+		texels[i] = ((unsigned)rgb[2] << 16) | ((unsigned)rgb[1] << 8) | rgb[0];
+	}
+	fclose(file);
+
+	SetTexture(texels.data(), width, height);
+	return true;
+}
+
+void FDAIBall::SetTexture(const unsigned *texels, int width, int height)
+{
+	texture.assign(texels, texels + width * height);
+	texW = width;
+	texH = height;
+}
+
+unsigned FDAIBall::Sample(float u, float v, int shade)
+{
+	//Bilinear filter, the texture repeats around the ball and is clamped at the poles
+	float fu = floorf(u), fv = floorf(v);
+	int iu = (int)fu, iv = (int)fv;
+	int wu = (int)((u - fu)*256.0f), wv = (int)((v - fv)*256.0f);
+	int u0 = iu % texW, u1;
+	if (u0 < 0) u0 += texW;
+	u1 = u0 + 1 == texW ? 0 : u0 + 1;
+	int v0 = iv < 0 ? 0 : (iv >= texH ? texH - 1 : iv);
+	int v1 = iv + 1 < 0 ? 0 : (iv + 1 >= texH ? texH - 1 : iv + 1);
+
+	unsigned t00 = texture[u0 + v0 * texW], t01 = texture[u1 + v0 * texW];
+	unsigned t10 = texture[u0 + v1 * texW], t11 = texture[u1 + v1 * texW];
+	unsigned out = 0;
+	int sh, c0, c1, c;
+	for (sh = 0;sh < 24;sh += 8)
+	{
+		c0 = (((t00 >> sh) & 0xFF) * (256 - wu) + ((t01 >> sh) & 0xFF) * wu);
+		c1 = (((t10 >> sh) & 0xFF) * (256 - wu) + ((t11 >> sh) & 0xFF) * wu);
+		c = ((c0 * (256 - wv) + c1 * wv) >> 16) * shade >> 8;
+		out |= (unsigned)(c > 255 ? 255 : c) << sh;
+	}
+	return out;
+}
+
+void FDAIBall::RenderScalar(int first, int last, const float M[9], unsigned *dst, int stride)
+{
+	int k;
+	float ox, oy, oz, u, v;
+
+	for (k = first;k < last;k++)
+	{
+		ox = M[0] * nx[k] + M[1] * ny[k] + M[2] * nz[k];
+		oy = M[3] * nx[k] + M[4] * ny[k] + M[5] * nz[k];
+		oz = M[6] * nx[k] + M[7] * ny[k] + M[8] * nz[k];
+
+		//Texture coordinates of gluSphere
+		u = FastAtan2(-ox, oy) * (0.5f / PI_F);
+		if (u < 0.0f) u += 1.0f;
+		v = 0.5f + FastAtan2(oz, sqrtf(ox * ox + oy * oy)) / PI_F;
+
+		dst[pixelX[k] + pixelY[k] * stride] = Sample(u * texW - 0.5f, v * texH - 0.5f, light[k]);
+	}
+}
+
+void FDAIBall::Render(double roll, double yaw, double pitch, unsigned *dst, int stride)
+{
+	double R1[9], R2[9], R3[9], T[9], R[9];
+	float M[9];
+	int i, j;
+
+	if (npix == 0 || texW == 0) return;
+
+	//Ball attitude as the former glRotate sequence, the transpose takes view frame normals to the ball frame
+	RotationY(PI_F / 2.0 + roll, R1);
+	RotationX(yaw, R2);
+	RotationZ(pitch, R3);
+	Multiply(R1, R2, T);
+	Multiply(T, R3, R);
+	for (i = 0;i < 3;i++)
+	{
+		for (j = 0;j < 3;j++)
+		{
+			M[i * 3 + j] = (float)R[j * 3 + i];
+		}
+	}
+
+#ifdef FDAIBALL_SSE2
+	const __m128 m0 = _mm_set1_ps(M[0]), m1 = _mm_set1_ps(M[1]), m2 = _mm_set1_ps(M[2]);
+	const __m128 m3 = _mm_set1_ps(M[3]), m4 = _mm_set1_ps(M[4]), m5 = _mm_set1_ps(M[5]);
+	const __m128 m6 = _mm_set1_ps(M[6]), m7 = _mm_set1_ps(M[7]), m8 = _mm_set1_ps(M[8]);
+	const __m128 signmask = _mm_set1_ps(-0.0f);
+	const __m128 uscale = _mm_set1_ps(0.5f / PI_F * texW), vscale = _mm_set1_ps(texH / PI_F);
+	const __m128 ubias = _mm_set1_ps(-0.5f), vbias = _mm_set1_ps(0.5f * texH - 0.5f);
+	float u[4], v[4];
+	int k, l;
+
+	for (k = 0;k < npix;k += 4)
+	{
+		__m128 x = _mm_loadu_ps(&nx[k]);
+		__m128 y = _mm_loadu_ps(&ny[k]);
+		__m128 z = _mm_loadu_ps(&nz[k]);
+		__m128 ox = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m0, x), _mm_mul_ps(m1, y)), _mm_mul_ps(m2, z));
+		__m128 oy = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m3, x), _mm_mul_ps(m4, y)), _mm_mul_ps(m5, z));
+		__m128 oz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m6, x), _mm_mul_ps(m7, y)), _mm_mul_ps(m8, z));
+
+		__m128 a = FastAtan2(_mm_xor_ps(ox, signmask), oy);
+		a = _mm_add_ps(a, _mm_and_ps(_mm_cmplt_ps(a, _mm_setzero_ps()), _mm_set1_ps(2.0f * PI_F)));
+		__m128 b = FastAtan2(oz, _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(ox, ox), _mm_mul_ps(oy, oy))));
+		_mm_storeu_ps(u, _mm_add_ps(_mm_mul_ps(a, uscale), ubias));
+		_mm_storeu_ps(v, _mm_add_ps(_mm_mul_ps(b, vscale), vbias));
+
+		for (l = 0;l < 4;l++)
+		{
+			dst[pixelX[k + l] + pixelY[k + l] * stride] = Sample(u[l], v[l], light[k + l]);
+		}
+	}
+#else
+	RenderScalar(0, npix, M, dst, stride);
+#endif
+}
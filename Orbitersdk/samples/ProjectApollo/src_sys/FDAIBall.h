@@ -0,0 +1,63 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  Software renderer for the FDAI ball (Header)
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#pragma once
+
+#include <vector>
+
+//Draws the textured and lit FDAI ball without a graphics API. The view of the ball never changes, so the unit sphere
+//normal and the lighting of every ball pixel are calculated once. Each frame only rotates the normals into the ball
+//frame and looks up the texture, four pixels at a time with SSE2. The geometry matches the former OpenGL rendering:
+//a ball of radius 12 seen from 35 units away with a 45° field of view, textured like gluSphere.
+//Pixels are 32 bit 0x00RRGGBB, as in a 32 bpp DIB section.
+class FDAIBall
+{
+public:
+	FDAIBall();
+
+	//Calculates the sphere mapping tables for a square image of the given size
+	void Init(int size);
+	//Loads the ball texture from an uncompressed 24 bit bitmap file. Returns false if the file can't be read.
+	bool LoadTexture(const char *filename);
+	//Sets the ball texture, rows from bottom to top as in a bitmap file
+	void SetTexture(const unsigned *texels, int width, int height);
+	//Draws the ball at the FDAI angles (radians) into dst, stride is the row length in pixels. Only the pixels covered
+	//by the ball are written, the background has to be cleared once by the caller.
+	void Render(double roll, double yaw, double pitch, unsigned *dst, int stride);
+
+	bool HasTexture() { return texW > 0; }
+	int GetSize() { return size; }
+protected:
+	void RenderScalar(int first, int last, const float M[9], unsigned *dst, int stride);
+	unsigned Sample(float u, float v, int shade);
+
+	int size;
+	//Ball pixels, padded to a multiple of four with the last pixel
+	int npix;
+	std::vector<float> nx, ny, nz;		//Unit sphere normal in the view frame
+	std::vector<int> pixelX, pixelY;	//Pixel position, from the top left corner
+	std::vector<int> light;				//Lighting factor, 256 = 1.0
+
+	std::vector<unsigned> texture;
+	int texW, texH;
+};
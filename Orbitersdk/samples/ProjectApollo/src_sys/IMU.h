@@ -30,6 +30,7 @@
 #include "apolloguidance.h"
 
 #include "powersource.h"
+#include "imukernel.h"
 
 class IMU {
 
@@ -140,6 +141,12 @@ protected:
 		MATRIX3 AttitudeReference;
 	} Orbiter;
 
+	// Global to vessel rotation of the current frame, Orbiter.Attitude holds its angles for the scenario
+	IMUQuat Attitude;
+	// Global to vessel rotation at the end of the last frame, start of the gimbal sub-steps
+	IMUQuat LastAttitude;
+	bool LastAttitudeValid;
+
 	VECTOR3 LastWeightAcceleration;
 	VECTOR3 LastGlobalVel;
 
@@ -0,0 +1,417 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  Lunar terrain elevation cache
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+// To force orbitersdk.h to use <fstream> in any compiler version
+#pragma include_alias( <fstream.h>, <fstream> )
+#include "Orbitersdk.h"
+#include <stdio.h>
+#include <math.h>
+#include <vector>
+#include "LunarTerrain.h"
+
+#define TILE LUNARTERRAIN_TILE_SIZE
+
+static int64_t TileKey(int ti, int tj)
+{
+	return ((int64_t)ti << 32) | (uint32_t)tj;
+}
+
+LunarTerrain::LunarTerrain()
+{
+	hPlanet = NULL;
+	radius = 0.0;
+	rows = 180 * LUNARTERRAIN_RESOLUTION + 1;
+	cols = 360 * LUNARTERRAIN_RESOLUTION;
+	usecount = 0;
+	unpinned = 0;
+	fillbudget = -1;
+	nodata = false;
+	lasttile = NULL;
+	lastkey = -1;
+}
+
+LunarTerrain::~LunarTerrain()
+{
+	Clear();
+}
+
+LunarTerrain &LunarTerrain::Get()
+{
+	static LunarTerrain terrain;
+	return terrain;
+}
+
+void LunarTerrain::Init()
+{
+	if (hPlanet == NULL)
+	{
+		hPlanet = oapiGetObjectByName("Moon");
+		if (hPlanet) radius = oapiGetSize(hPlanet);
+	}
+}
+
+OBJHANDLE LunarTerrain::GetPlanet()
+{
+	std::lock_guard<std::mutex> guard(lock);
+	Init();
+	return hPlanet;
+}
+
+double LunarTerrain::GetRadius()
+{
+	std::lock_guard<std::mutex> guard(lock);
+	Init();
+	return radius;
+}
+
+void LunarTerrain::Clear()
+{
+	std::lock_guard<std::mutex> guard(lock);
+
+	for (auto it = tiles.begin();it != tiles.end();++it)
+	{
+		delete it->second;
+	}
+	tiles.clear();
+	unpinned = 0;
+	lasttile = NULL;
+	lastkey = -1;
+}
+
+bool LunarTerrain::FillTile(Tile *t, int ti, int tj)
+{
+	int i, j, gi, gj;
+	double lat, lng;
+
+	for (i = t->Filled;i < TILE;i++)
+	{
+		if (fillbudget >= 0)
+		{
+			if (fillbudget < TILE) return false;
+			fillbudget -= TILE;
+		}
+
+		gi = ti * TILE + i;
+		if (gi > rows - 1) gi = rows - 1;
+		lat = ((double)gi / LUNARTERRAIN_RESOLUTION - 90.0)*RAD;
+		for (j = 0;j < TILE;j++)
+		{
+			gj = tj * TILE + j;
+			lng = (double)gj / LUNARTERRAIN_RESOLUTION * RAD;
+			if (lng > PI) lng -= PI2;
+			t->h[i][j] = hPlanet ? (float)oapiSurfaceElevation(hPlanet, lng, lat) : 0.0f;
+		}
+		t->Filled = i + 1;
+	}
+	return true;
+}
+
+void LunarTerrain::Evict()
+{
+	std::unordered_map<int64_t, Tile*>::iterator oldest = tiles.end();
+
+	for (auto it = tiles.begin();it != tiles.end();++it)
+	{
+		if (it->second->Pinned) continue;
+		if (oldest == tiles.end() || it->second->LastUse < oldest->second->LastUse)
+		{
+			oldest = it;
+		}
+	}
+	if (oldest == tiles.end()) return;
+
+	if (oldest->second == lasttile)
+	{
+		lasttile = NULL;
+		lastkey = -1;
+	}
+	delete oldest->second;
+	tiles.erase(oldest);
+	unpinned--;
+}
+
+LunarTerrain::Tile *LunarTerrain::GetTile(int ti, int tj)
+{
+	int64_t key = TileKey(ti, tj);
+	Tile *t;
+
+	if (key == lastkey) return lasttile;
+
+	auto it = tiles.find(key);
+	if (it != tiles.end())
+	{
+		t = it->second;
+	}
+	else
+	{
+		if (unpinned >= LUNARTERRAIN_MAX_TILES) Evict();
+		t = new Tile;
+		t->Pinned = false;
+		t->Filled = 0;
+		tiles[key] = t;
+		unpinned++;
+	}
+	t->LastUse = ++usecount;
+	if (t->Filled < TILE && !FillTile(t, ti, tj))
+	{
+		return NULL;
+	}
+	lasttile = t;
+	lastkey = key;
+	return t;
+}
+
+float LunarTerrain::GridPoint(int i, int j)
+{
+	if (i < 0) i = 0;
+	if (i > rows - 1) i = rows - 1;
+	j %= cols;
+	if (j < 0) j += cols;
+
+	Tile *t = GetTile(i / TILE, j / TILE);
+	if (t == NULL)
+	{
+		nodata = true;
+		return 0.0f;
+	}
+	return t->h[i % TILE][j % TILE];
+}
+
+double LunarTerrain::Interpolate(double lat, double lng)
+{
+	double x, y, fx, fy;
+	int i, j;
+
+	x = (lat*DEG + 90.0)*LUNARTERRAIN_RESOLUTION;
+	y = fmod(lng*DEG, 360.0);
+	if (y < 0.0) y += 360.0;
+	y *= LUNARTERRAIN_RESOLUTION;
+
+	i = (int)floor(x);
+	j = (int)floor(y);
+	fx = x - i;
+	fy = y - j;
+
+	return (1.0 - fx)*((1.0 - fy)*GridPoint(i, j) + fy * GridPoint(i, j + 1)) + fx * ((1.0 - fy)*GridPoint(i + 1, j) + fy * GridPoint(i + 1, j + 1));
+}
+
+double LunarTerrain::Elevation(double lat, double lng)
+{
+	std::lock_guard<std::mutex> guard(lock);
+	Init();
+	return Interpolate(lat, lng);
+}
+
+void LunarTerrain::Elevations(int n, const double *lat, const double *lng, double *alt)
+{
+	std::lock_guard<std::mutex> guard(lock);
+	int i;
+
+	Init();
+	for (i = 0;i < n;i++)
+	{
+		alt[i] = Interpolate(lat[i], lng[i]);
+	}
+}
+
+double LunarTerrain::Trace(const VECTOR3 &R, const VECTOR3 &u)
+{
+	VECTOR3 P;
+	double s, r, h, cos_ang, lat, lng;
+	int iter;
+
+	//Move along the ray by the height above the terrain under the current point, divided by the cosine of the
+	//angle to the local vertical. Over a flat surface that is exact in one step.
+	s = 0.0;
+	for (iter = 0;iter < 20;iter++)
+	{
+		P = R + u * s;
+		r = length(P);
+		lat = asin(P.y / r);
+		lng = atan2(P.z, P.x);
+		h = r - radius - Interpolate(lat, lng);
+		if (nodata) return LUNARTERRAIN_NODATA;
+		if (fabs(h) < 0.05) return s;
+
+		cos_ang = -dotp(P, u) / r;
+		//Looking up or along the horizon
+		if (cos_ang < 0.01) return -1.0;
+
+		s += h / cos_ang;
+		if (s < 0.0) s = 0.0;
+	}
+	return s;
+}
+
+double LunarTerrain::RayRange(const VECTOR3 &R, const VECTOR3 &u, int maxfill)
+{
+	std::lock_guard<std::mutex> guard(lock);
+	double s;
+
+	Init();
+	fillbudget = maxfill;
+	nodata = false;
+	s = Trace(R, u);
+	fillbudget = -1;
+	return s;
+}
+
+double LunarTerrain::BeamRange(const VECTOR3 &R, const VECTOR3 &u, double halfwidth, int n, int maxfill)
+{
+	std::lock_guard<std::mutex> guard(lock);
+	VECTOR3 a, b, v;
+	double s, sum, ang;
+	int i, hits;
+
+	Init();
+	fillbudget = maxfill;
+	nodata = false;
+	s = Trace(R, u);
+	if (s < 0.0)
+	{
+		fillbudget = -1;
+		return s == LUNARTERRAIN_NODATA ? s : -1.0;
+	}
+
+	//Two unit vectors normal to the beam
+	a = crossp(u, fabs(u.x) < 0.9 ? _V(1.0, 0.0, 0.0) : _V(0.0, 1.0, 0.0));
+	a = unit(a);
+	b = crossp(u, a);
+
+	sum = s;
+	hits = 1;
+	for (i = 0;i < n;i++)
+	{
+		ang = PI2 * i / n;
+		v = u * cos(halfwidth) + (a*cos(ang) + b * sin(ang))*sin(halfwidth);
+		s = Trace(R, v);
+		if (nodata) break;
+		if (s >= 0.0)
+		{
+			sum += s;
+			hits++;
+		}
+	}
+	fillbudget = -1;
+
+	//A partial beam would jump as its tiles fill in
+	if (nodata) return LUNARTERRAIN_NODATA;
+	return sum / hits;
+}
+
+void LunarTerrain::Prewarm(double lat, double lng, double r)
+{
+	std::lock_guard<std::mutex> guard(lock);
+	int i0, i1, j0, j1, ti, tj;
+	double dlat, dlng;
+
+	Init();
+	if (radius <= 0.0) return;
+
+	dlat = r / radius;
+	dlng = cos(lat) > 0.01 ? dlat / cos(lat) : PI;
+	if (dlng > PI) dlng = PI;
+
+	i0 = (int)floor(((lat - dlat)*DEG + 90.0)*LUNARTERRAIN_RESOLUTION);
+	i1 = (int)floor(((lat + dlat)*DEG + 90.0)*LUNARTERRAIN_RESOLUTION);
+	j0 = (int)floor((lng - dlng)*DEG*LUNARTERRAIN_RESOLUTION);
+	j1 = (int)floor((lng + dlng)*DEG*LUNARTERRAIN_RESOLUTION);
+	if (i0 < 0) i0 = 0;
+	if (i1 > rows - 1) i1 = rows - 1;
+
+	for (ti = i0 / TILE;ti <= i1 / TILE;ti++)
+	{
+		for (tj = (int)floor((double)j0 / TILE);tj <= (int)floor((double)j1 / TILE);tj++)
+		{
+			GetTile(ti, ((tj % (cols / TILE)) + cols / TILE) % (cols / TILE));
+		}
+	}
+}
+
+bool LunarTerrain::LoadDEM(const char *file)
+{
+	LunarTerrainDEMHeader hdr;
+	char buffer[256];
+	int ti, tj, i, j, count;
+	FILE *f;
+
+	f = fopen(file, "rb");
+	if (f == NULL) return false;
+
+	if (fread(&hdr, sizeof(hdr), 1, f) != 1 || hdr.Magic != LUNARTERRAIN_DEM_MAGIC || hdr.Version != LUNARTERRAIN_DEM_VERSION ||
+		hdr.Resolution != LUNARTERRAIN_RESOLUTION || hdr.Row0 < 0 || hdr.Col0 < 0 || hdr.Rows <= 0 || hdr.Cols <= 0)
+	{
+		fclose(f);
+		sprintf(buffer, "Lunar terrain: %s is not a DEM file with %d points per degree", file, LUNARTERRAIN_RESOLUTION);
+		oapiWriteLog(buffer);
+		return false;
+	}
+
+	std::vector<float> data((size_t)hdr.Rows*hdr.Cols);
+	if (fread(data.data(), sizeof(float), data.size(), f) != data.size())
+	{
+		fclose(f);
+		sprintf(buffer, "Lunar terrain: %s is too short", file);
+		oapiWriteLog(buffer);
+		return false;
+	}
+	fclose(f);
+
+	std::lock_guard<std::mutex> guard(lock);
+	count = 0;
+	for (ti = (hdr.Row0 + TILE - 1) / TILE;(ti + 1)*TILE <= hdr.Row0 + hdr.Rows;ti++)
+	{
+		for (tj = (hdr.Col0 + TILE - 1) / TILE;(tj + 1)*TILE <= hdr.Col0 + hdr.Cols;tj++)
+		{
+			int64_t key = TileKey(ti, tj % (cols / TILE));
+			Tile *t;
+
+			auto it = tiles.find(key);
+			if (it != tiles.end())
+			{
+				t = it->second;
+				if (!t->Pinned) unpinned--;
+			}
+			else
+			{
+				t = new Tile;
+				tiles[key] = t;
+			}
+			t->Pinned = true;
+			t->Filled = TILE;
+			t->LastUse = usecount;
+			for (i = 0;i < TILE;i++)
+			{
+				for (j = 0;j < TILE;j++)
+				{
+					t->h[i][j] = data[(size_t)(ti*TILE + i - hdr.Row0)*hdr.Cols + (tj*TILE + j - hdr.Col0)];
+				}
+			}
+			count++;
+		}
+	}
+
+	sprintf(buffer, "Lunar terrain: loaded %d tiles from %s", count, file);
+	oapiWriteLog(buffer);
+	return true;
+}
@@ -0,0 +1,147 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  Lunar terrain elevation cache (Header)
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+#include <mutex>
+#include <unordered_map>
+
+// ****************************************************************
+// The lunar surface elevation is sampled on a regular latitude and
+// longitude grid and kept in square tiles. A tile is filled with
+// oapiSurfaceElevation the first time a point in it is needed, or
+// from a binary DEM file. Queries interpolate bilinearly between
+// the grid points, so after the first pass over an area they don't
+// call into Orbiter at all.
+//
+// Grid point (i, j) is at latitude i / Resolution - 90 deg and
+// longitude j / Resolution deg east.
+//
+// DEM file: a LunarTerrainDEMHeader followed by Rows * Cols floats,
+// the elevation above the mean radius in meters, row by row from
+// grid row Row0 and grid column Col0 on. Only tiles which are
+// completely inside the file are loaded, and they stay in the cache.
+//
+// Filling a tile takes TILE_SIZE^2 oapiSurfaceElevation calls.
+// Callers in the frame loop pass a fill limit, the tile is then
+// filled a few rows per call over several frames, and the query
+// returns LUNARTERRAIN_NODATA until it is complete.
+// ****************************************************************
+
+//Grid points per degree, about 30 m on the Moon
+#define LUNARTERRAIN_RESOLUTION		1024
+//Grid points per tile side
+#define LUNARTERRAIN_TILE_SIZE		32
+//Tiles kept in the cache, not counting tiles from a DEM file
+#define LUNARTERRAIN_MAX_TILES		1024
+//Grid points a query in the frame loop may fill from Orbiter
+#define LUNARTERRAIN_FRAME_FILL		256
+//Returned by the range queries while a tile they need isn't filled yet
+#define LUNARTERRAIN_NODATA			-2.0
+
+#define LUNARTERRAIN_DEM_MAGIC		0x4D45444E	// "NDEM"
+#define LUNARTERRAIN_DEM_VERSION	1
+
+#pragma pack(push, 4)
+
+struct LunarTerrainDEMHeader
+{
+	uint32_t Magic;
+	uint32_t Version;
+	int32_t Resolution;
+	int32_t Row0;
+	int32_t Col0;
+	int32_t Rows;
+	int32_t Cols;
+	int32_t Reserved;
+};
+
+#pragma pack(pop)
+
+class LunarTerrain
+{
+public:
+	LunarTerrain();
+	~LunarTerrain();
+
+	//Cache shared by everything in this module
+	static LunarTerrain &Get();
+
+	OBJHANDLE GetPlanet();
+	//Mean radius the elevations refer to
+	double GetRadius();
+
+	//Elevation above the mean radius in meters
+	double Elevation(double lat, double lng);
+	//Same for n points, with one lock for all of them
+	void Elevations(int n, const double *lat, const double *lng, double *alt);
+
+	//Distance from R along the unit vector u to the surface, or -1 if the ray doesn't hit the surface.
+	//Both vectors are in the rotating Moon frame of Orbiter (left handed, y to the north pole).
+	//At most maxfill grid points are filled from Orbiter, -1 for no limit.
+	double RayRange(const VECTOR3 &R, const VECTOR3 &u, int maxfill = -1);
+	//Mean distance to the surface within a beam, from the center ray and n rays on a cone with half angle halfwidth. Returns -1 if the center ray misses.
+	double BeamRange(const VECTOR3 &R, const VECTOR3 &u, double halfwidth, int n, int maxfill = -1);
+
+	//Fills all tiles within radius (m) around a site
+	void Prewarm(double lat, double lng, double radius);
+	//Loads tiles from a DEM file, returns false if the file can't be used
+	bool LoadDEM(const char *file);
+	void Clear();
+
+protected:
+	struct Tile
+	{
+		unsigned LastUse;
+		bool Pinned;
+		//Rows filled so far
+		int Filled;
+		float h[LUNARTERRAIN_TILE_SIZE][LUNARTERRAIN_TILE_SIZE];
+	};
+
+	void Init();
+	Tile *GetTile(int ti, int tj);
+	bool FillTile(Tile *t, int ti, int tj);
+	void Evict();
+	float GridPoint(int i, int j);
+	double Interpolate(double lat, double lng);
+	double Trace(const VECTOR3 &R, const VECTOR3 &u);
+
+	std::mutex lock;
+	std::unordered_map<int64_t, Tile*> tiles;
+	OBJHANDLE hPlanet;
+	double radius;
+	int rows, cols;
+	unsigned usecount;
+	int unpinned;
+
+	//Grid points the current query may still fill, -1 for no limit
+	int fillbudget;
+	//Set when the current query needed a tile that isn't complete
+	bool nodata;
+
+	//Last tile used, most queries hit the same one
+	Tile *lasttile;
+	int64_t lastkey;
+};
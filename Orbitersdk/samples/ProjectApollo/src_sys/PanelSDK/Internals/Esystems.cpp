@@ -22,7 +22,7 @@
 
   **************************************************************************/
 
-#include "esystems.h"
+#include "Esystems.h"
 #include <math.h>
 #include <stdio.h>
 
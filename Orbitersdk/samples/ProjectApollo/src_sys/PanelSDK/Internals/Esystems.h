@@ -25,11 +25,11 @@
 #ifndef __ESYSTEMS_H_
 #define __ESYSTEMS_H_
 
-#include "thermal.h"
+#include "Thermal.h"
 // To force orbitersdk.h to use <fstream> in any compiler version
 #pragma include_alias( <fstream.h>, <fstream> )
 #include "Orbitersdk.h"
-#include "hsystems.h"
+#include "Hsystems.h"
 
 class E_system;
 
@@ -22,8 +22,8 @@
 
   **************************************************************************/
 
-#include "hsystems.h"
-#include "orbitersdk.h"
+#include "Hsystems.h"
+#include "Orbitersdk.h"
 #include <stdio.h>
 #include <math.h>
 #include "nasspdefs.h"
@@ -153,6 +153,12 @@ void ship_system::ConfigStage(int stage)
 				};
 }
 
+H_system::H_system() {
+
+	P_electric = NULL;
+	AtmPressure = 0.0;
+}
+
 void H_system::Save(FILEHANDLE scn) { 
 	
 	ship_object *runner;
@@ -1104,7 +1110,7 @@ void h_Evaporator::refresh(double dt) {  //Need to look at these values (-0.11,
 	if (!h_pump) throttle_temp = 0;
 
 	// The evaporators don't work inside the atmosphere, they stop working shortly before apex cover jettison
-	if (parent->Vessel->GetAtmPressure() > 30000.0) {
+	if (parent->AtmPressure > 30000.0) {
 		throttle_temp = 0;
 		steamUnderPressure = -0.11;
 	}
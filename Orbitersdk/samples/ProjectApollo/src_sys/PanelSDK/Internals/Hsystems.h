@@ -53,10 +53,10 @@ const double CRITICAL_T [MAX_SUB]=  {154.7,		33.2,		647.3,		126.2,		304.4,		256.
 
 const double FaradaysConstant = 96485.3321233100184; //Coulombs/mol
 
-#include "thermal.h"
+#include "Thermal.h"
 // To force orbitersdk.h to use <fstream> in any compiler version
 #pragma include_alias( <fstream.h>, <fstream> )
-#include "orbitersdk.h"
+#include "Orbitersdk.h"
 
 //base class for hydraulic objects
 class h_substance
@@ -133,8 +133,10 @@ class H_system:public ship_system
 	void Create_h_Accumulator(char* line);
 
 public:
+	H_system();
 
 	E_system* P_electric;
+	double AtmPressure;	//Pa, read on the main thread by PanelSDK::UpdateEnvironment
 	void* GetPointerByString(char *query);
 	void Load (FILEHANDLE scn);
 	void Save (FILEHANDLE scn);
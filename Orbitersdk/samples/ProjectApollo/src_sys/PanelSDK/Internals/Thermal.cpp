@@ -22,7 +22,7 @@
 
   **************************************************************************/
 
-#include "thermal.h"
+#include "Thermal.h"
 #include <math.h>
 #include <stdio.h>
 
@@ -67,8 +67,12 @@ Thermal_engine::Thermal_engine() {
 	distance_matrix = NULL;
 	InSun = 0;
 	InPlanet = 0;
+	PlanetDistanceFactor = 0;
+	PlanetIsSun = false;
+	PlanetIsEarth = false;
 
 	ObjToDebug = NULL;
+	DebugLine[0] = 0;
 }
 
 void Thermal_engine::Save(FILEHANDLE scn)
@@ -162,7 +166,10 @@ void Thermal_engine::GetSun() {
 		InPlanet = 0.0;
 }
 
-void Thermal_engine::Radiative(double dt) {
+void Thermal_engine::UpdateEnvironment() {
+
+	if (ObjToDebug)
+		strcpy(oapiDebugString(), DebugLine);
 
 	GetSun();// need to convert the myr and sun vectors to local coordinates
 
@@ -172,15 +179,15 @@ void Thermal_engine::Radiative(double dt) {
 	sun.selfnormalize();
 
 	char planetName[1000];
-	bool planetIsSun = false;
-	bool planetIsEarth = false;
+	PlanetIsSun = false;
+	PlanetIsEarth = false;
 
 	oapiGetObjectName(Planet, planetName, 255);
 
-	if (!strcmp(planetName, "Sun")) planetIsSun = true;
-	if (!strcmp(planetName, "Earth")) planetIsEarth = true;
+	if (!strcmp(planetName, "Sun")) PlanetIsSun = true;
+	if (!strcmp(planetName, "Earth")) PlanetIsEarth = true;
 
-	if (!planetIsSun) {
+	if (!PlanetIsSun) {
 		VECTOR3 LocalR;
 		v->Global2Local(_V(ToSun.x - ToPlanet.x,
   	  					   ToSun.y - ToPlanet.y,
@@ -188,6 +195,11 @@ void Thermal_engine::Radiative(double dt) {
 		myr = _vector3(LocalR.x, LocalR.y, LocalR.z);
 		myr.selfnormalize();
 	}
+}
+
+void Thermal_engine::Radiative(double dt) {
+
+	//Uses the sun and planet of the last UpdateEnvironment, no Orbiter API calls here
 
 	//Flux=q*T^4*Area;
 
@@ -197,7 +209,7 @@ void Thermal_engine::Radiative(double dt) {
 	runner=List.next_t;
 
 	while (runner) {
-		if (planetIsEarth) {
+		if (PlanetIsEarth) {
 			Q = (float) (190.0 * (runner->pos % myr) * PlanetDistanceFactor); //blank radiation from Earth
 		} else {
 			Q = 0;
@@ -206,18 +218,18 @@ void Thermal_engine::Radiative(double dt) {
 		if (Q < 0.0) Q = 0.0;
 		
 		Q1 = 0.0;
-		if (InSun || planetIsSun) Q1 = (float) (1372.0 * (runner->pos % sun));	//we are not behind planet,
+		if (InSun || PlanetIsSun) Q1 = (float) (1372.0 * (runner->pos % sun));	//we are not behind planet,
 		if (Q1 > 0)	Q += Q1;
 
 		Q2 = 0.0;
-		if (!planetIsSun && InPlanet > 0) Q2 = (float) (300.0 * (runner->pos % myr) * InPlanet);  //300W from planet's albedo
+		if (!PlanetIsSun && InPlanet > 0) Q2 = (float) (300.0 * (runner->pos % myr) * InPlanet);  //300W from planet's albedo
 		if (Q2 > 0) Q += Q2;
 
 		Q3 = (float) (q * pow(runner->Temp - 3.0, 4));
 		Q -= Q3;
 
 		if (ObjToDebug && runner == ObjToDebug) 
-			sprintf(oapiDebugString(), "Earth %.1f Sun %.1f Albedo %.1f Space %.1f Ges %.1f Temp %.1f", (Q0>0?Q0:0) * runner->Area * runner->isolation, (Q1>0?Q1:0) * runner->Area * runner->isolation, (Q2>0?Q2:0) * runner->Area * runner->isolation, -Q3 * runner->Area * runner->isolation, Q * runner->Area * runner->isolation, runner->GetTemp());
+			sprintf(DebugLine, "Earth %.1f Sun %.1f Albedo %.1f Space %.1f Ges %.1f Temp %.1f", (Q0>0?Q0:0) * runner->Area * runner->isolation, (Q1>0?Q1:0) * runner->Area * runner->isolation, (Q2>0?Q2:0) * runner->Area * runner->isolation, -Q3 * runner->Area * runner->isolation, Q * runner->Area * runner->isolation, runner->GetTemp());
 
 		runner->thermic(Q * runner->Area * dt * runner->isolation);
 		runner=runner->next_t;
@@ -25,10 +25,10 @@
 #ifndef __THERMAL_H_
 #define __THERMAL_H_
 
-#include "../matrix.h"
+#include "../Matrix.h"
 // To force orbitersdk.h to use <fstream> in any compiler version
 #pragma include_alias( <fstream.h>, <fstream> )
-#include "orbitersdk.h"
+#include "Orbitersdk.h"
 
 class therm_obj			//thermal object.an object that can receive thermal energy
 { public:
@@ -57,6 +57,7 @@ public:
   void InitThermal();	//builds a bunch of tables we'll need at runtime
 
   void GetSun();
+  void UpdateEnvironment();	//caches the sun and planet in local coordinates for Radiative
   void Conductive(double dt);	//runs the conductive calculations inbetween the thermal objects
   void Radiative(double dt);	//- II -   radiative   - II -, only for external objects..
 
@@ -79,8 +80,11 @@ public:
   int InSun;
   double InPlanet;
   double PlanetDistanceFactor;
+  bool PlanetIsSun;
+  bool PlanetIsEarth;
 
   therm_obj* ObjToDebug;
+  char DebugLine[256];	//output for ObjToDebug, shown by UpdateEnvironment
 };
 
 ///
@@ -23,7 +23,7 @@
   **************************************************************************/
 
 #include <stdio.h>
-#include "esystems.h"
+#include "Esystems.h"
 #include "../BUILD.H"
 
 void E_system::Create_Boiler(char *line) {
@@ -26,7 +26,8 @@
 #include "Internals/Thermal.h"
 #include "Internals/Hsystems.h"
 #include "Internals/Esystems.h"
-#include "vsmgmt.h"
+#include "VSMGMT.H"
+#include "profiler.h"
 
 PanelSDK::PanelSDK() {
 
@@ -250,6 +251,8 @@ void PanelSDK::Timestep(double time)
 	double dt = time - lastTime;
 	lastTime = time;
 
+	UpdateEnvironment();
+
 	double mintFactor = __max(dt / 100.0, 0.5);
 	double tFactor = __min(mintFactor, dt);
 	while (dt > 0) {
@@ -265,11 +268,32 @@ void PanelSDK::Timestep(double time)
 void PanelSDK::SimpleTimestep(double simdt) 
 
 {
+	UpdateEnvironment();
+	StepSystems(simdt);
+}
+
+void PanelSDK::UpdateEnvironment()
+
+{
+	THERMAL->UpdateEnvironment();
+	HYDRAULIC->AtmPressure = v->GetAtmPressure();
+}
+
+void PanelSDK::StepSystems(double simdt)
+
+{
+	PROFILESCOPE("PanelSDK::SimpleTimestep");
 	THERMAL->Radiative(simdt);
 	HYDRAULIC->Refresh(simdt);
 	ELECTRIC->Refresh(simdt);
 }
 
+double PanelSDK::GetAtmPressure()
+
+{
+	return HYDRAULIC->AtmPressure;
+}
+
 void PanelSDK::SetStage(int stage,int load)
 {
 if ((!load)&&(stage-1!=CurentStage)) return; //only process succesive separations
@@ -86,6 +86,11 @@ public:
 	void MFDEvent(int mfd);
 	void Timestep(double time);
 	void SimpleTimestep(double simdt);
+	//Reads the vessel's surroundings (sun, planet, atmosphere) with the Orbiter API
+	void UpdateEnvironment();
+	//Steps the systems with the surroundings of the last UpdateEnvironment, makes no Orbiter API calls
+	void StepSystems(double simdt);
+	double GetAtmPressure();
 	void SetStage(int stage,int load);
 	void AddElectrical(e_object *e, bool can_delete);
 	void AddHydraulic(h_object *h);
@@ -22,7 +22,7 @@
 
   **************************************************************************/
 
-#include "vectors.h"
+#include "Vectors.h"
 #include <math.h>
 
 const double PI   = 3.14159265358979;
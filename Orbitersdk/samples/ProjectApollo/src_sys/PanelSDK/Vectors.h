@@ -26,7 +26,7 @@
 #define _VECTORS_
 
 
-#include "matrix.h"
+#include "Matrix.h"
 class matrix;
 class vector3
 { public:
@@ -37,7 +37,7 @@ class vector3
   //constructors
       vector3(double _x,double _y,double _z) {set(_x,_y,_z);}
 	  vector3()	{set(0.0,0.0,0.0);}
-	  vector3(vector3 &v) {set(v.x,v.y,v.z);}
+	  vector3(const vector3 &v) {set(v.x,v.y,v.z);}
   //operators
 	//vector to vector
   vector3 operator+ (vector3);
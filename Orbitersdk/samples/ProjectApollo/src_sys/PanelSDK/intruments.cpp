@@ -25,8 +25,6 @@
 #include "instruments.h"
 #include <stdio.h>
 #include <math.h>
-#include < GL\gl.h >
-#include < GL\glu.h >
 
 instrument::instrument(int x, int y,Panel* i_parent) //basic constructor. Sets position and registers the instrument
 { ScrX=x;ScrY=y;parent=i_parent;
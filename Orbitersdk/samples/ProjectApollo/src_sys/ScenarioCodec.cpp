@@ -0,0 +1,536 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  Scenario file reading and writing
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+// To force orbitersdk.h to use <fstream> in any compiler version
+#pragma include_alias( <fstream.h>, <fstream> )
+#include "Orbitersdk.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "ScenarioCodec.h"
+
+//Powers of ten that are exact doubles
+static const double ExactPowersOfTen[23] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+
+static inline bool IsBlank(char c)
+{
+	return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f';
+}
+
+bool ScenarioParseDouble(const char *s, const char **end, double &d)
+{
+	const char *p = s;
+	unsigned long long m = 0;
+	int digits = 0, exp10 = 0, e = 0;
+	bool neg = false, eneg = false, any = false, exact = true;
+	char *q;
+
+	if (*p == '-' || *p == '+')
+	{
+		neg = (*p == '-');
+		p++;
+	}
+	while (*p >= '0' && *p <= '9')
+	{
+		any = true;
+		if (digits < 19)
+		{
+			m = m * 10 + (*p - '0');
+			if (m) digits++;
+		}
+		else
+		{
+			exact = false;
+		}
+		p++;
+	}
+	if (*p == '.')
+	{
+		p++;
+		while (*p >= '0' && *p <= '9')
+		{
+			any = true;
+			if (digits < 19)
+			{
+				m = m * 10 + (*p - '0');
+				if (m) digits++;
+				exp10--;
+			}
+			else
+			{
+				exact = false;
+			}
+			p++;
+		}
+	}
+	if (!any)
+	{
+		//inf, nan and the like
+		d = strtod(s, &q);
+		if (q == s) return false;
+		if (end) *end = q;
+		return true;
+	}
+	if (*p == 'e' || *p == 'E')
+	{
+		const char *pe = p + 1;
+
+		if (*pe == '-' || *pe == '+')
+		{
+			eneg = (*pe == '-');
+			pe++;
+		}
+		//Otherwise the e isn't part of the number
+		if (*pe >= '0' && *pe <= '9')
+		{
+			while (*pe >= '0' && *pe <= '9')
+			{
+				if (e < 10000) e = e * 10 + (*pe - '0');
+				pe++;
+			}
+			exp10 += eneg ? -e : e;
+			p = pe;
+		}
+	}
+
+	//Both the mantissa and the power of ten are exact doubles, so a single multiplication or division rounds correctly
+	if (exact && m <= (1ULL << 53) && exp10 >= -22 && exp10 <= 22)
+	{
+		d = (double)m;
+		if (exp10 < 0) d /= ExactPowersOfTen[-exp10];
+		else d *= ExactPowersOfTen[exp10];
+		if (neg) d = -d;
+	}
+	else
+	{
+		d = strtod(s, &q);
+		p = q;
+	}
+	if (end) *end = p;
+	return true;
+}
+
+int ScenarioFormatDouble(char *buf, double d)
+{
+	const char *end;
+	double e;
+	int n, prec;
+
+	if (d == floor(d) && fabs(d) < 1e15)
+	{
+		return sprintf(buf, "%.0lf", d);
+	}
+	//The correctly rounded text with the fewest digits that reads back as d
+	for (prec = 15;prec < 17;prec++)
+	{
+		n = sprintf(buf, "%.*g", prec, d);
+		if (ScenarioParseDouble(buf, &end, e) && e == d) return n;
+	}
+	return sprintf(buf, "%.17g", d);
+}
+
+ScenarioLine::ScenarioLine()
+{
+	line = NULL;
+	count = 0;
+	hash = 0;
+}
+
+unsigned ScenarioLine::Hash(const char *s)
+{
+	//FNV-1a
+	unsigned h = 2166136261u;
+
+	while (*s)
+	{
+		h ^= (unsigned char)*s++;
+		h *= 16777619u;
+	}
+	return h;
+}
+
+bool ScenarioLine::Parse(const char *l)
+{
+	int i, j;
+
+	line = l;
+	count = 0;
+	hash = 0;
+	i = 0;
+	j = 0;
+	while (l[i] && count < SCENARIO_TOKENS_MAX)
+	{
+		while (IsBlank(l[i])) i++;
+		if (!l[i]) break;
+
+		if (j >= SCENARIO_LINE_MAX - 1) break;
+		starts[count] = i;
+		tokens[count] = j;
+		while (l[i] && !IsBlank(l[i]) && j < SCENARIO_LINE_MAX - 1)
+		{
+			buffer[j++] = l[i++];
+		}
+		buffer[j++] = 0;
+		count++;
+	}
+	if (count > 0) hash = Hash(buffer + tokens[0]);
+	return count > 0;
+}
+
+const char *ScenarioLine::Token(int i) const
+{
+	if (i < 0 || i >= count) return NULL;
+	return buffer + tokens[i];
+}
+
+bool ScenarioLine::Int(int i, int &v) const
+{
+	const char *s = Token(i);
+	char *end;
+	long l;
+
+	if (s == NULL) return false;
+	l = strtol(s, &end, 10);
+	if (end == s) return false;
+	v = (int)l;
+	return true;
+}
+
+bool ScenarioLine::Bool(int i, bool &v) const
+{
+	int j;
+
+	if (!Int(i, j)) return false;
+	v = (j != 0);
+	return true;
+}
+
+bool ScenarioLine::Double(int i, double &v) const
+{
+	const char *s = Token(i);
+
+	if (s == NULL) return false;
+	return ScenarioParseDouble(s, NULL, v);
+}
+
+bool ScenarioLine::Ints(int i, int *v, int len) const
+{
+	int k;
+
+	if (i + len > count) return false;
+	for (k = 0;k < len;k++)
+	{
+		if (!Int(i + k, v[k])) return false;
+	}
+	return true;
+}
+
+bool ScenarioLine::Doubles(int i, double *v, int len) const
+{
+	int k;
+
+	if (i + len > count) return false;
+	for (k = 0;k < len;k++)
+	{
+		if (!Double(i + k, v[k])) return false;
+	}
+	return true;
+}
+
+bool ScenarioLine::Rest(int i, std::string &s) const
+{
+	const char *p, *e;
+
+	if (i < 0 || i >= count) return false;
+	p = line + starts[i];
+	e = p;
+	while (*e && *e != '\t' && *e != '\n') e++;
+	s.assign(p, e - p);
+	return true;
+}
+
+ScenarioReader::ScenarioReader()
+{
+}
+
+void ScenarioReader::Add(const char *item, Type type, void *value, void *value2, int len)
+{
+	Binding b;
+	int i;
+
+	b.Item = item;
+	b.Hash = ScenarioLine::Hash(item);
+	b.type = type;
+	b.Value = value;
+	b.Value2 = value2;
+	b.Len = len;
+
+	//A second binding of an item replaces the first
+	i = Find(item, b.Hash);
+	if (i >= 0)
+	{
+		bindings[i] = b;
+		return;
+	}
+	bindings.push_back(b);
+	if (bindings.size() * 2 > slots.size())
+	{
+		Rehash();
+	}
+	else
+	{
+		unsigned mask = slots.size() - 1;
+		unsigned s = b.Hash & mask;
+
+		while (slots[s] >= 0) s = (s + 1) & mask;
+		slots[s] = bindings.size() - 1;
+	}
+}
+
+void ScenarioReader::Rehash()
+{
+	unsigned size = 64, mask, s, i;
+
+	while (size < bindings.size() * 4) size *= 2;
+	slots.assign(size, -1);
+	mask = size - 1;
+	for (i = 0;i < bindings.size();i++)
+	{
+		s = bindings[i].Hash & mask;
+		while (slots[s] >= 0) s = (s + 1) & mask;
+		slots[s] = i;
+	}
+}
+
+int ScenarioReader::Find(const char *key, unsigned hash) const
+{
+	unsigned mask, s;
+
+	if (slots.empty()) return -1;
+
+	mask = slots.size() - 1;
+	s = hash & mask;
+	while (slots[s] >= 0)
+	{
+		const Binding &b = bindings[slots[s]];
+		if (b.Hash == hash && !strcmp(b.Item, key)) return slots[s];
+		s = (s + 1) & mask;
+	}
+	return -1;
+}
+
+void ScenarioReader::Bool(const char *item, bool &b)
+{
+	Add(item, SCN_BOOL, &b);
+}
+
+void ScenarioReader::Int(const char *item, int &i)
+{
+	Add(item, SCN_INT, &i);
+}
+
+void ScenarioReader::Double(const char *item, double &d)
+{
+	Add(item, SCN_DOUBLE, &d);
+}
+
+void ScenarioReader::Double2(const char *item, double &d1, double &d2)
+{
+	Add(item, SCN_DOUBLE2, &d1, &d2);
+}
+
+void ScenarioReader::Vec(const char *item, VECTOR3 &v)
+{
+	Add(item, SCN_VEC, &v);
+}
+
+void ScenarioReader::Mat(const char *item, MATRIX3 &m)
+{
+	Add(item, SCN_MAT, &m);
+}
+
+void ScenarioReader::Ints(const char *item, int *v, int len)
+{
+	Add(item, SCN_INTS, v, NULL, len);
+}
+
+void ScenarioReader::Doubles(const char *item, double *v, int len)
+{
+	Add(item, SCN_DOUBLES, v, NULL, len);
+}
+
+void ScenarioReader::String(const char *item, std::string &s)
+{
+	Add(item, SCN_STRING, &s);
+}
+
+void ScenarioReader::Call(const char *item, const std::function<void(const ScenarioLine &)> &f)
+{
+	int i;
+
+	Add(item, SCN_CALL, NULL);
+	i = Find(item, ScenarioLine::Hash(item));
+	bindings[i].Func = f;
+}
+
+bool ScenarioReader::Read(const char *line)
+{
+	double d[9];
+	int i, n;
+
+	if (!current.Parse(line)) return false;
+	i = Find(current.Token(0), current.KeyHash());
+	if (i < 0) return false;
+
+	Binding &b = bindings[i];
+	n = current.Count() - 1;
+	if (n > b.Len) n = b.Len;
+	//Values are only changed if the whole line is read
+	switch (b.type)
+	{
+	case SCN_BOOL:
+		current.Bool(1, *(bool *)b.Value);
+		break;
+	case SCN_INT:
+		current.Int(1, *(int *)b.Value);
+		break;
+	case SCN_DOUBLE:
+		current.Double(1, *(double *)b.Value);
+		break;
+	case SCN_DOUBLE2:
+		if (current.Doubles(1, d, 2))
+		{
+			*(double *)b.Value = d[0];
+			*(double *)b.Value2 = d[1];
+		}
+		break;
+	case SCN_VEC:
+		if (current.Doubles(1, d, 3))
+		{
+			*(VECTOR3 *)b.Value = _V(d[0], d[1], d[2]);
+		}
+		break;
+	case SCN_MAT:
+		if (current.Doubles(1, d, 9))
+		{
+			*(MATRIX3 *)b.Value = _M(d[0], d[1], d[2], d[3], d[4], d[5], d[6], d[7], d[8]);
+		}
+		break;
+	case SCN_INTS:
+		current.Ints(1, (int *)b.Value, n);
+		break;
+	case SCN_DOUBLES:
+		current.Doubles(1, (double *)b.Value, n);
+		break;
+	case SCN_STRING:
+		current.Rest(1, *(std::string *)b.Value);
+		break;
+	case SCN_CALL:
+		b.Func(current);
+		break;
+	}
+	return true;
+}
+
+ScenarioWriter::ScenarioWriter(const char *item)
+{
+	len = snprintf(buffer, SCENARIO_LINE_MAX, "  %s", item);
+	if (len < 0 || len >= SCENARIO_LINE_MAX) len = SCENARIO_LINE_MAX - 1;
+}
+
+ScenarioWriter &ScenarioWriter::Int(int i)
+{
+	char num[16];
+
+	sprintf(num, "%d", i);
+	return String(num);
+}
+
+ScenarioWriter &ScenarioWriter::Double(double d)
+{
+	char num[32];
+
+	ScenarioFormatDouble(num, d);
+	return String(num);
+}
+
+ScenarioWriter &ScenarioWriter::Vec(const VECTOR3 &v)
+{
+	return Double(v.x).Double(v.y).Double(v.z);
+}
+
+ScenarioWriter &ScenarioWriter::Mat(const MATRIX3 &m)
+{
+	return Double(m.m11).Double(m.m12).Double(m.m13).Double(m.m21).Double(m.m22).Double(m.m23).Double(m.m31).Double(m.m32).Double(m.m33);
+}
+
+ScenarioWriter &ScenarioWriter::String(const char *s)
+{
+	int n = strlen(s);
+
+	if (len + 1 + n < SCENARIO_LINE_MAX)
+	{
+		buffer[len++] = ' ';
+		memcpy(buffer + len, s, n + 1);
+		len += n;
+	}
+	return *this;
+}
+
+void ScenarioWriter::Write(FILEHANDLE scn)
+{
+	oapiWriteLine(scn, buffer);
+}
+
+void ScenarioWrite_double(FILEHANDLE scn, const char *item, double d)
+{
+	ScenarioWriter(item).Double(d).Write(scn);
+}
+
+void ScenarioWrite_double2(FILEHANDLE scn, const char *item, double d1, double d2)
+{
+	ScenarioWriter(item).Double(d1).Double(d2).Write(scn);
+}
+
+void ScenarioWrite_vec(FILEHANDLE scn, const char *item, const VECTOR3 &v)
+{
+	ScenarioWriter(item).Vec(v).Write(scn);
+}
+
+void ScenarioWrite_mx(FILEHANDLE scn, const char *item, const MATRIX3 &m)
+{
+	ScenarioWriter(item).Mat(m).Write(scn);
+}
+
+void ScenarioWrite_doublearr(FILEHANDLE scn, const char *item, const double *v, int len)
+{
+	ScenarioWriter w(item);
+	int i;
+
+	for (i = 0;i < len;i++)
+	{
+		w.Double(v[i]);
+	}
+	w.Write(scn);
+}
@@ -0,0 +1,173 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  Scenario file reading and writing (Header)
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <functional>
+
+// ****************************************************************
+// The papiReadScenario functions each scan the whole line again to
+// compare its first word with their item, so a state with a few
+// hundred items scans every line a few hundred times.
+//
+// ScenarioReader instead has the values bound to their items once.
+// Each line is split into words once, the first word is hashed and
+// looked up in a hash table, and only the value bound to it is
+// parsed. Numbers are converted directly where that is exact and
+// by strtod otherwise.
+//
+// The writers give each double the fewest digits that still read
+// back as the same double, so saving and loading a state doesn't
+// change it, unlike the fixed 12 decimals of papiWriteScenario.
+// Both formats are read by both the papi functions and these.
+// ****************************************************************
+
+//Longest line and most words per line that are read
+#define SCENARIO_LINE_MAX		1024
+#define SCENARIO_TOKENS_MAX		48
+
+//Converts the number at the start of s, end is set behind it. Returns false if s doesn't start with a number.
+bool ScenarioParseDouble(const char *s, const char **end, double &d);
+//Shortest text that reads back as d, returns its length
+int ScenarioFormatDouble(char *buf, double d);
+
+//One line of a scenario file, split into words
+class ScenarioLine
+{
+public:
+	ScenarioLine();
+
+	//Returns false if the line has no words
+	bool Parse(const char *line);
+
+	int Count() const { return count; }
+	const char *Token(int i) const;
+	//Hash of the first word
+	unsigned KeyHash() const { return hash; }
+
+	bool Int(int i, int &v) const;
+	bool Bool(int i, bool &v) const;
+	bool Double(int i, double &v) const;
+	//Words i to i + len - 1
+	bool Ints(int i, int *v, int len) const;
+	bool Doubles(int i, double *v, int len) const;
+	//Everything from word i up to a tab or the end of the line
+	bool Rest(int i, std::string &s) const;
+
+	static unsigned Hash(const char *s);
+
+protected:
+	char buffer[SCENARIO_LINE_MAX];
+	const char *line;
+	int tokens[SCENARIO_TOKENS_MAX];
+	int starts[SCENARIO_TOKENS_MAX];
+	int count;
+	unsigned hash;
+};
+
+class ScenarioReader
+{
+public:
+	ScenarioReader();
+
+	//Binds a value to an item. Items have to be string literals, or live as long as the reader.
+	void Bool(const char *item, bool &b);
+	void Int(const char *item, int &i);
+	void Double(const char *item, double &d);
+	void Double2(const char *item, double &d1, double &d2);
+	void Vec(const char *item, VECTOR3 &v);
+	void Mat(const char *item, MATRIX3 &m);
+	//Arrays take as many values as the line has, up to len
+	void Ints(const char *item, int *v, int len);
+	void Doubles(const char *item, double *v, int len);
+	void String(const char *item, std::string &s);
+	//Calls f with the line for anything not covered by the above
+	void Call(const char *item, const std::function<void(const ScenarioLine &)> &f);
+
+	//Sets the value bound to the first word of line. Returns false if nothing is bound to it.
+	bool Read(const char *line);
+	//Last line read
+	const ScenarioLine &Line() const { return current; }
+
+protected:
+	enum Type
+	{
+		SCN_BOOL,
+		SCN_INT,
+		SCN_DOUBLE,
+		SCN_DOUBLE2,
+		SCN_VEC,
+		SCN_MAT,
+		SCN_INTS,
+		SCN_DOUBLES,
+		SCN_STRING,
+		SCN_CALL
+	};
+
+	struct Binding
+	{
+		const char *Item;
+		unsigned Hash;
+		Type type;
+		void *Value;
+		void *Value2;
+		int Len;
+		std::function<void(const ScenarioLine &)> Func;
+	};
+
+	void Add(const char *item, Type type, void *value, void *value2 = NULL, int len = 0);
+	int Find(const char *key, unsigned hash) const;
+	void Rehash();
+
+	std::vector<Binding> bindings;
+	//Open addressing hash table of binding indices, -1 is empty
+	std::vector<int> slots;
+	ScenarioLine current;
+};
+
+void ScenarioWrite_double(FILEHANDLE scn, const char *item, double d);
+void ScenarioWrite_double2(FILEHANDLE scn, const char *item, double d1, double d2);
+void ScenarioWrite_vec(FILEHANDLE scn, const char *item, const VECTOR3 &v);
+void ScenarioWrite_mx(FILEHANDLE scn, const char *item, const MATRIX3 &m);
+void ScenarioWrite_doublearr(FILEHANDLE scn, const char *item, const double *v, int len);
+
+//Builds a line of mixed values
+class ScenarioWriter
+{
+public:
+	ScenarioWriter(const char *item);
+
+	ScenarioWriter &Int(int i);
+	ScenarioWriter &Double(double d);
+	ScenarioWriter &Vec(const VECTOR3 &v);
+	ScenarioWriter &Mat(const MATRIX3 &m);
+	ScenarioWriter &String(const char *s);
+
+	void Write(FILEHANDLE scn);
+
+protected:
+	char buffer[SCENARIO_LINE_MAX];
+	int len;
+};
@@ -0,0 +1,230 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  Mission sound timeline
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include "SoundTimeline.h"
+
+SoundTimeline::SoundTimeline()
+{
+	cursor = 0;
+}
+
+void SoundTimeline::Clear()
+{
+	events.clear();
+	errors.clear();
+	cursor = 0;
+}
+
+//Reads the digits at s into v, returns false if there are none
+static bool ParseNumber(const char *&s, int &v)
+{
+	const char *start = s;
+
+	v = 0;
+	while (*s >= '0' && *s <= '9')
+	{
+		if (v > 100000000) return false;
+		v = v * 10 + (*s - '0');
+		s++;
+	}
+	return s != start;
+}
+
+static bool IsSpace(char c)
+{
+	return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+bool SoundTimeline::ParseLine(const char *line, Format format, SoundTimelineEvent &ev, std::string &err)
+{
+	const char *s = line;
+	const char *end;
+	bool negative = false;
+	int hours, minutes, seconds;
+
+	ev.Priority = 9;
+	ev.LaunchRelative = true;
+	ev.Name.clear();
+
+	//
+	// Time
+	//
+
+	if (*s == '-')
+	{
+		negative = true;
+		s++;
+	}
+	if (!ParseNumber(s, hours) || *s++ != ':')
+	{
+		err = "hours expected";
+		return false;
+	}
+	if (!ParseNumber(s, minutes) || *s++ != ':')
+	{
+		err = "minutes expected";
+		return false;
+	}
+	if (!ParseNumber(s, seconds) || *s++ != ';')
+	{
+		err = "seconds and ';' expected";
+		return false;
+	}
+	if (minutes > 59 || seconds > 59)
+	{
+		err = "minutes and seconds must be 0-59";
+		return false;
+	}
+	ev.Time = seconds + minutes * 60.0 + hours * 3600.0;
+	if (negative) ev.Time = -ev.Time;
+
+	//
+	// Launch or re-entry and priority
+	//
+
+	if (format == FORMAT_PRIORITY)
+	{
+		if ((*s == 'l' || *s == 'L' || *s == 'r' || *s == 'R') && s[1] == ';')
+		{
+			ev.LaunchRelative = (*s == 'l' || *s == 'L');
+			s += 2;
+		}
+		else
+		{
+			err = "'l' or 'r' expected";
+			return false;
+		}
+
+		if (*s >= '0' && *s <= '9' && s[1] == ';')
+		{
+			ev.Priority = *s - '0';
+			s += 2;
+		}
+		else
+		{
+			err = "priority must be 0-9";
+			return false;
+		}
+	}
+
+	//
+	// File name. In sound.csv type files it ends at the first blank,
+	// the csmsound.csv names can have blanks in them.
+	//
+
+	end = s;
+	if (format == FORMAT_MET)
+	{
+		while (*end && !IsSpace(*end)) end++;
+	}
+	else
+	{
+		end = s + strlen(s);
+		while (end > s && IsSpace(end[-1])) end--;
+	}
+	if (end == s)
+	{
+		err = "file name expected";
+		return false;
+	}
+	ev.Name.assign(s, end - s);
+	return true;
+}
+
+bool SoundTimeline::LoadFromFile(const char *path, Format format)
+{
+	FILE *fp;
+	SoundTimelineEvent ev;
+	std::string line, err;
+	char buffer[256];
+	int c, lineno = 0;
+	bool comment;
+	unsigned i;
+
+	Clear();
+
+	fp = fopen(path, "r");
+	if (!fp)
+		return false;
+
+	do
+	{
+		//
+		// Read in a line, without the comment.
+		//
+
+		line.clear();
+		comment = false;
+		while ((c = fgetc(fp)) != '\n' && c != EOF)
+		{
+			if (c == '#')
+				comment = true;
+			if (!comment)
+				line += (char)c;
+		}
+		lineno++;
+
+		for (i = 0;i < line.length() && IsSpace(line[i]);i++);
+		if (i == line.length())
+			continue;
+
+		if (ParseLine(line.c_str(), format, ev, err))
+		{
+			ev.Line = lineno;
+			events.push_back(ev);
+		}
+		else
+		{
+			snprintf(buffer, sizeof(buffer), "line %d: %s", lineno, err.c_str());
+			errors.push_back(buffer);
+		}
+	} while (c != EOF);
+
+	fclose(fp);
+
+	std::stable_sort(events.begin(), events.end(), [](const SoundTimelineEvent &a, const SoundTimelineEvent &b) { return a.Time < b.Time; });
+	cursor = 0;
+	return true;
+}
+
+void SoundTimeline::Seek(double t)
+{
+	cursor = (int)(std::lower_bound(events.begin(), events.end(), t, [](const SoundTimelineEvent &a, double t) { return a.Time < t; }) - events.begin());
+}
+
+const SoundTimelineEvent *SoundTimeline::Next() const
+{
+	if (cursor < (int)events.size())
+		return &events[cursor];
+
+	return NULL;
+}
+
+void SoundTimeline::Advance()
+{
+	if (cursor < (int)events.size())
+		cursor++;
+}
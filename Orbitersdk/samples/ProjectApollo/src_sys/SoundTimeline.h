@@ -0,0 +1,102 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  Mission sound timeline (Header)
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+// ****************************************************************
+// The mission sound files list sounds by mission time, one per line:
+//
+//   [-]HHH:MM:SS;file                  sound.csv type files
+//   [-]HHH:MM:SS;l|r;priority;file     csmsound.csv
+//
+// The timeline reads such a file once into a table of events sorted
+// by time. Sounds at the same time keep the order of the file. Lines
+// that can't be read are left out and described in Errors(), with
+// their line number, instead of being read as a different time or
+// priority. There is no limit to the number of sounds.
+//
+// The cursor points to the next sound to play. Seek() finds it with
+// a binary search, for a scenario that starts in the middle of the
+// mission or when the mission time jumps. Otherwise the cursor only
+// moves forward by the sounds that are passed, so following the
+// mission time costs one comparison per timestep.
+// ****************************************************************
+
+struct SoundTimelineEvent
+{
+	//Time relative to launch, or to re-entry
+	double Time;
+	//From 0 to 9
+	int Priority;
+	bool LaunchRelative;
+	//Line in the file
+	int Line;
+	//Sound file name without path and .wav
+	std::string Name;
+
+	//Always played
+	bool IsMandatory() const { return Priority > 8; }
+	//Only played without time acceleration
+	bool IsInformational() const { return Priority < 3; }
+};
+
+class SoundTimeline
+{
+public:
+	enum Format
+	{
+		//time;file, played with priority 9
+		FORMAT_MET,
+		//time;l|r;priority;file
+		FORMAT_PRIORITY
+	};
+
+	SoundTimeline();
+
+	void Clear();
+	//Reads all sounds of a file and moves the cursor to the first one. Returns false if the file can't be opened.
+	bool LoadFromFile(const char *path, Format format);
+	//Reads one line without the comment and the end of line. Returns false and the reason in err if the line is malformed.
+	static bool ParseLine(const char *line, Format format, SoundTimelineEvent &ev, std::string &err);
+
+	//Lines that were left out, as "line <n>: <reason>"
+	const std::vector<std::string> &Errors() const { return errors; }
+	int Size() const { return (int)events.size(); }
+	const SoundTimelineEvent &Event(int i) const { return events[i]; }
+
+	//Moves the cursor to the first sound at or after time t
+	void Seek(double t);
+	//Sound at the cursor, NULL behind the last sound
+	const SoundTimelineEvent *Next() const;
+	//Moves the cursor to the following sound
+	void Advance();
+	int Cursor() const { return cursor; }
+
+protected:
+	std::vector<SoundTimelineEvent> events;
+	std::vector<std::string> errors;
+	int cursor;
+};
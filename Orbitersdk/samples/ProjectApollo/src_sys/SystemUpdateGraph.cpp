@@ -0,0 +1,237 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  Update order and rates of the internal systems
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+// To force orbitersdk.h to use <fstream> in any compiler version
+#pragma include_alias( <fstream.h>, <fstream> )
+#include "Orbitersdk.h"
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#ifdef NASSP_PROFILE
+#include <chrono>
+#endif
+#include "profiler.h"
+#include "SystemUpdateGraph.h"
+
+SystemUpdateGraph::SystemUpdateGraph()
+{
+	sorted = false;
+}
+
+void SystemUpdateGraph::Add(const char *name, const std::function<void(double)> &step, double rate)
+{
+	System s;
+
+	s.Name = name;
+	s.Step = step;
+	s.Rate = rate;
+	s.Elapsed = 0.0;
+	s.Calls = 0;
+	s.Skipped = 0;
+	s.Time = 0.0;
+	systems.push_back(s);
+	sorted = false;
+}
+
+int SystemUpdateGraph::Find(const char *name)
+{
+	unsigned i;
+
+	for (i = 0;i < systems.size();i++)
+	{
+		if (!strcmp(systems[i].Name, name)) return i;
+	}
+	return -1;
+}
+
+void SystemUpdateGraph::After(const char *name, const char *dep)
+{
+	char buffer[256];
+	int i = Find(name);
+	int j = Find(dep);
+
+	if (i < 0 || j < 0)
+	{
+		sprintf(buffer, "SystemUpdateGraph: unknown system in %s after %s", name, dep);
+		oapiWriteLog(buffer);
+		return;
+	}
+	systems[i].Deps.push_back(j);
+	sorted = false;
+}
+
+void SystemUpdateGraph::AllAfter(const char *dep)
+{
+	unsigned i;
+
+	for (i = 0;i < systems.size();i++)
+	{
+		if (strcmp(systems[i].Name, dep)) After(systems[i].Name, dep);
+	}
+}
+
+void SystemUpdateGraph::SetActive(const char *name, const std::function<bool()> &active)
+{
+	int i = Find(name);
+
+	if (i >= 0) systems[i].Active = active;
+}
+
+void SystemUpdateGraph::Sort()
+{
+	std::vector<bool> placed(systems.size(), false);
+	char buffer[256];
+	unsigned i, j;
+	bool ready;
+
+	//Always take the first system in registration order whose dependencies are done
+	order.clear();
+	while (order.size() < systems.size())
+	{
+		for (i = 0;i < systems.size();i++)
+		{
+			if (placed[i]) continue;
+
+			ready = true;
+			for (j = 0;j < systems[i].Deps.size();j++)
+			{
+				if (!placed[systems[i].Deps[j]])
+				{
+					ready = false;
+					break;
+				}
+			}
+			if (ready) break;
+		}
+
+		if (i == systems.size())
+		{
+			//Circular dependencies, run the rest in registration order
+			for (i = 0;i < systems.size();i++)
+			{
+				if (placed[i]) continue;
+
+				sprintf(buffer, "SystemUpdateGraph: circular dependency at %s", systems[i].Name);
+				oapiWriteLog(buffer);
+				order.push_back(i);
+				placed[i] = true;
+			}
+			break;
+		}
+
+		order.push_back(i);
+		placed[i] = true;
+	}
+	sorted = true;
+}
+
+void SystemUpdateGraph::Run(System &s, double dt)
+{
+	if (s.Active && !s.Active())
+	{
+		s.Skipped++;
+		return;
+	}
+
+#ifdef NASSP_PROFILE
+	ProfileScope scope(s.Name);
+	auto t0 = std::chrono::steady_clock::now();
+	s.Step(dt);
+	s.Time += std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+#else
+	s.Step(dt);
+#endif
+	s.Calls++;
+}
+
+void SystemUpdateGraph::Timestep(double simdt, double maxstep)
+{
+	double frame = simdt;
+	double tFactor;
+	unsigned i;
+
+	if (!sorted) Sort();
+
+	tFactor = std::min(maxstep, simdt);
+	while (simdt > 0)
+	{
+		for (i = 0;i < order.size();i++)
+		{
+			System &s = systems[order[i]];
+
+			if (s.Rate == SYSTEM_RATE_SUBSTEP)
+			{
+				Run(s, tFactor);
+			}
+			else if (s.Rate > 0.0)
+			{
+				s.Elapsed += tFactor;
+				if (s.Elapsed >= 1.0 / s.Rate)
+				{
+					Run(s, s.Elapsed);
+					s.Elapsed = 0.0;
+				}
+			}
+		}
+
+		simdt -= tFactor;
+		tFactor = std::min(maxstep, simdt);
+	}
+
+	for (i = 0;i < order.size();i++)
+	{
+		System &s = systems[order[i]];
+
+		if (s.Rate == SYSTEM_RATE_FRAME) Run(s, frame);
+	}
+}
+
+void SystemUpdateGraph::WriteStats(const char *owner)
+{
+	char buffer[256];
+	unsigned i;
+
+	if (!sorted) Sort();
+
+	sprintf(buffer, "(%s) System updates: calls, skipped, total ms", owner);
+	oapiWriteLog(buffer);
+	for (i = 0;i < order.size();i++)
+	{
+		System &s = systems[order[i]];
+
+		sprintf(buffer, "(%s) %-32s %10u %10u %12.3f", owner, s.Name, s.Calls, s.Skipped, s.Time*1000.0);
+		oapiWriteLog(buffer);
+	}
+}
+
+void SystemUpdateGraph::ResetStats()
+{
+	unsigned i;
+
+	for (i = 0;i < systems.size();i++)
+	{
+		systems[i].Calls = 0;
+		systems[i].Skipped = 0;
+		systems[i].Time = 0.0;
+	}
+}
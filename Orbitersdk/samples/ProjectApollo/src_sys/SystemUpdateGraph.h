@@ -0,0 +1,103 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  Update order and rates of the internal systems (Header)
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#pragma once
+
+#include <functional>
+#include <vector>
+
+// ****************************************************************
+// The internal systems timestep splits the frame into substeps and
+// updates the systems in each of them. Instead of calling them one
+// by one, a vessel registers its systems here once, with
+//
+// - the rate: every substep, once per frame with the frame length,
+//   or at a fixed rate in Hz with the time since its last update,
+// - the systems it has to run after, e.g. everything after the
+//   Panel SDK, so that power use feeds back to it,
+// - optionally a condition, the system is skipped while it is false.
+//
+// Systems without dependencies between them keep the order they
+// were added in, so the order is the same on every run.
+//
+// Systems drawing power from the Panel SDK have to run every
+// substep, as the power they draw is only used for the next substep.
+// Their condition is their own power check, so they are only skipped
+// when they wouldn't draw anything. Valves that only follow their
+// switches or hatches don't draw power and run at SYSTEM_RATE_VALVE.
+//
+// Calls and skips are counted per system. With NASSP_PROFILE the
+// time spent in each system is measured too, and every system is a
+// profiler scope of its own.
+// ****************************************************************
+
+//Update rates
+#define SYSTEM_RATE_SUBSTEP		0.0
+#define SYSTEM_RATE_FRAME		-1.0
+#define SYSTEM_RATE_VALVE		10.0
+
+class SystemUpdateGraph
+{
+public:
+	SystemUpdateGraph();
+
+	//Adds a system, name has to be a string literal
+	void Add(const char *name, const std::function<void(double)> &step, double rate = SYSTEM_RATE_SUBSTEP);
+	//System name runs after system dep
+	void After(const char *name, const char *dep);
+	//All other systems run after system dep
+	void AllAfter(const char *dep);
+	//System name only runs while active returns true
+	void SetActive(const char *name, const std::function<bool()> &active);
+
+	//Steps all systems over simdt in substeps of at most maxstep
+	void Timestep(double simdt, double maxstep);
+
+	//Writes calls, skips and time per system to the Orbiter log
+	void WriteStats(const char *owner);
+	void ResetStats();
+
+protected:
+	struct System
+	{
+		const char *Name;
+		std::function<void(double)> Step;
+		std::function<bool()> Active;
+		double Rate;
+		double Elapsed;
+		std::vector<int> Deps;
+
+		unsigned Calls;
+		unsigned Skipped;
+		double Time;
+	};
+
+	int Find(const char *name);
+	void Sort();
+	void Run(System &s, double dt);
+
+	std::vector<System> systems;
+	//Systems in update order
+	std::vector<int> order;
+	bool sorted;
+};
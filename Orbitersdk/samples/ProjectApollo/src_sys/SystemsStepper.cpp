@@ -0,0 +1,137 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  Worker thread for the internal systems timestep
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#include <algorithm>
+#include "SystemsStepper.h"
+
+SystemsStepper::SystemsStepper()
+{
+	leader = NULL;
+	running = false;
+	quit = false;
+}
+
+SystemsStepper::~SystemsStepper()
+{
+	unsigned i;
+
+	Link(NULL);
+
+	//Followers go back to their own worker
+	std::vector<SystemsStepper*> f = followers;
+	for (i = 0;i < f.size();i++)
+	{
+		f[i]->Link(NULL);
+	}
+
+	if (worker.joinable())
+	{
+		{
+			std::lock_guard<std::mutex> guard(lock);
+			quit = true;
+		}
+		wake.notify_all();
+		worker.join();
+	}
+}
+
+void SystemsStepper::Start(double simdt)
+{
+	SystemsStepper *s = leader ? leader : this;
+
+	s->Post(this, simdt);
+}
+
+void SystemsStepper::Wait()
+{
+	SystemsStepper *s = leader ? leader : this;
+
+	s->WaitIdle();
+}
+
+void SystemsStepper::Link(SystemsStepper *l)
+{
+	if (l == this) l = NULL;
+	if (l == leader) return;
+
+	//Nothing may run while the group changes
+	Wait();
+	if (l) l->Wait();
+
+	if (leader)
+	{
+		leader->followers.erase(std::remove(leader->followers.begin(), leader->followers.end(), this), leader->followers.end());
+	}
+	leader = l;
+	if (leader)
+	{
+		leader->followers.push_back(this);
+	}
+}
+
+void SystemsStepper::Post(SystemsStepper *s, double simdt)
+{
+	Item item;
+
+	item.stepper = s;
+	item.simdt = simdt;
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		queue.push_back(item);
+		if (!worker.joinable())
+		{
+			worker = std::thread(&SystemsStepper::Run, this);
+		}
+	}
+	wake.notify_one();
+}
+
+void SystemsStepper::WaitIdle()
+{
+	std::unique_lock<std::mutex> guard(lock);
+
+	idle.wait(guard, [this] { return queue.empty() && !running; });
+}
+
+void SystemsStepper::Run()
+{
+	std::unique_lock<std::mutex> guard(lock);
+	Item item;
+
+	while (true)
+	{
+		wake.wait(guard, [this] { return quit || !queue.empty(); });
+		if (quit) break;
+
+		item = queue.front();
+		queue.erase(queue.begin());
+		running = true;
+
+		guard.unlock();
+		if (item.stepper->step) item.stepper->step(item.simdt);
+		guard.lock();
+
+		running = false;
+		if (queue.empty()) idle.notify_all();
+	}
+}
@@ -0,0 +1,110 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  Worker thread for the internal systems timestep (Header)
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#pragma once
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <vector>
+
+// ****************************************************************
+// With the systems thread option (SYSTEMSTHREAD 1 in the launchpad
+// config, off by default) a vessel runs its internal systems
+// timestep on a worker thread. The step is started at the end of
+// clbkPostStep with the length of the frame Orbiter has just
+// integrated, so it overlaps with the other vessels and with
+// rendering, and Wait() at the start of the next clbkPreStep is the
+// frame barrier.
+//
+// The step only contains the Panel SDK substeps and the
+// SystemTimestep calls, which draw power, make heat and set pumps
+// and valves. They make no Orbiter API calls: the sun, planet and
+// atmosphere are read on the main thread by
+// PanelSDK::UpdateEnvironment just before Start, and sounds are
+// played by the device Timestep calls in clbkPreStep.
+//
+// The order is not the same as without the option. The internal
+// systems of a frame are stepped after its clbkPostStep instead of
+// before the AGC and the other devices in its clbkPreStep, so these
+// see the systems one frame behind.
+//
+// Anything else that reads or changes the systems state outside
+// the timesteps has to call Wait() first: the key, mouse and redraw
+// callbacks, loading panels, saving the scenario, docking, the
+// destructor, the ECS accessors of the MFD and the MCC uplink.
+// Without the option Wait() returns at once.
+//
+// Vessels whose Panel SDKs are connected directly, e.g. the docked
+// CSM and LM sharing the tunnel pipe and the umbilical power, can't
+// step at the same time. The follower is then linked to the leader,
+// and all steps of the group run on the leader's worker one after
+// the other, in the order they were started. A docked CSM and LM
+// are therefore serialised, they only overlap with the rest of the
+// frame and not with each other. Waiting on any member waits for
+// the whole group, so each of them waits at the start of its
+// clbkPostStep in case the other one has already started.
+// ****************************************************************
+
+class SystemsStepper
+{
+public:
+	SystemsStepper();
+	~SystemsStepper();
+
+	//Sets the step function, it is called with the time to step
+	void SetStep(const std::function<void(double)> &f) { step = f; };
+	//Starts the step on the worker thread of the group
+	void Start(double simdt);
+	//Frame barrier, returns when all started steps of the group are done
+	void Wait();
+	//Runs the steps of this vessel on the worker of leader from now on, NULL to use its own worker again
+	void Link(SystemsStepper *leader);
+
+protected:
+	struct Item
+	{
+		SystemsStepper *stepper;
+		double simdt;
+	};
+
+	void Post(SystemsStepper *s, double simdt);
+	void WaitIdle();
+	void Run();
+
+	std::function<void(double)> step;
+
+	//Group
+	SystemsStepper *leader;
+	std::vector<SystemsStepper*> followers;
+
+	//Worker, only used when this is the leader of its group
+	std::thread worker;
+	std::mutex lock;
+	std::condition_variable wake;
+	std::condition_variable idle;
+	std::vector<Item> queue;
+	bool running;
+	bool quit;
+};
@@ -0,0 +1,315 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  Shared memory telemetry bus
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+// To force orbitersdk.h to use <fstream> in any compiler version
+#pragma include_alias( <fstream.h>, <fstream> )
+#include "Orbitersdk.h"
+#include <stdio.h>
+#include <string.h>
+#include <atomic>
+#if !defined(_WIN32)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "soundlib.h"
+#include "apolloguidance.h"
+#include "dsky.h"
+#include "TelemetryBus.h"
+
+TelemetryBus::TelemetryBus(uint32_t t)
+{
+	type = t;
+	failed = false;
+	handle = NULL;
+	mapsize = 0;
+	header = NULL;
+	slot = NULL;
+	nvalues = 0;
+}
+
+TelemetryBus::~TelemetryBus()
+{
+	Disconnect();
+}
+
+void TelemetryBus::AddValue(const char *name, double *src)
+{
+	if (src == NULL || slot || nvalues >= NASSP_TLMBUS_VALUES) return;
+
+	strncpy(valuenames[nvalues], name, 31);
+	valuenames[nvalues][31] = 0;
+	values[nvalues] = src;
+	nvalues++;
+}
+
+bool TelemetryBus::Connect(VESSEL *v)
+{
+	const char *name = v->GetName();
+	char buffer[256];
+	bool created;
+	void *base;
+	int i;
+
+	mapsize = sizeof(TelemetryBusHeader) + NASSP_TLMBUS_SLOTS * sizeof(TelemetryBusSlot);
+
+#if defined(_WIN32)
+	HANDLE h = CreateFileMappingA(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE, 0, (DWORD)mapsize, NASSP_TLMBUS_NAME);
+	if (h == NULL) return false;
+	created = (GetLastError() != ERROR_ALREADY_EXISTS);
+	base = MapViewOfFile(h, FILE_MAP_ALL_ACCESS, 0, 0, mapsize);
+	if (base == NULL)
+	{
+		CloseHandle(h);
+		return false;
+	}
+	handle = h;
+#else
+	int fd = shm_open("/" NASSP_TLMBUS_NAME, O_RDWR | O_CREAT, 0666);
+	struct stat st;
+	if (fd < 0) return false;
+	if (fstat(fd, &st) != 0 || (st.st_size < (off_t)mapsize && ftruncate(fd, mapsize) != 0))
+	{
+		close(fd);
+		return false;
+	}
+	created = (st.st_size == 0);
+	base = mmap(NULL, mapsize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	if (base == MAP_FAILED) return false;
+	handle = base;
+#endif
+
+	header = (TelemetryBusHeader *)base;
+	if (created || header->Magic == 0)
+	{
+		memset(base, 0, mapsize);
+		header->HeaderSize = sizeof(TelemetryBusHeader);
+		header->SlotOffset = sizeof(TelemetryBusHeader);
+		header->SlotSize = sizeof(TelemetryBusSlot);
+		header->SlotCount = NASSP_TLMBUS_SLOTS;
+		header->ValueCount = NASSP_TLMBUS_VALUES;
+		header->PCMSize = NASSP_TLMBUS_PCM_SIZE;
+		header->Version = NASSP_TLMBUS_VERSION;
+		std::atomic_thread_fence(std::memory_order_release);
+		header->Magic = NASSP_TLMBUS_MAGIC;
+	}
+	else if (header->Magic != NASSP_TLMBUS_MAGIC || header->Version != NASSP_TLMBUS_VERSION || header->SlotSize != sizeof(TelemetryBusSlot)
+		|| header->SlotCount != NASSP_TLMBUS_SLOTS)
+	{
+		sprintf(buffer, "(%s) Telemetry bus %s has an incompatible layout, not publishing", name, NASSP_TLMBUS_NAME);
+		oapiWriteLog(buffer);
+		Disconnect();
+		return false;
+	}
+
+	TelemetryBusSlot *slots = (TelemetryBusSlot *)((char *)base + header->SlotOffset);
+
+	//Take over the slot of the same vessel from an earlier run, otherwise the first free one
+	for (i = 0;i < NASSP_TLMBUS_SLOTS;i++)
+	{
+		if (slots[i].Owner && !strncmp(slots[i].VesselName, name, 63))
+		{
+			slot = &slots[i];
+			break;
+		}
+	}
+	for (i = 0;slot == NULL && i < NASSP_TLMBUS_SLOTS;i++)
+	{
+#if defined(_WIN32)
+		if (InterlockedCompareExchange((volatile LONG *)&slots[i].Owner, 1, 0) == 0)
+#else
+		if (__sync_bool_compare_and_swap(&slots[i].Owner, 0, 1))
+#endif
+		{
+			slot = &slots[i];
+		}
+	}
+	if (slot == NULL)
+	{
+		sprintf(buffer, "(%s) No free slot on telemetry bus %s", name, NASSP_TLMBUS_NAME);
+		oapiWriteLog(buffer);
+		Disconnect();
+		return false;
+	}
+
+	//A writer may have stopped in the middle of an update
+	if (slot->Sequence & 1) slot->Sequence++;
+	slot->Sequence++;
+	std::atomic_thread_fence(std::memory_order_release);
+	slot->VesselType = type;
+	strncpy(slot->VesselName, name, 63);
+	slot->VesselName[63] = 0;
+	memset(slot->ValueNames, 0, sizeof(slot->ValueNames));
+	for (i = 0;i < nvalues;i++)
+	{
+		strncpy(slot->ValueNames[i], valuenames[i], 32);
+	}
+	slot->ValuesUsed = nvalues;
+	std::atomic_thread_fence(std::memory_order_release);
+	slot->Sequence++;
+	return true;
+}
+
+void TelemetryBus::Disconnect()
+{
+	if (slot)
+	{
+		slot->Owner = 0;
+		slot = NULL;
+	}
+	if (header)
+	{
+#if defined(_WIN32)
+		UnmapViewOfFile(header);
+		CloseHandle((HANDLE)handle);
+#else
+		munmap(header, mapsize);
+#endif
+		header = NULL;
+		handle = NULL;
+	}
+}
+
+bool TelemetryBus::BeginFrame(VESSEL *v, double MissionTime)
+{
+	int i;
+
+	if (slot == NULL)
+	{
+		//Don't retry every frame if the segment can't be created
+		if (failed) return false;
+		if (!Connect(v))
+		{
+			failed = true;
+			return false;
+		}
+	}
+
+	slot->Sequence++;
+	std::atomic_thread_fence(std::memory_order_release);
+
+	slot->SimT = oapiGetSimTime();
+	slot->SimDT = oapiGetSimStep();
+	slot->MJD = oapiGetSimMJD();
+	slot->MissionTime = MissionTime;
+
+	VECTOR3 R, V, arot, avel;
+	OBJHANDLE gravref = v->GetGravityRef();
+	oapiGetObjectName(gravref, slot->GravRef, 32);
+	v->GetRelativePos(gravref, R);
+	v->GetRelativeVel(gravref, V);
+	v->GetGlobalOrientation(arot);
+	v->GetAngularVel(avel);
+	for (i = 0;i < 3;i++)
+	{
+		slot->Pos[i] = R.data[i];
+		slot->Vel[i] = V.data[i];
+		slot->Attitude[i] = arot.data[i];
+		slot->AngVel[i] = avel.data[i];
+	}
+	slot->Mass = v->GetMass();
+
+	for (i = 0;i < nvalues;i++)
+	{
+		slot->Values[i] = *values[i];
+	}
+	return true;
+}
+
+void TelemetryBus::SetDSKY(int n, DSKY &dsky)
+{
+	if (slot == NULL || n < 0 || n > 1) return;
+
+	TelemetryBusDSKY &d = slot->DSKY[n];
+	uint32_t lights = 0;
+
+	memcpy(d.Prog, dsky.Prog, 3);
+	memcpy(d.Verb, dsky.Verb, 3);
+	memcpy(d.Noun, dsky.Noun, 3);
+	memcpy(d.R1, dsky.R1, 7);
+	memcpy(d.R2, dsky.R2, 7);
+	memcpy(d.R3, dsky.R3, 7);
+
+	if (dsky.CompActy) lights |= 1 << 0;
+	if (dsky.UplinkLight) lights |= 1 << 1;
+	if (dsky.NoAttLight) lights |= 1 << 2;
+	if (dsky.StbyLight) lights |= 1 << 3;
+	if (dsky.KbRelLight) lights |= 1 << 4;
+	if (dsky.OprErrLight) lights |= 1 << 5;
+	if (dsky.TempLight) lights |= 1 << 6;
+	if (dsky.GimbalLockLight) lights |= 1 << 7;
+	if (dsky.ProgLight) lights |= 1 << 8;
+	if (dsky.RestartLight) lights |= 1 << 9;
+	if (dsky.TrackerLight) lights |= 1 << 10;
+	if (dsky.AltLight) lights |= 1 << 11;
+	if (dsky.VelLight) lights |= 1 << 12;
+	if (dsky.PrioDispLight) lights |= 1 << 13;
+	if (dsky.NoDAPLight) lights |= 1 << 14;
+	if (dsky.VerbFlashing) lights |= 1 << 16;
+	if (dsky.NounFlashing) lights |= 1 << 17;
+	if (dsky.ELOff) lights |= 1 << 18;
+	d.Lights = lights;
+}
+
+void TelemetryBus::SetDEDA(const char *adr, const char *data)
+{
+	if (slot == NULL) return;
+
+	memcpy(slot->DEDAAdr, adr, 3);
+	memcpy(slot->DEDAData, data, 6);
+}
+
+void TelemetryBus::SetCWSLights(int n, uint32_t lights)
+{
+	if (slot == NULL || n < 0 || n > 3) return;
+
+	slot->CWSLights[n] = lights;
+}
+
+void TelemetryBus::EndFrame()
+{
+	if (slot == NULL) return;
+
+	std::atomic_thread_fence(std::memory_order_release);
+	slot->Sequence++;
+}
+
+void TelemetryBus::AddPCM(const unsigned char *data, int size)
+{
+	TelemetryBusSlot *s = slot;
+	uint64_t n;
+	int i;
+
+	if (s == NULL || size <= 0) return;
+
+	n = s->PCMWritten;
+	for (i = 0;i < size;i++)
+	{
+		s->PCM[(n + i) % NASSP_TLMBUS_PCM_SIZE] = data[i];
+	}
+	std::atomic_thread_fence(std::memory_order_release);
+	s->PCMWritten = n + size;
+}
@@ -0,0 +1,176 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  Shared memory telemetry bus (Header)
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+
+// ****************************************************************
+// The CSM and LM publish their state once per frame into a shared
+// memory segment, so external displays, instructor stations and
+// loggers can read it without a socket and without slowing down
+// the simulation. On Windows the segment is a named file mapping,
+// elsewhere a POSIX shared memory object called /NASSP_TLMBUS_100.
+//
+// The segment starts with a TelemetryBusHeader, followed by
+// SlotCount slots of SlotSize bytes at SlotOffset. Each vessel
+// claims one slot.
+//
+// Slots are updated seqlock style: Sequence is odd while the slot
+// is being written. A reader copies the slot, and the copy is
+// consistent if Sequence was even and unchanged before and after.
+//
+// The PCM downlink bytes go into a ring buffer outside the seqlock.
+// PCMWritten counts all bytes ever written, byte n is at
+// PCM[n % NASSP_TLMBUS_PCM_SIZE]. Read PCMWritten before and after
+// copying, bytes older than the second value minus the ring size
+// may have been overwritten.
+//
+// Readers include this header only, the layout uses fixed size
+// types and 8 byte alignment.
+// ****************************************************************
+
+#define NASSP_TLMBUS_NAME		"NASSP_TLMBUS_100"
+#define NASSP_TLMBUS_MAGIC		0x4D4C544E	// "NTLM"
+#define NASSP_TLMBUS_VERSION	1
+
+#define NASSP_TLMBUS_SLOTS		8
+#define NASSP_TLMBUS_VALUES		32
+#define NASSP_TLMBUS_PCM_SIZE	8192
+
+#define NASSP_TLMBUS_CSM		1
+#define NASSP_TLMBUS_LM			2
+
+#pragma pack(push, 8)
+
+struct TelemetryBusHeader
+{
+	uint32_t Magic;
+	uint32_t Version;
+	uint32_t HeaderSize;
+	uint32_t SlotOffset;
+	uint32_t SlotSize;
+	uint32_t SlotCount;
+	uint32_t ValueCount;
+	uint32_t PCMSize;
+};
+
+struct TelemetryBusDSKY
+{
+	char Prog[4];
+	char Verb[4];
+	char Noun[4];
+	char R1[8];
+	char R2[8];
+	char R3[8];
+	// Bit 0 COMP ACTY, 1 UPLINK ACTY, 2 NO ATT, 3 STBY, 4 KEY REL, 5 OPR ERR, 6 TEMP, 7 GIMBAL LOCK,
+	// 8 PROG, 9 RESTART, 10 TRACKER, 11 ALT, 12 VEL, 13 PRIO DISP, 14 NO DAP,
+	// 16 verb flashing, 17 noun flashing, 18 display off
+	uint32_t Lights;
+	uint32_t Reserved;
+};
+
+struct TelemetryBusSlot
+{
+	// Non-zero while a vessel owns the slot
+	volatile int32_t Owner;
+	volatile uint32_t Sequence;
+	uint32_t VesselType;
+	uint32_t ValuesUsed;
+	char VesselName[64];
+
+	// Time
+	double SimT;
+	double SimDT;
+	double MJD;
+	double MissionTime;
+
+	// State vector in the Orbiter global frame relative to GravRef
+	char GravRef[32];
+	double Pos[3];
+	double Vel[3];
+	double Attitude[3];		// Orbiter global orientation angles
+	double AngVel[3];		// Body rates
+	double Mass;
+
+	// Systems values, named in ValueNames
+	char ValueNames[NASSP_TLMBUS_VALUES][32];
+	double Values[NASSP_TLMBUS_VALUES];
+
+	// Displays
+	TelemetryBusDSKY DSKY[2];
+	char DEDAAdr[4];
+	char DEDAData[8];
+	uint32_t DEDAReserved;
+
+	// Caution and warning lights, CSM: left and right panel, LM: CWEA rows 0-3 and 4 in 8 bits each
+	uint32_t CWSLights[4];
+
+	// PCM downlink ring buffer
+	volatile uint64_t PCMWritten;
+	uint8_t PCM[NASSP_TLMBUS_PCM_SIZE];
+};
+
+#pragma pack(pop)
+
+#if !defined(NASSP_TLMBUS_READER)
+
+class VESSEL;
+class DSKY;
+
+//Publishing side, one per vessel
+class TelemetryBus
+{
+public:
+	TelemetryBus(uint32_t type);
+	~TelemetryBus();
+
+	//Adds a systems value to publish, usually a PanelSDK value pointer. Values added after the first frame are ignored.
+	void AddValue(const char *name, double *src);
+
+	//Starts the frame update, returns false if the bus isn't available. Set the displays between BeginFrame and EndFrame.
+	bool BeginFrame(VESSEL *v, double MissionTime);
+	void SetDSKY(int n, DSKY &dsky);
+	void SetDEDA(const char *adr, const char *data);
+	void SetCWSLights(int n, uint32_t lights);
+	void EndFrame();
+
+	//Appends PCM downlink bytes, can be called from the AGC thread
+	void AddPCM(const unsigned char *data, int size);
+protected:
+	bool Connect(VESSEL *v);
+	void Disconnect();
+
+	uint32_t type;
+	bool failed;
+	void *handle;
+	size_t mapsize;
+	TelemetryBusHeader *header;
+	TelemetryBusSlot *slot;
+
+	int nvalues;
+	char valuenames[NASSP_TLMBUS_VALUES][32];
+	double *values[NASSP_TLMBUS_VALUES];
+};
+
+#endif
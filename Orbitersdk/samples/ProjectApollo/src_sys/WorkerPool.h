@@ -0,0 +1,85 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  Worker threads for independent batch calculations (Header)
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#pragma once
+
+#include <thread>
+#include <atomic>
+#include <vector>
+#include <functional>
+
+//Runs independent work items on a set of worker threads. The threads only live for the duration of one call, so nothing
+//is left running when a module DLL is unloaded. Each work item has to write its result to its own slot, which keeps the
+//merged results independent of the thread scheduling.
+class WorkerPool
+{
+public:
+	//Number of threads used when none is specified
+	static unsigned DefaultThreadCount()
+	{
+		unsigned n = std::thread::hardware_concurrency();
+		return n > 0 ? n : 1;
+	}
+
+	//Calls func(i) for i = 0 to n-1 and returns when all calls are done. maxthreads = 0 uses all hardware threads
+	static void ParallelFor(int n, const std::function<void(int)> &func, unsigned maxthreads = 0)
+	{
+		unsigned nthreads, i;
+
+		if (n <= 0) return;
+
+		nthreads = maxthreads > 0 ? maxthreads : DefaultThreadCount();
+		if (nthreads > (unsigned)n) nthreads = (unsigned)n;
+
+		if (nthreads <= 1)
+		{
+			for (int j = 0;j < n;j++)
+			{
+				func(j);
+			}
+			return;
+		}
+
+		std::atomic<int> next(0);
+		auto worker = [&]()
+		{
+			int j;
+			while ((j = next.fetch_add(1)) < n)
+			{
+				func(j);
+			}
+		};
+
+		std::vector<std::thread> threads;
+		//The calling thread works as well
+		for (i = 1;i < nthreads;i++)
+		{
+			threads.push_back(std::thread(worker));
+		}
+		worker();
+		for (i = 0;i < threads.size();i++)
+		{
+			threads[i].join();
+		}
+	}
+};
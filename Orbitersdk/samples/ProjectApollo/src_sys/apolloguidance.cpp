@@ -77,6 +77,23 @@ ApolloGuidance::ApolloGuidance(SoundLib &s, DSKY &display, IMU &im, CDU &sc, CDU
 	TrackerAlarm = false;
 	GimbalLockAlarm = false;
 
+	//
+	// IMU counter feed.
+	//
+
+	memset(&imuFeedPending, 0, sizeof(imuFeedPending));
+	memset(&imuFeed, 0, sizeof(imuFeed));
+	imuFeedQueued = false;
+	imuFeedActive = false;
+	imuFeedCycle = 0;
+	imuFeedCycles = 0;
+	for (i = 0; i < 3; i++) {
+		imuFeedPendingCancel[i] = false;
+		imuFeedCancel[i] = false;
+		imuFeedPIPADone[i] = 0;
+		imuFeedCDUNow[i] = 0;
+	}
+
 	//
 	// Virtual AGC.
 	//
@@ -179,15 +196,174 @@ bool ApolloGuidance::OutOfReset()
 bool ApolloGuidance::SingleTimestepPrep(double simt, double simdt){
 	LastTimestep = CurrentTimestep;
 	CurrentTimestep = simt;
+	StartIMUCounterFeed(simdt);
 	return TRUE;
 }
 
 bool ApolloGuidance::SingleTimestep() {
 
 	agc_engine(&vagc);
+	if (imuFeedActive) ServiceIMUCounters();
 	return TRUE;
 }
 
+//
+// IMU counter feed. The IMU queues the PIPA pulses and CDU counts of a frame, which are then
+// spread over the machine cycles of the next timestep instead of arriving all at once.
+//
+
+void ApolloGuidance::QueueIMUCounters(const IMUCounterFeed &feed)
+
+{
+	IMUCounterFeed old;
+	bool oldcancel[3];
+	bool deliver;
+	int i;
+
+	{
+		Lock lock(imuFeedMutex);
+
+		deliver = imuFeedQueued;
+		if (deliver) {
+			old = imuFeedPending;
+			for (i = 0; i < 3; i++)
+				oldcancel[i] = imuFeedPendingCancel[i];
+		}
+		imuFeedPending = feed;
+		if (imuFeedPending.Steps > IMU_FEED_MAX_STEPS)
+			imuFeedPending.Steps = IMU_FEED_MAX_STEPS;
+		for (i = 0; i < 3; i++)
+			imuFeedPendingCancel[i] = false;
+		imuFeedQueued = true;
+	}
+
+	//
+	// The AGC didn't run since the last frame, so deliver the old counts as they are.
+	// Done outside of the feed lock, the AGC thread takes it with the cycle mutex held.
+	//
+	if (deliver) {
+		int none[3] = { 0, 0, 0 };
+		DeliverIMUCounters(old, none, oldcancel);
+	}
+}
+
+void ApolloGuidance::CancelIMUCDUFeed(int index)
+
+{
+	if (index < 0 || index > 2)
+		return;
+
+	imuFeedCancel[index] = true;
+
+	Lock lock(imuFeedMutex);
+	imuFeedPendingCancel[index] = true;
+}
+
+void ApolloGuidance::StartIMUCounterFeed(double simdt)
+
+{
+	int i;
+
+	if (imuFeedActive)
+		FinishIMUCounters();
+
+	{
+		Lock lock(imuFeedMutex);
+
+		if (!imuFeedQueued)
+			return;
+
+		imuFeed = imuFeedPending;
+		for (i = 0; i < 3; i++)
+			imuFeedCancel[i] = imuFeedPendingCancel[i];
+		imuFeedQueued = false;
+	}
+
+	imuFeedCycle = 0;
+	imuFeedCycles = (long)(simdt / 0.00001171875);
+	if (imuFeedCycles < 1)
+		imuFeedCycles = 1;
+	for (i = 0; i < 3; i++) {
+		imuFeedPIPADone[i] = 0;
+		imuFeedCDUNow[i] = imuFeed.CDUStart[i];
+	}
+	imuFeedActive = (imuFeed.Steps > 0);
+
+	if (!imuFeedActive) {
+		DeliverIMUCounters(imuFeed, imuFeedPIPADone, imuFeedCancel);
+	}
+}
+
+void ApolloGuidance::ServiceIMUCounters()
+
+{
+	int i, target, a, b, d, val;
+	long long s;
+	long k, rem;
+
+	imuFeedCycle++;
+
+	// PIPA pulses at an even rate over the timestep
+	for (i = 0; i < 3; i++) {
+		target = (int)((long long)imuFeed.PIPA[i] * imuFeedCycle / imuFeedCycles);
+		while (imuFeedPIPADone[i] < target) {
+			UnprogrammedIncrement(&vagc, RegPIPAX + i, 0);	// PINC
+			imuFeedPIPADone[i]++;
+		}
+		while (imuFeedPIPADone[i] > target) {
+			UnprogrammedIncrement(&vagc, RegPIPAX + i, 2);	// MINC
+			imuFeedPIPADone[i]--;
+		}
+	}
+
+	// CDU counts interpolated between the sub-step keyframes
+	s = (long long)imuFeedCycle * imuFeed.Steps;
+	k = (long)(s / imuFeedCycles);
+	rem = (long)(s % imuFeedCycles);
+
+	for (i = 0; i < 3; i++) {
+		if (imuFeedCancel[i])
+			continue;
+
+		if (k >= imuFeed.Steps) {
+			val = imuFeed.CDU[imuFeed.Steps - 1][i];
+		}
+		else {
+			a = (k == 0) ? imuFeed.CDUStart[i] : imuFeed.CDU[k - 1][i];
+			b = imuFeed.CDU[k][i];
+			// Shortest way on the 15 bit counter
+			d = ((b - a + 040000) & 077777) - 040000;
+			val = (a + (int)((long long)d * rem / imuFeedCycles)) & 077777;
+		}
+		if (val != imuFeedCDUNow[i]) {
+			ProcessIMUCDUReadCount(RegCDUX + i, val);
+			imuFeedCDUNow[i] = val;
+		}
+	}
+
+	if (imuFeedCycle >= imuFeedCycles)
+		imuFeedActive = false;
+}
+
+void ApolloGuidance::FinishIMUCounters()
+
+{
+	DeliverIMUCounters(imuFeed, imuFeedPIPADone, imuFeedCancel);
+	imuFeedActive = false;
+}
+
+void ApolloGuidance::DeliverIMUCounters(const IMUCounterFeed &feed, const int *pipadone, const volatile bool *cancel)
+
+{
+	int i;
+
+	for (i = 0; i < 3; i++) {
+		PulsePIPA(RegPIPAX + i, feed.PIPA[i] - pipadone[i]);
+		if (feed.Steps > 0 && !cancel[i])
+			ProcessIMUCDUReadCount(RegCDUX + i, feed.CDU[feed.Steps - 1][i]);
+	}
+}
+
 void ApolloGuidance::VirtualAGCCoreDump(char *fileName) {
 
 	MakeCoreDump(&vagc, fileName); 
@@ -195,7 +371,7 @@ void ApolloGuidance::VirtualAGCCoreDump(char *fileName) {
 
 bool ApolloGuidance::GenericTimestep(double simt, double simdt)
 {
-//	TRACESETUP("COMPUTER TIMESTEP");
+	PROFILESCOPE("ApolloGuidance::GenericTimestep");
 	int i;
 
 	LastTimestep = CurrentTimestep;
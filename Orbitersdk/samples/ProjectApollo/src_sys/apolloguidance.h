@@ -37,12 +37,41 @@ class PanelSDK;
 #include <bitset>
 #include "powersource.h"
 
-#include "control.h"
+#include "Control.h"
 #include "yaAGC/agc_engine.h"
 #include "thread.h"
 
 
 typedef std::bitset<16> ChannelValue;
+
+#define IMU_FEED_MAX_STEPS 64
+
+///
+/// \ingroup AGC
+/// \brief IMU counter increments for one frame.
+/// The IMU works out its gimbal angles and PIPA counts once per frame. The AGC feeds them into its
+/// counters over the machine cycles of the following timestep, as the real CDUs and PIPAs did.
+///
+struct IMUCounterFeed
+{
+	///
+	/// \brief PIPA pulses for the X, Y and Z registers.
+	///
+	int PIPA[3];
+	///
+	/// \brief Number of CDU keyframes.
+	///
+	int Steps;
+	///
+	/// \brief CDU counts at the start of the frame.
+	///
+	int CDUStart[3];
+	///
+	/// \brief CDU counts at the end of each sub-step, spaced evenly over the timestep.
+	///
+	int CDU[IMU_FEED_MAX_STEPS][3];
+};
+
 ///
 /// \ingroup AGC
 /// \brief AGC base class.
@@ -110,6 +139,12 @@ public:
 	///
 	bool OnStandby() { return vagc.Standby; };
 
+	///
+	/// \brief AGC clock time, for timing channel outputs within a timestep.
+	/// \return Time of the current machine cycle in seconds, counted from the last hardware restart.
+	///
+	double GetCycleTime() { return (double)vagc.CycleCounter * 0.00001171875; };
+
 	///
 	/// \brief Is the AGC out of reset?
 	///
@@ -260,6 +295,20 @@ public:
 
 	virtual void ProcessIMUCDUReadCount(int channel, int val);
 
+	///
+	/// \brief Queue PIPA and CDU counts from the IMU for the next AGC timestep.
+	/// A feed that hasn't been picked up by the AGC yet is delivered at once.
+	/// \param feed Counter increments of the last frame.
+	///
+	void QueueIMUCounters(const IMUCounterFeed &feed);
+
+	///
+	/// \brief Stop feeding CDU counts to an axis until the next frame.
+	/// Used when the gimbal is driven directly, e.g. by coarse align or gyro torquing.
+	/// \param index Gimbal index, 0 to 2.
+	///
+	void CancelIMUCDUFeed(int index);
+
 	///
 	/// \brief Triggers Virtual AGC core dump
 	///
@@ -345,6 +394,11 @@ protected:
 
 	bool SingleTimestepPrep(double simt, double simdt);
 	bool SingleTimestep();
+
+	void StartIMUCounterFeed(double simdt);
+	void ServiceIMUCounters();
+	void FinishIMUCounters();
+	void DeliverIMUCounters(const IMUCounterFeed &feed, const int *pipadone, const volatile bool *cancel);
 	bool GenericTimestep(double simt, double simdt);
 	bool GenericReadMemory(unsigned int loc, int &val);
 	void GenericWriteMemory(unsigned int loc, int val);
@@ -443,6 +497,25 @@ protected:
 	///
 	agc_t vagc;
 	Mutex agcCycleMutex;
+
+	///
+	/// \brief IMU counter feed waiting for the next timestep, protected by imuFeedMutex.
+	///
+	IMUCounterFeed imuFeedPending;
+	bool imuFeedQueued;
+	bool imuFeedPendingCancel[3];
+	Mutex imuFeedMutex;
+
+	///
+	/// \brief IMU counter feed being delivered in the current timestep.
+	///
+	IMUCounterFeed imuFeed;
+	bool imuFeedActive;
+	volatile bool imuFeedCancel[3];
+	long imuFeedCycle;
+	long imuFeedCycles;
+	int imuFeedPIPADone[3];
+	int imuFeedCDUNow[3];
 	Event timeStepEvent;
 	double thread_simt;
 	double thread_simdt;
@@ -257,6 +257,12 @@ public:
 	///
 	void PushMasterAlarm();
 
+	///
+	/// \brief Packed left and right panel light states, as saved in the scenario.
+	///
+	int GetLeftLightStates() { return GetLightStates(LeftLights); };
+	int GetRightLightStates() { return GetLightStates(RightLights); };
+
 	///
 	/// \brief What's the current light test state commanded by telemetry?
 	///
@@ -44,7 +44,7 @@
 #include <string>
 // To force orbitersdk.h to use <fstream> in any compiler version
 #pragma include_alias( <fstream.h>, <fstream> )
-#include "orbiterSDK.h"
+#include "Orbitersdk.h"
 #include "nasspdefs.h"
 #include "connector.h"
 #include "BasicExcelVC6.hpp"
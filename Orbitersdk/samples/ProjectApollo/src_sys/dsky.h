@@ -36,6 +36,8 @@
 class DSKY : public e_object
 
 {
+	friend class TelemetryBus;
+
 public:
 
 	DSKY(SoundLib &s, ApolloGuidance &computer, int IOChannel = 015);
@@ -32,7 +32,7 @@
 #include "nasspdefs.h"
 #include "toggleswitch.h"
 #include "apolloguidance.h"
-#include "csmcomputer.h"
+#include "CSMcomputer.h"
 #include "dsky.h"
 
 #include "ioChannels.h"
@@ -92,6 +92,13 @@ void IMU::Init()
 	LastWeightAcceleration = _V(0, 0, 0);
 	LastGlobalVel = _V(0, 0, 0);
 
+	Attitude.w = 1.0;
+	Attitude.x = 0.0;
+	Attitude.y = 0.0;
+	Attitude.z = 0.0;
+	LastAttitude = Attitude;
+	LastAttitudeValid = false;
+
 	OurVessel = 0;
 	IMUHeater = 0;
 	IMUHeat = 0;
@@ -212,6 +219,9 @@ void IMU::ChannelOutput(int address, ChannelValue value)
     
     	if (val12[ZeroIMUCDUs]) {
 			DoZeroIMUCDUs();
+			agc.CancelIMUCDUFeed(0);
+			agc.CancelIMUCDUFeed(1);
+			agc.CancelIMUCDUFeed(2);
 			agc.ProcessIMUCDUReadCount(RegCDUX, 0);
 			agc.ProcessIMUCDUReadCount(RegCDUY, 0);
 			agc.ProcessIMUCDUReadCount(RegCDUZ, 0);
@@ -369,11 +379,14 @@ void IMU::Timestep(double simdt)
 	if (!Operate) {
 		if (Powered)
 			TurnOn();
-		else
+		else {
+			LastAttitudeValid = false;
 			return; 
+		}
 	}
 	else if (!Powered) {
 		TurnOff();
+		LastAttitudeValid = false;
 		return;
 	}
 
@@ -382,21 +395,17 @@ void IMU::Timestep(double simdt)
 	//
 
 	if (!TurnedOn) {
+		LastAttitudeValid = false;
 		return;
 	}
 	
-	// fill OrbiterData
-	VECTOR3 arot;
-	OurVessel->GetGlobalOrientation(arot);
+	// Orbiter global to vessel rotation, the transpose of the vessel rotation matrix.
+	// Taken from the matrix, this needs no trigonometry, the Euler angles are only derived for the scenario.
+	MATRIX3 rot;
+	OurVessel->GetRotationMatrix(rot);
 
-	Orbiter.Attitude.X = arot.x;
-	Orbiter.Attitude.Y = arot.y;
-	Orbiter.Attitude.Z = arot.z;
-
-	// Vessel to Orbiter global transformation
-	MATRIX3	tinv = getRotationMatrixZ(-arot.z);
-	tinv = mul(getRotationMatrixY(-arot.y), tinv);
-	tinv = mul(getRotationMatrixX(-arot.x), tinv);
+	IMUQuat tinv = IMUQuatFromMatrix(rot);
+	Attitude = IMUQuatConj(tinv);
 
 	if (!Initialized) {
 		SetOrbiterAttitudeReference();
@@ -405,7 +414,7 @@ void IMU::Timestep(double simdt)
 		VECTOR3 w;
 		OurVessel->GetWeightVector(w);
 		// Transform to Orbiter global and calculate weight acceleration
-		w = mul(tinv, w) / OurVessel->GetMass();
+		w = IMUQuatRotate(tinv, w) / OurVessel->GetMass();
 
 		//Orbiter 2016 hack
 		if (length(w) == 0.0)
@@ -425,7 +434,7 @@ void IMU::Timestep(double simdt)
 		VECTOR3 w, vel;
 		OurVessel->GetWeightVector(w);
 		// Transform to Orbiter global and calculate accelerations
-		w = mul(tinv, w) / OurVessel->GetMass();
+		w = IMUQuatRotate(tinv, w) / OurVessel->GetMass();
 
 		//Orbiter 2016 hack
 		if (length(w) == 0.0)
@@ -464,22 +473,52 @@ void IMU::Timestep(double simdt)
 
 			TRACE("CHANNEL 12 NORMAL");
 
-			// Gimbals
-			MATRIX3 t = Orbiter.AttitudeReference;
-	  		t = mul(getRotationMatrixX(Orbiter.Attitude.X), t);
-	  		t = mul(getRotationMatrixY(Orbiter.Attitude.Y), t);
-	  		t = mul(getRotationMatrixZ(Orbiter.Attitude.Z), t);
-	  		
-	  		t = mul(getOrbiterLocalToNavigationBaseTransformation(), t);
-	  		
-			// calculate the new gimbal angles
-			VECTOR3 newAngles = getRotationAnglesXZY(t);
-
-			// drive gimbals to new angles		  		  				  		  	 	 	  		  	
-			// CAUTION: gimbal angles are left-handed
-			DriveGimbalX(-newAngles.x - Gimbal.X);
-		  	DriveGimbalY(-newAngles.y - Gimbal.Y);
-		  	DriveGimbalZ(-newAngles.z - Gimbal.Z);
+			IMUCounterFeed feed;
+			int i, k;
+
+			// Gimbals, integrated from the last attitude at a constant body rate.
+			// Each sub-step gives a CDU keyframe for the AGC, a frame is only split when the vessel turns fast.
+			MATRIX3 nb = getOrbiterLocalToNavigationBaseTransformation();
+			IMUQuat q = LastAttitudeValid ? LastAttitude : Attitude;
+			IMUQuat dq = IMUQuatMul(Attitude, IMUQuatConj(q));
+			int n = LastAttitudeValid ? IMUSubSteps(simdt, dq) : 1;
+
+			if (n > 1) {
+				dq = IMUQuatRoot(dq, n);
+			}
+
+			for (i = 0; i < 3; i++) {
+				feed.CDUStart[i] = ((int)(((double)radToGyroPulses(Gimbals[i])) / 64.0)) & 077777;
+			}
+			feed.Steps = n;
+
+			for (k = 0; k < n; k++) {
+				if (k == n - 1)
+					q = Attitude;
+				else
+					q = IMUQuatNormalize(IMUQuatMul(dq, q));
+
+				MATRIX3 t = mul(nb, mul(IMUQuatToMatrix(q), Orbiter.AttitudeReference));
+
+				// calculate the new gimbal angles
+				// CAUTION: gimbal angles are left-handed
+				VECTOR3 newAngles = IMUGimbalAnglesXZY(t);
+				double g[3] = { -newAngles.x, -newAngles.y, -newAngles.z };
+
+				for (i = 0; i < 3; i++) {
+					g[i] = fmod(g[i], TWO_PI);
+					if (g[i] < 0) {
+						g[i] += TWO_PI;
+					}
+					if (g[i] >= TWO_PI) {
+						g[i] -= TWO_PI;
+					}
+					feed.CDU[k][i] = ((int)(((double)radToGyroPulses(g[i])) / 64.0)) & 077777;
+					if (k == n - 1) {
+						Gimbals[i] = g[i];
+					}
+				}
+			}
 
 			// PIPAs
 			accel = tmul(Orbiter.AttitudeReference, accel);
@@ -487,19 +526,24 @@ void IMU::Timestep(double simdt)
 
 			// pulse PIPAs
 			pulses = RemainingPIPA.X + (accel.x * LastSimDT / pipaRate);
-			PulsePIPA(RegPIPAX, (int) pulses);
+			feed.PIPA[0] = (int) pulses;
 			RemainingPIPA.X = pulses - (int) pulses;
 
 			pulses = RemainingPIPA.Y + (accel.y * LastSimDT / pipaRate);
-			PulsePIPA(RegPIPAY, (int) pulses);
+			feed.PIPA[1] = (int) pulses;
 			RemainingPIPA.Y = pulses - (int) pulses;
 
 			pulses = RemainingPIPA.Z + (accel.z * LastSimDT / pipaRate);
-			PulsePIPA(RegPIPAZ, (int) pulses);
-			RemainingPIPA.Z = pulses - (int) pulses;			
+			feed.PIPA[2] = (int) pulses;
+			RemainingPIPA.Z = pulses - (int) pulses;
+
+			// CDU counts and PIPA pulses go into the AGC counters over its next timestep
+			agc.QueueIMUCounters(feed);
 		}
 		LastSimDT = simdt;
 	}
+	LastAttitude = Attitude;
+	LastAttitudeValid = true;
 }
 
 void IMU::SystemTimestep(double simdt) 
@@ -571,6 +615,9 @@ void IMU::DriveGimbal(int index, int RegCDU, double angle)
 	double OldGimbal;
 	double delta;
 	
+	// The gimbal is driven directly, stop feeding the counts from the last frame
+	agc.CancelIMUCDUFeed(index);
+
 	OldGimbal = Gimbals[index];
 	Gimbals[index] += angle;
 	if (Gimbals[index] >= TWO_PI) {
@@ -645,9 +692,7 @@ void IMU::SetOrbiterAttitudeReference()
 	t = mul(getNavigationBaseToOrbiterLocalTransformation(), t);
 	
 	// tranform to orbiter global coordinates
-	t = mul(getRotationMatrixZ(-Orbiter.Attitude.Z), t);
-	t = mul(getRotationMatrixY(-Orbiter.Attitude.Y), t);
-	t = mul(getRotationMatrixX(-Orbiter.Attitude.X), t);
+	t = mul(IMUQuatToMatrix(IMUQuatConj(Attitude)), t);
 
 	// "Orbiter's REFSMMAT"
 	Orbiter.AttitudeReference = t;
@@ -778,8 +823,10 @@ void IMU::LoadState(FILEHANDLE scn)
 	double flt = 0;
 
 	while (oapiReadScenario_nextline (scn, line)) {
-		if (!strnicmp(line, IMU_END_STRING, sizeof(IMU_END_STRING)))
+		if (!strnicmp(line, IMU_END_STRING, sizeof(IMU_END_STRING))) {
+			Attitude = IMUQuatEuler(Orbiter.Attitude.X, Orbiter.Attitude.Y, Orbiter.Attitude.Z);
 			return;
+		}
 		if (!strnicmp (line, "RPX", 3)) {
 			sscanf(line + 3, "%lf", &flt);
 			RemainingPIPA.X = flt;
@@ -895,6 +942,12 @@ void IMU::LoadState(FILEHANDLE scn)
 void IMU::SaveState(FILEHANDLE scn)
 
 {
+	VECTOR3 arot = IMUQuatEulerAngles(Attitude);
+
+	Orbiter.Attitude.X = arot.x;
+	Orbiter.Attitude.Y = arot.y;
+	Orbiter.Attitude.Z = arot.z;
+
 	oapiWriteLine(scn, IMU_START_STRING);
 
 	papiWriteScenario_double(scn, "RPX", RemainingPIPA.X);
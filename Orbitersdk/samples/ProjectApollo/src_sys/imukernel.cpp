@@ -0,0 +1,214 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  IMU attitude kernel
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+// To force orbitersdk.h to use <fstream> in any compiler version
+#pragma include_alias( <fstream.h>, <fstream> )
+#include "Orbitersdk.h"
+#include <math.h>
+#include "imukernel.h"
+
+IMUQuat IMUQuatEuler(double x, double y, double z)
+{
+	double cx = cos(0.5*x), sx = sin(0.5*x);
+	double cy = cos(0.5*y), sy = sin(0.5*y);
+	double cz = cos(0.5*z), sz = sin(0.5*z);
+	IMUQuat q;
+
+	//qz * qy * qx
+	q.w = cz * cy*cx + sz * sy*sx;
+	q.x = cz * cy*sx - sz * sy*cx;
+	q.y = cz * sy*cx + sz * cy*sx;
+	q.z = sz * cy*cx - cz * sy*sx;
+	return q;
+}
+
+VECTOR3 IMUQuatEulerAngles(const IMUQuat &q)
+{
+	MATRIX3 m = IMUQuatToMatrix(q);
+	double s = -m.m31;
+
+	if (s > 1.0) s = 1.0;
+	if (s < -1.0) s = -1.0;
+	return _V(atan2(m.m32, m.m33), asin(s), atan2(m.m21, m.m11));
+}
+
+IMUQuat IMUQuatFromMatrix(const MATRIX3 &m)
+{
+	IMUQuat q;
+	double t = m.m11 + m.m22 + m.m33, s;
+
+	//From the largest component, so that the divisions are well conditioned
+	if (t > 0.0)
+	{
+		s = 2.0 * sqrt(1.0 + t);
+		q.w = 0.25 * s;
+		q.x = (m.m32 - m.m23) / s;
+		q.y = (m.m13 - m.m31) / s;
+		q.z = (m.m21 - m.m12) / s;
+	}
+	else if (m.m11 > m.m22 && m.m11 > m.m33)
+	{
+		s = 2.0 * sqrt(1.0 + m.m11 - m.m22 - m.m33);
+		q.w = (m.m32 - m.m23) / s;
+		q.x = 0.25 * s;
+		q.y = (m.m12 + m.m21) / s;
+		q.z = (m.m13 + m.m31) / s;
+	}
+	else if (m.m22 > m.m33)
+	{
+		s = 2.0 * sqrt(1.0 + m.m22 - m.m11 - m.m33);
+		q.w = (m.m13 - m.m31) / s;
+		q.x = (m.m12 + m.m21) / s;
+		q.y = 0.25 * s;
+		q.z = (m.m23 + m.m32) / s;
+	}
+	else
+	{
+		s = 2.0 * sqrt(1.0 + m.m33 - m.m11 - m.m22);
+		q.w = (m.m21 - m.m12) / s;
+		q.x = (m.m13 + m.m31) / s;
+		q.y = (m.m23 + m.m32) / s;
+		q.z = 0.25 * s;
+	}
+	return q;
+}
+
+IMUQuat IMUQuatMul(const IMUQuat &a, const IMUQuat &b)
+{
+	IMUQuat q;
+
+	q.w = a.w*b.w - a.x*b.x - a.y*b.y - a.z*b.z;
+	q.x = a.w*b.x + a.x*b.w + a.y*b.z - a.z*b.y;
+	q.y = a.w*b.y - a.x*b.z + a.y*b.w + a.z*b.x;
+	q.z = a.w*b.z + a.x*b.y - a.y*b.x + a.z*b.w;
+	return q;
+}
+
+IMUQuat IMUQuatConj(const IMUQuat &q)
+{
+	IMUQuat c;
+
+	c.w = q.w;
+	c.x = -q.x;
+	c.y = -q.y;
+	c.z = -q.z;
+	return c;
+}
+
+IMUQuat IMUQuatNormalize(const IMUQuat &q)
+{
+	double l = sqrt(q.w*q.w + q.x*q.x + q.y*q.y + q.z*q.z);
+	IMUQuat n;
+
+	if (l == 0.0)
+	{
+		n.w = 1.0;
+		n.x = n.y = n.z = 0.0;
+		return n;
+	}
+	n.w = q.w / l;
+	n.x = q.x / l;
+	n.y = q.y / l;
+	n.z = q.z / l;
+	return n;
+}
+
+IMUQuat IMUQuatRoot(const IMUQuat &dq, int n)
+{
+	IMUQuat r;
+	double s, half, k;
+
+	r = dq;
+	//Shortest way round
+	if (r.w < 0.0)
+	{
+		r.w = -r.w;
+		r.x = -r.x;
+		r.y = -r.y;
+		r.z = -r.z;
+	}
+	if (n <= 1) return r;
+
+	s = sqrt(r.x*r.x + r.y*r.y + r.z*r.z);
+	if (s < 1e-12)
+	{
+		//Small angle, sin(a/n) = sin(a)/n
+		r.x /= n;
+		r.y /= n;
+		r.z /= n;
+		return IMUQuatNormalize(r);
+	}
+	half = atan2(s, r.w) / n;
+	k = sin(half) / s;
+	r.w = cos(half);
+	r.x *= k;
+	r.y *= k;
+	r.z *= k;
+	return r;
+}
+
+MATRIX3 IMUQuatToMatrix(const IMUQuat &q)
+{
+	double xx = q.x*q.x, yy = q.y*q.y, zz = q.z*q.z;
+	double xy = q.x*q.y, xz = q.x*q.z, yz = q.y*q.z;
+	double wx = q.w*q.x, wy = q.w*q.y, wz = q.w*q.z;
+
+	return _M(1.0 - 2.0*(yy + zz), 2.0*(xy - wz), 2.0*(xz + wy),
+		2.0*(xy + wz), 1.0 - 2.0*(xx + zz), 2.0*(yz - wx),
+		2.0*(xz - wy), 2.0*(yz + wx), 1.0 - 2.0*(xx + yy));
+}
+
+VECTOR3 IMUQuatRotate(const IMUQuat &q, const VECTOR3 &v)
+{
+	//v + 2w(u x v) + 2u x (u x v)
+	VECTOR3 u = _V(q.x, q.y, q.z);
+	VECTOR3 t = crossp(u, v) * 2.0;
+	return v + t * q.w + crossp(u, t);
+}
+
+VECTOR3 IMUGimbalAnglesXZY(const MATRIX3 &m)
+{
+	VECTOR3 v;
+	double s = -m.m12;
+
+	//Rounding can take the sine slightly out of range
+	if (s > 1.0) s = 1.0;
+	if (s < -1.0) s = -1.0;
+	v.z = asin(s);
+	v.y = atan2(m.m13, m.m11);
+	v.x = atan2(m.m32, m.m22);
+	return v;
+}
+
+int IMUSubSteps(double simdt, const IMUQuat &dq)
+{
+	//2 sin(a/2), slightly less than the angle a of dq but without trigonometry
+	double a = 2.0*sqrt(dq.x*dq.x + dq.y*dq.y + dq.z*dq.z);
+	int n = (int)ceil(a / IMU_SUBSTEP_ANGLE);
+	int cycles = (int)(simdt / IMU_AGC_CYCLE);
+
+	if (n > cycles) n = cycles;
+	if (n > IMU_MAX_SUBSTEPS) n = IMU_MAX_SUBSTEPS;
+	if (n < 1) n = 1;
+	return n;
+}
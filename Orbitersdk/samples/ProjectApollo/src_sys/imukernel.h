@@ -0,0 +1,61 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  IMU attitude kernel (Header)
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#pragma once
+
+//Quaternion helpers for the IMU gimbal calculation. They replace the Euler angle rotation matrices of imumath.cpp
+//in the per-frame path: the vessel attitude is taken from its rotation matrix with one square root, and the frame
+//is only divided into sub-steps of constant body rate when the vessel turns by more than IMU_SUBSTEP_ANGLE in it.
+//Requires MATRIX3 and VECTOR3 from the Orbiter API.
+
+//Largest rotation between two CDU keyframes, the AGC interpolates the counts linearly in between
+#define IMU_SUBSTEP_ANGLE (1.0*RAD)
+//AGC machine cycle in seconds, there is at most one keyframe per cycle of the AGC timestep
+#define IMU_AGC_CYCLE 0.00001171875
+//Maximum number of sub-steps per frame, has to fit the AGC counter feed
+#define IMU_MAX_SUBSTEPS 64
+
+struct IMUQuat
+{
+	double w, x, y, z;
+};
+
+//Global to vessel local rotation for the Orbiter global orientation angles, same as
+//getRotationMatrixZ(z) * getRotationMatrixY(y) * getRotationMatrixX(x)
+IMUQuat IMUQuatEuler(double x, double y, double z);
+//Orbiter global orientation angles of a global to vessel local rotation, the inverse of IMUQuatEuler
+VECTOR3 IMUQuatEulerAngles(const IMUQuat &q);
+//Rotation of the matrix m, the vessel's local to global matrix gives the conjugate of the IMUQuatEuler rotation
+IMUQuat IMUQuatFromMatrix(const MATRIX3 &m);
+IMUQuat IMUQuatMul(const IMUQuat &a, const IMUQuat &b);
+IMUQuat IMUQuatConj(const IMUQuat &q);
+IMUQuat IMUQuatNormalize(const IMUQuat &q);
+//Rotation by the n-th part of the angle of dq, around the same axis
+IMUQuat IMUQuatRoot(const IMUQuat &dq, int n);
+MATRIX3 IMUQuatToMatrix(const IMUQuat &q);
+VECTOR3 IMUQuatRotate(const IMUQuat &q, const VECTOR3 &v);
+
+//Same angles as IMU::getRotationAnglesXZY, modulo 2 pi
+VECTOR3 IMUGimbalAnglesXZY(const MATRIX3 &m);
+//Number of gimbal sub-steps for a frame of length simdt, in which the attitude changes by dq
+int IMUSubSteps(double simdt, const IMUQuat &dq);
@@ -105,10 +105,12 @@ void IMU::LogTimeStep(long simt)
 	timeline = ctime(&(tstruct.time));
 	strcpy(buffer, timeline + 11);
 		
+	VECTOR3 arot = IMUQuatEulerAngles(Attitude);
+
 	fprintf(logFile, "%.8s.%03hu TimeStep                   Orbiter %.2f %.2f %.2f   IMU %.2f %.2f %.2f\n", buffer, tstruct.millitm, 
-			radToDeg(Orbiter.Attitude.X),
-			radToDeg(Orbiter.Attitude.Y),
-			radToDeg(Orbiter.Attitude.Z),
+			radToDeg(arot.x),
+			radToDeg(arot.y),
+			radToDeg(arot.z),
 			radToDeg(Gimbal.X),
 			radToDeg(Gimbal.Y),
 			radToDeg(Gimbal.Z));
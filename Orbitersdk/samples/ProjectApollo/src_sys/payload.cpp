@@ -26,7 +26,7 @@
 #include <stdio.h>
 // To force orbitersdk.h to use <fstream> in any compiler version
 #pragma include_alias( <fstream.h>, <fstream> )
-#include "orbitersdk.h"
+#include "Orbitersdk.h"
 
 #include "PanelSDK/PanelSDK.h"
 #include "PanelSDK/Internals/Esystems.h"
@@ -34,33 +34,45 @@
 
 #include "soundlib.h"
 #include "soundevents.h"
+#include "SoundTimeline.h"
 
 #include "tracer.h"
 #include "nasspdefs.h"
 
 // MODIF PG
 
+//
+// One sound of the sound arrays.
+//
+struct SoundEventEntry
+{
+	double altitude;
+	int    mode;
+	double met;
+	char   filenames[255];
+	int    offset;
+	double timetoignition;
+	double timeafterignition;
+	double timetoapproach;
+	int    mandatory;
+};
+
 //
 // NONE OF THESE SHOULD BE STATIC VARIABLES! THESE SHOULD BE CLASS VARIABLES!
 //
-// And no fixed-size arrays either.
+// The array has one more entry behind the last sound, which play() looks at.
 //
 static int lastplayed = -1;
 static int reallyplayed;
 static int tobeplayed = -1;
 static int nSoundsLoaded = 0;
-#define MAX_SOUND_EVENT 256
-static SoundEvent soundevents[MAX_SOUND_EVENT];
+static std::vector<SoundEventEntry> soundevents(1);
 static int SoundEventLoaded = false;
 
 // MODIF x15 to manage landing mission sound
 SoundEvent::SoundEvent()
 
 {
-	altitude = -1.;
-	mode     = -1 ;
-	played   = false;
-	filenames[0] = 0;
 	lastplayed=-1;
     SoundEventLoaded =false;
 
@@ -150,7 +162,7 @@ int SoundEvent::play(SoundLib soundlib,
 
 //  no more sounds to be played just return
 
-	if(soundevents[lastplayed+1].met == 0)
+	if(lastplayed+1 >= nSoundsLoaded)
 		return(false);
 
 
@@ -271,11 +283,14 @@ int SoundEvent::play(SoundLib soundlib,
 //					   altitude,mode);
 //		sprintf(oapiDebugString(),"%s",buffers);
 
-        while (soundevents[kk].mode != mode)
+        while (kk < nSoundsLoaded && soundevents[kk].mode != mode)
 		{
 			kk++;
 		}
 
+        if (kk >= nSoundsLoaded)
+		    return 0;
+
 
 		while (    (soundevents[kk].altitude > altitude)
 			    && (soundevents[kk+1].altitude > altitude)
@@ -345,6 +360,7 @@ int SoundEvent::LoadMissionLandingSoundArray(SoundLib soundlib,char *soundname)
 	int type2 ;
 	int oldnumeroi;
 	double oldmet;
+	int offset;
 	
 	if(SoundEventLoaded)
 		return true;
@@ -395,6 +411,9 @@ TRACE(SoundPath);
     {
         buff = lines;
 
+		if ((int) soundevents.size() < indice + 2)
+			soundevents.resize(indice + 2);
+
 
 	    buff2 = strchr(buff,';');
 	    nchar = buff2 - buff;
@@ -575,6 +594,7 @@ TRACE(SoundPath);
 
 	fclose(fp);
     soundevents[indice].met = 0;
+	nSoundsLoaded = indice;
 
     /* now interpolate altitude information */
 
@@ -620,17 +640,10 @@ int SoundEvent::LoadMissionTimeSoundArray(SoundLib soundlib, char *soundname, do
 
 {
 	char	SoundPath[256];
-	FILE *fp;
-	char lines[255];
+	char  buffers[512];
 	int  indice = 0;
-	char *buff;
-	char *buff2;
-	char  buffers[255];
-	int   nchar;
-	char hours[4];
-	char mins[3];
-	char secs[3];
-	char rootfilenames[255]; 
+	int  i;
+	SoundTimeline timeline;
 
 	if(SoundEventLoaded)
 		return true;
@@ -646,96 +659,54 @@ int SoundEvent::LoadMissionTimeSoundArray(SoundLib soundlib, char *soundname, do
 		                                    soundlib.missionpath, soundname);
 	TRACE(SoundPath);
 
-	fp = fopen(SoundPath, "r");
-	if (!fp)
+	if (!timeline.LoadFromFile(SoundPath, SoundTimeline::FORMAT_MET))
 		return false;
 
- 	_snprintf(rootfilenames, 255, "%s/%s/", soundlib.basepath, soundlib.missionpath);
-
-	while (fgets(lines, 255, fp) != NULL && lines[0])
-    {
-		if (lines[0] != '#' && indice < MAX_SOUND_EVENT)
-		{
-			buff = lines;
-			bool negative = false;
-
-			buff2 = strchr(buff,';');
-
-			if (buff2)
-			{
-				nchar = buff2 - buff;
-				memset(buffers,0,sizeof(buffers));
-
-				//
-				// Check for negative.
-				//
-
-				if (lines[0] == '-')
-				{
-					negative = true;
-					buff++;
-				}
-
-				strncpy(buffers,buff,nchar);
-
-				/* first decode MET */
-				memset(hours,0,sizeof(hours));
-				strncpy(hours,buffers,3);
-				soundevents[indice].met = atoi(hours)*3600.0;
-
-				memset(mins,0,sizeof(mins));
-				strncpy(mins,buffers+4,2);
-				soundevents[indice].met += atoi(mins)*60.0;
-
-				memset(secs,0,sizeof(secs));
-				strncpy(secs,buffers+7,2);
-				soundevents[indice].met += (double) atoi(secs);
-
-				if (negative)
-					soundevents[indice].met = -soundevents[indice].met;
+	//
+	// Lines that can't be read are left out, tell which ones.
+	//
 
-				/* generate filenames */
-				buff = buff2 + 1;
+	for (i = 0; i < (int) timeline.Errors().size(); i++)
+	{
+		_snprintf(buffers, 511, "Mission sounds: %s %s", SoundPath, timeline.Errors()[i].c_str());
+		buffers[511] = 0;
+		TRACE(buffers);
+		oapiWriteLog(buffers);
+	}
 
-				//
-				// Find the end of the file-name. We have to do this both to
-				// allow for comments, and because fgets() leaves a dangling
-				// \n at the end of the line.
-				//
+	//
+	// The timeline is sorted, so the sounds before the mission time are
+	// the ones in front of the cursor.
+	//
 
-				buff2 = buff;
-				while (*buff2 && *buff2 != '\n' && *buff2 != '\r' && *buff2 != '#' && *buff2 != ' ' && *buff2 != '\t')
-					buff2++;
+	timeline.Seek(MissionTime);
+	soundevents.assign(timeline.Size() - timeline.Cursor() + 1, SoundEventEntry());
 
-				*buff2 = 0;
+	for (i = timeline.Cursor(); i < timeline.Size(); i++)
+	{
+		const SoundTimelineEvent &ev = timeline.Event(i);
 
-				strcpy(soundevents[indice].filenames, rootfilenames);
+		_snprintf(soundevents[indice].filenames, 254, "%s/%s/%s.wav", soundlib.basepath,
+			soundlib.missionpath, ev.Name.c_str());
+		soundevents[indice].filenames[254] = 0;
 
-				strcat(soundevents[indice].filenames, buff);
-				strcat(soundevents[indice].filenames, ".wav");
+		soundevents[indice].met = ev.Time;
+		soundevents[indice].altitude = 0.0;
+		soundevents[indice].mode = 3;
+		soundevents[indice].timetoignition = 0.0;
+		soundevents[indice].timeafterignition = 0.0;
+		soundevents[indice].mandatory = true;
+		soundevents[indice].timetoapproach = 0.0;
 
-				soundevents[indice].altitude = 0.0;
-				soundevents[indice].mode = 3;
-				soundevents[indice].timetoignition = 0.0;
-				soundevents[indice].mandatory = true;
-				soundevents[indice].timetoapproach = 0.0;
+		sprintf(buffers,"LOADED %d %f %f %s ",indice,
+					soundevents[indice].timetoignition,
+					soundevents[indice].timeafterignition,
+					soundevents[indice].filenames);
+		TRACE(buffers);
 
-				sprintf(buffers,"LOADED %d %f %f %s ",indice,
-							soundevents[indice].timetoignition,
-							soundevents[indice].timeafterignition,
-							soundevents[indice].filenames);
-				TRACE(buffers);
-		
-				//
-				// Just reuse this slot if the MET is less than the mission time.
-				//
-				if (soundevents[indice].met >= MissionTime)
-					indice++;
-			}
-		}
+		indice++;
 	}
 
-	fclose(fp);
     soundevents[indice].met = MINUS_INFINITY;
 
 	nSoundsLoaded = indice;
@@ -29,7 +29,7 @@
 // Looks like VC6.0 doesn't know about DWORD_PTR.
 //
 
-#if _MSC_VER <= 1300
+#if defined(_MSC_VER) && _MSC_VER <= 1300
 typedef unsigned long *DWORD_PTR;
 #endif
 
@@ -71,17 +71,6 @@ public:
 
 protected:
 
-	double altitude  ;
-	int    mode      ;
-	double    met       ;
-	bool   played    ;
-	char   filenames[255] ;
-	int    offset    ;
-	double timetoignition;
-	double timeafterignition;
-	double timetoapproach;
-	int    mandatory ;
-	
 	SoundLib soundlib;
 	LPDIRECTSOUND8  m_pDS;
 	LPDIRECTSOUNDBUFFER pDSBPrimary;
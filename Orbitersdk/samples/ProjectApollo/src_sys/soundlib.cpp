@@ -702,99 +702,31 @@ void FadeInOutSound::stop()
 	}
 }
 
-TimedSound::TimedSound()
-
-{
-	priority = 5;
-	triggerTime = 0.0;
-	soundname[0] = 0;
-
-	next = 0;
-	prev = 0;
-}
-
-TimedSound::~TimedSound()
-
-{
-}
-
-void TimedSound::AddToSoundQueue(TimedSound *previous)
-
-{
-	if (previous)
-	{
-		if (previous->next) {
-			next = previous->next;
-			next->prev = this;
-		}
-		previous->next = this;
-	}
-
-	prev = previous;
-}
-
-void TimedSound::RemoveFromQueue()
+TimedSoundManager::TimedSoundManager(SoundLib &s) : soundlib(s)
 
 {
-	if (prev)
-	{
-		prev->next = next;
-	}
-
-	if (next)
-	{
-		next->prev = prev;
-	}
-
-	prev = 0;
-	next = 0;
+	nextSoundIndex = -1;
+	LastTime = 0.0;
+	LaunchSoundsLoaded = false;
 }
 
-void TimedSound::SetFilename(char *s)
+TimedSoundManager::~TimedSoundManager()
 
 {
-	strncpy (soundname, s, 255);
 }
 
-void TimedSound::SetPriority(int n)
+void TimedSoundManager::LoadNextSound(int i)
 
 {
-	if (n < 0)
-		n = 0;
+	char filename[256];
 
-	if (n > 9)
-		n = 9;
+	nextSound.done();
 
-	priority = n;
-}
+	_snprintf(filename, 255, "%s.wav", sounds.Event(i).Name.c_str());
+	filename[255] = 0;
+	soundlib.LoadMissionSound(nextSound, filename, filename);
 
-TimedSoundManager::TimedSoundManager(SoundLib &s) : soundlib(s)
-
-{
-	launchRelativeList = 0;
-	reentryRelativeList = 0;
-
-	LaunchSoundsLoaded = false;
-	SoundToPlay = false;
-
-	TimeToPlay = MINUS_INFINITY;
-}
-
-//
-// When deleted, delete all the timed sounds too.
-//
-TimedSoundManager::~TimedSoundManager()
-
-{
-	TimedSound *s = launchRelativeList;
-	while (s)
-	{
-		TimedSound *n = s->GetNext();
-
-		delete s;
-
-		s = n;
-	}
+	nextSoundIndex = i;
 }
 
 void TimedSoundManager::Timestep(double simt, double simdt, bool autoslow)
@@ -804,252 +736,126 @@ void TimedSoundManager::Timestep(double simt, double simdt, bool autoslow)
 	if (!soundlib.IsOrbiterSoundActive()) return;
 
 	double timeaccel = oapiGetTimeAcceleration();
-	if (LaunchSoundsLoaded && simt >= TimeToPlay)
-	{
-		if (SoundToPlay)
-		{	
-			if (timeaccel > 1.0) 
-			{
-				if (SoundIsInformational || (!SoundIsMandatory && !autoslow))
-				{
-					SoundToPlay = false;
-				}
-				else
-				{
-					oapiSetTimeAcceleration(1.0);
-				}
-			}
-
-			//
-			// Stop previous sound if need be.
-			//
+	const SoundTimelineEvent *e;
+	int play = -1;
 
-			if (currentSound.isPlaying())
-				currentSound.stop();
+	if (LaunchSoundsLoaded)
+	{
+		//
+		// If the mission time went back or jumped further than this timestep,
+		// start from the sounds at the new time. The ones in between are not
+		// played.
+		//
 
-			currentSound.done();
+		if (simt < LastTime || simt > LastTime + simdt + 1.0)
+		{
+			sounds.Seek(simt);
+		}
+		LastTime = simt;
 
-			//
-			// Save away the new sound so we can stop it if time acceleration changes.
-			//
-			currentSound = nextSound;
+		//
+		// Of the sounds that are due, only the last one that can be played at
+		// this time acceleration is played.
+		//
 
-			if (SoundToPlay)
+		while ((e = sounds.Next()) != NULL && e->Time <= simt)
+		{
+			if (e->LaunchRelative && (timeaccel <= 1.0 || e->IsMandatory() || (autoslow && !e->IsInformational())))
 			{
-				currentSound.play();
+				play = sounds.Cursor();
 			}
+			sounds.Advance();
+		}
+	}
 
-			SoundToPlay = false;
+	if (play >= 0)
+	{
+		if (timeaccel > 1.0)
+		{
+			oapiSetTimeAcceleration(1.0);
 		}
 
 		//
-		// Now load the next sound.
+		// Stop previous sound if need be.
 		//
 
-		if (launchRelativeList)
-		{
-			nextSound.done();
+		if (currentSound.isPlaying())
+			currentSound.stop();
 
-			soundlib.LoadMissionSound(nextSound, launchRelativeList->GetFilename(), launchRelativeList->GetFilename());
-
-			SoundToPlay = true;
-			TimeToPlay = launchRelativeList->GetPlayTime();
-			SoundIsMandatory = launchRelativeList->IsMandatory();
-			SoundIsInformational = launchRelativeList->IsInformational();
-
-			TimedSound *n = launchRelativeList->GetNext();
-			launchRelativeList->RemoveFromQueue();
+		currentSound.done();
 
-			delete launchRelativeList;
+		//
+		// Save away the new sound so we can stop it if time acceleration changes.
+		//
 
-			launchRelativeList = n;
-		}
-		else
+		if (play != nextSoundIndex)
 		{
-			//
-			// Reached the end of the list.
-			//
-
-			LaunchSoundsLoaded = false;
-			currentSound.done();
+			LoadNextSound(play);
 		}
+
+		currentSound = nextSound;
+		currentSound.play();
+		nextSoundIndex = -1;
 	}
 	else if (timeaccel > 1.0 && currentSound.isPlaying())
 	{
 		currentSound.stop();
 		currentSound.done();
 	}
-}
 
-static int CharToInt(char c)
+	//
+	// Now load the next sound.
+	//
 
-{
-	if (c >= '0' && c <= '9')
-		return c - '0';
+	if (LaunchSoundsLoaded)
+	{
+		while ((e = sounds.Next()) != NULL && !e->LaunchRelative)
+		{
+			sounds.Advance();
+		}
 
-	return 0;
+		if (e && sounds.Cursor() != nextSoundIndex)
+		{
+			LoadNextSound(sounds.Cursor());
+		}
+	}
 }
 
 void TimedSoundManager::LoadFromFile(char *dataFile, double MissionTime)
 
 {
 	char filePath[256];
+	char buffer[512];
+	int i;
 
 	_snprintf(filePath, 255, "%s/%s/%s", soundlib.basepath,
 		                                    soundlib.missionpath, dataFile);
 
-	FILE *fp = fopen(filePath, "rt");
-
-	if (!fp)
+	if (!sounds.LoadFromFile(filePath, SoundTimeline::FORMAT_PRIORITY))
 	{
 		return;
 	}
 
-	char line[256];
-	bool copying;
-	int i, c;
-	TimedSound *lastLRSound = 0;
-	TimedSound *lastRRSound = 0;
+	//
+	// Lines that can't be read are left out, tell which ones.
+	//
 
-	while (!feof(fp))
+	for (i = 0;i < (int)sounds.Errors().size();i++)
 	{
-		copying = true;
-
-		//
-		// Read in a line.
-		//
-
-		i = 0;
-		while ((c = fgetc(fp)) != '\n' && c != EOF) {
-			if (c == '#')
-				copying = false;
-
-			if (copying)
-			{
-				line[i++] = c;
-			}
-		}
-
-		line[i] = 0;
-
-		if (i > 0)
-		{
-			int hours = 0, minutes = 0, seconds = 0;
-			double simt = 0.0;
-
-			bool timeNegative = false;
-
-			i = 0;
-
-			//
-			// Get hours.
-			//
-
-			if (line[i] == '-')
-			{
-				timeNegative = true;
-				i++;
-			}
-
-			while (line[i] != ':' && line[i])
-			{
-				hours = (hours * 10) + CharToInt(line[i]);
-				i++;
-			}
-
-			if (!line[i++])
-				continue;
-
-			//
-			// Get minutes.
-			//
-
-			while (line[i] != ':' && line[i])
-			{
-				minutes = (minutes * 10) + CharToInt(line[i]);
-				i++;
-			}
-
-			if (!line[i++])
-				continue;
-
-			//
-			// Get seconds.
-			//
-
-			while (line[i] != ';' && line[i])
-			{
-				seconds = (seconds * 10) + CharToInt(line[i]);
-				i++;
-			}
-
-			simt = (double) seconds + ((double) minutes) * 60.0 + ((double) hours * 3600.0);
-
-			if (timeNegative)
-			{
-				simt = (-simt);
-			}
-
-			if (simt >= MissionTime)
-			{
-				if (!line[i++])
-					continue;
-
-				bool launchRelative = (line[i] == 'l' || line[i] == 'L');
-
-				if (!line[i++])
-					continue;
-
-				if (line[i++] != ';')
-					continue;
-
-				int priority = CharToInt(line[i]);
-
-				if (!line[i++])
-					continue;
-
-				if (line[i++] != ';')
-					continue;
-
-				char filename[256];
-
-				strncpy(filename, line + i, 250);
-				strcat(filename, ".wav");
-
-				TimedSound *t = new TimedSound;
-
-				t->SetFilename(filename);
-				t->SetPriority(priority);
-				t->SetPlayTime(simt);
-
-				if (launchRelative)
-				{
-					t->AddToSoundQueue(lastLRSound);
-					lastLRSound = t;
-
-					if (!launchRelativeList)
-					{
-						launchRelativeList = t;
-					}
-				}
-				else
-				{
-					t->AddToSoundQueue(lastRRSound);
-					lastRRSound = t;
-
-					if (!reentryRelativeList)
-					{
-						reentryRelativeList = t;
-					}
-				}
-			}
-		}
+		_snprintf(buffer, 511, "Timed sounds: %s %s", filePath, sounds.Errors()[i].c_str());
+		buffer[511] = 0;
+		oapiWriteLog(buffer);
 	}
 
-	if (launchRelativeList || reentryRelativeList)
-		LaunchSoundsLoaded = true;
+	sounds.Seek(MissionTime);
+	LastTime = MissionTime;
+	nextSoundIndex = -1;
 
-	fclose(fp);
+	for (i = 0;i < sounds.Size();i++)
+	{
+		if (sounds.Event(i).LaunchRelative)
+			LaunchSoundsLoaded = true;
+	}
 }
 
 //
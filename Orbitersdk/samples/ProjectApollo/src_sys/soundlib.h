@@ -87,7 +87,7 @@ public:
 	void SetSoundData(SoundData *s);
 	void SetSoundLib(SoundLib *s) { sl = s; };
 
-	Sound& Sound::operator=(const Sound &s);
+	Sound& operator=(const Sound &s);
 
 protected:
 	int soundflags;
@@ -219,7 +219,6 @@ protected:
 	int SoundlibId;
 	int NextSlot;
 
-	friend class TimedSound;
 	friend class TimedSoundManager;
 	friend class SoundEvent;
 };
@@ -235,117 +234,10 @@ protected:
 // Timed sound sequencing.
 //
 
-///
-/// \brief Single timed sound.
-/// \ingroup Sound
-///
-class TimedSound
-{
-public:
-	TimedSound();
-	~TimedSound();
-
-	///
-	/// \brief Add a sound to the queue.
-	/// \param prev Previous TimedSound in the queue (may be NULL).
-	///
-	void AddToSoundQueue(TimedSound *prev);
-
-	///
-	/// \brief Remove this sound from the queue.
-	///
-	void RemoveFromQueue();
-
-	///
-	/// \brief Get the next sound in the queue.
-	/// \return Pointer to next sound.
-	///
-	TimedSound *GetNext() { return next; };
-
-	///
-	/// \brief Get the previous sound in the queue.
-	/// \return Pointer to previous sound.
-	///
-	TimedSound *GetPrev() { return prev; };
-
-	///
-	/// \brief Get the time at which this should be played.
-	/// \return Time to play the sound, relative to the appropriate event (launch, re-entry, etc).
-	///
-	double GetPlayTime() { return triggerTime; };
-
-	///
-	/// \brief Get the sound file name.
-	/// \return Pointer to file name (without path)
-	///
-	char *GetFilename() { return soundname; };
-
-	///
-	/// \brief Is this mandatory to play?
-	/// \return True if this should always be played.
-	///
-	bool IsMandatory() { return (priority > 8); };
-
-	///
-	/// \brief Is this purely informational, only to be played at low time acceleration?
-	/// \return True if this should be skipped when time acceleration > 1.0.
-	///
-	bool IsInformational() { return (priority < 3); };
-
-	///
-	/// \brief Get the priority level.
-	/// \return Priority level (0-9).
-	///
-	int	GetPriority() { return priority; };
-
-	///
-	/// \brief Set the time that the sound should be played.
-	/// \param t Time to play relative to apropriate event.
-	///
-	void SetPlayTime(double t) { triggerTime = t; };
-
-	///
-	/// \brief Set the filename of the associated sound file.
-	/// \param s File name without path.
-	///
-	void SetFilename(char *s);
-
-	///
-	/// \brief Set the priority of this sound.
-	/// \param n Priority, from 0 to 9.
-	///
-	void SetPriority(int n);
-
-protected:
-
-	///
-	/// \brief Sound priority.
-	///
-	int priority;
-
-	///
-	/// \brief Sound trigger time.
-	///
-	double triggerTime;
-
-	///
-	/// \brief Sound file name.
-	///
-	char soundname[256];
-
-	///
-	/// \brief Pointer to next sound in queue.
-	///
-	TimedSound *next;
-
-	///
-	/// \brief Pointer to previous sound in queue.
-	///
-	TimedSound *prev;
-};
+#include "SoundTimeline.h"
 
 ///
-/// \brief Manager code for timed playback.
+/// \brief Manager for timed sounds.
 /// \ingroup Sound
 ///
 class TimedSoundManager
@@ -375,14 +267,15 @@ public:
 
 protected:
 	///
-	/// \brief List of sounds that are launch-relative.
+	/// \brief Load a sound of the timeline into nextSound.
+	/// \param i Index of the sound in the timeline.
 	///
-	TimedSound *launchRelativeList;
+	void LoadNextSound(int i);
 
 	///
-	/// \brief List of sounds that are re-entry relative.
+	/// \brief All sounds of the data-file, sorted by time. Only launch-relative sounds are played.
 	///
-	TimedSound *reentryRelativeList;
+	SoundTimeline sounds;
 
 	///
 	/// \brief Current sound playing.
@@ -395,24 +288,14 @@ protected:
 	Sound nextSound;
 
 	///
-	/// \brief Did we load a sound to play?
-	///
-	bool SoundToPlay;
-
-	///
-	/// \brief Time to play sound.
-	///
-	double TimeToPlay;
-
-	///
-	/// \brief Is the next sound mandatory?
+	/// \brief Index of the sound loaded into nextSound, -1 if none.
 	///
-	bool SoundIsMandatory;
+	int nextSoundIndex;
 
 	///
-	/// \brief Is the next sound purely informational?
+	/// \brief Mission time of the last timestep, to find jumps in time.
 	///
-	bool SoundIsInformational;
+	double LastTime;
 
 	///
 	/// \brief Any launch-relative sounds to play?
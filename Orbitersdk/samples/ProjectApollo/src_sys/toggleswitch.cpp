@@ -42,7 +42,7 @@
 #include "apolloguidance.h"
 #include "ioChannels.h"
 #include "powersource.h"
-#include "fdai.h"
+#include "FDAI.h"
 #include "scs.h"
 #include "connector.h"
 #include "checklistController.h"